@@ -92,22 +92,39 @@ TMP_FILE = './main.c'
 # All collections that can be used for testing
 COLLECTIONS = [
     # header, library, collection, pfx, sname, size, key, val
+    {'h': '"cmc_artmap.h"',       'LIB': 'CMC', 'COLLECTION': 'ARTMAP',       'PFX': 'am',  'SNAME': 'artmap',       'SIZE': '', 'K': 'char *', 'V': 'size_t'},
     {'h': '"cmc_bitset.h"',       'LIB': 'CMC', 'COLLECTION': 'BITSET',       'PFX': 'bs',  'SNAME': 'bitset',       'SIZE': '', 'K': '',       'V': ''      },
     {'h': '"cmc_deque.h"',        'LIB': 'CMC', 'COLLECTION': 'DEQUE',        'PFX': 'd',   'SNAME': 'deque',        'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_disjointset.h"',  'LIB': 'CMC', 'COLLECTION': 'DISJOINTSET',  'PFX': 'djs', 'SNAME': 'disjointset',  'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_eliasfano.h"',    'LIB': 'CMC', 'COLLECTION': 'ELIASFANO',    'PFX': 'ef',  'SNAME': 'eliasfano',    'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_fenwicktree.h"',  'LIB': 'CMC', 'COLLECTION': 'FENWICKTREE',  'PFX': 'fwt', 'SNAME': 'fenwicktree',  'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_gapbuffer.h"',    'LIB': 'CMC', 'COLLECTION': 'GAPBUFFER',    'PFX': 'gb',  'SNAME': 'gapbuffer',    'SIZE': '', 'K': '',       'V': 'size_t'},
     {'h': '"cmc_hashbidimap.h"',  'LIB': 'CMC', 'COLLECTION': 'HASHBIDIMAP',  'PFX': 'hbm', 'SNAME': 'hashbidimap',  'SIZE': '', 'K': 'size_t', 'V': 'size_t'},
+    {'h': '"cmc_hashdisjointset.h"', 'LIB': 'CMC', 'COLLECTION': 'HASHDISJOINTSET', 'PFX': 'hdjs', 'SNAME': 'hashdisjointset', 'SIZE': '', 'K': 'size_t', 'V': ''},
     {'h': '"cmc_hashmap.h"',      'LIB': 'CMC', 'COLLECTION': 'HASHMAP',      'PFX': 'hm',  'SNAME': 'hashmap',      'SIZE': '', 'K': 'size_t', 'V': 'size_t'},
     {'h': '"cmc_hashmultimap.h"', 'LIB': 'CMC', 'COLLECTION': 'HASHMULTIMAP', 'PFX': 'hmm', 'SNAME': 'hashmultimap', 'SIZE': '', 'K': 'size_t', 'V': 'size_t'},
     {'h': '"cmc_hashmultiset.h"', 'LIB': 'CMC', 'COLLECTION': 'HASHMULTISET', 'PFX': 'hms', 'SNAME': 'hashmultiset', 'SIZE': '', 'K': '',       'V': 'size_t'},
     {'h': '"cmc_hashset.h"',      'LIB': 'CMC', 'COLLECTION': 'HASHSET',      'PFX': 'hs',  'SNAME': 'hashset',      'SIZE': '', 'K': '',       'V': 'size_t'},
     {'h': '"cmc_heap.h"',         'LIB': 'CMC', 'COLLECTION': 'HEAP',         'PFX': 'h',   'SNAME': 'heap',         'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_hyperloglog.h"',  'LIB': 'CMC', 'COLLECTION': 'HYPERLOGLOG',  'PFX': 'hll', 'SNAME': 'hyperloglog',  'SIZE': '', 'K': '',       'V': 'size_t'},
     {'h': '"cmc_intervalheap.h"', 'LIB': 'CMC', 'COLLECTION': 'INTERVALHEAP', 'PFX': 'ih',  'SNAME': 'intervalheap', 'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_intervaltree.h"', 'LIB': 'CMC', 'COLLECTION': 'INTERVALTREE', 'PFX': 'itv', 'SNAME': 'intervaltree', 'SIZE': '', 'K': 'size_t', 'V': 'size_t'},
     {'h': '"cmc_linkedlist.h"',   'LIB': 'CMC', 'COLLECTION': 'LINKEDLIST',   'PFX': 'll',  'SNAME': 'linkedlist',   'SIZE': '', 'K': '',       'V': 'size_t'},
     {'h': '"cmc_list.h"',         'LIB': 'CMC', 'COLLECTION': 'LIST',         'PFX': 'l',   'SNAME': 'list',         'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_phashmap.h"',     'LIB': 'CMC', 'COLLECTION': 'PHASHMAP',     'PFX': 'phm', 'SNAME': 'phashmap',     'SIZE': '', 'K': 'size_t', 'V': 'size_t'},
+    {'h': '"cmc_ptreemap.h"',     'LIB': 'CMC', 'COLLECTION': 'PTREEMAP',     'PFX': 'ptm', 'SNAME': 'ptreemap',     'SIZE': '', 'K': 'size_t', 'V': 'size_t'},
     {'h': '"cmc_queue.h"',        'LIB': 'CMC', 'COLLECTION': 'QUEUE',        'PFX': 'q',   'SNAME': 'queue',        'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_segmenttree.h"',  'LIB': 'CMC', 'COLLECTION': 'SEGMENTTREE',  'PFX': 'sgt', 'SNAME': 'segmenttree',  'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_slotmap.h"',      'LIB': 'CMC', 'COLLECTION': 'SLOTMAP',      'PFX': 'sm',  'SNAME': 'slotmap',      'SIZE': '', 'K': '',       'V': 'size_t'},
     {'h': '"cmc_sortedlist.h"',   'LIB': 'CMC', 'COLLECTION': 'SORTEDLIST',   'PFX': 'sl',  'SNAME': 'sortedlist',   'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_sortedmap.h"',    'LIB': 'CMC', 'COLLECTION': 'SORTEDMAP',    'PFX': 'smp', 'SNAME': 'sortedmap',    'SIZE': '', 'K': 'size_t', 'V': 'size_t'},
+    {'h': '"cmc_sparseset.h"',    'LIB': 'CMC', 'COLLECTION': 'SPARSESET',    'PFX': 'ss',  'SNAME': 'sparseset',    'SIZE': '', 'K': '',       'V': 'size_t'},
     {'h': '"cmc_stack.h"',        'LIB': 'CMC', 'COLLECTION': 'STACK',        'PFX': 's',   'SNAME': 'stack',        'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"cmc_timerwheel.h"',   'LIB': 'CMC', 'COLLECTION': 'TIMERWHEEL',   'PFX': 'tmw', 'SNAME': 'timerwheel',   'SIZE': '', 'K': '',       'V': 'size_t'},
     {'h': '"cmc_treemap.h"',      'LIB': 'CMC', 'COLLECTION': 'TREEMAP',      'PFX': 'tm',  'SNAME': 'treemap',      'SIZE': '', 'K': 'size_t', 'V': 'size_t'},
-    {'h': '"cmc_treeset.h"',      'LIB': 'CMC', 'COLLECTION': 'TREESET',      'PFX': 'ts',  'SNAME': 'treeset',      'SIZE': '', 'K': '',       'V': 'size_t'}
+    {'h': '"cmc_treeset.h"',      'LIB': 'CMC', 'COLLECTION': 'TREESET',      'PFX': 'ts',  'SNAME': 'treeset',      'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"tsc_queue.h"',        'LIB': 'TSC', 'COLLECTION': 'QUEUE',        'PFX': 'tq',  'SNAME': 'tsc_queue',    'SIZE': '', 'K': '',       'V': 'size_t'},
+    {'h': '"tsc_stack.h"',        'LIB': 'TSC', 'COLLECTION': 'STACK',        'PFX': 'tsk', 'SNAME': 'tsc_stack',    'SIZE': '', 'K': '',       'V': 'size_t'}
 ]
 
 
@@ -148,6 +165,13 @@ def full_path(path: Text) -> Text:
     return str(pathlib.Path(path).resolve())
 
 
+def test_name(data) -> Text:
+    '''
+        The name of the generated test files of a collection, e.g. 'tst_cmc_list' for "cmc_list.h"
+    '''
+    return 'tst_' + data['h'].strip('"')[:-len('.h')]
+
+
 def execute_command(commands: List[Text]):
     cmd = ' '.join(commands)
     print(cmd)
@@ -259,7 +283,7 @@ def expand_code():
                 print('Didn\'t match FLAG. Probably because compilation failed.', file=sys.stderr)
                 exit(1)
 
-            file = open(f'{OUTPUT_DIR}/{DIR_MAP[ftype]}/tst_{data["LIB"].lower()}_{data["SNAME"]}.{EXT_MAP[ftype]}', 'w')
+            file = open(f'{OUTPUT_DIR}/{DIR_MAP[ftype]}/{test_name(data)}.{EXT_MAP[ftype]}', 'w')
 
             if ftype == 'HEADER':
                 file.write(
@@ -275,7 +299,7 @@ def expand_code():
             else:
                 file.write(
                 f'''
-                    #include {'"tst_' + data["h"][1:]}
+                    #include "{test_name(data)}.h"
 
                     {match.group("code")}
                 ''')
@@ -283,7 +307,7 @@ def expand_code():
             file.flush()
             file.close()
 
-            print(f'''Generated {'"tst_' + data["h"][1:]: >24} -> {OUTPUT_DIR}/{DIR_MAP[ftype]}/tst_{data["LIB"].lower()}_{data["SNAME"]}.{EXT_MAP[ftype]}''')
+            print(f'''Generated {'"tst_' + data["h"][1:]: >24} -> {OUTPUT_DIR}/{DIR_MAP[ftype]}/{test_name(data)}.{EXT_MAP[ftype]}''')
 
     os.remove(TMP_FILE)
 
@@ -306,8 +330,8 @@ def build_main():
         cmd = [CC]
         cmd += TINCLUDE # This one needs to go first
         cmd += INCLUDE
-        cmd += ['-c', f"{SRC_DIR}/tst_{data['LIB'].lower()}_{data['SNAME']}.c"]
-        cmd += ['-o', f"{OBJ_DIR}/tst_{data['LIB'].lower()}_{data['SNAME']}.o"]
+        cmd += ['-c', f"{SRC_DIR}/{test_name(data)}.c"]
+        cmd += ['-o', f"{OBJ_DIR}/{test_name(data)}.o"]
         execute_command(cmd)
 
     # Build OUTPUT_DIR/main.c
@@ -323,7 +347,7 @@ def build_main():
     cmd += LFLAGS
     cmd += ['-o', f'{BIN_DIR}/{MAIN}.exe']
     cmd += [f'{OBJ_DIR}/main.o']
-    cmd += [f'{OBJ_DIR}/tst_{data["LIB"].lower()}_{data["SNAME"]}.o' for data in COLLECTIONS]
+    cmd += [f'{OBJ_DIR}/{test_name(data)}.o' for data in COLLECTIONS]
     execute_command(cmd)
 
 
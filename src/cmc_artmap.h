@@ -0,0 +1,1667 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_artmap.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+/**
+ * ArtMap
+ *
+ * An ArtMap is an ordered Map implemented as an Adaptive Radix Tree. Keys are
+ * turned into a sequence of bytes by the bytes function of the key function
+ * table and the tree branches on one byte per level. Inner nodes come in four
+ * sizes (4, 16, 48 and 256 children) and grow or shrink as children are added
+ * or removed, while runs of bytes with a single child are compressed into the
+ * node's prefix. This makes the cost of an operation depend on the length of
+ * the key and not on how many keys are stored.
+ *
+ * The bytes of a key must sort the same way as the key itself and no two keys
+ * may have the same bytes. A key may be a prefix of another key. Entries are
+ * also kept in a doubly linked list in key order so that the ordered
+ * iteration, the min and the max are cheap.
+ */
+
+#ifndef CMC_CMC_ARTMAP_H
+#define CMC_CMC_ARTMAP_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/* How many bytes of a compressed path are stored inside a node */
+#define CMC_ART_PREFIX 8
+
+/* Size of the buffer given to the bytes function of the key function table */
+#define CMC_ART_BUFFER 16
+
+/* Children that are entries are tagged in their lowest bit */
+#define CMC_ART_IS_ENTRY(ptr) (((uintptr_t)(ptr)) & 1)
+#define CMC_ART_ENTRY(ptr) ((void *)((uintptr_t)(ptr) & ~(uintptr_t)1))
+#define CMC_ART_TAG(ptr) ((void *)((uintptr_t)(ptr) | 1))
+
+/* The compressed path of a node, stored inline if it fits */
+#define CMC_ART_PREFIX_OF(node) ((node)->prefix_len <= CMC_ART_PREFIX ? (node)->prefix.bytes : (node)->prefix.heap)
+
+/* Kinds of inner nodes */
+enum cmc_art_kind
+{
+    CMC_ART_NODE4 = 0,
+    CMC_ART_NODE16,
+    CMC_ART_NODE48,
+    CMC_ART_NODE256
+};
+
+/**
+ * Core ArtMap implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_ARTMAP_CORE(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_CMC_ARTMAP_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_ARTMAP_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_ARTMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_ARTMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_ARTMAP_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_ARTMAP_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_ARTMAP_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    struct CMC_DEF_NODE(CMC_PARAM_SNAME(PARAMS)); \
+    struct CMC_DEF_ENTRY(CMC_PARAM_SNAME(PARAMS)); \
+    CMC_CMC_ARTMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_ARTMAP_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_ARTMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_ARTMAP_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_ARTMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_ARTMAP_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_ARTMAP_CORE_HEADER(PARAMS) \
+    CMC_CMC_ARTMAP_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_ARTMAP_CORE_SOURCE(PARAMS) \
+    CMC_CMC_ARTMAP_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_ARTMAP_CORE_STRUCT_(PFX, SNAME, K, V) \
+\
+    /* Artmap Structure */ \
+    struct SNAME \
+    { \
+        /* Root node, either an inner node or a tagged entry */ \
+        struct CMC_DEF_NODE(SNAME) * root; \
+\
+        /* Entry with the smallest key */ \
+        struct CMC_DEF_ENTRY(SNAME) * head; \
+\
+        /* Entry with the greatest key */ \
+        struct CMC_DEF_ENTRY(SNAME) * tail; \
+\
+        /* Current amount of keys */ \
+        size_t count; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Key function table */ \
+        struct CMC_DEF_FKEY(SNAME) * f_key; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    }; \
+\
+    /* Artmap Node header, shared by every kind of inner node */ \
+    struct CMC_DEF_NODE(SNAME) \
+    { \
+        /* One of enum cmc_art_kind */ \
+        unsigned char kind; \
+\
+        /* Amount of children */ \
+        uint16_t count; \
+\
+        /* Length of the compressed path */ \
+        size_t prefix_len; \
+\
+        /* Compressed path, inline when it has up to CMC_ART_PREFIX bytes */ \
+        union \
+        { \
+            unsigned char bytes[CMC_ART_PREFIX]; \
+            unsigned char *heap; \
+        } prefix; \
+\
+        /* Entry whose key ends exactly at this node */ \
+        struct CMC_DEF_ENTRY(SNAME) * entry; \
+    }; \
+\
+    /* Node with up to 4 children sorted by key */ \
+    struct CMC_(SNAME, _node4) \
+    { \
+        struct CMC_DEF_NODE(SNAME) header; \
+        unsigned char keys[4]; \
+        struct CMC_DEF_NODE(SNAME) * children[4]; \
+    }; \
+\
+    /* Node with up to 16 children sorted by key */ \
+    struct CMC_(SNAME, _node16) \
+    { \
+        struct CMC_DEF_NODE(SNAME) header; \
+        unsigned char keys[16]; \
+        struct CMC_DEF_NODE(SNAME) * children[16]; \
+    }; \
+\
+    /* Node with up to 48 children, index maps a byte to its slot plus one */ \
+    struct CMC_(SNAME, _node48) \
+    { \
+        struct CMC_DEF_NODE(SNAME) header; \
+        unsigned char index[256]; \
+        struct CMC_DEF_NODE(SNAME) * children[48]; \
+    }; \
+\
+    /* Node with a child for each possible byte */ \
+    struct CMC_(SNAME, _node256) \
+    { \
+        struct CMC_DEF_NODE(SNAME) header; \
+        struct CMC_DEF_NODE(SNAME) * children[256]; \
+    }; \
+\
+    /* Artmap Entry */ \
+    struct CMC_DEF_ENTRY(SNAME) \
+    { \
+        /* Entry Key */ \
+        K key; \
+\
+        /* Entry Value */ \
+        V value; \
+\
+        /* Previous entry in key order */ \
+        struct CMC_DEF_ENTRY(SNAME) * prev; \
+\
+        /* Next entry in key order */ \
+        struct CMC_DEF_ENTRY(SNAME) * next; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_ARTMAP_CORE_HEADER_(PFX, SNAME, K, V) \
+\
+    /* Key struct function table */ \
+    struct CMC_DEF_FKEY(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(K); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(K); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(K); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(K); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(K); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(K); \
+\
+        /* Binary-comparable bytes function */ \
+        CMC_DEF_FTAB_BYTES(K); \
+    }; \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _clear)(struct SNAME * _map_); \
+    void CMC_(PFX, _free)(struct SNAME * _map_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value); \
+    bool CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value); \
+    bool CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value); \
+    /* Element Access */ \
+    bool CMC_(PFX, _max)(struct SNAME * _map_, K * key, V * value); \
+    bool CMC_(PFX, _min)(struct SNAME * _map_, K * key, V * value); \
+    V CMC_(PFX, _get)(struct SNAME * _map_, K key); \
+    V *CMC_(PFX, _get_ref)(struct SNAME * _map_, K key); \
+    bool CMC_(PFX, _longest_prefix)(struct SNAME * _map_, K key, K * out_key, V * out_value); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, K key); \
+    bool CMC_(PFX, _empty)(struct SNAME * _map_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _map_); \
+    int CMC_(PFX, _flag)(struct SNAME * _map_); \
+    /* Collection Utility */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_ARTMAP_CORE_SOURCE_(PFX, SNAME, K, V) \
+\
+    /* Implementation Detail Functions */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_new_node)(struct SNAME * _map_, unsigned char kind); \
+    static void CMC_(PFX, _impl_free_node)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node); \
+    static void CMC_(PFX, _impl_free_tree)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node); \
+    static bool CMC_(PFX, _impl_set_prefix)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, \
+                                            const unsigned char *bytes, size_t length); \
+    static struct CMC_DEF_NODE(SNAME) * *CMC_(PFX, _impl_find_child)(struct CMC_DEF_NODE(SNAME) * node, \
+                                                                     unsigned char byte); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_child_from)(struct CMC_DEF_NODE(SNAME) * node, size_t from); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_last_child)(struct CMC_DEF_NODE(SNAME) * node); \
+    static bool CMC_(PFX, _impl_add_child)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * *ref, \
+                                           unsigned char byte, struct CMC_DEF_NODE(SNAME) * child); \
+    static void CMC_(PFX, _impl_remove_child)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * *ref, \
+                                              unsigned char byte); \
+    static void CMC_(PFX, _impl_compact)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * *ref); \
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_min)(struct CMC_DEF_NODE(SNAME) * node); \
+    static bool CMC_(PFX, _impl_insert)(struct SNAME * _map_, struct CMC_DEF_ENTRY(SNAME) * entry); \
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_entry)(struct SNAME * _map_, K key); \
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_upper)(struct SNAME * _map_, const unsigned char *bytes, \
+                                                                 size_t length); \
+\
+    struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(f_key, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!f_key || !f_val || !f_key->bytes) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_map_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_map_) \
+            return NULL; \
+\
+        _map_->root = NULL; \
+        _map_->head = NULL; \
+        _map_->tail = NULL; \
+        _map_->count = 0; \
+        _map_->flag = CMC_FLAG_OK; \
+        _map_->f_key = f_key; \
+        _map_->f_val = f_val; \
+        _map_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        return _map_; \
+    } \
+\
+    void CMC_(PFX, _clear)(struct SNAME * _map_) \
+    { \
+        struct CMC_DEF_ENTRY(SNAME) *scan = _map_->head; \
+\
+        while (scan != NULL) \
+        { \
+            struct CMC_DEF_ENTRY(SNAME) *next = scan->next; \
+\
+            if (_map_->f_key->free) \
+                _map_->f_key->free(scan->key); \
+            if (_map_->f_val->free) \
+                _map_->f_val->free(scan->value); \
+\
+            _map_->alloc->free(scan); \
+\
+            scan = next; \
+        } \
+\
+        CMC_(PFX, _impl_free_tree)(_map_, _map_->root); \
+\
+        _map_->root = NULL; \
+        _map_->head = NULL; \
+        _map_->tail = NULL; \
+        _map_->count = 0; \
+        _map_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _map_) \
+    { \
+        CMC_(PFX, _clear)(_map_); \
+\
+        _map_->alloc->free(_map_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _map_->alloc = &cmc_alloc_node_default; \
+        else \
+            _map_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        _map_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value) \
+    { \
+        struct CMC_DEF_ENTRY(SNAME) *entry = _map_->alloc->malloc(sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+\
+        if (!entry) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        entry->key = key; \
+        entry->value = value; \
+        entry->prev = NULL; \
+        entry->next = NULL; \
+\
+        if (!CMC_(PFX, _impl_insert)(_map_, entry)) \
+        { \
+            _map_->alloc->free(entry); \
+            return false; \
+        } \
+\
+        _map_->count++; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *entry = CMC_(PFX, _impl_get_entry)(_map_, key); \
+\
+        if (!entry) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (old_value) \
+            *old_value = entry->value; \
+\
+        entry->value = new_value; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, update); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        unsigned char buffer[CMC_ART_BUFFER]; \
+        size_t length; \
+        const unsigned char *bytes = _map_->f_key->bytes(&key, buffer, &length); \
+\
+        struct CMC_DEF_NODE(SNAME) **ref = &_map_->root; \
+        struct CMC_DEF_NODE(SNAME) **parent = NULL; \
+        struct CMC_DEF_ENTRY(SNAME) *entry = NULL; \
+        unsigned char byte = 0; \
+        size_t depth = 0; \
+\
+        while (*ref) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *node = *ref; \
+\
+            if (CMC_ART_IS_ENTRY(node)) \
+            { \
+                struct CMC_DEF_ENTRY(SNAME) *leaf = CMC_ART_ENTRY(node); \
+\
+                if (_map_->f_key->cmp(leaf->key, key) != 0) \
+                    break; \
+\
+                entry = leaf; \
+\
+                if (!parent) \
+                    _map_->root = NULL; \
+                else \
+                    CMC_(PFX, _impl_remove_child)(_map_, parent, byte); \
+\
+                break; \
+            } \
+\
+            if (length - depth < node->prefix_len || \
+                memcmp(CMC_ART_PREFIX_OF(node), bytes + depth, node->prefix_len) != 0) \
+                break; \
+\
+            depth += node->prefix_len; \
+\
+            if (depth == length) \
+            { \
+                entry = node->entry; \
+\
+                if (entry) \
+                { \
+                    node->entry = NULL; \
+                    CMC_(PFX, _impl_compact)(_map_, ref); \
+                } \
+\
+                break; \
+            } \
+\
+            struct CMC_DEF_NODE(SNAME) **child = CMC_(PFX, _impl_find_child)(node, bytes[depth]); \
+\
+            if (!child) \
+                break; \
+\
+            parent = ref; \
+            byte = bytes[depth]; \
+            ref = child; \
+            depth++; \
+        } \
+\
+        if (!entry) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (entry->prev) \
+            entry->prev->next = entry->next; \
+        else \
+            _map_->head = entry->next; \
+\
+        if (entry->next) \
+            entry->next->prev = entry->prev; \
+        else \
+            _map_->tail = entry->prev; \
+\
+        if (out_value) \
+            *out_value = entry->value; \
+\
+        _map_->alloc->free(entry); \
+\
+        _map_->count--; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, delete); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _max)(struct SNAME * _map_, K * key, V * value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        if (key) \
+            *key = _map_->tail->key; \
+        if (value) \
+            *value = _map_->tail->value; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _min)(struct SNAME * _map_, K * key, V * value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        if (key) \
+            *key = _map_->head->key; \
+        if (value) \
+            *value = _map_->head->value; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _map_, K key) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *entry = CMC_(PFX, _impl_get_entry)(_map_, key); \
+\
+        if (!entry) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return (V){ 0 }; \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return entry->value; \
+    } \
+\
+    V *CMC_(PFX, _get_ref)(struct SNAME * _map_, K key) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return NULL; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *entry = CMC_(PFX, _impl_get_entry)(_map_, key); \
+\
+        if (!entry) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return NULL; \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return &(entry->value); \
+    } \
+\
+    bool CMC_(PFX, _longest_prefix)(struct SNAME * _map_, K key, K * out_key, V * out_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        unsigned char buffer[CMC_ART_BUFFER]; \
+        unsigned char other[CMC_ART_BUFFER]; \
+        size_t length, other_length; \
+        const unsigned char *bytes = _map_->f_key->bytes(&key, buffer, &length); \
+\
+        struct CMC_DEF_NODE(SNAME) *node = _map_->root; \
+        struct CMC_DEF_ENTRY(SNAME) *best = NULL; \
+        size_t depth = 0; \
+\
+        while (node) \
+        { \
+            if (CMC_ART_IS_ENTRY(node)) \
+            { \
+                struct CMC_DEF_ENTRY(SNAME) *leaf = CMC_ART_ENTRY(node); \
+                const unsigned char *leaf_bytes = _map_->f_key->bytes(&leaf->key, other, &other_length); \
+\
+                if (other_length <= length && memcmp(leaf_bytes, bytes, other_length) == 0) \
+                    best = leaf; \
+\
+                break; \
+            } \
+\
+            if (length - depth < node->prefix_len || \
+                memcmp(CMC_ART_PREFIX_OF(node), bytes + depth, node->prefix_len) != 0) \
+                break; \
+\
+            depth += node->prefix_len; \
+\
+            /* Every byte on the path matched so this entry is a prefix of key */ \
+            if (node->entry) \
+                best = node->entry; \
+\
+            if (depth == length) \
+                break; \
+\
+            struct CMC_DEF_NODE(SNAME) **child = CMC_(PFX, _impl_find_child)(node, bytes[depth]); \
+\
+            if (!child) \
+                break; \
+\
+            node = *child; \
+            depth++; \
+        } \
+\
+        if (!best) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (out_key) \
+            *out_key = best->key; \
+        if (out_value) \
+            *out_value = best->value; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, K key) \
+    { \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        bool result = CMC_(PFX, _impl_get_entry)(_map_, key) != NULL; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _map_) \
+    { \
+        return _map_->count == 0; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _map_) \
+    { \
+        return _map_->count; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _map_) \
+    { \
+        return _map_->flag; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_) \
+    { \
+        /* Callback will be added later */ \
+        struct SNAME *result = CMC_(PFX, _new_custom)(_map_->f_key, _map_->f_val, _map_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _map_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        for (struct CMC_DEF_ENTRY(SNAME) *scan = _map_->head; scan; scan = scan->next) \
+        { \
+            K key = _map_->f_key->cpy ? _map_->f_key->cpy(scan->key) : scan->key; \
+            V value = _map_->f_val->cpy ? _map_->f_val->cpy(scan->value) : scan->value; \
+\
+            if (!CMC_(PFX, _insert)(result, key, value)) \
+            { \
+                if (_map_->f_key->cpy && _map_->f_key->free) \
+                    _map_->f_key->free(key); \
+                if (_map_->f_val->cpy && _map_->f_val->free) \
+                    _map_->f_val->free(value); \
+\
+                CMC_(PFX, _free)(result); \
+\
+                _map_->flag = CMC_FLAG_ALLOC; \
+                return NULL; \
+            } \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_ASSIGN(result, _map_->callbacks); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_) \
+    { \
+        _map1_->flag = CMC_FLAG_OK; \
+        _map2_->flag = CMC_FLAG_OK; \
+\
+        if (_map1_->count != _map2_->count) \
+            return false; \
+\
+        /* Both lists are in key order so they can be compared side by side */ \
+        struct CMC_DEF_ENTRY(SNAME) *scan1 = _map1_->head; \
+        struct CMC_DEF_ENTRY(SNAME) *scan2 = _map2_->head; \
+\
+        while (scan1 && scan2) \
+        { \
+            if (_map1_->f_key->cmp(scan1->key, scan2->key) != 0) \
+                return false; \
+\
+            if (_map1_->f_val->cmp(scan1->value, scan2->value) != 0) \
+                return false; \
+\
+            scan1 = scan1->next; \
+            scan2 = scan2->next; \
+        } \
+\
+        return true; \
+    } \
+\
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_new_node)(struct SNAME * _map_, unsigned char kind) \
+    { \
+        size_t size; \
+\
+        switch (kind) \
+        { \
+        case CMC_ART_NODE4: \
+            size = sizeof(struct CMC_(SNAME, _node4)); \
+            break; \
+        case CMC_ART_NODE16: \
+            size = sizeof(struct CMC_(SNAME, _node16)); \
+            break; \
+        case CMC_ART_NODE48: \
+            size = sizeof(struct CMC_(SNAME, _node48)); \
+            break; \
+        default: \
+            size = sizeof(struct CMC_(SNAME, _node256)); \
+            break; \
+        } \
+\
+        /* Zeroed so that every child slot and index starts empty */ \
+        struct CMC_DEF_NODE(SNAME) *node = _map_->alloc->calloc(1, size); \
+\
+        if (!node) \
+            return NULL; \
+\
+        node->kind = kind; \
+\
+        return node; \
+    } \
+\
+    static void CMC_(PFX, _impl_free_node)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (node->prefix_len > CMC_ART_PREFIX) \
+            _map_->alloc->free(node->prefix.heap); \
+\
+        _map_->alloc->free(node); \
+    } \
+\
+    static void CMC_(PFX, _impl_free_tree)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        /* Entries are freed through the linked list */ \
+        if (!node || CMC_ART_IS_ENTRY(node)) \
+            return; \
+\
+        struct CMC_DEF_NODE(SNAME) **children; \
+        size_t slots; \
+\
+        switch (node->kind) \
+        { \
+        case CMC_ART_NODE4: \
+            children = ((struct CMC_(SNAME, _node4) *)node)->children; \
+            slots = node->count; \
+            break; \
+        case CMC_ART_NODE16: \
+            children = ((struct CMC_(SNAME, _node16) *)node)->children; \
+            slots = node->count; \
+            break; \
+        case CMC_ART_NODE48: \
+            children = ((struct CMC_(SNAME, _node48) *)node)->children; \
+            slots = 48; \
+            break; \
+        default: \
+            children = ((struct CMC_(SNAME, _node256) *)node)->children; \
+            slots = 256; \
+            break; \
+        } \
+\
+        for (size_t i = 0; i < slots; i++) \
+            CMC_(PFX, _impl_free_tree)(_map_, children[i]); \
+\
+        CMC_(PFX, _impl_free_node)(_map_, node); \
+    } \
+\
+    static bool CMC_(PFX, _impl_set_prefix)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, \
+                                            const unsigned char *bytes, size_t length) \
+    { \
+        /* bytes might point inside the current prefix so it is only released at the end */ \
+        unsigned char *old = node->prefix_len > CMC_ART_PREFIX ? node->prefix.heap : NULL; \
+\
+        if (length > CMC_ART_PREFIX) \
+        { \
+            unsigned char *heap = _map_->alloc->malloc(length); \
+\
+            if (!heap) \
+                return false; \
+\
+            memcpy(heap, bytes, length); \
+\
+            node->prefix.heap = heap; \
+        } \
+        else \
+            memmove(node->prefix.bytes, bytes, length); \
+\
+        node->prefix_len = length; \
+\
+        if (old) \
+            _map_->alloc->free(old); \
+\
+        return true; \
+    } \
+\
+    static struct CMC_DEF_NODE(SNAME) * *CMC_(PFX, _impl_find_child)(struct CMC_DEF_NODE(SNAME) * node, \
+                                                                     unsigned char byte) \
+    { \
+        switch (node->kind) \
+        { \
+        case CMC_ART_NODE4: { \
+            struct CMC_(SNAME, _node4) *n = (struct CMC_(SNAME, _node4) *)node; \
+\
+            for (size_t i = 0; i < node->count; i++) \
+            { \
+                if (n->keys[i] == byte) \
+                    return &n->children[i]; \
+            } \
+\
+            return NULL; \
+        } \
+        case CMC_ART_NODE16: { \
+            struct CMC_(SNAME, _node16) *n = (struct CMC_(SNAME, _node16) *)node; \
+\
+            for (size_t i = 0; i < node->count; i++) \
+            { \
+                if (n->keys[i] == byte) \
+                    return &n->children[i]; \
+            } \
+\
+            return NULL; \
+        } \
+        case CMC_ART_NODE48: { \
+            struct CMC_(SNAME, _node48) *n = (struct CMC_(SNAME, _node48) *)node; \
+\
+            return n->index[byte] ? &n->children[n->index[byte] - 1] : NULL; \
+        } \
+        default: { \
+            struct CMC_(SNAME, _node256) *n = (struct CMC_(SNAME, _node256) *)node; \
+\
+            return n->children[byte] ? &n->children[byte] : NULL; \
+        } \
+        } \
+    } \
+\
+    /* The child with the smallest byte that is greater than or equal to from */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_child_from)(struct CMC_DEF_NODE(SNAME) * node, size_t from) \
+    { \
+        switch (node->kind) \
+        { \
+        case CMC_ART_NODE4: { \
+            struct CMC_(SNAME, _node4) *n = (struct CMC_(SNAME, _node4) *)node; \
+\
+            for (size_t i = 0; i < node->count; i++) \
+            { \
+                if (n->keys[i] >= from) \
+                    return n->children[i]; \
+            } \
+\
+            return NULL; \
+        } \
+        case CMC_ART_NODE16: { \
+            struct CMC_(SNAME, _node16) *n = (struct CMC_(SNAME, _node16) *)node; \
+\
+            for (size_t i = 0; i < node->count; i++) \
+            { \
+                if (n->keys[i] >= from) \
+                    return n->children[i]; \
+            } \
+\
+            return NULL; \
+        } \
+        case CMC_ART_NODE48: { \
+            struct CMC_(SNAME, _node48) *n = (struct CMC_(SNAME, _node48) *)node; \
+\
+            for (size_t b = from; b < 256; b++) \
+            { \
+                if (n->index[b]) \
+                    return n->children[n->index[b] - 1]; \
+            } \
+\
+            return NULL; \
+        } \
+        default: { \
+            struct CMC_(SNAME, _node256) *n = (struct CMC_(SNAME, _node256) *)node; \
+\
+            for (size_t b = from; b < 256; b++) \
+            { \
+                if (n->children[b]) \
+                    return n->children[b]; \
+            } \
+\
+            return NULL; \
+        } \
+        } \
+    } \
+\
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_last_child)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        switch (node->kind) \
+        { \
+        case CMC_ART_NODE4: \
+            return node->count ? ((struct CMC_(SNAME, _node4) *)node)->children[node->count - 1] : NULL; \
+        case CMC_ART_NODE16: \
+            return node->count ? ((struct CMC_(SNAME, _node16) *)node)->children[node->count - 1] : NULL; \
+        case CMC_ART_NODE48: { \
+            struct CMC_(SNAME, _node48) *n = (struct CMC_(SNAME, _node48) *)node; \
+\
+            for (size_t b = 256; b > 0; b--) \
+            { \
+                if (n->index[b - 1]) \
+                    return n->children[n->index[b - 1] - 1]; \
+            } \
+\
+            return NULL; \
+        } \
+        default: { \
+            struct CMC_(SNAME, _node256) *n = (struct CMC_(SNAME, _node256) *)node; \
+\
+            for (size_t b = 256; b > 0; b--) \
+            { \
+                if (n->children[b - 1]) \
+                    return n->children[b - 1]; \
+            } \
+\
+            return NULL; \
+        } \
+        } \
+    } \
+\
+    /* Adds a child to the node at ref, which is replaced by a bigger one if full */ \
+    static bool CMC_(PFX, _impl_add_child)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * *ref, \
+                                           unsigned char byte, struct CMC_DEF_NODE(SNAME) * child) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *node = *ref; \
+\
+        switch (node->kind) \
+        { \
+        case CMC_ART_NODE4: { \
+            struct CMC_(SNAME, _node4) *n = (struct CMC_(SNAME, _node4) *)node; \
+\
+            if (node->count < 4) \
+            { \
+                size_t i = 0; \
+\
+                while (i < node->count && n->keys[i] < byte) \
+                    i++; \
+\
+                memmove(n->keys + i + 1, n->keys + i, node->count - i); \
+                memmove(n->children + i + 1, n->children + i, (node->count - i) * sizeof(n->children[0])); \
+\
+                n->keys[i] = byte; \
+                n->children[i] = child; \
+                node->count++; \
+\
+                return true; \
+            } \
+\
+            struct CMC_(SNAME, _node16) *bigger = \
+                (struct CMC_(SNAME, _node16) *)CMC_(PFX, _impl_new_node)(_map_, CMC_ART_NODE16); \
+\
+            if (!bigger) \
+                return false; \
+\
+            /* The header, including a heap allocated prefix, moves to the new node */ \
+            bigger->header = n->header; \
+            bigger->header.kind = CMC_ART_NODE16; \
+\
+            memcpy(bigger->keys, n->keys, 4); \
+            memcpy(bigger->children, n->children, 4 * sizeof(n->children[0])); \
+\
+            *ref = &bigger->header; \
+            _map_->alloc->free(n); \
+\
+            return CMC_(PFX, _impl_add_child)(_map_, ref, byte, child); \
+        } \
+        case CMC_ART_NODE16: { \
+            struct CMC_(SNAME, _node16) *n = (struct CMC_(SNAME, _node16) *)node; \
+\
+            if (node->count < 16) \
+            { \
+                size_t i = 0; \
+\
+                while (i < node->count && n->keys[i] < byte) \
+                    i++; \
+\
+                memmove(n->keys + i + 1, n->keys + i, node->count - i); \
+                memmove(n->children + i + 1, n->children + i, (node->count - i) * sizeof(n->children[0])); \
+\
+                n->keys[i] = byte; \
+                n->children[i] = child; \
+                node->count++; \
+\
+                return true; \
+            } \
+\
+            struct CMC_(SNAME, _node48) *bigger = \
+                (struct CMC_(SNAME, _node48) *)CMC_(PFX, _impl_new_node)(_map_, CMC_ART_NODE48); \
+\
+            if (!bigger) \
+                return false; \
+\
+            bigger->header = n->header; \
+            bigger->header.kind = CMC_ART_NODE48; \
+\
+            for (size_t i = 0; i < 16; i++) \
+            { \
+                bigger->index[n->keys[i]] = (unsigned char)(i + 1); \
+                bigger->children[i] = n->children[i]; \
+            } \
+\
+            *ref = &bigger->header; \
+            _map_->alloc->free(n); \
+\
+            return CMC_(PFX, _impl_add_child)(_map_, ref, byte, child); \
+        } \
+        case CMC_ART_NODE48: { \
+            struct CMC_(SNAME, _node48) *n = (struct CMC_(SNAME, _node48) *)node; \
+\
+            if (node->count < 48) \
+            { \
+                size_t slot = 0; \
+\
+                while (n->children[slot]) \
+                    slot++; \
+\
+                n->index[byte] = (unsigned char)(slot + 1); \
+                n->children[slot] = child; \
+                node->count++; \
+\
+                return true; \
+            } \
+\
+            struct CMC_(SNAME, _node256) *bigger = \
+                (struct CMC_(SNAME, _node256) *)CMC_(PFX, _impl_new_node)(_map_, CMC_ART_NODE256); \
+\
+            if (!bigger) \
+                return false; \
+\
+            bigger->header = n->header; \
+            bigger->header.kind = CMC_ART_NODE256; \
+\
+            for (size_t b = 0; b < 256; b++) \
+            { \
+                if (n->index[b]) \
+                    bigger->children[b] = n->children[n->index[b] - 1]; \
+            } \
+\
+            *ref = &bigger->header; \
+            _map_->alloc->free(n); \
+\
+            return CMC_(PFX, _impl_add_child)(_map_, ref, byte, child); \
+        } \
+        default: { \
+            struct CMC_(SNAME, _node256) *n = (struct CMC_(SNAME, _node256) *)node; \
+\
+            n->children[byte] = child; \
+            node->count++; \
+\
+            return true; \
+        } \
+        } \
+    } \
+\
+    /* Removes a child from the node at ref, which is shrunk or collapsed when it gets too sparse */ \
+    static void CMC_(PFX, _impl_remove_child)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * *ref, \
+                                              unsigned char byte) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *node = *ref; \
+\
+        switch (node->kind) \
+        { \
+        case CMC_ART_NODE4: { \
+            struct CMC_(SNAME, _node4) *n = (struct CMC_(SNAME, _node4) *)node; \
+\
+            size_t i = 0; \
+\
+            while (n->keys[i] != byte) \
+                i++; \
+\
+            memmove(n->keys + i, n->keys + i + 1, node->count - i - 1); \
+            memmove(n->children + i, n->children + i + 1, (node->count - i - 1) * sizeof(n->children[0])); \
+\
+            node->count--; \
+\
+            break; \
+        } \
+        case CMC_ART_NODE16: { \
+            struct CMC_(SNAME, _node16) *n = (struct CMC_(SNAME, _node16) *)node; \
+\
+            size_t i = 0; \
+\
+            while (n->keys[i] != byte) \
+                i++; \
+\
+            memmove(n->keys + i, n->keys + i + 1, node->count - i - 1); \
+            memmove(n->children + i, n->children + i + 1, (node->count - i - 1) * sizeof(n->children[0])); \
+\
+            node->count--; \
+\
+            /* Shrinking to a smaller node is only an optimization, so it is */ \
+            /* fine to keep the current one if the allocation fails */ \
+            if (node->count == 3) \
+            { \
+                struct CMC_(SNAME, _node4) *smaller = \
+                    (struct CMC_(SNAME, _node4) *)CMC_(PFX, _impl_new_node)(_map_, CMC_ART_NODE4); \
+\
+                if (smaller) \
+                { \
+                    smaller->header = n->header; \
+                    smaller->header.kind = CMC_ART_NODE4; \
+\
+                    memcpy(smaller->keys, n->keys, 3); \
+                    memcpy(smaller->children, n->children, 3 * sizeof(n->children[0])); \
+\
+                    *ref = &smaller->header; \
+                    _map_->alloc->free(n); \
+                } \
+            } \
+\
+            break; \
+        } \
+        case CMC_ART_NODE48: { \
+            struct CMC_(SNAME, _node48) *n = (struct CMC_(SNAME, _node48) *)node; \
+\
+            n->children[n->index[byte] - 1] = NULL; \
+            n->index[byte] = 0; \
+\
+            node->count--; \
+\
+            if (node->count == 12) \
+            { \
+                struct CMC_(SNAME, _node16) *smaller = \
+                    (struct CMC_(SNAME, _node16) *)CMC_(PFX, _impl_new_node)(_map_, CMC_ART_NODE16); \
+\
+                if (smaller) \
+                { \
+                    smaller->header = n->header; \
+                    smaller->header.kind = CMC_ART_NODE16; \
+\
+                    size_t i = 0; \
+\
+                    for (size_t b = 0; b < 256; b++) \
+                    { \
+                        if (n->index[b]) \
+                        { \
+                            smaller->keys[i] = (unsigned char)b; \
+                            smaller->children[i] = n->children[n->index[b] - 1]; \
+                            i++; \
+                        } \
+                    } \
+\
+                    *ref = &smaller->header; \
+                    _map_->alloc->free(n); \
+                } \
+            } \
+\
+            break; \
+        } \
+        default: { \
+            struct CMC_(SNAME, _node256) *n = (struct CMC_(SNAME, _node256) *)node; \
+\
+            n->children[byte] = NULL; \
+\
+            node->count--; \
+\
+            if (node->count == 37) \
+            { \
+                struct CMC_(SNAME, _node48) *smaller = \
+                    (struct CMC_(SNAME, _node48) *)CMC_(PFX, _impl_new_node)(_map_, CMC_ART_NODE48); \
+\
+                if (smaller) \
+                { \
+                    smaller->header = n->header; \
+                    smaller->header.kind = CMC_ART_NODE48; \
+\
+                    size_t slot = 0; \
+\
+                    for (size_t b = 0; b < 256; b++) \
+                    { \
+                        if (n->children[b]) \
+                        { \
+                            smaller->children[slot] = n->children[b]; \
+                            smaller->index[b] = (unsigned char)(++slot); \
+                        } \
+                    } \
+\
+                    *ref = &smaller->header; \
+                    _map_->alloc->free(n); \
+                } \
+            } \
+\
+            break; \
+        } \
+        } \
+\
+        CMC_(PFX, _impl_compact)(_map_, ref); \
+    } \
+\
+    /* Collapses the node at ref if it no longer needs to branch */ \
+    static void CMC_(PFX, _impl_compact)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * *ref) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *node = *ref; \
+\
+        if (node->count == 0) \
+        { \
+            /* Entries don't need to be at their full depth, so it can take */ \
+            /* the place of its node */ \
+            *ref = node->entry ? CMC_ART_TAG(node->entry) : NULL; \
+\
+            CMC_(PFX, _impl_free_node)(_map_, node); \
+        } \
+        else if (node->count == 1 && !node->entry && node->kind == CMC_ART_NODE4) \
+        { \
+            struct CMC_(SNAME, _node4) *n = (struct CMC_(SNAME, _node4) *)node; \
+            struct CMC_DEF_NODE(SNAME) *child = n->children[0]; \
+\
+            if (CMC_ART_IS_ENTRY(child)) \
+            { \
+                *ref = child; \
+\
+                CMC_(PFX, _impl_free_node)(_map_, node); \
+\
+                return; \
+            } \
+\
+            /* Merge the path of node, the byte to its child and the path of */ \
+            /* the child into the child's prefix */ \
+            size_t length = node->prefix_len + 1 + child->prefix_len; \
+\
+            unsigned char small[CMC_ART_PREFIX]; \
+            unsigned char *path = small; \
+\
+            if (length > CMC_ART_PREFIX) \
+            { \
+                path = _map_->alloc->malloc(length); \
+\
+                /* The node is kept as it is, which is still valid */ \
+                if (!path) \
+                    return; \
+            } \
+\
+            memcpy(path, CMC_ART_PREFIX_OF(node), node->prefix_len); \
+            path[node->prefix_len] = n->keys[0]; \
+            memcpy(path + node->prefix_len + 1, CMC_ART_PREFIX_OF(child), child->prefix_len); \
+\
+            if (CMC_(PFX, _impl_set_prefix)(_map_, child, path, length)) \
+            { \
+                *ref = child; \
+\
+                CMC_(PFX, _impl_free_node)(_map_, node); \
+            } \
+\
+            if (path != small) \
+                _map_->alloc->free(path); \
+        } \
+    } \
+\
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_min)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        while (node && !CMC_ART_IS_ENTRY(node)) \
+        { \
+            /* The entry of a node is smaller than anything below it */ \
+            if (node->entry) \
+                return node->entry; \
+\
+            node = CMC_(PFX, _impl_child_from)(node, 0); \
+        } \
+\
+        return node ? CMC_ART_ENTRY(node) : NULL; \
+    } \
+\
+    /* Places the entry in the tree and links it between its neighbours */ \
+    static bool CMC_(PFX, _impl_insert)(struct SNAME * _map_, struct CMC_DEF_ENTRY(SNAME) * entry) \
+    { \
+        unsigned char buffer[CMC_ART_BUFFER]; \
+        unsigned char other[CMC_ART_BUFFER]; \
+        size_t length, other_length; \
+        const unsigned char *bytes = _map_->f_key->bytes(&entry->key, buffer, &length); \
+\
+        struct CMC_DEF_NODE(SNAME) **ref = &_map_->root; \
+        size_t depth = 0; \
+\
+        while (true) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *node = *ref; \
+\
+            if (!node) \
+            { \
+                *ref = CMC_ART_TAG(entry); \
+                break; \
+            } \
+\
+            if (CMC_ART_IS_ENTRY(node)) \
+            { \
+                /* Both keys go under a new node holding their common bytes */ \
+                struct CMC_DEF_ENTRY(SNAME) *leaf = CMC_ART_ENTRY(node); \
+                const unsigned char *leaf_bytes = _map_->f_key->bytes(&leaf->key, other, &other_length); \
+\
+                size_t limit = length < other_length ? length : other_length; \
+                size_t common = depth; \
+\
+                while (common < limit && bytes[common] == leaf_bytes[common]) \
+                    common++; \
+\
+                if (common == length && common == other_length) \
+                { \
+                    _map_->flag = CMC_FLAG_DUPLICATE; \
+                    return false; \
+                } \
+\
+                struct CMC_DEF_NODE(SNAME) *split = CMC_(PFX, _impl_new_node)(_map_, CMC_ART_NODE4); \
+\
+                if (!split) \
+                { \
+                    _map_->flag = CMC_FLAG_ALLOC; \
+                    return false; \
+                } \
+\
+                if (!CMC_(PFX, _impl_set_prefix)(_map_, split, bytes + depth, common - depth)) \
+                { \
+                    CMC_(PFX, _impl_free_node)(_map_, split); \
+\
+                    _map_->flag = CMC_FLAG_ALLOC; \
+                    return false; \
+                } \
+\
+                /* A fresh Node4 has room, so adding children can't fail */ \
+                if (common == other_length) \
+                    split->entry = leaf; \
+                else \
+                    CMC_(PFX, _impl_add_child)(_map_, &split, leaf_bytes[common], node); \
+\
+                if (common == length) \
+                    split->entry = entry; \
+                else \
+                    CMC_(PFX, _impl_add_child)(_map_, &split, bytes[common], CMC_ART_TAG(entry)); \
+\
+                *ref = split; \
+                break; \
+            } \
+\
+            const unsigned char *prefix = CMC_ART_PREFIX_OF(node); \
+            size_t limit = node->prefix_len < length - depth ? node->prefix_len : length - depth; \
+            size_t p = 0; \
+\
+            while (p < limit && prefix[p] == bytes[depth + p]) \
+                p++; \
+\
+            if (p < node->prefix_len) \
+            { \
+                /* The key leaves the compressed path at p */ \
+                struct CMC_DEF_NODE(SNAME) *split = CMC_(PFX, _impl_new_node)(_map_, CMC_ART_NODE4); \
+\
+                if (!split) \
+                { \
+                    _map_->flag = CMC_FLAG_ALLOC; \
+                    return false; \
+                } \
+\
+                if (!CMC_(PFX, _impl_set_prefix)(_map_, split, prefix, p)) \
+                { \
+                    CMC_(PFX, _impl_free_node)(_map_, split); \
+\
+                    _map_->flag = CMC_FLAG_ALLOC; \
+                    return false; \
+                } \
+\
+                unsigned char byte = prefix[p]; \
+\
+                if (!CMC_(PFX, _impl_set_prefix)(_map_, node, prefix + p + 1, node->prefix_len - p - 1)) \
+                { \
+                    CMC_(PFX, _impl_free_node)(_map_, split); \
+\
+                    _map_->flag = CMC_FLAG_ALLOC; \
+                    return false; \
+                } \
+\
+                CMC_(PFX, _impl_add_child)(_map_, &split, byte, node); \
+\
+                if (depth + p == length) \
+                    split->entry = entry; \
+                else \
+                    CMC_(PFX, _impl_add_child)(_map_, &split, bytes[depth + p], CMC_ART_TAG(entry)); \
+\
+                *ref = split; \
+                break; \
+            } \
+\
+            depth += node->prefix_len; \
+\
+            if (depth == length) \
+            { \
+                if (node->entry) \
+                { \
+                    _map_->flag = CMC_FLAG_DUPLICATE; \
+                    return false; \
+                } \
+\
+                node->entry = entry; \
+                break; \
+            } \
+\
+            struct CMC_DEF_NODE(SNAME) **child = CMC_(PFX, _impl_find_child)(node, bytes[depth]); \
+\
+            if (!child) \
+            { \
+                if (!CMC_(PFX, _impl_add_child)(_map_, ref, bytes[depth], CMC_ART_TAG(entry))) \
+                { \
+                    _map_->flag = CMC_FLAG_ALLOC; \
+                    return false; \
+                } \
+\
+                break; \
+            } \
+\
+            ref = child; \
+            depth++; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *next = CMC_(PFX, _impl_upper)(_map_, bytes, length); \
+\
+        entry->next = next; \
+        entry->prev = next ? next->prev : _map_->tail; \
+\
+        if (entry->prev) \
+            entry->prev->next = entry; \
+        else \
+            _map_->head = entry; \
+\
+        if (next) \
+            next->prev = entry; \
+        else \
+            _map_->tail = entry; \
+\
+        return true; \
+    } \
+\
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_entry)(struct SNAME * _map_, K key) \
+    { \
+        unsigned char buffer[CMC_ART_BUFFER]; \
+        size_t length; \
+        const unsigned char *bytes = _map_->f_key->bytes(&key, buffer, &length); \
+\
+        struct CMC_DEF_NODE(SNAME) *node = _map_->root; \
+        size_t depth = 0; \
+\
+        while (node) \
+        { \
+            if (CMC_ART_IS_ENTRY(node)) \
+            { \
+                struct CMC_DEF_ENTRY(SNAME) *leaf = CMC_ART_ENTRY(node); \
+\
+                return _map_->f_key->cmp(leaf->key, key) == 0 ? leaf : NULL; \
+            } \
+\
+            if (length - depth < node->prefix_len || \
+                memcmp(CMC_ART_PREFIX_OF(node), bytes + depth, node->prefix_len) != 0) \
+                return NULL; \
+\
+            depth += node->prefix_len; \
+\
+            if (depth == length) \
+                return node->entry; \
+\
+            struct CMC_DEF_NODE(SNAME) **child = CMC_(PFX, _impl_find_child)(node, bytes[depth]); \
+\
+            if (!child) \
+                return NULL; \
+\
+            node = *child; \
+            depth++; \
+        } \
+\
+        return NULL; \
+    } \
+\
+    /* The entry with the smallest key whose bytes are greater than the given ones */ \
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_upper)(struct SNAME * _map_, const unsigned char *bytes, \
+                                                                 size_t length) \
+    { \
+        unsigned char other[CMC_ART_BUFFER]; \
+        size_t other_length; \
+\
+        /* The deepest subtree found so far that is entirely greater */ \
+        struct CMC_DEF_NODE(SNAME) *greater = NULL; \
+        struct CMC_DEF_NODE(SNAME) *node = _map_->root; \
+        size_t depth = 0; \
+\
+        while (node) \
+        { \
+            if (CMC_ART_IS_ENTRY(node)) \
+            { \
+                struct CMC_DEF_ENTRY(SNAME) *leaf = CMC_ART_ENTRY(node); \
+                const unsigned char *leaf_bytes = _map_->f_key->bytes(&leaf->key, other, &other_length); \
+\
+                int cmp = memcmp(leaf_bytes, bytes, length < other_length ? length : other_length); \
+\
+                if (cmp == 0) \
+                    cmp = (other_length > length) - (other_length < length); \
+\
+                if (cmp > 0) \
+                    return leaf; \
+\
+                break; \
+            } \
+\
+            const unsigned char *prefix = CMC_ART_PREFIX_OF(node); \
+\
+            for (size_t i = 0; i < node->prefix_len; i++) \
+            { \
+                /* The bytes are a prefix of everything in this subtree */ \
+                if (depth + i == length) \
+                    return CMC_(PFX, _impl_min)(node); \
+\
+                if (prefix[i] != bytes[depth + i]) \
+                { \
+                    if (prefix[i] > bytes[depth + i]) \
+                        return CMC_(PFX, _impl_min)(node); \
+\
+                    return CMC_(PFX, _impl_min)(greater); \
+                } \
+            } \
+\
+            depth += node->prefix_len; \
+\
+            /* Only the entry of this node is not greater */ \
+            if (depth == length) \
+            { \
+                struct CMC_DEF_NODE(SNAME) *first = CMC_(PFX, _impl_child_from)(node, 0); \
+\
+                return CMC_(PFX, _impl_min)(first ? first : greater); \
+            } \
+\
+            struct CMC_DEF_NODE(SNAME) *next = CMC_(PFX, _impl_child_from)(node, (size_t)bytes[depth] + 1); \
+\
+            if (next) \
+                greater = next; \
+\
+            struct CMC_DEF_NODE(SNAME) **child = CMC_(PFX, _impl_find_child)(node, bytes[depth]); \
+\
+            if (!child) \
+                break; \
+\
+            node = *child; \
+            depth++; \
+        } \
+\
+        return CMC_(PFX, _impl_min)(greater); \
+    }
+
+#endif /* CMC_CMC_ARTMAP_H */
@@ -59,6 +59,7 @@
  * Core functionalities of the C Macro Collections Library
  * ------------------------------------------------------------------------- */
 #include "cor_core.h"
+#include "cor_sort.h"
 
 /**
  * Core Deque implementation
@@ -116,6 +117,12 @@
 \
         /* Index representing the back of the deque */ \
         size_t back; \
+\
+        /* If adding to a full deque overwrites the element at its other end */ \
+        bool overwrite; \
+\
+        /* Takes every element that is overwritten, which is freed if NULL */ \
+        void (*evict)(V); \
 \
         /* Flags indicating errors or success */ \
         int flag; \
@@ -153,6 +160,9 @@
 \
         /* Priority function */ \
         CMC_DEF_FTAB_PRI(V); \
+\
+        /* Search function for contiguous elements, can be NULL */ \
+        CMC_DEF_FTAB_FIND(V); \
     }; \
 \
     /* Collection Functions */ \
@@ -170,6 +180,7 @@
     bool CMC_(PFX, _push_back)(struct SNAME * _deque_, V value); \
     bool CMC_(PFX, _pop_front)(struct SNAME * _deque_); \
     bool CMC_(PFX, _pop_back)(struct SNAME * _deque_); \
+    bool CMC_(PFX, _push_back_many)(struct SNAME * _deque_, V * values, size_t count); \
     /* Element Access */ \
     V CMC_(PFX, _front)(struct SNAME * _deque_); \
     V CMC_(PFX, _back)(struct SNAME * _deque_); \
@@ -180,8 +191,12 @@
     size_t CMC_(PFX, _count)(struct SNAME * _deque_); \
     size_t CMC_(PFX, _capacity)(struct SNAME * _deque_); \
     int CMC_(PFX, _flag)(struct SNAME * _deque_); \
+    /* Collection Sorting */ \
+    void CMC_(PFX, _sort)(struct SNAME * _deque_); \
+    bool CMC_(PFX, _stable_sort)(struct SNAME * _deque_); \
     /* Collection Utility */ \
     bool CMC_(PFX, _resize)(struct SNAME * _deque_, size_t capacity); \
+    void CMC_(PFX, _set_overwrite)(struct SNAME * _deque_, bool overwrite, void (*evict)(V)); \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _deque_); \
     bool CMC_(PFX, _equals)(struct SNAME * _deque1_, struct SNAME * _deque2_);
 
@@ -191,7 +206,9 @@
 #define CMC_CMC_DEQUE_CORE_SOURCE_(PFX, SNAME, V) \
 \
     /* Implementation Detail Functions */ \
-    /* None */ \
+    static V *CMC_(PFX, _impl_contiguous)(struct SNAME * _deque_); \
+    static void CMC_(PFX, _impl_evict)(struct SNAME * _deque_, V value); \
+    CMC_COR_SORT_SOURCE(PFX, V) \
 \
     struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val) \
     { \
@@ -229,6 +246,8 @@
         _deque_->count = 0; \
         _deque_->front = 0; \
         _deque_->back = 0; \
+        _deque_->overwrite = false; \
+        _deque_->evict = NULL; \
         _deque_->flag = CMC_FLAG_OK; \
         _deque_->f_val = f_val; \
         _deque_->alloc = alloc; \
@@ -293,7 +312,17 @@
     { \
         if (CMC_(PFX, _full)(_deque_)) \
         { \
-            if (!CMC_(PFX, _resize)(_deque_, _deque_->capacity * 2)) \
+            if (_deque_->overwrite) \
+            { \
+                /* The front meets the back so the newest element is replaced */ \
+                _deque_->back = (_deque_->back == 0) ? _deque_->capacity - 1 : _deque_->back - 1; \
+                _deque_->count--; \
+\
+                CMC_(PFX, _impl_evict)(_deque_, _deque_->buffer[_deque_->back]); \
+\
+                CMC_CALLBACKS_CALL(_deque_, delete); \
+            } \
+            else if (!CMC_(PFX, _resize)(_deque_, _deque_->capacity * 2)) \
                 return false; \
         } \
 \
@@ -313,7 +342,17 @@
     { \
         if (CMC_(PFX, _full)(_deque_)) \
         { \
-            if (!CMC_(PFX, _resize)(_deque_, _deque_->capacity * 2)) \
+            if (_deque_->overwrite) \
+            { \
+                /* The back meets the front so the oldest element is replaced */ \
+                CMC_(PFX, _impl_evict)(_deque_, _deque_->buffer[_deque_->front]); \
+\
+                _deque_->front = (_deque_->front == _deque_->capacity - 1) ? 0 : _deque_->front + 1; \
+                _deque_->count--; \
+\
+                CMC_CALLBACKS_CALL(_deque_, delete); \
+            } \
+            else if (!CMC_(PFX, _resize)(_deque_, _deque_->capacity * 2)) \
                 return false; \
         } \
 \
@@ -368,6 +407,71 @@
 \
         return true; \
     } \
+\
+    bool CMC_(PFX, _push_back_many)(struct SNAME * _deque_, V * values, size_t count) \
+    { \
+        if (count == 0) \
+        { \
+            _deque_->flag = CMC_FLAG_OK; \
+            return true; \
+        } \
+\
+        if (_deque_->overwrite) \
+        { \
+            /* Values that would be overwritten by the rest of the array */ \
+            /* are evicted right away */ \
+            size_t skipped = count > _deque_->capacity ? count - _deque_->capacity : 0; \
+            size_t evicted = _deque_->count + count - skipped; \
+\
+            evicted = evicted > _deque_->capacity ? evicted - _deque_->capacity : 0; \
+\
+            for (size_t i = 0; i < evicted; i++) \
+            { \
+                CMC_(PFX, _impl_evict)(_deque_, _deque_->buffer[_deque_->front]); \
+\
+                _deque_->front = (_deque_->front == _deque_->capacity - 1) ? 0 : _deque_->front + 1; \
+            } \
+\
+            for (size_t i = 0; i < skipped; i++) \
+                CMC_(PFX, _impl_evict)(_deque_, values[i]); \
+\
+            if (evicted + skipped > 0) \
+            { \
+                CMC_CALLBACKS_CALL(_deque_, delete); \
+            } \
+\
+            _deque_->count -= evicted; \
+            values += skipped; \
+            count -= skipped; \
+        } \
+        else if (_deque_->count + count > _deque_->capacity) \
+        { \
+            size_t capacity = _deque_->capacity * 2; \
+\
+            if (capacity < _deque_->count + count) \
+                capacity = _deque_->count + count; \
+\
+            if (!CMC_(PFX, _resize)(_deque_, capacity)) \
+                return false; \
+        } \
+\
+        /* The values wrap around the end of the buffer at most once */ \
+        size_t first = _deque_->capacity - _deque_->back; \
+\
+        if (first > count) \
+            first = count; \
+\
+        memcpy(_deque_->buffer + _deque_->back, values, sizeof(V) * first); \
+        memcpy(_deque_->buffer, values + first, sizeof(V) * (count - first)); \
+\
+        _deque_->back = (_deque_->back + count) % _deque_->capacity; \
+        _deque_->count += count; \
+        _deque_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_deque_, create); \
+\
+        return true; \
+    } \
 \
     V CMC_(PFX, _front)(struct SNAME * _deque_) \
     { \
@@ -405,15 +509,31 @@
 \
         bool result = false; \
 \
-        for (size_t i = _deque_->front, j = 0; j < _deque_->count; j++) \
+        if (_deque_->f_val->find) \
+        { \
+            /* The elements are split in up to two contiguous parts of the buffer */ \
+            size_t first = _deque_->capacity - _deque_->front; \
+\
+            if (first > _deque_->count) \
+                first = _deque_->count; \
+\
+            size_t second = _deque_->count - first; \
+\
+            result = _deque_->f_val->find(_deque_->buffer + _deque_->front, first, value) < first || \
+                     _deque_->f_val->find(_deque_->buffer, second, value) < second; \
+        } \
+        else \
         { \
-            if (_deque_->f_val->cmp(_deque_->buffer[i], value) == 0) \
+            for (size_t i = _deque_->front, j = 0; j < _deque_->count; j++) \
             { \
-                result = true; \
-                break; \
-            } \
+                if (_deque_->f_val->cmp(_deque_->buffer[i], value) == 0) \
+                { \
+                    result = true; \
+                    break; \
+                } \
 \
-            i = (i + 1) % _deque_->capacity; \
+                i = (i + 1) % _deque_->capacity; \
+            } \
         } \
 \
         CMC_CALLBACKS_CALL(_deque_, read); \
@@ -445,6 +565,34 @@
     { \
         return _deque_->flag; \
     } \
+\
+    void CMC_(PFX, _sort)(struct SNAME * _deque_) \
+    { \
+        V *array = CMC_(PFX, _impl_contiguous)(_deque_); \
+\
+        CMC_(PFX, _impl_sort)(array, _deque_->count, _deque_->f_val->cmp, _deque_->alloc); \
+\
+        _deque_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_deque_, update); \
+    } \
+\
+    bool CMC_(PFX, _stable_sort)(struct SNAME * _deque_) \
+    { \
+        V *array = CMC_(PFX, _impl_contiguous)(_deque_); \
+\
+        if (!CMC_(PFX, _impl_stable_sort)(array, _deque_->count, _deque_->f_val->cmp, _deque_->alloc)) \
+        { \
+            _deque_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        _deque_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_deque_, update); \
+\
+        return true; \
+    } \
 \
     bool CMC_(PFX, _resize)(struct SNAME * _deque_, size_t capacity) \
     { \
@@ -487,6 +635,13 @@
 \
         return true; \
     } \
+\
+    void CMC_(PFX, _set_overwrite)(struct SNAME * _deque_, bool overwrite, void (*evict)(V)) \
+    { \
+        _deque_->overwrite = overwrite; \
+        _deque_->evict = evict; \
+        _deque_->flag = CMC_FLAG_OK; \
+    } \
 \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _deque_) \
     { \
@@ -521,7 +676,9 @@
 \
         result->count = _deque_->count; \
         result->front = 0; \
-        result->back = _deque_->count; \
+        result->back = _deque_->count % _deque_->capacity; \
+        result->overwrite = _deque_->overwrite; \
+        result->evict = _deque_->evict; \
 \
         _deque_->flag = CMC_FLAG_OK; \
 \
@@ -547,6 +704,44 @@
         } \
 \
         return true; \
+    } \
+\
+    /* Returns the elements as a single array, moving them to the start of the */ \
+    /* buffer if they wrap around its end */ \
+    static V *CMC_(PFX, _impl_contiguous)(struct SNAME * _deque_) \
+    { \
+        if (_deque_->front + _deque_->count <= _deque_->capacity) \
+            return _deque_->buffer + _deque_->front; \
+\
+        /* Rotating the whole buffer left by front with three reversals needs */ \
+        /* no extra memory */ \
+        size_t ranges[3][2] = { { 0, _deque_->front }, \
+                                { _deque_->front, _deque_->capacity }, \
+                                { 0, _deque_->capacity } }; \
+\
+        for (size_t r = 0; r < 3; r++) \
+        { \
+            for (size_t i = ranges[r][0], j = ranges[r][1]; i + 1 < j; i++, j--) \
+            { \
+                V _tmp_ = _deque_->buffer[i]; \
+                _deque_->buffer[i] = _deque_->buffer[j - 1]; \
+                _deque_->buffer[j - 1] = _tmp_; \
+            } \
+        } \
+\
+        _deque_->front = 0; \
+        _deque_->back = _deque_->count % _deque_->capacity; \
+\
+        return _deque_->buffer; \
+    } \
+\
+    /* Overwritten elements go to evict, or are freed if there is none */ \
+    static void CMC_(PFX, _impl_evict)(struct SNAME * _deque_, V value) \
+    { \
+        if (_deque_->evict) \
+            _deque_->evict(value); \
+        else if (_deque_->f_val->free) \
+            _deque_->f_val->free(value); \
     }
 
 #endif /* CMC_CMC_DEQUE_H */
@@ -0,0 +1,554 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_disjointset.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * DisjointSet
+ *
+ * A DisjointSet (or Union-Find) keeps track of a partition of the unsigned
+ * integers smaller than its count into sets. Every value starts in a set of
+ * its own and two sets can be joined into one with _union(). _find() returns
+ * a value that represents the set of another value, so two values are in the
+ * same set if they have the same representative.
+ *
+ * Every set is a tree where each value points to its parent and the root is
+ * the representative of the set. Finding a root halves the path it went
+ * through and the root of the shallower tree is the one that becomes a child
+ * on a union, which makes both operations nearly O(1) amortized. Every value
+ * is also in a circular list with the other values of its set so that a set
+ * can be iterated over without going through every value.
+ */
+
+#ifndef CMC_CMC_DISJOINTSET_H
+#define CMC_CMC_DISJOINTSET_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/**
+ * Core DisjointSet implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_DISJOINTSET_CORE(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_CMC_DISJOINTSET_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_DISJOINTSET_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_DISJOINTSET_CORE_STRUCT(PARAMS) \
+    CMC_CMC_DISJOINTSET_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_DISJOINTSET_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_DISJOINTSET_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_DISJOINTSET_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_CMC_DISJOINTSET_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_DISJOINTSET_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_DISJOINTSET_CORE_STRUCT(PARAMS) \
+    CMC_CMC_DISJOINTSET_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_DISJOINTSET_CORE_STRUCT(PARAMS) \
+    CMC_CMC_DISJOINTSET_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_DISJOINTSET_CORE_HEADER(PARAMS) \
+    CMC_CMC_DISJOINTSET_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_DISJOINTSET_CORE_SOURCE(PARAMS) \
+    CMC_CMC_DISJOINTSET_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_DISJOINTSET_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* DisjointSet Structure */ \
+    struct SNAME \
+    { \
+        /* Parent of each value, roots are their own parent */ \
+        size_t *parent; \
+\
+        /* Upper bound of the height of the tree of each root */ \
+        unsigned char *rank; \
+\
+        /* Amount of values in the set of each root */ \
+        size_t *size; \
+\
+        /* Circular list of the values in each set */ \
+        size_t *next; \
+        size_t *prev; \
+\
+        /* Amount of values */ \
+        size_t count; \
+\
+        /* Amount of sets */ \
+        size_t sets; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_DISJOINTSET_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t count, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t count, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _clear)(struct SNAME * _set_); \
+    void CMC_(PFX, _free)(struct SNAME * _set_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _set_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _union)(struct SNAME * _set_, V value1, V value2); \
+    /* Element Access */ \
+    bool CMC_(PFX, _find)(struct SNAME * _set_, V value, V * root); \
+    /* Collection State */ \
+    bool CMC_(PFX, _connected)(struct SNAME * _set_, V value1, V value2); \
+    size_t CMC_(PFX, _set_size)(struct SNAME * _set_, V value); \
+    size_t CMC_(PFX, _set_count)(struct SNAME * _set_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _set_); \
+    int CMC_(PFX, _flag)(struct SNAME * _set_); \
+    /* Collection Utility */ \
+    bool CMC_(PFX, _resize)(struct SNAME * _set_, size_t count); \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _set_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _set1_, struct SNAME * _set2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_DISJOINTSET_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static void CMC_(PFX, _impl_reset)(struct SNAME * _set_, size_t from, size_t to); \
+    static size_t CMC_(PFX, _impl_find)(struct SNAME * _set_, size_t index); \
+    static void CMC_(PFX, _impl_link)(struct SNAME * _set_, size_t root1, size_t root2); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t count, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(count, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t count, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (count == 0 || !f_val) \
+            return NULL; \
+\
+        /* Prevent integer overflow */ \
+        if (count > SIZE_MAX / sizeof(size_t)) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_set_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_set_) \
+            return NULL; \
+\
+        _set_->parent = alloc->malloc(sizeof(size_t) * count); \
+        _set_->rank = alloc->malloc(sizeof(unsigned char) * count); \
+        _set_->size = alloc->malloc(sizeof(size_t) * count); \
+        _set_->next = alloc->malloc(sizeof(size_t) * count); \
+        _set_->prev = alloc->malloc(sizeof(size_t) * count); \
+\
+        if (!_set_->parent || !_set_->rank || !_set_->size || !_set_->next || !_set_->prev) \
+        { \
+            alloc->free(_set_->parent); \
+            alloc->free(_set_->rank); \
+            alloc->free(_set_->size); \
+            alloc->free(_set_->next); \
+            alloc->free(_set_->prev); \
+            alloc->free(_set_); \
+            return NULL; \
+        } \
+\
+        _set_->count = count; \
+        _set_->flag = CMC_FLAG_OK; \
+        _set_->f_val = f_val; \
+        _set_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_set_, callbacks); \
+\
+        CMC_(PFX, _impl_reset)(_set_, 0, count); \
+\
+        _set_->sets = count; \
+\
+        return _set_; \
+    } \
+\
+    void CMC_(PFX, _clear)(struct SNAME * _set_) \
+    { \
+        CMC_(PFX, _impl_reset)(_set_, 0, _set_->count); \
+\
+        _set_->sets = _set_->count; \
+        _set_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _set_) \
+    { \
+        _set_->alloc->free(_set_->parent); \
+        _set_->alloc->free(_set_->rank); \
+        _set_->alloc->free(_set_->size); \
+        _set_->alloc->free(_set_->next); \
+        _set_->alloc->free(_set_->prev); \
+        _set_->alloc->free(_set_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _set_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _set_->alloc = &cmc_alloc_node_default; \
+        else \
+            _set_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_set_, callbacks); \
+\
+        _set_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _union)(struct SNAME * _set_, V value1, V value2) \
+    { \
+        if ((size_t)value1 >= _set_->count || (size_t)value2 >= _set_->count) \
+        { \
+            _set_->flag = CMC_FLAG_RANGE; \
+            return false; \
+        } \
+\
+        size_t root1 = CMC_(PFX, _impl_find)(_set_, (size_t)value1); \
+        size_t root2 = CMC_(PFX, _impl_find)(_set_, (size_t)value2); \
+\
+        if (root1 == root2) \
+        { \
+            _set_->flag = CMC_FLAG_DUPLICATE; \
+            return false; \
+        } \
+\
+        CMC_(PFX, _impl_link)(_set_, root1, root2); \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, update); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _find)(struct SNAME * _set_, V value, V * root) \
+    { \
+        if ((size_t)value >= _set_->count) \
+        { \
+            _set_->flag = CMC_FLAG_RANGE; \
+            return false; \
+        } \
+\
+        size_t result = CMC_(PFX, _impl_find)(_set_, (size_t)value); \
+\
+        if (root) \
+            *root = (V)result; \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _connected)(struct SNAME * _set_, V value1, V value2) \
+    { \
+        if ((size_t)value1 >= _set_->count || (size_t)value2 >= _set_->count) \
+        { \
+            _set_->flag = CMC_FLAG_RANGE; \
+            return false; \
+        } \
+\
+        size_t root1 = CMC_(PFX, _impl_find)(_set_, (size_t)value1); \
+        size_t root2 = CMC_(PFX, _impl_find)(_set_, (size_t)value2); \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return root1 == root2; \
+    } \
+\
+    size_t CMC_(PFX, _set_size)(struct SNAME * _set_, V value) \
+    { \
+        if ((size_t)value >= _set_->count) \
+        { \
+            _set_->flag = CMC_FLAG_RANGE; \
+            return 0; \
+        } \
+\
+        size_t result = _set_->size[CMC_(PFX, _impl_find)(_set_, (size_t)value)]; \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return result; \
+    } \
+\
+    size_t CMC_(PFX, _set_count)(struct SNAME * _set_) \
+    { \
+        return _set_->sets; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _set_) \
+    { \
+        return _set_->count; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _set_) \
+    { \
+        return _set_->flag; \
+    } \
+\
+    bool CMC_(PFX, _resize)(struct SNAME * _set_, size_t count) \
+    { \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        if (_set_->count == count) \
+            goto success; \
+\
+        /* Values can't be taken out of their sets */ \
+        if (count < _set_->count) \
+        { \
+            _set_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        /* Prevent integer overflow */ \
+        if (count > SIZE_MAX / sizeof(size_t)) \
+        { \
+            _set_->flag = CMC_FLAG_ERROR; \
+            return false; \
+        } \
+\
+        /* Arrays that were already reallocated are only larger than needed */ \
+        /* if a later one fails */ \
+        size_t *new_parent = _set_->alloc->realloc(_set_->parent, sizeof(size_t) * count); \
+\
+        if (!new_parent) \
+            goto alloc_error; \
+\
+        _set_->parent = new_parent; \
+\
+        unsigned char *new_rank = _set_->alloc->realloc(_set_->rank, sizeof(unsigned char) * count); \
+\
+        if (!new_rank) \
+            goto alloc_error; \
+\
+        _set_->rank = new_rank; \
+\
+        size_t *new_size = _set_->alloc->realloc(_set_->size, sizeof(size_t) * count); \
+\
+        if (!new_size) \
+            goto alloc_error; \
+\
+        _set_->size = new_size; \
+\
+        size_t *new_next = _set_->alloc->realloc(_set_->next, sizeof(size_t) * count); \
+\
+        if (!new_next) \
+            goto alloc_error; \
+\
+        _set_->next = new_next; \
+\
+        size_t *new_prev = _set_->alloc->realloc(_set_->prev, sizeof(size_t) * count); \
+\
+        if (!new_prev) \
+            goto alloc_error; \
+\
+        _set_->prev = new_prev; \
+\
+        CMC_(PFX, _impl_reset)(_set_, _set_->count, count); \
+\
+        _set_->sets += count - _set_->count; \
+        _set_->count = count; \
+\
+    success: \
+\
+        CMC_CALLBACKS_CALL(_set_, resize); \
+\
+        return true; \
+\
+    alloc_error: \
+\
+        _set_->flag = CMC_FLAG_ALLOC; \
+        return false; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _set_) \
+    { \
+        struct SNAME *result = CMC_(PFX, _new_custom)(_set_->count, _set_->f_val, _set_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _set_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _set_->callbacks); \
+\
+        memcpy(result->parent, _set_->parent, sizeof(size_t) * _set_->count); \
+        memcpy(result->rank, _set_->rank, sizeof(unsigned char) * _set_->count); \
+        memcpy(result->size, _set_->size, sizeof(size_t) * _set_->count); \
+        memcpy(result->next, _set_->next, sizeof(size_t) * _set_->count); \
+        memcpy(result->prev, _set_->prev, sizeof(size_t) * _set_->count); \
+\
+        result->sets = _set_->sets; \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        _set1_->flag = CMC_FLAG_OK; \
+        _set2_->flag = CMC_FLAG_OK; \
+\
+        if (_set1_->count != _set2_->count || _set1_->sets != _set2_->sets) \
+            return false; \
+\
+        /* If every set of the first is inside a set of the second and both */ \
+        /* have the same amount of sets then they are the same partition */ \
+        for (size_t i = 0; i < _set1_->count; i++) \
+        { \
+            size_t root1 = CMC_(PFX, _impl_find)(_set1_, i); \
+\
+            if (CMC_(PFX, _impl_find)(_set2_, i) != CMC_(PFX, _impl_find)(_set2_, root1)) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    static void CMC_(PFX, _impl_reset)(struct SNAME * _set_, size_t from, size_t to) \
+    { \
+        for (size_t i = from; i < to; i++) \
+        { \
+            _set_->parent[i] = i; \
+            _set_->rank[i] = 0; \
+            _set_->size[i] = 1; \
+            _set_->next[i] = i; \
+            _set_->prev[i] = i; \
+        } \
+    } \
+\
+    static size_t CMC_(PFX, _impl_find)(struct SNAME * _set_, size_t index) \
+    { \
+        /* Path halving: every other value on the way points to its */ \
+        /* grandparent */ \
+        while (_set_->parent[index] != index) \
+        { \
+            _set_->parent[index] = _set_->parent[_set_->parent[index]]; \
+            index = _set_->parent[index]; \
+        } \
+\
+        return index; \
+    } \
+\
+    static void CMC_(PFX, _impl_link)(struct SNAME * _set_, size_t root1, size_t root2) \
+    { \
+        if (_set_->rank[root1] < _set_->rank[root2]) \
+        { \
+            size_t tmp = root1; \
+            root1 = root2; \
+            root2 = tmp; \
+        } \
+        else if (_set_->rank[root1] == _set_->rank[root2]) \
+            _set_->rank[root1]++; \
+\
+        _set_->parent[root2] = root1; \
+        _set_->size[root1] += _set_->size[root2]; \
+\
+        /* Splice both circular lists into one */ \
+        size_t next1 = _set_->next[root1]; \
+        size_t next2 = _set_->next[root2]; \
+\
+        _set_->next[root1] = next2; \
+        _set_->prev[next2] = root1; \
+        _set_->next[root2] = next1; \
+        _set_->prev[next1] = root2; \
+\
+        _set_->sets--; \
+    }
+
+#endif /* CMC_CMC_DISJOINTSET_H */
@@ -0,0 +1,637 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_eliasfano.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * EliasFano
+ *
+ * An EliasFano is an immutable and compressed sequence of non-decreasing
+ * unsigned integers, like a posting list of sorted IDs. It is built once from
+ * a sorted array and takes less than 3 + log2(U / n) bits per value, where U is
+ * the greatest value and n is the amount of values, while still giving random
+ * access to any value by its index and finding the first value not less than
+ * a given one.
+ *
+ * Each value is split in its low l bits, stored packed in an array, and its
+ * high bits, stored in unary in a bit vector where the i-th value sets the bit
+ * at (high + i). The high part of the i-th value is then the position of the
+ * i-th set bit minus i and every unset bit ends a bucket of values with the
+ * same high part. Positions of every CMC_ELIASFANO_SAMPLE-th set and unset bit
+ * are sampled so that finding any of them only scans a few words.
+ *
+ * The EliasFano does not make use of K and V is the type of the values, which
+ * must be an unsigned integer type. Because of that, it doesn't have Functions
+ * Tables.
+ */
+
+#ifndef CMC_CMC_ELIASFANO_H
+#define CMC_CMC_ELIASFANO_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/* Every how many set or unset bits of the high bits a position is sampled */
+#define CMC_ELIASFANO_SAMPLE 256
+
+/**
+ * Core EliasFano implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_ELIASFANO_CORE(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_CMC_ELIASFANO_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_ELIASFANO_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_ELIASFANO_CORE_STRUCT(PARAMS) \
+    CMC_CMC_ELIASFANO_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_ELIASFANO_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_ELIASFANO_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_ELIASFANO_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_CMC_ELIASFANO_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_ELIASFANO_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_ELIASFANO_CORE_STRUCT(PARAMS) \
+    CMC_CMC_ELIASFANO_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_ELIASFANO_CORE_STRUCT(PARAMS) \
+    CMC_CMC_ELIASFANO_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_ELIASFANO_CORE_HEADER(PARAMS) \
+    CMC_CMC_ELIASFANO_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_ELIASFANO_CORE_SOURCE(PARAMS) \
+    CMC_CMC_ELIASFANO_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_ELIASFANO_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* EliasFano Structure */ \
+    struct SNAME \
+    { \
+        /* Low bits of every value, packed */ \
+        uint64_t *lower; \
+\
+        /* High bits of every value, in unary */ \
+        uint64_t *upper; \
+\
+        /* Position of every CMC_ELIASFANO_SAMPLE-th set bit of upper */ \
+        size_t *ones; \
+\
+        /* Position of every CMC_ELIASFANO_SAMPLE-th unset bit of upper */ \
+        size_t *zeros; \
+\
+        /* Amount of values */ \
+        size_t count; \
+\
+        /* Amount of low bits of each value */ \
+        size_t low_bits; \
+\
+        /* Amount of bits in upper */ \
+        size_t length; \
+\
+        /* Amount of words in lower */ \
+        size_t lower_words; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_ELIASFANO_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(V * values, size_t count); \
+    struct SNAME *CMC_(PFX, _new_custom)(V * values, size_t count, struct CMC_ALLOC_NODE_NAME * alloc, \
+                                         struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _free)(struct SNAME * _ef_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _ef_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Element Access */ \
+    V CMC_(PFX, _get)(struct SNAME * _ef_, size_t index); \
+    bool CMC_(PFX, _next_geq)(struct SNAME * _ef_, V value, size_t * index, V * result); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _ef_, V value); \
+    bool CMC_(PFX, _empty)(struct SNAME * _ef_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _ef_); \
+    size_t CMC_(PFX, _memory)(struct SNAME * _ef_); \
+    int CMC_(PFX, _flag)(struct SNAME * _ef_); \
+    /* Collection Utility */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _ef_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _ef1_, struct SNAME * _ef2_); \
+    /* Set Operations */ \
+    struct SNAME *CMC_(PFX, _intersection)(struct SNAME * _ef1_, struct SNAME * _ef2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_ELIASFANO_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static uint64_t CMC_(PFX, _impl_low)(struct SNAME * _ef_, size_t index); \
+    static size_t CMC_(PFX, _impl_select)(struct SNAME * _ef_, size_t rank, bool bit); \
+    static size_t CMC_(PFX, _impl_popcount)(uint64_t bits); \
+    static size_t CMC_(PFX, _impl_lowest_bit)(uint64_t bits); \
+\
+    struct SNAME *CMC_(PFX, _new)(V * values, size_t count) \
+    { \
+        return CMC_(PFX, _new_custom)(values, count, NULL, NULL); \
+    } \
+\
+    /* The values must be sorted in non-decreasing order */ \
+    struct SNAME *CMC_(PFX, _new_custom)(V * values, size_t count, struct CMC_ALLOC_NODE_NAME * alloc, \
+                                         struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!values && count > 0) \
+            return NULL; \
+\
+        for (size_t i = 1; i < count; i++) \
+        { \
+            if (values[i] < values[i - 1]) \
+                return NULL; \
+        } \
+\
+        uint64_t universe = count > 0 ? (uint64_t)values[count - 1] : 0; \
+\
+        /* Low bits are floor(log2(universe / count)) so that upper takes */ \
+        /* at most two bits per value */ \
+        size_t low_bits = 0; \
+\
+        for (uint64_t q = count > 0 ? universe / count : 0; q > 1; q >>= 1) \
+            low_bits++; \
+\
+        size_t high = (size_t)(universe >> low_bits) + 1; \
+\
+        /* Prevent integer overflow */ \
+        if (count > SIZE_MAX / 64 || high > SIZE_MAX - count - 64) \
+            return NULL; \
+\
+        size_t length = count + high; \
+        size_t lower_words = (count * low_bits + 63) / 64; \
+        size_t upper_words = (length + 63) / 64; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_ef_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_ef_) \
+            return NULL; \
+\
+        /* Always allocate something so that NULL only means an error */ \
+        _ef_->lower = alloc->calloc(lower_words + 1, sizeof(uint64_t)); \
+        _ef_->upper = alloc->calloc(upper_words, sizeof(uint64_t)); \
+        _ef_->ones = alloc->malloc(sizeof(size_t) * (count / CMC_ELIASFANO_SAMPLE + 1)); \
+        _ef_->zeros = alloc->malloc(sizeof(size_t) * (high / CMC_ELIASFANO_SAMPLE + 1)); \
+\
+        if (!_ef_->lower || !_ef_->upper || !_ef_->ones || !_ef_->zeros) \
+        { \
+            alloc->free(_ef_->lower); \
+            alloc->free(_ef_->upper); \
+            alloc->free(_ef_->ones); \
+            alloc->free(_ef_->zeros); \
+            alloc->free(_ef_); \
+            return NULL; \
+        } \
+\
+        uint64_t low_mask = ((uint64_t)1 << low_bits) - 1; \
+\
+        for (size_t i = 0; i < count; i++) \
+        { \
+            uint64_t value = (uint64_t)values[i]; \
+            size_t position = (size_t)(value >> low_bits) + i; \
+\
+            _ef_->upper[position / 64] |= (uint64_t)1 << (position % 64); \
+\
+            if (low_bits > 0) \
+            { \
+                uint64_t low = value & low_mask; \
+                size_t offset = i * low_bits; \
+\
+                _ef_->lower[offset / 64] |= low << (offset % 64); \
+\
+                if (offset % 64 + low_bits > 64) \
+                    _ef_->lower[offset / 64 + 1] |= low >> (64 - offset % 64); \
+            } \
+        } \
+\
+        size_t ones = 0; \
+        size_t zeros = 0; \
+\
+        for (size_t position = 0; position < length; position++) \
+        { \
+            if (_ef_->upper[position / 64] & ((uint64_t)1 << (position % 64))) \
+            { \
+                if (ones % CMC_ELIASFANO_SAMPLE == 0) \
+                    _ef_->ones[ones / CMC_ELIASFANO_SAMPLE] = position; \
+\
+                ones++; \
+            } \
+            else \
+            { \
+                if (zeros % CMC_ELIASFANO_SAMPLE == 0) \
+                    _ef_->zeros[zeros / CMC_ELIASFANO_SAMPLE] = position; \
+\
+                zeros++; \
+            } \
+        } \
+\
+        _ef_->count = count; \
+        _ef_->low_bits = low_bits; \
+        _ef_->length = length; \
+        _ef_->lower_words = lower_words + 1; \
+        _ef_->flag = CMC_FLAG_OK; \
+        _ef_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_ef_, callbacks); \
+\
+        return _ef_; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _ef_) \
+    { \
+        _ef_->alloc->free(_ef_->lower); \
+        _ef_->alloc->free(_ef_->upper); \
+        _ef_->alloc->free(_ef_->ones); \
+        _ef_->alloc->free(_ef_->zeros); \
+        _ef_->alloc->free(_ef_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _ef_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _ef_->alloc = &cmc_alloc_node_default; \
+        else \
+            _ef_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_ef_, callbacks); \
+\
+        _ef_->flag = CMC_FLAG_OK; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _ef_, size_t index) \
+    { \
+        if (CMC_(PFX, _empty)(_ef_)) \
+        { \
+            _ef_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        if (index >= _ef_->count) \
+        { \
+            _ef_->flag = CMC_FLAG_RANGE; \
+            return (V){ 0 }; \
+        } \
+\
+        uint64_t high = CMC_(PFX, _impl_select)(_ef_, index, true) - index; \
+\
+        _ef_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_ef_, read); \
+\
+        return (V)((high << _ef_->low_bits) | CMC_(PFX, _impl_low)(_ef_, index)); \
+    } \
+\
+    /* Finds the first value that is not less than the given one. Both the */ \
+    /* index and the result are optional. */ \
+    bool CMC_(PFX, _next_geq)(struct SNAME * _ef_, V value, size_t * index, V * result) \
+    { \
+        if (CMC_(PFX, _empty)(_ef_)) \
+        { \
+            _ef_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        _ef_->flag = CMC_FLAG_OK; \
+\
+        uint64_t high = (uint64_t)value >> _ef_->low_bits; \
+        uint64_t low = (uint64_t)value & (((uint64_t)1 << _ef_->low_bits) - 1); \
+\
+        /* Every value is in a bucket before this one */ \
+        if (high >= _ef_->length - _ef_->count) \
+        { \
+            _ef_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        /* The bucket starts right after the unset bit that ends the last */ \
+        /* one */ \
+        size_t position = high == 0 ? 0 : CMC_(PFX, _impl_select)(_ef_, (size_t)high - 1, false) + 1; \
+        size_t i = position - (size_t)high; \
+\
+        /* Values in the same bucket only differ in their low bits */ \
+        while (position < _ef_->length && (_ef_->upper[position / 64] & ((uint64_t)1 << (position % 64)))) \
+        { \
+            if (CMC_(PFX, _impl_low)(_ef_, i) >= low) \
+                break; \
+\
+            position++; \
+            i++; \
+        } \
+\
+        if (i == _ef_->count) \
+        { \
+            _ef_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (index) \
+            *index = i; \
+\
+        if (result) \
+        { \
+            uint64_t value_high = CMC_(PFX, _impl_select)(_ef_, i, true) - i; \
+\
+            *result = (V)((value_high << _ef_->low_bits) | CMC_(PFX, _impl_low)(_ef_, i)); \
+        } \
+\
+        CMC_CALLBACKS_CALL(_ef_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _ef_, V value) \
+    { \
+        V result; \
+\
+        if (CMC_(PFX, _empty)(_ef_)) \
+        { \
+            _ef_->flag = CMC_FLAG_OK; \
+            return false; \
+        } \
+\
+        bool found = CMC_(PFX, _next_geq)(_ef_, value, NULL, &result) && result == value; \
+\
+        _ef_->flag = CMC_FLAG_OK; \
+\
+        return found; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _ef_) \
+    { \
+        return _ef_->count == 0; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _ef_) \
+    { \
+        return _ef_->count; \
+    } \
+\
+    /* Bytes used by the encoded values */ \
+    size_t CMC_(PFX, _memory)(struct SNAME * _ef_) \
+    { \
+        size_t upper_words = (_ef_->length + 63) / 64; \
+        size_t samples = _ef_->count / CMC_ELIASFANO_SAMPLE + (_ef_->length - _ef_->count) / CMC_ELIASFANO_SAMPLE + 2; \
+\
+        return sizeof(uint64_t) * (_ef_->lower_words + upper_words) + sizeof(size_t) * samples; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _ef_) \
+    { \
+        return _ef_->flag; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _ef_) \
+    { \
+        struct CMC_ALLOC_NODE_NAME *alloc = _ef_->alloc; \
+\
+        struct SNAME *result = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!result) \
+        { \
+            _ef_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        size_t upper_words = (_ef_->length + 63) / 64; \
+        size_t ones = _ef_->count / CMC_ELIASFANO_SAMPLE + 1; \
+        size_t zeros = (_ef_->length - _ef_->count) / CMC_ELIASFANO_SAMPLE + 1; \
+\
+        result->lower = alloc->malloc(sizeof(uint64_t) * _ef_->lower_words); \
+        result->upper = alloc->malloc(sizeof(uint64_t) * upper_words); \
+        result->ones = alloc->malloc(sizeof(size_t) * ones); \
+        result->zeros = alloc->malloc(sizeof(size_t) * zeros); \
+\
+        if (!result->lower || !result->upper || !result->ones || !result->zeros) \
+        { \
+            alloc->free(result->lower); \
+            alloc->free(result->upper); \
+            alloc->free(result->ones); \
+            alloc->free(result->zeros); \
+            alloc->free(result); \
+            _ef_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        memcpy(result->lower, _ef_->lower, sizeof(uint64_t) * _ef_->lower_words); \
+        memcpy(result->upper, _ef_->upper, sizeof(uint64_t) * upper_words); \
+        memcpy(result->ones, _ef_->ones, sizeof(size_t) * ones); \
+        memcpy(result->zeros, _ef_->zeros, sizeof(size_t) * zeros); \
+\
+        result->count = _ef_->count; \
+        result->low_bits = _ef_->low_bits; \
+        result->length = _ef_->length; \
+        result->lower_words = _ef_->lower_words; \
+        result->flag = CMC_FLAG_OK; \
+        result->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(result, _ef_->callbacks); \
+\
+        _ef_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _ef1_, struct SNAME * _ef2_) \
+    { \
+        _ef1_->flag = CMC_FLAG_OK; \
+        _ef2_->flag = CMC_FLAG_OK; \
+\
+        /* The encoding of a sequence is unique */ \
+        if (_ef1_->count != _ef2_->count || _ef1_->low_bits != _ef2_->low_bits || _ef1_->length != _ef2_->length) \
+            return false; \
+\
+        if (memcmp(_ef1_->lower, _ef2_->lower, sizeof(uint64_t) * _ef1_->lower_words) != 0) \
+            return false; \
+\
+        return memcmp(_ef1_->upper, _ef2_->upper, sizeof(uint64_t) * ((_ef1_->length + 63) / 64)) == 0; \
+    } \
+\
+    /* Values that are in both sequences, each only once. The result uses */ \
+    /* the allocation functions of the first sequence. */ \
+    struct SNAME *CMC_(PFX, _intersection)(struct SNAME * _ef1_, struct SNAME * _ef2_) \
+    { \
+        size_t capacity = _ef1_->count < _ef2_->count ? _ef1_->count : _ef2_->count; \
+\
+        V *buffer = _ef1_->alloc->malloc(sizeof(V) * (capacity + 1)); \
+\
+        if (!buffer) \
+        { \
+            _ef1_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        size_t count = 0; \
+        size_t i = 0; \
+        size_t j = 0; \
+        V value1; \
+        V value2; \
+\
+        /* Each sequence skips ahead to the current value of the other */ \
+        if (CMC_(PFX, _next_geq)(_ef1_, (V){ 0 }, &i, &value1)) \
+        { \
+            while (CMC_(PFX, _next_geq)(_ef2_, value1, &j, &value2)) \
+            { \
+                if (value1 == value2) \
+                { \
+                    if (count == 0 || buffer[count - 1] != value1) \
+                        buffer[count++] = value1; \
+\
+                    if (++i == _ef1_->count) \
+                        break; \
+\
+                    value1 = CMC_(PFX, _get)(_ef1_, i); \
+                } \
+                else if (!CMC_(PFX, _next_geq)(_ef1_, value2, &i, &value1)) \
+                    break; \
+            } \
+        } \
+\
+        struct SNAME *result = CMC_(PFX, _new_custom)(buffer, count, _ef1_->alloc, NULL); \
+\
+        _ef1_->alloc->free(buffer); \
+\
+        if (!result) \
+        { \
+            _ef1_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _ef1_->callbacks); \
+\
+        _ef1_->flag = CMC_FLAG_OK; \
+        _ef2_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    static uint64_t CMC_(PFX, _impl_low)(struct SNAME * _ef_, size_t index) \
+    { \
+        if (_ef_->low_bits == 0) \
+            return 0; \
+\
+        size_t offset = index * _ef_->low_bits; \
+        uint64_t low = _ef_->lower[offset / 64] >> (offset % 64); \
+\
+        if (offset % 64 + _ef_->low_bits > 64) \
+            low |= _ef_->lower[offset / 64 + 1] << (64 - offset % 64); \
+\
+        return low & (((uint64_t)1 << _ef_->low_bits) - 1); \
+    } \
+\
+    /* Position of the set or unset bit of upper with the given rank */ \
+    static size_t CMC_(PFX, _impl_select)(struct SNAME * _ef_, size_t rank, bool bit) \
+    { \
+        size_t *samples = bit ? _ef_->ones : _ef_->zeros; \
+        size_t position = samples[rank / CMC_ELIASFANO_SAMPLE]; \
+\
+        rank %= CMC_ELIASFANO_SAMPLE; \
+\
+        size_t w = position / 64; \
+        uint64_t word = bit ? _ef_->upper[w] : ~_ef_->upper[w]; \
+\
+        /* Bits before the sampled position are not counted */ \
+        word &= ~(uint64_t)0 << (position % 64); \
+\
+        while (true) \
+        { \
+            size_t popcount = CMC_(PFX, _impl_popcount)(word); \
+\
+            if (rank < popcount) \
+                break; \
+\
+            rank -= popcount; \
+            w++; \
+            word = bit ? _ef_->upper[w] : ~_ef_->upper[w]; \
+        } \
+\
+        for (size_t i = 0; i < rank; i++) \
+            word &= word - 1; \
+\
+        return w * 64 + CMC_(PFX, _impl_lowest_bit)(word); \
+    } \
+\
+    static size_t CMC_(PFX, _impl_popcount)(uint64_t bits) \
+    { \
+        bits = bits - ((bits >> 1) & UINT64_C(0x5555555555555555)); \
+        bits = (bits & UINT64_C(0x3333333333333333)) + ((bits >> 2) & UINT64_C(0x3333333333333333)); \
+        bits = (bits + (bits >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f); \
+\
+        return (size_t)((bits * UINT64_C(0x0101010101010101)) >> 56); \
+    } \
+\
+    /* Index of the lowest bit set */ \
+    static size_t CMC_(PFX, _impl_lowest_bit)(uint64_t bits) \
+    { \
+        static const unsigned char table[64] = { 0,  1,  56, 2,  57, 49, 28, 3,  61, 58, 42, 50, 38, 29, 17, 4, \
+                                                 62, 47, 59, 36, 45, 43, 51, 22, 53, 39, 33, 30, 24, 18, 12, 5, \
+                                                 63, 55, 48, 27, 60, 41, 37, 16, 46, 35, 44, 21, 52, 32, 23, 11, \
+                                                 54, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6 }; \
+\
+        return table[((bits & (~bits + 1)) * UINT64_C(0x03f79d71b4ca8b09)) >> 58]; \
+    }
+
+#endif /* CMC_CMC_ELIASFANO_H */
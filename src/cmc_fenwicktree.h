@@ -0,0 +1,467 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_fenwicktree.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * FenwickTree
+ *
+ * A FenwickTree (or Binary Indexed Tree) stores a fixed amount of values and
+ * answers what is the combination of a range of them in O(log n) instead of
+ * going through the whole range. Values are combined by the combine function
+ * of the value functions table, which must be associative and commutative,
+ * like a sum, a product or a bitwise or.
+ *
+ * Every position of the tree holds the combination of a block of values
+ * ending at that position, so a prefix is the combination of at most log n
+ * blocks and updating a value touches at most log n blocks. Since the combine
+ * function has no inverse, a mirrored tree of blocks starting at each position
+ * and a copy of the values themselves are also kept, so that any range is the
+ * combination of at most 2 log n blocks from both trees.
+ */
+
+#ifndef CMC_CMC_FENWICKTREE_H
+#define CMC_CMC_FENWICKTREE_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/**
+ * Core FenwickTree implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_FENWICKTREE_CORE(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_CMC_FENWICKTREE_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_FENWICKTREE_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_FENWICKTREE_CORE_STRUCT(PARAMS) \
+    CMC_CMC_FENWICKTREE_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_FENWICKTREE_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_FENWICKTREE_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_FENWICKTREE_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_CMC_FENWICKTREE_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_FENWICKTREE_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_FENWICKTREE_CORE_STRUCT(PARAMS) \
+    CMC_CMC_FENWICKTREE_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_FENWICKTREE_CORE_STRUCT(PARAMS) \
+    CMC_CMC_FENWICKTREE_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_FENWICKTREE_CORE_HEADER(PARAMS) \
+    CMC_CMC_FENWICKTREE_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_FENWICKTREE_CORE_SOURCE(PARAMS) \
+    CMC_CMC_FENWICKTREE_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_FENWICKTREE_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* FenwickTree Structure */ \
+    struct SNAME \
+    { \
+        /* The values themselves */ \
+        V *values; \
+\
+        /* Each position holds the combination of a block of values */ \
+        /* ending at that position */ \
+        V *tree; \
+\
+        /* Each position holds the combination of a block of values */ \
+        /* starting at that position */ \
+        V *mirror; \
+\
+        /* Amount of values */ \
+        size_t count; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_FENWICKTREE_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+\
+        /* Combine function */ \
+        CMC_DEF_FTAB_COMBINE(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(V * values, size_t count, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(V * values, size_t count, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _free)(struct SNAME * _tree_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _tree_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _update)(struct SNAME * _tree_, size_t index, V value); \
+    /* Element Access */ \
+    V CMC_(PFX, _get)(struct SNAME * _tree_, size_t index); \
+    V CMC_(PFX, _prefix)(struct SNAME * _tree_, size_t index); \
+    V CMC_(PFX, _query)(struct SNAME * _tree_, size_t from, size_t to); \
+    /* Collection State */ \
+    size_t CMC_(PFX, _count)(struct SNAME * _tree_); \
+    int CMC_(PFX, _flag)(struct SNAME * _tree_); \
+    /* Collection Utility */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _tree_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _tree1_, struct SNAME * _tree2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_FENWICKTREE_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    struct SNAME *CMC_(PFX, _new)(V * values, size_t count, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(values, count, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(V * values, size_t count, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!values || count == 0 || !f_val || !f_val->combine) \
+            return NULL; \
+\
+        /* Prevent integer overflow */ \
+        if (count > SIZE_MAX / sizeof(V)) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_tree_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_tree_) \
+            return NULL; \
+\
+        _tree_->values = alloc->malloc(sizeof(V) * count); \
+\
+        if (!_tree_->values) \
+        { \
+            alloc->free(_tree_); \
+            return NULL; \
+        } \
+\
+        _tree_->tree = alloc->malloc(sizeof(V) * count); \
+\
+        if (!_tree_->tree) \
+        { \
+            alloc->free(_tree_->values); \
+            alloc->free(_tree_); \
+            return NULL; \
+        } \
+\
+        _tree_->mirror = alloc->malloc(sizeof(V) * count); \
+\
+        if (!_tree_->mirror) \
+        { \
+            alloc->free(_tree_->values); \
+            alloc->free(_tree_->tree); \
+            alloc->free(_tree_); \
+            return NULL; \
+        } \
+\
+        memcpy(_tree_->values, values, sizeof(V) * count); \
+        memcpy(_tree_->tree, values, sizeof(V) * count); \
+        memcpy(_tree_->mirror, values, sizeof(V) * count); \
+\
+        /* Each block is complete by the time it is added to its parent */ \
+        /* block, so the whole tree is built in O(n) */ \
+        for (size_t i = 0; i < count; i++) \
+        { \
+            size_t parent = i | (i + 1); \
+\
+            if (parent < count) \
+                _tree_->tree[parent] = f_val->combine(_tree_->tree[parent], _tree_->tree[i]); \
+        } \
+\
+        /* The mirrored blocks are built the same way from the last one */ \
+        for (size_t i = count; i > 0; i--) \
+        { \
+            size_t parent = i & (i - 1); \
+\
+            if (parent > 0) \
+                _tree_->mirror[parent - 1] = f_val->combine(_tree_->mirror[parent - 1], _tree_->mirror[i - 1]); \
+        } \
+\
+        _tree_->count = count; \
+        _tree_->flag = CMC_FLAG_OK; \
+        _tree_->f_val = f_val; \
+        _tree_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_tree_, callbacks); \
+\
+        return _tree_; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _tree_) \
+    { \
+        _tree_->alloc->free(_tree_->values); \
+        _tree_->alloc->free(_tree_->tree); \
+        _tree_->alloc->free(_tree_->mirror); \
+        _tree_->alloc->free(_tree_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _tree_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _tree_->alloc = &cmc_alloc_node_default; \
+        else \
+            _tree_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_tree_, callbacks); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _update)(struct SNAME * _tree_, size_t index, V value) \
+    { \
+        if (index >= _tree_->count) \
+        { \
+            _tree_->flag = CMC_FLAG_RANGE; \
+            return false; \
+        } \
+\
+        _tree_->values[index] = _tree_->f_val->combine(_tree_->values[index], value); \
+\
+        /* Every block that contains the index */ \
+        for (size_t i = index; i < _tree_->count; i |= i + 1) \
+            _tree_->tree[i] = _tree_->f_val->combine(_tree_->tree[i], value); \
+\
+        for (size_t i = index + 1; i > 0; i &= i - 1) \
+            _tree_->mirror[i - 1] = _tree_->f_val->combine(_tree_->mirror[i - 1], value); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, update); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _tree_, size_t index) \
+    { \
+        if (index >= _tree_->count) \
+        { \
+            _tree_->flag = CMC_FLAG_RANGE; \
+            return (V){ 0 }; \
+        } \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, read); \
+\
+        return _tree_->values[index]; \
+    } \
+\
+    V CMC_(PFX, _prefix)(struct SNAME * _tree_, size_t index) \
+    { \
+        return CMC_(PFX, _query)(_tree_, 0, index); \
+    } \
+\
+    V CMC_(PFX, _query)(struct SNAME * _tree_, size_t from, size_t to) \
+    { \
+        if (from > to) \
+        { \
+            _tree_->flag = CMC_FLAG_INVALID; \
+            return (V){ 0 }; \
+        } \
+\
+        if (to >= _tree_->count) \
+        { \
+            _tree_->flag = CMC_FLAG_RANGE; \
+            return (V){ 0 }; \
+        } \
+\
+        /* Positions are counted from one so that the size of a block is */ \
+        /* the lowest set bit of its position. The range is split at the */ \
+        /* position with the most trailing zeros: mirrored blocks are taken */ \
+        /* from the start up to it and blocks from the end down to it, so */ \
+        /* at most 2 log n blocks are combined */ \
+        size_t start = from + 1; \
+        size_t end = to + 1; \
+\
+        V left = (V){ 0 }; \
+        V right = (V){ 0 }; \
+        bool has_left = false; \
+        bool has_right = false; \
+\
+        while (start + (start & (~start + 1)) - 1 <= end) \
+        { \
+            V block = _tree_->mirror[start - 1]; \
+\
+            left = has_left ? _tree_->f_val->combine(left, block) : block; \
+            has_left = true; \
+\
+            start += start & (~start + 1); \
+        } \
+\
+        while (end >= start && (end & (end - 1)) + 1 >= start) \
+        { \
+            V block = _tree_->tree[end - 1]; \
+\
+            right = has_right ? _tree_->f_val->combine(block, right) : block; \
+            has_right = true; \
+\
+            end &= end - 1; \
+        } \
+\
+        /* Both walks stop at the split position unless a block covers it */ \
+        if (end >= start) \
+        { \
+            V value = _tree_->values[end - 1]; \
+\
+            right = has_right ? _tree_->f_val->combine(value, right) : value; \
+            has_right = true; \
+        } \
+\
+        V result; \
+\
+        if (has_left && has_right) \
+            result = _tree_->f_val->combine(left, right); \
+        else if (has_left) \
+            result = left; \
+        else \
+            result = right; \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, read); \
+\
+        return result; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _tree_) \
+    { \
+        return _tree_->count; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _tree_) \
+    { \
+        return _tree_->flag; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _tree_) \
+    { \
+        struct SNAME *result = \
+            CMC_(PFX, _new_custom)(_tree_->values, _tree_->count, _tree_->f_val, _tree_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _tree_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _tree_->callbacks); \
+\
+        /* The tree was already rebuilt from the values */ \
+        if (_tree_->f_val->cpy) \
+        { \
+            for (size_t i = 0; i < _tree_->count; i++) \
+            { \
+                result->values[i] = _tree_->f_val->cpy(_tree_->values[i]); \
+                result->tree[i] = _tree_->f_val->cpy(_tree_->tree[i]); \
+                result->mirror[i] = _tree_->f_val->cpy(_tree_->mirror[i]); \
+            } \
+        } \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _tree1_, struct SNAME * _tree2_) \
+    { \
+        _tree1_->flag = CMC_FLAG_OK; \
+        _tree2_->flag = CMC_FLAG_OK; \
+\
+        if (_tree1_->count != _tree2_->count) \
+            return false; \
+\
+        for (size_t i = 0; i < _tree1_->count; i++) \
+        { \
+            if (_tree1_->f_val->cmp(_tree1_->values[i], _tree2_->values[i]) != 0) \
+                return false; \
+        } \
+\
+        return true; \
+    }
+
+#endif /* CMC_CMC_FENWICKTREE_H */
@@ -0,0 +1,678 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_gapbuffer.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * GapBuffer
+ *
+ * A GapBuffer is a List that keeps its unused capacity, the gap, wherever the
+ * last insertion or removal happened instead of always at the end. Inserting
+ * or removing an element moves the gap to its index first, shifting only the
+ * elements between the old and the new position of the gap, and then takes or
+ * releases a single slot at the edge of the gap. Edits close to each other, as
+ * in a text editor typing and deleting around a cursor, take amortized
+ * constant time no matter how many elements there are, while elements can
+ * still be accessed by their index in constant time.
+ *
+ * The position of the gap is the cursor, which can also be moved explicitly
+ * with _move_cursor() before a batch of edits. Edits far from each other cost
+ * as much as in a List.
+ *
+ * When the buffer is filled, it is reallocated with a greater capacity, usually
+ * being doubled, and the elements after the gap are moved to the end of the
+ * new buffer.
+ */
+
+#ifndef CMC_CMC_GAPBUFFER_H
+#define CMC_CMC_GAPBUFFER_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/**
+ * Core GapBuffer implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_GAPBUFFER_CORE(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_CMC_GAPBUFFER_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_GAPBUFFER_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_GAPBUFFER_CORE_STRUCT(PARAMS) \
+    CMC_CMC_GAPBUFFER_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_GAPBUFFER_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_GAPBUFFER_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_GAPBUFFER_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_CMC_GAPBUFFER_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_GAPBUFFER_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_GAPBUFFER_CORE_STRUCT(PARAMS) \
+    CMC_CMC_GAPBUFFER_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_GAPBUFFER_CORE_STRUCT(PARAMS) \
+    CMC_CMC_GAPBUFFER_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_GAPBUFFER_CORE_HEADER(PARAMS) \
+    CMC_CMC_GAPBUFFER_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_GAPBUFFER_CORE_SOURCE(PARAMS) \
+    CMC_CMC_GAPBUFFER_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_GAPBUFFER_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* GapBuffer Structure */ \
+    struct SNAME \
+    { \
+        /* Dynamic array of elements with a gap in the middle */ \
+        V *buffer; \
+\
+        /* Current array capacity */ \
+        size_t capacity; \
+\
+        /* Current amount of elements */ \
+        size_t count; \
+\
+        /* Where the gap starts, also the index of the cursor */ \
+        size_t gap; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_GAPBUFFER_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _clear)(struct SNAME * _gb_); \
+    void CMC_(PFX, _free)(struct SNAME * _gb_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _gb_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _push_front)(struct SNAME * _gb_, V value); \
+    bool CMC_(PFX, _push_at)(struct SNAME * _gb_, V value, size_t index); \
+    bool CMC_(PFX, _push_back)(struct SNAME * _gb_, V value); \
+    bool CMC_(PFX, _pop_front)(struct SNAME * _gb_); \
+    bool CMC_(PFX, _pop_at)(struct SNAME * _gb_, size_t index); \
+    bool CMC_(PFX, _pop_back)(struct SNAME * _gb_); \
+    /* Cursor */ \
+    bool CMC_(PFX, _move_cursor)(struct SNAME * _gb_, size_t index); \
+    size_t CMC_(PFX, _cursor)(struct SNAME * _gb_); \
+    /* Element Access */ \
+    V CMC_(PFX, _front)(struct SNAME * _gb_); \
+    V CMC_(PFX, _get)(struct SNAME * _gb_, size_t index); \
+    V *CMC_(PFX, _get_ref)(struct SNAME * _gb_, size_t index); \
+    V CMC_(PFX, _back)(struct SNAME * _gb_); \
+    size_t CMC_(PFX, _index_of)(struct SNAME * _gb_, V value, bool from_start); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _gb_, V value); \
+    bool CMC_(PFX, _empty)(struct SNAME * _gb_); \
+    bool CMC_(PFX, _full)(struct SNAME * _gb_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _gb_); \
+    bool CMC_(PFX, _fits)(struct SNAME * _gb_, size_t size); \
+    size_t CMC_(PFX, _capacity)(struct SNAME * _gb_); \
+    int CMC_(PFX, _flag)(struct SNAME * _gb_); \
+    /* Collection Utility */ \
+    bool CMC_(PFX, _resize)(struct SNAME * _gb_, size_t capacity); \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _gb_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _gb1_, struct SNAME * _gb2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_GAPBUFFER_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static size_t CMC_(PFX, _impl_position)(struct SNAME * _gb_, size_t index); \
+    static void CMC_(PFX, _impl_move_gap)(struct SNAME * _gb_, size_t index); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(capacity, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (capacity < 1) \
+            return NULL; \
+\
+        if (!f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_gb_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_gb_) \
+            return NULL; \
+\
+        _gb_->buffer = alloc->calloc(capacity, sizeof(V)); \
+\
+        if (!_gb_->buffer) \
+        { \
+            alloc->free(_gb_); \
+            return NULL; \
+        } \
+\
+        _gb_->capacity = capacity; \
+        _gb_->count = 0; \
+        _gb_->gap = 0; \
+        _gb_->flag = CMC_FLAG_OK; \
+        _gb_->f_val = f_val; \
+        _gb_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_gb_, callbacks); \
+\
+        return _gb_; \
+    } \
+\
+    void CMC_(PFX, _clear)(struct SNAME * _gb_) \
+    { \
+        if (_gb_->f_val->free) \
+        { \
+            for (size_t i = 0; i < _gb_->count; i++) \
+                _gb_->f_val->free(_gb_->buffer[CMC_(PFX, _impl_position)(_gb_, i)]); \
+        } \
+\
+        memset(_gb_->buffer, 0, sizeof(V) * _gb_->capacity); \
+\
+        _gb_->count = 0; \
+        _gb_->gap = 0; \
+        _gb_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _gb_) \
+    { \
+        if (_gb_->f_val->free) \
+        { \
+            for (size_t i = 0; i < _gb_->count; i++) \
+                _gb_->f_val->free(_gb_->buffer[CMC_(PFX, _impl_position)(_gb_, i)]); \
+        } \
+\
+        _gb_->alloc->free(_gb_->buffer); \
+        _gb_->alloc->free(_gb_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _gb_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _gb_->alloc = &cmc_alloc_node_default; \
+        else \
+            _gb_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_gb_, callbacks); \
+\
+        _gb_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _push_front)(struct SNAME * _gb_, V value) \
+    { \
+        return CMC_(PFX, _push_at)(_gb_, value, 0); \
+    } \
+\
+    /* The cursor ends up right after the new element */ \
+    bool CMC_(PFX, _push_at)(struct SNAME * _gb_, V value, size_t index) \
+    { \
+        if (index > _gb_->count) \
+        { \
+            _gb_->flag = CMC_FLAG_RANGE; \
+            return false; \
+        } \
+\
+        if (CMC_(PFX, _full)(_gb_)) \
+        { \
+            if (!CMC_(PFX, _resize)(_gb_, _gb_->count * 2)) \
+                return false; \
+        } \
+\
+        CMC_(PFX, _impl_move_gap)(_gb_, index); \
+\
+        _gb_->buffer[_gb_->gap++] = value; \
+        _gb_->count++; \
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_gb_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _push_back)(struct SNAME * _gb_, V value) \
+    { \
+        return CMC_(PFX, _push_at)(_gb_, value, _gb_->count); \
+    } \
+\
+    bool CMC_(PFX, _pop_front)(struct SNAME * _gb_) \
+    { \
+        return CMC_(PFX, _pop_at)(_gb_, 0); \
+    } \
+\
+    /* The cursor ends up where the removed element was */ \
+    bool CMC_(PFX, _pop_at)(struct SNAME * _gb_, size_t index) \
+    { \
+        if (CMC_(PFX, _empty)(_gb_)) \
+        { \
+            _gb_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        if (index >= _gb_->count) \
+        { \
+            _gb_->flag = CMC_FLAG_RANGE; \
+            return false; \
+        } \
+\
+        CMC_(PFX, _impl_move_gap)(_gb_, index); \
+\
+        /* The element is right after the gap, which grows over it */ \
+        _gb_->buffer[_gb_->gap + _gb_->capacity - _gb_->count] = (V){ 0 }; \
+        _gb_->count--; \
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_gb_, delete); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _pop_back)(struct SNAME * _gb_) \
+    { \
+        if (CMC_(PFX, _empty)(_gb_)) \
+        { \
+            _gb_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        return CMC_(PFX, _pop_at)(_gb_, _gb_->count - 1); \
+    } \
+\
+    /* Moves the gap so that the next edits around index are cheap */ \
+    bool CMC_(PFX, _move_cursor)(struct SNAME * _gb_, size_t index) \
+    { \
+        if (index > _gb_->count) \
+        { \
+            _gb_->flag = CMC_FLAG_RANGE; \
+            return false; \
+        } \
+\
+        CMC_(PFX, _impl_move_gap)(_gb_, index); \
+\
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        return true; \
+    } \
+\
+    size_t CMC_(PFX, _cursor)(struct SNAME * _gb_) \
+    { \
+        return _gb_->gap; \
+    } \
+\
+    V CMC_(PFX, _front)(struct SNAME * _gb_) \
+    { \
+        if (CMC_(PFX, _empty)(_gb_)) \
+        { \
+            _gb_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_gb_, read); \
+\
+        return _gb_->buffer[CMC_(PFX, _impl_position)(_gb_, 0)]; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _gb_, size_t index) \
+    { \
+        if (CMC_(PFX, _empty)(_gb_)) \
+        { \
+            _gb_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        if (index >= _gb_->count) \
+        { \
+            _gb_->flag = CMC_FLAG_RANGE; \
+            return (V){ 0 }; \
+        } \
+\
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_gb_, read); \
+\
+        return _gb_->buffer[CMC_(PFX, _impl_position)(_gb_, index)]; \
+    } \
+\
+    /* The reference is invalidated once the gap moves */ \
+    V *CMC_(PFX, _get_ref)(struct SNAME * _gb_, size_t index) \
+    { \
+        if (CMC_(PFX, _empty)(_gb_)) \
+        { \
+            _gb_->flag = CMC_FLAG_EMPTY; \
+            return NULL; \
+        } \
+\
+        if (index >= _gb_->count) \
+        { \
+            _gb_->flag = CMC_FLAG_RANGE; \
+            return NULL; \
+        } \
+\
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_gb_, read); \
+\
+        return &(_gb_->buffer[CMC_(PFX, _impl_position)(_gb_, index)]); \
+    } \
+\
+    V CMC_(PFX, _back)(struct SNAME * _gb_) \
+    { \
+        if (CMC_(PFX, _empty)(_gb_)) \
+        { \
+            _gb_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_gb_, read); \
+\
+        return _gb_->buffer[CMC_(PFX, _impl_position)(_gb_, _gb_->count - 1)]; \
+    } \
+\
+    size_t CMC_(PFX, _index_of)(struct SNAME * _gb_, V value, bool from_start) \
+    { \
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        size_t result = _gb_->count; \
+\
+        if (from_start) \
+        { \
+            for (size_t i = 0; i < _gb_->count; i++) \
+            { \
+                if (_gb_->f_val->cmp(_gb_->buffer[CMC_(PFX, _impl_position)(_gb_, i)], value) == 0) \
+                { \
+                    result = i; \
+                    break; \
+                } \
+            } \
+        } \
+        else \
+        { \
+            for (size_t i = _gb_->count; i > 0; i--) \
+            { \
+                if (_gb_->f_val->cmp(_gb_->buffer[CMC_(PFX, _impl_position)(_gb_, i - 1)], value) == 0) \
+                { \
+                    result = i - 1; \
+                    break; \
+                } \
+            } \
+        } \
+\
+        CMC_CALLBACKS_CALL(_gb_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _gb_, V value) \
+    { \
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        bool result = false; \
+\
+        for (size_t i = 0; i < _gb_->count; i++) \
+        { \
+            if (_gb_->f_val->cmp(_gb_->buffer[CMC_(PFX, _impl_position)(_gb_, i)], value) == 0) \
+            { \
+                result = true; \
+                break; \
+            } \
+        } \
+\
+        CMC_CALLBACKS_CALL(_gb_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _gb_) \
+    { \
+        return _gb_->count == 0; \
+    } \
+\
+    bool CMC_(PFX, _full)(struct SNAME * _gb_) \
+    { \
+        return _gb_->count >= _gb_->capacity; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _gb_) \
+    { \
+        return _gb_->count; \
+    } \
+\
+    bool CMC_(PFX, _fits)(struct SNAME * _gb_, size_t size) \
+    { \
+        return _gb_->count + size <= _gb_->capacity; \
+    } \
+\
+    size_t CMC_(PFX, _capacity)(struct SNAME * _gb_) \
+    { \
+        return _gb_->capacity; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _gb_) \
+    { \
+        return _gb_->flag; \
+    } \
+\
+    bool CMC_(PFX, _resize)(struct SNAME * _gb_, size_t capacity) \
+    { \
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        if (_gb_->capacity == capacity) \
+            return true; \
+\
+        if (capacity < _gb_->count || capacity < 1) \
+        { \
+            _gb_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        /* Elements after the gap */ \
+        size_t tail = _gb_->count - _gb_->gap; \
+\
+        /* When shrinking, the elements after the gap are moved before the */ \
+        /* buffer loses its end */ \
+        if (capacity < _gb_->capacity) \
+        { \
+            memmove(_gb_->buffer + capacity - tail, _gb_->buffer + _gb_->capacity - tail, sizeof(V) * tail); \
+        } \
+\
+        V *new_buffer = _gb_->alloc->realloc(_gb_->buffer, sizeof(V) * capacity); \
+\
+        if (!new_buffer) \
+        { \
+            if (capacity < _gb_->capacity) \
+            { \
+                memmove(_gb_->buffer + _gb_->capacity - tail, _gb_->buffer + capacity - tail, sizeof(V) * tail); \
+            } \
+\
+            _gb_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        if (capacity > _gb_->capacity) \
+        { \
+            memmove(new_buffer + capacity - tail, new_buffer + _gb_->capacity - tail, sizeof(V) * tail); \
+        } \
+\
+        _gb_->buffer = new_buffer; \
+        _gb_->capacity = capacity; \
+\
+        CMC_CALLBACKS_CALL(_gb_, resize); \
+\
+        return true; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _gb_) \
+    { \
+        struct SNAME *result = CMC_(PFX, _new_custom)(_gb_->capacity, _gb_->f_val, _gb_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _gb_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _gb_->callbacks); \
+\
+        /* The copy has its gap at the end */ \
+        for (size_t i = 0; i < _gb_->count; i++) \
+        { \
+            V value = _gb_->buffer[CMC_(PFX, _impl_position)(_gb_, i)]; \
+\
+            if (_gb_->f_val->cpy) \
+                result->buffer[i] = _gb_->f_val->cpy(value); \
+            else \
+                result->buffer[i] = value; \
+        } \
+\
+        result->count = _gb_->count; \
+        result->gap = _gb_->count; \
+\
+        _gb_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _gb1_, struct SNAME * _gb2_) \
+    { \
+        _gb1_->flag = CMC_FLAG_OK; \
+        _gb2_->flag = CMC_FLAG_OK; \
+\
+        if (_gb1_->count != _gb2_->count) \
+            return false; \
+\
+        for (size_t i = 0; i < _gb1_->count; i++) \
+        { \
+            V value1 = _gb1_->buffer[CMC_(PFX, _impl_position)(_gb1_, i)]; \
+            V value2 = _gb2_->buffer[CMC_(PFX, _impl_position)(_gb2_, i)]; \
+\
+            if (0 != _gb1_->f_val->cmp(value1, value2)) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    /* Position in the buffer of the element at the given index */ \
+    static size_t CMC_(PFX, _impl_position)(struct SNAME * _gb_, size_t index) \
+    { \
+        return index < _gb_->gap ? index : index + _gb_->capacity - _gb_->count; \
+    } \
+\
+    /* Only the elements between the old and the new position are moved */ \
+    static void CMC_(PFX, _impl_move_gap)(struct SNAME * _gb_, size_t index) \
+    { \
+        size_t gap_size = _gb_->capacity - _gb_->count; \
+\
+        if (gap_size > 0) \
+        { \
+            if (index < _gb_->gap) \
+            { \
+                memmove(_gb_->buffer + index + gap_size, _gb_->buffer + index, sizeof(V) * (_gb_->gap - index)); \
+            } \
+            else if (index > _gb_->gap) \
+            { \
+                V *tail = _gb_->buffer + _gb_->gap + gap_size; \
+\
+                memmove(_gb_->buffer + _gb_->gap, tail, sizeof(V) * (index - _gb_->gap)); \
+            } \
+        } \
+\
+        _gb_->gap = index; \
+    }
+
+#endif /* CMC_CMC_GAPBUFFER_H */
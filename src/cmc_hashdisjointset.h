@@ -0,0 +1,765 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_hashdisjointset.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * HashDisjointSet
+ *
+ * A HashDisjointSet is a DisjointSet (or Union-Find) of keys of any type
+ * instead of a range of unsigned integers. Every key inserted starts in a set
+ * of its own and two sets can be joined into one with _union(). _find()
+ * returns a key that represents the set of another key, so two keys are in the
+ * same set if they have the same representative.
+ *
+ * Keys are given an index in the order they are inserted and a flat hashtable
+ * maps each key to its index. Sets are kept over these indexes exactly like
+ * in a DisjointSet, so only a single hash lookup is made per key given to an
+ * operation, no matter how long the path to its root is.
+ */
+
+#ifndef CMC_CMC_HASHDISJOINTSET_H
+#define CMC_CMC_HASHDISJOINTSET_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/* -------------------------------------------------------------------------
+ * Hashtable Implementation
+ * ------------------------------------------------------------------------- */
+#include "cor_hashtable.h"
+
+/**
+ * Core HashDisjointSet implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_HASHDISJOINTSET_CORE(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_CMC_HASHDISJOINTSET_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_HASHDISJOINTSET_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_HASHDISJOINTSET_CORE_STRUCT(PARAMS) \
+    CMC_CMC_HASHDISJOINTSET_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_HASHDISJOINTSET_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_HASHDISJOINTSET_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_HASHDISJOINTSET_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_CMC_HASHDISJOINTSET_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_HASHDISJOINTSET_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_HASHDISJOINTSET_CORE_STRUCT(PARAMS) \
+    CMC_CMC_HASHDISJOINTSET_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_HASHDISJOINTSET_CORE_STRUCT(PARAMS) \
+    CMC_CMC_HASHDISJOINTSET_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS))
+
+#define CMC_CMC_HASHDISJOINTSET_CORE_HEADER(PARAMS) \
+    CMC_CMC_HASHDISJOINTSET_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS))
+
+#define CMC_CMC_HASHDISJOINTSET_CORE_SOURCE(PARAMS) \
+    CMC_CMC_HASHDISJOINTSET_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_HASHDISJOINTSET_CORE_STRUCT_(PFX, SNAME, K) \
+\
+    /* HashDisjointSet Structure */ \
+    struct SNAME \
+    { \
+        /* Keys in the order they were inserted */ \
+        K *keys; \
+\
+        /* Parent of each key, roots are their own parent */ \
+        size_t *parent; \
+\
+        /* Upper bound of the height of the tree of each root */ \
+        unsigned char *rank; \
+\
+        /* Amount of keys in the set of each root */ \
+        size_t *size; \
+\
+        /* Circular list of the keys in each set */ \
+        size_t *next; \
+        size_t *prev; \
+\
+        /* Maps a key to its index plus one, zero is an empty bucket */ \
+        size_t *buckets; \
+\
+        /* Amount of buckets */ \
+        size_t bucket_count; \
+\
+        /* How many keys fit in the arrays above */ \
+        size_t capacity; \
+\
+        /* Amount of keys */ \
+        size_t count; \
+\
+        /* Amount of sets */ \
+        size_t sets; \
+\
+        /* Load factor in range (0.0, 1.0) */ \
+        double load; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Key function table */ \
+        struct CMC_DEF_FKEY(SNAME) * f_key; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_HASHDISJOINTSET_CORE_HEADER_(PFX, SNAME, K) \
+\
+    /* Key struct function table */ \
+    struct CMC_DEF_FKEY(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(K); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(K); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(K); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(K); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(K); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(K); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, double load, struct CMC_DEF_FKEY(SNAME) * f_key); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, double load, struct CMC_DEF_FKEY(SNAME) * f_key, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _clear)(struct SNAME * _set_); \
+    void CMC_(PFX, _free)(struct SNAME * _set_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _set_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _insert)(struct SNAME * _set_, K key); \
+    bool CMC_(PFX, _union)(struct SNAME * _set_, K key1, K key2); \
+    /* Element Access */ \
+    bool CMC_(PFX, _find)(struct SNAME * _set_, K key, K * root); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _set_, K key); \
+    bool CMC_(PFX, _connected)(struct SNAME * _set_, K key1, K key2); \
+    size_t CMC_(PFX, _set_size)(struct SNAME * _set_, K key); \
+    size_t CMC_(PFX, _set_count)(struct SNAME * _set_); \
+    bool CMC_(PFX, _empty)(struct SNAME * _set_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _set_); \
+    size_t CMC_(PFX, _capacity)(struct SNAME * _set_); \
+    int CMC_(PFX, _flag)(struct SNAME * _set_); \
+    /* Collection Utility */ \
+    bool CMC_(PFX, _resize)(struct SNAME * _set_, size_t capacity); \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _set_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _set1_, struct SNAME * _set2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_HASHDISJOINTSET_CORE_SOURCE_(PFX, SNAME, K) \
+\
+    /* Implementation Detail Functions */ \
+    static size_t CMC_(PFX, _impl_get_index)(struct SNAME * _set_, K key); \
+    static void CMC_(PFX, _impl_add_bucket)(struct SNAME * _set_, size_t index); \
+    static size_t CMC_(PFX, _impl_find)(struct SNAME * _set_, size_t index); \
+    static void CMC_(PFX, _impl_link)(struct SNAME * _set_, size_t root1, size_t root2); \
+    static size_t CMC_(PFX, _impl_calculate_size)(size_t required); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, double load, struct CMC_DEF_FKEY(SNAME) * f_key) \
+    { \
+        return CMC_(PFX, _new_custom)(capacity, load, f_key, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, double load, struct CMC_DEF_FKEY(SNAME) * f_key, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (capacity == 0 || load <= 0 || load >= 1) \
+            return NULL; \
+\
+        /* Prevent integer overflow */ \
+        if (capacity >= UINTMAX_MAX * load || capacity > SIZE_MAX / sizeof(size_t) || \
+            capacity > SIZE_MAX / sizeof(K)) \
+            return NULL; \
+\
+        if (!f_key) \
+            return NULL; \
+\
+        size_t bucket_count = CMC_(PFX, _impl_calculate_size)(capacity / load); \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_set_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_set_) \
+            return NULL; \
+\
+        _set_->keys = alloc->malloc(sizeof(K) * capacity); \
+        _set_->parent = alloc->malloc(sizeof(size_t) * capacity); \
+        _set_->rank = alloc->malloc(sizeof(unsigned char) * capacity); \
+        _set_->size = alloc->malloc(sizeof(size_t) * capacity); \
+        _set_->next = alloc->malloc(sizeof(size_t) * capacity); \
+        _set_->prev = alloc->malloc(sizeof(size_t) * capacity); \
+        _set_->buckets = alloc->calloc(bucket_count, sizeof(size_t)); \
+\
+        if (!_set_->keys || !_set_->parent || !_set_->rank || !_set_->size || !_set_->next || !_set_->prev || \
+            !_set_->buckets) \
+        { \
+            alloc->free(_set_->keys); \
+            alloc->free(_set_->parent); \
+            alloc->free(_set_->rank); \
+            alloc->free(_set_->size); \
+            alloc->free(_set_->next); \
+            alloc->free(_set_->prev); \
+            alloc->free(_set_->buckets); \
+            alloc->free(_set_); \
+            return NULL; \
+        } \
+\
+        _set_->bucket_count = bucket_count; \
+        _set_->capacity = capacity; \
+        _set_->count = 0; \
+        _set_->sets = 0; \
+        _set_->load = load; \
+        _set_->flag = CMC_FLAG_OK; \
+        _set_->f_key = f_key; \
+        _set_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_set_, callbacks); \
+\
+        return _set_; \
+    } \
+\
+    void CMC_(PFX, _clear)(struct SNAME * _set_) \
+    { \
+        if (_set_->f_key->free) \
+        { \
+            for (size_t i = 0; i < _set_->count; i++) \
+                _set_->f_key->free(_set_->keys[i]); \
+        } \
+\
+        memset(_set_->buckets, 0, sizeof(size_t) * _set_->bucket_count); \
+\
+        _set_->count = 0; \
+        _set_->sets = 0; \
+        _set_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _set_) \
+    { \
+        if (_set_->f_key->free) \
+        { \
+            for (size_t i = 0; i < _set_->count; i++) \
+                _set_->f_key->free(_set_->keys[i]); \
+        } \
+\
+        _set_->alloc->free(_set_->keys); \
+        _set_->alloc->free(_set_->parent); \
+        _set_->alloc->free(_set_->rank); \
+        _set_->alloc->free(_set_->size); \
+        _set_->alloc->free(_set_->next); \
+        _set_->alloc->free(_set_->prev); \
+        _set_->alloc->free(_set_->buckets); \
+        _set_->alloc->free(_set_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _set_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _set_->alloc = &cmc_alloc_node_default; \
+        else \
+            _set_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_set_, callbacks); \
+\
+        _set_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _insert)(struct SNAME * _set_, K key) \
+    { \
+        if (CMC_(PFX, _impl_get_index)(_set_, key) != SIZE_MAX) \
+        { \
+            _set_->flag = CMC_FLAG_DUPLICATE; \
+            return false; \
+        } \
+\
+        if (_set_->count == _set_->capacity) \
+        { \
+            /* Prevent integer overflow */ \
+            if (_set_->capacity > SIZE_MAX / 2) \
+            { \
+                _set_->flag = CMC_FLAG_ERROR; \
+                return false; \
+            } \
+\
+            if (!CMC_(PFX, _resize)(_set_, _set_->capacity * 2)) \
+                return false; \
+        } \
+\
+        size_t index = _set_->count; \
+\
+        /* A set of its own */ \
+        _set_->keys[index] = key; \
+        _set_->parent[index] = index; \
+        _set_->rank[index] = 0; \
+        _set_->size[index] = 1; \
+        _set_->next[index] = index; \
+        _set_->prev[index] = index; \
+\
+        CMC_(PFX, _impl_add_bucket)(_set_, index); \
+\
+        _set_->count++; \
+        _set_->sets++; \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _union)(struct SNAME * _set_, K key1, K key2) \
+    { \
+        if (CMC_(PFX, _empty)(_set_)) \
+        { \
+            _set_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        size_t index1 = CMC_(PFX, _impl_get_index)(_set_, key1); \
+        size_t index2 = CMC_(PFX, _impl_get_index)(_set_, key2); \
+\
+        if (index1 == SIZE_MAX || index2 == SIZE_MAX) \
+        { \
+            _set_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        size_t root1 = CMC_(PFX, _impl_find)(_set_, index1); \
+        size_t root2 = CMC_(PFX, _impl_find)(_set_, index2); \
+\
+        if (root1 == root2) \
+        { \
+            _set_->flag = CMC_FLAG_DUPLICATE; \
+            return false; \
+        } \
+\
+        CMC_(PFX, _impl_link)(_set_, root1, root2); \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, update); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _find)(struct SNAME * _set_, K key, K * root) \
+    { \
+        if (CMC_(PFX, _empty)(_set_)) \
+        { \
+            _set_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        size_t index = CMC_(PFX, _impl_get_index)(_set_, key); \
+\
+        if (index == SIZE_MAX) \
+        { \
+            _set_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (root) \
+            *root = _set_->keys[CMC_(PFX, _impl_find)(_set_, index)]; \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _set_, K key) \
+    { \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        bool result = CMC_(PFX, _impl_get_index)(_set_, key) != SIZE_MAX; \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _connected)(struct SNAME * _set_, K key1, K key2) \
+    { \
+        size_t index1 = CMC_(PFX, _impl_get_index)(_set_, key1); \
+        size_t index2 = CMC_(PFX, _impl_get_index)(_set_, key2); \
+\
+        if (index1 == SIZE_MAX || index2 == SIZE_MAX) \
+        { \
+            _set_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        size_t root1 = CMC_(PFX, _impl_find)(_set_, index1); \
+        size_t root2 = CMC_(PFX, _impl_find)(_set_, index2); \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return root1 == root2; \
+    } \
+\
+    size_t CMC_(PFX, _set_size)(struct SNAME * _set_, K key) \
+    { \
+        size_t index = CMC_(PFX, _impl_get_index)(_set_, key); \
+\
+        if (index == SIZE_MAX) \
+        { \
+            _set_->flag = CMC_FLAG_NOT_FOUND; \
+            return 0; \
+        } \
+\
+        size_t result = _set_->size[CMC_(PFX, _impl_find)(_set_, index)]; \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return result; \
+    } \
+\
+    size_t CMC_(PFX, _set_count)(struct SNAME * _set_) \
+    { \
+        return _set_->sets; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _set_) \
+    { \
+        return _set_->count == 0; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _set_) \
+    { \
+        return _set_->count; \
+    } \
+\
+    size_t CMC_(PFX, _capacity)(struct SNAME * _set_) \
+    { \
+        return _set_->capacity; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _set_) \
+    { \
+        return _set_->flag; \
+    } \
+\
+    bool CMC_(PFX, _resize)(struct SNAME * _set_, size_t capacity) \
+    { \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        if (_set_->capacity == capacity) \
+            goto success; \
+\
+        /* Keys can't be taken out of their sets */ \
+        if (capacity < _set_->count || capacity == 0) \
+        { \
+            _set_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        /* Prevent integer overflow */ \
+        if (capacity >= UINTMAX_MAX * _set_->load || capacity > SIZE_MAX / sizeof(size_t) || \
+            capacity > SIZE_MAX / sizeof(K)) \
+        { \
+            _set_->flag = CMC_FLAG_ERROR; \
+            return false; \
+        } \
+\
+        size_t bucket_count = CMC_(PFX, _impl_calculate_size)(capacity / _set_->load); \
+\
+        size_t *new_buckets = _set_->alloc->calloc(bucket_count, sizeof(size_t)); \
+\
+        if (!new_buckets) \
+            goto alloc_error; \
+\
+        /* When growing, arrays that were already reallocated are only larger */ \
+        /* than needed if a later one fails. When shrinking, an array that */ \
+        /* fails to shrink keeps its old block, which still fits every key */ \
+        bool grow = capacity > _set_->capacity; \
+\
+        K *new_keys = _set_->alloc->realloc(_set_->keys, sizeof(K) * capacity); \
+\
+        if (new_keys) \
+            _set_->keys = new_keys; \
+        else if (grow) \
+            goto buckets_error; \
+\
+        size_t *new_parent = _set_->alloc->realloc(_set_->parent, sizeof(size_t) * capacity); \
+\
+        if (new_parent) \
+            _set_->parent = new_parent; \
+        else if (grow) \
+            goto buckets_error; \
+\
+        unsigned char *new_rank = _set_->alloc->realloc(_set_->rank, sizeof(unsigned char) * capacity); \
+\
+        if (new_rank) \
+            _set_->rank = new_rank; \
+        else if (grow) \
+            goto buckets_error; \
+\
+        size_t *new_size = _set_->alloc->realloc(_set_->size, sizeof(size_t) * capacity); \
+\
+        if (new_size) \
+            _set_->size = new_size; \
+        else if (grow) \
+            goto buckets_error; \
+\
+        size_t *new_next = _set_->alloc->realloc(_set_->next, sizeof(size_t) * capacity); \
+\
+        if (new_next) \
+            _set_->next = new_next; \
+        else if (grow) \
+            goto buckets_error; \
+\
+        size_t *new_prev = _set_->alloc->realloc(_set_->prev, sizeof(size_t) * capacity); \
+\
+        if (new_prev) \
+            _set_->prev = new_prev; \
+        else if (grow) \
+            goto buckets_error; \
+\
+        _set_->alloc->free(_set_->buckets); \
+\
+        _set_->buckets = new_buckets; \
+        _set_->bucket_count = bucket_count; \
+        _set_->capacity = capacity; \
+\
+        for (size_t i = 0; i < _set_->count; i++) \
+            CMC_(PFX, _impl_add_bucket)(_set_, i); \
+\
+    success: \
+\
+        CMC_CALLBACKS_CALL(_set_, resize); \
+\
+        return true; \
+\
+    buckets_error: \
+\
+        _set_->alloc->free(new_buckets); \
+\
+    alloc_error: \
+\
+        _set_->flag = CMC_FLAG_ALLOC; \
+        return false; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _set_) \
+    { \
+        struct SNAME *result = \
+            CMC_(PFX, _new_custom)(_set_->capacity, _set_->load, _set_->f_key, _set_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _set_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _set_->callbacks); \
+\
+        if (_set_->f_key->cpy) \
+        { \
+            for (size_t i = 0; i < _set_->count; i++) \
+                result->keys[i] = _set_->f_key->cpy(_set_->keys[i]); \
+        } \
+        else \
+            memcpy(result->keys, _set_->keys, sizeof(K) * _set_->count); \
+\
+        memcpy(result->parent, _set_->parent, sizeof(size_t) * _set_->count); \
+        memcpy(result->rank, _set_->rank, sizeof(unsigned char) * _set_->count); \
+        memcpy(result->size, _set_->size, sizeof(size_t) * _set_->count); \
+        memcpy(result->next, _set_->next, sizeof(size_t) * _set_->count); \
+        memcpy(result->prev, _set_->prev, sizeof(size_t) * _set_->count); \
+\
+        /* Both have the same amount of buckets */ \
+        memcpy(result->buckets, _set_->buckets, sizeof(size_t) * _set_->bucket_count); \
+\
+        result->count = _set_->count; \
+        result->sets = _set_->sets; \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        _set1_->flag = CMC_FLAG_OK; \
+        _set2_->flag = CMC_FLAG_OK; \
+\
+        if (_set1_->count != _set2_->count || _set1_->sets != _set2_->sets) \
+            return false; \
+\
+        /* If every set of the first is inside a set of the second and both */ \
+        /* have the same keys and amount of sets then they are the same */ \
+        /* partition */ \
+        for (size_t i = 0; i < _set1_->count; i++) \
+        { \
+            size_t root1 = CMC_(PFX, _impl_find)(_set1_, i); \
+\
+            size_t index = CMC_(PFX, _impl_get_index)(_set2_, _set1_->keys[i]); \
+\
+            if (index == SIZE_MAX) \
+                return false; \
+\
+            size_t root_index = CMC_(PFX, _impl_get_index)(_set2_, _set1_->keys[root1]); \
+\
+            if (CMC_(PFX, _impl_find)(_set2_, index) != CMC_(PFX, _impl_find)(_set2_, root_index)) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    /* Returns SIZE_MAX if the key is not in the set */ \
+    static size_t CMC_(PFX, _impl_get_index)(struct SNAME * _set_, K key) \
+    { \
+        size_t pos = _set_->f_key->hash(key) % _set_->bucket_count; \
+\
+        while (_set_->buckets[pos] != 0) \
+        { \
+            size_t index = _set_->buckets[pos] - 1; \
+\
+            if (_set_->f_key->cmp(_set_->keys[index], key) == 0) \
+                return index; \
+\
+            pos = (pos + 1) % _set_->bucket_count; \
+        } \
+\
+        return SIZE_MAX; \
+    } \
+\
+    static void CMC_(PFX, _impl_add_bucket)(struct SNAME * _set_, size_t index) \
+    { \
+        size_t pos = _set_->f_key->hash(_set_->keys[index]) % _set_->bucket_count; \
+\
+        /* Keys are never removed on their own so there are no tombstones */ \
+        while (_set_->buckets[pos] != 0) \
+            pos = (pos + 1) % _set_->bucket_count; \
+\
+        _set_->buckets[pos] = index + 1; \
+    } \
+\
+    static size_t CMC_(PFX, _impl_find)(struct SNAME * _set_, size_t index) \
+    { \
+        /* Path halving: every other key on the way points to its */ \
+        /* grandparent */ \
+        while (_set_->parent[index] != index) \
+        { \
+            _set_->parent[index] = _set_->parent[_set_->parent[index]]; \
+            index = _set_->parent[index]; \
+        } \
+\
+        return index; \
+    } \
+\
+    static void CMC_(PFX, _impl_link)(struct SNAME * _set_, size_t root1, size_t root2) \
+    { \
+        if (_set_->rank[root1] < _set_->rank[root2]) \
+        { \
+            size_t tmp = root1; \
+            root1 = root2; \
+            root2 = tmp; \
+        } \
+        else if (_set_->rank[root1] == _set_->rank[root2]) \
+            _set_->rank[root1]++; \
+\
+        _set_->parent[root2] = root1; \
+        _set_->size[root1] += _set_->size[root2]; \
+\
+        /* Splice both circular lists into one */ \
+        size_t next1 = _set_->next[root1]; \
+        size_t next2 = _set_->next[root2]; \
+\
+        _set_->next[root1] = next2; \
+        _set_->prev[next2] = root1; \
+        _set_->next[root2] = next1; \
+        _set_->prev[next1] = root2; \
+\
+        _set_->sets--; \
+    } \
+\
+    static size_t CMC_(PFX, _impl_calculate_size)(size_t required) \
+    { \
+        const size_t count = sizeof(cmc_hashtable_primes) / sizeof(cmc_hashtable_primes[0]); \
+\
+        if (cmc_hashtable_primes[count - 1] < required) \
+            return required; \
+\
+        size_t i = 0; \
+        while (cmc_hashtable_primes[i] < required) \
+            i++; \
+\
+        return cmc_hashtable_primes[i]; \
+    }
+
+#endif /* CMC_CMC_HASHDISJOINTSET_H */
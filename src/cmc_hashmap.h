@@ -110,6 +110,12 @@
 \
         /* Load factor in range (0.0, 1.0) */ \
         double load; \
+\
+        /* Load factor below which the table shrinks on removal (0 disables it) */ \
+        double shrink; \
+\
+        /* Entries from an older epoch are empty; bumped by _clear() */ \
+        uint16_t epoch; \
 \
         /* Flags indicating errors or success */ \
         int flag; \
@@ -142,6 +148,9 @@
 \
         /* The sate of this node (DELETED, EMPTY, FILLED) */ \
         enum cmc_entry_state state; \
+\
+        /* The epoch in which the state was last written */ \
+        uint16_t epoch; \
     };
 
 /* -------------------------------------------------------------------------
@@ -207,6 +216,8 @@
                                struct CMC_CALLBACKS_NAME * callbacks); \
     /* Collection Input and Output */ \
     bool CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value); \
+    bool CMC_(PFX, _insert_ptr)(struct SNAME * _map_, const K *key, const V *value); \
+    V *CMC_(PFX, _emplace)(struct SNAME * _map_, K key); \
     bool CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value); \
     bool CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value); \
     /* Element Access */ \
@@ -224,6 +235,8 @@
     int CMC_(PFX, _flag)(struct SNAME * _map_); \
     /* Collection Utility */ \
     bool CMC_(PFX, _resize)(struct SNAME * _map_, size_t capacity); \
+    bool CMC_(PFX, _shrink_to_fit)(struct SNAME * _map_); \
+    bool CMC_(PFX, _set_shrink)(struct SNAME * _map_, double shrink); \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_); \
     bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_);
 
@@ -234,6 +247,9 @@
 \
     /* Implementation Detail Functions */ \
     static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_entry)(struct SNAME * _map_, K key); \
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_insert)(struct SNAME * _map_, const K *key); \
+    static bool CMC_(PFX, _impl_rehash)(struct SNAME * _map_, size_t capacity); \
+    static void CMC_(PFX, _impl_shrink)(struct SNAME * _map_); \
     static size_t CMC_(PFX, _impl_calculate_size)(size_t required); \
 \
     struct SNAME *CMC_(PFX, _new)(size_t capacity, double load, struct CMC_DEF_FKEY(SNAME) * f_key, \
@@ -279,6 +295,8 @@
         _map_->count = 0; \
         _map_->capacity = real_capacity; \
         _map_->load = load; \
+        _map_->shrink = 0; \
+        _map_->epoch = 0; \
         _map_->flag = CMC_FLAG_OK; \
         _map_->f_key = f_key; \
         _map_->f_val = f_val; \
@@ -296,7 +314,7 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *entry = &(_map_->buffer[i]); \
 \
-                if (entry->state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(*entry, _map_->epoch) == CMC_ES_FILLED) \
                 { \
                     if (_map_->f_key->free) \
                         _map_->f_key->free(entry->key); \
@@ -306,7 +324,15 @@
             } \
         } \
 \
-        memset(_map_->buffer, 0, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _map_->capacity); \
+        /* Instead of wiping the buffer, every entry is made stale at once by */ \
+        /* moving to the next epoch. The buffer is only wiped on wraparound */ \
+        if (_map_->epoch == UINT16_MAX) \
+        { \
+            memset(_map_->buffer, 0, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _map_->capacity); \
+            _map_->epoch = 0; \
+        } \
+        else \
+            _map_->epoch++; \
 \
         _map_->count = 0; \
         _map_->flag = CMC_FLAG_OK; \
@@ -320,7 +346,7 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *entry = &(_map_->buffer[i]); \
 \
-                if (entry->state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(*entry, _map_->epoch) == CMC_ES_FILLED) \
                 { \
                     if (_map_->f_key->free) \
                         _map_->f_key->free(entry->key); \
@@ -351,70 +377,44 @@
 \
     bool CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value) \
     { \
-        if (CMC_(PFX, _full)(_map_)) \
-        { \
-            if (!CMC_(PFX, _resize)(_map_, _map_->capacity + 1)) \
-                return false; \
-        } \
+        struct CMC_DEF_ENTRY(SNAME) *entry = CMC_(PFX, _impl_insert)(_map_, &key); \
 \
-        if (CMC_(PFX, _impl_get_entry)(_map_, key) != NULL) \
-        { \
-            _map_->flag = CMC_FLAG_DUPLICATE; \
+        if (!entry) \
             return false; \
-        } \
 \
-        size_t hash = _map_->f_key->hash(key); \
-        size_t original_pos = hash % _map_->capacity; \
-        size_t pos = original_pos; \
+        entry->value = value; \
 \
-        struct CMC_DEF_ENTRY(SNAME) *target = &(_map_->buffer[pos]); \
+        CMC_CALLBACKS_CALL(_map_, create); \
 \
-        if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED) \
-        { \
-            target->key = key; \
-            target->value = value; \
-            target->dist = 0; \
-            target->state = CMC_ES_FILLED; \
-        } \
-        else \
-        { \
-            while (true) \
-            { \
-                pos++; \
-                target = &(_map_->buffer[pos % _map_->capacity]); \
+        return true; \
+    } \
 \
-                if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED) \
-                { \
-                    target->key = key; \
-                    target->value = value; \
-                    target->dist = pos - original_pos; \
-                    target->state = CMC_ES_FILLED; \
+    bool CMC_(PFX, _insert_ptr)(struct SNAME * _map_, const K *key, const V *value) \
+    { \
+        struct CMC_DEF_ENTRY(SNAME) *entry = CMC_(PFX, _impl_insert)(_map_, key); \
 \
-                    break; \
-                } \
-                else if (target->dist < pos - original_pos) \
-                { \
-                    K tmp_k = target->key; \
-                    V tmp_v = target->value; \
-                    size_t tmp_dist = target->dist; \
+        if (!entry) \
+            return false; \
 \
-                    target->key = key; \
-                    target->value = value; \
-                    target->dist = pos - original_pos; \
+        entry->value = *value; \
 \
-                    key = tmp_k; \
-                    value = tmp_v; \
-                    original_pos = pos - tmp_dist; \
-                } \
-            } \
-        } \
+        CMC_CALLBACKS_CALL(_map_, create); \
 \
-        _map_->count++; \
-        _map_->flag = CMC_FLAG_OK; \
+        return true; \
+    } \
+\
+    V *CMC_(PFX, _emplace)(struct SNAME * _map_, K key) \
+    { \
+        struct CMC_DEF_ENTRY(SNAME) *entry = CMC_(PFX, _impl_insert)(_map_, &key); \
+\
+        if (!entry) \
+            return NULL; \
+\
+        memset(&(entry->value), 0, sizeof(V)); \
 \
         CMC_CALLBACKS_CALL(_map_, create); \
 \
-        return true; \
+        return &(entry->value); \
     } \
 \
     bool CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value) \
@@ -473,6 +473,9 @@
         _map_->flag = CMC_FLAG_OK; \
 \
         CMC_CALLBACKS_CALL(_map_, delete); \
+\
+        if ((double)_map_->count < (double)_map_->capacity * _map_->shrink) \
+            CMC_(PFX, _impl_shrink)(_map_); \
 \
         return true; \
     } \
@@ -491,7 +494,7 @@
 \
         for (size_t i = 0; i < _map_->capacity; i++) \
         { \
-            if (_map_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_map_->buffer[i], _map_->epoch) == CMC_ES_FILLED) \
             { \
                 if (first) \
                 { \
@@ -533,7 +536,7 @@
 \
         for (size_t i = 0; i < _map_->capacity; i++) \
         { \
-            if (_map_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_map_->buffer[i], _map_->epoch) == CMC_ES_FILLED) \
             { \
                 if (first) \
                 { \
@@ -675,54 +678,42 @@
             return false; \
         } \
 \
-        /* No callbacks since _new_map_ is just a temporary hashtable */ \
-        struct SNAME *_new_map_ = \
-            CMC_(PFX, _new_custom)(capacity, _map_->load, _map_->f_key, _map_->f_val, _map_->alloc, NULL); \
-\
-        if (!_new_map_) \
-        { \
-            _map_->flag = CMC_FLAG_ALLOC; \
+        if (!CMC_(PFX, _impl_rehash)(_map_, capacity)) \
             return false; \
-        } \
 \
-        for (size_t i = 0; i < _map_->capacity; i++) \
-        { \
-            if (_map_->buffer[i].state == CMC_ES_FILLED) \
-            { \
-                K key = _map_->buffer[i].key; \
-                V value = _map_->buffer[i].value; \
+    success: \
 \
-                /* TODO check this for possible errors */ \
-                CMC_(PFX, _insert)(_new_map_, key, value); \
-            } \
-        } \
+        CMC_CALLBACKS_CALL(_map_, resize); \
 \
-        /* Unlikely */ \
-        if (_map_->count != _new_map_->count) \
-        { \
-            CMC_(PFX, _free)(_new_map_); \
+        return true; \
+    } \
 \
-            _map_->flag = CMC_FLAG_ERROR; \
-            return false; \
-        } \
+    bool CMC_(PFX, _shrink_to_fit)(struct SNAME * _map_) \
+    { \
+        _map_->flag = CMC_FLAG_OK; \
 \
-        struct CMC_DEF_ENTRY(SNAME) *tmp_b = _map_->buffer; \
-        _map_->buffer = _new_map_->buffer; \
-        _new_map_->buffer = tmp_b; \
+        if (CMC_(PFX, _impl_calculate_size)(_map_->count / _map_->load) >= _map_->capacity) \
+            return true; \
 \
-        size_t tmp_c = _map_->capacity; \
-        _map_->capacity = _new_map_->capacity; \
-        _new_map_->capacity = tmp_c; \
+        if (!CMC_(PFX, _impl_rehash)(_map_, _map_->count)) \
+            return false; \
 \
-        /* Prevent the map from freeing the data */ \
-        _new_map_->f_key = &(struct CMC_DEF_FKEY(SNAME)){ NULL }; \
-        _new_map_->f_val = &(struct CMC_DEF_FVAL(SNAME)){ NULL }; \
+        CMC_CALLBACKS_CALL(_map_, resize); \
 \
-        CMC_(PFX, _free)(_new_map_); \
+        return true; \
+    } \
 \
-    success: \
+    bool CMC_(PFX, _set_shrink)(struct SNAME * _map_, double shrink) \
+    { \
+        /* Below half the load factor so a table that was just shrunk doesn't shrink again */ \
+        if (shrink < 0 || shrink >= _map_->load / 2) \
+        { \
+            _map_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
 \
-        CMC_CALLBACKS_CALL(_map_, resize); \
+        _map_->shrink = shrink; \
+        _map_->flag = CMC_FLAG_OK; \
 \
         return true; \
     } \
@@ -746,15 +737,17 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *scan = &(_map_->buffer[i]); \
 \
-                if (scan->state != CMC_ES_EMPTY) \
+                if (CMC_ENTRY_STATE(*scan, _map_->epoch) != CMC_ES_EMPTY) \
                 { \
                     struct CMC_DEF_ENTRY(SNAME) *target = &(result->buffer[i]); \
 \
-                    if (scan->state == CMC_ES_DELETED) \
+                    target->epoch = result->epoch; \
+\
+                    if (CMC_ENTRY_STATE(*scan, _map_->epoch) == CMC_ES_DELETED) \
                         target->state = CMC_ES_DELETED; \
                     else \
                     { \
-                        target->state = scan->state; \
+                        target->state = CMC_ES_FILLED; \
                         target->dist = scan->dist; \
 \
                         if (_map_->f_key->cpy) \
@@ -771,9 +764,13 @@
             } \
         } \
         else \
+        { \
             memcpy(result->buffer, _map_->buffer, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _map_->capacity); \
+            result->epoch = _map_->epoch; \
+        } \
 \
         result->count = _map_->count; \
+        result->shrink = _map_->shrink; \
 \
         _map_->flag = CMC_FLAG_OK; \
 \
@@ -797,7 +794,7 @@
 \
         for (size_t i = 0; i < _map_a_->capacity; i++) \
         { \
-            if (_map_a_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_map_a_->buffer[i], _map_a_->epoch) == CMC_ES_FILLED) \
             { \
                 struct CMC_DEF_ENTRY(SNAME) *entry_a = &(_map_a_->buffer[i]); \
                 struct CMC_DEF_ENTRY(SNAME) *entry_b = CMC_(PFX, _impl_get_entry)(_map_b_, entry_a->key); \
@@ -820,7 +817,7 @@
 \
         struct CMC_DEF_ENTRY(SNAME) *target = &(_map_->buffer[pos]); \
 \
-        while (target->state == CMC_ES_FILLED || target->state == CMC_ES_DELETED) \
+        while (CMC_ENTRY_STATE(*target, _map_->epoch) != CMC_ES_EMPTY) \
         { \
             if (_map_->f_key->cmp(target->key, key) == 0) \
                 return target; \
@@ -831,6 +828,135 @@
 \
         return NULL; \
     } \
+\
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_insert)(struct SNAME * _map_, const K *key) \
+    { \
+        if (CMC_(PFX, _full)(_map_)) \
+        { \
+            if (!CMC_(PFX, _resize)(_map_, _map_->capacity + 1)) \
+                return NULL; \
+        } \
+\
+        if (CMC_(PFX, _impl_get_entry)(_map_, *key) != NULL) \
+        { \
+            _map_->flag = CMC_FLAG_DUPLICATE; \
+            return NULL; \
+        } \
+\
+        size_t hash = _map_->f_key->hash(*key); \
+        size_t original_pos = hash % _map_->capacity; \
+        size_t pos = original_pos; \
+\
+        /* Find the first slot that is free or owned by an entry closer to its original position */ \
+        struct CMC_DEF_ENTRY(SNAME) *target = &(_map_->buffer[pos]); \
+\
+        while (CMC_ENTRY_STATE(*target, _map_->epoch) == CMC_ES_FILLED && target->dist >= pos - original_pos) \
+        { \
+            pos++; \
+            target = &(_map_->buffer[pos % _map_->capacity]); \
+        } \
+\
+        if (CMC_ENTRY_STATE(*target, _map_->epoch) == CMC_ES_FILLED) \
+        { \
+            /* Robin hood: shift the rest of the cluster one slot to the right so */ \
+            /* that every displaced entry is moved only once */ \
+            size_t last = pos + 1; \
+\
+            while (CMC_ENTRY_STATE(_map_->buffer[last % _map_->capacity], _map_->epoch) == CMC_ES_FILLED) \
+                last++; \
+\
+            for (size_t i = last; i > pos; i--) \
+            { \
+                struct CMC_DEF_ENTRY(SNAME) *next = &(_map_->buffer[i % _map_->capacity]); \
+\
+                *next = _map_->buffer[(i - 1) % _map_->capacity]; \
+                next->dist++; \
+            } \
+        } \
+\
+        target->key = *key; \
+        target->dist = pos - original_pos; \
+        target->state = CMC_ES_FILLED; \
+        target->epoch = _map_->epoch; \
+\
+        _map_->count++; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        return target; \
+    } \
+\
+    static bool CMC_(PFX, _impl_rehash)(struct SNAME * _map_, size_t capacity) \
+    { \
+        /* An empty table still keeps the smallest possible buffer */ \
+        if (capacity == 0) \
+            capacity = 1; \
+\
+        /* No callbacks since _new_map_ is just a temporary hashtable */ \
+        struct SNAME *_new_map_ = \
+            CMC_(PFX, _new_custom)(capacity, _map_->load, _map_->f_key, _map_->f_val, _map_->alloc, NULL); \
+\
+        if (!_new_map_) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        for (size_t i = 0; i < _map_->capacity; i++) \
+        { \
+            if (CMC_ENTRY_STATE(_map_->buffer[i], _map_->epoch) == CMC_ES_FILLED) \
+            { \
+                K key = _map_->buffer[i].key; \
+                V value = _map_->buffer[i].value; \
+\
+                /* TODO check this for possible errors */ \
+                CMC_(PFX, _insert)(_new_map_, key, value); \
+            } \
+        } \
+\
+        /* Unlikely */ \
+        if (_map_->count != _new_map_->count) \
+        { \
+            CMC_(PFX, _free)(_new_map_); \
+\
+            _map_->flag = CMC_FLAG_ERROR; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *tmp_b = _map_->buffer; \
+        _map_->buffer = _new_map_->buffer; \
+        _new_map_->buffer = tmp_b; \
+\
+        size_t tmp_c = _map_->capacity; \
+        _map_->capacity = _new_map_->capacity; \
+        _new_map_->capacity = tmp_c; \
+\
+        uint16_t tmp_e = _map_->epoch; \
+        _map_->epoch = _new_map_->epoch; \
+        _new_map_->epoch = tmp_e; \
+\
+        /* Prevent the map from freeing the data */ \
+        _new_map_->f_key = &(struct CMC_DEF_FKEY(SNAME)){ NULL }; \
+        _new_map_->f_val = &(struct CMC_DEF_FVAL(SNAME)){ NULL }; \
+\
+        CMC_(PFX, _free)(_new_map_); \
+\
+        return true; \
+    } \
+\
+    static void CMC_(PFX, _impl_shrink)(struct SNAME * _map_) \
+    { \
+        /* Leave room for the table to grow back before it has to resize again */ \
+        size_t capacity = _map_->count * 2; \
+\
+        if (CMC_(PFX, _impl_calculate_size)(capacity / _map_->load) < _map_->capacity) \
+        { \
+            /* A failed shrink doesn't undo the removal */ \
+            if (CMC_(PFX, _impl_rehash)(_map_, capacity)) \
+                CMC_CALLBACKS_CALL(_map_, resize); \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+    } \
 \
     static size_t CMC_(PFX, _impl_calculate_size)(size_t required) \
     { \
@@ -136,6 +136,9 @@
 \
         /* Load factor in range (0.0, infinity) */ \
         double load; \
+\
+        /* Load factor below which the table shrinks on removal (0 disables it) */ \
+        double shrink; \
 \
         /* Flags indicating errors or success */ \
         int flag; \
@@ -252,6 +255,8 @@
     int CMC_(PFX, _flag)(struct SNAME * _map_); \
     /* Collection Utility */ \
     bool CMC_(PFX, _resize)(struct SNAME * _map_, size_t capacity); \
+    bool CMC_(PFX, _shrink_to_fit)(struct SNAME * _map_); \
+    bool CMC_(PFX, _set_shrink)(struct SNAME * _map_, double shrink); \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_); \
     bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_);
 
@@ -264,6 +269,8 @@
     struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_new_entry)(struct SNAME * _map_, K key, V value); \
     struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_entry)(struct SNAME * _map_, K key); \
     size_t CMC_(PFX, _impl_key_count)(struct SNAME * _map_, K key); \
+    bool CMC_(PFX, _impl_rehash)(struct SNAME * _map_, size_t capacity); \
+    void CMC_(PFX, _impl_shrink)(struct SNAME * _map_); \
     size_t CMC_(PFX, _impl_calculate_size)(size_t required); \
 \
     struct SNAME *CMC_(PFX, _new)(size_t capacity, double load, struct CMC_DEF_FKEY(SNAME) * f_key, \
@@ -309,6 +316,7 @@
         _map_->count = 0; \
         _map_->capacity = real_capacity; \
         _map_->load = load; \
+        _map_->shrink = 0; \
         _map_->flag = CMC_FLAG_OK; \
         _map_->f_key = f_key; \
         _map_->f_val = f_val; \
@@ -605,6 +613,9 @@
         _map_->flag = CMC_FLAG_OK; \
 \
         CMC_CALLBACKS_CALL(_map_, delete); \
+\
+        if ((double)_map_->count < (double)_map_->capacity * _map_->shrink) \
+            CMC_(PFX, _impl_shrink)(_map_); \
 \
         return true; \
     } \
@@ -696,6 +707,9 @@
         _map_->flag = CMC_FLAG_OK; \
 \
         CMC_CALLBACKS_CALL(_map_, delete); \
+\
+        if ((double)_map_->count < (double)_map_->capacity * _map_->shrink) \
+            CMC_(PFX, _impl_shrink)(_map_); \
 \
         return index; \
     } \
@@ -913,54 +927,42 @@
             return false; \
         } \
 \
-        /* No callbacks since _new_map_ is just a temporary hashtable */ \
-        struct SNAME *_new_map_ = \
-            CMC_(PFX, _new_custom)(capacity, _map_->load, _map_->f_key, _map_->f_val, _map_->alloc, NULL); \
-\
-        if (!_new_map_) \
-        { \
-            _map_->flag = CMC_FLAG_ALLOC; \
+        if (!CMC_(PFX, _impl_rehash)(_map_, capacity)) \
             return false; \
-        } \
-\
-        for (size_t i = 0; i < _map_->capacity; i++) \
-        { \
-            struct CMC_DEF_ENTRY(SNAME) *scan = _map_->buffer[i][0]; \
 \
-            while (scan) \
-            { \
-                /* TODO check for errors */ \
-                CMC_(PFX, _insert)(_new_map_, scan->key, scan->value); \
+    success: \
 \
-                scan = scan->next; \
-            } \
-        } \
+        CMC_CALLBACKS_CALL(_map_, resize); \
 \
-        if (_map_->count != _new_map_->count) \
-        { \
-            CMC_(PFX, _free)(_new_map_); \
+        return true; \
+    } \
 \
-            _map_->flag = CMC_FLAG_ERROR; \
-            return false; \
-        } \
+    bool CMC_(PFX, _shrink_to_fit)(struct SNAME * _map_) \
+    { \
+        _map_->flag = CMC_FLAG_OK; \
 \
-        struct CMC_DEF_ENTRY(SNAME) * (*tmp_b)[2] = _map_->buffer; \
-        _map_->buffer = _new_map_->buffer; \
-        _new_map_->buffer = tmp_b; \
+        if (CMC_(PFX, _impl_calculate_size)(_map_->count / _map_->load) >= _map_->capacity) \
+            return true; \
 \
-        size_t tmp_c = _map_->capacity; \
-        _map_->capacity = _new_map_->capacity; \
-        _new_map_->capacity = tmp_c; \
+        if (!CMC_(PFX, _impl_rehash)(_map_, _map_->count)) \
+            return false; \
 \
-        /* Prevent the map from freeing the data */ \
-        _new_map_->f_key = &(struct CMC_DEF_FKEY(SNAME)){ NULL }; \
-        _new_map_->f_val = &(struct CMC_DEF_FVAL(SNAME)){ NULL }; \
+        CMC_CALLBACKS_CALL(_map_, resize); \
 \
-        CMC_(PFX, _free)(_new_map_); \
+        return true; \
+    } \
 \
-    success: \
+    bool CMC_(PFX, _set_shrink)(struct SNAME * _map_, double shrink) \
+    { \
+        /* Below half the load factor so a table that was just shrunk doesn't shrink again */ \
+        if (shrink < 0 || shrink >= _map_->load / 2) \
+        { \
+            _map_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
 \
-        CMC_CALLBACKS_CALL(_map_, resize); \
+        _map_->shrink = shrink; \
+        _map_->flag = CMC_FLAG_OK; \
 \
         return true; \
     } \
@@ -1001,6 +1003,8 @@
                 scan = scan->next; \
             } \
         } \
+\
+        result->shrink = _map_->shrink; \
 \
         CMC_CALLBACKS_ASSIGN(result, _map_->callbacks); \
         _map_->flag = CMC_FLAG_OK; \
@@ -1093,6 +1097,75 @@
 \
         return total_count; \
     } \
+\
+    bool CMC_(PFX, _impl_rehash)(struct SNAME * _map_, size_t capacity) \
+    { \
+        /* An empty table still keeps the smallest possible buffer */ \
+        if (capacity == 0) \
+            capacity = 1; \
+\
+        /* No callbacks since _new_map_ is just a temporary hashtable */ \
+        struct SNAME *_new_map_ = \
+            CMC_(PFX, _new_custom)(capacity, _map_->load, _map_->f_key, _map_->f_val, _map_->alloc, NULL); \
+\
+        if (!_new_map_) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        for (size_t i = 0; i < _map_->capacity; i++) \
+        { \
+            struct CMC_DEF_ENTRY(SNAME) *scan = _map_->buffer[i][0]; \
+\
+            while (scan) \
+            { \
+                /* TODO check for errors */ \
+                CMC_(PFX, _insert)(_new_map_, scan->key, scan->value); \
+\
+                scan = scan->next; \
+            } \
+        } \
+\
+        if (_map_->count != _new_map_->count) \
+        { \
+            CMC_(PFX, _free)(_new_map_); \
+\
+            _map_->flag = CMC_FLAG_ERROR; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) * (*tmp_b)[2] = _map_->buffer; \
+        _map_->buffer = _new_map_->buffer; \
+        _new_map_->buffer = tmp_b; \
+\
+        size_t tmp_c = _map_->capacity; \
+        _map_->capacity = _new_map_->capacity; \
+        _new_map_->capacity = tmp_c; \
+\
+        /* Prevent the map from freeing the data */ \
+        _new_map_->f_key = &(struct CMC_DEF_FKEY(SNAME)){ NULL }; \
+        _new_map_->f_val = &(struct CMC_DEF_FVAL(SNAME)){ NULL }; \
+\
+        CMC_(PFX, _free)(_new_map_); \
+\
+        return true; \
+    } \
+\
+    void CMC_(PFX, _impl_shrink)(struct SNAME * _map_) \
+    { \
+        /* Leave room for the table to grow back before it has to resize again */ \
+        size_t capacity = _map_->count * 2; \
+\
+        if (CMC_(PFX, _impl_calculate_size)(capacity / _map_->load) < _map_->capacity) \
+        { \
+            /* A failed shrink doesn't undo the removal */ \
+            if (CMC_(PFX, _impl_rehash)(_map_, capacity)) \
+                CMC_CALLBACKS_CALL(_map_, resize); \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+    } \
 \
     size_t CMC_(PFX, _impl_calculate_size)(size_t required) \
     { \
@@ -118,6 +118,9 @@
 \
         /* Load factor in range (0.0, 1.0) */ \
         double load; \
+\
+        /* Entries from an older epoch are empty; bumped by _clear() */ \
+        uint16_t epoch; \
 \
         /* Flags indicating errors or success */ \
         int flag; \
@@ -146,6 +149,9 @@
 \
         /* The sate of this node (DELETED, EMPTY, FILLED) */ \
         enum cmc_entry_state state; \
+\
+        /* The epoch in which the state was last written */ \
+        uint16_t epoch; \
     };
 
 /* -------------------------------------------------------------------------
@@ -263,6 +269,7 @@
         _set_->cardinality = 0; \
         _set_->capacity = real_capacity; \
         _set_->load = load; \
+        _set_->epoch = 0; \
         _set_->flag = CMC_FLAG_OK; \
         _set_->f_val = f_val; \
         _set_->alloc = alloc; \
@@ -279,14 +286,22 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *entry = &(_set_->buffer[i]); \
 \
-                if (entry->state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(*entry, _set_->epoch) == CMC_ES_FILLED) \
                 { \
                     _set_->f_val->free(entry->value); \
                 } \
             } \
         } \
 \
-        memset(_set_->buffer, 0, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _set_->capacity); \
+        /* Instead of wiping the buffer, every entry is made stale at once by */ \
+        /* moving to the next epoch. The buffer is only wiped on wraparound */ \
+        if (_set_->epoch == UINT16_MAX) \
+        { \
+            memset(_set_->buffer, 0, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _set_->capacity); \
+            _set_->epoch = 0; \
+        } \
+        else \
+            _set_->epoch++; \
 \
         _set_->count = 0; \
         _set_->flag = CMC_FLAG_OK; \
@@ -300,7 +315,7 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *entry = &(_set_->buffer[i]); \
 \
-                if (entry->state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(*entry, _set_->epoch) == CMC_ES_FILLED) \
                 { \
                     _set_->f_val->free(entry->value); \
                 } \
@@ -506,7 +521,7 @@
 \
         for (size_t i = 0; i < _set_->capacity; i++) \
         { \
-            if (_set_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_set_->buffer[i], _set_->epoch) == CMC_ES_FILLED) \
             { \
                 if (first) \
                 { \
@@ -543,7 +558,7 @@
 \
         for (size_t i = 0; i < _set_->capacity; i++) \
         { \
-            if (_set_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_set_->buffer[i], _set_->epoch) == CMC_ES_FILLED) \
             { \
                 if (first) \
                 { \
@@ -665,7 +680,7 @@
 \
         for (size_t i = 0; i < _set_->capacity; i++) \
         { \
-            if (_set_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_set_->buffer[i], _set_->epoch) == CMC_ES_FILLED) \
             { \
                 V value = _set_->buffer[i].value; \
                 size_t multiplicity = _set_->buffer[i].multiplicity; \
@@ -693,6 +708,10 @@
         size_t tmp_c = _set_->capacity; \
         _set_->capacity = _new_set_->capacity; \
         _new_set_->capacity = tmp_c; \
+\
+        uint16_t tmp_e = _set_->epoch; \
+        _set_->epoch = _new_set_->epoch; \
+        _new_set_->epoch = tmp_e; \
 \
         /* Prevent the set from freeing the data */ \
         _new_set_->f_val = &(struct CMC_DEF_FVAL(SNAME)){ NULL }; \
@@ -725,15 +744,17 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *scan = &(_set_->buffer[i]); \
 \
-                if (scan->state != CMC_ES_EMPTY) \
+                if (CMC_ENTRY_STATE(*scan, _set_->epoch) != CMC_ES_EMPTY) \
                 { \
                     struct CMC_DEF_ENTRY(SNAME) *target = &(result->buffer[i]); \
 \
-                    if (scan->state == CMC_ES_DELETED) \
+                    target->epoch = result->epoch; \
+\
+                    if (CMC_ENTRY_STATE(*scan, _set_->epoch) == CMC_ES_DELETED) \
                         target->state = CMC_ES_DELETED; \
                     else \
                     { \
-                        target->state = scan->state; \
+                        target->state = CMC_ES_FILLED; \
                         target->dist = scan->dist; \
                         target->multiplicity = scan->multiplicity; \
 \
@@ -743,7 +764,10 @@
             } \
         } \
         else \
+        { \
             memcpy(result->buffer, _set_->buffer, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _set_->capacity); \
+            result->epoch = _set_->epoch; \
+        } \
 \
         result->count = _set_->count; \
         result->cardinality = _set_->cardinality; \
@@ -776,7 +800,7 @@
 \
         for (size_t i = 0; i < _set_a_->capacity; i++) \
         { \
-            if (_set_a_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_set_a_->buffer[i], _set_a_->epoch) == CMC_ES_FILLED) \
             { \
                 struct CMC_DEF_ENTRY(SNAME) *entry_a = &(_set_a_->buffer[i]); \
                 struct CMC_DEF_ENTRY(SNAME) *entry_b = CMC_(PFX, _impl_get_entry)(_set_b_, entry_a->value); \
@@ -835,12 +859,13 @@
         struct CMC_DEF_ENTRY(SNAME) *target = &(_set_->buffer[pos]); \
         struct CMC_DEF_ENTRY(SNAME) *to_return = NULL; \
 \
-        if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED) \
+        if (CMC_ENTRY_STATE(*target, _set_->epoch) != CMC_ES_FILLED) \
         { \
             target->value = value; \
             target->multiplicity = curr_mul; \
             target->dist = pos - original_pos; \
             target->state = CMC_ES_FILLED; \
+            target->epoch = _set_->epoch; \
 \
             to_return = target; \
         } \
@@ -851,12 +876,13 @@
                 pos++; \
                 target = &(_set_->buffer[pos % _set_->capacity]); \
 \
-                if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED) \
+                if (CMC_ENTRY_STATE(*target, _set_->epoch) != CMC_ES_FILLED) \
                 { \
                     target->value = value; \
                     target->multiplicity = curr_mul; \
                     target->dist = pos - original_pos; \
                     target->state = CMC_ES_FILLED; \
+                    target->epoch = _set_->epoch; \
 \
                     if (!to_return) \
                         to_return = target; \
@@ -896,7 +922,7 @@
 \
         struct CMC_DEF_ENTRY(SNAME) *target = &(_set_->buffer[pos]); \
 \
-        while (target->state == CMC_ES_FILLED || target->state == CMC_ES_DELETED) \
+        while (CMC_ENTRY_STATE(*target, _set_->epoch) != CMC_ES_EMPTY) \
         { \
             if (_set_->f_val->cmp(target->value, value) == 0) \
                 return target; \
@@ -107,6 +107,12 @@
 \
         /* Load factor in range (0.0, 1.0) */ \
         double load; \
+\
+        /* Load factor below which the table shrinks on removal (0 disables it) */ \
+        double shrink; \
+\
+        /* Entries from an older epoch are empty; bumped by _clear() */ \
+        uint16_t epoch; \
 \
         /* Flags indicating errors or success */ \
         int flag; \
@@ -132,6 +138,9 @@
 \
         /* The sate of this node (DELETED, EMPTY, FILLED) */ \
         enum cmc_entry_state state; \
+\
+        /* The epoch in which the state was last written */ \
+        uint16_t epoch; \
     };
 
 /* -------------------------------------------------------------------------
@@ -187,6 +196,8 @@
     int CMC_(PFX, _flag)(struct SNAME * _set_); \
     /* Collection Utility */ \
     bool CMC_(PFX, _resize)(struct SNAME * _set_, size_t capacity); \
+    bool CMC_(PFX, _shrink_to_fit)(struct SNAME * _set_); \
+    bool CMC_(PFX, _set_shrink)(struct SNAME * _set_, double shrink); \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _set_); \
     bool CMC_(PFX, _equals)(struct SNAME * _set1_, struct SNAME * _set2_);
 
@@ -197,6 +208,8 @@
 \
     /* Implementation Detail Functions */ \
     static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_entry)(struct SNAME * _set_, V value); \
+    static bool CMC_(PFX, _impl_rehash)(struct SNAME * _set_, size_t capacity); \
+    static void CMC_(PFX, _impl_shrink)(struct SNAME * _set_); \
     static size_t CMC_(PFX, _impl_calculate_size)(size_t required); \
 \
     struct SNAME *CMC_(PFX, _new)(size_t capacity, double load, struct CMC_DEF_FVAL(SNAME) * f_val) \
@@ -240,6 +253,8 @@
         _set_->count = 0; \
         _set_->capacity = real_capacity; \
         _set_->load = load; \
+        _set_->shrink = 0; \
+        _set_->epoch = 0; \
         _set_->flag = CMC_FLAG_OK; \
         _set_->f_val = f_val; \
         _set_->alloc = alloc; \
@@ -256,14 +271,22 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *entry = &(_set_->buffer[i]); \
 \
-                if (entry->state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(*entry, _set_->epoch) == CMC_ES_FILLED) \
                 { \
                     _set_->f_val->free(entry->value); \
                 } \
             } \
         } \
 \
-        memset(_set_->buffer, 0, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _set_->capacity); \
+        /* Instead of wiping the buffer, every entry is made stale at once by */ \
+        /* moving to the next epoch. The buffer is only wiped on wraparound */ \
+        if (_set_->epoch == UINT16_MAX) \
+        { \
+            memset(_set_->buffer, 0, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _set_->capacity); \
+            _set_->epoch = 0; \
+        } \
+        else \
+            _set_->epoch++; \
 \
         _set_->count = 0; \
         _set_->flag = CMC_FLAG_OK; \
@@ -277,7 +300,7 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *entry = &(_set_->buffer[i]); \
 \
-                if (entry->state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(*entry, _set_->epoch) == CMC_ES_FILLED) \
                 { \
                     _set_->f_val->free(entry->value); \
                 } \
@@ -323,11 +346,12 @@
 \
         struct CMC_DEF_ENTRY(SNAME) *target = &(_set_->buffer[pos]); \
 \
-        if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED) \
+        if (CMC_ENTRY_STATE(*target, _set_->epoch) != CMC_ES_FILLED) \
         { \
             target->value = value; \
             target->dist = 0; \
             target->state = CMC_ES_FILLED; \
+            target->epoch = _set_->epoch; \
         } \
         else \
         { \
@@ -336,11 +360,12 @@
                 pos++; \
                 target = &(_set_->buffer[pos % _set_->capacity]); \
 \
-                if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED) \
+                if (CMC_ENTRY_STATE(*target, _set_->epoch) != CMC_ES_FILLED) \
                 { \
                     target->value = value; \
                     target->dist = pos - original_pos; \
                     target->state = CMC_ES_FILLED; \
+                    target->epoch = _set_->epoch; \
 \
                     break; \
                 } \
@@ -390,6 +415,9 @@
         _set_->flag = CMC_FLAG_OK; \
 \
         CMC_CALLBACKS_CALL(_set_, delete); \
+\
+        if ((double)_set_->count < (double)_set_->capacity * _set_->shrink) \
+            CMC_(PFX, _impl_shrink)(_set_); \
 \
         return true; \
     } \
@@ -407,7 +435,7 @@
 \
         for (size_t i = 0; i < _set_->capacity; i++) \
         { \
-            if (_set_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_set_->buffer[i], _set_->epoch) == CMC_ES_FILLED) \
             { \
                 if (first) \
                 { \
@@ -444,7 +472,7 @@
 \
         for (size_t i = 0; i < _set_->capacity; i++) \
         { \
-            if (_set_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_set_->buffer[i], _set_->epoch) == CMC_ES_FILLED) \
             { \
                 if (first) \
                 { \
@@ -536,51 +564,42 @@
             return false; \
         } \
 \
-        /* No callbacks since _new_set_ is just a temporary hashtable */ \
-        struct SNAME *_new_set_ = CMC_(PFX, _new_custom)(capacity, _set_->load, _set_->f_val, _set_->alloc, NULL); \
-\
-        if (!_new_set_) \
-        { \
-            _set_->flag = CMC_FLAG_ALLOC; \
+        if (!CMC_(PFX, _impl_rehash)(_set_, capacity)) \
             return false; \
-        } \
 \
-        for (size_t i = 0; i < _set_->capacity; i++) \
-        { \
-            if (_set_->buffer[i].state == CMC_ES_FILLED) \
-            { \
-                V value = _set_->buffer[i].value; \
+    success: \
 \
-                /* TODO check this for possible errors */ \
-                CMC_(PFX, _insert)(_new_set_, value); \
-            } \
-        } \
+        CMC_CALLBACKS_CALL(_set_, resize); \
 \
-        /* Unlikely */ \
-        if (_set_->count != _new_set_->count) \
-        { \
-            CMC_(PFX, _free)(_new_set_); \
+        return true; \
+    } \
 \
-            _set_->flag = CMC_FLAG_ERROR; \
-            return false; \
-        } \
+    bool CMC_(PFX, _shrink_to_fit)(struct SNAME * _set_) \
+    { \
+        _set_->flag = CMC_FLAG_OK; \
 \
-        struct CMC_DEF_ENTRY(SNAME) *tmp_b = _set_->buffer; \
-        _set_->buffer = _new_set_->buffer; \
-        _new_set_->buffer = tmp_b; \
+        if (CMC_(PFX, _impl_calculate_size)(_set_->count / _set_->load) >= _set_->capacity) \
+            return true; \
 \
-        size_t tmp_c = _set_->capacity; \
-        _set_->capacity = _new_set_->capacity; \
-        _new_set_->capacity = tmp_c; \
+        if (!CMC_(PFX, _impl_rehash)(_set_, _set_->count)) \
+            return false; \
 \
-        /* Prevent the set from freeing the data */ \
-        _new_set_->f_val = &(struct CMC_DEF_FVAL(SNAME)){ NULL }; \
+        CMC_CALLBACKS_CALL(_set_, resize); \
 \
-        CMC_(PFX, _free)(_new_set_); \
+        return true; \
+    } \
 \
-    success: \
+    bool CMC_(PFX, _set_shrink)(struct SNAME * _set_, double shrink) \
+    { \
+        /* Below half the load factor so a table that was just shrunk doesn't shrink again */ \
+        if (shrink < 0 || shrink >= _set_->load / 2) \
+        { \
+            _set_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
 \
-        CMC_CALLBACKS_CALL(_set_, resize); \
+        _set_->shrink = shrink; \
+        _set_->flag = CMC_FLAG_OK; \
 \
         return true; \
     } \
@@ -604,15 +623,17 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *scan = &(_set_->buffer[i]); \
 \
-                if (scan->state != CMC_ES_EMPTY) \
+                if (CMC_ENTRY_STATE(*scan, _set_->epoch) != CMC_ES_EMPTY) \
                 { \
                     struct CMC_DEF_ENTRY(SNAME) *target = &(result->buffer[i]); \
 \
-                    if (scan->state == CMC_ES_DELETED) \
+                    target->epoch = result->epoch; \
+\
+                    if (CMC_ENTRY_STATE(*scan, _set_->epoch) == CMC_ES_DELETED) \
                         target->state = CMC_ES_DELETED; \
                     else \
                     { \
-                        target->state = scan->state; \
+                        target->state = CMC_ES_FILLED; \
                         target->dist = scan->dist; \
 \
                         target->value = _set_->f_val->cpy(scan->value); \
@@ -621,9 +642,13 @@
             } \
         } \
         else \
+        { \
             memcpy(result->buffer, _set_->buffer, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _set_->capacity); \
+            result->epoch = _set_->epoch; \
+        } \
 \
         result->count = _set_->count; \
+        result->shrink = _set_->shrink; \
 \
         _set_->flag = CMC_FLAG_OK; \
 \
@@ -647,7 +672,7 @@
 \
         for (size_t i = 0; i < _set_a_->capacity; i++) \
         { \
-            if (_set_a_->buffer[i].state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_set_a_->buffer[i], _set_a_->epoch) == CMC_ES_FILLED) \
             { \
 \
                 if (!CMC_(PFX, _impl_get_entry)(_set_b_, _set_a_->buffer[i].value)) \
@@ -665,7 +690,7 @@
 \
         struct CMC_DEF_ENTRY(SNAME) *target = &(_set_->buffer[pos]); \
 \
-        while (target->state == CMC_ES_FILLED || target->state == CMC_ES_DELETED) \
+        while (CMC_ENTRY_STATE(*target, _set_->epoch) != CMC_ES_EMPTY) \
         { \
             if (_set_->f_val->cmp(target->value, value) == 0) \
                 return target; \
@@ -676,6 +701,76 @@
 \
         return NULL; \
     } \
+\
+    static bool CMC_(PFX, _impl_rehash)(struct SNAME * _set_, size_t capacity) \
+    { \
+        /* An empty table still keeps the smallest possible buffer */ \
+        if (capacity == 0) \
+            capacity = 1; \
+\
+        /* No callbacks since _new_set_ is just a temporary hashtable */ \
+        struct SNAME *_new_set_ = CMC_(PFX, _new_custom)(capacity, _set_->load, _set_->f_val, _set_->alloc, NULL); \
+\
+        if (!_new_set_) \
+        { \
+            _set_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        for (size_t i = 0; i < _set_->capacity; i++) \
+        { \
+            if (CMC_ENTRY_STATE(_set_->buffer[i], _set_->epoch) == CMC_ES_FILLED) \
+            { \
+                V value = _set_->buffer[i].value; \
+\
+                /* TODO check this for possible errors */ \
+                CMC_(PFX, _insert)(_new_set_, value); \
+            } \
+        } \
+\
+        /* Unlikely */ \
+        if (_set_->count != _new_set_->count) \
+        { \
+            CMC_(PFX, _free)(_new_set_); \
+\
+            _set_->flag = CMC_FLAG_ERROR; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *tmp_b = _set_->buffer; \
+        _set_->buffer = _new_set_->buffer; \
+        _new_set_->buffer = tmp_b; \
+\
+        size_t tmp_c = _set_->capacity; \
+        _set_->capacity = _new_set_->capacity; \
+        _new_set_->capacity = tmp_c; \
+\
+        uint16_t tmp_e = _set_->epoch; \
+        _set_->epoch = _new_set_->epoch; \
+        _new_set_->epoch = tmp_e; \
+\
+        /* Prevent the set from freeing the data */ \
+        _new_set_->f_val = &(struct CMC_DEF_FVAL(SNAME)){ NULL }; \
+\
+        CMC_(PFX, _free)(_new_set_); \
+\
+        return true; \
+    } \
+\
+    static void CMC_(PFX, _impl_shrink)(struct SNAME * _set_) \
+    { \
+        /* Leave room for the table to grow back before it has to resize again */ \
+        size_t capacity = _set_->count * 2; \
+\
+        if (CMC_(PFX, _impl_calculate_size)(capacity / _set_->load) < _set_->capacity) \
+        { \
+            /* A failed shrink doesn't undo the removal */ \
+            if (CMC_(PFX, _impl_rehash)(_set_, capacity)) \
+                CMC_CALLBACKS_CALL(_set_, resize); \
+        } \
+\
+        _set_->flag = CMC_FLAG_OK; \
+    } \
 \
     static size_t CMC_(PFX, _impl_calculate_size)(size_t required) \
     { \
@@ -156,6 +156,9 @@
 \
         /* Priority function */ \
         CMC_DEF_FTAB_PRI(V); \
+\
+        /* Search function for contiguous elements, can be NULL */ \
+        CMC_DEF_FTAB_FIND(V); \
     }; \
 \
     /* Collection Functions */ \
@@ -350,12 +353,19 @@
 \
         bool result = false; \
 \
-        for (size_t i = 0; i < _heap_->count; i++) \
+        if (_heap_->f_val->find) \
+        { \
+            result = _heap_->f_val->find(_heap_->buffer, _heap_->count, value) < _heap_->count; \
+        } \
+        else \
         { \
-            if (_heap_->f_val->cmp(_heap_->buffer[i], value) == 0) \
+            for (size_t i = 0; i < _heap_->count; i++) \
             { \
-                result = true; \
-                break; \
+                if (_heap_->f_val->cmp(_heap_->buffer[i], value) == 0) \
+                { \
+                    result = true; \
+                    break; \
+                } \
             } \
         } \
 \
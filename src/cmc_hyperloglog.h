@@ -0,0 +1,648 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_hyperloglog.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * HyperLogLog
+ *
+ * A HyperLogLog estimates how many distinct values were added to it using a
+ * fixed and small amount of memory, no matter how many values there are. The
+ * values themselves are not stored, only their hashes are used. With a
+ * precision p the sketch has 2^p registers and the standard error of the
+ * estimate is about 1.04 / sqrt(2^p).
+ *
+ * The low p bits of the hash of a value select a register, which keeps the
+ * greatest amount of trailing zeros plus one seen in the remaining bits. While
+ * few registers are set they are kept in a sorted array of 32-bit entries,
+ * the sparse representation, which is replaced by an array of 2^p bytes, the
+ * dense representation, once it would need more than 2^p / 8 entries, that is
+ * more than half of its size.
+ */
+
+#ifndef CMC_CMC_HYPERLOGLOG_H
+#define CMC_CMC_HYPERLOGLOG_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/* Bounds of the precision of a HyperLogLog */
+#define CMC_HYPERLOGLOG_MIN_PRECISION 4
+#define CMC_HYPERLOGLOG_MAX_PRECISION 16
+
+/* A register of the sparse representation is its index and its rank */
+#define CMC_HYPERLOGLOG_SPARSE(index, rank) (((uint32_t)(index) << 8) | (uint32_t)(rank))
+#define CMC_HYPERLOGLOG_INDEX(entry) ((size_t)((entry) >> 8))
+#define CMC_HYPERLOGLOG_RANK(entry) ((unsigned char)((entry)&0xFF))
+
+/**
+ * Core HyperLogLog implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_HYPERLOGLOG_CORE(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_CMC_HYPERLOGLOG_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_HYPERLOGLOG_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_HYPERLOGLOG_CORE_STRUCT(PARAMS) \
+    CMC_CMC_HYPERLOGLOG_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_HYPERLOGLOG_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_HYPERLOGLOG_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_HYPERLOGLOG_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_CMC_HYPERLOGLOG_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_HYPERLOGLOG_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_HYPERLOGLOG_CORE_STRUCT(PARAMS) \
+    CMC_CMC_HYPERLOGLOG_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_HYPERLOGLOG_CORE_STRUCT(PARAMS) \
+    CMC_CMC_HYPERLOGLOG_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_HYPERLOGLOG_CORE_HEADER(PARAMS) \
+    CMC_CMC_HYPERLOGLOG_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_HYPERLOGLOG_CORE_SOURCE(PARAMS) \
+    CMC_CMC_HYPERLOGLOG_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_HYPERLOGLOG_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* HyperLogLog Structure */ \
+    struct SNAME \
+    { \
+        /* Dense representation or NULL while the sketch is sparse */ \
+        unsigned char *registers; \
+\
+        /* Registers that are set, sorted by index, while the sketch is */ \
+        /* sparse */ \
+        uint32_t *sparse; \
+\
+        /* Amount of registers in the sparse representation */ \
+        size_t sparse_count; \
+\
+        /* Capacity of the sparse representation */ \
+        size_t sparse_capacity; \
+\
+        /* Amount of bits of the hash used to select a register */ \
+        size_t precision; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_HYPERLOGLOG_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t precision, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t precision, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _clear)(struct SNAME * _hll_); \
+    void CMC_(PFX, _free)(struct SNAME * _hll_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _hll_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _add)(struct SNAME * _hll_, V value); \
+    bool CMC_(PFX, _add_many)(struct SNAME * _hll_, V * values, size_t count); \
+    bool CMC_(PFX, _merge)(struct SNAME * _hll1_, struct SNAME * _hll2_); \
+    /* Element Access */ \
+    size_t CMC_(PFX, _estimate)(struct SNAME * _hll_); \
+    /* Collection State */ \
+    bool CMC_(PFX, _sparse)(struct SNAME * _hll_); \
+    size_t CMC_(PFX, _precision)(struct SNAME * _hll_); \
+    int CMC_(PFX, _flag)(struct SNAME * _hll_); \
+    /* Collection Utility */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _hll_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _hll1_, struct SNAME * _hll2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_HYPERLOGLOG_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static bool CMC_(PFX, _impl_set)(struct SNAME * _hll_, size_t index, unsigned char rank); \
+    static unsigned char CMC_(PFX, _impl_get)(struct SNAME * _hll_, size_t index); \
+    static size_t CMC_(PFX, _impl_search)(struct SNAME * _hll_, size_t index); \
+    static bool CMC_(PFX, _impl_to_dense)(struct SNAME * _hll_); \
+    static double CMC_(PFX, _impl_log)(double x); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t precision, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(precision, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t precision, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (precision < CMC_HYPERLOGLOG_MIN_PRECISION || precision > CMC_HYPERLOGLOG_MAX_PRECISION) \
+            return NULL; \
+\
+        if (!f_val || !f_val->hash) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_hll_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_hll_) \
+            return NULL; \
+\
+        /* The sparse representation grows up to 2^p / 8 entries of 4 bytes, */ \
+        /* half the size of the dense one */ \
+        size_t capacity = ((size_t)1 << precision) / 8; \
+\
+        if (capacity > 16) \
+            capacity = 16; \
+\
+        _hll_->sparse = alloc->malloc(sizeof(uint32_t) * capacity); \
+\
+        if (!_hll_->sparse) \
+        { \
+            alloc->free(_hll_); \
+            return NULL; \
+        } \
+\
+        _hll_->registers = NULL; \
+        _hll_->sparse_count = 0; \
+        _hll_->sparse_capacity = capacity; \
+        _hll_->precision = precision; \
+        _hll_->flag = CMC_FLAG_OK; \
+        _hll_->f_val = f_val; \
+        _hll_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_hll_, callbacks); \
+\
+        return _hll_; \
+    } \
+\
+    /* A dense sketch stays dense */ \
+    void CMC_(PFX, _clear)(struct SNAME * _hll_) \
+    { \
+        if (_hll_->registers) \
+            memset(_hll_->registers, 0, (size_t)1 << _hll_->precision); \
+\
+        _hll_->sparse_count = 0; \
+        _hll_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _hll_) \
+    { \
+        _hll_->alloc->free(_hll_->registers); \
+        _hll_->alloc->free(_hll_->sparse); \
+        _hll_->alloc->free(_hll_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _hll_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _hll_->alloc = &cmc_alloc_node_default; \
+        else \
+            _hll_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_hll_, callbacks); \
+\
+        _hll_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _add)(struct SNAME * _hll_, V value) \
+    { \
+        uint64_t hash = (uint64_t)_hll_->f_val->hash(value); \
+\
+        /* Mix the hash since only some of its bits select the register */ \
+        hash = (hash ^ (hash >> 30)) * UINT64_C(0xbf58476d1ce4e5b9); \
+        hash = (hash ^ (hash >> 27)) * UINT64_C(0x94d049bb133111eb); \
+        hash = hash ^ (hash >> 31); \
+\
+        size_t index = (size_t)(hash & (((uint64_t)1 << _hll_->precision) - 1)); \
+        uint64_t rest = hash >> _hll_->precision; \
+\
+        /* Amount of trailing zeros plus one */ \
+        unsigned char rank = 1; \
+\
+        while (rest % 2 == 0 && rank <= 64 - _hll_->precision) \
+        { \
+            rest >>= 1; \
+            rank++; \
+        } \
+\
+        if (!CMC_(PFX, _impl_set)(_hll_, index, rank)) \
+            return false; \
+\
+        _hll_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_hll_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _add_many)(struct SNAME * _hll_, V * values, size_t count) \
+    { \
+        for (size_t i = 0; i < count; i++) \
+        { \
+            if (!CMC_(PFX, _add)(_hll_, values[i])) \
+                return false; \
+        } \
+\
+        _hll_->flag = CMC_FLAG_OK; \
+\
+        return true; \
+    } \
+\
+    /* Adds every value of the second sketch to the first one. Both must */ \
+    /* have the same precision. */ \
+    bool CMC_(PFX, _merge)(struct SNAME * _hll1_, struct SNAME * _hll2_) \
+    { \
+        if (_hll1_->precision != _hll2_->precision) \
+        { \
+            _hll1_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        if (_hll2_->registers) \
+        { \
+            if (!_hll1_->registers && !CMC_(PFX, _impl_to_dense)(_hll1_)) \
+                return false; \
+\
+            unsigned char *registers1 = _hll1_->registers; \
+            unsigned char *registers2 = _hll2_->registers; \
+            size_t count = (size_t)1 << _hll1_->precision; \
+\
+            /* A loop simple enough to be vectorized */ \
+            for (size_t i = 0; i < count; i++) \
+                registers1[i] = registers1[i] < registers2[i] ? registers2[i] : registers1[i]; \
+        } \
+        else \
+        { \
+            for (size_t i = 0; i < _hll2_->sparse_count; i++) \
+            { \
+                uint32_t entry = _hll2_->sparse[i]; \
+\
+                if (!CMC_(PFX, _impl_set)(_hll1_, CMC_HYPERLOGLOG_INDEX(entry), CMC_HYPERLOGLOG_RANK(entry))) \
+                    return false; \
+            } \
+        } \
+\
+        _hll1_->flag = CMC_FLAG_OK; \
+        _hll2_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_hll1_, update); \
+\
+        return true; \
+    } \
+\
+    size_t CMC_(PFX, _estimate)(struct SNAME * _hll_) \
+    { \
+        size_t count = (size_t)1 << _hll_->precision; \
+        size_t zeros = 0; \
+        double sum = 0.0; \
+\
+        if (_hll_->registers) \
+        { \
+            for (size_t i = 0; i < count; i++) \
+            { \
+                if (_hll_->registers[i] == 0) \
+                    zeros++; \
+\
+                sum += 1.0 / (double)((uint64_t)1 << _hll_->registers[i]); \
+            } \
+        } \
+        else \
+        { \
+            zeros = count - _hll_->sparse_count; \
+            sum = (double)zeros; \
+\
+            for (size_t i = 0; i < _hll_->sparse_count; i++) \
+                sum += 1.0 / (double)((uint64_t)1 << CMC_HYPERLOGLOG_RANK(_hll_->sparse[i])); \
+        } \
+\
+        double m = (double)count; \
+        double alpha; \
+\
+        if (count == 16) \
+            alpha = 0.673; \
+        else if (count == 32) \
+            alpha = 0.697; \
+        else if (count == 64) \
+            alpha = 0.709; \
+        else \
+            alpha = 0.7213 / (1.0 + 1.079 / m); \
+\
+        double estimate = alpha * m * m / sum; \
+\
+        /* Linear counting is more precise for small cardinalities */ \
+        if (estimate <= 2.5 * m && zeros > 0) \
+            estimate = m * CMC_(PFX, _impl_log)(m / (double)zeros); \
+\
+        _hll_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_hll_, read); \
+\
+        return (size_t)(estimate + 0.5); \
+    } \
+\
+    bool CMC_(PFX, _sparse)(struct SNAME * _hll_) \
+    { \
+        return _hll_->registers == NULL; \
+    } \
+\
+    size_t CMC_(PFX, _precision)(struct SNAME * _hll_) \
+    { \
+        return _hll_->precision; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _hll_) \
+    { \
+        return _hll_->flag; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _hll_) \
+    { \
+        struct SNAME *result = CMC_(PFX, _new_custom)(_hll_->precision, _hll_->f_val, _hll_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _hll_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _hll_->callbacks); \
+\
+        if (_hll_->registers) \
+        { \
+            if (!CMC_(PFX, _impl_to_dense)(result)) \
+            { \
+                CMC_(PFX, _free)(result); \
+                _hll_->flag = CMC_FLAG_ALLOC; \
+                return NULL; \
+            } \
+\
+            memcpy(result->registers, _hll_->registers, (size_t)1 << _hll_->precision); \
+        } \
+        else \
+        { \
+            for (size_t i = 0; i < _hll_->sparse_count; i++) \
+            { \
+                uint32_t entry = _hll_->sparse[i]; \
+\
+                if (!CMC_(PFX, _impl_set)(result, CMC_HYPERLOGLOG_INDEX(entry), CMC_HYPERLOGLOG_RANK(entry))) \
+                { \
+                    CMC_(PFX, _free)(result); \
+                    _hll_->flag = CMC_FLAG_ALLOC; \
+                    return NULL; \
+                } \
+            } \
+        } \
+\
+        _hll_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    /* Two sketches are equal if they have the same registers, no matter */ \
+    /* their representation */ \
+    bool CMC_(PFX, _equals)(struct SNAME * _hll1_, struct SNAME * _hll2_) \
+    { \
+        _hll1_->flag = CMC_FLAG_OK; \
+        _hll2_->flag = CMC_FLAG_OK; \
+\
+        if (_hll1_->precision != _hll2_->precision) \
+            return false; \
+\
+        size_t count = (size_t)1 << _hll1_->precision; \
+\
+        for (size_t i = 0; i < count; i++) \
+        { \
+            if (CMC_(PFX, _impl_get)(_hll1_, i) != CMC_(PFX, _impl_get)(_hll2_, i)) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    /* Sets a register to the given rank if it is greater */ \
+    static bool CMC_(PFX, _impl_set)(struct SNAME * _hll_, size_t index, unsigned char rank) \
+    { \
+        if (_hll_->registers) \
+        { \
+            if (_hll_->registers[index] < rank) \
+                _hll_->registers[index] = rank; \
+\
+            return true; \
+        } \
+\
+        size_t i = CMC_(PFX, _impl_search)(_hll_, index); \
+\
+        if (i < _hll_->sparse_count && CMC_HYPERLOGLOG_INDEX(_hll_->sparse[i]) == index) \
+        { \
+            if (CMC_HYPERLOGLOG_RANK(_hll_->sparse[i]) < rank) \
+                _hll_->sparse[i] = CMC_HYPERLOGLOG_SPARSE(index, rank); \
+\
+            return true; \
+        } \
+\
+        if (_hll_->sparse_count == _hll_->sparse_capacity) \
+        { \
+            size_t limit = ((size_t)1 << _hll_->precision) / 8; \
+\
+            if (_hll_->sparse_capacity == limit) \
+            { \
+                if (!CMC_(PFX, _impl_to_dense)(_hll_)) \
+                    return false; \
+\
+                _hll_->registers[index] = rank; \
+\
+                return true; \
+            } \
+\
+            size_t capacity = _hll_->sparse_capacity * 2; \
+\
+            if (capacity > limit) \
+                capacity = limit; \
+\
+            uint32_t *new_sparse = _hll_->alloc->realloc(_hll_->sparse, sizeof(uint32_t) * capacity); \
+\
+            if (!new_sparse) \
+            { \
+                _hll_->flag = CMC_FLAG_ALLOC; \
+                return false; \
+            } \
+\
+            _hll_->sparse = new_sparse; \
+            _hll_->sparse_capacity = capacity; \
+        } \
+\
+        memmove(_hll_->sparse + i + 1, _hll_->sparse + i, sizeof(uint32_t) * (_hll_->sparse_count - i)); \
+\
+        _hll_->sparse[i] = CMC_HYPERLOGLOG_SPARSE(index, rank); \
+        _hll_->sparse_count++; \
+\
+        return true; \
+    } \
+\
+    static unsigned char CMC_(PFX, _impl_get)(struct SNAME * _hll_, size_t index) \
+    { \
+        if (_hll_->registers) \
+            return _hll_->registers[index]; \
+\
+        size_t i = CMC_(PFX, _impl_search)(_hll_, index); \
+\
+        if (i < _hll_->sparse_count && CMC_HYPERLOGLOG_INDEX(_hll_->sparse[i]) == index) \
+            return CMC_HYPERLOGLOG_RANK(_hll_->sparse[i]); \
+\
+        return 0; \
+    } \
+\
+    /* Position of the first register of the sparse representation whose */ \
+    /* index is not less than the given one */ \
+    static size_t CMC_(PFX, _impl_search)(struct SNAME * _hll_, size_t index) \
+    { \
+        size_t low = 0; \
+        size_t high = _hll_->sparse_count; \
+\
+        while (low < high) \
+        { \
+            size_t mid = low + (high - low) / 2; \
+\
+            if (CMC_HYPERLOGLOG_INDEX(_hll_->sparse[mid]) < index) \
+                low = mid + 1; \
+            else \
+                high = mid; \
+        } \
+\
+        return low; \
+    } \
+\
+    static bool CMC_(PFX, _impl_to_dense)(struct SNAME * _hll_) \
+    { \
+        unsigned char *registers = _hll_->alloc->calloc((size_t)1 << _hll_->precision, sizeof(unsigned char)); \
+\
+        if (!registers) \
+        { \
+            _hll_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        for (size_t i = 0; i < _hll_->sparse_count; i++) \
+        { \
+            uint32_t entry = _hll_->sparse[i]; \
+\
+            registers[CMC_HYPERLOGLOG_INDEX(entry)] = CMC_HYPERLOGLOG_RANK(entry); \
+        } \
+\
+        _hll_->alloc->free(_hll_->sparse); \
+\
+        _hll_->registers = registers; \
+        _hll_->sparse = NULL; \
+        _hll_->sparse_count = 0; \
+        _hll_->sparse_capacity = 0; \
+\
+        return true; \
+    } \
+\
+    /* Natural logarithm of a number not less than 1, so that math.h and */ \
+    /* its library are not needed */ \
+    static double CMC_(PFX, _impl_log)(double x) \
+    { \
+        double result = 0.0; \
+\
+        while (x >= 2.0) \
+        { \
+            x /= 2.0; \
+            result += 0.69314718055994530942; \
+        } \
+\
+        /* ln(x) = 2 * atanh((x - 1) / (x + 1)) converges quickly for x < 2 */ \
+        double z = (x - 1.0) / (x + 1.0); \
+        double term = z; \
+\
+        for (int i = 1; i < 40; i += 2) \
+        { \
+            result += 2.0 * term / i; \
+            term *= z * z; \
+        } \
+\
+        return result; \
+    }
+
+#endif /* CMC_CMC_HYPERLOGLOG_H */
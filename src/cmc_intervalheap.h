@@ -105,6 +105,10 @@
 \
         /* Current amount of elements in the heap */ \
         size_t count; \
+\
+        /* Maximum amount of elements kept by the offer functions */ \
+        /* A value of 0 means that the heap is unbounded */ \
+        size_t limit; \
 \
         /* Flags indicating errors or success */ \
         int flag; \
@@ -160,6 +164,10 @@
     bool CMC_(PFX, _insert)(struct SNAME * _heap_, V value); \
     bool CMC_(PFX, _remove_max)(struct SNAME * _heap_); \
     bool CMC_(PFX, _remove_min)(struct SNAME * _heap_); \
+    bool CMC_(PFX, _offer_max)(struct SNAME * _heap_, V value); \
+    bool CMC_(PFX, _offer_min)(struct SNAME * _heap_, V value); \
+    size_t CMC_(PFX, _offer_many_max)(struct SNAME * _heap_, V * values, size_t count); \
+    size_t CMC_(PFX, _offer_many_min)(struct SNAME * _heap_, V * values, size_t count); \
     /* Collection Update */ \
     bool CMC_(PFX, _update_max)(struct SNAME * _heap_, V value); \
     bool CMC_(PFX, _update_min)(struct SNAME * _heap_, V value); \
@@ -172,9 +180,11 @@
     bool CMC_(PFX, _full)(struct SNAME * _heap_); \
     size_t CMC_(PFX, _count)(struct SNAME * _heap_); \
     size_t CMC_(PFX, _capacity)(struct SNAME * _heap_); \
+    size_t CMC_(PFX, _limit)(struct SNAME * _heap_); \
     int CMC_(PFX, _flag)(struct SNAME * _heap_); \
     /* Collection Utility */ \
     bool CMC_(PFX, _resize)(struct SNAME * _heap_, size_t capacity); \
+    bool CMC_(PFX, _set_limit)(struct SNAME * _heap_, size_t limit); \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _heap_); \
     bool CMC_(PFX, _equals)(struct SNAME * _heap1_, struct SNAME * _heap2_);
 
@@ -226,6 +236,7 @@
         _heap_->capacity = capacity; \
         _heap_->size = 0; \
         _heap_->count = 0; \
+        _heap_->limit = 0; \
         _heap_->flag = CMC_FLAG_OK; \
         _heap_->f_val = f_val; \
         _heap_->alloc = alloc; \
@@ -440,6 +451,70 @@
 \
         return true; \
     } \
+\
+    bool CMC_(PFX, _offer_max)(struct SNAME * _heap_, V value) \
+    { \
+        if (_heap_->limit == 0 || _heap_->count < _heap_->limit) \
+            return CMC_(PFX, _insert)(_heap_, value); \
+\
+        /* The heap is at its limit so it only keeps the value if it is */ \
+        /* greater than the current Min, which takes its place */ \
+        if (_heap_->f_val->cmp(value, _heap_->buffer[0][0]) <= 0) \
+        { \
+            _heap_->flag = CMC_FLAG_OK; \
+            return false; \
+        } \
+\
+        return CMC_(PFX, _update_min)(_heap_, value); \
+    } \
+\
+    bool CMC_(PFX, _offer_min)(struct SNAME * _heap_, V value) \
+    { \
+        if (_heap_->limit == 0 || _heap_->count < _heap_->limit) \
+            return CMC_(PFX, _insert)(_heap_, value); \
+\
+        /* The heap is at its limit so it only keeps the value if it is */ \
+        /* less than the current Max, which takes its place */ \
+        V max = _heap_->count == 1 ? _heap_->buffer[0][0] : _heap_->buffer[0][1]; \
+\
+        if (_heap_->f_val->cmp(value, max) >= 0) \
+        { \
+            _heap_->flag = CMC_FLAG_OK; \
+            return false; \
+        } \
+\
+        return CMC_(PFX, _update_max)(_heap_, value); \
+    } \
+\
+    size_t CMC_(PFX, _offer_many_max)(struct SNAME * _heap_, V * values, size_t count) \
+    { \
+        size_t kept = 0; \
+\
+        for (size_t i = 0; i < count; i++) \
+        { \
+            if (CMC_(PFX, _offer_max)(_heap_, values[i])) \
+                kept++; \
+            else if (_heap_->flag != CMC_FLAG_OK) \
+                break; \
+        } \
+\
+        return kept; \
+    } \
+\
+    size_t CMC_(PFX, _offer_many_min)(struct SNAME * _heap_, V * values, size_t count) \
+    { \
+        size_t kept = 0; \
+\
+        for (size_t i = 0; i < count; i++) \
+        { \
+            if (CMC_(PFX, _offer_min)(_heap_, values[i])) \
+                kept++; \
+            else if (_heap_->flag != CMC_FLAG_OK) \
+                break; \
+        } \
+\
+        return kept; \
+    } \
 \
     bool CMC_(PFX, _update_max)(struct SNAME * _heap_, V value) \
     { \
@@ -588,6 +663,11 @@
     { \
         return _heap_->capacity; \
     } \
+\
+    size_t CMC_(PFX, _limit)(struct SNAME * _heap_) \
+    { \
+        return _heap_->limit; \
+    } \
 \
     int CMC_(PFX, _flag)(struct SNAME * _heap_) \
     { \
@@ -599,7 +679,8 @@
         if (_heap_->capacity == capacity) \
             goto success; \
 \
-        if (capacity < _heap_->count) \
+        /* Each node holds two elements */ \
+        if (capacity < _heap_->count / 2 + _heap_->count % 2) \
         { \
             _heap_->flag = CMC_FLAG_INVALID; \
             return false; \
@@ -638,6 +719,26 @@
 \
         return true; \
     } \
+\
+    bool CMC_(PFX, _set_limit)(struct SNAME * _heap_, size_t limit) \
+    { \
+        if (limit != 0 && limit < _heap_->count) \
+        { \
+            _heap_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        /* Reserve every node up front so that offering never resizes */ \
+        size_t capacity = limit / 2 + limit % 2; \
+\
+        if (capacity > _heap_->capacity && !CMC_(PFX, _resize)(_heap_, capacity)) \
+            return false; \
+\
+        _heap_->limit = limit; \
+        _heap_->flag = CMC_FLAG_OK; \
+\
+        return true; \
+    } \
 \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _heap_) \
     { \
@@ -671,6 +772,7 @@
         result->capacity = _heap_->capacity; \
         result->size = _heap_->size; \
         result->count = _heap_->count; \
+        result->limit = _heap_->limit; \
         result->flag = CMC_FLAG_OK; \
         result->f_val = _heap_->f_val; \
         result->alloc = _heap_->alloc; \
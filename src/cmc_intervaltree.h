@@ -0,0 +1,895 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_intervaltree.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * IntervalTree
+ *
+ * An IntervalTree maps closed intervals [low, high] to values and finds every
+ * interval that overlaps a given range or contains a given point without going
+ * through all of them. It is an AVL Tree, like the TreeMap, ordered by the low
+ * endpoint and then by the high endpoint of each interval, where every node
+ * also keeps the greatest high endpoint of its subtree. A search skips every
+ * subtree whose greatest high endpoint is before the range, and everything to
+ * the right of an interval that starts after the range. Each interval that
+ * is reported can cost a path of O(log n) nodes, so reporting k intervals
+ * takes O(min(n, (k + 1) log n)).
+ *
+ * The same interval can only be in the tree once, but intervals can overlap
+ * each other or share one of their endpoints. K is the type of the endpoints.
+ */
+
+#ifndef CMC_CMC_INTERVALTREE_H
+#define CMC_CMC_INTERVALTREE_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/**
+ * Core IntervalTree implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_INTERVALTREE_CORE(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_CMC_INTERVALTREE_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_INTERVALTREE_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_INTERVALTREE_CORE_STRUCT(PARAMS) \
+    CMC_CMC_INTERVALTREE_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_INTERVALTREE_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_INTERVALTREE_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_INTERVALTREE_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    struct CMC_DEF_NODE(CMC_PARAM_SNAME(PARAMS)); \
+    CMC_CMC_INTERVALTREE_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_INTERVALTREE_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_INTERVALTREE_CORE_STRUCT(PARAMS) \
+    CMC_CMC_INTERVALTREE_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_INTERVALTREE_CORE_STRUCT(PARAMS) \
+    CMC_CMC_INTERVALTREE_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_INTERVALTREE_CORE_HEADER(PARAMS) \
+    CMC_CMC_INTERVALTREE_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_INTERVALTREE_CORE_SOURCE(PARAMS) \
+    CMC_CMC_INTERVALTREE_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_INTERVALTREE_CORE_STRUCT_(PFX, SNAME, K, V) \
+\
+    /* IntervalTree Structure */ \
+    struct SNAME \
+    { \
+        /* Root node */ \
+        struct CMC_DEF_NODE(SNAME) * root; \
+\
+        /* Current amount of intervals */ \
+        size_t count; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Endpoint function table */ \
+        struct CMC_DEF_FKEY(SNAME) * f_key; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    }; \
+\
+    /* IntervalTree Node */ \
+    struct CMC_DEF_NODE(SNAME) \
+    { \
+        /* Start of the interval */ \
+        K low; \
+\
+        /* End of the interval */ \
+        K high; \
+\
+        /* Greatest high endpoint in this subtree */ \
+        K max; \
+\
+        /* Node Value */ \
+        V value; \
+\
+        /* Node height used by the AVL tree to keep it strictly balanced */ \
+        unsigned char height; \
+\
+        /* Right child node or subtree */ \
+        struct CMC_DEF_NODE(SNAME) * right; \
+\
+        /* Left child node or subtree */ \
+        struct CMC_DEF_NODE(SNAME) * left; \
+\
+        /* Parent node */ \
+        struct CMC_DEF_NODE(SNAME) * parent; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_INTERVALTREE_CORE_HEADER_(PFX, SNAME, K, V) \
+\
+    /* Key struct function table */ \
+    struct CMC_DEF_FKEY(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(K); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(K); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(K); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(K); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(K); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(K); \
+    }; \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _clear)(struct SNAME * _tree_); \
+    void CMC_(PFX, _free)(struct SNAME * _tree_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _tree_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _insert)(struct SNAME * _tree_, K low, K high, V value); \
+    bool CMC_(PFX, _update)(struct SNAME * _tree_, K low, K high, V new_value, V * old_value); \
+    bool CMC_(PFX, _remove)(struct SNAME * _tree_, K low, K high, V * out_value); \
+    /* Element Access */ \
+    V CMC_(PFX, _get)(struct SNAME * _tree_, K low, K high); \
+    V *CMC_(PFX, _get_ref)(struct SNAME * _tree_, K low, K high); \
+    size_t CMC_(PFX, _overlaps)(struct SNAME * _tree_, K low, K high, void (*match)(K, K, V)); \
+    size_t CMC_(PFX, _stab)(struct SNAME * _tree_, K point, void (*match)(K, K, V)); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _tree_, K low, K high); \
+    bool CMC_(PFX, _empty)(struct SNAME * _tree_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _tree_); \
+    int CMC_(PFX, _flag)(struct SNAME * _tree_); \
+    /* Collection Utility */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _tree_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _tree1_, struct SNAME * _tree2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_INTERVALTREE_CORE_SOURCE_(PFX, SNAME, K, V) \
+\
+    /* Implementation Detail Functions */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_new_node)(struct SNAME * _tree_, K low, K high, V value); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_get_node)(struct SNAME * _tree_, K low, K high); \
+    static int CMC_(PFX, _impl_cmp)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * node, K low, K high); \
+    static size_t CMC_(PFX, _impl_search)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * node, K low, K high, \
+                                          void (*match)(K, K, V)); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_first)(struct CMC_DEF_NODE(SNAME) * node); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_next)(struct CMC_DEF_NODE(SNAME) * node); \
+    static unsigned char CMC_(PFX, _impl_h)(struct CMC_DEF_NODE(SNAME) * node); \
+    static unsigned char CMC_(PFX, _impl_hupdate)(struct CMC_DEF_NODE(SNAME) * node); \
+    static void CMC_(PFX, _impl_mupdate)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * node); \
+    static void CMC_(PFX, _impl_rotate_right)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * *Z); \
+    static void CMC_(PFX, _impl_rotate_left)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * *Z); \
+    static void CMC_(PFX, _impl_rebalance)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * node); \
+\
+    struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(f_key, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!f_key || !f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_tree_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_tree_) \
+            return NULL; \
+\
+        _tree_->count = 0; \
+        _tree_->root = NULL; \
+        _tree_->flag = CMC_FLAG_OK; \
+        _tree_->f_key = f_key; \
+        _tree_->f_val = f_val; \
+        _tree_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_tree_, callbacks); \
+\
+        return _tree_; \
+    } \
+\
+    void CMC_(PFX, _clear)(struct SNAME * _tree_) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *scan = _tree_->root; \
+\
+        /* Frees every node after both of its subtrees, walking up through */ \
+        /* the parent pointers */ \
+        while (scan != NULL) \
+        { \
+            if (scan->left != NULL) \
+                scan = scan->left; \
+            else if (scan->right != NULL) \
+                scan = scan->right; \
+            else \
+            { \
+                struct CMC_DEF_NODE(SNAME) *parent = scan->parent; \
+\
+                if (parent != NULL) \
+                { \
+                    if (parent->left == scan) \
+                        parent->left = NULL; \
+                    else \
+                        parent->right = NULL; \
+                } \
+\
+                if (_tree_->f_key->free) \
+                { \
+                    _tree_->f_key->free(scan->low); \
+                    _tree_->f_key->free(scan->high); \
+                } \
+                if (_tree_->f_val->free) \
+                    _tree_->f_val->free(scan->value); \
+\
+                _tree_->alloc->free(scan); \
+\
+                scan = parent; \
+            } \
+        } \
+\
+        _tree_->count = 0; \
+        _tree_->root = NULL; \
+        _tree_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _tree_) \
+    { \
+        CMC_(PFX, _clear)(_tree_); \
+\
+        _tree_->alloc->free(_tree_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _tree_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _tree_->alloc = &cmc_alloc_node_default; \
+        else \
+            _tree_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_tree_, callbacks); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _insert)(struct SNAME * _tree_, K low, K high, V value) \
+    { \
+        if (_tree_->f_key->cmp(low, high) > 0) \
+        { \
+            _tree_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *scan = _tree_->root; \
+        struct CMC_DEF_NODE(SNAME) *parent = NULL; \
+        int cmp = 0; \
+\
+        while (scan != NULL) \
+        { \
+            parent = scan; \
+            cmp = CMC_(PFX, _impl_cmp)(_tree_, scan, low, high); \
+\
+            if (cmp > 0) \
+                scan = scan->left; \
+            else if (cmp < 0) \
+                scan = scan->right; \
+            else \
+            { \
+                _tree_->flag = CMC_FLAG_DUPLICATE; \
+                return false; \
+            } \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_new_node)(_tree_, low, high, value); \
+\
+        if (!node) \
+        { \
+            _tree_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        node->parent = parent; \
+\
+        if (parent == NULL) \
+            _tree_->root = node; \
+        else if (cmp > 0) \
+            parent->left = node; \
+        else \
+            parent->right = node; \
+\
+        /* Also updates the greatest high endpoint of every ancestor */ \
+        CMC_(PFX, _impl_rebalance)(_tree_, parent); \
+\
+        _tree_->count++; \
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _update)(struct SNAME * _tree_, K low, K high, V new_value, V * old_value) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_get_node)(_tree_, low, high); \
+\
+        if (!node) \
+        { \
+            _tree_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (old_value) \
+            *old_value = node->value; \
+\
+        node->value = new_value; \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, update); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _remove)(struct SNAME * _tree_, K low, K high, V * out_value) \
+    { \
+        if (CMC_(PFX, _empty)(_tree_)) \
+        { \
+            _tree_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_get_node)(_tree_, low, high); \
+\
+        if (!node) \
+        { \
+            _tree_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (out_value) \
+            *out_value = node->value; \
+\
+        /* A node with two children takes the interval of its successor, */ \
+        /* which is removed instead */ \
+        if (node->left != NULL && node->right != NULL) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *successor = CMC_(PFX, _impl_first)(node->right); \
+\
+            node->low = successor->low; \
+            node->high = successor->high; \
+            node->value = successor->value; \
+\
+            node = successor; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *child = node->left != NULL ? node->left : node->right; \
+        struct CMC_DEF_NODE(SNAME) *parent = node->parent; \
+\
+        if (child != NULL) \
+            child->parent = parent; \
+\
+        if (parent == NULL) \
+            _tree_->root = child; \
+        else if (parent->left == node) \
+            parent->left = child; \
+        else \
+            parent->right = child; \
+\
+        _tree_->alloc->free(node); \
+\
+        CMC_(PFX, _impl_rebalance)(_tree_, parent); \
+\
+        _tree_->count--; \
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, delete); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _tree_, K low, K high) \
+    { \
+        if (CMC_(PFX, _empty)(_tree_)) \
+        { \
+            _tree_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_get_node)(_tree_, low, high); \
+\
+        if (!node) \
+        { \
+            _tree_->flag = CMC_FLAG_NOT_FOUND; \
+            return (V){ 0 }; \
+        } \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, read); \
+\
+        return node->value; \
+    } \
+\
+    V *CMC_(PFX, _get_ref)(struct SNAME * _tree_, K low, K high) \
+    { \
+        if (CMC_(PFX, _empty)(_tree_)) \
+        { \
+            _tree_->flag = CMC_FLAG_EMPTY; \
+            return NULL; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_get_node)(_tree_, low, high); \
+\
+        if (!node) \
+        { \
+            _tree_->flag = CMC_FLAG_NOT_FOUND; \
+            return NULL; \
+        } \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, read); \
+\
+        return &(node->value); \
+    } \
+\
+    /* Calls match, which is optional, for every interval that overlaps */ \
+    /* [low, high] in order and returns how many there are */ \
+    size_t CMC_(PFX, _overlaps)(struct SNAME * _tree_, K low, K high, void (*match)(K, K, V)) \
+    { \
+        if (_tree_->f_key->cmp(low, high) > 0) \
+        { \
+            _tree_->flag = CMC_FLAG_INVALID; \
+            return 0; \
+        } \
+\
+        size_t result = CMC_(PFX, _impl_search)(_tree_, _tree_->root, low, high, match); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, read); \
+\
+        return result; \
+    } \
+\
+    /* Calls match, which is optional, for every interval that contains */ \
+    /* point in order and returns how many there are */ \
+    size_t CMC_(PFX, _stab)(struct SNAME * _tree_, K point, void (*match)(K, K, V)) \
+    { \
+        return CMC_(PFX, _overlaps)(_tree_, point, point, match); \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _tree_, K low, K high) \
+    { \
+        bool result = CMC_(PFX, _impl_get_node)(_tree_, low, high) != NULL; \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _tree_) \
+    { \
+        return _tree_->count == 0; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _tree_) \
+    { \
+        return _tree_->count; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _tree_) \
+    { \
+        return _tree_->flag; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _tree_) \
+    { \
+        /* Callback will be added later */ \
+        struct SNAME *result = CMC_(PFX, _new_custom)(_tree_->f_key, _tree_->f_val, _tree_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _tree_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *scan = CMC_(PFX, _impl_first)(_tree_->root); \
+\
+        for (; scan != NULL; scan = CMC_(PFX, _impl_next)(scan)) \
+        { \
+            K low = scan->low; \
+            K high = scan->high; \
+            V value = scan->value; \
+\
+            if (_tree_->f_key->cpy) \
+            { \
+                low = _tree_->f_key->cpy(scan->low); \
+                high = _tree_->f_key->cpy(scan->high); \
+            } \
+            if (_tree_->f_val->cpy) \
+                value = _tree_->f_val->cpy(scan->value); \
+\
+            if (!CMC_(PFX, _insert)(result, low, high, value)) \
+            { \
+                CMC_(PFX, _free)(result); \
+                _tree_->flag = CMC_FLAG_ALLOC; \
+                return NULL; \
+            } \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _tree_->callbacks); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _tree1_, struct SNAME * _tree2_) \
+    { \
+        _tree1_->flag = CMC_FLAG_OK; \
+        _tree2_->flag = CMC_FLAG_OK; \
+\
+        if (_tree1_->count != _tree2_->count) \
+            return false; \
+\
+        /* Both trees are walked in order at the same time */ \
+        struct CMC_DEF_NODE(SNAME) *scan1 = CMC_(PFX, _impl_first)(_tree1_->root); \
+        struct CMC_DEF_NODE(SNAME) *scan2 = CMC_(PFX, _impl_first)(_tree2_->root); \
+\
+        while (scan1 != NULL && scan2 != NULL) \
+        { \
+            if (CMC_(PFX, _impl_cmp)(_tree1_, scan1, scan2->low, scan2->high) != 0) \
+                return false; \
+\
+            if (_tree1_->f_val->cmp(scan1->value, scan2->value) != 0) \
+                return false; \
+\
+            scan1 = CMC_(PFX, _impl_next)(scan1); \
+            scan2 = CMC_(PFX, _impl_next)(scan2); \
+        } \
+\
+        return true; \
+    } \
+\
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_new_node)(struct SNAME * _tree_, K low, K high, V value) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *node = _tree_->alloc->malloc(sizeof(struct CMC_DEF_NODE(SNAME))); \
+\
+        if (!node) \
+            return NULL; \
+\
+        node->low = low; \
+        node->high = high; \
+        node->max = high; \
+        node->value = value; \
+        node->right = NULL; \
+        node->left = NULL; \
+        node->parent = NULL; \
+        node->height = 1; \
+\
+        return node; \
+    } \
+\
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_get_node)(struct SNAME * _tree_, K low, K high) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *scan = _tree_->root; \
+\
+        while (scan != NULL) \
+        { \
+            int cmp = CMC_(PFX, _impl_cmp)(_tree_, scan, low, high); \
+\
+            if (cmp > 0) \
+                scan = scan->left; \
+            else if (cmp < 0) \
+                scan = scan->right; \
+            else \
+                return scan; \
+        } \
+\
+        return NULL; \
+    } \
+\
+    /* Intervals are ordered by their low endpoint, then their high endpoint */ \
+    static int CMC_(PFX, _impl_cmp)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * node, K low, K high) \
+    { \
+        int cmp = _tree_->f_key->cmp(node->low, low); \
+\
+        if (cmp != 0) \
+            return cmp; \
+\
+        return _tree_->f_key->cmp(node->high, high); \
+    } \
+\
+    static size_t CMC_(PFX, _impl_search)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * node, K low, K high, \
+                                          void (*match)(K, K, V)) \
+    { \
+        size_t result = 0; \
+\
+        /* The left subtree is only skipped with the node's own max, so */ \
+        /* the recursion is only as deep as the tree */ \
+        while (node != NULL && _tree_->f_key->cmp(node->max, low) >= 0) \
+        { \
+            result += CMC_(PFX, _impl_search)(_tree_, node->left, low, high, match); \
+\
+            /* Every interval from here on starts after the range */ \
+            if (_tree_->f_key->cmp(node->low, high) > 0) \
+                break; \
+\
+            if (_tree_->f_key->cmp(node->high, low) >= 0) \
+            { \
+                if (match) \
+                    match(node->low, node->high, node->value); \
+\
+                result++; \
+            } \
+\
+            node = node->right; \
+        } \
+\
+        return result; \
+    } \
+\
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_first)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (node == NULL) \
+            return NULL; \
+\
+        while (node->left != NULL) \
+            node = node->left; \
+\
+        return node; \
+    } \
+\
+    /* In-order successor */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_next)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (node->right != NULL) \
+            return CMC_(PFX, _impl_first)(node->right); \
+\
+        while (node->parent != NULL && node->parent->right == node) \
+            node = node->parent; \
+\
+        return node->parent; \
+    } \
+\
+    static unsigned char CMC_(PFX, _impl_h)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (node == NULL) \
+            return 0; \
+\
+        return node->height; \
+    } \
+\
+    static unsigned char CMC_(PFX, _impl_hupdate)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (node == NULL) \
+            return 0; \
+\
+        unsigned char h_l = CMC_(PFX, _impl_h)(node->left); \
+        unsigned char h_r = CMC_(PFX, _impl_h)(node->right); \
+\
+        return 1 + (h_l > h_r ? h_l : h_r); \
+    } \
+\
+    /* Recomputes the greatest high endpoint from the node's children */ \
+    static void CMC_(PFX, _impl_mupdate)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        node->max = node->high; \
+\
+        if (node->left != NULL && _tree_->f_key->cmp(node->left->max, node->max) > 0) \
+            node->max = node->left->max; \
+        if (node->right != NULL && _tree_->f_key->cmp(node->right->max, node->max) > 0) \
+            node->max = node->right->max; \
+    } \
+\
+    static void CMC_(PFX, _impl_rotate_right)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * *Z) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *root = *Z; \
+        struct CMC_DEF_NODE(SNAME) *new_root = root->left; \
+\
+        if (root->parent != NULL) \
+        { \
+            if (root->parent->left == root) \
+                root->parent->left = new_root; \
+            else \
+                root->parent->right = new_root; \
+        } \
+\
+        new_root->parent = root->parent; \
+\
+        root->parent = new_root; \
+        root->left = new_root->right; \
+\
+        if (root->left) \
+            root->left->parent = root; \
+\
+        new_root->right = root; \
+\
+        root->height = CMC_(PFX, _impl_hupdate)(root); \
+        new_root->height = CMC_(PFX, _impl_hupdate)(new_root); \
+\
+        CMC_(PFX, _impl_mupdate)(_tree_, root); \
+        CMC_(PFX, _impl_mupdate)(_tree_, new_root); \
+\
+        *Z = new_root; \
+    } \
+\
+    static void CMC_(PFX, _impl_rotate_left)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * *Z) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *root = *Z; \
+        struct CMC_DEF_NODE(SNAME) *new_root = root->right; \
+\
+        if (root->parent != NULL) \
+        { \
+            if (root->parent->right == root) \
+                root->parent->right = new_root; \
+            else \
+                root->parent->left = new_root; \
+        } \
+\
+        new_root->parent = root->parent; \
+\
+        root->parent = new_root; \
+        root->right = new_root->left; \
+\
+        if (root->right) \
+            root->right->parent = root; \
+\
+        new_root->left = root; \
+\
+        root->height = CMC_(PFX, _impl_hupdate)(root); \
+        new_root->height = CMC_(PFX, _impl_hupdate)(new_root); \
+\
+        CMC_(PFX, _impl_mupdate)(_tree_, root); \
+        CMC_(PFX, _impl_mupdate)(_tree_, new_root); \
+\
+        *Z = new_root; \
+    } \
+\
+    /* Goes up to the root updating heights and greatest high endpoints */ \
+    static void CMC_(PFX, _impl_rebalance)(struct SNAME * _tree_, struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *scan = node, *child = NULL; \
+\
+        int balance; \
+        bool is_root = false; \
+\
+        while (scan != NULL) \
+        { \
+            if (scan->parent == NULL) \
+                is_root = true; \
+\
+            scan->height = CMC_(PFX, _impl_hupdate)(scan); \
+            CMC_(PFX, _impl_mupdate)(_tree_, scan); \
+            balance = CMC_(PFX, _impl_h)(scan->right) - CMC_(PFX, _impl_h)(scan->left); \
+\
+            if (balance >= 2) \
+            { \
+                child = scan->right; \
+\
+                if (CMC_(PFX, _impl_h)(child->right) < CMC_(PFX, _impl_h)(child->left)) \
+                    CMC_(PFX, _impl_rotate_right)(_tree_, &(scan->right)); \
+\
+                CMC_(PFX, _impl_rotate_left)(_tree_, &scan); \
+            } \
+            else if (balance <= -2) \
+            { \
+                child = scan->left; \
+\
+                if (CMC_(PFX, _impl_h)(child->left) < CMC_(PFX, _impl_h)(child->right)) \
+                    CMC_(PFX, _impl_rotate_left)(_tree_, &(scan->left)); \
+\
+                CMC_(PFX, _impl_rotate_right)(_tree_, &scan); \
+            } \
+\
+            if (is_root) \
+            { \
+                _tree_->root = scan; \
+                is_root = false; \
+            } \
+\
+            scan = scan->parent; \
+        } \
+    }
+
+#endif /* CMC_CMC_INTERVALTREE_H */
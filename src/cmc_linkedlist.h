@@ -189,6 +189,8 @@
     bool CMC_(PFX, _empty)(struct SNAME * _list_); \
     size_t CMC_(PFX, _count)(struct SNAME * _list_); \
     int CMC_(PFX, _flag)(struct SNAME * _list_); \
+    /* Collection Sorting */ \
+    void CMC_(PFX, _sort)(struct SNAME * _list_); \
     /* Collection Utility */ \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _list_); \
     bool CMC_(PFX, _equals)(struct SNAME * _list1_, struct SNAME * _list2_);
@@ -579,6 +581,84 @@
     { \
         return _list_->flag; \
     } \
+\
+    void CMC_(PFX, _sort)(struct SNAME * _list_) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *head = _list_->head; \
+\
+        /* Bottom-up merge sort that merges runs of width nodes into runs of */ \
+        /* 2 * width nodes by relinking them. It is stable and allocates nothing. */ \
+        for (size_t width = 1; width < _list_->count; width *= 2) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *left = head; \
+            struct CMC_DEF_NODE(SNAME) *tail = NULL; \
+\
+            head = NULL; \
+\
+            while (left) \
+            { \
+                struct CMC_DEF_NODE(SNAME) *right = left; \
+                size_t left_size = 0; \
+                size_t right_size = width; \
+\
+                while (left_size < width && right) \
+                { \
+                    left_size++; \
+                    right = right->next; \
+                } \
+\
+                while (left_size > 0 || (right_size > 0 && right)) \
+                { \
+                    struct CMC_DEF_NODE(SNAME) *next; \
+\
+                    /* Taking from the left run on ties keeps the sort stable */ \
+                    bool take_left = left_size > 0; \
+\
+                    if (take_left && right_size > 0 && right) \
+                        take_left = _list_->f_val->cmp(left->value, right->value) <= 0; \
+\
+                    if (take_left) \
+                    { \
+                        next = left; \
+                        left = left->next; \
+                        left_size--; \
+                    } \
+                    else \
+                    { \
+                        next = right; \
+                        right = right->next; \
+                        right_size--; \
+                    } \
+\
+                    if (tail) \
+                        tail->next = next; \
+                    else \
+                        head = next; \
+\
+                    tail = next; \
+                } \
+\
+                left = right; \
+            } \
+\
+            tail->next = NULL; \
+        } \
+\
+        /* Only the next links were kept while merging */ \
+        struct CMC_DEF_NODE(SNAME) *prev = NULL; \
+\
+        for (struct CMC_DEF_NODE(SNAME) *node = head; node; node = node->next) \
+        { \
+            node->prev = prev; \
+            prev = node; \
+        } \
+\
+        _list_->head = head; \
+        _list_->tail = prev; \
+        _list_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_list_, update); \
+    } \
 \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _list_) \
     { \
@@ -71,6 +71,7 @@
  * Core functionalities of the C Macro Collections Library
  * ------------------------------------------------------------------------- */
 #include "cor_core.h"
+#include "cor_sort.h"
 
 /**
  * Core List implementation
@@ -98,18 +99,18 @@
 
 /* Lowest level API */
 #define CMC_CMC_LIST_CORE_STRUCT(PARAMS) \
-    CMC_CMC_LIST_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+    CMC_CMC_LIST_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SIZE(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
 
 #define CMC_CMC_LIST_CORE_HEADER(PARAMS) \
     CMC_CMC_LIST_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
 
 #define CMC_CMC_LIST_CORE_SOURCE(PARAMS) \
-    CMC_CMC_LIST_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+    CMC_CMC_LIST_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SIZE(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
 
 /* -------------------------------------------------------------------------
  * Struct
  * ------------------------------------------------------------------------- */
-#define CMC_CMC_LIST_CORE_STRUCT_(PFX, SNAME, V) \
+#define CMC_CMC_LIST_CORE_STRUCT_(PFX, SIZE, SNAME, V) \
 \
     /* List Structure */ \
     struct SNAME \
@@ -134,6 +135,10 @@
 \
         /* Custom callback functions */ \
         CMC_CALLBACKS_DECL; \
+\
+        /* Inline storage used while the list fits in SIZE elements */ \
+        /* If SIZE is empty this is a flexible array member that takes no space */ \
+        V inline_buffer[SIZE]; \
     };
 
 /* -------------------------------------------------------------------------
@@ -161,6 +166,9 @@
 \
         /* Priority function */ \
         CMC_DEF_FTAB_PRI(V); \
+\
+        /* Search function for contiguous elements, can be NULL */ \
+        CMC_DEF_FTAB_FIND(V); \
     }; \
 \
     /* Collection Functions */ \
@@ -194,6 +202,9 @@
     bool CMC_(PFX, _fits)(struct SNAME * _list_, size_t size); \
     size_t CMC_(PFX, _capacity)(struct SNAME * _list_); \
     int CMC_(PFX, _flag)(struct SNAME * _list_); \
+    /* Collection Sorting */ \
+    void CMC_(PFX, _sort)(struct SNAME * _list_); \
+    bool CMC_(PFX, _stable_sort)(struct SNAME * _list_); \
     /* Collection Utility */ \
     bool CMC_(PFX, _resize)(struct SNAME * _list_, size_t capacity); \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _list_); \
@@ -202,10 +213,11 @@
 /* -------------------------------------------------------------------------
  * Source
  * ------------------------------------------------------------------------- */
-#define CMC_CMC_LIST_CORE_SOURCE_(PFX, SNAME, V) \
+#define CMC_CMC_LIST_CORE_SOURCE_(PFX, SIZE, SNAME, V) \
 \
     /* Implementation Detail Functions */ \
-    /* None */ \
+    static bool CMC_(PFX, _impl_is_inline)(struct SNAME * _list_); \
+    CMC_COR_SORT_SOURCE(PFX, V) \
 \
     struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val) \
     { \
@@ -231,12 +243,23 @@
         if (!_list_) \
             return NULL; \
 \
-        _list_->buffer = alloc->calloc(capacity, sizeof(V)); \
+        if (capacity <= CMC_SIZE_OR_ZERO(SIZE)) \
+        { \
+            /* Small lists don't need a separate buffer */ \
+            memset(_list_->inline_buffer, 0, sizeof(V) * CMC_SIZE_OR_ZERO(SIZE)); \
 \
-        if (!_list_->buffer) \
+            _list_->buffer = _list_->inline_buffer; \
+            capacity = CMC_SIZE_OR_ZERO(SIZE); \
+        } \
+        else \
         { \
-            alloc->free(_list_); \
-            return NULL; \
+            _list_->buffer = alloc->calloc(capacity, sizeof(V)); \
+\
+            if (!_list_->buffer) \
+            { \
+                alloc->free(_list_); \
+                return NULL; \
+            } \
         } \
 \
         _list_->capacity = capacity; \
@@ -271,7 +294,9 @@
                 _list_->f_val->free(_list_->buffer[i]); \
         } \
 \
-        _list_->alloc->free(_list_->buffer); \
+        if (!CMC_(PFX, _impl_is_inline)(_list_)) \
+            _list_->alloc->free(_list_->buffer); \
+\
         _list_->alloc->free(_list_); \
     } \
 \
@@ -487,7 +512,11 @@
 \
         size_t result = _list_->count; \
 \
-        if (from_start) \
+        if (from_start && _list_->f_val->find) \
+        { \
+            result = _list_->f_val->find(_list_->buffer, _list_->count, value); \
+        } \
+        else if (from_start) \
         { \
             for (size_t i = 0; i < _list_->count; i++) \
             { \
@@ -521,12 +550,19 @@
 \
         bool result = false; \
 \
-        for (size_t i = 0; i < _list_->count; i++) \
+        if (_list_->f_val->find) \
         { \
-            if (_list_->f_val->cmp(_list_->buffer[i], value) == 0) \
+            result = _list_->f_val->find(_list_->buffer, _list_->count, value) < _list_->count; \
+        } \
+        else \
+        { \
+            for (size_t i = 0; i < _list_->count; i++) \
             { \
-                result = true; \
-                break; \
+                if (_list_->f_val->cmp(_list_->buffer[i], value) == 0) \
+                { \
+                    result = true; \
+                    break; \
+                } \
             } \
         } \
 \
@@ -564,6 +600,30 @@
     { \
         return _list_->flag; \
     } \
+\
+    void CMC_(PFX, _sort)(struct SNAME * _list_) \
+    { \
+        CMC_(PFX, _impl_sort)(_list_->buffer, _list_->count, _list_->f_val->cmp, _list_->alloc); \
+\
+        _list_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_list_, update); \
+    } \
+\
+    bool CMC_(PFX, _stable_sort)(struct SNAME * _list_) \
+    { \
+        if (!CMC_(PFX, _impl_stable_sort)(_list_->buffer, _list_->count, _list_->f_val->cmp, _list_->alloc)) \
+        { \
+            _list_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        _list_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_list_, update); \
+\
+        return true; \
+    } \
 \
     bool CMC_(PFX, _resize)(struct SNAME * _list_, size_t capacity) \
     { \
@@ -578,7 +638,35 @@
             return false; \
         } \
 \
-        V *new_buffer = _list_->alloc->realloc(_list_->buffer, sizeof(V) * capacity); \
+        /* The inline buffer always holds up to SIZE elements */ \
+        if (CMC_SIZE_OR_ZERO(SIZE) > 0 && capacity <= CMC_SIZE_OR_ZERO(SIZE)) \
+        { \
+            if (CMC_(PFX, _impl_is_inline)(_list_)) \
+                return true; \
+\
+            memcpy(_list_->inline_buffer, _list_->buffer, sizeof(V) * _list_->count); \
+            _list_->alloc->free(_list_->buffer); \
+\
+            _list_->buffer = _list_->inline_buffer; \
+            _list_->capacity = CMC_SIZE_OR_ZERO(SIZE); \
+\
+            CMC_CALLBACKS_CALL(_list_, resize); \
+\
+            return true; \
+        } \
+\
+        V *new_buffer; \
+\
+        if (CMC_(PFX, _impl_is_inline)(_list_)) \
+        { \
+            /* Spill the inline buffer to the heap */ \
+            new_buffer = _list_->alloc->malloc(sizeof(V) * capacity); \
+\
+            if (new_buffer) \
+                memcpy(new_buffer, _list_->inline_buffer, sizeof(V) * _list_->count); \
+        } \
+        else \
+            new_buffer = _list_->alloc->realloc(_list_->buffer, sizeof(V) * capacity); \
 \
         if (!new_buffer) \
         { \
@@ -638,6 +726,11 @@
         } \
 \
         return true; \
+    } \
+\
+    static bool CMC_(PFX, _impl_is_inline)(struct SNAME * _list_) \
+    { \
+        return CMC_SIZE_OR_ZERO(SIZE) > 0 && _list_->buffer == _list_->inline_buffer; \
     }
 
 #endif /* CMC_CMC_LIST_H */
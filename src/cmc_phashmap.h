@@ -0,0 +1,1040 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_phashmap.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * PHashMap
+ *
+ * A PHashMap is a persistent HashMap: inserting, updating or removing a key
+ * never changes the map, but returns a new version of it. It is a Hash Array
+ * Mapped Trie where every node branches on 5 bits of the hash of the keys and
+ * keeps its entries and its children in two compact arrays indexed by a
+ * bitmap each. A new version only copies the nodes on the path to the key it
+ * changes and shares every other node with the version it came from, which
+ * makes an update take O(log32 n) time and memory and a snapshot with
+ * _copy_of() O(1). Keys whose hashes are completely equal end up together in
+ * a collision node at the bottom of the trie.
+ *
+ * Nodes are reference counted and each version has to be freed with _free().
+ * A node is only freed when the last version using it is freed. Keys and
+ * values are shared between versions as they are, so the cpy and free
+ * functions of the function tables are never called and their memory has to
+ * be managed outside of the map. Any number of threads can read versions at
+ * the same time, but creating and freeing versions that share nodes has to be
+ * synchronized.
+ */
+
+#ifndef CMC_CMC_PHASHMAP_H
+#define CMC_CMC_PHASHMAP_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/* Maximum depth of the trie, one level for every 5 bits of a hash plus the */
+/* level of the collision nodes */
+#define CMC_PHASHMAP_DEPTH ((sizeof(size_t) * CHAR_BIT + 4) / 5 + 1)
+
+/**
+ * Core PHashMap implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_PHASHMAP_CORE(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_CMC_PHASHMAP_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_PHASHMAP_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_PHASHMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_PHASHMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_PHASHMAP_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_PHASHMAP_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_PHASHMAP_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    struct CMC_DEF_NODE(CMC_PARAM_SNAME(PARAMS)); \
+    struct CMC_DEF_ENTRY(CMC_PARAM_SNAME(PARAMS)); \
+    CMC_CMC_PHASHMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_PHASHMAP_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_PHASHMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_PHASHMAP_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_PHASHMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_PHASHMAP_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                  CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_PHASHMAP_CORE_HEADER(PARAMS) \
+    CMC_CMC_PHASHMAP_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                  CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_PHASHMAP_CORE_SOURCE(PARAMS) \
+    CMC_CMC_PHASHMAP_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                  CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_PHASHMAP_CORE_STRUCT_(PFX, SNAME, K, V) \
+\
+    /* PHashMap Structure, a version of the map */ \
+    struct SNAME \
+    { \
+        /* Root node, NULL if the map is empty */ \
+        struct CMC_DEF_NODE(SNAME) * root; \
+\
+        /* How many keys are in this version */ \
+        size_t count; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Key function table */ \
+        struct CMC_DEF_FKEY(SNAME) * f_key; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    }; \
+\
+    /* PHashMap Entry */ \
+    struct CMC_DEF_ENTRY(SNAME) \
+    { \
+        /* Entry Key */ \
+        K key; \
+\
+        /* Entry Value */ \
+        V value; \
+\
+        /* Hash of the key */ \
+        size_t hash; \
+    }; \
+\
+    /* PHashMap Node, shared by every version that reaches it */ \
+    struct CMC_DEF_NODE(SNAME) \
+    { \
+        /* How many versions and parent nodes point to this node */ \
+        size_t refcount; \
+\
+        /* How many entries are in this node */ \
+        size_t length; \
+\
+        /* Which of the 32 branches hold an entry */ \
+        uint32_t datamap; \
+\
+        /* Which of the 32 branches hold a child node */ \
+        uint32_t nodemap; \
+\
+        /* Entries ordered by their branch, or in any order in a collision node */ \
+        struct CMC_DEF_ENTRY(SNAME) * entries; \
+\
+        /* Child nodes ordered by their branch */ \
+        struct CMC_DEF_NODE(SNAME) * *children; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_PHASHMAP_CORE_HEADER_(PFX, SNAME, K, V) \
+\
+    /* Key struct function table */ \
+    struct CMC_DEF_FKEY(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(K); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(K); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(K); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(K); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(K); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(K); \
+    }; \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _free)(struct SNAME * _map_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output, each returns a new version */ \
+    struct SNAME *CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value); \
+    struct SNAME *CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value); \
+    struct SNAME *CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value); \
+    /* Element Access */ \
+    V CMC_(PFX, _get)(struct SNAME * _map_, K key); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, K key); \
+    bool CMC_(PFX, _empty)(struct SNAME * _map_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _map_); \
+    int CMC_(PFX, _flag)(struct SNAME * _map_); \
+    /* Collection Utility */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_PHASHMAP_CORE_SOURCE_(PFX, SNAME, K, V) \
+\
+    /* Implementation Detail Functions */ \
+    static struct SNAME *CMC_(PFX, _impl_version)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * root, \
+                                                  size_t count); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_new_node)(struct SNAME * _map_, size_t length, \
+                                                                  size_t children); \
+    static void CMC_(PFX, _impl_release)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_put)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, \
+                                                             size_t shift, struct CMC_DEF_ENTRY(SNAME) * entry, \
+                                                             bool update, V * old_value); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_merge)(struct SNAME * _map_, struct CMC_DEF_ENTRY(SNAME) * a, \
+                                                               struct CMC_DEF_ENTRY(SNAME) * b, size_t shift); \
+    static bool CMC_(PFX, _impl_delete)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, size_t shift, \
+                                        size_t hash, K key, V * out_value, struct CMC_DEF_NODE(SNAME) * *result); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_without_entry)(struct SNAME * _map_, \
+                                                                       struct CMC_DEF_NODE(SNAME) * node, \
+                                                                       uint32_t bit, size_t index); \
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_entry)(struct SNAME * _map_, K key); \
+    static bool CMC_(PFX, _impl_contains_all)(struct SNAME * _map1_, struct SNAME * _map2_, \
+                                              struct CMC_DEF_NODE(SNAME) * node); \
+    static size_t CMC_(PFX, _impl_children)(struct CMC_DEF_NODE(SNAME) * node); \
+    static size_t CMC_(PFX, _impl_popcount)(uint32_t bits); \
+\
+    struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(f_key, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!f_key || !f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_map_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_map_) \
+            return NULL; \
+\
+        _map_->root = NULL; \
+        _map_->count = 0; \
+        _map_->flag = CMC_FLAG_OK; \
+        _map_->f_key = f_key; \
+        _map_->f_val = f_val; \
+        _map_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        return _map_; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _map_) \
+    { \
+        if (_map_->root) \
+            CMC_(PFX, _impl_release)(_map_, _map_->root); \
+\
+        _map_->alloc->free(_map_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _map_->alloc = &cmc_alloc_node_default; \
+        else \
+            _map_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        _map_->flag = CMC_FLAG_OK; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value) \
+    { \
+        struct CMC_DEF_ENTRY(SNAME) entry = { key, value, _map_->f_key->hash(key) }; \
+\
+        struct CMC_DEF_NODE(SNAME) *root = CMC_(PFX, _impl_put)(_map_, _map_->root, 0, &entry, false, NULL); \
+\
+        if (!root) \
+            return NULL; \
+\
+        struct SNAME *result = CMC_(PFX, _impl_version)(_map_, root, _map_->count + 1); \
+\
+        if (!result) \
+            return NULL; \
+\
+        CMC_CALLBACKS_CALL(result, create); \
+\
+        return result; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return NULL; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) entry = { key, new_value, _map_->f_key->hash(key) }; \
+\
+        struct CMC_DEF_NODE(SNAME) *root = CMC_(PFX, _impl_put)(_map_, _map_->root, 0, &entry, true, old_value); \
+\
+        if (!root) \
+            return NULL; \
+\
+        struct SNAME *result = CMC_(PFX, _impl_version)(_map_, root, _map_->count); \
+\
+        if (!result) \
+            return NULL; \
+\
+        CMC_CALLBACKS_CALL(result, update); \
+\
+        return result; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return NULL; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *root = NULL; \
+\
+        if (!CMC_(PFX, _impl_delete)(_map_, _map_->root, 0, _map_->f_key->hash(key), key, out_value, &root)) \
+            return NULL; \
+\
+        struct SNAME *result = CMC_(PFX, _impl_version)(_map_, root, _map_->count - 1); \
+\
+        if (!result) \
+            return NULL; \
+\
+        CMC_CALLBACKS_CALL(result, delete); \
+\
+        return result; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _map_, K key) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *entry = CMC_(PFX, _impl_get_entry)(_map_, key); \
+\
+        if (!entry) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return (V){ 0 }; \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return entry->value; \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, K key) \
+    { \
+        bool result = CMC_(PFX, _impl_get_entry)(_map_, key) != NULL; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _map_) \
+    { \
+        return _map_->count == 0; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _map_) \
+    { \
+        return _map_->count; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _map_) \
+    { \
+        return _map_->flag; \
+    } \
+\
+    /* Versions never change, so a copy shares the whole trie in O(1) */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_) \
+    { \
+        /* On failure the reference is dropped again by _impl_version */ \
+        if (_map_->root) \
+            _map_->root->refcount++; \
+\
+        return CMC_(PFX, _impl_version)(_map_, _map_->root, _map_->count); \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_) \
+    { \
+        _map1_->flag = CMC_FLAG_OK; \
+        _map2_->flag = CMC_FLAG_OK; \
+\
+        if (_map1_->count != _map2_->count) \
+            return false; \
+\
+        /* Versions that share their root are equal without looking further */ \
+        if (_map1_->root == _map2_->root) \
+            return true; \
+\
+        return CMC_(PFX, _impl_contains_all)(_map1_, _map2_, _map1_->root); \
+    } \
+\
+    /* Wraps a root in a new version with the same settings as _map_ */ \
+    static struct SNAME *CMC_(PFX, _impl_version)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * root, \
+                                                  size_t count) \
+    { \
+        struct SNAME *result = _map_->alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!result) \
+        { \
+            if (root) \
+                CMC_(PFX, _impl_release)(_map_, root); \
+\
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        result->root = root; \
+        result->count = count; \
+        result->flag = CMC_FLAG_OK; \
+        result->f_key = _map_->f_key; \
+        result->f_val = _map_->f_val; \
+        result->alloc = _map_->alloc; \
+        CMC_CALLBACKS_ASSIGN(result, _map_->callbacks); \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    /* Allocates a node and both of its arrays in a single block */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_new_node)(struct SNAME * _map_, size_t length, \
+                                                                  size_t children) \
+    { \
+        /* Each array starts at a multiple of the size of its elements */ \
+        size_t entry_size = sizeof(struct CMC_DEF_ENTRY(SNAME)); \
+        size_t child_size = sizeof(struct CMC_DEF_NODE(SNAME) *); \
+        size_t entries_at = (sizeof(struct CMC_DEF_NODE(SNAME)) + entry_size - 1) / entry_size * entry_size; \
+        size_t children_at = (entries_at + length * entry_size + child_size - 1) / child_size * child_size; \
+\
+        unsigned char *block = _map_->alloc->malloc(children_at + children * child_size); \
+\
+        if (!block) \
+            return NULL; \
+\
+        struct CMC_DEF_NODE(SNAME) *node = (struct CMC_DEF_NODE(SNAME) *)block; \
+\
+        node->refcount = 1; \
+        node->length = length; \
+        node->datamap = 0; \
+        node->nodemap = 0; \
+        node->entries = (struct CMC_DEF_ENTRY(SNAME) *)(block + entries_at); \
+        node->children = (struct CMC_DEF_NODE(SNAME) **)(block + children_at); \
+\
+        return node; \
+    } \
+\
+    /* Drops a reference to node, freeing it and releasing its children once */ \
+    /* nothing points to it */ \
+    static void CMC_(PFX, _impl_release)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (--node->refcount > 0) \
+            return; \
+\
+        size_t children = CMC_(PFX, _impl_children)(node); \
+\
+        for (size_t i = 0; i < children; i++) \
+            CMC_(PFX, _impl_release)(_map_, node->children[i]); \
+\
+        _map_->alloc->free(node); \
+    } \
+\
+    /* Returns a copy of node with entry added, or with its value replaced */ \
+    /* if update is true, sharing every other child with node */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_put)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, \
+                                                             size_t shift, struct CMC_DEF_ENTRY(SNAME) * entry, \
+                                                             bool update, V * old_value) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *result = NULL; \
+\
+        if (!node) \
+        { \
+            /* Only the root of an empty map */ \
+            if (!(result = CMC_(PFX, _impl_new_node)(_map_, 1, 0))) \
+            { \
+                _map_->flag = CMC_FLAG_ALLOC; \
+                return NULL; \
+            } \
+\
+            result->datamap = (uint32_t)1 << (entry->hash & 31); \
+            result->entries[0] = *entry; \
+\
+            return result; \
+        } \
+\
+        size_t children = CMC_(PFX, _impl_children)(node); \
+\
+        /* Collision node, every entry has the same hash */ \
+        if (shift >= sizeof(size_t) * CHAR_BIT) \
+        { \
+            size_t index = 0; \
+\
+            while (index < node->length && _map_->f_key->cmp(node->entries[index].key, entry->key) != 0) \
+                index++; \
+\
+            if (index < node->length && !update) \
+            { \
+                _map_->flag = CMC_FLAG_DUPLICATE; \
+                return NULL; \
+            } \
+            else if (index == node->length && update) \
+            { \
+                _map_->flag = CMC_FLAG_NOT_FOUND; \
+                return NULL; \
+            } \
+\
+            size_t length = update ? node->length : node->length + 1; \
+\
+            if (!(result = CMC_(PFX, _impl_new_node)(_map_, length, 0))) \
+            { \
+                _map_->flag = CMC_FLAG_ALLOC; \
+                return NULL; \
+            } \
+\
+            memcpy(result->entries, node->entries, node->length * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+\
+            if (update && old_value) \
+                *old_value = node->entries[index].value; \
+\
+            result->entries[index] = *entry; \
+\
+            return result; \
+        } \
+\
+        uint32_t bit = (uint32_t)1 << ((entry->hash >> shift) & 31); \
+        size_t e_index = CMC_(PFX, _impl_popcount)(node->datamap & (bit - 1)); \
+        size_t c_index = CMC_(PFX, _impl_popcount)(node->nodemap & (bit - 1)); \
+\
+        if (node->datamap & bit) \
+        { \
+            struct CMC_DEF_ENTRY(SNAME) *current = &(node->entries[e_index]); \
+\
+            if (current->hash == entry->hash && _map_->f_key->cmp(current->key, entry->key) == 0) \
+            { \
+                if (!update) \
+                { \
+                    _map_->flag = CMC_FLAG_DUPLICATE; \
+                    return NULL; \
+                } \
+\
+                if (!(result = CMC_(PFX, _impl_new_node)(_map_, node->length, children))) \
+                { \
+                    _map_->flag = CMC_FLAG_ALLOC; \
+                    return NULL; \
+                } \
+\
+                result->datamap = node->datamap; \
+                result->nodemap = node->nodemap; \
+\
+                memcpy(result->entries, node->entries, node->length * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+                memcpy(result->children, node->children, children * sizeof(struct CMC_DEF_NODE(SNAME) *)); \
+\
+                for (size_t i = 0; i < children; i++) \
+                    node->children[i]->refcount++; \
+\
+                if (old_value) \
+                    *old_value = current->value; \
+\
+                result->entries[e_index].value = entry->value; \
+\
+                return result; \
+            } \
+\
+            if (update) \
+            { \
+                _map_->flag = CMC_FLAG_NOT_FOUND; \
+                return NULL; \
+            } \
+\
+            /* Both entries go one level down */ \
+            struct CMC_DEF_NODE(SNAME) *child = CMC_(PFX, _impl_merge)(_map_, current, entry, shift + 5); \
+\
+            if (!child) \
+            { \
+                _map_->flag = CMC_FLAG_ALLOC; \
+                return NULL; \
+            } \
+\
+            if (!(result = CMC_(PFX, _impl_new_node)(_map_, node->length - 1, children + 1))) \
+            { \
+                CMC_(PFX, _impl_release)(_map_, child); \
+                _map_->flag = CMC_FLAG_ALLOC; \
+                return NULL; \
+            } \
+\
+            result->datamap = node->datamap & ~bit; \
+            result->nodemap = node->nodemap | bit; \
+\
+            memcpy(result->entries, node->entries, e_index * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+            memcpy(result->entries + e_index, node->entries + e_index + 1, \
+                   (node->length - e_index - 1) * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+\
+            memcpy(result->children, node->children, c_index * sizeof(struct CMC_DEF_NODE(SNAME) *)); \
+            memcpy(result->children + c_index + 1, node->children + c_index, \
+                   (children - c_index) * sizeof(struct CMC_DEF_NODE(SNAME) *)); \
+\
+            for (size_t i = 0; i < children; i++) \
+                node->children[i]->refcount++; \
+\
+            result->children[c_index] = child; \
+\
+            return result; \
+        } \
+        else if (node->nodemap & bit) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *child = \
+                CMC_(PFX, _impl_put)(_map_, node->children[c_index], shift + 5, entry, update, old_value); \
+\
+            if (!child) \
+                return NULL; \
+\
+            if (!(result = CMC_(PFX, _impl_new_node)(_map_, node->length, children))) \
+            { \
+                CMC_(PFX, _impl_release)(_map_, child); \
+                _map_->flag = CMC_FLAG_ALLOC; \
+                return NULL; \
+            } \
+\
+            result->datamap = node->datamap; \
+            result->nodemap = node->nodemap; \
+\
+            memcpy(result->entries, node->entries, node->length * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+            memcpy(result->children, node->children, children * sizeof(struct CMC_DEF_NODE(SNAME) *)); \
+\
+            for (size_t i = 0; i < children; i++) \
+            { \
+                if (i != c_index) \
+                    node->children[i]->refcount++; \
+            } \
+\
+            result->children[c_index] = child; \
+\
+            return result; \
+        } \
+\
+        if (update) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return NULL; \
+        } \
+\
+        if (!(result = CMC_(PFX, _impl_new_node)(_map_, node->length + 1, children))) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        result->datamap = node->datamap | bit; \
+        result->nodemap = node->nodemap; \
+\
+        memcpy(result->entries, node->entries, e_index * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+        memcpy(result->entries + e_index + 1, node->entries + e_index, \
+               (node->length - e_index) * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+        memcpy(result->children, node->children, children * sizeof(struct CMC_DEF_NODE(SNAME) *)); \
+\
+        for (size_t i = 0; i < children; i++) \
+            node->children[i]->refcount++; \
+\
+        result->entries[e_index] = *entry; \
+\
+        return result; \
+    } \
+\
+    /* Creates the nodes that separate two entries with different keys */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_merge)(struct SNAME * _map_, struct CMC_DEF_ENTRY(SNAME) * a, \
+                                                               struct CMC_DEF_ENTRY(SNAME) * b, size_t shift) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *result = NULL; \
+\
+        if (shift >= sizeof(size_t) * CHAR_BIT) \
+        { \
+            if (!(result = CMC_(PFX, _impl_new_node)(_map_, 2, 0))) \
+                return NULL; \
+\
+            result->entries[0] = *a; \
+            result->entries[1] = *b; \
+\
+            return result; \
+        } \
+\
+        size_t branch_a = (a->hash >> shift) & 31; \
+        size_t branch_b = (b->hash >> shift) & 31; \
+\
+        if (branch_a == branch_b) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *child = CMC_(PFX, _impl_merge)(_map_, a, b, shift + 5); \
+\
+            if (!child) \
+                return NULL; \
+\
+            if (!(result = CMC_(PFX, _impl_new_node)(_map_, 0, 1))) \
+            { \
+                CMC_(PFX, _impl_release)(_map_, child); \
+                return NULL; \
+            } \
+\
+            result->nodemap = (uint32_t)1 << branch_a; \
+            result->children[0] = child; \
+\
+            return result; \
+        } \
+\
+        if (!(result = CMC_(PFX, _impl_new_node)(_map_, 2, 0))) \
+            return NULL; \
+\
+        result->datamap = ((uint32_t)1 << branch_a) | ((uint32_t)1 << branch_b); \
+        result->entries[branch_a < branch_b ? 0 : 1] = *a; \
+        result->entries[branch_a < branch_b ? 1 : 0] = *b; \
+\
+        return result; \
+    } \
+\
+    /* Sets result to a copy of node without key, which is NULL if nothing */ \
+    /* would be left in it. A child left with a single entry is replaced by */ \
+    /* that entry so that the trie stays as shallow as possible */ \
+    static bool CMC_(PFX, _impl_delete)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, size_t shift, \
+                                        size_t hash, K key, V * out_value, struct CMC_DEF_NODE(SNAME) * *result) \
+    { \
+        if (shift >= sizeof(size_t) * CHAR_BIT) \
+        { \
+            for (size_t i = 0; i < node->length; i++) \
+            { \
+                if (_map_->f_key->cmp(node->entries[i].key, key) == 0) \
+                { \
+                    if (out_value) \
+                        *out_value = node->entries[i].value; \
+\
+                    *result = NULL; \
+\
+                    if (node->length == 1) \
+                        return true; \
+\
+                    if (!(*result = CMC_(PFX, _impl_without_entry)(_map_, node, 0, i))) \
+                    { \
+                        _map_->flag = CMC_FLAG_ALLOC; \
+                        return false; \
+                    } \
+\
+                    return true; \
+                } \
+            } \
+\
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        size_t children = CMC_(PFX, _impl_children)(node); \
+        uint32_t bit = (uint32_t)1 << ((hash >> shift) & 31); \
+        size_t e_index = CMC_(PFX, _impl_popcount)(node->datamap & (bit - 1)); \
+        size_t c_index = CMC_(PFX, _impl_popcount)(node->nodemap & (bit - 1)); \
+\
+        if (node->datamap & bit) \
+        { \
+            struct CMC_DEF_ENTRY(SNAME) *current = &(node->entries[e_index]); \
+\
+            if (current->hash != hash || _map_->f_key->cmp(current->key, key) != 0) \
+            { \
+                _map_->flag = CMC_FLAG_NOT_FOUND; \
+                return false; \
+            } \
+\
+            if (out_value) \
+                *out_value = current->value; \
+\
+            *result = NULL; \
+\
+            if (node->length == 1 && children == 0) \
+                return true; \
+\
+            if (!(*result = CMC_(PFX, _impl_without_entry)(_map_, node, bit, e_index))) \
+            { \
+                _map_->flag = CMC_FLAG_ALLOC; \
+                return false; \
+            } \
+\
+            return true; \
+        } \
+        else if (!(node->nodemap & bit)) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *child = NULL; \
+\
+        if (!CMC_(PFX, _impl_delete)(_map_, node->children[c_index], shift + 5, hash, key, out_value, &child)) \
+            return false; \
+\
+        /* The child is inlined if it has a single entry left */ \
+        bool inline_child = child && child->length == 1 && child->nodemap == 0; \
+\
+        size_t length = node->length + (inline_child ? 1 : 0); \
+        size_t new_children = children - (child && !inline_child ? 0 : 1); \
+\
+        if (length == 0 && new_children == 0) \
+        { \
+            *result = NULL; \
+            return true; \
+        } \
+\
+        if (!(*result = CMC_(PFX, _impl_new_node)(_map_, length, new_children))) \
+        { \
+            if (child) \
+                CMC_(PFX, _impl_release)(_map_, child); \
+\
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *r = *result; \
+\
+        r->datamap = node->datamap; \
+        r->nodemap = node->nodemap; \
+\
+        if (inline_child) \
+        { \
+            r->datamap |= bit; \
+\
+            memcpy(r->entries, node->entries, e_index * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+            memcpy(r->entries + e_index + 1, node->entries + e_index, \
+                   (node->length - e_index) * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+\
+            r->entries[e_index] = child->entries[0]; \
+\
+            CMC_(PFX, _impl_release)(_map_, child); \
+            child = NULL; \
+        } \
+        else \
+            memcpy(r->entries, node->entries, node->length * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+\
+        if (child) \
+        { \
+            memcpy(r->children, node->children, children * sizeof(struct CMC_DEF_NODE(SNAME) *)); \
+            r->children[c_index] = child; \
+        } \
+        else \
+        { \
+            r->nodemap &= ~bit; \
+\
+            memcpy(r->children, node->children, c_index * sizeof(struct CMC_DEF_NODE(SNAME) *)); \
+            memcpy(r->children + c_index, node->children + c_index + 1, \
+                   (children - c_index - 1) * sizeof(struct CMC_DEF_NODE(SNAME) *)); \
+        } \
+\
+        for (size_t i = 0; i < children; i++) \
+        { \
+            if (i != c_index) \
+                node->children[i]->refcount++; \
+        } \
+\
+        return true; \
+    } \
+\
+    /* Copy of node without the entry at index, which is at branch bit */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_without_entry)(struct SNAME * _map_, \
+                                                                       struct CMC_DEF_NODE(SNAME) * node, \
+                                                                       uint32_t bit, size_t index) \
+    { \
+        size_t children = CMC_(PFX, _impl_children)(node); \
+\
+        struct CMC_DEF_NODE(SNAME) *result = CMC_(PFX, _impl_new_node)(_map_, node->length - 1, children); \
+\
+        if (!result) \
+            return NULL; \
+\
+        result->datamap = node->datamap & ~bit; \
+        result->nodemap = node->nodemap; \
+\
+        memcpy(result->entries, node->entries, index * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+        memcpy(result->entries + index, node->entries + index + 1, \
+               (node->length - index - 1) * sizeof(struct CMC_DEF_ENTRY(SNAME))); \
+        memcpy(result->children, node->children, children * sizeof(struct CMC_DEF_NODE(SNAME) *)); \
+\
+        for (size_t i = 0; i < children; i++) \
+            node->children[i]->refcount++; \
+\
+        return result; \
+    } \
+\
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_entry)(struct SNAME * _map_, K key) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *node = _map_->root; \
+\
+        size_t hash = _map_->f_key->hash(key); \
+        size_t shift = 0; \
+\
+        while (node) \
+        { \
+            if (shift >= sizeof(size_t) * CHAR_BIT) \
+            { \
+                for (size_t i = 0; i < node->length; i++) \
+                { \
+                    if (_map_->f_key->cmp(node->entries[i].key, key) == 0) \
+                        return &(node->entries[i]); \
+                } \
+\
+                return NULL; \
+            } \
+\
+            uint32_t bit = (uint32_t)1 << ((hash >> shift) & 31); \
+\
+            if (node->datamap & bit) \
+            { \
+                struct CMC_DEF_ENTRY(SNAME) *entry = \
+                    &(node->entries[CMC_(PFX, _impl_popcount)(node->datamap & (bit - 1))]); \
+\
+                if (entry->hash == hash && _map_->f_key->cmp(entry->key, key) == 0) \
+                    return entry; \
+\
+                return NULL; \
+            } \
+            else if (node->nodemap & bit) \
+                node = node->children[CMC_(PFX, _impl_popcount)(node->nodemap & (bit - 1))]; \
+            else \
+                return NULL; \
+\
+            shift += 5; \
+        } \
+\
+        return NULL; \
+    } \
+\
+    /* If every entry under node is also in _map2_ with an equal value */ \
+    static bool CMC_(PFX, _impl_contains_all)(struct SNAME * _map1_, struct SNAME * _map2_, \
+                                              struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (!node) \
+            return true; \
+\
+        for (size_t i = 0; i < node->length; i++) \
+        { \
+            struct CMC_DEF_ENTRY(SNAME) *entry = CMC_(PFX, _impl_get_entry)(_map2_, node->entries[i].key); \
+\
+            if (!entry || _map1_->f_val->cmp(node->entries[i].value, entry->value) != 0) \
+                return false; \
+        } \
+\
+        size_t children = CMC_(PFX, _impl_children)(node); \
+\
+        for (size_t i = 0; i < children; i++) \
+        { \
+            if (!CMC_(PFX, _impl_contains_all)(_map1_, _map2_, node->children[i])) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    static size_t CMC_(PFX, _impl_children)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        return CMC_(PFX, _impl_popcount)(node->nodemap); \
+    } \
+\
+    static size_t CMC_(PFX, _impl_popcount)(uint32_t bits) \
+    { \
+        bits = bits - ((bits >> 1) & 0x55555555u); \
+        bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u); \
+        bits = (bits + (bits >> 4)) & 0x0F0F0F0Fu; \
+\
+        return (size_t)((uint32_t)(bits * 0x01010101u) >> 24); \
+    }
+
+#endif /* CMC_CMC_PHASHMAP_H */
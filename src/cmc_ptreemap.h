@@ -0,0 +1,851 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_ptreemap.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * PTreeMap
+ *
+ * A PTreeMap is a persistent TreeMap: inserting, updating or removing a key
+ * never changes the map, but returns a new version of it. Like the TreeMap it
+ * is an AVL Tree that keeps its keys sorted, but nodes have no parent and are
+ * never modified once they are part of a version. A new version copies only
+ * the O(log n) nodes on the path to the key it changes, plus the few that a
+ * rotation touches, and shares every other node with the version it came
+ * from. A snapshot with _copy_of() takes O(1).
+ *
+ * Nodes are reference counted and each version has to be freed with _free().
+ * A node is only freed when the last version using it is freed. Keys and
+ * values are shared between versions as they are, so the cpy and free
+ * functions of the function tables are never called and their memory has to
+ * be managed outside of the map. Any number of threads can read versions at
+ * the same time, but creating and freeing versions that share nodes has to be
+ * synchronized.
+ */
+
+#ifndef CMC_CMC_PTREEMAP_H
+#define CMC_CMC_PTREEMAP_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/* Bound on the height of the tree, an AVL Tree with n nodes is never taller */
+/* than 1.45 * log2(n + 2) */
+#define CMC_PTREEMAP_DEPTH (sizeof(size_t) * CHAR_BIT * 3 / 2)
+
+/**
+ * Core PTreeMap implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_PTREEMAP_CORE(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_CMC_PTREEMAP_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_PTREEMAP_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_PTREEMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_PTREEMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_PTREEMAP_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_PTREEMAP_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_PTREEMAP_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    struct CMC_DEF_NODE(CMC_PARAM_SNAME(PARAMS)); \
+    CMC_CMC_PTREEMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_PTREEMAP_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_PTREEMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_PTREEMAP_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_PTREEMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_PTREEMAP_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                  CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_PTREEMAP_CORE_HEADER(PARAMS) \
+    CMC_CMC_PTREEMAP_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                  CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_PTREEMAP_CORE_SOURCE(PARAMS) \
+    CMC_CMC_PTREEMAP_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                  CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_PTREEMAP_CORE_STRUCT_(PFX, SNAME, K, V) \
+\
+    /* PTreeMap Structure, a version of the map */ \
+    struct SNAME \
+    { \
+        /* Root node, NULL if the map is empty */ \
+        struct CMC_DEF_NODE(SNAME) * root; \
+\
+        /* How many keys are in this version */ \
+        size_t count; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Key function table */ \
+        struct CMC_DEF_FKEY(SNAME) * f_key; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    }; \
+\
+    /* PTreeMap Node, shared by every version that reaches it */ \
+    struct CMC_DEF_NODE(SNAME) \
+    { \
+        /* Node Key */ \
+        K key; \
+\
+        /* Node Value */ \
+        V value; \
+\
+        /* How many versions and parent nodes point to this node */ \
+        size_t refcount; \
+\
+        /* Height of the subtree, 1 for a leaf */ \
+        unsigned char height; \
+\
+        /* Right child node or subtree */ \
+        struct CMC_DEF_NODE(SNAME) * right; \
+\
+        /* Left child node or subtree */ \
+        struct CMC_DEF_NODE(SNAME) * left; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_PTREEMAP_CORE_HEADER_(PFX, SNAME, K, V) \
+\
+    /* Key struct function table */ \
+    struct CMC_DEF_FKEY(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(K); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(K); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(K); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(K); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(K); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(K); \
+    }; \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _free)(struct SNAME * _map_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output, each returns a new version */ \
+    struct SNAME *CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value); \
+    struct SNAME *CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value); \
+    struct SNAME *CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value); \
+    /* Element Access */ \
+    bool CMC_(PFX, _max)(struct SNAME * _map_, K * key, V * value); \
+    bool CMC_(PFX, _min)(struct SNAME * _map_, K * key, V * value); \
+    V CMC_(PFX, _get)(struct SNAME * _map_, K key); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, K key); \
+    bool CMC_(PFX, _empty)(struct SNAME * _map_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _map_); \
+    int CMC_(PFX, _flag)(struct SNAME * _map_); \
+    /* Collection Utility */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_PTREEMAP_CORE_SOURCE_(PFX, SNAME, K, V) \
+\
+    /* Implementation Detail Functions */ \
+    static struct SNAME *CMC_(PFX, _impl_version)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * root, \
+                                                  size_t count); \
+    static void CMC_(PFX, _impl_acquire)(struct CMC_DEF_NODE(SNAME) * node); \
+    static void CMC_(PFX, _impl_release)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_node)(struct CMC_DEF_NODE(SNAME) * node, K key, V value, \
+                                                              struct CMC_DEF_NODE(SNAME) * left, \
+                                                              struct CMC_DEF_NODE(SNAME) * right); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_balance)(struct SNAME * _map_, K key, V value, \
+                                                                 struct CMC_DEF_NODE(SNAME) * left, \
+                                                                 struct CMC_DEF_NODE(SNAME) * right); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_put)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, \
+                                                             K key, V value, bool update, V * old_value); \
+    static bool CMC_(PFX, _impl_delete)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, K key, \
+                                        V * out_value, struct CMC_DEF_NODE(SNAME) * *result); \
+    static bool CMC_(PFX, _impl_delete_min)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, K * key, \
+                                            V * value, struct CMC_DEF_NODE(SNAME) * *result); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_get_node)(struct SNAME * _map_, K key); \
+    static bool CMC_(PFX, _impl_contains_all)(struct SNAME * _map1_, struct SNAME * _map2_, \
+                                              struct CMC_DEF_NODE(SNAME) * node); \
+    static unsigned char CMC_(PFX, _impl_h)(struct CMC_DEF_NODE(SNAME) * node); \
+\
+    struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(f_key, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!f_key || !f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_map_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_map_) \
+            return NULL; \
+\
+        _map_->root = NULL; \
+        _map_->count = 0; \
+        _map_->flag = CMC_FLAG_OK; \
+        _map_->f_key = f_key; \
+        _map_->f_val = f_val; \
+        _map_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        return _map_; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _map_) \
+    { \
+        CMC_(PFX, _impl_release)(_map_, _map_->root); \
+\
+        _map_->alloc->free(_map_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _map_->alloc = &cmc_alloc_node_default; \
+        else \
+            _map_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        _map_->flag = CMC_FLAG_OK; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *root = CMC_(PFX, _impl_put)(_map_, _map_->root, key, value, false, NULL); \
+\
+        if (!root) \
+            return NULL; \
+\
+        struct SNAME *result = CMC_(PFX, _impl_version)(_map_, root, _map_->count + 1); \
+\
+        if (!result) \
+            return NULL; \
+\
+        CMC_CALLBACKS_CALL(result, create); \
+\
+        return result; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return NULL; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *root = CMC_(PFX, _impl_put)(_map_, _map_->root, key, new_value, true, old_value); \
+\
+        if (!root) \
+            return NULL; \
+\
+        struct SNAME *result = CMC_(PFX, _impl_version)(_map_, root, _map_->count); \
+\
+        if (!result) \
+            return NULL; \
+\
+        CMC_CALLBACKS_CALL(result, update); \
+\
+        return result; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return NULL; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *root = NULL; \
+\
+        if (!CMC_(PFX, _impl_delete)(_map_, _map_->root, key, out_value, &root)) \
+            return NULL; \
+\
+        struct SNAME *result = CMC_(PFX, _impl_version)(_map_, root, _map_->count - 1); \
+\
+        if (!result) \
+            return NULL; \
+\
+        CMC_CALLBACKS_CALL(result, delete); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _max)(struct SNAME * _map_, K * key, V * value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *node = _map_->root; \
+\
+        while (node->right) \
+            node = node->right; \
+\
+        if (key) \
+            *key = node->key; \
+        if (value) \
+            *value = node->value; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _min)(struct SNAME * _map_, K * key, V * value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *node = _map_->root; \
+\
+        while (node->left) \
+            node = node->left; \
+\
+        if (key) \
+            *key = node->key; \
+        if (value) \
+            *value = node->value; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _map_, K key) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_get_node)(_map_, key); \
+\
+        if (!node) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return (V){ 0 }; \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return node->value; \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, K key) \
+    { \
+        bool result = CMC_(PFX, _impl_get_node)(_map_, key) != NULL; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _map_) \
+    { \
+        return _map_->count == 0; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _map_) \
+    { \
+        return _map_->count; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _map_) \
+    { \
+        return _map_->flag; \
+    } \
+\
+    /* Versions never change, so a copy shares the whole tree in O(1) */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_) \
+    { \
+        /* On failure the reference is dropped again by _impl_version */ \
+        CMC_(PFX, _impl_acquire)(_map_->root); \
+\
+        return CMC_(PFX, _impl_version)(_map_, _map_->root, _map_->count); \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_) \
+    { \
+        _map1_->flag = CMC_FLAG_OK; \
+        _map2_->flag = CMC_FLAG_OK; \
+\
+        if (_map1_->count != _map2_->count) \
+            return false; \
+\
+        /* Versions that share their root are equal without looking further */ \
+        if (_map1_->root == _map2_->root) \
+            return true; \
+\
+        return CMC_(PFX, _impl_contains_all)(_map1_, _map2_, _map1_->root); \
+    } \
+\
+    /* Wraps a root in a new version with the same settings as _map_ */ \
+    static struct SNAME *CMC_(PFX, _impl_version)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * root, \
+                                                  size_t count) \
+    { \
+        struct SNAME *result = _map_->alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!result) \
+        { \
+            CMC_(PFX, _impl_release)(_map_, root); \
+\
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        result->root = root; \
+        result->count = count; \
+        result->flag = CMC_FLAG_OK; \
+        result->f_key = _map_->f_key; \
+        result->f_val = _map_->f_val; \
+        result->alloc = _map_->alloc; \
+        CMC_CALLBACKS_ASSIGN(result, _map_->callbacks); \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    static void CMC_(PFX, _impl_acquire)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (node) \
+            node->refcount++; \
+    } \
+\
+    /* Drops a reference to node, freeing it and releasing its children once */ \
+    /* nothing points to it */ \
+    static void CMC_(PFX, _impl_release)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (!node || --node->refcount > 0) \
+            return; \
+\
+        CMC_(PFX, _impl_release)(_map_, node->left); \
+        CMC_(PFX, _impl_release)(_map_, node->right); \
+\
+        _map_->alloc->free(node); \
+    } \
+\
+    /* Fills an allocated node, taking over the references to left and right */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_node)(struct CMC_DEF_NODE(SNAME) * node, K key, V value, \
+                                                              struct CMC_DEF_NODE(SNAME) * left, \
+                                                              struct CMC_DEF_NODE(SNAME) * right) \
+    { \
+        unsigned char h_l = CMC_(PFX, _impl_h)(left); \
+        unsigned char h_r = CMC_(PFX, _impl_h)(right); \
+\
+        node->key = key; \
+        node->value = value; \
+        node->refcount = 1; \
+        node->height = 1 + (h_l > h_r ? h_l : h_r); \
+        node->left = left; \
+        node->right = right; \
+\
+        return node; \
+    } \
+\
+    /* Creates a node with key and value over left and right, whose heights */ \
+    /* differ by at most 2, rotating when needed. It takes over the */ \
+    /* references to left and right and only creates new nodes, since the */ \
+    /* ones under it may be shared. On failure both are released */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_balance)(struct SNAME * _map_, K key, V value, \
+                                                                 struct CMC_DEF_NODE(SNAME) * left, \
+                                                                 struct CMC_DEF_NODE(SNAME) * right) \
+    { \
+        int balance = CMC_(PFX, _impl_h)(right) - CMC_(PFX, _impl_h)(left); \
+\
+        struct CMC_DEF_NODE(SNAME) *heavy = balance >= 2 ? right : (balance <= -2 ? left : NULL); \
+        struct CMC_DEF_NODE(SNAME) *inner = NULL; \
+\
+        /* A double rotation if the inner grandchild is the taller one */ \
+        if (!heavy) \
+            inner = NULL; \
+        else if (heavy == right && CMC_(PFX, _impl_h)(right->left) > CMC_(PFX, _impl_h)(right->right)) \
+            inner = right->left; \
+        else if (heavy == left && CMC_(PFX, _impl_h)(left->right) > CMC_(PFX, _impl_h)(left->left)) \
+            inner = left->right; \
+\
+        /* Every node that is needed is allocated before anything changes */ \
+        size_t needed = 1 + (heavy ? 1 : 0) + (inner ? 1 : 0); \
+        struct CMC_DEF_NODE(SNAME) *nodes[3] = { NULL, NULL, NULL }; \
+\
+        for (size_t i = 0; i < needed; i++) \
+        { \
+            if (!(nodes[i] = _map_->alloc->malloc(sizeof(struct CMC_DEF_NODE(SNAME))))) \
+            { \
+                for (size_t j = 0; j < i; j++) \
+                    _map_->alloc->free(nodes[j]); \
+\
+                CMC_(PFX, _impl_release)(_map_, left); \
+                CMC_(PFX, _impl_release)(_map_, right); \
+\
+                _map_->flag = CMC_FLAG_ALLOC; \
+                return NULL; \
+            } \
+        } \
+\
+        if (!heavy) \
+            return CMC_(PFX, _impl_node)(nodes[0], key, value, left, right); \
+\
+        struct CMC_DEF_NODE(SNAME) *result = NULL; \
+\
+        /* The subtrees that are moved get a reference from the new nodes */ \
+        /* before the one to the node they came from is dropped */ \
+        if (heavy == right && !inner) \
+        { \
+            CMC_(PFX, _impl_acquire)(right->left); \
+            CMC_(PFX, _impl_acquire)(right->right); \
+\
+            struct CMC_DEF_NODE(SNAME) *l = CMC_(PFX, _impl_node)(nodes[1], key, value, left, right->left); \
+\
+            result = CMC_(PFX, _impl_node)(nodes[0], right->key, right->value, l, right->right); \
+        } \
+        else if (heavy == left && !inner) \
+        { \
+            CMC_(PFX, _impl_acquire)(left->left); \
+            CMC_(PFX, _impl_acquire)(left->right); \
+\
+            struct CMC_DEF_NODE(SNAME) *r = CMC_(PFX, _impl_node)(nodes[1], key, value, left->right, right); \
+\
+            result = CMC_(PFX, _impl_node)(nodes[0], left->key, left->value, left->left, r); \
+        } \
+        else if (heavy == right) \
+        { \
+            CMC_(PFX, _impl_acquire)(inner->left); \
+            CMC_(PFX, _impl_acquire)(inner->right); \
+            CMC_(PFX, _impl_acquire)(right->right); \
+\
+            struct CMC_DEF_NODE(SNAME) *l = CMC_(PFX, _impl_node)(nodes[1], key, value, left, inner->left); \
+            struct CMC_DEF_NODE(SNAME) *r = \
+                CMC_(PFX, _impl_node)(nodes[2], right->key, right->value, inner->right, right->right); \
+\
+            result = CMC_(PFX, _impl_node)(nodes[0], inner->key, inner->value, l, r); \
+        } \
+        else \
+        { \
+            CMC_(PFX, _impl_acquire)(inner->left); \
+            CMC_(PFX, _impl_acquire)(inner->right); \
+            CMC_(PFX, _impl_acquire)(left->left); \
+\
+            struct CMC_DEF_NODE(SNAME) *l = \
+                CMC_(PFX, _impl_node)(nodes[1], left->key, left->value, left->left, inner->left); \
+            struct CMC_DEF_NODE(SNAME) *r = CMC_(PFX, _impl_node)(nodes[2], key, value, inner->right, right); \
+\
+            result = CMC_(PFX, _impl_node)(nodes[0], inner->key, inner->value, l, r); \
+        } \
+\
+        CMC_(PFX, _impl_release)(_map_, heavy); \
+\
+        return result; \
+    } \
+\
+    /* Returns a copy of the subtree at node with key added, or with its */ \
+    /* value replaced if update is true */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_put)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, \
+                                                             K key, V value, bool update, V * old_value) \
+    { \
+        if (!node) \
+        { \
+            if (update) \
+            { \
+                _map_->flag = CMC_FLAG_NOT_FOUND; \
+                return NULL; \
+            } \
+\
+            return CMC_(PFX, _impl_balance)(_map_, key, value, NULL, NULL); \
+        } \
+\
+        int cmp = _map_->f_key->cmp(key, node->key); \
+\
+        if (cmp == 0) \
+        { \
+            if (!update) \
+            { \
+                _map_->flag = CMC_FLAG_DUPLICATE; \
+                return NULL; \
+            } \
+\
+            if (old_value) \
+                *old_value = node->value; \
+\
+            CMC_(PFX, _impl_acquire)(node->left); \
+            CMC_(PFX, _impl_acquire)(node->right); \
+\
+            return CMC_(PFX, _impl_balance)(_map_, node->key, value, node->left, node->right); \
+        } \
+        else if (cmp < 0) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *left = CMC_(PFX, _impl_put)(_map_, node->left, key, value, update, old_value); \
+\
+            if (!left) \
+                return NULL; \
+\
+            CMC_(PFX, _impl_acquire)(node->right); \
+\
+            return CMC_(PFX, _impl_balance)(_map_, node->key, node->value, left, node->right); \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *right = CMC_(PFX, _impl_put)(_map_, node->right, key, value, update, old_value); \
+\
+        if (!right) \
+            return NULL; \
+\
+        CMC_(PFX, _impl_acquire)(node->left); \
+\
+        return CMC_(PFX, _impl_balance)(_map_, node->key, node->value, node->left, right); \
+    } \
+\
+    /* Sets result to a copy of the subtree at node without key, which is */ \
+    /* NULL if nothing is left */ \
+    static bool CMC_(PFX, _impl_delete)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, K key, \
+                                        V * out_value, struct CMC_DEF_NODE(SNAME) * *result) \
+    { \
+        if (!node) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        int cmp = _map_->f_key->cmp(key, node->key); \
+\
+        struct CMC_DEF_NODE(SNAME) *left = node->left; \
+        struct CMC_DEF_NODE(SNAME) *right = node->right; \
+\
+        if (cmp < 0) \
+        { \
+            if (!CMC_(PFX, _impl_delete)(_map_, node->left, key, out_value, &left)) \
+                return false; \
+\
+            CMC_(PFX, _impl_acquire)(right); \
+        } \
+        else if (cmp > 0) \
+        { \
+            if (!CMC_(PFX, _impl_delete)(_map_, node->right, key, out_value, &right)) \
+                return false; \
+\
+            CMC_(PFX, _impl_acquire)(left); \
+        } \
+        else \
+        { \
+            if (out_value) \
+                *out_value = node->value; \
+\
+            CMC_(PFX, _impl_acquire)(left); \
+\
+            /* The node is replaced by the smallest key of its right subtree */ \
+            if (right) \
+            { \
+                K min_key; \
+                V min_value; \
+\
+                if (!CMC_(PFX, _impl_delete_min)(_map_, node->right, &min_key, &min_value, &right)) \
+                { \
+                    CMC_(PFX, _impl_release)(_map_, left); \
+                    return false; \
+                } \
+\
+                *result = CMC_(PFX, _impl_balance)(_map_, min_key, min_value, left, right); \
+\
+                return *result != NULL; \
+            } \
+\
+            *result = left; \
+\
+            return true; \
+        } \
+\
+        *result = CMC_(PFX, _impl_balance)(_map_, node->key, node->value, left, right); \
+\
+        return *result != NULL; \
+    } \
+\
+    /* Sets result to a copy of the subtree at node without its smallest key, */ \
+    /* which is returned with its value */ \
+    static bool CMC_(PFX, _impl_delete_min)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, K * key, \
+                                            V * value, struct CMC_DEF_NODE(SNAME) * *result) \
+    { \
+        if (!node->left) \
+        { \
+            *key = node->key; \
+            *value = node->value; \
+\
+            CMC_(PFX, _impl_acquire)(node->right); \
+\
+            *result = node->right; \
+\
+            return true; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *left = NULL; \
+\
+        if (!CMC_(PFX, _impl_delete_min)(_map_, node->left, key, value, &left)) \
+            return false; \
+\
+        CMC_(PFX, _impl_acquire)(node->right); \
+\
+        *result = CMC_(PFX, _impl_balance)(_map_, node->key, node->value, left, node->right); \
+\
+        return *result != NULL; \
+    } \
+\
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_get_node)(struct SNAME * _map_, K key) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *node = _map_->root; \
+\
+        while (node) \
+        { \
+            int cmp = _map_->f_key->cmp(key, node->key); \
+\
+            if (cmp < 0) \
+                node = node->left; \
+            else if (cmp > 0) \
+                node = node->right; \
+            else \
+                return node; \
+        } \
+\
+        return NULL; \
+    } \
+\
+    /* If every key under node is also in _map2_ with an equal value */ \
+    static bool CMC_(PFX, _impl_contains_all)(struct SNAME * _map1_, struct SNAME * _map2_, \
+                                              struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (!node) \
+            return true; \
+\
+        struct CMC_DEF_NODE(SNAME) *other = CMC_(PFX, _impl_get_node)(_map2_, node->key); \
+\
+        if (!other || _map1_->f_val->cmp(node->value, other->value) != 0) \
+            return false; \
+\
+        return CMC_(PFX, _impl_contains_all)(_map1_, _map2_, node->left) && \
+               CMC_(PFX, _impl_contains_all)(_map1_, _map2_, node->right); \
+    } \
+\
+    static unsigned char CMC_(PFX, _impl_h)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        if (node == NULL) \
+            return 0; \
+\
+        return node->height; \
+    }
+
+#endif /* CMC_CMC_PTREEMAP_H */
@@ -128,6 +128,12 @@
 \
         /* Index representing the back of the queue */ \
         size_t back; \
+\
+        /* If adding to a full queue overwrites the element at its other end */ \
+        bool overwrite; \
+\
+        /* Takes every element that is overwritten, which is freed if NULL */ \
+        void (*evict)(V); \
 \
         /* Flags indicating errors or success */ \
         int flag; \
@@ -167,6 +173,9 @@
 \
         /* Priority function */ \
         CMC_DEF_FTAB_PRI(V); \
+\
+        /* Search function for contiguous elements, can be NULL */ \
+        CMC_DEF_FTAB_FIND(V); \
     }; \
 \
     /* Collection Functions */ \
@@ -182,6 +191,7 @@
     /* Collection Input and Output */ \
     bool CMC_(PFX, _enqueue)(struct SNAME * _queue_, V value); \
     bool CMC_(PFX, _dequeue)(struct SNAME * _queue_); \
+    bool CMC_(PFX, _enqueue_many)(struct SNAME * _queue_, V * values, size_t count); \
     /* Element Access */ \
     V CMC_(PFX, _peek)(struct SNAME * _queue_); \
     /* Collection State */ \
@@ -193,6 +203,7 @@
     int CMC_(PFX, _flag)(struct SNAME * _queue_); \
     /* Collection Utility */ \
     bool CMC_(PFX, _resize)(struct SNAME * _queue_, size_t capacity); \
+    void CMC_(PFX, _set_overwrite)(struct SNAME * _queue_, bool overwrite, void (*evict)(V)); \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _queue_); \
     bool CMC_(PFX, _equals)(struct SNAME * _queue1_, struct SNAME * _queue2_);
 
@@ -202,7 +213,7 @@
 #define CMC_CMC_QUEUE_CORE_SOURCE_(PFX, SNAME, V) \
 \
     /* Implementation Detail Functions */ \
-    /* None */ \
+    static void CMC_(PFX, _impl_evict)(struct SNAME * _queue_, V value); \
 \
     struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val) \
     { \
@@ -240,6 +251,8 @@
         _queue_->count = 0; \
         _queue_->front = 0; \
         _queue_->back = 0; \
+        _queue_->overwrite = false; \
+        _queue_->evict = NULL; \
         _queue_->flag = CMC_FLAG_OK; \
         _queue_->f_val = f_val; \
         _queue_->alloc = alloc; \
@@ -303,7 +316,17 @@
     { \
         if (CMC_(PFX, _full)(_queue_)) \
         { \
-            if (!CMC_(PFX, _resize)(_queue_, _queue_->capacity * 2)) \
+            if (_queue_->overwrite) \
+            { \
+                /* The back meets the front so the oldest element is replaced */ \
+                CMC_(PFX, _impl_evict)(_queue_, _queue_->buffer[_queue_->front]); \
+\
+                _queue_->front = (_queue_->front == _queue_->capacity - 1) ? 0 : _queue_->front + 1; \
+                _queue_->count--; \
+\
+                CMC_CALLBACKS_CALL(_queue_, delete); \
+            } \
+            else if (!CMC_(PFX, _resize)(_queue_, _queue_->capacity * 2)) \
                 return false; \
         } \
 \
@@ -336,6 +359,71 @@
 \
         return true; \
     } \
+\
+    bool CMC_(PFX, _enqueue_many)(struct SNAME * _queue_, V * values, size_t count) \
+    { \
+        if (count == 0) \
+        { \
+            _queue_->flag = CMC_FLAG_OK; \
+            return true; \
+        } \
+\
+        if (_queue_->overwrite) \
+        { \
+            /* Values that would be overwritten by the rest of the array */ \
+            /* are evicted right away */ \
+            size_t skipped = count > _queue_->capacity ? count - _queue_->capacity : 0; \
+            size_t evicted = _queue_->count + count - skipped; \
+\
+            evicted = evicted > _queue_->capacity ? evicted - _queue_->capacity : 0; \
+\
+            for (size_t i = 0; i < evicted; i++) \
+            { \
+                CMC_(PFX, _impl_evict)(_queue_, _queue_->buffer[_queue_->front]); \
+\
+                _queue_->front = (_queue_->front == _queue_->capacity - 1) ? 0 : _queue_->front + 1; \
+            } \
+\
+            for (size_t i = 0; i < skipped; i++) \
+                CMC_(PFX, _impl_evict)(_queue_, values[i]); \
+\
+            if (evicted + skipped > 0) \
+            { \
+                CMC_CALLBACKS_CALL(_queue_, delete); \
+            } \
+\
+            _queue_->count -= evicted; \
+            values += skipped; \
+            count -= skipped; \
+        } \
+        else if (_queue_->count + count > _queue_->capacity) \
+        { \
+            size_t capacity = _queue_->capacity * 2; \
+\
+            if (capacity < _queue_->count + count) \
+                capacity = _queue_->count + count; \
+\
+            if (!CMC_(PFX, _resize)(_queue_, capacity)) \
+                return false; \
+        } \
+\
+        /* The values wrap around the end of the buffer at most once */ \
+        size_t first = _queue_->capacity - _queue_->back; \
+\
+        if (first > count) \
+            first = count; \
+\
+        memcpy(_queue_->buffer + _queue_->back, values, sizeof(V) * first); \
+        memcpy(_queue_->buffer, values + first, sizeof(V) * (count - first)); \
+\
+        _queue_->back = (_queue_->back + count) % _queue_->capacity; \
+        _queue_->count += count; \
+        _queue_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_queue_, create); \
+\
+        return true; \
+    } \
 \
     V CMC_(PFX, _peek)(struct SNAME * _queue_) \
     { \
@@ -358,15 +446,31 @@
 \
         bool result = false; \
 \
-        for (size_t i = _queue_->front, j = 0; j < _queue_->count; j++) \
+        if (_queue_->f_val->find) \
         { \
-            if (_queue_->f_val->cmp(_queue_->buffer[i], value) == 0) \
+            /* The elements are split in up to two contiguous parts of the buffer */ \
+            size_t first = _queue_->capacity - _queue_->front; \
+\
+            if (first > _queue_->count) \
+                first = _queue_->count; \
+\
+            size_t second = _queue_->count - first; \
+\
+            result = _queue_->f_val->find(_queue_->buffer + _queue_->front, first, value) < first || \
+                     _queue_->f_val->find(_queue_->buffer, second, value) < second; \
+        } \
+        else \
+        { \
+            for (size_t i = _queue_->front, j = 0; j < _queue_->count; j++) \
             { \
-                result = true; \
-                break; \
-            } \
+                if (_queue_->f_val->cmp(_queue_->buffer[i], value) == 0) \
+                { \
+                    result = true; \
+                    break; \
+                } \
 \
-            i = (i + 1) % _queue_->capacity; \
+                i = (i + 1) % _queue_->capacity; \
+            } \
         } \
 \
         CMC_CALLBACKS_CALL(_queue_, read); \
@@ -440,6 +544,13 @@
 \
         return true; \
     } \
+\
+    void CMC_(PFX, _set_overwrite)(struct SNAME * _queue_, bool overwrite, void (*evict)(V)) \
+    { \
+        _queue_->overwrite = overwrite; \
+        _queue_->evict = evict; \
+        _queue_->flag = CMC_FLAG_OK; \
+    } \
 \
     struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _queue_) \
     { \
@@ -474,7 +585,9 @@
 \
         result->count = _queue_->count; \
         result->front = 0; \
-        result->back = _queue_->count; \
+        result->back = _queue_->count % _queue_->capacity; \
+        result->overwrite = _queue_->overwrite; \
+        result->evict = _queue_->evict; \
 \
         _queue_->flag = CMC_FLAG_OK; \
 \
@@ -500,6 +613,15 @@
         } \
 \
         return true; \
+    } \
+\
+    /* Overwritten elements go to evict, or are freed if there is none */ \
+    static void CMC_(PFX, _impl_evict)(struct SNAME * _queue_, V value) \
+    { \
+        if (_queue_->evict) \
+            _queue_->evict(value); \
+        else if (_queue_->f_val->free) \
+            _queue_->f_val->free(value); \
     }
 
 #endif /* CMC_CMC_QUEUE_H */
@@ -0,0 +1,577 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_segmenttree.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * SegmentTree
+ *
+ * A SegmentTree stores a fixed amount of values and answers what is the
+ * combination of a range of them in O(log n). Values are combined by the
+ * combine function of the value functions table, which must be associative,
+ * like a sum, a minimum or a matrix product. Unlike the FenwickTree it doesn't
+ * need to be commutative and values can be replaced.
+ *
+ * Every node holds the combination of a range of values and its two children
+ * split that range in half, with the root covering all values. The tree is
+ * kept in an array where the children of node i are the nodes 2i and 2i + 1.
+ *
+ * If the apply function of the value functions table is set, the same update
+ * can be applied to a whole range of values in O(log n). An update is only
+ * applied to the highest nodes that cover the range and kept there, as a
+ * pending update, until a query or another update needs to go below them.
+ */
+
+#ifndef CMC_CMC_SEGMENTTREE_H
+#define CMC_CMC_SEGMENTTREE_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/**
+ * Core SegmentTree implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_SEGMENTTREE_CORE(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_CMC_SEGMENTTREE_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_SEGMENTTREE_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_SEGMENTTREE_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SEGMENTTREE_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_SEGMENTTREE_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_SEGMENTTREE_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_SEGMENTTREE_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_CMC_SEGMENTTREE_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_SEGMENTTREE_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_SEGMENTTREE_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SEGMENTTREE_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_SEGMENTTREE_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SEGMENTTREE_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_SEGMENTTREE_CORE_HEADER(PARAMS) \
+    CMC_CMC_SEGMENTTREE_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_SEGMENTTREE_CORE_SOURCE(PARAMS) \
+    CMC_CMC_SEGMENTTREE_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SEGMENTTREE_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* SegmentTree Structure */ \
+    struct SNAME \
+    { \
+        /* Combination of the range of values covered by each node */ \
+        V *tree; \
+\
+        /* Update that still has to be applied to the children of a node */ \
+        V *lazy; \
+\
+        /* If a node has an update in the lazy array */ \
+        bool *pending; \
+\
+        /* Amount of nodes in the arrays */ \
+        size_t nodes; \
+\
+        /* Amount of values */ \
+        size_t count; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SEGMENTTREE_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+\
+        /* Combine function */ \
+        CMC_DEF_FTAB_COMBINE(V); \
+\
+        /* Apply function */ \
+        CMC_DEF_FTAB_APPLY(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(V * values, size_t count, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(V * values, size_t count, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _free)(struct SNAME * _tree_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _tree_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _set)(struct SNAME * _tree_, size_t index, V value); \
+    bool CMC_(PFX, _update)(struct SNAME * _tree_, size_t from, size_t to, V update); \
+    /* Element Access */ \
+    V CMC_(PFX, _get)(struct SNAME * _tree_, size_t index); \
+    V CMC_(PFX, _query)(struct SNAME * _tree_, size_t from, size_t to); \
+    /* Collection State */ \
+    size_t CMC_(PFX, _count)(struct SNAME * _tree_); \
+    int CMC_(PFX, _flag)(struct SNAME * _tree_); \
+    /* Collection Utility */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _tree_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _tree1_, struct SNAME * _tree2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SEGMENTTREE_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static struct SNAME *CMC_(PFX, _impl_new)(size_t count, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                              struct CMC_ALLOC_NODE_NAME * alloc); \
+    static void CMC_(PFX, _impl_build)(struct SNAME * _tree_, V * values, size_t node, size_t lo, size_t hi); \
+    static void CMC_(PFX, _impl_apply)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi, V update); \
+    static void CMC_(PFX, _impl_push)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi); \
+    static void CMC_(PFX, _impl_set)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi, size_t index, \
+                                     V value); \
+    static void CMC_(PFX, _impl_update)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi, size_t from, \
+                                        size_t to, V update); \
+    static V CMC_(PFX, _impl_query)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi, size_t from, \
+                                    size_t to); \
+\
+    struct SNAME *CMC_(PFX, _new)(V * values, size_t count, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(values, count, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(V * values, size_t count, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!values) \
+            return NULL; \
+\
+        struct SNAME *_tree_ = CMC_(PFX, _impl_new)(count, f_val, alloc); \
+\
+        if (!_tree_) \
+            return NULL; \
+\
+        CMC_(PFX, _impl_build)(_tree_, values, 1, 0, count); \
+\
+        CMC_CALLBACKS_ASSIGN(_tree_, callbacks); \
+\
+        return _tree_; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _tree_) \
+    { \
+        _tree_->alloc->free(_tree_->tree); \
+        _tree_->alloc->free(_tree_->lazy); \
+        _tree_->alloc->free(_tree_->pending); \
+        _tree_->alloc->free(_tree_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _tree_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _tree_->alloc = &cmc_alloc_node_default; \
+        else \
+            _tree_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_tree_, callbacks); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _set)(struct SNAME * _tree_, size_t index, V value) \
+    { \
+        if (index >= _tree_->count) \
+        { \
+            _tree_->flag = CMC_FLAG_RANGE; \
+            return false; \
+        } \
+\
+        CMC_(PFX, _impl_set)(_tree_, 1, 0, _tree_->count, index, value); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, update); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _update)(struct SNAME * _tree_, size_t from, size_t to, V update) \
+    { \
+        if (!_tree_->f_val->apply || from > to) \
+        { \
+            _tree_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        if (to >= _tree_->count) \
+        { \
+            _tree_->flag = CMC_FLAG_RANGE; \
+            return false; \
+        } \
+\
+        CMC_(PFX, _impl_update)(_tree_, 1, 0, _tree_->count, from, to + 1, update); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, update); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _tree_, size_t index) \
+    { \
+        if (index >= _tree_->count) \
+        { \
+            _tree_->flag = CMC_FLAG_RANGE; \
+            return (V){ 0 }; \
+        } \
+\
+        V result = CMC_(PFX, _impl_query)(_tree_, 1, 0, _tree_->count, index, index + 1); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, read); \
+\
+        return result; \
+    } \
+\
+    V CMC_(PFX, _query)(struct SNAME * _tree_, size_t from, size_t to) \
+    { \
+        if (from > to) \
+        { \
+            _tree_->flag = CMC_FLAG_INVALID; \
+            return (V){ 0 }; \
+        } \
+\
+        if (to >= _tree_->count) \
+        { \
+            _tree_->flag = CMC_FLAG_RANGE; \
+            return (V){ 0 }; \
+        } \
+\
+        V result = CMC_(PFX, _impl_query)(_tree_, 1, 0, _tree_->count, from, to + 1); \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_tree_, read); \
+\
+        return result; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _tree_) \
+    { \
+        return _tree_->count; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _tree_) \
+    { \
+        return _tree_->flag; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _tree_) \
+    { \
+        struct SNAME *result = CMC_(PFX, _impl_new)(_tree_->count, _tree_->f_val, _tree_->alloc); \
+\
+        if (!result) \
+        { \
+            _tree_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _tree_->callbacks); \
+\
+        if (_tree_->f_val->cpy) \
+        { \
+            for (size_t i = 0; i < _tree_->nodes; i++) \
+                result->tree[i] = _tree_->f_val->cpy(_tree_->tree[i]); \
+        } \
+        else \
+            memcpy(result->tree, _tree_->tree, sizeof(V) * _tree_->nodes); \
+\
+        /* Pending updates are copied as they are */ \
+        if (_tree_->lazy) \
+        { \
+            memcpy(result->lazy, _tree_->lazy, sizeof(V) * _tree_->nodes); \
+            memcpy(result->pending, _tree_->pending, sizeof(bool) * _tree_->nodes); \
+        } \
+\
+        _tree_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _tree1_, struct SNAME * _tree2_) \
+    { \
+        _tree1_->flag = CMC_FLAG_OK; \
+        _tree2_->flag = CMC_FLAG_OK; \
+\
+        if (_tree1_->count != _tree2_->count) \
+            return false; \
+\
+        /* Pending updates make it so that the nodes can't be compared */ \
+        /* directly */ \
+        for (size_t i = 0; i < _tree1_->count; i++) \
+        { \
+            V value1 = CMC_(PFX, _impl_query)(_tree1_, 1, 0, _tree1_->count, i, i + 1); \
+            V value2 = CMC_(PFX, _impl_query)(_tree2_, 1, 0, _tree2_->count, i, i + 1); \
+\
+            if (_tree1_->f_val->cmp(value1, value2) != 0) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    static struct SNAME *CMC_(PFX, _impl_new)(size_t count, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                              struct CMC_ALLOC_NODE_NAME * alloc) \
+    { \
+        if (count == 0 || !f_val || !f_val->combine) \
+            return NULL; \
+\
+        /* Twice the smallest power of two that fits every value is enough */ \
+        size_t nodes = 1; \
+\
+        while (nodes < count) \
+        { \
+            /* Prevent integer overflow */ \
+            if (nodes > SIZE_MAX / 4) \
+                return NULL; \
+\
+            nodes *= 2; \
+        } \
+\
+        nodes *= 2; \
+\
+        /* Prevent integer overflow */ \
+        if (nodes > SIZE_MAX / sizeof(V)) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_tree_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_tree_) \
+            return NULL; \
+\
+        _tree_->tree = alloc->malloc(sizeof(V) * nodes); \
+        _tree_->lazy = NULL; \
+        _tree_->pending = NULL; \
+\
+        if (!_tree_->tree) \
+        { \
+            alloc->free(_tree_); \
+            return NULL; \
+        } \
+\
+        /* Range updates are only possible with an apply function */ \
+        if (f_val->apply) \
+        { \
+            _tree_->lazy = alloc->malloc(sizeof(V) * nodes); \
+            _tree_->pending = alloc->calloc(nodes, sizeof(bool)); \
+\
+            if (!_tree_->lazy || !_tree_->pending) \
+            { \
+                alloc->free(_tree_->tree); \
+                alloc->free(_tree_->lazy); \
+                alloc->free(_tree_->pending); \
+                alloc->free(_tree_); \
+                return NULL; \
+            } \
+        } \
+\
+        _tree_->nodes = nodes; \
+        _tree_->count = count; \
+        _tree_->flag = CMC_FLAG_OK; \
+        _tree_->f_val = f_val; \
+        _tree_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_tree_, NULL); \
+\
+        return _tree_; \
+    } \
+\
+    static void CMC_(PFX, _impl_build)(struct SNAME * _tree_, V * values, size_t node, size_t lo, size_t hi) \
+    { \
+        if (hi - lo == 1) \
+        { \
+            _tree_->tree[node] = values[lo]; \
+            return; \
+        } \
+\
+        size_t mid = lo + (hi - lo) / 2; \
+\
+        CMC_(PFX, _impl_build)(_tree_, values, node * 2, lo, mid); \
+        CMC_(PFX, _impl_build)(_tree_, values, node * 2 + 1, mid, hi); \
+\
+        _tree_->tree[node] = _tree_->f_val->combine(_tree_->tree[node * 2], _tree_->tree[node * 2 + 1]); \
+    } \
+\
+    static void CMC_(PFX, _impl_apply)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi, V update) \
+    { \
+        _tree_->tree[node] = _tree_->f_val->apply(_tree_->tree[node], update, hi - lo); \
+\
+        /* Leaves have no children to pass the update to */ \
+        if (hi - lo == 1) \
+            return; \
+\
+        /* An update on top of another is the same as applying the newer */ \
+        /* one to the older one */ \
+        if (_tree_->pending[node]) \
+            _tree_->lazy[node] = _tree_->f_val->apply(_tree_->lazy[node], update, 1); \
+        else \
+            _tree_->lazy[node] = update; \
+\
+        _tree_->pending[node] = true; \
+    } \
+\
+    static void CMC_(PFX, _impl_push)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi) \
+    { \
+        if (!_tree_->pending || !_tree_->pending[node]) \
+            return; \
+\
+        size_t mid = lo + (hi - lo) / 2; \
+\
+        CMC_(PFX, _impl_apply)(_tree_, node * 2, lo, mid, _tree_->lazy[node]); \
+        CMC_(PFX, _impl_apply)(_tree_, node * 2 + 1, mid, hi, _tree_->lazy[node]); \
+\
+        _tree_->pending[node] = false; \
+    } \
+\
+    static void CMC_(PFX, _impl_set)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi, size_t index, \
+                                     V value) \
+    { \
+        if (hi - lo == 1) \
+        { \
+            _tree_->tree[node] = value; \
+            return; \
+        } \
+\
+        CMC_(PFX, _impl_push)(_tree_, node, lo, hi); \
+\
+        size_t mid = lo + (hi - lo) / 2; \
+\
+        if (index < mid) \
+            CMC_(PFX, _impl_set)(_tree_, node * 2, lo, mid, index, value); \
+        else \
+            CMC_(PFX, _impl_set)(_tree_, node * 2 + 1, mid, hi, index, value); \
+\
+        _tree_->tree[node] = _tree_->f_val->combine(_tree_->tree[node * 2], _tree_->tree[node * 2 + 1]); \
+    } \
+\
+    static void CMC_(PFX, _impl_update)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi, size_t from, \
+                                        size_t to, V update) \
+    { \
+        if (from <= lo && hi <= to) \
+        { \
+            CMC_(PFX, _impl_apply)(_tree_, node, lo, hi, update); \
+            return; \
+        } \
+\
+        CMC_(PFX, _impl_push)(_tree_, node, lo, hi); \
+\
+        size_t mid = lo + (hi - lo) / 2; \
+\
+        if (from < mid) \
+            CMC_(PFX, _impl_update)(_tree_, node * 2, lo, mid, from, to, update); \
+        if (to > mid) \
+            CMC_(PFX, _impl_update)(_tree_, node * 2 + 1, mid, hi, from, to, update); \
+\
+        _tree_->tree[node] = _tree_->f_val->combine(_tree_->tree[node * 2], _tree_->tree[node * 2 + 1]); \
+    } \
+\
+    static V CMC_(PFX, _impl_query)(struct SNAME * _tree_, size_t node, size_t lo, size_t hi, size_t from, \
+                                    size_t to) \
+    { \
+        if (from <= lo && hi <= to) \
+            return _tree_->tree[node]; \
+\
+        CMC_(PFX, _impl_push)(_tree_, node, lo, hi); \
+\
+        size_t mid = lo + (hi - lo) / 2; \
+\
+        if (to <= mid) \
+            return CMC_(PFX, _impl_query)(_tree_, node * 2, lo, mid, from, to); \
+        if (from >= mid) \
+            return CMC_(PFX, _impl_query)(_tree_, node * 2 + 1, mid, hi, from, to); \
+\
+        V left = CMC_(PFX, _impl_query)(_tree_, node * 2, lo, mid, from, to); \
+        V right = CMC_(PFX, _impl_query)(_tree_, node * 2 + 1, mid, hi, from, to); \
+\
+        return _tree_->f_val->combine(left, right); \
+    }
+
+#endif /* CMC_CMC_SEGMENTTREE_H */
@@ -0,0 +1,686 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_slotmap.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * SlotMap
+ *
+ * A SlotMap stores values in a contiguous array and gives back a handle for
+ * each inserted value. A handle stays valid until its value is removed, no
+ * matter how many other values are inserted or removed, and a handle to a
+ * removed value is detected instead of reading whatever took its place.
+ *
+ * Values are kept packed in a dense array so that iterating over them is as
+ * fast as iterating over a List. A separate array of slots maps the index
+ * part of a handle to the position of its value in the dense array, along
+ * with a generation that is bumped every time the slot is freed. Free slots
+ * are reused through a free list. Insert, remove and lookup are all O(1).
+ */
+
+#ifndef CMC_CMC_SLOTMAP_H
+#define CMC_CMC_SLOTMAP_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/* A handle is a 64-bit integer made of a slot index and its generation */
+#define CMC_SLOTMAP_HANDLE(index, generation) (((uint64_t)(generation) << 32) | (uint64_t)(index))
+#define CMC_SLOTMAP_INDEX(handle) ((uint32_t)((handle)&UINT32_MAX))
+#define CMC_SLOTMAP_GENERATION(handle) ((uint32_t)((handle) >> 32))
+
+/* A handle that never refers to a value */
+#define CMC_SLOTMAP_NULL ((uint64_t)0)
+
+/* End of the free list of slots */
+#define CMC_SLOTMAP_END UINT32_MAX
+
+/**
+ * Core SlotMap implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_SLOTMAP_CORE(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_CMC_SLOTMAP_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_SLOTMAP_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_SLOTMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SLOTMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_SLOTMAP_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_SLOTMAP_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_SLOTMAP_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    struct CMC_DEF_ENTRY(CMC_PARAM_SNAME(PARAMS)); \
+    CMC_CMC_SLOTMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_SLOTMAP_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_SLOTMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SLOTMAP_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_SLOTMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SLOTMAP_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_SLOTMAP_CORE_HEADER(PARAMS) \
+    CMC_CMC_SLOTMAP_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_SLOTMAP_CORE_SOURCE(PARAMS) \
+    CMC_CMC_SLOTMAP_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SLOTMAP_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* SlotMap Structure */ \
+    struct SNAME \
+    { \
+        /* Values packed at the front */ \
+        V *buffer; \
+\
+        /* Slot of each value in the buffer */ \
+        uint32_t *owner; \
+\
+        /* Array of slots */ \
+        struct CMC_DEF_ENTRY(SNAME) * slots; \
+\
+        /* Capacity of the buffer and of the slots */ \
+        size_t capacity; \
+\
+        /* Current amount of elements */ \
+        size_t count; \
+\
+        /* How many slots have been used at least once */ \
+        size_t used; \
+\
+        /* First free slot or CMC_SLOTMAP_END */ \
+        uint32_t free; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    }; \
+\
+    struct CMC_DEF_ENTRY(SNAME) \
+    { \
+        /* Position in the buffer if the slot is taken, otherwise the next */ \
+        /* free slot */ \
+        uint32_t index; \
+\
+        /* Odd if the slot is taken; bumped every time it is taken or freed */ \
+        uint32_t generation; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SLOTMAP_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _clear)(struct SNAME * _map_); \
+    void CMC_(PFX, _free)(struct SNAME * _map_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _insert)(struct SNAME * _map_, V value, uint64_t * handle); \
+    bool CMC_(PFX, _update)(struct SNAME * _map_, uint64_t handle, V new_value, V * old_value); \
+    bool CMC_(PFX, _remove)(struct SNAME * _map_, uint64_t handle, V * out_value); \
+    /* Element Access */ \
+    V CMC_(PFX, _get)(struct SNAME * _map_, uint64_t handle); \
+    V *CMC_(PFX, _get_ref)(struct SNAME * _map_, uint64_t handle); \
+    uint64_t CMC_(PFX, _handle_at)(struct SNAME * _map_, size_t index); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, uint64_t handle); \
+    bool CMC_(PFX, _empty)(struct SNAME * _map_); \
+    bool CMC_(PFX, _full)(struct SNAME * _map_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _map_); \
+    size_t CMC_(PFX, _capacity)(struct SNAME * _map_); \
+    int CMC_(PFX, _flag)(struct SNAME * _map_); \
+    /* Collection Utility */ \
+    bool CMC_(PFX, _resize)(struct SNAME * _map_, size_t capacity); \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SLOTMAP_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_slot)(struct SNAME * _map_, uint64_t handle); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(capacity, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        /* Slot indexes are 32 bits and CMC_SLOTMAP_END is reserved */ \
+        if (capacity == 0 || capacity >= CMC_SLOTMAP_END) \
+            return NULL; \
+\
+        if (!f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_map_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_map_) \
+            return NULL; \
+\
+        _map_->buffer = alloc->malloc(sizeof(V) * capacity); \
+        _map_->owner = alloc->malloc(sizeof(uint32_t) * capacity); \
+        _map_->slots = alloc->malloc(sizeof(struct CMC_DEF_ENTRY(SNAME)) * capacity); \
+\
+        if (!_map_->buffer || !_map_->owner || !_map_->slots) \
+        { \
+            alloc->free(_map_->buffer); \
+            alloc->free(_map_->owner); \
+            alloc->free(_map_->slots); \
+            alloc->free(_map_); \
+            return NULL; \
+        } \
+\
+        _map_->capacity = capacity; \
+        _map_->count = 0; \
+        _map_->used = 0; \
+        _map_->free = CMC_SLOTMAP_END; \
+        _map_->flag = CMC_FLAG_OK; \
+        _map_->f_val = f_val; \
+        _map_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        return _map_; \
+    } \
+\
+    void CMC_(PFX, _clear)(struct SNAME * _map_) \
+    { \
+        /* Every taken slot is freed so that its handles become stale */ \
+        for (size_t i = 0; i < _map_->count; i++) \
+        { \
+            uint32_t s = _map_->owner[i]; \
+            struct CMC_DEF_ENTRY(SNAME) *slot = &(_map_->slots[s]); \
+\
+            if (_map_->f_val->free) \
+                _map_->f_val->free(_map_->buffer[i]); \
+\
+            slot->generation++; \
+\
+            /* Retire the slot if its generation wrapped around */ \
+            if (slot->generation != 0) \
+            { \
+                slot->index = _map_->free; \
+                _map_->free = s; \
+            } \
+        } \
+\
+        _map_->count = 0; \
+        _map_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _map_) \
+    { \
+        if (_map_->f_val->free) \
+        { \
+            for (size_t i = 0; i < _map_->count; i++) \
+                _map_->f_val->free(_map_->buffer[i]); \
+        } \
+\
+        _map_->alloc->free(_map_->buffer); \
+        _map_->alloc->free(_map_->owner); \
+        _map_->alloc->free(_map_->slots); \
+        _map_->alloc->free(_map_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _map_->alloc = &cmc_alloc_node_default; \
+        else \
+            _map_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        _map_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _insert)(struct SNAME * _map_, V value, uint64_t * handle) \
+    { \
+        if (_map_->free == CMC_SLOTMAP_END && _map_->used == _map_->capacity) \
+        { \
+            size_t capacity = _map_->capacity * 2; \
+\
+            if (capacity >= CMC_SLOTMAP_END) \
+                capacity = CMC_SLOTMAP_END - 1; \
+\
+            /* Every possible slot is taken */ \
+            if (capacity == _map_->capacity) \
+            { \
+                _map_->flag = CMC_FLAG_ERROR; \
+                return false; \
+            } \
+\
+            if (!CMC_(PFX, _resize)(_map_, capacity)) \
+                return false; \
+        } \
+\
+        uint32_t s; \
+\
+        if (_map_->free != CMC_SLOTMAP_END) \
+        { \
+            s = _map_->free; \
+            _map_->free = _map_->slots[s].index; \
+        } \
+        else \
+        { \
+            s = (uint32_t)_map_->used++; \
+            _map_->slots[s].generation = 0; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *slot = &(_map_->slots[s]); \
+\
+        slot->index = (uint32_t)_map_->count; \
+        slot->generation++; \
+\
+        _map_->buffer[_map_->count] = value; \
+        _map_->owner[_map_->count] = s; \
+\
+        if (handle) \
+            *handle = CMC_SLOTMAP_HANDLE(s, slot->generation); \
+\
+        _map_->count++; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _update)(struct SNAME * _map_, uint64_t handle, V new_value, V * old_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *slot = CMC_(PFX, _impl_get_slot)(_map_, handle); \
+\
+        if (!slot) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (old_value) \
+            *old_value = _map_->buffer[slot->index]; \
+\
+        _map_->buffer[slot->index] = new_value; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, update); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _remove)(struct SNAME * _map_, uint64_t handle, V * out_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *slot = CMC_(PFX, _impl_get_slot)(_map_, handle); \
+\
+        if (!slot) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        uint32_t index = slot->index; \
+        size_t last = _map_->count - 1; \
+\
+        if (out_value) \
+            *out_value = _map_->buffer[index]; \
+\
+        /* The last value is moved into the hole to keep the buffer packed */ \
+        _map_->buffer[index] = _map_->buffer[last]; \
+        _map_->owner[index] = _map_->owner[last]; \
+        _map_->slots[_map_->owner[index]].index = index; \
+\
+        slot->generation++; \
+\
+        /* Retire the slot if its generation wrapped around */ \
+        if (slot->generation != 0) \
+        { \
+            slot->index = _map_->free; \
+            _map_->free = CMC_SLOTMAP_INDEX(handle); \
+        } \
+\
+        _map_->count--; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, delete); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _map_, uint64_t handle) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *slot = CMC_(PFX, _impl_get_slot)(_map_, handle); \
+\
+        if (!slot) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return (V){ 0 }; \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return _map_->buffer[slot->index]; \
+    } \
+\
+    /* The reference is only valid until the next insert or remove */ \
+    V *CMC_(PFX, _get_ref)(struct SNAME * _map_, uint64_t handle) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return NULL; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *slot = CMC_(PFX, _impl_get_slot)(_map_, handle); \
+\
+        if (!slot) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return NULL; \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return &(_map_->buffer[slot->index]); \
+    } \
+\
+    /* Handle of the value at the given position of the buffer */ \
+    uint64_t CMC_(PFX, _handle_at)(struct SNAME * _map_, size_t index) \
+    { \
+        if (index >= _map_->count) \
+        { \
+            _map_->flag = CMC_FLAG_RANGE; \
+            return CMC_SLOTMAP_NULL; \
+        } \
+\
+        uint32_t s = _map_->owner[index]; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        return CMC_SLOTMAP_HANDLE(s, _map_->slots[s].generation); \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, uint64_t handle) \
+    { \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        bool result = CMC_(PFX, _impl_get_slot)(_map_, handle) != NULL; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _map_) \
+    { \
+        return _map_->count == 0; \
+    } \
+\
+    bool CMC_(PFX, _full)(struct SNAME * _map_) \
+    { \
+        return _map_->count >= _map_->capacity; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _map_) \
+    { \
+        return _map_->count; \
+    } \
+\
+    size_t CMC_(PFX, _capacity)(struct SNAME * _map_) \
+    { \
+        return _map_->capacity; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _map_) \
+    { \
+        return _map_->flag; \
+    } \
+\
+    bool CMC_(PFX, _resize)(struct SNAME * _map_, size_t capacity) \
+    { \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        if (_map_->capacity == capacity) \
+            goto success; \
+\
+        /* Slots that were used once can't be dropped or their handles */ \
+        /* could become valid again */ \
+        if (capacity < _map_->used || capacity == 0) \
+        { \
+            _map_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        if (capacity >= CMC_SLOTMAP_END) \
+        { \
+            _map_->flag = CMC_FLAG_ERROR; \
+            return false; \
+        } \
+\
+        V *new_buffer = _map_->alloc->realloc(_map_->buffer, sizeof(V) * capacity); \
+\
+        if (!new_buffer) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        _map_->buffer = new_buffer; \
+\
+        uint32_t *new_owner = _map_->alloc->realloc(_map_->owner, sizeof(uint32_t) * capacity); \
+\
+        if (!new_owner) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        _map_->owner = new_owner; \
+\
+        struct CMC_DEF_ENTRY(SNAME) *new_slots = \
+            _map_->alloc->realloc(_map_->slots, sizeof(struct CMC_DEF_ENTRY(SNAME)) * capacity); \
+\
+        if (!new_slots) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        _map_->slots = new_slots; \
+        _map_->capacity = capacity; \
+\
+    success: \
+\
+        CMC_CALLBACKS_CALL(_map_, resize); \
+\
+        return true; \
+    } \
+\
+    /* Handles of the original are also valid for the copy */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_) \
+    { \
+        struct SNAME *result = CMC_(PFX, _new_custom)(_map_->capacity, _map_->f_val, _map_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _map_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _map_->callbacks); \
+\
+        if (_map_->f_val->cpy) \
+        { \
+            for (size_t i = 0; i < _map_->count; i++) \
+                result->buffer[i] = _map_->f_val->cpy(_map_->buffer[i]); \
+        } \
+        else \
+            memcpy(result->buffer, _map_->buffer, sizeof(V) * _map_->count); \
+\
+        memcpy(result->owner, _map_->owner, sizeof(uint32_t) * _map_->count); \
+        memcpy(result->slots, _map_->slots, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _map_->used); \
+\
+        result->count = _map_->count; \
+        result->used = _map_->used; \
+        result->free = _map_->free; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    /* Two SlotMaps are equal if every handle of one refers to an equal */ \
+    /* value in the other */ \
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_) \
+    { \
+        _map1_->flag = CMC_FLAG_OK; \
+        _map2_->flag = CMC_FLAG_OK; \
+\
+        if (_map1_->count != _map2_->count) \
+            return false; \
+\
+        for (size_t i = 0; i < _map1_->count; i++) \
+        { \
+            uint32_t s = _map1_->owner[i]; \
+            uint64_t handle = CMC_SLOTMAP_HANDLE(s, _map1_->slots[s].generation); \
+\
+            struct CMC_DEF_ENTRY(SNAME) *slot = CMC_(PFX, _impl_get_slot)(_map2_, handle); \
+\
+            if (!slot) \
+                return false; \
+\
+            if (_map1_->f_val->cmp(_map1_->buffer[i], _map2_->buffer[slot->index]) != 0) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_slot)(struct SNAME * _map_, uint64_t handle) \
+    { \
+        uint32_t s = CMC_SLOTMAP_INDEX(handle); \
+        uint32_t generation = CMC_SLOTMAP_GENERATION(handle); \
+\
+        /* Even generations belong to free slots */ \
+        if (s >= _map_->used || generation % 2 == 0) \
+            return NULL; \
+\
+        struct CMC_DEF_ENTRY(SNAME) *slot = &(_map_->slots[s]); \
+\
+        if (slot->generation != generation) \
+            return NULL; \
+\
+        return slot; \
+    }
+
+#endif /* CMC_CMC_SLOTMAP_H */
@@ -159,6 +159,8 @@
     /* Collection Input and Output */ \
     bool CMC_(PFX, _insert)(struct SNAME * _list_, V value); \
     bool CMC_(PFX, _remove)(struct SNAME * _list_, size_t index); \
+    size_t CMC_(PFX, _remove_range)(struct SNAME * _list_, V low, V high); \
+    size_t CMC_(PFX, _remove_below)(struct SNAME * _list_, V value); \
     /* Element Access */ \
     V CMC_(PFX, _max)(struct SNAME * _list_); \
     V CMC_(PFX, _min)(struct SNAME * _list_); \
@@ -185,6 +187,8 @@
     /* Implementation Detail Functions */ \
     static size_t CMC_(PFX, _impl_binary_search_first)(struct SNAME * _list_, V value); \
     static size_t CMC_(PFX, _impl_binary_search_last)(struct SNAME * _list_, V value); \
+    static size_t CMC_(PFX, _impl_bound)(struct SNAME * _list_, V value, bool after); \
+    static size_t CMC_(PFX, _impl_remove_span)(struct SNAME * _list_, size_t from, size_t to); \
     void CMC_(PFX, _impl_sort_quicksort)(V * array, int (*cmp)(V, V), size_t low, size_t high); \
     void CMC_(PFX, _impl_sort_insertion)(V * array, int (*cmp)(V, V), size_t low, size_t high); \
 \
@@ -311,6 +315,45 @@
 \
         return true; \
     } \
+\
+    /* Removes every element from low to high, both included, returning how */ \
+    /* many there were. They are freed like in _clear() */ \
+    size_t CMC_(PFX, _remove_range)(struct SNAME * _list_, V low, V high) \
+    { \
+        if (CMC_(PFX, _empty)(_list_)) \
+        { \
+            _list_->flag = CMC_FLAG_EMPTY; \
+            return 0; \
+        } \
+\
+        if (_list_->f_val->cmp(low, high) > 0) \
+        { \
+            _list_->flag = CMC_FLAG_INVALID; \
+            return 0; \
+        } \
+\
+        CMC_(PFX, _sort)(_list_); \
+\
+        size_t from = CMC_(PFX, _impl_bound)(_list_, low, false); \
+        size_t to = CMC_(PFX, _impl_bound)(_list_, high, true); \
+\
+        return CMC_(PFX, _impl_remove_span)(_list_, from, to); \
+    } \
+\
+    /* Removes every element smaller than value, returning how many there */ \
+    /* were */ \
+    size_t CMC_(PFX, _remove_below)(struct SNAME * _list_, V value) \
+    { \
+        if (CMC_(PFX, _empty)(_list_)) \
+        { \
+            _list_->flag = CMC_FLAG_EMPTY; \
+            return 0; \
+        } \
+\
+        CMC_(PFX, _sort)(_list_); \
+\
+        return CMC_(PFX, _impl_remove_span)(_list_, 0, CMC_(PFX, _impl_bound)(_list_, value, false)); \
+    } \
 \
     V CMC_(PFX, _max)(struct SNAME * _list_) \
     { \
@@ -563,6 +606,53 @@
         /* Not found */ \
         return _list_->count; \
     } \
+\
+    /* Index of the first element that is not smaller than value, or that */ \
+    /* is greater than it if after is true */ \
+    static size_t CMC_(PFX, _impl_bound)(struct SNAME * _list_, V value, bool after) \
+    { \
+        size_t L = 0; \
+        size_t R = _list_->count; \
+\
+        while (L < R) \
+        { \
+            size_t M = L + (R - L) / 2; \
+            int cmp = _list_->f_val->cmp(_list_->buffer[M], value); \
+\
+            if (cmp < 0 || (after && cmp == 0)) \
+                L = M + 1; \
+            else \
+                R = M; \
+        } \
+\
+        return L; \
+    } \
+\
+    /* Frees the elements in [from, to) and closes the gap with a single */ \
+    /* memmove */ \
+    static size_t CMC_(PFX, _impl_remove_span)(struct SNAME * _list_, size_t from, size_t to) \
+    { \
+        size_t removed = to - from; \
+\
+        if (_list_->f_val->free) \
+        { \
+            for (size_t i = from; i < to; i++) \
+                _list_->f_val->free(_list_->buffer[i]); \
+        } \
+\
+        memmove(_list_->buffer + from, _list_->buffer + to, (_list_->count - to) * sizeof(V)); \
+        memset(_list_->buffer + _list_->count - removed, 0, removed * sizeof(V)); \
+\
+        _list_->count -= removed; \
+        _list_->flag = CMC_FLAG_OK; \
+\
+        if (removed > 0) \
+        { \
+            CMC_CALLBACKS_CALL(_list_, delete); \
+        } \
+\
+        return removed; \
+    } \
 \
     /* Characteristics of this quicksort implementation: */ \
     /* - Hybrid: uses insertion sort for small arrays */ \
@@ -605,8 +695,9 @@
                 /* Tail recursion */ \
                 if (pindex - low < high - pindex) \
                 { \
-                    CMC_(PFX, _impl_sort_quicksort) \
-                    (array, cmp, low, pindex - 1); \
+                    /* The pivot can be the smallest element at index 0 */ \
+                    if (pindex > low) \
+                        CMC_(PFX, _impl_sort_quicksort)(array, cmp, low, pindex - 1); \
 \
                     low = pindex + 1; \
                 } \
@@ -0,0 +1,950 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_sortedmap.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * SortedMap
+ *
+ * A SortedMap is a Map that keeps its keys sorted in a flat array, with the
+ * values in a parallel array. Lookups are a binary search and iterating in
+ * order is a walk over contiguous memory, so it is much more compact and
+ * cache friendly than a TreeMap. It is meant for data that is built once and
+ * read many times.
+ *
+ * Inserting in the middle of the array is O(n), so pairs can also be pushed
+ * to the end of the array and are only sorted and merged into the rest when
+ * the map is read, like the SortedList does. When a key is pushed more than
+ * once or is already in the map, the last pushed pair wins.
+ */
+
+#ifndef CMC_CMC_SORTEDMAP_H
+#define CMC_CMC_SORTEDMAP_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/**
+ * Core SortedMap implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_SORTEDMAP_CORE(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_CMC_SORTEDMAP_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_SORTEDMAP_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_SORTEDMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SORTEDMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_SORTEDMAP_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_SORTEDMAP_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_SORTEDMAP_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_CMC_SORTEDMAP_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_SORTEDMAP_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_SORTEDMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SORTEDMAP_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_SORTEDMAP_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SORTEDMAP_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                   CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_SORTEDMAP_CORE_HEADER(PARAMS) \
+    CMC_CMC_SORTEDMAP_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                   CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_SORTEDMAP_CORE_SOURCE(PARAMS) \
+    CMC_CMC_SORTEDMAP_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                   CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SORTEDMAP_CORE_STRUCT_(PFX, SNAME, K, V) \
+\
+    /* SortedMap Structure */ \
+    struct SNAME \
+    { \
+        /* Sorted keys followed by the pending ones */ \
+        K *keys; \
+\
+        /* Values in the same position as their keys */ \
+        V *values; \
+\
+        /* Current arrays capacity */ \
+        size_t capacity; \
+\
+        /* Current amount of sorted pairs */ \
+        size_t count; \
+\
+        /* Pairs pushed after the sorted ones that still need to be merged; */ \
+        /* the map is sorted when this is zero */ \
+        size_t pending; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Key function table */ \
+        struct CMC_DEF_FKEY(SNAME) * f_key; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SORTEDMAP_CORE_HEADER_(PFX, SNAME, K, V) \
+\
+    /* Key struct function table */ \
+    struct CMC_DEF_FKEY(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(K); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(K); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(K); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(K); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(K); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(K); \
+    }; \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FKEY(SNAME) * f_key, \
+                                  struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FKEY(SNAME) * f_key, \
+                                         struct CMC_DEF_FVAL(SNAME) * f_val, struct CMC_ALLOC_NODE_NAME * alloc, \
+                                         struct CMC_CALLBACKS_NAME * callbacks); \
+    struct SNAME *CMC_(PFX, _from_pairs)(K * keys, V * values, size_t count, struct CMC_DEF_FKEY(SNAME) * f_key, \
+                                         struct CMC_DEF_FVAL(SNAME) * f_val); \
+    void CMC_(PFX, _clear)(struct SNAME * _map_); \
+    void CMC_(PFX, _free)(struct SNAME * _map_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value); \
+    bool CMC_(PFX, _push)(struct SNAME * _map_, K key, V value); \
+    bool CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value); \
+    bool CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value); \
+    /* Element Access */ \
+    bool CMC_(PFX, _max)(struct SNAME * _map_, K * key, V * value); \
+    bool CMC_(PFX, _min)(struct SNAME * _map_, K * key, V * value); \
+    V CMC_(PFX, _get)(struct SNAME * _map_, K key); \
+    V *CMC_(PFX, _get_ref)(struct SNAME * _map_, K key); \
+    bool CMC_(PFX, _lower_bound)(struct SNAME * _map_, K key, K * out_key, V * out_value); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, K key); \
+    bool CMC_(PFX, _empty)(struct SNAME * _map_); \
+    bool CMC_(PFX, _full)(struct SNAME * _map_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _map_); \
+    size_t CMC_(PFX, _capacity)(struct SNAME * _map_); \
+    int CMC_(PFX, _flag)(struct SNAME * _map_); \
+    /* Collection Utility */ \
+    bool CMC_(PFX, _merge)(struct SNAME * _map_); \
+    bool CMC_(PFX, _resize)(struct SNAME * _map_, size_t capacity); \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SORTEDMAP_CORE_SOURCE_(PFX, SNAME, K, V) \
+\
+    /* Implementation Detail Functions */ \
+    static size_t CMC_(PFX, _impl_lower_bound)(struct SNAME * _map_, K key); \
+    static size_t CMC_(PFX, _impl_get_index)(struct SNAME * _map_, K key); \
+    static void CMC_(PFX, _impl_sort)(K * keys, V * values, K * tmp_keys, V * tmp_values, size_t count, \
+                                      int (*cmp)(K, K)); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FKEY(SNAME) * f_key, \
+                                  struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(capacity, f_key, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FKEY(SNAME) * f_key, \
+                                         struct CMC_DEF_FVAL(SNAME) * f_val, struct CMC_ALLOC_NODE_NAME * alloc, \
+                                         struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (capacity < 1) \
+            return NULL; \
+\
+        if (!f_key || !f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_map_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_map_) \
+            return NULL; \
+\
+        _map_->keys = alloc->malloc(sizeof(K) * capacity); \
+        _map_->values = alloc->malloc(sizeof(V) * capacity); \
+\
+        if (!_map_->keys || !_map_->values) \
+        { \
+            alloc->free(_map_->keys); \
+            alloc->free(_map_->values); \
+            alloc->free(_map_); \
+            return NULL; \
+        } \
+\
+        _map_->capacity = capacity; \
+        _map_->count = 0; \
+        _map_->pending = 0; \
+        _map_->flag = CMC_FLAG_OK; \
+        _map_->f_key = f_key; \
+        _map_->f_val = f_val; \
+        _map_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        return _map_; \
+    } \
+\
+    /* Builds a map out of count pairs with a single sort */ \
+    struct SNAME *CMC_(PFX, _from_pairs)(K * keys, V * values, size_t count, struct CMC_DEF_FKEY(SNAME) * f_key, \
+                                         struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        struct SNAME *_map_ = CMC_(PFX, _new)(count > 0 ? count : 1, f_key, f_val); \
+\
+        if (!_map_) \
+            return NULL; \
+\
+        memcpy(_map_->keys, keys, sizeof(K) * count); \
+        memcpy(_map_->values, values, sizeof(V) * count); \
+\
+        _map_->pending = count; \
+\
+        if (!CMC_(PFX, _merge)(_map_)) \
+        { \
+            /* Prevent the map from freeing the pairs of the caller */ \
+            _map_->pending = 0; \
+            CMC_(PFX, _free)(_map_); \
+            return NULL; \
+        } \
+\
+        return _map_; \
+    } \
+\
+    void CMC_(PFX, _clear)(struct SNAME * _map_) \
+    { \
+        size_t total = _map_->count + _map_->pending; \
+\
+        for (size_t i = 0; i < total; i++) \
+        { \
+            if (_map_->f_key->free) \
+                _map_->f_key->free(_map_->keys[i]); \
+            if (_map_->f_val->free) \
+                _map_->f_val->free(_map_->values[i]); \
+        } \
+\
+        _map_->count = 0; \
+        _map_->pending = 0; \
+        _map_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _map_) \
+    { \
+        size_t total = _map_->count + _map_->pending; \
+\
+        for (size_t i = 0; i < total; i++) \
+        { \
+            if (_map_->f_key->free) \
+                _map_->f_key->free(_map_->keys[i]); \
+            if (_map_->f_val->free) \
+                _map_->f_val->free(_map_->values[i]); \
+        } \
+\
+        _map_->alloc->free(_map_->keys); \
+        _map_->alloc->free(_map_->values); \
+        _map_->alloc->free(_map_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _map_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _map_->alloc = &cmc_alloc_node_default; \
+        else \
+            _map_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_map_, callbacks); \
+\
+        _map_->flag = CMC_FLAG_OK; \
+    } \
+\
+    /* Inserts the pair right away in its sorted position */ \
+    bool CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value) \
+    { \
+        if (!CMC_(PFX, _merge)(_map_)) \
+            return false; \
+\
+        size_t index = CMC_(PFX, _impl_lower_bound)(_map_, key); \
+\
+        if (index < _map_->count && _map_->f_key->cmp(_map_->keys[index], key) == 0) \
+        { \
+            _map_->flag = CMC_FLAG_DUPLICATE; \
+            return false; \
+        } \
+\
+        if (CMC_(PFX, _full)(_map_)) \
+        { \
+            if (!CMC_(PFX, _resize)(_map_, _map_->capacity * 2)) \
+                return false; \
+        } \
+\
+        size_t after = _map_->count - index; \
+\
+        memmove(_map_->keys + index + 1, _map_->keys + index, sizeof(K) * after); \
+        memmove(_map_->values + index + 1, _map_->values + index, sizeof(V) * after); \
+\
+        _map_->keys[index] = key; \
+        _map_->values[index] = value; \
+\
+        _map_->count++; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, create); \
+\
+        return true; \
+    } \
+\
+    /* Appends the pair to be merged into the map the next time it is read */ \
+    bool CMC_(PFX, _push)(struct SNAME * _map_, K key, V value) \
+    { \
+        if (CMC_(PFX, _full)(_map_)) \
+        { \
+            if (!CMC_(PFX, _resize)(_map_, _map_->capacity * 2)) \
+                return false; \
+        } \
+\
+        size_t index = _map_->count + _map_->pending; \
+\
+        _map_->keys[index] = key; \
+        _map_->values[index] = value; \
+\
+        _map_->pending++; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        size_t index = CMC_(PFX, _impl_get_index)(_map_, key); \
+\
+        if (index == _map_->count) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (old_value) \
+            *old_value = _map_->values[index]; \
+\
+        _map_->values[index] = new_value; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, update); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        size_t index = CMC_(PFX, _impl_get_index)(_map_, key); \
+\
+        if (index == _map_->count) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (out_value) \
+            *out_value = _map_->values[index]; \
+\
+        size_t after = _map_->count - index - 1; \
+\
+        memmove(_map_->keys + index, _map_->keys + index + 1, sizeof(K) * after); \
+        memmove(_map_->values + index, _map_->values + index + 1, sizeof(V) * after); \
+\
+        _map_->count--; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, delete); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _max)(struct SNAME * _map_, K * key, V * value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        if (key) \
+            *key = _map_->keys[_map_->count - 1]; \
+        if (value) \
+            *value = _map_->values[_map_->count - 1]; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _min)(struct SNAME * _map_, K * key, V * value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        if (key) \
+            *key = _map_->keys[0]; \
+        if (value) \
+            *value = _map_->values[0]; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _map_, K key) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        size_t index = CMC_(PFX, _impl_get_index)(_map_, key); \
+\
+        if (index == _map_->count) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return (V){ 0 }; \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return _map_->values[index]; \
+    } \
+\
+    V *CMC_(PFX, _get_ref)(struct SNAME * _map_, K key) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return NULL; \
+        } \
+\
+        size_t index = CMC_(PFX, _impl_get_index)(_map_, key); \
+\
+        if (index == _map_->count) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return NULL; \
+        } \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return &(_map_->values[index]); \
+    } \
+\
+    /* Finds the first pair with a key that is greater than or equal to key */ \
+    bool CMC_(PFX, _lower_bound)(struct SNAME * _map_, K key, K * out_key, V * out_value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        size_t index = CMC_(PFX, _impl_lower_bound)(_map_, key); \
+\
+        if (index == _map_->count) \
+        { \
+            _map_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (out_key) \
+            *out_key = _map_->keys[index]; \
+        if (out_value) \
+            *out_value = _map_->values[index]; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _map_, K key) \
+    { \
+        if (!CMC_(PFX, _merge)(_map_)) \
+            return false; \
+\
+        bool result = CMC_(PFX, _impl_get_index)(_map_, key) < _map_->count; \
+\
+        CMC_CALLBACKS_CALL(_map_, read); \
+\
+        return result; \
+    } \
+\
+    /* Merges the pending pairs first; if that fails the map is reported as */ \
+    /* empty and the flag is set */ \
+    bool CMC_(PFX, _empty)(struct SNAME * _map_) \
+    { \
+        if (!CMC_(PFX, _merge)(_map_)) \
+            return true; \
+\
+        return _map_->count == 0; \
+    } \
+\
+    bool CMC_(PFX, _full)(struct SNAME * _map_) \
+    { \
+        return _map_->count + _map_->pending >= _map_->capacity; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _map_) \
+    { \
+        CMC_(PFX, _merge)(_map_); \
+\
+        return _map_->count; \
+    } \
+\
+    size_t CMC_(PFX, _capacity)(struct SNAME * _map_) \
+    { \
+        return _map_->capacity; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _map_) \
+    { \
+        return _map_->flag; \
+    } \
+\
+    /* Sorts the pending pairs and merges them into the sorted ones */ \
+    bool CMC_(PFX, _merge)(struct SNAME * _map_) \
+    { \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        if (_map_->pending == 0) \
+            return true; \
+\
+        size_t n = _map_->pending; \
+\
+        K *tmp_keys = _map_->alloc->malloc(sizeof(K) * n); \
+        V *tmp_values = _map_->alloc->malloc(sizeof(V) * n); \
+\
+        if (!tmp_keys || !tmp_values) \
+        { \
+            _map_->alloc->free(tmp_keys); \
+            _map_->alloc->free(tmp_values); \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        K *keys = _map_->keys + _map_->count; \
+        V *values = _map_->values + _map_->count; \
+\
+        /* Stable, so the last of the pairs with the same key is kept */ \
+        CMC_(PFX, _impl_sort)(keys, values, tmp_keys, tmp_values, n, _map_->f_key->cmp); \
+\
+        /* Drop the pairs with the same key, keeping the last one, and move */ \
+        /* the rest to the temporary buffer */ \
+        size_t m = 0; \
+        for (size_t i = 0; i < n; i++) \
+        { \
+            if (i + 1 < n && _map_->f_key->cmp(keys[i], keys[i + 1]) == 0) \
+            { \
+                if (_map_->f_key->free) \
+                    _map_->f_key->free(keys[i]); \
+                if (_map_->f_val->free) \
+                    _map_->f_val->free(values[i]); \
+            } \
+            else \
+            { \
+                tmp_keys[m] = keys[i]; \
+                tmp_values[m] = values[i]; \
+                m++; \
+            } \
+        } \
+\
+        /* Merge from the back so that every pair is moved only once */ \
+        size_t a = _map_->count; \
+        size_t b = m; \
+        size_t w = _map_->count + m; \
+\
+        while (b > 0) \
+        { \
+            int c = a > 0 ? _map_->f_key->cmp(_map_->keys[a - 1], tmp_keys[b - 1]) : -1; \
+\
+            if (c > 0) \
+            { \
+                a--; \
+                w--; \
+                _map_->keys[w] = _map_->keys[a]; \
+                _map_->values[w] = _map_->values[a]; \
+            } \
+            else \
+            { \
+                /* The pushed pair replaces the one already in the map */ \
+                if (c == 0) \
+                { \
+                    a--; \
+\
+                    if (_map_->f_key->free) \
+                        _map_->f_key->free(_map_->keys[a]); \
+                    if (_map_->f_val->free) \
+                        _map_->f_val->free(_map_->values[a]); \
+                } \
+\
+                b--; \
+                w--; \
+                _map_->keys[w] = tmp_keys[b]; \
+                _map_->values[w] = tmp_values[b]; \
+            } \
+        } \
+\
+        size_t merged = _map_->count + m - w; \
+\
+        /* Close the gap left by replaced pairs */ \
+        if (w > a) \
+        { \
+            memmove(_map_->keys + a, _map_->keys + w, sizeof(K) * merged); \
+            memmove(_map_->values + a, _map_->values + w, sizeof(V) * merged); \
+        } \
+\
+        _map_->count = a + merged; \
+        _map_->pending = 0; \
+\
+        _map_->alloc->free(tmp_keys); \
+        _map_->alloc->free(tmp_values); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _resize)(struct SNAME * _map_, size_t capacity) \
+    { \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        if (_map_->capacity == capacity) \
+            goto success; \
+\
+        if (capacity < _map_->count + _map_->pending || capacity == 0) \
+        { \
+            _map_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        K *new_keys = _map_->alloc->realloc(_map_->keys, sizeof(K) * capacity); \
+\
+        if (!new_keys) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        _map_->keys = new_keys; \
+\
+        V *new_values = _map_->alloc->realloc(_map_->values, sizeof(V) * capacity); \
+\
+        if (!new_values) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        _map_->values = new_values; \
+        _map_->capacity = capacity; \
+\
+    success: \
+\
+        CMC_CALLBACKS_CALL(_map_, resize); \
+\
+        return true; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _map_) \
+    { \
+        if (!CMC_(PFX, _merge)(_map_)) \
+            return NULL; \
+\
+        struct SNAME *result = \
+            CMC_(PFX, _new_custom)(_map_->capacity, _map_->f_key, _map_->f_val, _map_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _map_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _map_->callbacks); \
+\
+        if (_map_->f_key->cpy) \
+        { \
+            for (size_t i = 0; i < _map_->count; i++) \
+                result->keys[i] = _map_->f_key->cpy(_map_->keys[i]); \
+        } \
+        else \
+            memcpy(result->keys, _map_->keys, sizeof(K) * _map_->count); \
+\
+        if (_map_->f_val->cpy) \
+        { \
+            for (size_t i = 0; i < _map_->count; i++) \
+                result->values[i] = _map_->f_val->cpy(_map_->values[i]); \
+        } \
+        else \
+            memcpy(result->values, _map_->values, sizeof(V) * _map_->count); \
+\
+        result->count = _map_->count; \
+\
+        _map_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _map1_, struct SNAME * _map2_) \
+    { \
+        if (CMC_(PFX, _count)(_map1_) != CMC_(PFX, _count)(_map2_)) \
+            return false; \
+\
+        for (size_t i = 0; i < _map1_->count; i++) \
+        { \
+            if (_map1_->f_key->cmp(_map1_->keys[i], _map2_->keys[i]) != 0) \
+                return false; \
+\
+            if (_map1_->f_val->cmp(_map1_->values[i], _map2_->values[i]) != 0) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    static size_t CMC_(PFX, _impl_lower_bound)(struct SNAME * _map_, K key) \
+    { \
+        size_t L = 0; \
+        size_t R = _map_->count; \
+\
+        while (L < R) \
+        { \
+            size_t M = L + (R - L) / 2; \
+\
+            if (_map_->f_key->cmp(_map_->keys[M], key) < 0) \
+                L = M + 1; \
+            else \
+                R = M; \
+        } \
+\
+        return L; \
+    } \
+\
+    /* Returns the count if the key is not in the map */ \
+    static size_t CMC_(PFX, _impl_get_index)(struct SNAME * _map_, K key) \
+    { \
+        size_t index = CMC_(PFX, _impl_lower_bound)(_map_, key); \
+\
+        if (index < _map_->count && _map_->f_key->cmp(_map_->keys[index], key) == 0) \
+            return index; \
+\
+        return _map_->count; \
+    } \
+\
+    /* Stable bottom-up merge sort of the pairs, using insertion sort for */ \
+    /* small runs; tmp_keys and tmp_values must have room for count pairs */ \
+    static void CMC_(PFX, _impl_sort)(K * keys, V * values, K * tmp_keys, V * tmp_values, size_t count, \
+                                      int (*cmp)(K, K)) \
+    { \
+        const size_t run = 16; \
+\
+        for (size_t low = 0; low < count; low += run) \
+        { \
+            size_t high = low + run < count ? low + run : count; \
+\
+            for (size_t i = low + 1; i < high; i++) \
+            { \
+                K k = keys[i]; \
+                V v = values[i]; \
+                size_t j = i; \
+\
+                while (j > low && cmp(keys[j - 1], k) > 0) \
+                { \
+                    keys[j] = keys[j - 1]; \
+                    values[j] = values[j - 1]; \
+                    j--; \
+                } \
+\
+                keys[j] = k; \
+                values[j] = v; \
+            } \
+        } \
+\
+        K *src_k = keys; \
+        V *src_v = values; \
+        K *dst_k = tmp_keys; \
+        V *dst_v = tmp_values; \
+\
+        for (size_t width = run; width < count; width *= 2) \
+        { \
+            for (size_t low = 0; low < count; low += 2 * width) \
+            { \
+                size_t mid = low + width < count ? low + width : count; \
+                size_t high = low + 2 * width < count ? low + 2 * width : count; \
+\
+                size_t i = low; \
+                size_t j = mid; \
+                size_t k = low; \
+\
+                while (i < mid && j < high) \
+                { \
+                    /* Ties take from the left run to keep the sort stable */ \
+                    if (cmp(src_k[j], src_k[i]) < 0) \
+                    { \
+                        dst_k[k] = src_k[j]; \
+                        dst_v[k++] = src_v[j++]; \
+                    } \
+                    else \
+                    { \
+                        dst_k[k] = src_k[i]; \
+                        dst_v[k++] = src_v[i++]; \
+                    } \
+                } \
+\
+                while (i < mid) \
+                { \
+                    dst_k[k] = src_k[i]; \
+                    dst_v[k++] = src_v[i++]; \
+                } \
+\
+                while (j < high) \
+                { \
+                    dst_k[k] = src_k[j]; \
+                    dst_v[k++] = src_v[j++]; \
+                } \
+            } \
+\
+            K *swap_k = src_k; \
+            src_k = dst_k; \
+            dst_k = swap_k; \
+\
+            V *swap_v = src_v; \
+            src_v = dst_v; \
+            dst_v = swap_v; \
+        } \
+\
+        if (src_k != keys) \
+        { \
+            memcpy(keys, src_k, sizeof(K) * count); \
+            memcpy(values, src_v, sizeof(V) * count); \
+        } \
+    }
+
+#endif /* CMC_CMC_SORTEDMAP_H */
@@ -0,0 +1,587 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_sparseset.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * SparseSet
+ *
+ * A SparseSet is a Set of unsigned integers that are smaller than its
+ * capacity. It keeps two arrays: a dense one, with every value packed at the
+ * front, and a sparse one, indexed by the value itself, that stores where
+ * that value is in the dense array. A value is in the set if its sparse slot
+ * points to a position in the dense array that holds it back. This makes
+ * insert, remove and contains O(1) without hashing and clear O(1) as the
+ * sparse array is never wiped. Iteration only goes through the dense array,
+ * in no particular order.
+ *
+ * The capacity grows when a value that is too big is inserted, so the memory
+ * used is proportional to the greatest value ever inserted and not to the
+ * amount of values in the set.
+ */
+
+#ifndef CMC_CMC_SPARSESET_H
+#define CMC_CMC_SPARSESET_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/**
+ * Core SparseSet implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_SPARSESET_CORE(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_CMC_SPARSESET_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_SPARSESET_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_SPARSESET_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SPARSESET_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_SPARSESET_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_SPARSESET_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_SPARSESET_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_CMC_SPARSESET_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_SPARSESET_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_SPARSESET_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SPARSESET_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_SPARSESET_CORE_STRUCT(PARAMS) \
+    CMC_CMC_SPARSESET_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_SPARSESET_CORE_HEADER(PARAMS) \
+    CMC_CMC_SPARSESET_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_SPARSESET_CORE_SOURCE(PARAMS) \
+    CMC_CMC_SPARSESET_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SPARSESET_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* SparseSet Structure */ \
+    struct SNAME \
+    { \
+        /* Values of the set packed at the front */ \
+        V *dense; \
+\
+        /* Position of each value in the dense array, indexed by the value */ \
+        size_t *sparse; \
+\
+        /* Values must be smaller than the capacity */ \
+        size_t capacity; \
+\
+        /* Current amount of elements */ \
+        size_t count; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SPARSESET_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _clear)(struct SNAME * _set_); \
+    void CMC_(PFX, _free)(struct SNAME * _set_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _set_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _insert)(struct SNAME * _set_, V value); \
+    bool CMC_(PFX, _remove)(struct SNAME * _set_, V value); \
+    /* Element Access */ \
+    bool CMC_(PFX, _max)(struct SNAME * _set_, V * value); \
+    bool CMC_(PFX, _min)(struct SNAME * _set_, V * value); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _set_, V value); \
+    bool CMC_(PFX, _empty)(struct SNAME * _set_); \
+    bool CMC_(PFX, _full)(struct SNAME * _set_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _set_); \
+    size_t CMC_(PFX, _capacity)(struct SNAME * _set_); \
+    int CMC_(PFX, _flag)(struct SNAME * _set_); \
+    /* Collection Utility */ \
+    bool CMC_(PFX, _resize)(struct SNAME * _set_, size_t capacity); \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _set_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _set1_, struct SNAME * _set2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_SPARSESET_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static bool CMC_(PFX, _impl_contains)(struct SNAME * _set_, V value); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(capacity, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (capacity == 0 || !f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_set_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_set_) \
+            return NULL; \
+\
+        _set_->dense = alloc->malloc(sizeof(V) * capacity); \
+\
+        if (!_set_->dense) \
+        { \
+            alloc->free(_set_); \
+            return NULL; \
+        } \
+\
+        /* Never needs to be wiped again but starts zeroed so that stale */ \
+        /* slots are never uninitialized memory */ \
+        _set_->sparse = alloc->calloc(capacity, sizeof(size_t)); \
+\
+        if (!_set_->sparse) \
+        { \
+            alloc->free(_set_->dense); \
+            alloc->free(_set_); \
+            return NULL; \
+        } \
+\
+        _set_->capacity = capacity; \
+        _set_->count = 0; \
+        _set_->flag = CMC_FLAG_OK; \
+        _set_->f_val = f_val; \
+        _set_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_set_, callbacks); \
+\
+        return _set_; \
+    } \
+\
+    void CMC_(PFX, _clear)(struct SNAME * _set_) \
+    { \
+        if (_set_->f_val->free) \
+        { \
+            for (size_t i = 0; i < _set_->count; i++) \
+                _set_->f_val->free(_set_->dense[i]); \
+        } \
+\
+        /* Every sparse slot now points past the dense array */ \
+        _set_->count = 0; \
+        _set_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _set_) \
+    { \
+        if (_set_->f_val->free) \
+        { \
+            for (size_t i = 0; i < _set_->count; i++) \
+                _set_->f_val->free(_set_->dense[i]); \
+        } \
+\
+        _set_->alloc->free(_set_->dense); \
+        _set_->alloc->free(_set_->sparse); \
+        _set_->alloc->free(_set_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _set_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _set_->alloc = &cmc_alloc_node_default; \
+        else \
+            _set_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_set_, callbacks); \
+\
+        _set_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _insert)(struct SNAME * _set_, V value) \
+    { \
+        size_t index = (size_t)value; \
+\
+        if (index >= _set_->capacity) \
+        { \
+            /* Prevent integer overflow */ \
+            if (index == SIZE_MAX) \
+            { \
+                _set_->flag = CMC_FLAG_INVALID; \
+                return false; \
+            } \
+\
+            size_t capacity = _set_->capacity * 2; \
+\
+            if (capacity <= index) \
+                capacity = index + 1; \
+\
+            if (!CMC_(PFX, _resize)(_set_, capacity)) \
+                return false; \
+        } \
+        else if (CMC_(PFX, _impl_contains)(_set_, value)) \
+        { \
+            _set_->flag = CMC_FLAG_DUPLICATE; \
+            return false; \
+        } \
+\
+        _set_->dense[_set_->count] = value; \
+        _set_->sparse[index] = _set_->count; \
+\
+        _set_->count++; \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _remove)(struct SNAME * _set_, V value) \
+    { \
+        if (CMC_(PFX, _empty)(_set_)) \
+        { \
+            _set_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        if (!CMC_(PFX, _impl_contains)(_set_, value)) \
+        { \
+            _set_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        /* The last value is moved into the hole to keep the array packed */ \
+        size_t index = _set_->sparse[(size_t)value]; \
+        V last = _set_->dense[_set_->count - 1]; \
+\
+        _set_->dense[index] = last; \
+        _set_->sparse[(size_t)last] = index; \
+\
+        _set_->count--; \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, delete); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _max)(struct SNAME * _set_, V * value) \
+    { \
+        if (CMC_(PFX, _empty)(_set_)) \
+        { \
+            _set_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        V max_val = _set_->dense[0]; \
+\
+        for (size_t i = 1; i < _set_->count; i++) \
+        { \
+            if (_set_->f_val->cmp(_set_->dense[i], max_val) > 0) \
+                max_val = _set_->dense[i]; \
+        } \
+\
+        if (value) \
+            *value = max_val; \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _min)(struct SNAME * _set_, V * value) \
+    { \
+        if (CMC_(PFX, _empty)(_set_)) \
+        { \
+            _set_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        V min_val = _set_->dense[0]; \
+\
+        for (size_t i = 1; i < _set_->count; i++) \
+        { \
+            if (_set_->f_val->cmp(_set_->dense[i], min_val) < 0) \
+                min_val = _set_->dense[i]; \
+        } \
+\
+        if (value) \
+            *value = min_val; \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _set_, V value) \
+    { \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        bool result = CMC_(PFX, _impl_contains)(_set_, value); \
+\
+        CMC_CALLBACKS_CALL(_set_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _set_) \
+    { \
+        return _set_->count == 0; \
+    } \
+\
+    bool CMC_(PFX, _full)(struct SNAME * _set_) \
+    { \
+        return _set_->count >= _set_->capacity; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _set_) \
+    { \
+        return _set_->count; \
+    } \
+\
+    size_t CMC_(PFX, _capacity)(struct SNAME * _set_) \
+    { \
+        return _set_->capacity; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _set_) \
+    { \
+        return _set_->flag; \
+    } \
+\
+    bool CMC_(PFX, _resize)(struct SNAME * _set_, size_t capacity) \
+    { \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        if (_set_->capacity == capacity) \
+            goto success; \
+\
+        if (capacity == 0) \
+        { \
+            _set_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        /* Can only shrink if no value is left out of the new capacity */ \
+        if (capacity < _set_->capacity) \
+        { \
+            for (size_t i = 0; i < _set_->count; i++) \
+            { \
+                if ((size_t)_set_->dense[i] >= capacity) \
+                { \
+                    _set_->flag = CMC_FLAG_INVALID; \
+                    return false; \
+                } \
+            } \
+        } \
+\
+        /* Prevent integer overflow */ \
+        if (capacity > SIZE_MAX / sizeof(size_t) || capacity > SIZE_MAX / sizeof(V)) \
+        { \
+            _set_->flag = CMC_FLAG_ERROR; \
+            return false; \
+        } \
+\
+        /* Both arrays must always hold at least capacity elements, so the */ \
+        /* first one to be reallocated is the one that can't be left */ \
+        /* smaller than the capacity if the other one fails */ \
+        if (capacity > _set_->capacity) \
+        { \
+            V *new_dense = _set_->alloc->realloc(_set_->dense, sizeof(V) * capacity); \
+\
+            if (!new_dense) \
+            { \
+                _set_->flag = CMC_FLAG_ALLOC; \
+                return false; \
+            } \
+\
+            _set_->dense = new_dense; \
+\
+            size_t *new_sparse = _set_->alloc->realloc(_set_->sparse, sizeof(size_t) * capacity); \
+\
+            if (!new_sparse) \
+            { \
+                /* The dense array is still valid, only larger than needed */ \
+                _set_->flag = CMC_FLAG_ALLOC; \
+                return false; \
+            } \
+\
+            memset(new_sparse + _set_->capacity, 0, sizeof(size_t) * (capacity - _set_->capacity)); \
+\
+            _set_->sparse = new_sparse; \
+        } \
+        else \
+        { \
+            size_t *new_sparse = _set_->alloc->realloc(_set_->sparse, sizeof(size_t) * capacity); \
+\
+            if (!new_sparse) \
+            { \
+                _set_->flag = CMC_FLAG_ALLOC; \
+                return false; \
+            } \
+\
+            _set_->sparse = new_sparse; \
+\
+            /* If this fails the old dense array is kept, which is still */ \
+            /* valid since every value in it fits in the new capacity */ \
+            V *new_dense = _set_->alloc->realloc(_set_->dense, sizeof(V) * capacity); \
+\
+            if (new_dense) \
+                _set_->dense = new_dense; \
+        } \
+\
+        _set_->capacity = capacity; \
+\
+    success: \
+\
+        CMC_CALLBACKS_CALL(_set_, resize); \
+\
+        return true; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _set_) \
+    { \
+        struct SNAME *result = CMC_(PFX, _new_custom)(_set_->capacity, _set_->f_val, _set_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _set_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _set_->callbacks); \
+\
+        if (_set_->f_val->cpy) \
+        { \
+            for (size_t i = 0; i < _set_->count; i++) \
+                result->dense[i] = _set_->f_val->cpy(_set_->dense[i]); \
+        } \
+        else \
+            memcpy(result->dense, _set_->dense, sizeof(V) * _set_->count); \
+\
+        /* Only the slots of the values in the set are meaningful */ \
+        for (size_t i = 0; i < _set_->count; i++) \
+            result->sparse[(size_t)result->dense[i]] = i; \
+\
+        result->count = _set_->count; \
+\
+        _set_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _equals)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        _set1_->flag = CMC_FLAG_OK; \
+        _set2_->flag = CMC_FLAG_OK; \
+\
+        if (_set1_->count != _set2_->count) \
+            return false; \
+\
+        for (size_t i = 0; i < _set1_->count; i++) \
+        { \
+            if (!CMC_(PFX, _impl_contains)(_set2_, _set1_->dense[i])) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    static bool CMC_(PFX, _impl_contains)(struct SNAME * _set_, V value) \
+    { \
+        size_t index = (size_t)value; \
+\
+        if (index >= _set_->capacity) \
+            return false; \
+\
+        size_t pos = _set_->sparse[index]; \
+\
+        return pos < _set_->count && _set_->dense[pos] == value; \
+    }
+
+#endif /* CMC_CMC_SPARSESET_H */
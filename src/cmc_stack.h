@@ -83,18 +83,18 @@
 
 /* Lowest level API */
 #define CMC_CMC_STACK_CORE_STRUCT(PARAMS) \
-    CMC_CMC_STACK_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+    CMC_CMC_STACK_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SIZE(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
 
 #define CMC_CMC_STACK_CORE_HEADER(PARAMS) \
     CMC_CMC_STACK_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
 
 #define CMC_CMC_STACK_CORE_SOURCE(PARAMS) \
-    CMC_CMC_STACK_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+    CMC_CMC_STACK_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SIZE(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
 
 /* -------------------------------------------------------------------------
  * Struct
  * ------------------------------------------------------------------------- */
-#define CMC_CMC_STACK_CORE_STRUCT_(PFX, SNAME, V) \
+#define CMC_CMC_STACK_CORE_STRUCT_(PFX, SIZE, SNAME, V) \
 \
     /* Stack Structure */ \
     struct SNAME \
@@ -119,6 +119,10 @@
 \
         /* Custom callback functions */ \
         CMC_CALLBACKS_DECL; \
+\
+        /* Inline storage used while the stack fits in SIZE elements */ \
+        /* If SIZE is empty this is a flexible array member that takes no space */ \
+        V inline_buffer[SIZE]; \
     };
 
 /* -------------------------------------------------------------------------
@@ -146,6 +150,9 @@
 \
         /* Priority function */ \
         CMC_DEF_FTAB_PRI(V); \
+\
+        /* Search function for contiguous elements, can be NULL */ \
+        CMC_DEF_FTAB_FIND(V); \
     }; \
 \
     /* Collection Functions */ \
@@ -178,10 +185,10 @@
 /* -------------------------------------------------------------------------
  * Source
  * ------------------------------------------------------------------------- */
-#define CMC_CMC_STACK_CORE_SOURCE_(PFX, SNAME, V) \
+#define CMC_CMC_STACK_CORE_SOURCE_(PFX, SIZE, SNAME, V) \
 \
     /* Implementation Detail Functions */ \
-    /* None */ \
+    static bool CMC_(PFX, _impl_is_inline)(struct SNAME * _stack_); \
 \
     struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val) \
     { \
@@ -206,12 +213,23 @@
         if (!_stack_) \
             return NULL; \
 \
-        _stack_->buffer = alloc->calloc(capacity, sizeof(V)); \
+        if (capacity <= CMC_SIZE_OR_ZERO(SIZE)) \
+        { \
+            /* Small stacks don't need a separate buffer */ \
+            memset(_stack_->inline_buffer, 0, sizeof(V) * CMC_SIZE_OR_ZERO(SIZE)); \
 \
-        if (!_stack_->buffer) \
+            _stack_->buffer = _stack_->inline_buffer; \
+            capacity = CMC_SIZE_OR_ZERO(SIZE); \
+        } \
+        else \
         { \
-            alloc->free(_stack_); \
-            return NULL; \
+            _stack_->buffer = alloc->calloc(capacity, sizeof(V)); \
+\
+            if (!_stack_->buffer) \
+            { \
+                alloc->free(_stack_); \
+                return NULL; \
+            } \
         } \
 \
         _stack_->capacity = capacity; \
@@ -246,7 +264,9 @@
                 _stack_->f_val->free(_stack_->buffer[i]); \
         } \
 \
-        _stack_->alloc->free(_stack_->buffer); \
+        if (!CMC_(PFX, _impl_is_inline)(_stack_)) \
+            _stack_->alloc->free(_stack_->buffer); \
+\
         _stack_->alloc->free(_stack_); \
     } \
 \
@@ -320,12 +340,19 @@
 \
         bool result = false; \
 \
-        for (size_t i = 0; i < _stack_->count; i++) \
+        if (_stack_->f_val->find) \
         { \
-            if (_stack_->f_val->cmp(_stack_->buffer[i], value) == 0) \
+            result = _stack_->f_val->find(_stack_->buffer, _stack_->count, value) < _stack_->count; \
+        } \
+        else \
+        { \
+            for (size_t i = 0; i < _stack_->count; i++) \
             { \
-                result = true; \
-                break; \
+                if (_stack_->f_val->cmp(_stack_->buffer[i], value) == 0) \
+                { \
+                    result = true; \
+                    break; \
+                } \
             } \
         } \
 \
@@ -370,7 +397,33 @@
             return false; \
         } \
 \
-        V *new_buffer = _stack_->alloc->realloc(_stack_->buffer, sizeof(V) * capacity); \
+        /* The inline buffer always holds up to SIZE elements */ \
+        if (CMC_SIZE_OR_ZERO(SIZE) > 0 && capacity <= CMC_SIZE_OR_ZERO(SIZE)) \
+        { \
+            if (CMC_(PFX, _impl_is_inline)(_stack_)) \
+                goto success; \
+\
+            memcpy(_stack_->inline_buffer, _stack_->buffer, sizeof(V) * _stack_->count); \
+            _stack_->alloc->free(_stack_->buffer); \
+\
+            _stack_->buffer = _stack_->inline_buffer; \
+            _stack_->capacity = CMC_SIZE_OR_ZERO(SIZE); \
+\
+            goto success; \
+        } \
+\
+        V *new_buffer; \
+\
+        if (CMC_(PFX, _impl_is_inline)(_stack_)) \
+        { \
+            /* Spill the inline buffer to the heap */ \
+            new_buffer = _stack_->alloc->malloc(sizeof(V) * capacity); \
+\
+            if (new_buffer) \
+                memcpy(new_buffer, _stack_->inline_buffer, sizeof(V) * _stack_->count); \
+        } \
+        else \
+            new_buffer = _stack_->alloc->realloc(_stack_->buffer, sizeof(V) * capacity); \
 \
         if (!new_buffer) \
         { \
@@ -434,6 +487,11 @@
         } \
 \
         return true; \
+    } \
+\
+    static bool CMC_(PFX, _impl_is_inline)(struct SNAME * _stack_) \
+    { \
+        return CMC_SIZE_OR_ZERO(SIZE) > 0 && _stack_->buffer == _stack_->inline_buffer; \
     }
 
 #endif /* CMC_CMC_STACK_H */
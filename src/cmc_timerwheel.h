@@ -0,0 +1,974 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cmc_timerwheel.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+/**
+ * TimerWheel
+ *
+ * A TimerWheel keeps timers, each with a value and a deadline, and expires
+ * them as time goes forward. Time is measured in ticks of any unit chosen by
+ * the user and only moves forward through _advance(). Scheduling, cancelling
+ * and rescheduling a timer are O(1) no matter how many timers there are, and
+ * each timer is identified by a handle that is detected once it is stale.
+ *
+ * The wheel is made of levels of 64 slots. A timer is placed at the level of
+ * the highest group of 6 bits where its deadline differs from the current
+ * time and at the slot given by that group of its deadline. Every time the
+ * current time reaches the first tick covered by a slot, the timers in it are
+ * placed again in lower levels, until they get to the list of timers that are
+ * due. A bitmap of the slots in use lets _advance() jump over empty ticks.
+ */
+
+#ifndef CMC_CMC_TIMERWHEEL_H
+#define CMC_CMC_TIMERWHEEL_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/* Bits of the time covered by each level of the wheel */
+#define CMC_TIMERWHEEL_BITS 6
+#define CMC_TIMERWHEEL_SLOTS (1 << CMC_TIMERWHEEL_BITS)
+
+/* Enough levels to cover every possible 64-bit deadline */
+#define CMC_TIMERWHEEL_LEVELS 11
+
+/* Lists that are not slots of the wheel; due timers and timers being expired */
+#define CMC_TIMERWHEEL_DUE (CMC_TIMERWHEEL_LEVELS * CMC_TIMERWHEEL_SLOTS)
+#define CMC_TIMERWHEEL_FIRING (CMC_TIMERWHEEL_DUE + 1)
+
+/* A handle is a 64-bit integer made of a timer index and its generation */
+#define CMC_TIMERWHEEL_HANDLE(index, generation) (((uint64_t)(generation) << 32) | (uint64_t)(index))
+#define CMC_TIMERWHEEL_INDEX(handle) ((uint32_t)((handle)&UINT32_MAX))
+#define CMC_TIMERWHEEL_GENERATION(handle) ((uint32_t)((handle) >> 32))
+
+/* A handle that never refers to a timer */
+#define CMC_TIMERWHEEL_NULL ((uint64_t)0)
+
+/* End of a list of timers */
+#define CMC_TIMERWHEEL_END UINT32_MAX
+
+/**
+ * Core TimerWheel implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_CMC_TIMERWHEEL_CORE(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_CMC_TIMERWHEEL_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_CMC_TIMERWHEEL_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_CMC_TIMERWHEEL_CORE_STRUCT(PARAMS) \
+    CMC_CMC_TIMERWHEEL_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_TIMERWHEEL_CORE_PUBLIC_SOURCE(PARAMS) CMC_CMC_TIMERWHEEL_CORE_SOURCE(PARAMS)
+
+#define CMC_CMC_TIMERWHEEL_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    struct CMC_DEF_ENTRY(CMC_PARAM_SNAME(PARAMS)); \
+    CMC_CMC_TIMERWHEEL_CORE_HEADER(PARAMS)
+
+#define CMC_CMC_TIMERWHEEL_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_CMC_TIMERWHEEL_CORE_STRUCT(PARAMS) \
+    CMC_CMC_TIMERWHEEL_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_CMC_TIMERWHEEL_CORE_STRUCT(PARAMS) \
+    CMC_CMC_TIMERWHEEL_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_TIMERWHEEL_CORE_HEADER(PARAMS) \
+    CMC_CMC_TIMERWHEEL_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_CMC_TIMERWHEEL_CORE_SOURCE(PARAMS) \
+    CMC_CMC_TIMERWHEEL_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_TIMERWHEEL_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* TimerWheel Structure */ \
+    struct SNAME \
+    { \
+        /* Array of timers */ \
+        struct CMC_DEF_ENTRY(SNAME) * timers; \
+\
+        /* Capacity of the array of timers */ \
+        size_t capacity; \
+\
+        /* Current amount of timers */ \
+        size_t count; \
+\
+        /* How many timers have been used at least once */ \
+        size_t used; \
+\
+        /* First free timer or CMC_TIMERWHEEL_END */ \
+        uint32_t free; \
+\
+        /* Current time */ \
+        uint64_t now; \
+\
+        /* First timer of each slot, followed by the due and firing lists */ \
+        uint32_t lists[CMC_TIMERWHEEL_FIRING + 1]; \
+\
+        /* Bitmap of the slots in use of each level */ \
+        uint64_t occupied[CMC_TIMERWHEEL_LEVELS]; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    }; \
+\
+    struct CMC_DEF_ENTRY(SNAME) \
+    { \
+        /* Timer's value */ \
+        V value; \
+\
+        /* When the timer expires */ \
+        uint64_t deadline; \
+\
+        /* Next timer in the same list if the timer is taken, otherwise the */ \
+        /* next free timer */ \
+        uint32_t next; \
+\
+        /* Previous timer in the same list */ \
+        uint32_t prev; \
+\
+        /* Odd if the timer is taken; bumped every time it is taken or freed */ \
+        uint32_t generation; \
+\
+        /* List where the timer is */ \
+        uint16_t list; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_TIMERWHEEL_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, uint64_t now, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, uint64_t now, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _clear)(struct SNAME * _wheel_); \
+    void CMC_(PFX, _free)(struct SNAME * _wheel_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _wheel_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _schedule)(struct SNAME * _wheel_, uint64_t deadline, V value, uint64_t * handle); \
+    bool CMC_(PFX, _cancel)(struct SNAME * _wheel_, uint64_t handle, V * out_value); \
+    bool CMC_(PFX, _reschedule)(struct SNAME * _wheel_, uint64_t handle, uint64_t deadline); \
+    size_t CMC_(PFX, _advance)(struct SNAME * _wheel_, uint64_t now, void (*expire)(V, uint64_t)); \
+    /* Element Access */ \
+    V CMC_(PFX, _get)(struct SNAME * _wheel_, uint64_t handle); \
+    uint64_t CMC_(PFX, _deadline)(struct SNAME * _wheel_, uint64_t handle); \
+    bool CMC_(PFX, _next_tick)(struct SNAME * _wheel_, uint64_t * tick); \
+    /* Collection State */ \
+    bool CMC_(PFX, _contains)(struct SNAME * _wheel_, uint64_t handle); \
+    bool CMC_(PFX, _empty)(struct SNAME * _wheel_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _wheel_); \
+    size_t CMC_(PFX, _capacity)(struct SNAME * _wheel_); \
+    uint64_t CMC_(PFX, _now)(struct SNAME * _wheel_); \
+    int CMC_(PFX, _flag)(struct SNAME * _wheel_); \
+    /* Collection Utility */ \
+    bool CMC_(PFX, _resize)(struct SNAME * _wheel_, size_t capacity); \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _wheel_); \
+    bool CMC_(PFX, _equals)(struct SNAME * _wheel1_, struct SNAME * _wheel2_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_CMC_TIMERWHEEL_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_timer)(struct SNAME * _wheel_, uint64_t handle); \
+    static void CMC_(PFX, _impl_reset)(struct SNAME * _wheel_); \
+    static void CMC_(PFX, _impl_link)(struct SNAME * _wheel_, uint32_t t); \
+    static void CMC_(PFX, _impl_unlink)(struct SNAME * _wheel_, uint32_t t); \
+    static void CMC_(PFX, _impl_release)(struct SNAME * _wheel_, uint32_t t); \
+    static void CMC_(PFX, _impl_cascade)(struct SNAME * _wheel_); \
+    static uint32_t CMC_(PFX, _impl_sort)(struct SNAME * _wheel_, uint32_t t); \
+    static size_t CMC_(PFX, _impl_lowest_bit)(uint64_t bits); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, uint64_t now, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(capacity, now, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, uint64_t now, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        /* Timer indexes are 32 bits and CMC_TIMERWHEEL_END is reserved */ \
+        if (capacity == 0 || capacity >= CMC_TIMERWHEEL_END) \
+            return NULL; \
+\
+        if (!f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_wheel_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_wheel_) \
+            return NULL; \
+\
+        _wheel_->timers = alloc->malloc(sizeof(struct CMC_DEF_ENTRY(SNAME)) * capacity); \
+\
+        if (!_wheel_->timers) \
+        { \
+            alloc->free(_wheel_); \
+            return NULL; \
+        } \
+\
+        _wheel_->capacity = capacity; \
+        _wheel_->count = 0; \
+        _wheel_->used = 0; \
+        _wheel_->free = CMC_TIMERWHEEL_END; \
+        _wheel_->now = now; \
+        _wheel_->flag = CMC_FLAG_OK; \
+        _wheel_->f_val = f_val; \
+        _wheel_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_wheel_, callbacks); \
+\
+        CMC_(PFX, _impl_reset)(_wheel_); \
+\
+        return _wheel_; \
+    } \
+\
+    void CMC_(PFX, _clear)(struct SNAME * _wheel_) \
+    { \
+        /* Every taken timer is freed so that its handles become stale */ \
+        for (size_t i = 0; i < _wheel_->used; i++) \
+        { \
+            if (_wheel_->timers[i].generation % 2 == 0) \
+                continue; \
+\
+            if (_wheel_->f_val->free) \
+                _wheel_->f_val->free(_wheel_->timers[i].value); \
+\
+            CMC_(PFX, _impl_release)(_wheel_, (uint32_t)i); \
+        } \
+\
+        CMC_(PFX, _impl_reset)(_wheel_); \
+\
+        _wheel_->count = 0; \
+        _wheel_->flag = CMC_FLAG_OK; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _wheel_) \
+    { \
+        if (_wheel_->f_val->free) \
+        { \
+            for (size_t i = 0; i < _wheel_->used; i++) \
+            { \
+                if (_wheel_->timers[i].generation % 2 != 0) \
+                    _wheel_->f_val->free(_wheel_->timers[i].value); \
+            } \
+        } \
+\
+        _wheel_->alloc->free(_wheel_->timers); \
+        _wheel_->alloc->free(_wheel_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _wheel_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _wheel_->alloc = &cmc_alloc_node_default; \
+        else \
+            _wheel_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_wheel_, callbacks); \
+\
+        _wheel_->flag = CMC_FLAG_OK; \
+    } \
+\
+    /* A deadline that is not after the current time expires on the next */ \
+    /* call to _advance() */ \
+    bool CMC_(PFX, _schedule)(struct SNAME * _wheel_, uint64_t deadline, V value, uint64_t * handle) \
+    { \
+        if (_wheel_->free == CMC_TIMERWHEEL_END && _wheel_->used == _wheel_->capacity) \
+        { \
+            size_t capacity = _wheel_->capacity * 2; \
+\
+            if (capacity >= CMC_TIMERWHEEL_END) \
+                capacity = CMC_TIMERWHEEL_END - 1; \
+\
+            /* Every possible timer is taken */ \
+            if (capacity == _wheel_->capacity) \
+            { \
+                _wheel_->flag = CMC_FLAG_ERROR; \
+                return false; \
+            } \
+\
+            if (!CMC_(PFX, _resize)(_wheel_, capacity)) \
+                return false; \
+        } \
+\
+        uint32_t t; \
+\
+        if (_wheel_->free != CMC_TIMERWHEEL_END) \
+        { \
+            t = _wheel_->free; \
+            _wheel_->free = _wheel_->timers[t].next; \
+        } \
+        else \
+        { \
+            t = (uint32_t)_wheel_->used++; \
+            _wheel_->timers[t].generation = 0; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *timer = &(_wheel_->timers[t]); \
+\
+        timer->value = value; \
+        timer->deadline = deadline; \
+        timer->generation++; \
+\
+        CMC_(PFX, _impl_link)(_wheel_, t); \
+\
+        if (handle) \
+            *handle = CMC_TIMERWHEEL_HANDLE(t, timer->generation); \
+\
+        _wheel_->count++; \
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_wheel_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _cancel)(struct SNAME * _wheel_, uint64_t handle, V * out_value) \
+    { \
+        if (CMC_(PFX, _empty)(_wheel_)) \
+        { \
+            _wheel_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *timer = CMC_(PFX, _impl_get_timer)(_wheel_, handle); \
+\
+        if (!timer) \
+        { \
+            _wheel_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        if (out_value) \
+            *out_value = timer->value; \
+\
+        CMC_(PFX, _impl_unlink)(_wheel_, CMC_TIMERWHEEL_INDEX(handle)); \
+        CMC_(PFX, _impl_release)(_wheel_, CMC_TIMERWHEEL_INDEX(handle)); \
+\
+        _wheel_->count--; \
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_wheel_, delete); \
+\
+        return true; \
+    } \
+\
+    /* The handle stays valid */ \
+    bool CMC_(PFX, _reschedule)(struct SNAME * _wheel_, uint64_t handle, uint64_t deadline) \
+    { \
+        if (CMC_(PFX, _empty)(_wheel_)) \
+        { \
+            _wheel_->flag = CMC_FLAG_EMPTY; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *timer = CMC_(PFX, _impl_get_timer)(_wheel_, handle); \
+\
+        if (!timer) \
+        { \
+            _wheel_->flag = CMC_FLAG_NOT_FOUND; \
+            return false; \
+        } \
+\
+        CMC_(PFX, _impl_unlink)(_wheel_, CMC_TIMERWHEEL_INDEX(handle)); \
+\
+        timer->deadline = deadline; \
+\
+        CMC_(PFX, _impl_link)(_wheel_, CMC_TIMERWHEEL_INDEX(handle)); \
+\
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_wheel_, update); \
+\
+        return true; \
+    } \
+\
+    /* Moves the current time forward, removing every timer whose deadline */ \
+    /* is reached and passing its value to expire in order of deadline. If */ \
+    /* expire is NULL the values are freed instead. From expire, only timers */ \
+    /* may be scheduled, cancelled or rescheduled. Returns how many timers */ \
+    /* expired. */ \
+    size_t CMC_(PFX, _advance)(struct SNAME * _wheel_, uint64_t now, void (*expire)(V, uint64_t)) \
+    { \
+        if (now < _wheel_->now) \
+        { \
+            _wheel_->flag = CMC_FLAG_INVALID; \
+            return 0; \
+        } \
+\
+        size_t result = 0; \
+        uint64_t tick; \
+\
+        while (true) \
+        { \
+            /* Timers that become due from expire wait for the next batch */ \
+            _wheel_->lists[CMC_TIMERWHEEL_FIRING] = _wheel_->lists[CMC_TIMERWHEEL_DUE]; \
+            _wheel_->lists[CMC_TIMERWHEEL_DUE] = CMC_TIMERWHEEL_END; \
+\
+            bool sorted = true; \
+\
+            for (uint32_t t = _wheel_->lists[CMC_TIMERWHEEL_FIRING]; t != CMC_TIMERWHEEL_END; \
+                 t = _wheel_->timers[t].next) \
+            { \
+                uint32_t next = _wheel_->timers[t].next; \
+\
+                if (next != CMC_TIMERWHEEL_END && _wheel_->timers[next].deadline < _wheel_->timers[t].deadline) \
+                    sorted = false; \
+\
+                _wheel_->timers[t].list = CMC_TIMERWHEEL_FIRING; \
+            } \
+\
+            /* Timers that were scheduled with a deadline that was already */ \
+            /* reached go straight to the due list in any order */ \
+            if (!sorted) \
+            { \
+                uint32_t prev = CMC_TIMERWHEEL_END; \
+\
+                _wheel_->lists[CMC_TIMERWHEEL_FIRING] = \
+                    CMC_(PFX, _impl_sort)(_wheel_, _wheel_->lists[CMC_TIMERWHEEL_FIRING]); \
+\
+                for (uint32_t t = _wheel_->lists[CMC_TIMERWHEEL_FIRING]; t != CMC_TIMERWHEEL_END; \
+                     t = _wheel_->timers[t].next) \
+                { \
+                    _wheel_->timers[t].prev = prev; \
+                    prev = t; \
+                } \
+            } \
+\
+            while (_wheel_->lists[CMC_TIMERWHEEL_FIRING] != CMC_TIMERWHEEL_END) \
+            { \
+                uint32_t t = _wheel_->lists[CMC_TIMERWHEEL_FIRING]; \
+\
+                V value = _wheel_->timers[t].value; \
+                uint64_t deadline = _wheel_->timers[t].deadline; \
+\
+                CMC_(PFX, _impl_unlink)(_wheel_, t); \
+                CMC_(PFX, _impl_release)(_wheel_, t); \
+\
+                _wheel_->count--; \
+                result++; \
+\
+                if (expire) \
+                    expire(value, deadline); \
+                else if (_wheel_->f_val->free) \
+                    _wheel_->f_val->free(value); \
+            } \
+\
+            if (!CMC_(PFX, _next_tick)(_wheel_, &tick) || tick > now) \
+                break; \
+\
+            _wheel_->now = tick; \
+\
+            CMC_(PFX, _impl_cascade)(_wheel_); \
+        } \
+\
+        _wheel_->now = now; \
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_wheel_, update); \
+\
+        return result; \
+    } \
+\
+    V CMC_(PFX, _get)(struct SNAME * _wheel_, uint64_t handle) \
+    { \
+        if (CMC_(PFX, _empty)(_wheel_)) \
+        { \
+            _wheel_->flag = CMC_FLAG_EMPTY; \
+            return (V){ 0 }; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *timer = CMC_(PFX, _impl_get_timer)(_wheel_, handle); \
+\
+        if (!timer) \
+        { \
+            _wheel_->flag = CMC_FLAG_NOT_FOUND; \
+            return (V){ 0 }; \
+        } \
+\
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_wheel_, read); \
+\
+        return timer->value; \
+    } \
+\
+    uint64_t CMC_(PFX, _deadline)(struct SNAME * _wheel_, uint64_t handle) \
+    { \
+        if (CMC_(PFX, _empty)(_wheel_)) \
+        { \
+            _wheel_->flag = CMC_FLAG_EMPTY; \
+            return 0; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *timer = CMC_(PFX, _impl_get_timer)(_wheel_, handle); \
+\
+        if (!timer) \
+        { \
+            _wheel_->flag = CMC_FLAG_NOT_FOUND; \
+            return 0; \
+        } \
+\
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_wheel_, read); \
+\
+        return timer->deadline; \
+    } \
+\
+    /* The next tick after the current time when the wheel has work to do, */ \
+    /* either expiring timers or moving them to a lower level. It is never */ \
+    /* later than the earliest deadline, so it can be used as a timeout. */ \
+    /* Returns false if no timer is waiting in the wheel. */ \
+    bool CMC_(PFX, _next_tick)(struct SNAME * _wheel_, uint64_t * tick) \
+    { \
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        /* A slot of a lower level always comes before any slot of the */ \
+        /* levels above it */ \
+        for (size_t level = 0; level < CMC_TIMERWHEEL_LEVELS; level++) \
+        { \
+            size_t shift = level * CMC_TIMERWHEEL_BITS; \
+            size_t slot = (size_t)(_wheel_->now >> shift) & (CMC_TIMERWHEEL_SLOTS - 1); \
+\
+            /* Only slots after the current one can be in use */ \
+            if (slot + 1 == CMC_TIMERWHEEL_SLOTS) \
+                continue; \
+\
+            uint64_t bits = _wheel_->occupied[level] >> (slot + 1) << (slot + 1); \
+\
+            if (bits == 0) \
+                continue; \
+\
+            uint64_t above = 0; \
+\
+            if (shift + CMC_TIMERWHEEL_BITS < 64) \
+                above = _wheel_->now >> (shift + CMC_TIMERWHEEL_BITS) << (shift + CMC_TIMERWHEEL_BITS); \
+\
+            if (tick) \
+                *tick = above | ((uint64_t)CMC_(PFX, _impl_lowest_bit)(bits) << shift); \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _contains)(struct SNAME * _wheel_, uint64_t handle) \
+    { \
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        bool result = CMC_(PFX, _impl_get_timer)(_wheel_, handle) != NULL; \
+\
+        CMC_CALLBACKS_CALL(_wheel_, read); \
+\
+        return result; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _wheel_) \
+    { \
+        return _wheel_->count == 0; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _wheel_) \
+    { \
+        return _wheel_->count; \
+    } \
+\
+    size_t CMC_(PFX, _capacity)(struct SNAME * _wheel_) \
+    { \
+        return _wheel_->capacity; \
+    } \
+\
+    uint64_t CMC_(PFX, _now)(struct SNAME * _wheel_) \
+    { \
+        return _wheel_->now; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _wheel_) \
+    { \
+        return _wheel_->flag; \
+    } \
+\
+    bool CMC_(PFX, _resize)(struct SNAME * _wheel_, size_t capacity) \
+    { \
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        if (_wheel_->capacity == capacity) \
+            goto success; \
+\
+        /* Timers that were used once can't be dropped or their handles */ \
+        /* could become valid again */ \
+        if (capacity < _wheel_->used || capacity == 0) \
+        { \
+            _wheel_->flag = CMC_FLAG_INVALID; \
+            return false; \
+        } \
+\
+        if (capacity >= CMC_TIMERWHEEL_END) \
+        { \
+            _wheel_->flag = CMC_FLAG_ERROR; \
+            return false; \
+        } \
+\
+        struct CMC_DEF_ENTRY(SNAME) *new_timers = \
+            _wheel_->alloc->realloc(_wheel_->timers, sizeof(struct CMC_DEF_ENTRY(SNAME)) * capacity); \
+\
+        if (!new_timers) \
+        { \
+            _wheel_->flag = CMC_FLAG_ALLOC; \
+            return false; \
+        } \
+\
+        _wheel_->timers = new_timers; \
+        _wheel_->capacity = capacity; \
+\
+    success: \
+\
+        CMC_CALLBACKS_CALL(_wheel_, resize); \
+\
+        return true; \
+    } \
+\
+    /* Handles of the original are also valid for the copy */ \
+    struct SNAME *CMC_(PFX, _copy_of)(struct SNAME * _wheel_) \
+    { \
+        struct SNAME *result = \
+            CMC_(PFX, _new_custom)(_wheel_->capacity, _wheel_->now, _wheel_->f_val, _wheel_->alloc, NULL); \
+\
+        if (!result) \
+        { \
+            _wheel_->flag = CMC_FLAG_ERROR; \
+            return NULL; \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(result, _wheel_->callbacks); \
+\
+        memcpy(result->timers, _wheel_->timers, sizeof(struct CMC_DEF_ENTRY(SNAME)) * _wheel_->used); \
+        memcpy(result->lists, _wheel_->lists, sizeof(_wheel_->lists)); \
+        memcpy(result->occupied, _wheel_->occupied, sizeof(_wheel_->occupied)); \
+\
+        if (_wheel_->f_val->cpy) \
+        { \
+            for (size_t i = 0; i < _wheel_->used; i++) \
+            { \
+                if (result->timers[i].generation % 2 != 0) \
+                    result->timers[i].value = _wheel_->f_val->cpy(_wheel_->timers[i].value); \
+            } \
+        } \
+\
+        result->count = _wheel_->count; \
+        result->used = _wheel_->used; \
+        result->free = _wheel_->free; \
+\
+        _wheel_->flag = CMC_FLAG_OK; \
+\
+        return result; \
+    } \
+\
+    /* Two TimerWheels are equal if they are at the same time and every */ \
+    /* handle of one refers to a timer with the same deadline and an equal */ \
+    /* value in the other */ \
+    bool CMC_(PFX, _equals)(struct SNAME * _wheel1_, struct SNAME * _wheel2_) \
+    { \
+        _wheel1_->flag = CMC_FLAG_OK; \
+        _wheel2_->flag = CMC_FLAG_OK; \
+\
+        if (_wheel1_->now != _wheel2_->now || _wheel1_->count != _wheel2_->count) \
+            return false; \
+\
+        for (size_t i = 0; i < _wheel1_->used; i++) \
+        { \
+            struct CMC_DEF_ENTRY(SNAME) *timer1 = &(_wheel1_->timers[i]); \
+\
+            if (timer1->generation % 2 == 0) \
+                continue; \
+\
+            uint64_t handle = CMC_TIMERWHEEL_HANDLE(i, timer1->generation); \
+\
+            struct CMC_DEF_ENTRY(SNAME) *timer2 = CMC_(PFX, _impl_get_timer)(_wheel2_, handle); \
+\
+            if (!timer2 || timer1->deadline != timer2->deadline) \
+                return false; \
+\
+            if (_wheel1_->f_val->cmp(timer1->value, timer2->value) != 0) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_get_timer)(struct SNAME * _wheel_, uint64_t handle) \
+    { \
+        uint32_t t = CMC_TIMERWHEEL_INDEX(handle); \
+        uint32_t generation = CMC_TIMERWHEEL_GENERATION(handle); \
+\
+        /* Even generations belong to free timers */ \
+        if (t >= _wheel_->used || generation % 2 == 0) \
+            return NULL; \
+\
+        struct CMC_DEF_ENTRY(SNAME) *timer = &(_wheel_->timers[t]); \
+\
+        if (timer->generation != generation) \
+            return NULL; \
+\
+        return timer; \
+    } \
+\
+    static void CMC_(PFX, _impl_reset)(struct SNAME * _wheel_) \
+    { \
+        for (size_t i = 0; i <= CMC_TIMERWHEEL_FIRING; i++) \
+            _wheel_->lists[i] = CMC_TIMERWHEEL_END; \
+\
+        for (size_t i = 0; i < CMC_TIMERWHEEL_LEVELS; i++) \
+            _wheel_->occupied[i] = 0; \
+    } \
+\
+    /* Adds a timer to the list its deadline belongs to */ \
+    static void CMC_(PFX, _impl_link)(struct SNAME * _wheel_, uint32_t t) \
+    { \
+        struct CMC_DEF_ENTRY(SNAME) *timer = &(_wheel_->timers[t]); \
+\
+        size_t list = CMC_TIMERWHEEL_DUE; \
+\
+        if (timer->deadline > _wheel_->now) \
+        { \
+            uint64_t diff = timer->deadline ^ _wheel_->now; \
+            size_t level = 0; \
+\
+            while (diff >= CMC_TIMERWHEEL_SLOTS) \
+            { \
+                diff >>= CMC_TIMERWHEEL_BITS; \
+                level++; \
+            } \
+\
+            size_t slot = (size_t)(timer->deadline >> (level * CMC_TIMERWHEEL_BITS)) & (CMC_TIMERWHEEL_SLOTS - 1); \
+\
+            list = level * CMC_TIMERWHEEL_SLOTS + slot; \
+\
+            _wheel_->occupied[level] |= (uint64_t)1 << slot; \
+        } \
+\
+        timer->list = (uint16_t)list; \
+        timer->prev = CMC_TIMERWHEEL_END; \
+        timer->next = _wheel_->lists[list]; \
+\
+        if (timer->next != CMC_TIMERWHEEL_END) \
+            _wheel_->timers[timer->next].prev = t; \
+\
+        _wheel_->lists[list] = t; \
+    } \
+\
+    static void CMC_(PFX, _impl_unlink)(struct SNAME * _wheel_, uint32_t t) \
+    { \
+        struct CMC_DEF_ENTRY(SNAME) *timer = &(_wheel_->timers[t]); \
+\
+        if (timer->prev != CMC_TIMERWHEEL_END) \
+            _wheel_->timers[timer->prev].next = timer->next; \
+        else \
+            _wheel_->lists[timer->list] = timer->next; \
+\
+        if (timer->next != CMC_TIMERWHEEL_END) \
+            _wheel_->timers[timer->next].prev = timer->prev; \
+\
+        if (timer->list < CMC_TIMERWHEEL_DUE && _wheel_->lists[timer->list] == CMC_TIMERWHEEL_END) \
+        { \
+            size_t level = timer->list / CMC_TIMERWHEEL_SLOTS; \
+            size_t slot = timer->list % CMC_TIMERWHEEL_SLOTS; \
+\
+            _wheel_->occupied[level] &= ~((uint64_t)1 << slot); \
+        } \
+    } \
+\
+    /* Puts a timer back in the free list */ \
+    static void CMC_(PFX, _impl_release)(struct SNAME * _wheel_, uint32_t t) \
+    { \
+        struct CMC_DEF_ENTRY(SNAME) *timer = &(_wheel_->timers[t]); \
+\
+        timer->generation++; \
+\
+        /* Retire the timer if its generation wrapped around */ \
+        if (timer->generation != 0) \
+        { \
+            timer->next = _wheel_->free; \
+            _wheel_->free = t; \
+        } \
+    } \
+\
+    /* Moves the timers of every slot that starts at the current time to */ \
+    /* the lists their deadlines now belong to */ \
+    static void CMC_(PFX, _impl_cascade)(struct SNAME * _wheel_) \
+    { \
+        for (size_t level = 0; level < CMC_TIMERWHEEL_LEVELS; level++) \
+        { \
+            size_t slot = (size_t)(_wheel_->now >> (level * CMC_TIMERWHEEL_BITS)) & (CMC_TIMERWHEEL_SLOTS - 1); \
+            size_t list = level * CMC_TIMERWHEEL_SLOTS + slot; \
+\
+            uint32_t t = _wheel_->lists[list]; \
+\
+            if (t == CMC_TIMERWHEEL_END) \
+                continue; \
+\
+            _wheel_->lists[list] = CMC_TIMERWHEEL_END; \
+            _wheel_->occupied[level] &= ~((uint64_t)1 << slot); \
+\
+            /* Timers always end up in a lower level or in the due list */ \
+            while (t != CMC_TIMERWHEEL_END) \
+            { \
+                uint32_t next = _wheel_->timers[t].next; \
+\
+                CMC_(PFX, _impl_link)(_wheel_, t); \
+\
+                t = next; \
+            } \
+        } \
+    } \
+\
+    /* Merge sorts a list of timers by deadline, only linking them forward */ \
+    static uint32_t CMC_(PFX, _impl_sort)(struct SNAME * _wheel_, uint32_t t) \
+    { \
+        if (t == CMC_TIMERWHEEL_END || _wheel_->timers[t].next == CMC_TIMERWHEEL_END) \
+            return t; \
+\
+        uint32_t middle = t; \
+        uint32_t fast = _wheel_->timers[t].next; \
+\
+        while (fast != CMC_TIMERWHEEL_END && _wheel_->timers[fast].next != CMC_TIMERWHEEL_END) \
+        { \
+            middle = _wheel_->timers[middle].next; \
+            fast = _wheel_->timers[_wheel_->timers[fast].next].next; \
+        } \
+\
+        uint32_t right = _wheel_->timers[middle].next; \
+        _wheel_->timers[middle].next = CMC_TIMERWHEEL_END; \
+\
+        uint32_t left = CMC_(PFX, _impl_sort)(_wheel_, t); \
+        right = CMC_(PFX, _impl_sort)(_wheel_, right); \
+\
+        uint32_t head = CMC_TIMERWHEEL_END; \
+        uint32_t tail = CMC_TIMERWHEEL_END; \
+\
+        while (left != CMC_TIMERWHEEL_END || right != CMC_TIMERWHEEL_END) \
+        { \
+            uint32_t next; \
+\
+            if (right == CMC_TIMERWHEEL_END || \
+                (left != CMC_TIMERWHEEL_END && _wheel_->timers[left].deadline <= _wheel_->timers[right].deadline)) \
+            { \
+                next = left; \
+                left = _wheel_->timers[left].next; \
+            } \
+            else \
+            { \
+                next = right; \
+                right = _wheel_->timers[right].next; \
+            } \
+\
+            if (tail == CMC_TIMERWHEEL_END) \
+                head = next; \
+            else \
+                _wheel_->timers[tail].next = next; \
+\
+            tail = next; \
+        } \
+\
+        return head; \
+    } \
+\
+    /* Index of the lowest bit set */ \
+    static size_t CMC_(PFX, _impl_lowest_bit)(uint64_t bits) \
+    { \
+        static const unsigned char table[64] = { 0,  1,  56, 2,  57, 49, 28, 3,  61, 58, 42, 50, 38, 29, 17, 4, \
+                                                 62, 47, 59, 36, 45, 43, 51, 22, 53, 39, 33, 30, 24, 18, 12, 5, \
+                                                 63, 55, 48, 27, 60, 41, 37, 16, 46, 35, 44, 21, 52, 32, 23, 11, \
+                                                 54, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6 }; \
+\
+        return table[((bits & (~bits + 1)) * UINT64_C(0x03f79d71b4ca8b09)) >> 58]; \
+    }
+
+#endif /* CMC_CMC_TIMERWHEEL_H */
@@ -201,6 +201,8 @@
     bool CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value); \
     bool CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value); \
     bool CMC_(PFX, _remove)(struct SNAME * _map_, K key, V * out_value); \
+    size_t CMC_(PFX, _remove_range)(struct SNAME * _map_, K low, K high); \
+    size_t CMC_(PFX, _remove_below)(struct SNAME * _map_, K key); \
     /* Element Access */ \
     bool CMC_(PFX, _max)(struct SNAME * _map_, K * key, V * value); \
     bool CMC_(PFX, _min)(struct SNAME * _map_, K * key, V * value); \
@@ -228,11 +230,99 @@
     static void CMC_(PFX, _impl_rotate_right)(struct CMC_DEF_NODE(SNAME) * *Z); \
     static void CMC_(PFX, _impl_rotate_left)(struct CMC_DEF_NODE(SNAME) * *Z); \
     static void CMC_(PFX, _impl_rebalance)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node); \
+    static size_t CMC_(PFX, _impl_free_nodes)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * scan); \
+    static void CMC_(PFX, _impl_split)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, K key, bool after, \
+                                       struct CMC_DEF_NODE(SNAME) * *left, struct CMC_DEF_NODE(SNAME) * *right); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_join)(struct CMC_DEF_NODE(SNAME) * left, \
+                                                              struct CMC_DEF_NODE(SNAME) * middle, \
+                                                              struct CMC_DEF_NODE(SNAME) * right); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_fix)(struct CMC_DEF_NODE(SNAME) * node); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_attach)(struct SNAME * _map_, \
+                                                                struct CMC_DEF_NODE(SNAME) * parent, bool left, \
+                                                                K key, V value); \
 \
     struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val) \
     { \
         return CMC_(PFX, _new_custom)(f_key, f_val, NULL, NULL); \
     } \
+\
+    /* Removes every key from low to high, both included, returning how */ \
+    /* many there were. They are freed like in _clear() */ \
+    size_t CMC_(PFX, _remove_range)(struct SNAME * _map_, K low, K high) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return 0; \
+        } \
+\
+        if (_map_->f_key->cmp(low, high) > 0) \
+        { \
+            _map_->flag = CMC_FLAG_INVALID; \
+            return 0; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *left = NULL; \
+        struct CMC_DEF_NODE(SNAME) *middle = NULL; \
+        struct CMC_DEF_NODE(SNAME) *right = NULL; \
+\
+        /* The range is cut out of the tree in O(log n) and the two sides */ \
+        /* are joined back together by the smallest key on the right */ \
+        CMC_(PFX, _impl_split)(_map_, _map_->root, low, false, &left, &right); \
+        CMC_(PFX, _impl_split)(_map_, right, high, true, &middle, &right); \
+\
+        if (left && right) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *min = right; \
+\
+            while (min->left) \
+                min = min->left; \
+\
+            CMC_(PFX, _impl_split)(_map_, right, min->key, true, &min, &right); \
+\
+            _map_->root = CMC_(PFX, _impl_join)(left, min, right); \
+        } \
+        else \
+            _map_->root = left ? left : right; \
+\
+        size_t removed = CMC_(PFX, _impl_free_nodes)(_map_, middle); \
+\
+        _map_->count -= removed; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        if (removed > 0) \
+        { \
+            CMC_CALLBACKS_CALL(_map_, delete); \
+        } \
+\
+        return removed; \
+    } \
+\
+    /* Removes every key smaller than key, returning how many there were */ \
+    size_t CMC_(PFX, _remove_below)(struct SNAME * _map_, K key) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            _map_->flag = CMC_FLAG_EMPTY; \
+            return 0; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *below = NULL; \
+\
+        CMC_(PFX, _impl_split)(_map_, _map_->root, key, false, &below, &_map_->root); \
+\
+        size_t removed = CMC_(PFX, _impl_free_nodes)(_map_, below); \
+\
+        _map_->count -= removed; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        if (removed > 0) \
+        { \
+            CMC_CALLBACKS_CALL(_map_, delete); \
+        } \
+\
+        return removed; \
+    } \
 \
     struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FKEY(SNAME) * f_key, struct CMC_DEF_FVAL(SNAME) * f_val, \
                                          struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
@@ -263,64 +353,7 @@
 \
     void CMC_(PFX, _clear)(struct SNAME * _map_) \
     { \
-        struct CMC_DEF_NODE(SNAME) *scan = _map_->root; \
-        struct CMC_DEF_NODE(SNAME) *up = NULL; \
-\
-        while (scan != NULL) \
-        { \
-            if (scan->left != NULL) \
-            { \
-                struct CMC_DEF_NODE(SNAME) *left = scan->left; \
-\
-                scan->left = up; \
-                up = scan; \
-                scan = left; \
-            } \
-            else if (scan->right != NULL) \
-            { \
-                struct CMC_DEF_NODE(SNAME) *right = scan->right; \
-\
-                scan->left = up; \
-                scan->right = NULL; \
-                up = scan; \
-                scan = right; \
-            } \
-            else \
-            { \
-                if (up == NULL) \
-                { \
-                    if (_map_->f_key->free) \
-                        _map_->f_key->free(scan->key); \
-                    if (_map_->f_val->free) \
-                        _map_->f_val->free(scan->value); \
-\
-                    _map_->alloc->free(scan); \
-                    scan = NULL; \
-                } \
-\
-                while (up != NULL) \
-                { \
-                    if (_map_->f_key->free) \
-                        _map_->f_key->free(scan->key); \
-                    if (_map_->f_val->free) \
-                        _map_->f_val->free(scan->value); \
-\
-                    _map_->alloc->free(scan); \
-\
-                    if (up->right != NULL) \
-                    { \
-                        scan = up->right; \
-                        up->right = NULL; \
-                        break; \
-                    } \
-                    else \
-                    { \
-                        scan = up; \
-                        up = up->left; \
-                    } \
-                } \
-            } \
-        } \
+        CMC_(PFX, _impl_free_nodes)(_map_, _map_->root); \
 \
         _map_->count = 0; \
         _map_->root = NULL; \
@@ -352,73 +385,30 @@
     bool CMC_(PFX, _insert)(struct SNAME * _map_, K key, V value) \
     { \
         if (CMC_(PFX, _empty)(_map_)) \
-        { \
-            _map_->root = CMC_(PFX, _impl_new_node)(_map_, key, value); \
-\
-            if (!_map_->root) \
-            { \
-                _map_->flag = CMC_FLAG_ALLOC; \
-                return false; \
-            } \
-        } \
-        else \
-        { \
-            struct CMC_DEF_NODE(SNAME) *scan = _map_->root; \
-            struct CMC_DEF_NODE(SNAME) *parent = scan; \
+            return CMC_(PFX, _impl_attach)(_map_, NULL, false, key, value) != NULL; \
 \
-            while (scan != NULL) \
-            { \
-                parent = scan; \
-\
-                if (_map_->f_key->cmp(scan->key, key) > 0) \
-                    scan = scan->left; \
-                else if (_map_->f_key->cmp(scan->key, key) < 0) \
-                    scan = scan->right; \
-                else \
-                { \
-                    _map_->flag = CMC_FLAG_DUPLICATE; \
-                    return false; \
-                } \
-            } \
-\
-            struct CMC_DEF_NODE(SNAME) * node; \
+        struct CMC_DEF_NODE(SNAME) *scan = _map_->root; \
+        struct CMC_DEF_NODE(SNAME) *parent = scan; \
 \
-            if (_map_->f_key->cmp(parent->key, key) > 0) \
-            { \
-                parent->left = CMC_(PFX, _impl_new_node)(_map_, key, value); \
+        int cmp = 0; \
 \
-                if (!parent->left) \
-                { \
-                    _map_->flag = CMC_FLAG_ALLOC; \
-                    return false; \
-                } \
+        while (scan != NULL) \
+        { \
+            parent = scan; \
+            cmp = _map_->f_key->cmp(scan->key, key); \
 \
-                parent->left->parent = parent; \
-                node = parent->left; \
-            } \
+            if (cmp > 0) \
+                scan = scan->left; \
+            else if (cmp < 0) \
+                scan = scan->right; \
             else \
             { \
-                parent->right = CMC_(PFX, _impl_new_node)(_map_, key, value); \
-\
-                if (!parent->right) \
-                { \
-                    _map_->flag = CMC_FLAG_ALLOC; \
-                    return false; \
-                } \
-\
-                parent->right->parent = parent; \
-                node = parent->right; \
+                _map_->flag = CMC_FLAG_DUPLICATE; \
+                return false; \
             } \
-\
-            CMC_(PFX, _impl_rebalance)(_map_, node); \
         } \
 \
-        _map_->count++; \
-        _map_->flag = CMC_FLAG_OK; \
-\
-        CMC_CALLBACKS_CALL(_map_, create); \
-\
-        return true; \
+        return CMC_(PFX, _impl_attach)(_map_, parent, cmp > 0, key, value) != NULL; \
     } \
 \
     bool CMC_(PFX, _update)(struct SNAME * _map_, K key, V new_value, V * old_value) \
@@ -843,9 +833,11 @@
 \
         while (scan != NULL) \
         { \
-            if (_map_->f_key->cmp(scan->key, key) > 0) \
+            int cmp = _map_->f_key->cmp(scan->key, key); \
+\
+            if (cmp > 0) \
                 scan = scan->left; \
-            else if (_map_->f_key->cmp(scan->key, key) < 0) \
+            else if (cmp < 0) \
                 scan = scan->right; \
             else \
                 return scan; \
@@ -940,6 +932,8 @@
 \
         while (scan != NULL) \
         { \
+            unsigned char height = scan->height; \
+\
             if (scan->parent == NULL) \
                 is_root = true; \
 \
@@ -970,9 +964,225 @@
                 _map_->root = scan; \
                 is_root = false; \
             } \
+\
+            /* The ancestors only depend on the height of this subtree */ \
+            if (scan->height == height) \
+                break; \
 \
             scan = scan->parent; \
         } \
+    } \
+\
+    /* Links a new node as a child of parent, or as the root if parent is */ \
+    /* NULL, and rebalances the tree from it */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_attach)(struct SNAME * _map_, \
+                                                                struct CMC_DEF_NODE(SNAME) * parent, bool left, \
+                                                                K key, V value) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_new_node)(_map_, key, value); \
+\
+        if (!node) \
+        { \
+            _map_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        node->parent = parent; \
+\
+        if (!parent) \
+            _map_->root = node; \
+        else if (left) \
+            parent->left = node; \
+        else \
+            parent->right = node; \
+\
+        CMC_(PFX, _impl_rebalance)(_map_, node); \
+\
+        _map_->count++; \
+        _map_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_map_, create); \
+\
+        return node; \
+    } \
+\
+    /* Frees every node under scan, with their keys, without recursion and */ \
+    /* returns how many there were */ \
+    static size_t CMC_(PFX, _impl_free_nodes)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * scan) \
+    { \
+        size_t count = 0; \
+        struct CMC_DEF_NODE(SNAME) *up = NULL; \
+\
+        while (scan != NULL) \
+        { \
+            if (scan->left != NULL) \
+            { \
+                struct CMC_DEF_NODE(SNAME) *left = scan->left; \
+\
+                scan->left = up; \
+                up = scan; \
+                scan = left; \
+            } \
+            else if (scan->right != NULL) \
+            { \
+                struct CMC_DEF_NODE(SNAME) *right = scan->right; \
+\
+                scan->left = up; \
+                scan->right = NULL; \
+                up = scan; \
+                scan = right; \
+            } \
+            else \
+            { \
+                if (up == NULL) \
+                { \
+                    if (_map_->f_key->free) \
+                        _map_->f_key->free(scan->key); \
+                    if (_map_->f_val->free) \
+                        _map_->f_val->free(scan->value); \
+\
+                    _map_->alloc->free(scan); \
+                    count++; \
+                    scan = NULL; \
+                } \
+\
+                while (up != NULL) \
+                { \
+                    if (_map_->f_key->free) \
+                        _map_->f_key->free(scan->key); \
+                    if (_map_->f_val->free) \
+                        _map_->f_val->free(scan->value); \
+\
+                    _map_->alloc->free(scan); \
+                    count++; \
+\
+                    if (up->right != NULL) \
+                    { \
+                        scan = up->right; \
+                        up->right = NULL; \
+                        break; \
+                    } \
+                    else \
+                    { \
+                        scan = up; \
+                        up = up->left; \
+                    } \
+                } \
+            } \
+        } \
+\
+        return count; \
+    } \
+\
+    /* Splits the tree at node into the keys smaller than key, or also the */ \
+    /* one equal to it if after is true, and the rest. Both trees are */ \
+    /* balanced and it takes O(log n) */ \
+    static void CMC_(PFX, _impl_split)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, K key, bool after, \
+                                       struct CMC_DEF_NODE(SNAME) * *left, struct CMC_DEF_NODE(SNAME) * *right) \
+    { \
+        if (!node) \
+        { \
+            *left = NULL; \
+            *right = NULL; \
+            return; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *l = node->left; \
+        struct CMC_DEF_NODE(SNAME) *r = node->right; \
+\
+        if (l) \
+            l->parent = NULL; \
+        if (r) \
+            r->parent = NULL; \
+\
+        int cmp = _map_->f_key->cmp(node->key, key); \
+\
+        if (cmp < 0 || (after && cmp == 0)) \
+        { \
+            CMC_(PFX, _impl_split)(_map_, r, key, after, left, right); \
+\
+            *left = CMC_(PFX, _impl_join)(l, node, *left); \
+        } \
+        else \
+        { \
+            CMC_(PFX, _impl_split)(_map_, l, key, after, left, right); \
+\
+            *right = CMC_(PFX, _impl_join)(*right, node, r); \
+        } \
+    } \
+\
+    /* Joins two trees with middle between them, where every key of left is */ \
+    /* smaller than the one of middle and every key of right is greater. */ \
+    /* It descends the taller tree until the heights match, so it takes time */ \
+    /* proportional to their difference */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_join)(struct CMC_DEF_NODE(SNAME) * left, \
+                                                              struct CMC_DEF_NODE(SNAME) * middle, \
+                                                              struct CMC_DEF_NODE(SNAME) * right) \
+    { \
+        unsigned char h_l = CMC_(PFX, _impl_h)(left); \
+        unsigned char h_r = CMC_(PFX, _impl_h)(right); \
+\
+        if (h_l > h_r + 1) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *sub = CMC_(PFX, _impl_join)(left->right, middle, right); \
+\
+            left->right = sub; \
+            sub->parent = left; \
+\
+            return CMC_(PFX, _impl_fix)(left); \
+        } \
+        else if (h_r > h_l + 1) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *sub = CMC_(PFX, _impl_join)(left, middle, right->left); \
+\
+            right->left = sub; \
+            sub->parent = right; \
+\
+            return CMC_(PFX, _impl_fix)(right); \
+        } \
+\
+        middle->parent = NULL; \
+        middle->left = left; \
+        middle->right = right; \
+\
+        if (left) \
+            left->parent = middle; \
+        if (right) \
+            right->parent = middle; \
+\
+        middle->height = CMC_(PFX, _impl_hupdate)(middle); \
+\
+        return middle; \
+    } \
+\
+    /* Rebalances a single node whose subtrees differ in height by at most */ \
+    /* 2, returning the new root of its subtree */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_fix)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        int balance = CMC_(PFX, _impl_h)(node->right) - CMC_(PFX, _impl_h)(node->left); \
+\
+        if (balance >= 2) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *child = node->right; \
+\
+            if (CMC_(PFX, _impl_h)(child->right) < CMC_(PFX, _impl_h)(child->left)) \
+                CMC_(PFX, _impl_rotate_right)(&(node->right)); \
+\
+            CMC_(PFX, _impl_rotate_left)(&node); \
+        } \
+        else if (balance <= -2) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *child = node->left; \
+\
+            if (CMC_(PFX, _impl_h)(child->left) < CMC_(PFX, _impl_h)(child->right)) \
+                CMC_(PFX, _impl_rotate_left)(&(node->left)); \
+\
+            CMC_(PFX, _impl_rotate_right)(&node); \
+        } \
+        else \
+            node->height = CMC_(PFX, _impl_hupdate)(node); \
+\
+        return node; \
     }
 
 #endif /* CMC_CMC_TREEMAP_H */
@@ -168,6 +168,8 @@
     /* Collection Input and Output */ \
     bool CMC_(PFX, _insert)(struct SNAME * _set_, V value); \
     bool CMC_(PFX, _remove)(struct SNAME * _set_, V value); \
+    size_t CMC_(PFX, _remove_range)(struct SNAME * _set_, V low, V high); \
+    size_t CMC_(PFX, _remove_below)(struct SNAME * _set_, V value); \
     /* Element Access */ \
     bool CMC_(PFX, _max)(struct SNAME * _set_, V * value); \
     bool CMC_(PFX, _min)(struct SNAME * _set_, V * value); \
@@ -193,11 +195,99 @@
     static void CMC_(PFX, _impl_rotate_right)(struct CMC_DEF_NODE(SNAME) * *Z); \
     static void CMC_(PFX, _impl_rotate_left)(struct CMC_DEF_NODE(SNAME) * *Z); \
     static void CMC_(PFX, _impl_rebalance)(struct SNAME * _set_, struct CMC_DEF_NODE(SNAME) * node); \
+    static size_t CMC_(PFX, _impl_free_nodes)(struct SNAME * _set_, struct CMC_DEF_NODE(SNAME) * scan); \
+    static void CMC_(PFX, _impl_split)(struct SNAME * _set_, struct CMC_DEF_NODE(SNAME) * node, V value, bool after, \
+                                       struct CMC_DEF_NODE(SNAME) * *left, struct CMC_DEF_NODE(SNAME) * *right); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_join)(struct CMC_DEF_NODE(SNAME) * left, \
+                                                              struct CMC_DEF_NODE(SNAME) * middle, \
+                                                              struct CMC_DEF_NODE(SNAME) * right); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_fix)(struct CMC_DEF_NODE(SNAME) * node); \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_attach)(struct SNAME * _set_, \
+                                                                struct CMC_DEF_NODE(SNAME) * parent, bool left, \
+                                                                V value); \
 \
     struct SNAME *CMC_(PFX, _new)(struct CMC_DEF_FVAL(SNAME) * f_val) \
     { \
         return CMC_(PFX, _new_custom)(f_val, NULL, NULL); \
     } \
+\
+    /* Removes every value from low to high, both included, returning how */ \
+    /* many there were. They are freed like in _clear() */ \
+    size_t CMC_(PFX, _remove_range)(struct SNAME * _set_, V low, V high) \
+    { \
+        if (CMC_(PFX, _empty)(_set_)) \
+        { \
+            _set_->flag = CMC_FLAG_EMPTY; \
+            return 0; \
+        } \
+\
+        if (_set_->f_val->cmp(low, high) > 0) \
+        { \
+            _set_->flag = CMC_FLAG_INVALID; \
+            return 0; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *left = NULL; \
+        struct CMC_DEF_NODE(SNAME) *middle = NULL; \
+        struct CMC_DEF_NODE(SNAME) *right = NULL; \
+\
+        /* The range is cut out of the tree in O(log n) and the two sides */ \
+        /* are joined back together by the smallest value on the right */ \
+        CMC_(PFX, _impl_split)(_set_, _set_->root, low, false, &left, &right); \
+        CMC_(PFX, _impl_split)(_set_, right, high, true, &middle, &right); \
+\
+        if (left && right) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *min = right; \
+\
+            while (min->left) \
+                min = min->left; \
+\
+            CMC_(PFX, _impl_split)(_set_, right, min->value, true, &min, &right); \
+\
+            _set_->root = CMC_(PFX, _impl_join)(left, min, right); \
+        } \
+        else \
+            _set_->root = left ? left : right; \
+\
+        size_t removed = CMC_(PFX, _impl_free_nodes)(_set_, middle); \
+\
+        _set_->count -= removed; \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        if (removed > 0) \
+        { \
+            CMC_CALLBACKS_CALL(_set_, delete); \
+        } \
+\
+        return removed; \
+    } \
+\
+    /* Removes every value smaller than value, returning how many there were */ \
+    size_t CMC_(PFX, _remove_below)(struct SNAME * _set_, V value) \
+    { \
+        if (CMC_(PFX, _empty)(_set_)) \
+        { \
+            _set_->flag = CMC_FLAG_EMPTY; \
+            return 0; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *below = NULL; \
+\
+        CMC_(PFX, _impl_split)(_set_, _set_->root, value, false, &below, &_set_->root); \
+\
+        size_t removed = CMC_(PFX, _impl_free_nodes)(_set_, below); \
+\
+        _set_->count -= removed; \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        if (removed > 0) \
+        { \
+            CMC_CALLBACKS_CALL(_set_, delete); \
+        } \
+\
+        return removed; \
+    } \
 \
     struct SNAME *CMC_(PFX, _new_custom)(struct CMC_DEF_FVAL(SNAME) * f_val, struct CMC_ALLOC_NODE_NAME * alloc, \
                                          struct CMC_CALLBACKS_NAME * callbacks) \
@@ -227,60 +317,7 @@
 \
     void CMC_(PFX, _clear)(struct SNAME * _set_) \
     { \
-        struct CMC_DEF_NODE(SNAME) *scan = _set_->root; \
-        struct CMC_DEF_NODE(SNAME) *up = NULL; \
-\
-        while (scan != NULL) \
-        { \
-            if (scan->left != NULL) \
-            { \
-                struct CMC_DEF_NODE(SNAME) *left = scan->left; \
-\
-                scan->left = up; \
-                up = scan; \
-                scan = left; \
-            } \
-            else if (scan->right != NULL) \
-            { \
-                struct CMC_DEF_NODE(SNAME) *right = scan->right; \
-\
-                scan->left = up; \
-                scan->right = NULL; \
-                up = scan; \
-                scan = right; \
-            } \
-            else \
-            { \
-                if (up == NULL) \
-                { \
-                    if (_set_->f_val->free) \
-                        _set_->f_val->free(scan->value); \
-\
-                    _set_->alloc->free(scan); \
-                    scan = NULL; \
-                } \
-\
-                while (up != NULL) \
-                { \
-                    if (_set_->f_val->free) \
-                        _set_->f_val->free(scan->value); \
-\
-                    _set_->alloc->free(scan); \
-\
-                    if (up->right != NULL) \
-                    { \
-                        scan = up->right; \
-                        up->right = NULL; \
-                        break; \
-                    } \
-                    else \
-                    { \
-                        scan = up; \
-                        up = up->left; \
-                    } \
-                } \
-            } \
-        } \
+        CMC_(PFX, _impl_free_nodes)(_set_, _set_->root); \
 \
         _set_->count = 0; \
         _set_->root = NULL; \
@@ -312,73 +349,30 @@
     bool CMC_(PFX, _insert)(struct SNAME * _set_, V value) \
     { \
         if (CMC_(PFX, _empty)(_set_)) \
-        { \
-            _set_->root = CMC_(PFX, _impl_new_node)(_set_, value); \
-\
-            if (!_set_->root) \
-            { \
-                _set_->flag = CMC_FLAG_ALLOC; \
-                return false; \
-            } \
-        } \
-        else \
-        { \
-            struct CMC_DEF_NODE(SNAME) *scan = _set_->root; \
-            struct CMC_DEF_NODE(SNAME) *parent = scan; \
+            return CMC_(PFX, _impl_attach)(_set_, NULL, false, value) != NULL; \
 \
-            while (scan != NULL) \
-            { \
-                parent = scan; \
-\
-                if (_set_->f_val->cmp(scan->value, value) > 0) \
-                    scan = scan->left; \
-                else if (_set_->f_val->cmp(scan->value, value) < 0) \
-                    scan = scan->right; \
-                else \
-                { \
-                    _set_->flag = CMC_FLAG_DUPLICATE; \
-                    return false; \
-                } \
-            } \
-\
-            struct CMC_DEF_NODE(SNAME) * node; \
+        struct CMC_DEF_NODE(SNAME) *scan = _set_->root; \
+        struct CMC_DEF_NODE(SNAME) *parent = scan; \
 \
-            if (_set_->f_val->cmp(parent->value, value) > 0) \
-            { \
-                parent->left = CMC_(PFX, _impl_new_node)(_set_, value); \
+        int cmp = 0; \
 \
-                if (!parent->left) \
-                { \
-                    _set_->flag = CMC_FLAG_ALLOC; \
-                    return false; \
-                } \
+        while (scan != NULL) \
+        { \
+            parent = scan; \
+            cmp = _set_->f_val->cmp(scan->value, value); \
 \
-                parent->left->parent = parent; \
-                node = parent->left; \
-            } \
+            if (cmp > 0) \
+                scan = scan->left; \
+            else if (cmp < 0) \
+                scan = scan->right; \
             else \
             { \
-                parent->right = CMC_(PFX, _impl_new_node)(_set_, value); \
-\
-                if (!parent->right) \
-                { \
-                    _set_->flag = CMC_FLAG_ALLOC; \
-                    return false; \
-                } \
-\
-                parent->right->parent = parent; \
-                node = parent->right; \
+                _set_->flag = CMC_FLAG_DUPLICATE; \
+                return false; \
             } \
-\
-            CMC_(PFX, _impl_rebalance)(_set_, node); \
         } \
 \
-        _set_->count++; \
-        _set_->flag = CMC_FLAG_OK; \
-\
-        CMC_CALLBACKS_CALL(_set_, create); \
-\
-        return true; \
+        return CMC_(PFX, _impl_attach)(_set_, parent, cmp > 0, value) != NULL; \
     } \
 \
     bool CMC_(PFX, _remove)(struct SNAME * _set_, V value) \
@@ -655,9 +649,11 @@
 \
         while (scan != NULL) \
         { \
-            if (_set_->f_val->cmp(scan->value, value) > 0) \
+            int cmp = _set_->f_val->cmp(scan->value, value); \
+\
+            if (cmp > 0) \
                 scan = scan->left; \
-            else if (_set_->f_val->cmp(scan->value, value) < 0) \
+            else if (cmp < 0) \
                 scan = scan->right; \
             else \
                 return scan; \
@@ -752,6 +748,8 @@
 \
         while (scan != NULL) \
         { \
+            unsigned char height = scan->height; \
+\
             if (scan->parent == NULL) \
                 is_root = true; \
 \
@@ -782,9 +780,221 @@
                 _set_->root = scan; \
                 is_root = false; \
             } \
+\
+            /* The ancestors only depend on the height of this subtree */ \
+            if (scan->height == height) \
+                break; \
 \
             scan = scan->parent; \
         } \
+    } \
+\
+    /* Links a new node as a child of parent, or as the root if parent is */ \
+    /* NULL, and rebalances the tree from it */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_attach)(struct SNAME * _set_, \
+                                                                struct CMC_DEF_NODE(SNAME) * parent, bool left, \
+                                                                V value) \
+    { \
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_new_node)(_set_, value); \
+\
+        if (!node) \
+        { \
+            _set_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        node->parent = parent; \
+\
+        if (!parent) \
+            _set_->root = node; \
+        else if (left) \
+            parent->left = node; \
+        else \
+            parent->right = node; \
+\
+        CMC_(PFX, _impl_rebalance)(_set_, node); \
+\
+        _set_->count++; \
+        _set_->flag = CMC_FLAG_OK; \
+\
+        CMC_CALLBACKS_CALL(_set_, create); \
+\
+        return node; \
+    } \
+\
+    /* Frees every node under scan, with their values, without recursion and */ \
+    /* returns how many there were */ \
+    static size_t CMC_(PFX, _impl_free_nodes)(struct SNAME * _set_, struct CMC_DEF_NODE(SNAME) * scan) \
+    { \
+        size_t count = 0; \
+        struct CMC_DEF_NODE(SNAME) *up = NULL; \
+\
+        while (scan != NULL) \
+        { \
+            if (scan->left != NULL) \
+            { \
+                struct CMC_DEF_NODE(SNAME) *left = scan->left; \
+\
+                scan->left = up; \
+                up = scan; \
+                scan = left; \
+            } \
+            else if (scan->right != NULL) \
+            { \
+                struct CMC_DEF_NODE(SNAME) *right = scan->right; \
+\
+                scan->left = up; \
+                scan->right = NULL; \
+                up = scan; \
+                scan = right; \
+            } \
+            else \
+            { \
+                if (up == NULL) \
+                { \
+                    if (_set_->f_val->free) \
+                        _set_->f_val->free(scan->value); \
+\
+                    _set_->alloc->free(scan); \
+                    count++; \
+                    scan = NULL; \
+                } \
+\
+                while (up != NULL) \
+                { \
+                    if (_set_->f_val->free) \
+                        _set_->f_val->free(scan->value); \
+\
+                    _set_->alloc->free(scan); \
+                    count++; \
+\
+                    if (up->right != NULL) \
+                    { \
+                        scan = up->right; \
+                        up->right = NULL; \
+                        break; \
+                    } \
+                    else \
+                    { \
+                        scan = up; \
+                        up = up->left; \
+                    } \
+                } \
+            } \
+        } \
+\
+        return count; \
+    } \
+\
+    /* Splits the tree at node into the values smaller than value, or also the */ \
+    /* one equal to it if after is true, and the rest. Both trees are */ \
+    /* balanced and it takes O(log n) */ \
+    static void CMC_(PFX, _impl_split)(struct SNAME * _set_, struct CMC_DEF_NODE(SNAME) * node, V value, bool after, \
+                                       struct CMC_DEF_NODE(SNAME) * *left, struct CMC_DEF_NODE(SNAME) * *right) \
+    { \
+        if (!node) \
+        { \
+            *left = NULL; \
+            *right = NULL; \
+            return; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *l = node->left; \
+        struct CMC_DEF_NODE(SNAME) *r = node->right; \
+\
+        if (l) \
+            l->parent = NULL; \
+        if (r) \
+            r->parent = NULL; \
+\
+        int cmp = _set_->f_val->cmp(node->value, value); \
+\
+        if (cmp < 0 || (after && cmp == 0)) \
+        { \
+            CMC_(PFX, _impl_split)(_set_, r, value, after, left, right); \
+\
+            *left = CMC_(PFX, _impl_join)(l, node, *left); \
+        } \
+        else \
+        { \
+            CMC_(PFX, _impl_split)(_set_, l, value, after, left, right); \
+\
+            *right = CMC_(PFX, _impl_join)(*right, node, r); \
+        } \
+    } \
+\
+    /* Joins two trees with middle between them, where every value of left is */ \
+    /* smaller than the one of middle and every value of right is greater. */ \
+    /* It descends the taller tree until the heights match, so it takes time */ \
+    /* proportional to their difference */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_join)(struct CMC_DEF_NODE(SNAME) * left, \
+                                                              struct CMC_DEF_NODE(SNAME) * middle, \
+                                                              struct CMC_DEF_NODE(SNAME) * right) \
+    { \
+        unsigned char h_l = CMC_(PFX, _impl_h)(left); \
+        unsigned char h_r = CMC_(PFX, _impl_h)(right); \
+\
+        if (h_l > h_r + 1) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *sub = CMC_(PFX, _impl_join)(left->right, middle, right); \
+\
+            left->right = sub; \
+            sub->parent = left; \
+\
+            return CMC_(PFX, _impl_fix)(left); \
+        } \
+        else if (h_r > h_l + 1) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *sub = CMC_(PFX, _impl_join)(left, middle, right->left); \
+\
+            right->left = sub; \
+            sub->parent = right; \
+\
+            return CMC_(PFX, _impl_fix)(right); \
+        } \
+\
+        middle->parent = NULL; \
+        middle->left = left; \
+        middle->right = right; \
+\
+        if (left) \
+            left->parent = middle; \
+        if (right) \
+            right->parent = middle; \
+\
+        middle->height = CMC_(PFX, _impl_hupdate)(middle); \
+\
+        return middle; \
+    } \
+\
+    /* Rebalances a single node whose subtrees differ in height by at most */ \
+    /* 2, returning the new root of its subtree */ \
+    static struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _impl_fix)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        int balance = CMC_(PFX, _impl_h)(node->right) - CMC_(PFX, _impl_h)(node->left); \
+\
+        if (balance >= 2) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *child = node->right; \
+\
+            if (CMC_(PFX, _impl_h)(child->right) < CMC_(PFX, _impl_h)(child->left)) \
+                CMC_(PFX, _impl_rotate_right)(&(node->right)); \
+\
+            CMC_(PFX, _impl_rotate_left)(&node); \
+        } \
+        else if (balance <= -2) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *child = node->left; \
+\
+            if (CMC_(PFX, _impl_h)(child->left) < CMC_(PFX, _impl_h)(child->right)) \
+                CMC_(PFX, _impl_rotate_left)(&(node->left)); \
+\
+            CMC_(PFX, _impl_rotate_right)(&node); \
+        } \
+        else \
+            node->height = CMC_(PFX, _impl_hupdate)(node); \
+\
+        return node; \
     }
 
 #endif /* CMC_CMC_TREESET_H */
@@ -110,7 +110,7 @@
  *
  *   PFX - Functions prefix
  * SNAME - `struct` name
- *  SIZE - Size for SAC library
+ *  SIZE - Size for SAC library or inline capacity for CMC List and Stack
  *     K - Key type
  *     V - Value type
  *
@@ -122,4 +122,10 @@
 #define CMC_PARAM_K CMC_TUP_3
 #define CMC_PARAM_V CMC_TUP_4
 
+/**
+ * Evaluates a SIZE parameter as an integer constant expression. An empty SIZE
+ * evaluates to 0.
+ */
+#define CMC_SIZE_OR_ZERO(SIZE) (SIZE + 0)
+
 #endif /* CMC_COR_CORE_H */
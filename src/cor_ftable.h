@@ -48,5 +48,9 @@
 #define CMC_DEF_FTAB_FREE(T) void (*free)(T)
 #define CMC_DEF_FTAB_HASH(T) size_t (*hash)(T)
 #define CMC_DEF_FTAB_PRI(T) int (*pri)(T, T)
+#define CMC_DEF_FTAB_BYTES(T) const unsigned char *(*bytes)(T *, unsigned char *, size_t *)
+#define CMC_DEF_FTAB_COMBINE(T) T (*combine)(T, T)
+#define CMC_DEF_FTAB_APPLY(T) T (*apply)(T, T, size_t)
+#define CMC_DEF_FTAB_FIND(T) size_t (*find)(T *, size_t, T)
 
 #endif /* CMC_COR_FTABLE_H */
@@ -60,6 +60,15 @@ enum cmc_entry_state
     CMC_ES_FILLED = 1
 };
 
+/**
+ * CMC_ENTRY_STATE
+ *
+ * The state of an entry in a flat hashtable that keeps an epoch. Entries
+ * written in an older epoch are left behind by an O(1) clear and are
+ * considered EMPTY.
+ */
+#define CMC_ENTRY_STATE(ENTRY, EPOCH) ((ENTRY).epoch == (EPOCH) ? (ENTRY).state : CMC_ES_EMPTY)
+
 /**
  * static const size_t cmc_hashtable_primes[59]
  *
@@ -0,0 +1,425 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * cor_sort.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+/**
+ * Sorting algorithms shared by array based collections.
+ */
+
+#ifndef CMC_COR_SORT_H
+#define CMC_COR_SORT_H
+
+#include "cor_alloc.h"
+#include "cor_core.h"
+
+/**
+ * CMC_SORT_THREADS
+ *
+ * If defined before including the library, arrays with at least
+ * CMC_SORT_PARALLEL_MIN elements are split into CMC_SORT_THREADS parts. Each
+ * part is sorted by its own thread and then they are merged, also in parallel.
+ * This needs a temporary buffer as large as the array, if it can't be allocated
+ * the array is sorted by the calling thread.
+ */
+#ifdef CMC_SORT_THREADS
+#include "utl_thread.h"
+#endif
+
+#ifndef CMC_SORT_PARALLEL_MIN
+#define CMC_SORT_PARALLEL_MIN 65536
+#endif
+
+/**
+ * CMC_COR_SORT_SOURCE
+ *
+ * Generates the static functions _impl_sort and _impl_stable_sort for arrays of
+ * V. Used inside the SOURCE part of a collection.
+ *
+ * \param PFX Functions prefix
+ * \param V   Value type
+ */
+#define CMC_COR_SORT_SOURCE(PFX, V) \
+    /* Sorting algorithms over arrays, shared by array based collections */ \
+\
+    /* Sorts array[0, count) by insertion, used for small arrays */ \
+    static void CMC_(PFX, _impl_sort_insertion)(V * array, size_t count, int (*cmp)(V, V)) \
+    { \
+        for (size_t i = 1; i < count; i++) \
+        { \
+            V _tmp_ = array[i]; \
+            size_t j = i; \
+\
+            while (j > 0 && cmp(array[j - 1], _tmp_) > 0) \
+            { \
+                array[j] = array[j - 1]; \
+                j--; \
+            } \
+\
+            array[j] = _tmp_; \
+        } \
+    } \
+\
+    /* Sorts array[0, count) with heap sort, used when quicksort recurses too deep */ \
+    static void CMC_(PFX, _impl_sort_heap)(V * array, size_t count, int (*cmp)(V, V)) \
+    { \
+        for (size_t end = count, i = count / 2; end > 1;) \
+        { \
+            /* First build the max-heap, then move its top to the end */ \
+            if (i > 0) \
+                i--; \
+            else \
+            { \
+                end--; \
+                V _tmp_ = array[0]; \
+                array[0] = array[end]; \
+                array[end] = _tmp_; \
+            } \
+\
+            for (size_t node = i, child = i * 2 + 1; child < end; node = child, child = child * 2 + 1) \
+            { \
+                if (child + 1 < end && cmp(array[child + 1], array[child]) > 0) \
+                    child++; \
+\
+                if (cmp(array[child], array[node]) <= 0) \
+                    break; \
+\
+                V _tmp_ = array[node]; \
+                array[node] = array[child]; \
+                array[child] = _tmp_; \
+            } \
+        } \
+    } \
+\
+    /* Characteristics of this quicksort implementation: */ \
+    /* - Hybrid: uses insertion sort for small arrays */ \
+    /* - Pivot: median of three */ \
+    /* - Partition: three-way, so repeated elements are not sorted again */ \
+    /* - Introspective: uses heap sort after depth partitions */ \
+    static void CMC_(PFX, _impl_sort_intro)(V * array, size_t count, int (*cmp)(V, V), size_t depth) \
+    { \
+        while (count > 16) \
+        { \
+            if (depth == 0) \
+            { \
+                CMC_(PFX, _impl_sort_heap)(array, count, cmp); \
+                return; \
+            } \
+\
+            depth--; \
+\
+            size_t mid = count / 2; \
+\
+            if (cmp(array[mid], array[0]) < 0) \
+            { \
+                V _tmp_ = array[mid]; \
+                array[mid] = array[0]; \
+                array[0] = _tmp_; \
+            } \
+            if (cmp(array[count - 1], array[0]) < 0) \
+            { \
+                V _tmp_ = array[count - 1]; \
+                array[count - 1] = array[0]; \
+                array[0] = _tmp_; \
+            } \
+            if (cmp(array[count - 1], array[mid]) < 0) \
+            { \
+                V _tmp_ = array[count - 1]; \
+                array[count - 1] = array[mid]; \
+                array[mid] = _tmp_; \
+            } \
+\
+            V pivot = array[mid]; \
+\
+            /* [0, lt) < pivot, [lt, i) == pivot, [gt, count) > pivot */ \
+            size_t lt = 0, i = 0, gt = count; \
+\
+            while (i < gt) \
+            { \
+                int c = cmp(array[i], pivot); \
+\
+                if (c < 0) \
+                { \
+                    V _tmp_ = array[i]; \
+                    array[i++] = array[lt]; \
+                    array[lt++] = _tmp_; \
+                } \
+                else if (c > 0) \
+                { \
+                    V _tmp_ = array[i]; \
+                    array[i] = array[--gt]; \
+                    array[gt] = _tmp_; \
+                } \
+                else \
+                    i++; \
+            } \
+\
+            /* Recurse into the smaller side and loop over the larger one */ \
+            if (lt < count - gt) \
+            { \
+                CMC_(PFX, _impl_sort_intro)(array, lt, cmp, depth); \
+\
+                array += gt; \
+                count -= gt; \
+            } \
+            else \
+            { \
+                CMC_(PFX, _impl_sort_intro)(array + gt, count - gt, cmp, depth); \
+\
+                count = lt; \
+            } \
+        } \
+\
+        CMC_(PFX, _impl_sort_insertion)(array, count, cmp); \
+    } \
+\
+    /* Merges the sorted runs array[0, half) and array[half, count) */ \
+    /* temp must have room for half elements */ \
+    static void CMC_(PFX, _impl_sort_merge)(V * array, V * temp, size_t half, size_t count, int (*cmp)(V, V)) \
+    { \
+        /* Already in order */ \
+        if (half == 0 || half == count || cmp(array[half - 1], array[half]) <= 0) \
+            return; \
+\
+        memcpy(temp, array, half * sizeof(V)); \
+\
+        size_t i = 0, j = half, k = 0; \
+\
+        /* Taking from the left run on ties keeps the sort stable */ \
+        while (i < half && j < count) \
+        { \
+            if (cmp(array[j], temp[i]) < 0) \
+                array[k++] = array[j++]; \
+            else \
+                array[k++] = temp[i++]; \
+        } \
+\
+        while (i < half) \
+            array[k++] = temp[i++]; \
+    } \
+\
+    /* Stable merge sort of array[0, count), temp must have room for count / 2 elements */ \
+    static void CMC_(PFX, _impl_sort_mergesort)(V * array, V * temp, size_t count, int (*cmp)(V, V)) \
+    { \
+        if (count <= 16) \
+        { \
+            CMC_(PFX, _impl_sort_insertion)(array, count, cmp); \
+            return; \
+        } \
+\
+        size_t half = count / 2; \
+\
+        CMC_(PFX, _impl_sort_mergesort)(array, temp, half, cmp); \
+        CMC_(PFX, _impl_sort_mergesort)(array + half, temp, count - half, cmp); \
+        CMC_(PFX, _impl_sort_merge)(array, temp, half, count, cmp); \
+    } \
+\
+    /* Maximum depth of quicksort partitions before switching to heap sort */ \
+    static size_t CMC_(PFX, _impl_sort_depth)(size_t count) \
+    { \
+        size_t depth = 0; \
+\
+        while (count > 1) \
+        { \
+            count /= 2; \
+            depth += 2; \
+        } \
+\
+        return depth; \
+    } \
+\
+    CMC_COR_SORT_PARALLEL_SOURCE_(PFX, V) \
+\
+    /* Sorts array[0, count), not stable */ \
+    static void CMC_(PFX, _impl_sort)(V * array, size_t count, int (*cmp)(V, V), struct CMC_ALLOC_NODE_NAME * alloc) \
+    { \
+        if (count >= CMC_SORT_PARALLEL_MIN && CMC_(PFX, _impl_sort_parallel)(array, count, cmp, alloc, false)) \
+            return; \
+\
+        CMC_(PFX, _impl_sort_intro)(array, count, cmp, CMC_(PFX, _impl_sort_depth)(count)); \
+    } \
+\
+    /* Sorts array[0, count) keeping equal elements in order */ \
+    /* Returns false if the temporary buffer could not be allocated */ \
+    static bool CMC_(PFX, _impl_stable_sort)(V * array, size_t count, int (*cmp)(V, V), \
+                                             struct CMC_ALLOC_NODE_NAME * alloc) \
+    { \
+        if (count <= 16) \
+        { \
+            CMC_(PFX, _impl_sort_insertion)(array, count, cmp); \
+            return true; \
+        } \
+\
+        if (count >= CMC_SORT_PARALLEL_MIN && CMC_(PFX, _impl_sort_parallel)(array, count, cmp, alloc, true)) \
+            return true; \
+\
+        V *temp = alloc->malloc((count / 2) * sizeof(V)); \
+\
+        if (!temp) \
+            return false; \
+\
+        CMC_(PFX, _impl_sort_mergesort)(array, temp, count, cmp); \
+\
+        alloc->free(temp); \
+\
+        return true; \
+    }
+
+#ifdef CMC_SORT_THREADS
+
+#define CMC_COR_SORT_PARALLEL_SOURCE_(PFX, V) \
+    /* A part of the array sorted or merged by a thread */ \
+    struct CMC_(PFX, _impl_sort_task) \
+    { \
+        V *array; \
+        V *temp; \
+        /* If 0 sort array[0, count), otherwise merge array[0, half) and array[half, count) */ \
+        size_t half; \
+        size_t count; \
+        int (*cmp)(V, V); \
+        bool stable; \
+    }; \
+\
+    static int CMC_(PFX, _impl_sort_task_run)(void *args) \
+    { \
+        struct CMC_(PFX, _impl_sort_task) *task = args; \
+\
+        if (task->half > 0) \
+            CMC_(PFX, _impl_sort_merge)(task->array, task->temp, task->half, task->count, task->cmp); \
+        else if (task->stable) \
+            CMC_(PFX, _impl_sort_mergesort)(task->array, task->temp, task->count, task->cmp); \
+        else \
+        { \
+            size_t depth = CMC_(PFX, _impl_sort_depth)(task->count); \
+\
+            CMC_(PFX, _impl_sort_intro)(task->array, task->count, task->cmp, depth); \
+        } \
+\
+        return 0; \
+    } \
+\
+    /* Runs every task on its own thread, the first one on the calling thread */ \
+    static void CMC_(PFX, _impl_sort_tasks)(struct CMC_(PFX, _impl_sort_task) * tasks, size_t count) \
+    { \
+        struct cmc_thread threads[CMC_SORT_THREADS]; \
+        bool spawned[CMC_SORT_THREADS]; \
+\
+        for (size_t i = 1; i < count; i++) \
+        { \
+            spawned[i] = cmc_thrd_create(&threads[i], CMC_(PFX, _impl_sort_task_run), &tasks[i]); \
+\
+            /* Not enough threads, run it here instead */ \
+            if (!spawned[i]) \
+                CMC_(PFX, _impl_sort_task_run)(&tasks[i]); \
+        } \
+\
+        CMC_(PFX, _impl_sort_task_run)(&tasks[0]); \
+\
+        for (size_t i = 1; i < count; i++) \
+        { \
+            if (spawned[i]) \
+                cmc_thrd_join(&threads[i], NULL); \
+        } \
+    } \
+\
+    /* Sorts CMC_SORT_THREADS parts of the array in parallel and then merges them */ \
+    /* in rounds, also in parallel. Returns false if it could not allocate. */ \
+    static bool CMC_(PFX, _impl_sort_parallel)(V * array, size_t count, int (*cmp)(V, V), \
+                                               struct CMC_ALLOC_NODE_NAME * alloc, bool stable) \
+    { \
+        size_t parts = CMC_SORT_THREADS; \
+\
+        if (parts < 2 || count < parts) \
+            return false; \
+\
+        V *temp = alloc->malloc(count * sizeof(V)); \
+\
+        if (!temp) \
+            return false; \
+\
+        size_t bounds[CMC_SORT_THREADS + 1]; \
+        struct CMC_(PFX, _impl_sort_task) tasks[CMC_SORT_THREADS]; \
+\
+        for (size_t i = 0; i < parts; i++) \
+            bounds[i] = (count / parts) * i; \
+\
+        bounds[parts] = count; \
+\
+        for (size_t i = 0; i < parts; i++) \
+        { \
+            tasks[i] = (struct CMC_(PFX, _impl_sort_task)){ array + bounds[i], temp + bounds[i], 0, \
+                                                            bounds[i + 1] - bounds[i], cmp, stable }; \
+        } \
+\
+        CMC_(PFX, _impl_sort_tasks)(tasks, parts); \
+\
+        /* Merge adjacent parts, doubling their width every round */ \
+        for (size_t width = 1; width < parts; width *= 2) \
+        { \
+            size_t merges = 0; \
+\
+            for (size_t i = 0; i + width < parts; i += 2 * width) \
+            { \
+                size_t end = i + 2 * width < parts ? i + 2 * width : parts; \
+\
+                tasks[merges++] = (struct CMC_(PFX, _impl_sort_task)){ array + bounds[i], temp + bounds[i], \
+                                                                       bounds[i + width] - bounds[i], \
+                                                                       bounds[end] - bounds[i], cmp, stable }; \
+            } \
+\
+            CMC_(PFX, _impl_sort_tasks)(tasks, merges); \
+        } \
+\
+        alloc->free(temp); \
+\
+        return true; \
+    }
+
+#else
+
+#define CMC_COR_SORT_PARALLEL_SOURCE_(PFX, V) \
+    /* Parallel sorting is disabled, see CMC_SORT_THREADS */ \
+    static bool CMC_(PFX, _impl_sort_parallel)(V * array, size_t count, int (*cmp)(V, V), \
+                                               struct CMC_ALLOC_NODE_NAME * alloc, bool stable) \
+    { \
+        (void)array; \
+        (void)count; \
+        (void)cmp; \
+        (void)alloc; \
+        (void)stable; \
+\
+        return false; \
+    }
+
+#endif
+
+#endif /* CMC_COR_SORT_H */
@@ -0,0 +1,505 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * ext_cmc_artmap.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+#ifndef CMC_EXT_CMC_ARTMAP_H
+#define CMC_EXT_CMC_ARTMAP_H
+
+#include "cor_core.h"
+
+/**
+ * All the EXT parts of CMC ArtMap.
+ */
+#define CMC_EXT_CMC_ARTMAP_PARTS ITER, STR
+
+/**
+ * ITER
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_ARTMAP_ITER(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_ARTMAP_ITER_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_ARTMAP_ITER_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_ARTMAP_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                    CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ARTMAP_ITER_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_ARTMAP_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                    CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ARTMAP_ITER_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_ARTMAP_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                    CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ARTMAP_ITER_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_ARTMAP_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                    CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ARTMAP_ITER_HEADER_(PFX, SNAME, K, V) \
+\
+    /* Artmap Iterator */ \
+    struct CMC_DEF_ITER(SNAME) \
+    { \
+        /* Target artmap */ \
+        struct SNAME *target; \
+\
+        /* Cursor's current entry */ \
+        struct CMC_DEF_ENTRY(SNAME) * cursor; \
+\
+        /* The first entry in the iteration */ \
+        struct CMC_DEF_ENTRY(SNAME) * first; \
+\
+        /* The last entry in the iteration */ \
+        struct CMC_DEF_ENTRY(SNAME) * last; \
+\
+        /* How many entries are between first and last */ \
+        size_t count; \
+\
+        /* Keeps track of relative index to the iteration of elements */ \
+        size_t index; \
+\
+        /* If the iterator has reached the start of the iteration */ \
+        bool start; \
+\
+        /* If the iterator has reached the end of the iteration */ \
+        bool end; \
+    }; \
+\
+    /* Iterator Initialization */ \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target); \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target); \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_prefix)(struct SNAME * target, K prefix); \
+    /* Iterator State */ \
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    /* Iterator Movement */ \
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index); \
+    /* Iterator Access */ \
+    K CMC_(PFX, _iter_key)(struct CMC_DEF_ITER(SNAME) * iter); \
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter); \
+    V *CMC_(PFX, _iter_rvalue)(struct CMC_DEF_ITER(SNAME) * iter); \
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter);
+
+#define CMC_EXT_CMC_ARTMAP_ITER_SOURCE_(PFX, SNAME, K, V) \
+\
+    /* Implementation Detail Functions */ \
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_max)(struct CMC_DEF_NODE(SNAME) * node); \
+    static bool CMC_(PFX, _impl_prefix_range)(struct SNAME * _map_, const unsigned char *bytes, size_t length, \
+                                              struct CMC_DEF_ENTRY(SNAME) * *first, \
+                                              struct CMC_DEF_ENTRY(SNAME) * *last); \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.cursor = target->head; \
+        iter.first = target->head; \
+        iter.last = target->tail; \
+        iter.count = target->count; \
+        iter.index = 0; \
+        iter.start = true; \
+        iter.end = iter.count == 0; \
+\
+        return iter; \
+    } \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.cursor = target->tail; \
+        iter.first = target->head; \
+        iter.last = target->tail; \
+        iter.count = target->count; \
+        iter.index = iter.count == 0 ? 0 : iter.count - 1; \
+        iter.start = iter.count == 0; \
+        iter.end = true; \
+\
+        return iter; \
+    } \
+\
+    /* An iterator over the keys that start with prefix, positioned at the start */ \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_prefix)(struct SNAME * target, K prefix) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        unsigned char buffer[CMC_ART_BUFFER]; \
+        size_t length; \
+        const unsigned char *bytes = target->f_key->bytes(&prefix, buffer, &length); \
+\
+        iter.target = target; \
+        iter.first = NULL; \
+        iter.last = NULL; \
+        iter.count = 0; \
+        iter.index = 0; \
+        iter.start = true; \
+        iter.end = true; \
+\
+        if (CMC_(PFX, _impl_prefix_range)(target, bytes, length, &iter.first, &iter.last)) \
+        { \
+            iter.count = 1; \
+\
+            for (struct CMC_DEF_ENTRY(SNAME) *scan = iter.first; scan != iter.last; scan = scan->next) \
+                iter.count++; \
+\
+            iter.end = false; \
+        } \
+\
+        iter.cursor = iter.first; \
+\
+        return iter; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->count == 0 || iter->start; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->count == 0 || iter->end; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count != 0) \
+        { \
+            iter->index = 0; \
+            iter->start = true; \
+            iter->end = false; \
+            iter->cursor = iter->first; \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count != 0) \
+        { \
+            iter->index = iter->count - 1; \
+            iter->start = false; \
+            iter->end = true; \
+            iter->cursor = iter->last; \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->cursor == iter->last) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        iter->start = false; \
+        iter->cursor = iter->cursor->next; \
+        iter->index++; \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->cursor == iter->first) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        iter->end = false; \
+        iter->cursor = iter->cursor->prev; \
+        iter->index--; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->cursor == iter->last) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->index + steps >= iter->count) \
+            return false; \
+\
+        for (size_t i = 0; i < steps; i++) \
+            CMC_(PFX, _iter_next)(iter); \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->cursor == iter->first) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->index < steps) \
+            return false; \
+\
+        for (size_t i = 0; i < steps; i++) \
+            CMC_(PFX, _iter_prev)(iter); \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator was able to be positioned at the */ \
+    /* given index */ \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index) \
+    { \
+        if (index >= iter->count) \
+            return false; \
+\
+        if (iter->index > index) \
+            return CMC_(PFX, _iter_rewind)(iter, iter->index - index); \
+        else if (iter->index < index) \
+            return CMC_(PFX, _iter_advance)(iter, index - iter->index); \
+\
+        return true; \
+    } \
+\
+    K CMC_(PFX, _iter_key)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count == 0) \
+            return (K){ 0 }; \
+\
+        return iter->cursor->key; \
+    } \
+\
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count == 0) \
+            return (V){ 0 }; \
+\
+        return iter->cursor->value; \
+    } \
+\
+    V *CMC_(PFX, _iter_rvalue)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count == 0) \
+            return NULL; \
+\
+        return &(iter->cursor->value); \
+    } \
+\
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->index; \
+    } \
+\
+    static struct CMC_DEF_ENTRY(SNAME) * CMC_(PFX, _impl_max)(struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        while (node && !CMC_ART_IS_ENTRY(node)) \
+        { \
+            struct CMC_DEF_NODE(SNAME) *last = CMC_(PFX, _impl_last_child)(node); \
+\
+            if (!last) \
+                return node->entry; \
+\
+            node = last; \
+        } \
+\
+        return node ? CMC_ART_ENTRY(node) : NULL; \
+    } \
+\
+    /* Finds the first and the last entries whose keys start with the given bytes */ \
+    static bool CMC_(PFX, _impl_prefix_range)(struct SNAME * _map_, const unsigned char *bytes, size_t length, \
+                                              struct CMC_DEF_ENTRY(SNAME) * *first, \
+                                              struct CMC_DEF_ENTRY(SNAME) * *last) \
+    { \
+        unsigned char other[CMC_ART_BUFFER]; \
+        size_t other_length; \
+\
+        struct CMC_DEF_NODE(SNAME) *node = _map_->root; \
+        size_t depth = 0; \
+\
+        while (node) \
+        { \
+            if (CMC_ART_IS_ENTRY(node)) \
+            { \
+                struct CMC_DEF_ENTRY(SNAME) *leaf = CMC_ART_ENTRY(node); \
+                const unsigned char *leaf_bytes = _map_->f_key->bytes(&leaf->key, other, &other_length); \
+\
+                if (other_length < length || memcmp(leaf_bytes, bytes, length) != 0) \
+                    return false; \
+\
+                *first = leaf; \
+                *last = leaf; \
+\
+                return true; \
+            } \
+\
+            size_t remaining = length - depth; \
+            size_t compare = node->prefix_len < remaining ? node->prefix_len : remaining; \
+\
+            if (memcmp(CMC_ART_PREFIX_OF(node), bytes + depth, compare) != 0) \
+                return false; \
+\
+            /* The prefix ends inside this node so the whole subtree matches */ \
+            if (node->prefix_len >= remaining) \
+            { \
+                *first = CMC_(PFX, _impl_min)(node); \
+                *last = CMC_(PFX, _impl_max)(node); \
+\
+                return true; \
+            } \
+\
+            depth += node->prefix_len; \
+\
+            struct CMC_DEF_NODE(SNAME) **child = CMC_(PFX, _impl_find_child)(node, bytes[depth]); \
+\
+            if (!child) \
+                return false; \
+\
+            node = *child; \
+            depth++; \
+        } \
+\
+        return false; \
+    }
+
+/**
+ * STR
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_ARTMAP_STR(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_ARTMAP_STR_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_ARTMAP_STR_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_ARTMAP_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                   CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ARTMAP_STR_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_ARTMAP_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                   CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ARTMAP_STR_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_ARTMAP_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                   CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ARTMAP_STR_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_ARTMAP_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                   CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ARTMAP_STR_HEADER_(PFX, SNAME, K, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _map_, FILE * fptr); \
+    bool CMC_(PFX, _print)(struct SNAME * _map_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end, const char *key_val_sep);
+
+#define CMC_EXT_CMC_ARTMAP_STR_SOURCE_(PFX, SNAME, K, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _map_, FILE * fptr) \
+    { \
+        struct SNAME *m_ = _map_; \
+\
+        return 0 <= fprintf(fptr, \
+                            "struct %s<%s, %s> " \
+                            "at %p { " \
+                            "root:%p, " \
+                            "head:%p, " \
+                            "tail:%p, " \
+                            "count:%" PRIuMAX ", " \
+                            "flag:%d, " \
+                            "f_val:%p, " \
+                            "f_key:%p, " \
+                            "alloc:%p, " \
+                            "callbacks:%p }", \
+                            CMC_TO_STRING(SNAME), CMC_TO_STRING(K), CMC_TO_STRING(V), m_, m_->root, m_->head, \
+                            m_->tail, m_->count, m_->flag, m_->f_key, m_->f_val, m_->alloc, CMC_CALLBACKS_GET(m_)); \
+    } \
+\
+    bool CMC_(PFX, _print)(struct SNAME * _map_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end, const char *key_val_sep) \
+    { \
+        fprintf(fptr, "%s", start); \
+\
+        for (struct CMC_DEF_ENTRY(SNAME) *scan = _map_->head; scan; scan = scan->next) \
+        { \
+            if (!_map_->f_key->str(fptr, scan->key)) \
+                return false; \
+\
+            fprintf(fptr, "%s", key_val_sep); \
+\
+            if (!_map_->f_val->str(fptr, scan->value)) \
+                return false; \
+\
+            if (scan->next) \
+                fprintf(fptr, "%s", separator); \
+        } \
+\
+        fprintf(fptr, "%s", end); \
+\
+        return true; \
+    }
+
+#endif /* CMC_EXT_CMC_ARTMAP_H */
@@ -0,0 +1,390 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * ext_cmc_disjointset.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+#ifndef CMC_EXT_CMC_DISJOINTSET_H
+#define CMC_EXT_CMC_DISJOINTSET_H
+
+#include "cor_core.h"
+
+/**
+ * All the EXT parts of CMC DisjointSet.
+ */
+#define CMC_EXT_CMC_DISJOINTSET_PARTS ITER, STR
+
+/**
+ * ITER
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_DISJOINTSET_ITER(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_DISJOINTSET_ITER_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_DISJOINTSET_ITER_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_DISJOINTSET_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_DISJOINTSET_ITER_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_DISJOINTSET_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_DISJOINTSET_ITER_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_DISJOINTSET_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_DISJOINTSET_ITER_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_DISJOINTSET_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_DISJOINTSET_ITER_HEADER_(PFX, SNAME, V) \
+\
+    /* DisjointSet Iterator */ \
+    /* Iterates over the values of a single set, starting at a given value */ \
+    struct CMC_DEF_ITER(SNAME) \
+    { \
+        /* Target DisjointSet */ \
+        struct SNAME *target; \
+\
+        /* The value where the iteration starts */ \
+        size_t first; \
+\
+        /* Cursor's position (the value itself) */ \
+        size_t cursor; \
+\
+        /* Keeps track of relative index to the iteration of values */ \
+        size_t index; \
+\
+        /* How many values are in the set */ \
+        size_t count; \
+\
+        /* If the iterator has reached the start of the iteration */ \
+        bool start; \
+\
+        /* If the iterator has reached the end of the iteration */ \
+        bool end; \
+    }; \
+\
+    /* Iterator Initialization */ \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target, V value); \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target, V value); \
+    /* Iterator State */ \
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    /* Iterator Movement */ \
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index); \
+    /* Iterator Access */ \
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter); \
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter);
+
+#define CMC_EXT_CMC_DISJOINTSET_ITER_SOURCE_(PFX, SNAME, V) \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target, V value) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.first = (size_t)value; \
+        iter.cursor = (size_t)value; \
+        iter.index = 0; \
+        iter.count = 0; \
+        iter.start = true; \
+        iter.end = true; \
+\
+        if ((size_t)value < target->count) \
+        { \
+            iter.count = target->size[CMC_(PFX, _impl_find)(target, (size_t)value)]; \
+            iter.end = false; \
+        } \
+\
+        return iter; \
+    } \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target, V value) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter = CMC_(PFX, _iter_start)(target, value); \
+\
+        if (iter.count > 0) \
+        { \
+            iter.cursor = target->prev[iter.first]; \
+            iter.index = iter.count - 1; \
+            iter.start = false; \
+            iter.end = true; \
+        } \
+\
+        return iter; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->count == 0 || iter->start; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->count == 0 || iter->end; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count > 0) \
+        { \
+            iter->cursor = iter->first; \
+            iter->index = 0; \
+            iter->start = true; \
+            iter->end = false; \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count > 0) \
+        { \
+            iter->cursor = iter->target->prev[iter->first]; \
+            iter->index = iter->count - 1; \
+            iter->start = false; \
+            iter->end = true; \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->index + 1 == iter->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        iter->start = false; \
+\
+        iter->cursor = iter->target->next[iter->cursor]; \
+        iter->index++; \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->index == 0) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        iter->end = false; \
+\
+        iter->cursor = iter->target->prev[iter->cursor]; \
+        iter->index--; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->index + 1 == iter->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->index + steps >= iter->count) \
+            return false; \
+\
+        iter->start = false; \
+\
+        for (size_t i = 0; i < steps; i++) \
+            iter->cursor = iter->target->next[iter->cursor]; \
+\
+        iter->index += steps; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->index == 0) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->index < steps) \
+            return false; \
+\
+        iter->end = false; \
+\
+        for (size_t i = 0; i < steps; i++) \
+            iter->cursor = iter->target->prev[iter->cursor]; \
+\
+        iter->index -= steps; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator was able to be positioned at the */ \
+    /* given index */ \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index) \
+    { \
+        if (index >= iter->count) \
+            return false; \
+\
+        if (iter->index > index) \
+            return CMC_(PFX, _iter_rewind)(iter, iter->index - index); \
+        else if (iter->index < index) \
+            return CMC_(PFX, _iter_advance)(iter, index - iter->index); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count == 0) \
+            return (V){ 0 }; \
+\
+        return (V)iter->cursor; \
+    } \
+\
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->index; \
+    }
+
+/**
+ * STR
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_DISJOINTSET_STR(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_DISJOINTSET_STR_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_DISJOINTSET_STR_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_DISJOINTSET_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_DISJOINTSET_STR_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_DISJOINTSET_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_DISJOINTSET_STR_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_DISJOINTSET_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_DISJOINTSET_STR_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_DISJOINTSET_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_DISJOINTSET_STR_HEADER_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _set_, FILE * fptr); \
+    bool CMC_(PFX, _print)(struct SNAME * _set_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end);
+
+#define CMC_EXT_CMC_DISJOINTSET_STR_SOURCE_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _set_, FILE * fptr) \
+    { \
+        struct SNAME *s_ = _set_; \
+\
+        return 0 <= fprintf(fptr, \
+                            "struct %s<%s> " \
+                            "at %p { " \
+                            "parent:%p, " \
+                            "rank:%p, " \
+                            "size:%p, " \
+                            "next:%p, " \
+                            "prev:%p, " \
+                            "count:%" PRIuMAX ", " \
+                            "sets:%" PRIuMAX ", " \
+                            "flag:%d, " \
+                            "f_val:%p, " \
+                            "alloc:%p, " \
+                            "callbacks: %p }", \
+                            CMC_TO_STRING(SNAME), CMC_TO_STRING(V), s_, s_->parent, s_->rank, s_->size, s_->next, \
+                            s_->prev, s_->count, s_->sets, s_->flag, s_->f_val, s_->alloc, CMC_CALLBACKS_GET(s_)); \
+    } \
+\
+    /* Prints every set, each one surrounded by start and end */ \
+    bool CMC_(PFX, _print)(struct SNAME * _set_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end) \
+    { \
+        for (size_t i = 0; i < _set_->count; i++) \
+        { \
+            if (_set_->parent[i] != i) \
+                continue; \
+\
+            fprintf(fptr, "%s", start); \
+\
+            size_t cursor = i; \
+\
+            do \
+            { \
+                if (!_set_->f_val->str(fptr, (V)cursor)) \
+                    return false; \
+\
+                cursor = _set_->next[cursor]; \
+\
+                if (cursor != i) \
+                    fprintf(fptr, "%s", separator); \
+            } while (cursor != i); \
+\
+            fprintf(fptr, "%s", end); \
+        } \
+\
+        return true; \
+    }
+
+#endif /* CMC_EXT_CMC_DISJOINTSET_H */
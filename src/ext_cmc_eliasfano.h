@@ -0,0 +1,380 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * ext_cmc_eliasfano.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+#ifndef CMC_EXT_CMC_ELIASFANO_H
+#define CMC_EXT_CMC_ELIASFANO_H
+
+#include "cor_core.h"
+
+/**
+ * All the EXT parts of CMC EliasFano.
+ */
+#define CMC_EXT_CMC_ELIASFANO_PARTS ITER, STR
+
+/**
+ * ITER
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_ELIASFANO_ITER(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_ELIASFANO_ITER_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_ELIASFANO_ITER_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_ELIASFANO_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ELIASFANO_ITER_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_ELIASFANO_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ELIASFANO_ITER_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_ELIASFANO_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ELIASFANO_ITER_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_ELIASFANO_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ELIASFANO_ITER_HEADER_(PFX, SNAME, V) \
+\
+    /* EliasFano Iterator */ \
+    struct CMC_DEF_ITER(SNAME) \
+    { \
+        /* Target EliasFano */ \
+        struct SNAME *target; \
+\
+        /* Cursor's position (the set bit of the current value in upper) */ \
+        size_t cursor; \
+\
+        /* Keeps track of relative index to the iteration of values */ \
+        size_t index; \
+\
+        /* If the iterator has reached the start of the iteration */ \
+        bool start; \
+\
+        /* If the iterator has reached the end of the iteration */ \
+        bool end; \
+    }; \
+\
+    /* Iterator Initialization */ \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target); \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target); \
+    /* Iterator State */ \
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    /* Iterator Movement */ \
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index); \
+    /* Iterator Access */ \
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter); \
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter);
+
+#define CMC_EXT_CMC_ELIASFANO_ITER_SOURCE_(PFX, SNAME, V) \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.cursor = 0; \
+        iter.index = 0; \
+        iter.start = true; \
+        iter.end = CMC_(PFX, _empty)(target); \
+\
+        if (!iter.end) \
+            iter.cursor = CMC_(PFX, _impl_select)(target, 0, true); \
+\
+        return iter; \
+    } \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.cursor = 0; \
+        iter.index = 0; \
+        iter.start = CMC_(PFX, _empty)(target); \
+        iter.end = true; \
+\
+        if (!iter.start) \
+        { \
+            iter.index = target->count - 1; \
+            iter.cursor = CMC_(PFX, _impl_select)(target, iter.index, true); \
+        } \
+\
+        return iter; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return CMC_(PFX, _empty)(iter->target) || iter->start; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return CMC_(PFX, _empty)(iter->target) || iter->end; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (!CMC_(PFX, _empty)(iter->target)) \
+        { \
+            iter->cursor = CMC_(PFX, _impl_select)(iter->target, 0, true); \
+            iter->index = 0; \
+            iter->start = true; \
+            iter->end = false; \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (!CMC_(PFX, _empty)(iter->target)) \
+        { \
+            iter->index = iter->target->count - 1; \
+            iter->cursor = CMC_(PFX, _impl_select)(iter->target, iter->index, true); \
+            iter->start = false; \
+            iter->end = true; \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->index + 1 == iter->target->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        iter->start = false; \
+\
+        /* Scans for the next set bit, which is always there */ \
+        size_t position = iter->cursor + 1; \
+        size_t w = position / 64; \
+        uint64_t word = iter->target->upper[w] & (~(uint64_t)0 << (position % 64)); \
+\
+        while (!word) \
+            word = iter->target->upper[++w]; \
+\
+        iter->cursor = w * 64 + CMC_(PFX, _impl_lowest_bit)(word); \
+        iter->index++; \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->index == 0) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        iter->end = false; \
+\
+        iter->index--; \
+        iter->cursor = CMC_(PFX, _impl_select)(iter->target, iter->index, true); \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->index + 1 == iter->target->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->index + steps >= iter->target->count) \
+            return false; \
+\
+        iter->start = false; \
+\
+        iter->index += steps; \
+        iter->cursor = CMC_(PFX, _impl_select)(iter->target, iter->index, true); \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->index == 0) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->index < steps) \
+            return false; \
+\
+        iter->end = false; \
+\
+        iter->index -= steps; \
+        iter->cursor = CMC_(PFX, _impl_select)(iter->target, iter->index, true); \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator was able to be positioned at the */ \
+    /* given index */ \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index) \
+    { \
+        if (index >= iter->target->count) \
+            return false; \
+\
+        if (iter->index > index) \
+            return CMC_(PFX, _iter_rewind)(iter, iter->index - index); \
+        else if (iter->index < index) \
+            return CMC_(PFX, _iter_advance)(iter, index - iter->index); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (CMC_(PFX, _empty)(iter->target)) \
+            return (V){ 0 }; \
+\
+        uint64_t high = iter->cursor - iter->index; \
+\
+        return (V)((high << iter->target->low_bits) | CMC_(PFX, _impl_low)(iter->target, iter->index)); \
+    } \
+\
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->index; \
+    }
+
+/**
+ * STR
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_ELIASFANO_STR(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_ELIASFANO_STR_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_ELIASFANO_STR_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_ELIASFANO_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ELIASFANO_STR_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_ELIASFANO_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ELIASFANO_STR_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_ELIASFANO_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ELIASFANO_STR_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_ELIASFANO_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_ELIASFANO_STR_HEADER_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _ef_, FILE * fptr); \
+    bool CMC_(PFX, _print)(struct SNAME * _ef_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end);
+
+#define CMC_EXT_CMC_ELIASFANO_STR_SOURCE_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _ef_, FILE * fptr) \
+    { \
+        struct SNAME *e_ = _ef_; \
+\
+        return 0 <= fprintf(fptr, \
+                            "struct %s<%s> " \
+                            "at %p { " \
+                            "lower:%p, " \
+                            "upper:%p, " \
+                            "ones:%p, " \
+                            "zeros:%p, " \
+                            "count:%" PRIuMAX ", " \
+                            "low_bits:%" PRIuMAX ", " \
+                            "length:%" PRIuMAX ", " \
+                            "flag:%d, " \
+                            "alloc:%p, " \
+                            "callbacks: %p }", \
+                            CMC_TO_STRING(SNAME), CMC_TO_STRING(V), e_, e_->lower, e_->upper, e_->ones, e_->zeros, \
+                            e_->count, e_->low_bits, e_->length, e_->flag, e_->alloc, CMC_CALLBACKS_GET(e_)); \
+    } \
+\
+    /* Values are printed as unsigned integers */ \
+    bool CMC_(PFX, _print)(struct SNAME * _ef_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end) \
+    { \
+        fprintf(fptr, "%s", start); \
+\
+        for (size_t i = 0; i < _ef_->count; i++) \
+        { \
+            uint64_t high = CMC_(PFX, _impl_select)(_ef_, i, true) - i; \
+            V value = (V)((high << _ef_->low_bits) | CMC_(PFX, _impl_low)(_ef_, i)); \
+\
+            if (fprintf(fptr, "%" PRIuMAX, (uintmax_t)value) < 0) \
+                return false; \
+\
+            if (i + 1 < _ef_->count) \
+                fprintf(fptr, "%s", separator); \
+        } \
+\
+        fprintf(fptr, "%s", end); \
+\
+        return true; \
+    }
+
+#endif /* CMC_EXT_CMC_ELIASFANO_H */
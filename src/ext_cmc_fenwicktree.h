@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * ext_cmc_fenwicktree.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+#ifndef CMC_EXT_CMC_FENWICKTREE_H
+#define CMC_EXT_CMC_FENWICKTREE_H
+
+#include "cor_core.h"
+
+/**
+ * All the EXT parts of CMC FenwickTree.
+ */
+#define CMC_EXT_CMC_FENWICKTREE_PARTS STR
+
+/**
+ * STR
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_FENWICKTREE_STR(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_FENWICKTREE_STR_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_FENWICKTREE_STR_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_FENWICKTREE_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_FENWICKTREE_STR_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_FENWICKTREE_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_FENWICKTREE_STR_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_FENWICKTREE_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_FENWICKTREE_STR_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_FENWICKTREE_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_FENWICKTREE_STR_HEADER_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _tree_, FILE * fptr); \
+    bool CMC_(PFX, _print)(struct SNAME * _tree_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end);
+
+#define CMC_EXT_CMC_FENWICKTREE_STR_SOURCE_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _tree_, FILE * fptr) \
+    { \
+        struct SNAME *t_ = _tree_; \
+\
+        return 0 <= fprintf(fptr, \
+                            "struct %s<%s> " \
+                            "at %p { " \
+                            "values:%p, " \
+                            "tree:%p, " \
+                            "count:%" PRIuMAX ", " \
+                            "flag:%d, " \
+                            "f_val:%p, " \
+                            "alloc:%p, " \
+                            "callbacks: %p }", \
+                            CMC_TO_STRING(SNAME), CMC_TO_STRING(V), t_, t_->values, t_->tree, t_->count, t_->flag, \
+                            t_->f_val, t_->alloc, CMC_CALLBACKS_GET(t_)); \
+    } \
+\
+    bool CMC_(PFX, _print)(struct SNAME * _tree_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end) \
+    { \
+        fprintf(fptr, "%s", start); \
+\
+        for (size_t i = 0; i < _tree_->count; i++) \
+        { \
+            if (!_tree_->f_val->str(fptr, _tree_->values[i])) \
+                return false; \
+\
+            if (i + 1 < _tree_->count) \
+                fprintf(fptr, "%s", separator); \
+        } \
+\
+        fprintf(fptr, "%s", end); \
+\
+        return true; \
+    }
+
+#endif /* CMC_EXT_CMC_FENWICKTREE_H */
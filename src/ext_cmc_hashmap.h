@@ -133,7 +133,7 @@
             { \
                 struct CMC_DEF_ENTRY(SNAME) *entry = &(_map_.buffer[i]); \
 \
-                if (entry->state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(*entry, _map_.epoch) == CMC_ES_FILLED) \
                 { \
                     if (_map_.f_key->free) \
                         _map_.f_key->free(entry->key); \
@@ -237,7 +237,7 @@
         { \
             for (size_t i = 0; i < target->capacity; i++) \
             { \
-                if (target->buffer[i].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.first = i; \
                     break; \
@@ -248,7 +248,7 @@
 \
             for (size_t i = target->capacity; i > 0; i--) \
             { \
-                if (target->buffer[i - 1].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i - 1], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.last = i - 1; \
                     break; \
@@ -275,7 +275,7 @@
         { \
             for (size_t i = 0; i < target->capacity; i++) \
             { \
-                if (target->buffer[i].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.first = i; \
                     break; \
@@ -284,7 +284,7 @@
 \
             for (size_t i = target->capacity; i > 0; i--) \
             { \
-                if (target->buffer[i - 1].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i - 1], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.last = i - 1; \
                     break; \
@@ -360,7 +360,7 @@
             iter->cursor++; \
             scan = &(iter->target->buffer[iter->cursor]); \
 \
-            if (scan->state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(*scan, iter->target->epoch) == CMC_ES_FILLED) \
                 break; \
         } \
 \
@@ -389,7 +389,7 @@
             iter->cursor--; \
             scan = &(iter->target->buffer[iter->cursor]); \
 \
-            if (scan->state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(*scan, iter->target->epoch) == CMC_ES_FILLED) \
                 break; \
         } \
 \
@@ -544,7 +544,7 @@
         size_t last = 0; \
         for (size_t i = _map_->capacity; i > 0; i--) \
         { \
-            if ((_map_->buffer[i - 1]).state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_map_->buffer[i - 1], _map_->epoch) == CMC_ES_FILLED) \
             { \
                 last = i - 1; \
                 break; \
@@ -555,7 +555,7 @@
         { \
             struct CMC_DEF_ENTRY(SNAME) *entry = &(_map_->buffer[i]); \
 \
-            if (entry->state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(*entry, _map_->epoch) == CMC_ES_FILLED) \
             { \
                 if (!_map_->f_key->str(fptr, entry->key)) \
                     return false; \
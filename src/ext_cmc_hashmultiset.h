@@ -128,7 +128,7 @@
         { \
             for (size_t i = 0; i < target->capacity; i++) \
             { \
-                if (target->buffer[i].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.first = i; \
                     break; \
@@ -139,7 +139,7 @@
 \
             for (size_t i = target->capacity; i > 0; i--) \
             { \
-                if (target->buffer[i - 1].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i - 1], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.last = i - 1; \
                     break; \
@@ -166,7 +166,7 @@
         { \
             for (size_t i = 0; i < target->capacity; i++) \
             { \
-                if (target->buffer[i].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.first = i; \
                     break; \
@@ -175,7 +175,7 @@
 \
             for (size_t i = target->capacity; i > 0; i--) \
             { \
-                if (target->buffer[i - 1].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i - 1], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.last = i - 1; \
                     break; \
@@ -251,7 +251,7 @@
             iter->cursor++; \
             scan = &(iter->target->buffer[iter->cursor]); \
 \
-            if (scan->state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(*scan, iter->target->epoch) == CMC_ES_FILLED) \
                 break; \
         } \
 \
@@ -280,7 +280,7 @@
             iter->cursor--; \
             scan = &(iter->target->buffer[iter->cursor]); \
 \
-            if (scan->state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(*scan, iter->target->epoch) == CMC_ES_FILLED) \
                 break; \
         } \
 \
@@ -715,7 +715,7 @@
         size_t last = 0; \
         for (size_t i = _set_->capacity; i > 0; i--) \
         { \
-            if ((_set_->buffer[i - 1]).state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_set_->buffer[i - 1], _set_->epoch) == CMC_ES_FILLED) \
             { \
                 last = i - 1; \
                 break; \
@@ -726,7 +726,7 @@
         { \
             struct CMC_DEF_ENTRY(SNAME) *entry = &(_set_->buffer[i]); \
 \
-            if (entry->state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(*entry, _set_->epoch) == CMC_ES_FILLED) \
             { \
                 if (!_set_->f_val->str(fptr, entry->value)) \
                     return false; \
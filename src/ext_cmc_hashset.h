@@ -127,7 +127,7 @@
         { \
             for (size_t i = 0; i < target->capacity; i++) \
             { \
-                if (target->buffer[i].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.first = i; \
                     break; \
@@ -138,7 +138,7 @@
 \
             for (size_t i = target->capacity; i > 0; i--) \
             { \
-                if (target->buffer[i - 1].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i - 1], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.last = i - 1; \
                     break; \
@@ -165,7 +165,7 @@
         { \
             for (size_t i = 0; i < target->capacity; i++) \
             { \
-                if (target->buffer[i].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.first = i; \
                     break; \
@@ -174,7 +174,7 @@
 \
             for (size_t i = target->capacity; i > 0; i--) \
             { \
-                if (target->buffer[i - 1].state == CMC_ES_FILLED) \
+                if (CMC_ENTRY_STATE(target->buffer[i - 1], target->epoch) == CMC_ES_FILLED) \
                 { \
                     iter.last = i - 1; \
                     break; \
@@ -250,7 +250,7 @@
             iter->cursor++; \
             scan = &(iter->target->buffer[iter->cursor]); \
 \
-            if (scan->state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(*scan, iter->target->epoch) == CMC_ES_FILLED) \
                 break; \
         } \
 \
@@ -279,7 +279,7 @@
             iter->cursor--; \
             scan = &(iter->target->buffer[iter->cursor]); \
 \
-            if (scan->state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(*scan, iter->target->epoch) == CMC_ES_FILLED) \
                 break; \
         } \
 \
@@ -688,7 +688,7 @@
         size_t last = 0; \
         for (size_t i = _set_->capacity; i > 0; i--) \
         { \
-            if ((_set_->buffer[i - 1]).state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(_set_->buffer[i - 1], _set_->epoch) == CMC_ES_FILLED) \
             { \
                 last = i - 1; \
                 break; \
@@ -699,7 +699,7 @@
         { \
             struct CMC_DEF_ENTRY(SNAME) *entry = &(_set_->buffer[i]); \
 \
-            if (entry->state == CMC_ES_FILLED) \
+            if (CMC_ENTRY_STATE(*entry, _set_->epoch) == CMC_ES_FILLED) \
             { \
                 if (!_set_->f_val->str(fptr, entry->value)) \
                     return false; \
@@ -319,12 +319,13 @@
                             "capacity:%" PRIuMAX ", " \
                             "size:%" PRIuMAX ", " \
                             "count:%" PRIuMAX ", " \
+                            "limit:%" PRIuMAX ", " \
                             "flag:%d, " \
                             "f_val:%p, " \
                             "alloc:%p, " \
                             "callbacks:%p }", \
                             CMC_TO_STRING(SNAME), CMC_TO_STRING(V), h_, h_->buffer, h_->capacity, h_->size, h_->count, \
-                            h_->flag, h_->f_val, h_->alloc, CMC_CALLBACKS_GET(h_)); \
+                            h_->limit, h_->flag, h_->f_val, h_->alloc, CMC_CALLBACKS_GET(h_)); \
     } \
 \
     bool CMC_(PFX, _print)(struct SNAME * _heap_, FILE * fptr, const char *start, const char *separator, \
@@ -0,0 +1,457 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * ext_cmc_ptreemap.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+#ifndef CMC_EXT_CMC_PTREEMAP_H
+#define CMC_EXT_CMC_PTREEMAP_H
+
+#include "cor_core.h"
+
+/**
+ * All the EXT parts of CMC PTreeMap.
+ */
+#define CMC_EXT_CMC_PTREEMAP_PARTS ITER, STR
+
+/**
+ * ITER
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_PTREEMAP_ITER(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_PTREEMAP_ITER_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_PTREEMAP_ITER_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_PTREEMAP_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_PTREEMAP_ITER_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_PTREEMAP_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_PTREEMAP_ITER_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_PTREEMAP_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_PTREEMAP_ITER_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_PTREEMAP_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_PTREEMAP_ITER_HEADER_(PFX, SNAME, K, V) \
+\
+    /* PTreeMap Iterator */ \
+    struct CMC_DEF_ITER(SNAME) \
+    { \
+        /* Target ptreemap */ \
+        struct SNAME *target; \
+\
+        /* Nodes from the root to the cursor, since nodes have no parent */ \
+        struct CMC_DEF_NODE(SNAME) * path[CMC_PTREEMAP_DEPTH]; \
+\
+        /* Index in path of the cursor */ \
+        size_t depth; \
+\
+        /* Keeps track of relative index to the iteration of elements */ \
+        size_t index; \
+\
+        /* If the iterator has reached the start of the iteration */ \
+        bool start; \
+\
+        /* If the iterator has reached the end of the iteration */ \
+        bool end; \
+    }; \
+\
+    /* Iterator Initialization */ \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target); \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target); \
+    /* Iterator State */ \
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    /* Iterator Movement */ \
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index); \
+    /* Iterator Access */ \
+    K CMC_(PFX, _iter_key)(struct CMC_DEF_ITER(SNAME) * iter); \
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter); \
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter);
+
+#define CMC_EXT_CMC_PTREEMAP_ITER_SOURCE_(PFX, SNAME, K, V) \
+\
+    /* Implementation Detail Functions */ \
+    static void CMC_(PFX, _impl_iter_first)(struct CMC_DEF_ITER(SNAME) * iter, size_t depth, \
+                                            struct CMC_DEF_NODE(SNAME) * node); \
+    static void CMC_(PFX, _impl_iter_last)(struct CMC_DEF_ITER(SNAME) * iter, size_t depth, \
+                                           struct CMC_DEF_NODE(SNAME) * node); \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.depth = 0; \
+        iter.index = 0; \
+        iter.start = true; \
+        iter.end = CMC_(PFX, _empty)(target); \
+\
+        if (!CMC_(PFX, _empty)(target)) \
+            CMC_(PFX, _impl_iter_first)(&iter, 0, target->root); \
+\
+        return iter; \
+    } \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.depth = 0; \
+        iter.index = 0; \
+        iter.start = CMC_(PFX, _empty)(target); \
+        iter.end = true; \
+\
+        if (!CMC_(PFX, _empty)(target)) \
+        { \
+            iter.index = target->count - 1; \
+\
+            CMC_(PFX, _impl_iter_last)(&iter, 0, target->root); \
+        } \
+\
+        return iter; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return CMC_(PFX, _empty)(iter->target) || iter->start; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return CMC_(PFX, _empty)(iter->target) || iter->end; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (!CMC_(PFX, _empty)(iter->target)) \
+        { \
+            *iter = CMC_(PFX, _iter_start)(iter->target); \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (!CMC_(PFX, _empty)(iter->target)) \
+        { \
+            *iter = CMC_(PFX, _iter_end)(iter->target); \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->index + 1 >= iter->target->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        iter->start = CMC_(PFX, _empty)(iter->target); \
+\
+        struct CMC_DEF_NODE(SNAME) *node = iter->path[iter->depth]; \
+\
+        if (node->right) \
+            CMC_(PFX, _impl_iter_first)(iter, iter->depth + 1, node->right); \
+        else \
+        { \
+            /* Goes up until the cursor comes from a left child */ \
+            while (iter->path[iter->depth - 1]->right == iter->path[iter->depth]) \
+                iter->depth--; \
+\
+            iter->depth--; \
+        } \
+\
+        iter->index++; \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->index == 0) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        iter->end = CMC_(PFX, _empty)(iter->target); \
+\
+        struct CMC_DEF_NODE(SNAME) *node = iter->path[iter->depth]; \
+\
+        if (node->left) \
+            CMC_(PFX, _impl_iter_last)(iter, iter->depth + 1, node->left); \
+        else \
+        { \
+            /* Goes up until the cursor comes from a right child */ \
+            while (iter->path[iter->depth - 1]->left == iter->path[iter->depth]) \
+                iter->depth--; \
+\
+            iter->depth--; \
+        } \
+\
+        iter->index--; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->index + 1 >= iter->target->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->index + steps >= iter->target->count) \
+            return false; \
+\
+        for (size_t i = 0; i < steps; i++) \
+            CMC_(PFX, _iter_next)(iter); \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->index == 0) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->index < steps) \
+            return false; \
+\
+        for (size_t i = 0; i < steps; i++) \
+            CMC_(PFX, _iter_prev)(iter); \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator was able to be positioned at the */ \
+    /* given index */ \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index) \
+    { \
+        if (index >= iter->target->count) \
+            return false; \
+\
+        if (iter->index > index) \
+            return CMC_(PFX, _iter_rewind)(iter, iter->index - index); \
+        else if (iter->index < index) \
+            return CMC_(PFX, _iter_advance)(iter, index - iter->index); \
+\
+        return true; \
+    } \
+\
+    K CMC_(PFX, _iter_key)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (CMC_(PFX, _empty)(iter->target)) \
+            return (K){ 0 }; \
+\
+        return iter->path[iter->depth]->key; \
+    } \
+\
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (CMC_(PFX, _empty)(iter->target)) \
+            return (V){ 0 }; \
+\
+        return iter->path[iter->depth]->value; \
+    } \
+\
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->index; \
+    } \
+\
+    /* Puts node at depth in the path and descends to its smallest key */ \
+    static void CMC_(PFX, _impl_iter_first)(struct CMC_DEF_ITER(SNAME) * iter, size_t depth, \
+                                            struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        iter->path[depth] = node; \
+\
+        while (node->left) \
+        { \
+            node = node->left; \
+            iter->path[++depth] = node; \
+        } \
+\
+        iter->depth = depth; \
+    } \
+\
+    /* Puts node at depth in the path and descends to its greatest key */ \
+    static void CMC_(PFX, _impl_iter_last)(struct CMC_DEF_ITER(SNAME) * iter, size_t depth, \
+                                           struct CMC_DEF_NODE(SNAME) * node) \
+    { \
+        iter->path[depth] = node; \
+\
+        while (node->right) \
+        { \
+            node = node->right; \
+            iter->path[++depth] = node; \
+        } \
+\
+        iter->depth = depth; \
+    }
+
+/**
+ * STR
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_PTREEMAP_STR(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_PTREEMAP_STR_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_PTREEMAP_STR_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_PTREEMAP_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                     CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_PTREEMAP_STR_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_PTREEMAP_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                     CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_PTREEMAP_STR_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_PTREEMAP_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                     CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_PTREEMAP_STR_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_PTREEMAP_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                     CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_PTREEMAP_STR_HEADER_(PFX, SNAME, K, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _map_, FILE * fptr); \
+    bool CMC_(PFX, _print)(struct SNAME * _map_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end, const char *key_val_sep);
+
+#define CMC_EXT_CMC_PTREEMAP_STR_SOURCE_(PFX, SNAME, K, V) \
+\
+    /* Implementation Detail Functions */ \
+    static bool CMC_(PFX, _impl_print_node)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, FILE * fptr, \
+                                            size_t * printed, const char *separator, const char *key_val_sep); \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _map_, FILE * fptr) \
+    { \
+        struct SNAME *m_ = _map_; \
+\
+        return 0 <= fprintf(fptr, \
+                            "struct %s<%s, %s> " \
+                            "at %p { " \
+                            "root:%p, " \
+                            "count:%" PRIuMAX ", " \
+                            "flag:%d, " \
+                            "f_val:%p, " \
+                            "f_key:%p, " \
+                            "alloc:%p, " \
+                            "callbacks:%p }", \
+                            CMC_TO_STRING(SNAME), CMC_TO_STRING(K), CMC_TO_STRING(V), m_, m_->root, m_->count, \
+                            m_->flag, m_->f_key, m_->f_val, m_->alloc, CMC_CALLBACKS_GET(m_)); \
+    } \
+\
+    bool CMC_(PFX, _print)(struct SNAME * _map_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end, const char *key_val_sep) \
+    { \
+        fprintf(fptr, "%s", start); \
+\
+        size_t printed = 0; \
+\
+        if (!CMC_(PFX, _impl_print_node)(_map_, _map_->root, fptr, &printed, separator, key_val_sep)) \
+            return false; \
+\
+        fprintf(fptr, "%s", end); \
+\
+        return true; \
+    } \
+\
+    /* Prints the keys under node in order */ \
+    static bool CMC_(PFX, _impl_print_node)(struct SNAME * _map_, struct CMC_DEF_NODE(SNAME) * node, FILE * fptr, \
+                                            size_t * printed, const char *separator, const char *key_val_sep) \
+    { \
+        if (!node) \
+            return true; \
+\
+        if (!CMC_(PFX, _impl_print_node)(_map_, node->left, fptr, printed, separator, key_val_sep)) \
+            return false; \
+\
+        if (!_map_->f_key->str(fptr, node->key)) \
+            return false; \
+\
+        fprintf(fptr, "%s", key_val_sep); \
+\
+        if (!_map_->f_val->str(fptr, node->value)) \
+            return false; \
+\
+        if (++(*printed) < _map_->count) \
+            fprintf(fptr, "%s", separator); \
+\
+        return CMC_(PFX, _impl_print_node)(_map_, node->right, fptr, printed, separator, key_val_sep); \
+    }
+
+#endif /* CMC_EXT_CMC_PTREEMAP_H */
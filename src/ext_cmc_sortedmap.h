@@ -0,0 +1,416 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * ext_cmc_sortedmap.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+#ifndef CMC_EXT_CMC_SORTEDMAP_H
+#define CMC_EXT_CMC_SORTEDMAP_H
+
+#include "cor_core.h"
+
+/**
+ * All the EXT parts of CMC SortedMap.
+ */
+#define CMC_EXT_CMC_SORTEDMAP_PARTS ITER, STR
+
+/**
+ * ITER
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_SORTEDMAP_ITER(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_SORTEDMAP_ITER_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_SORTEDMAP_ITER_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_SORTEDMAP_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                       CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SORTEDMAP_ITER_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SORTEDMAP_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                       CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SORTEDMAP_ITER_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_SORTEDMAP_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                       CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SORTEDMAP_ITER_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SORTEDMAP_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                       CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SORTEDMAP_ITER_HEADER_(PFX, SNAME, K, V) \
+\
+    /* SortedMap Iterator */ \
+    struct CMC_DEF_ITER(SNAME) \
+    { \
+        /* Target SortedMap */ \
+        struct SNAME *target; \
+\
+        /* Cursor's position (index) */ \
+        size_t cursor; \
+\
+        /* The index of the first pair in the iteration */ \
+        size_t first; \
+\
+        /* How many pairs are in the iteration */ \
+        size_t count; \
+\
+        /* If the iterator has reached the start of the iteration */ \
+        bool start; \
+\
+        /* If the iterator has reached the end of the iteration */ \
+        bool end; \
+    }; \
+\
+    /* Iterator Initialization */ \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target); \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target); \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_range)(struct SNAME * target, K from, K to); \
+    /* Iterator State */ \
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    /* Iterator Movement */ \
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index); \
+    /* Iterator Access */ \
+    K CMC_(PFX, _iter_key)(struct CMC_DEF_ITER(SNAME) * iter); \
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter); \
+    V *CMC_(PFX, _iter_rvalue)(struct CMC_DEF_ITER(SNAME) * iter); \
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter);
+
+#define CMC_EXT_CMC_SORTEDMAP_ITER_SOURCE_(PFX, SNAME, K, V) \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.cursor = 0; \
+        iter.first = 0; \
+        iter.count = CMC_(PFX, _count)(target); \
+        iter.start = true; \
+        iter.end = iter.count == 0; \
+\
+        return iter; \
+    } \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.cursor = 0; \
+        iter.first = 0; \
+        iter.count = CMC_(PFX, _count)(target); \
+        iter.start = iter.count == 0; \
+        iter.end = true; \
+\
+        if (iter.count > 0) \
+            iter.cursor = iter.count - 1; \
+\
+        return iter; \
+    } \
+\
+    /* Iterates over every key that is in the range [from, to) */ \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_range)(struct SNAME * target, K from, K to) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        CMC_(PFX, _merge)(target); \
+\
+        size_t first = CMC_(PFX, _impl_lower_bound)(target, from); \
+        size_t last = CMC_(PFX, _impl_lower_bound)(target, to); \
+\
+        iter.target = target; \
+        iter.cursor = first; \
+        iter.first = first; \
+        iter.count = last > first ? last - first : 0; \
+        iter.start = true; \
+        iter.end = iter.count == 0; \
+\
+        return iter; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->count == 0 || iter->start; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->count == 0 || iter->end; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count > 0) \
+        { \
+            iter->cursor = iter->first; \
+            iter->start = true; \
+            iter->end = false; \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count > 0) \
+        { \
+            iter->cursor = iter->first + iter->count - 1; \
+            iter->start = false; \
+            iter->end = true; \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->cursor + 1 == iter->first + iter->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        iter->start = false; \
+\
+        iter->cursor++; \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->cursor == iter->first) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        iter->end = false; \
+\
+        iter->cursor--; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->cursor + 1 == iter->first + iter->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->cursor + steps >= iter->first + iter->count) \
+            return false; \
+\
+        iter->start = false; \
+\
+        iter->cursor += steps; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->cursor == iter->first) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->cursor - iter->first < steps) \
+            return false; \
+\
+        iter->end = false; \
+\
+        iter->cursor -= steps; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator was able to be positioned at the */ \
+    /* given index */ \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index) \
+    { \
+        if (index >= iter->count) \
+            return false; \
+\
+        size_t current = iter->cursor - iter->first; \
+\
+        if (current > index) \
+            return CMC_(PFX, _iter_rewind)(iter, current - index); \
+        else if (current < index) \
+            return CMC_(PFX, _iter_advance)(iter, index - current); \
+\
+        return true; \
+    } \
+\
+    K CMC_(PFX, _iter_key)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count == 0) \
+            return (K){ 0 }; \
+\
+        return iter->target->keys[iter->cursor]; \
+    } \
+\
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count == 0) \
+            return (V){ 0 }; \
+\
+        return iter->target->values[iter->cursor]; \
+    } \
+\
+    V *CMC_(PFX, _iter_rvalue)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->count == 0) \
+            return NULL; \
+\
+        return &(iter->target->values[iter->cursor]); \
+    } \
+\
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->cursor - iter->first; \
+    }
+
+/**
+ * STR
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_SORTEDMAP_STR(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_SORTEDMAP_STR_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_SORTEDMAP_STR_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_SORTEDMAP_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SORTEDMAP_STR_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SORTEDMAP_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SORTEDMAP_STR_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_SORTEDMAP_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SORTEDMAP_STR_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SORTEDMAP_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_K(PARAMS), \
+                                      CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SORTEDMAP_STR_HEADER_(PFX, SNAME, K, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _map_, FILE * fptr); \
+    bool CMC_(PFX, _print)(struct SNAME * _map_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end, const char *key_val_sep);
+
+#define CMC_EXT_CMC_SORTEDMAP_STR_SOURCE_(PFX, SNAME, K, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _map_, FILE * fptr) \
+    { \
+        struct SNAME *m_ = _map_; \
+\
+        return 0 <= fprintf(fptr, \
+                            "struct %s<%s, %s> " \
+                            "at %p { " \
+                            "keys:%p, " \
+                            "values:%p, " \
+                            "capacity:%" PRIuMAX ", " \
+                            "count:%" PRIuMAX ", " \
+                            "pending:%" PRIuMAX ", " \
+                            "flag:%d, " \
+                            "f_key:%p, " \
+                            "f_val:%p, " \
+                            "alloc:%p, " \
+                            "callbacks:%p }", \
+                            CMC_TO_STRING(SNAME), CMC_TO_STRING(K), CMC_TO_STRING(V), m_, m_->keys, m_->values, \
+                            m_->capacity, m_->count, m_->pending, m_->flag, m_->f_key, m_->f_val, m_->alloc, \
+                            CMC_CALLBACKS_GET(m_)); \
+    } \
+\
+    bool CMC_(PFX, _print)(struct SNAME * _map_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end, const char *key_val_sep) \
+    { \
+        CMC_(PFX, _merge)(_map_); \
+\
+        fprintf(fptr, "%s", start); \
+\
+        for (size_t i = 0; i < _map_->count; i++) \
+        { \
+            if (!_map_->f_key->str(fptr, _map_->keys[i])) \
+                return false; \
+\
+            fprintf(fptr, "%s", key_val_sep); \
+\
+            if (!_map_->f_val->str(fptr, _map_->values[i])) \
+                return false; \
+\
+            if (i + 1 < _map_->count) \
+                fprintf(fptr, "%s", separator); \
+        } \
+\
+        fprintf(fptr, "%s", end); \
+\
+        return true; \
+    }
+
+#endif /* CMC_EXT_CMC_SORTEDMAP_H */
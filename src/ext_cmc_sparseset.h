@@ -0,0 +1,576 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * ext_cmc_sparseset.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+#ifndef CMC_EXT_CMC_SPARSESET_H
+#define CMC_EXT_CMC_SPARSESET_H
+
+#include "cor_core.h"
+
+/**
+ * All the EXT parts of CMC SparseSet.
+ */
+#define CMC_EXT_CMC_SPARSESET_PARTS ITER, SETF, STR
+
+/**
+ * ITER
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_SPARSESET_ITER(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_SPARSESET_ITER_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_SPARSESET_ITER_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_ITER_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_ITER_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_ITER_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_ITER_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_ITER_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_ITER_HEADER_(PFX, SNAME, V) \
+\
+    /* SparseSet Iterator */ \
+    struct CMC_DEF_ITER(SNAME) \
+    { \
+        /* Target SparseSet */ \
+        struct SNAME *target; \
+\
+        /* Cursor's position (index) in the dense array */ \
+        size_t cursor; \
+\
+        /* If the iterator has reached the start of the iteration */ \
+        bool start; \
+\
+        /* If the iterator has reached the end of the iteration */ \
+        bool end; \
+    }; \
+\
+    /* Iterator Initialization */ \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target); \
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target); \
+    /* Iterator State */ \
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    /* Iterator Movement */ \
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter); \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps); \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index); \
+    /* Iterator Access */ \
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter); \
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter);
+
+#define CMC_EXT_CMC_SPARSESET_ITER_SOURCE_(PFX, SNAME, V) \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_start)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.cursor = 0; \
+        iter.start = true; \
+        iter.end = CMC_(PFX, _empty)(target); \
+\
+        return iter; \
+    } \
+\
+    struct CMC_DEF_ITER(SNAME) CMC_(PFX, _iter_end)(struct SNAME * target) \
+    { \
+        struct CMC_DEF_ITER(SNAME) iter; \
+\
+        iter.target = target; \
+        iter.cursor = 0; \
+        iter.start = CMC_(PFX, _empty)(target); \
+        iter.end = true; \
+\
+        if (!CMC_(PFX, _empty)(target)) \
+            iter.cursor = target->count - 1; \
+\
+        return iter; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return CMC_(PFX, _empty)(iter->target) || iter->start; \
+    } \
+\
+    bool CMC_(PFX, _iter_at_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return CMC_(PFX, _empty)(iter->target) || iter->end; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_start)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (!CMC_(PFX, _empty)(iter->target)) \
+        { \
+            iter->cursor = 0; \
+            iter->start = true; \
+            iter->end = CMC_(PFX, _empty)(iter->target); \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_to_end)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (!CMC_(PFX, _empty)(iter->target)) \
+        { \
+            iter->start = CMC_(PFX, _empty)(iter->target); \
+            iter->cursor = iter->target->count - 1; \
+            iter->end = true; \
+\
+            return true; \
+        } \
+\
+        return false; \
+    } \
+\
+    bool CMC_(PFX, _iter_next)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->cursor + 1 == iter->target->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        iter->start = CMC_(PFX, _empty)(iter->target); \
+\
+        iter->cursor++; \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _iter_prev)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->cursor == 0) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        iter->end = CMC_(PFX, _empty)(iter->target); \
+\
+        iter->cursor--; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_advance)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->end) \
+            return false; \
+\
+        if (iter->cursor + 1 == iter->target->count) \
+        { \
+            iter->end = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->cursor + steps >= iter->target->count) \
+            return false; \
+\
+        iter->start = CMC_(PFX, _empty)(iter->target); \
+\
+        iter->cursor += steps; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator moved */ \
+    bool CMC_(PFX, _iter_rewind)(struct CMC_DEF_ITER(SNAME) * iter, size_t steps) \
+    { \
+        if (iter->start) \
+            return false; \
+\
+        if (iter->cursor == 0) \
+        { \
+            iter->start = true; \
+            return false; \
+        } \
+\
+        if (steps == 0 || iter->cursor < steps) \
+            return false; \
+\
+        iter->end = CMC_(PFX, _empty)(iter->target); \
+\
+        iter->cursor -= steps; \
+\
+        return true; \
+    } \
+\
+    /* Returns true only if the iterator was able to be positioned at the */ \
+    /* given index */ \
+    bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index) \
+    { \
+        if (index >= iter->target->count) \
+            return false; \
+\
+        if (iter->cursor > index) \
+            return CMC_(PFX, _iter_rewind)(iter, iter->cursor - index); \
+        else if (iter->cursor < index) \
+            return CMC_(PFX, _iter_advance)(iter, index - iter->cursor); \
+\
+        return true; \
+    } \
+\
+    V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        if (CMC_(PFX, _empty)(iter->target)) \
+            return (V){ 0 }; \
+\
+        return iter->target->dense[iter->cursor]; \
+    } \
+\
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter) \
+    { \
+        return iter->cursor; \
+    }
+
+/**
+ * SETF
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_SPARSESET_SETF(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_SPARSESET_SETF_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_SPARSESET_SETF_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_SETF_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_SETF_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_SETF_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_SETF_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_SETF_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_SETF_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_SETF_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_SETF_HEADER_(PFX, SNAME, V) \
+\
+    /* Set Operations */ \
+    struct SNAME *CMC_(PFX, _union)(struct SNAME * _set1_, struct SNAME * _set2_); \
+    struct SNAME *CMC_(PFX, _intersection)(struct SNAME * _set1_, struct SNAME * _set2_); \
+    struct SNAME *CMC_(PFX, _difference)(struct SNAME * _set1_, struct SNAME * _set2_); \
+    struct SNAME *CMC_(PFX, _symmetric_difference)(struct SNAME * _set1_, struct SNAME * _set2_); \
+    bool CMC_(PFX, _is_subset)(struct SNAME * _set1_, struct SNAME * _set2_); \
+    bool CMC_(PFX, _is_superset)(struct SNAME * _set1_, struct SNAME * _set2_); \
+    bool CMC_(PFX, _is_proper_subset)(struct SNAME * _set1_, struct SNAME * _set2_); \
+    bool CMC_(PFX, _is_proper_superset)(struct SNAME * _set1_, struct SNAME * _set2_); \
+    bool CMC_(PFX, _is_disjointset)(struct SNAME * _set1_, struct SNAME * _set2_);
+
+#define CMC_EXT_CMC_SPARSESET_SETF_SOURCE_(PFX, SNAME, V) \
+\
+    /* The result of a set operation is created big enough for every value */ \
+    /* it can hold so that inserting into it never has to resize */ \
+\
+    struct SNAME *CMC_(PFX, _union)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        size_t capacity = _set1_->capacity > _set2_->capacity ? _set1_->capacity : _set2_->capacity; \
+\
+        /* Callbacks are added later */ \
+        struct SNAME *_set_r_ = CMC_(PFX, _new_custom)(capacity, _set1_->f_val, _set1_->alloc, NULL); \
+\
+        if (!_set_r_) \
+        { \
+            _set1_->flag = CMC_FLAG_ALLOC; \
+            _set2_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        for (size_t i = 0; i < _set1_->count; i++) \
+            CMC_(PFX, _insert)(_set_r_, _set1_->dense[i]); \
+\
+        for (size_t i = 0; i < _set2_->count; i++) \
+        { \
+            if (!CMC_(PFX, _impl_contains)(_set1_, _set2_->dense[i])) \
+                CMC_(PFX, _insert)(_set_r_, _set2_->dense[i]); \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(_set_r_, _set1_->callbacks); \
+\
+        return _set_r_; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _intersection)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        struct SNAME *_set_A_ = _set1_->count < _set2_->count ? _set1_ : _set2_; \
+        struct SNAME *_set_B_ = _set_A_ == _set1_ ? _set2_ : _set1_; \
+\
+        /* Callbacks are added later */ \
+        struct SNAME *_set_r_ = CMC_(PFX, _new_custom)(_set_A_->capacity, _set1_->f_val, _set1_->alloc, NULL); \
+\
+        if (!_set_r_) \
+        { \
+            _set1_->flag = CMC_FLAG_ALLOC; \
+            _set2_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        for (size_t i = 0; i < _set_A_->count; i++) \
+        { \
+            if (CMC_(PFX, _impl_contains)(_set_B_, _set_A_->dense[i])) \
+                CMC_(PFX, _insert)(_set_r_, _set_A_->dense[i]); \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(_set_r_, _set1_->callbacks); \
+\
+        return _set_r_; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _difference)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        /* Callbacks are added later */ \
+        struct SNAME *_set_r_ = CMC_(PFX, _new_custom)(_set1_->capacity, _set1_->f_val, _set1_->alloc, NULL); \
+\
+        if (!_set_r_) \
+        { \
+            _set1_->flag = CMC_FLAG_ALLOC; \
+            _set2_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        for (size_t i = 0; i < _set1_->count; i++) \
+        { \
+            if (!CMC_(PFX, _impl_contains)(_set2_, _set1_->dense[i])) \
+                CMC_(PFX, _insert)(_set_r_, _set1_->dense[i]); \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(_set_r_, _set1_->callbacks); \
+\
+        return _set_r_; \
+    } \
+\
+    struct SNAME *CMC_(PFX, _symmetric_difference)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        size_t capacity = _set1_->capacity > _set2_->capacity ? _set1_->capacity : _set2_->capacity; \
+\
+        /* Callbacks are added later */ \
+        struct SNAME *_set_r_ = CMC_(PFX, _new_custom)(capacity, _set1_->f_val, _set1_->alloc, NULL); \
+\
+        if (!_set_r_) \
+        { \
+            _set1_->flag = CMC_FLAG_ALLOC; \
+            _set2_->flag = CMC_FLAG_ALLOC; \
+            return NULL; \
+        } \
+\
+        for (size_t i = 0; i < _set1_->count; i++) \
+        { \
+            if (!CMC_(PFX, _impl_contains)(_set2_, _set1_->dense[i])) \
+                CMC_(PFX, _insert)(_set_r_, _set1_->dense[i]); \
+        } \
+\
+        for (size_t i = 0; i < _set2_->count; i++) \
+        { \
+            if (!CMC_(PFX, _impl_contains)(_set1_, _set2_->dense[i])) \
+                CMC_(PFX, _insert)(_set_r_, _set2_->dense[i]); \
+        } \
+\
+        CMC_CALLBACKS_ASSIGN(_set_r_, _set1_->callbacks); \
+\
+        return _set_r_; \
+    } \
+\
+    /* Is _set1_ a subset of _set2_ ? */ \
+    /* A set X is a subset of a set Y when: X <= Y */ \
+    /* If X is a subset of Y, then Y is a superset of X */ \
+    bool CMC_(PFX, _is_subset)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        _set1_->flag = CMC_FLAG_OK; \
+        _set2_->flag = CMC_FLAG_OK; \
+\
+        /* If the cardinality of _set1_ is greater than that of _set2_, */ \
+        /* then it is safe to say that _set1_ can't be a subset of _set2_ */ \
+        if (_set1_->count > _set2_->count) \
+            return false; \
+\
+        for (size_t i = 0; i < _set1_->count; i++) \
+        { \
+            if (!CMC_(PFX, _impl_contains)(_set2_, _set1_->dense[i])) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    /* Is _set1_ a superset of _set2_ ? */ \
+    /* A set X is a superset of a set Y when: X >= Y */ \
+    /* If X is a superset of Y, then Y is a subset of X */ \
+    bool CMC_(PFX, _is_superset)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        return CMC_(PFX, _is_subset)(_set2_, _set1_); \
+    } \
+\
+    /* Is _set1_ a proper subset of _set2_ ? */ \
+    /* A set X is a proper subset of a set Y when: X < Y */ \
+    /* If X is a proper subset of Y, then Y is a proper superset of X */ \
+    bool CMC_(PFX, _is_proper_subset)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        _set1_->flag = CMC_FLAG_OK; \
+        _set2_->flag = CMC_FLAG_OK; \
+\
+        /* If the cardinality of _set1_ is greater than or equal to that of */ \
+        /* _set2_, then it is safe to say that _set1_ can't be a proper */ \
+        /* subset of _set2_ */ \
+        if (_set1_->count >= _set2_->count) \
+            return false; \
+\
+        for (size_t i = 0; i < _set1_->count; i++) \
+        { \
+            if (!CMC_(PFX, _impl_contains)(_set2_, _set1_->dense[i])) \
+                return false; \
+        } \
+\
+        return true; \
+    } \
+\
+    /* Is _set1_ a proper superset of _set2_ ? */ \
+    /* A set X is a proper superset of a set Y when: X > Y */ \
+    /* If X is a proper superset of Y, then Y is a proper subset of X */ \
+    bool CMC_(PFX, _is_proper_superset)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        return CMC_(PFX, _is_proper_subset)(_set2_, _set1_); \
+    } \
+\
+    /* Is _set1_ a disjointset of _set2_ ? */ \
+    /* A set X is a disjointset of a set Y if their intersection is empty, */ \
+    /* that is, if there are no elements in common between the two */ \
+    bool CMC_(PFX, _is_disjointset)(struct SNAME * _set1_, struct SNAME * _set2_) \
+    { \
+        _set1_->flag = CMC_FLAG_OK; \
+        _set2_->flag = CMC_FLAG_OK; \
+\
+        struct SNAME *_set_A_ = _set1_->count < _set2_->count ? _set1_ : _set2_; \
+        struct SNAME *_set_B_ = _set_A_ == _set1_ ? _set2_ : _set1_; \
+\
+        for (size_t i = 0; i < _set_A_->count; i++) \
+        { \
+            if (CMC_(PFX, _impl_contains)(_set_B_, _set_A_->dense[i])) \
+                return false; \
+        } \
+\
+        return true; \
+    }
+
+/**
+ * STR
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_SPARSESET_STR(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_SPARSESET_STR_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_SPARSESET_STR_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_STR_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_STR_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_STR_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_SPARSESET_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_SPARSESET_STR_HEADER_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _set_, FILE * fptr); \
+    bool CMC_(PFX, _print)(struct SNAME * _set_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end);
+
+#define CMC_EXT_CMC_SPARSESET_STR_SOURCE_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _set_, FILE * fptr) \
+    { \
+        struct SNAME *s_ = _set_; \
+\
+        return 0 <= fprintf(fptr, \
+                            "struct %s<%s> " \
+                            "at %p { " \
+                            "dense:%p, " \
+                            "sparse:%p, " \
+                            "capacity:%" PRIuMAX ", " \
+                            "count:%" PRIuMAX ", " \
+                            "flag:%d, " \
+                            "f_val:%p, " \
+                            "alloc:%p, " \
+                            "callbacks: %p }", \
+                            CMC_TO_STRING(SNAME), CMC_TO_STRING(V), s_, s_->dense, s_->sparse, s_->capacity, \
+                            s_->count, s_->flag, s_->f_val, s_->alloc, CMC_CALLBACKS_GET(s_)); \
+    } \
+\
+    bool CMC_(PFX, _print)(struct SNAME * _set_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end) \
+    { \
+        fprintf(fptr, "%s", start); \
+\
+        for (size_t i = 0; i < _set_->count; i++) \
+        { \
+            if (!_set_->f_val->str(fptr, _set_->dense[i])) \
+                return false; \
+\
+            if (i + 1 < _set_->count) \
+                fprintf(fptr, "%s", separator); \
+        } \
+\
+        fprintf(fptr, "%s", end); \
+\
+        return true; \
+    }
+
+#endif /* CMC_EXT_CMC_SPARSESET_H */
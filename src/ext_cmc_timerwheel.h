@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * ext_cmc_timerwheel.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+
+#ifndef CMC_EXT_CMC_TIMERWHEEL_H
+#define CMC_EXT_CMC_TIMERWHEEL_H
+
+#include "cor_core.h"
+
+/**
+ * All the EXT parts of CMC TimerWheel.
+ */
+#define CMC_EXT_CMC_TIMERWHEEL_PARTS STR
+
+/**
+ * STR
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_CMC_TIMERWHEEL_STR(ACCESS, FILE, PARAMS) \
+    CMC_(CMC_(CMC_EXT_CMC_TIMERWHEEL_STR_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_CMC_TIMERWHEEL_STR_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_CMC_TIMERWHEEL_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_TIMERWHEEL_STR_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_CMC_TIMERWHEEL_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_TIMERWHEEL_STR_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_CMC_TIMERWHEEL_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_TIMERWHEEL_STR_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_CMC_TIMERWHEEL_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_CMC_TIMERWHEEL_STR_HEADER_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _wheel_, FILE * fptr); \
+    bool CMC_(PFX, _print)(struct SNAME * _wheel_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end);
+
+#define CMC_EXT_CMC_TIMERWHEEL_STR_SOURCE_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _wheel_, FILE * fptr) \
+    { \
+        struct SNAME *w_ = _wheel_; \
+\
+        return 0 <= fprintf(fptr, \
+                            "struct %s<%s> " \
+                            "at %p { " \
+                            "timers:%p, " \
+                            "capacity:%" PRIuMAX ", " \
+                            "count:%" PRIuMAX ", " \
+                            "used:%" PRIuMAX ", " \
+                            "now:%" PRIu64 ", " \
+                            "flag:%d, " \
+                            "f_val:%p, " \
+                            "alloc:%p, " \
+                            "callbacks: %p }", \
+                            CMC_TO_STRING(SNAME), CMC_TO_STRING(V), w_, w_->timers, w_->capacity, w_->count, w_->used, \
+                            w_->now, w_->flag, w_->f_val, w_->alloc, CMC_CALLBACKS_GET(w_)); \
+    } \
+\
+    /* Values are printed in no particular order */ \
+    bool CMC_(PFX, _print)(struct SNAME * _wheel_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end) \
+    { \
+        fprintf(fptr, "%s", start); \
+\
+        size_t printed = 0; \
+\
+        for (size_t i = 0; i < _wheel_->used; i++) \
+        { \
+            if (_wheel_->timers[i].generation % 2 == 0) \
+                continue; \
+\
+            if (!_wheel_->f_val->str(fptr, _wheel_->timers[i].value)) \
+                return false; \
+\
+            if (++printed < _wheel_->count) \
+                fprintf(fptr, "%s", separator); \
+        } \
+\
+        fprintf(fptr, "%s", end); \
+\
+        return true; \
+    }
+
+#endif /* CMC_EXT_CMC_TIMERWHEEL_H */
@@ -113,7 +113,9 @@
     K CMC_(PFX, _iter_key)(struct CMC_DEF_ITER(SNAME) * iter); \
     V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter); \
     V *CMC_(PFX, _iter_rvalue)(struct CMC_DEF_ITER(SNAME) * iter); \
-    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter);
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter); \
+    /* Collection Input from an Iterator */ \
+    bool CMC_(PFX, _insert_hint)(struct SNAME * _map_, struct CMC_DEF_ITER(SNAME) * hint, K key, V value);
 
 #define CMC_EXT_CMC_TREEMAP_ITER_SOURCE_(PFX, SNAME, K, V) \
 \
@@ -377,6 +379,133 @@
     size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter) \
     { \
         return iter->index; \
+    } \
+\
+    /* Inserts key starting from hint instead of the root. If key goes */ \
+    /* right before or after the cursor, or before the first or after the */ \
+    /* last key, it is linked there without searching the tree and the */ \
+    /* iterator moves to it, so ascending keys are appended in amortized */ \
+    /* O(1). Otherwise this is the same as _insert() and the iterator stays */ \
+    /* where it was. hint must not be used after other changes to _map_ */ \
+    bool CMC_(PFX, _insert_hint)(struct SNAME * _map_, struct CMC_DEF_ITER(SNAME) * hint, K key, V value) \
+    { \
+        if (CMC_(PFX, _empty)(_map_)) \
+        { \
+            if (!CMC_(PFX, _insert)(_map_, key, value)) \
+                return false; \
+\
+            *hint = CMC_(PFX, _iter_start)(_map_); \
+\
+            return true; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *cursor = hint->cursor; \
+        struct CMC_DEF_NODE(SNAME) *parent = NULL; \
+\
+        bool left = false; \
+        size_t index = hint->index; \
+        int cmp = 0; \
+\
+        if (_map_->f_key->cmp(key, hint->last->key) > 0) \
+        { \
+            parent = hint->last; \
+            index = _map_->count; \
+        } \
+        else if (_map_->f_key->cmp(key, hint->first->key) < 0) \
+        { \
+            parent = hint->first; \
+            left = true; \
+            index = 0; \
+        } \
+        else if ((cmp = _map_->f_key->cmp(key, cursor->key)) == 0) \
+        { \
+            _map_->flag = CMC_FLAG_DUPLICATE; \
+            return false; \
+        } \
+        else if (cmp > 0) \
+        { \
+            /* The cursor is not the last node, so it has a successor */ \
+            struct CMC_DEF_NODE(SNAME) *next = cursor->right; \
+\
+            if (next) \
+            { \
+                while (next->left) \
+                    next = next->left; \
+            } \
+            else \
+            { \
+                next = cursor; \
+\
+                while (next->parent->right == next) \
+                    next = next->parent; \
+\
+                next = next->parent; \
+            } \
+\
+            /* Either the cursor has no right child or its successor has no */ \
+            /* left child */ \
+            if (_map_->f_key->cmp(key, next->key) < 0) \
+            { \
+                parent = cursor->right ? next : cursor; \
+                left = cursor->right != NULL; \
+                index = hint->index + 1; \
+            } \
+        } \
+        else \
+        { \
+            /* The cursor is not the first node, so it has a predecessor */ \
+            struct CMC_DEF_NODE(SNAME) *prev = cursor->left; \
+\
+            if (prev) \
+            { \
+                while (prev->right) \
+                    prev = prev->right; \
+            } \
+            else \
+            { \
+                prev = cursor; \
+\
+                while (prev->parent->left == prev) \
+                    prev = prev->parent; \
+\
+                prev = prev->parent; \
+            } \
+\
+            if (_map_->f_key->cmp(key, prev->key) > 0) \
+            { \
+                parent = cursor->left ? prev : cursor; \
+                left = cursor->left == NULL; \
+                index = hint->index; \
+            } \
+        } \
+\
+        if (!parent) \
+        { \
+            if (!CMC_(PFX, _insert)(_map_, key, value)) \
+                return false; \
+\
+            if (cmp < 0) \
+                hint->index++; \
+\
+            return true; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_attach)(_map_, parent, left, key, value); \
+\
+        if (!node) \
+            return false; \
+\
+        if (parent == hint->last && !left) \
+            hint->last = node; \
+        else if (parent == hint->first && left) \
+            hint->first = node; \
+\
+        hint->cursor = node; \
+        hint->index = index; \
+        hint->start = false; \
+        hint->end = false; \
+\
+        return true; \
     }
 
 /**
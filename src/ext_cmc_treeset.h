@@ -107,7 +107,9 @@
     bool CMC_(PFX, _iter_go_to)(struct CMC_DEF_ITER(SNAME) * iter, size_t index); \
     /* Iterator Access */ \
     V CMC_(PFX, _iter_value)(struct CMC_DEF_ITER(SNAME) * iter); \
-    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter);
+    size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter); \
+    /* Collection Input from an Iterator */ \
+    bool CMC_(PFX, _insert_hint)(struct SNAME * _set_, struct CMC_DEF_ITER(SNAME) * hint, V value);
 
 #define CMC_EXT_CMC_TREESET_ITER_SOURCE_(PFX, SNAME, V) \
 \
@@ -355,6 +357,133 @@
     size_t CMC_(PFX, _iter_index)(struct CMC_DEF_ITER(SNAME) * iter) \
     { \
         return iter->index; \
+    } \
+\
+    /* Inserts value starting from hint instead of the root. If value goes */ \
+    /* right before or after the cursor, or before the first or after the */ \
+    /* last value, it is linked there without searching the tree and the */ \
+    /* iterator moves to it, so ascending values are appended in amortized */ \
+    /* O(1). Otherwise this is the same as _insert() and the iterator stays */ \
+    /* where it was. hint must not be used after other changes to _set_ */ \
+    bool CMC_(PFX, _insert_hint)(struct SNAME * _set_, struct CMC_DEF_ITER(SNAME) * hint, V value) \
+    { \
+        if (CMC_(PFX, _empty)(_set_)) \
+        { \
+            if (!CMC_(PFX, _insert)(_set_, value)) \
+                return false; \
+\
+            *hint = CMC_(PFX, _iter_start)(_set_); \
+\
+            return true; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *cursor = hint->cursor; \
+        struct CMC_DEF_NODE(SNAME) *parent = NULL; \
+\
+        bool left = false; \
+        size_t index = hint->index; \
+        int cmp = 0; \
+\
+        if (_set_->f_val->cmp(value, hint->last->value) > 0) \
+        { \
+            parent = hint->last; \
+            index = _set_->count; \
+        } \
+        else if (_set_->f_val->cmp(value, hint->first->value) < 0) \
+        { \
+            parent = hint->first; \
+            left = true; \
+            index = 0; \
+        } \
+        else if ((cmp = _set_->f_val->cmp(value, cursor->value)) == 0) \
+        { \
+            _set_->flag = CMC_FLAG_DUPLICATE; \
+            return false; \
+        } \
+        else if (cmp > 0) \
+        { \
+            /* The cursor is not the last node, so it has a successor */ \
+            struct CMC_DEF_NODE(SNAME) *next = cursor->right; \
+\
+            if (next) \
+            { \
+                while (next->left) \
+                    next = next->left; \
+            } \
+            else \
+            { \
+                next = cursor; \
+\
+                while (next->parent->right == next) \
+                    next = next->parent; \
+\
+                next = next->parent; \
+            } \
+\
+            /* Either the cursor has no right child or its successor has no */ \
+            /* left child */ \
+            if (_set_->f_val->cmp(value, next->value) < 0) \
+            { \
+                parent = cursor->right ? next : cursor; \
+                left = cursor->right != NULL; \
+                index = hint->index + 1; \
+            } \
+        } \
+        else \
+        { \
+            /* The cursor is not the first node, so it has a predecessor */ \
+            struct CMC_DEF_NODE(SNAME) *prev = cursor->left; \
+\
+            if (prev) \
+            { \
+                while (prev->right) \
+                    prev = prev->right; \
+            } \
+            else \
+            { \
+                prev = cursor; \
+\
+                while (prev->parent->left == prev) \
+                    prev = prev->parent; \
+\
+                prev = prev->parent; \
+            } \
+\
+            if (_set_->f_val->cmp(value, prev->value) > 0) \
+            { \
+                parent = cursor->left ? prev : cursor; \
+                left = cursor->left == NULL; \
+                index = hint->index; \
+            } \
+        } \
+\
+        if (!parent) \
+        { \
+            if (!CMC_(PFX, _insert)(_set_, value)) \
+                return false; \
+\
+            if (cmp < 0) \
+                hint->index++; \
+\
+            return true; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *node = CMC_(PFX, _impl_attach)(_set_, parent, left, value); \
+\
+        if (!node) \
+            return false; \
+\
+        if (parent == hint->last && !left) \
+            hint->last = node; \
+        else if (parent == hint->first && left) \
+            hint->first = node; \
+\
+        hint->cursor = node; \
+        hint->index = index; \
+        hint->start = false; \
+        hint->end = false; \
+\
+        return true; \
     }
 
 /**
@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * ext_tsc_stack.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+#ifndef CMC_EXT_TSC_STACK_H
+#define CMC_EXT_TSC_STACK_H
+
+#include "cor_core.h"
+
+/**
+ * All the EXT parts of TSC Stack.
+ */
+#define CMC_EXT_TSC_STACK_PARTS NODE, STR
+
+/**
+ * NODE
+ *
+ * Gives direct access to the nodes of the stack so that values can be used
+ * and modified in place. A node taken with _new_node or _pop_node belongs to
+ * the calling thread until it is given back with _push_node or _free_node.
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_TSC_STACK_NODE(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_EXT_TSC_STACK_NODE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_TSC_STACK_NODE_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_TSC_STACK_NODE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_TSC_STACK_NODE_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_TSC_STACK_NODE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_TSC_STACK_NODE_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_TSC_STACK_NODE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_TSC_STACK_NODE_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_TSC_STACK_NODE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_TSC_STACK_NODE_HEADER_(PFX, SNAME, V) \
+\
+    /* Node Allocation and Deallocation */ \
+    struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _new_node)(struct SNAME * _stack_, V value); \
+    void CMC_(PFX, _free_node)(struct SNAME * _stack_, struct CMC_DEF_NODE(SNAME) * _node_); \
+    /* Node Input and Output */ \
+    bool CMC_(PFX, _push_node)(struct SNAME * _stack_, struct CMC_DEF_NODE(SNAME) * _node_); \
+    struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _pop_node)(struct SNAME * _stack_);
+
+#define CMC_EXT_TSC_STACK_NODE_SOURCE_(PFX, SNAME, V) \
+\
+    struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _new_node)(struct SNAME * _stack_, V value) \
+    { \
+        uint32_t index = CMC_(PFX, _impl_pop)(_stack_, &_stack_->free); \
+\
+        if (index == UINT32_MAX) \
+        { \
+            atomic_store_explicit(&_stack_->flag, CMC_FLAG_FULL, memory_order_relaxed); \
+            return NULL; \
+        } \
+\
+        struct CMC_DEF_NODE(SNAME) *_node_ = &(_stack_->buffer[index]); \
+\
+        _node_->value = value; \
+\
+        atomic_store_explicit(&_stack_->flag, CMC_FLAG_OK, memory_order_relaxed); \
+\
+        return _node_; \
+    } \
+\
+    void CMC_(PFX, _free_node)(struct SNAME * _stack_, struct CMC_DEF_NODE(SNAME) * _node_) \
+    { \
+        if (_node_ < _stack_->buffer || _node_ >= _stack_->buffer + _stack_->capacity) \
+        { \
+            atomic_store_explicit(&_stack_->flag, CMC_FLAG_INVALID, memory_order_relaxed); \
+            return; \
+        } \
+        uint32_t index = (uint32_t)(_node_ - _stack_->buffer); \
+\
+        CMC_(PFX, _impl_push)(_stack_, &_stack_->free, index, index); \
+\
+        atomic_store_explicit(&_stack_->flag, CMC_FLAG_OK, memory_order_relaxed); \
+    } \
+\
+    bool CMC_(PFX, _push_node)(struct SNAME * _stack_, struct CMC_DEF_NODE(SNAME) * _node_) \
+    { \
+        if (_node_ < _stack_->buffer || _node_ >= _stack_->buffer + _stack_->capacity) \
+        { \
+            atomic_store_explicit(&_stack_->flag, CMC_FLAG_INVALID, memory_order_relaxed); \
+            return false; \
+        } \
+\
+        uint32_t index = (uint32_t)(_node_ - _stack_->buffer); \
+\
+        atomic_fetch_add_explicit(&_stack_->count, 1, memory_order_relaxed); \
+\
+        CMC_(PFX, _impl_push)(_stack_, &_stack_->head, index, index); \
+\
+        atomic_store_explicit(&_stack_->flag, CMC_FLAG_OK, memory_order_relaxed); \
+\
+        CMC_CALLBACKS_CALL(_stack_, create); \
+\
+        return true; \
+    } \
+\
+    struct CMC_DEF_NODE(SNAME) * CMC_(PFX, _pop_node)(struct SNAME * _stack_) \
+    { \
+        uint32_t index = CMC_(PFX, _impl_pop)(_stack_, &_stack_->head); \
+\
+        if (index == UINT32_MAX) \
+        { \
+            atomic_store_explicit(&_stack_->flag, CMC_FLAG_EMPTY, memory_order_relaxed); \
+            return NULL; \
+        } \
+\
+        atomic_fetch_sub_explicit(&_stack_->count, 1, memory_order_relaxed); \
+\
+        atomic_store_explicit(&_stack_->flag, CMC_FLAG_OK, memory_order_relaxed); \
+\
+        CMC_CALLBACKS_CALL(_stack_, delete); \
+\
+        return &(_stack_->buffer[index]); \
+    }
+
+/**
+ * STR
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_EXT_TSC_STACK_STR(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_EXT_TSC_STACK_STR_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+#define CMC_EXT_TSC_STACK_STR_PUBLIC_HEADER(PARAMS) \
+    CMC_EXT_TSC_STACK_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_TSC_STACK_STR_PUBLIC_SOURCE(PARAMS) \
+    CMC_EXT_TSC_STACK_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_TSC_STACK_STR_PRIVATE_HEADER(PARAMS) \
+    CMC_EXT_TSC_STACK_STR_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_TSC_STACK_STR_PRIVATE_SOURCE(PARAMS) \
+    CMC_EXT_TSC_STACK_STR_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_EXT_TSC_STACK_STR_HEADER_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _stack_, FILE * fptr); \
+    bool CMC_(PFX, _print)(struct SNAME * _stack_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end);
+
+#define CMC_EXT_TSC_STACK_STR_SOURCE_(PFX, SNAME, V) \
+\
+    bool CMC_(PFX, _to_string)(struct SNAME * _stack_, FILE * fptr) \
+    { \
+        struct SNAME *s_ = _stack_; \
+\
+        return 0 <= fprintf(fptr, \
+                            "struct %s<%s> " \
+                            "at %p { " \
+                            "buffer:%p, " \
+                            "capacity:%" PRIuMAX ", " \
+                            "count:%" PRIuMAX ", " \
+                            "flag:%d, " \
+                            "f_val:%p, " \
+                            "alloc:%p, " \
+                            "callbacks:%p }", \
+                            CMC_TO_STRING(SNAME), CMC_TO_STRING(V), s_, s_->buffer, s_->capacity, \
+                            CMC_(PFX, _count)(s_), CMC_(PFX, _flag)(s_), s_->f_val, s_->alloc, \
+                            CMC_CALLBACKS_GET(s_)); \
+    } \
+\
+    /* Not thread-safe, the stack must not be modified while it is printed */ \
+    bool CMC_(PFX, _print)(struct SNAME * _stack_, FILE * fptr, const char *start, const char *separator, \
+                           const char *end) \
+    { \
+        fprintf(fptr, "%s", start); \
+\
+        uint32_t index = (uint32_t)atomic_load(&_stack_->head); \
+\
+        while (index != UINT32_MAX) \
+        { \
+            if (!_stack_->f_val->str(fptr, _stack_->buffer[index].value)) \
+                return false; \
+\
+            index = atomic_load(&_stack_->buffer[index].next); \
+\
+            if (index != UINT32_MAX) \
+                fprintf(fptr, "%s", separator); \
+        } \
+\
+        fprintf(fptr, "%s", end); \
+\
+        return true; \
+    }
+
+#endif /* CMC_EXT_TSC_STACK_H */
@@ -52,20 +52,35 @@
 #define CMC_MACRO_COLLECTIONS_H
 
 // clang-format off
+#include "cmc_artmap.h"           /* Added in 18/10/2026 */
 #include "cmc_bitset.h"           /* Added in 30/04/2020 */
 #include "cmc_deque.h"            /* Added in 20/03/2019 */
+#include "cmc_disjointset.h"      /* Added in 18/10/2026 */
+#include "cmc_eliasfano.h"        /* Added in 18/10/2026 */
+#include "cmc_fenwicktree.h"      /* Added in 18/10/2026 */
+#include "cmc_gapbuffer.h"        /* Added in 18/10/2026 */
 #include "cmc_hashbidimap.h"      /* Added in 26/09/2019 */
+#include "cmc_hashdisjointset.h"  /* Added in 18/10/2026 */
 #include "cmc_hashmap.h"          /* Added in 03/04/2019 */
 #include "cmc_hashmultimap.h"     /* Added in 26/04/2019 */
 #include "cmc_hashmultiset.h"     /* Added in 10/04/2019 */
 #include "cmc_hashset.h"          /* Added in 01/04/2019 */
 #include "cmc_heap.h"             /* Added in 25/03/2019 */
+#include "cmc_hyperloglog.h"      /* Added in 18/10/2026 */
 #include "cmc_intervalheap.h"     /* Added in 06/07/2019 */
+#include "cmc_intervaltree.h"     /* Added in 18/10/2026 */
 #include "cmc_linkedlist.h"       /* Added in 22/03/2019 */
 #include "cmc_list.h"             /* Added in 12/02/2019 */
+#include "cmc_phashmap.h"         /* Added in 18/10/2026 */
+#include "cmc_ptreemap.h"         /* Added in 18/10/2026 */
 #include "cmc_queue.h"            /* Added in 15/02/2019 */
+#include "cmc_segmenttree.h"      /* Added in 18/10/2026 */
+#include "cmc_slotmap.h"          /* Added in 18/10/2026 */
 #include "cmc_sortedlist.h"       /* Added in 17/09/2019 */
+#include "cmc_sortedmap.h"        /* Added in 18/10/2026 */
+#include "cmc_sparseset.h"        /* Added in 18/10/2026 */
 #include "cmc_stack.h"            /* Added in 14/02/2019 */
+#include "cmc_timerwheel.h"       /* Added in 18/10/2026 */
 #include "cmc_treemap.h"          /* Added in 28/03/2019 */
 #include "cmc_treeset.h"          /* Added in 27/03/2019 */
 
@@ -77,27 +92,48 @@
 #include "cor_ftable.h"           /* Added in 27/05/2020 */
 #include "cor_hashtable.h"        /* Added in 17/03/2020 */
 #include "cor_heap.h"             /* Added in 01/06/2020 */
+#include "cor_sort.h"             /* Added in 18/10/2026 */
 
+#include "ext_cmc_artmap.h"       /* Added in 18/10/2026 */
 #include "ext_cmc_bitset.h"       /* Added in 08/06/2020 */
 #include "ext_cmc_deque.h"        /* Added in 25/05/2020 */
+#include "ext_cmc_disjointset.h"  /* Added in 18/10/2026 */
+#include "ext_cmc_eliasfano.h"    /* Added in 18/10/2026 */
+#include "ext_cmc_fenwicktree.h"  /* Added in 18/10/2026 */
+#include "ext_cmc_gapbuffer.h"    /* Added in 18/10/2026 */
 #include "ext_cmc_hashbidimap.h"  /* Added in 26/05/2020 */
+#include "ext_cmc_hashdisjointset.h" /* Added in 18/10/2026 */
 #include "ext_cmc_hashmap.h"      /* Added in 25/05/2020 */
 #include "ext_cmc_hashmultimap.h" /* Added in 29/05/2020 */
 #include "ext_cmc_hashmultiset.h" /* Added in 30/05/2020 */
 #include "ext_cmc_hashset.h"      /* Added in 31/05/2020 */
 #include "ext_cmc_heap.h"         /* Added in 01/06/2020 */
+#include "ext_cmc_hyperloglog.h"  /* Added in 18/10/2026 */
 #include "ext_cmc_intervalheap.h" /* Added in 02/06/2020 */
+#include "ext_cmc_intervaltree.h" /* Added in 18/10/2026 */
 #include "ext_cmc_linkedlist.h"   /* Added in 03/06/2020 */
 #include "ext_cmc_list.h"         /* Added in 04/06/2020 */
+#include "ext_cmc_phashmap.h"     /* Added in 18/10/2026 */
+#include "ext_cmc_ptreemap.h"     /* Added in 18/10/2026 */
 #include "ext_cmc_queue.h"        /* Added in 05/06/2020 */
+#include "ext_cmc_segmenttree.h"  /* Added in 18/10/2026 */
+#include "ext_cmc_slotmap.h"      /* Added in 18/10/2026 */
 #include "ext_cmc_sortedlist.h"   /* Added in 06/06/2020 */
+#include "ext_cmc_sortedmap.h"    /* Added in 18/10/2026 */
+#include "ext_cmc_sparseset.h"    /* Added in 18/10/2026 */
 #include "ext_cmc_stack.h"        /* Added in 07/06/2020 */
+#include "ext_cmc_timerwheel.h"   /* Added in 18/10/2026 */
 #include "ext_cmc_treemap.h"      /* Added in 08/06/2020 */
 #include "ext_cmc_treeset.h"      /* Added in 08/06/2020 */
 #include "ext_sac_list.h"         /* Added in 08/06/2020 */
+#include "ext_tsc_queue.h"        /* Added in 18/10/2026 */
+#include "ext_tsc_stack.h"        /* Added in 18/10/2026 */
 
 #include "sac_list.h"             /* Added in 06/10/2020 */
 
+#include "tsc_queue.h"            /* Added in 18/10/2026 */
+#include "tsc_stack.h"            /* Added in 18/10/2026 */
+
 #include "utl_assert.h"           /* Added in 27/06/2019 */
 #include "utl_foreach.h"          /* Added in 25/02/2019 */
 #include "utl_futils.h"           /* Added in 15/04/2020 */
@@ -0,0 +1,582 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * tsc_queue.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+/**
+ * Queue
+ *
+ * A thread-safe bounded blocking Queue. Elements are stored in a fixed sized
+ * circular array that is protected by a mutex and two condition variables,
+ * one signaled when an element is added (`not_empty`) and another when an
+ * element is removed (`not_full`).
+ *
+ * Producers that find the Queue full and consumers that find it empty can
+ * either fail immediately (`_enqueue` and `_dequeue`), block until they can
+ * make progress (`_enqueue_wait` and `_dequeue_wait`) or block for at most a
+ * certain amount of milliseconds (`_enqueue_timed` and `_dequeue_timed`).
+ *
+ * Consumers can also drain many elements at once with `_dequeue_many` and its
+ * blocking variants, which only take the lock once and wake up all blocked
+ * producers in a single broadcast. Condition variables are only signaled when
+ * there is at least one thread waiting on them, so an uncontended Queue never
+ * makes a system call to wake up other threads.
+ */
+
+#ifndef CMC_TSC_QUEUE_H
+#define CMC_TSC_QUEUE_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+/* -------------------------------------------------------------------------
+ * Threading utilities
+ * ------------------------------------------------------------------------- */
+#include "utl_mutex.h"
+
+/**
+ * Core Queue implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_TSC_QUEUE_CORE(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_TSC_QUEUE_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_TSC_QUEUE_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_TSC_QUEUE_CORE_STRUCT(PARAMS) \
+    CMC_TSC_QUEUE_CORE_HEADER(PARAMS)
+
+#define CMC_TSC_QUEUE_CORE_PUBLIC_SOURCE(PARAMS) CMC_TSC_QUEUE_CORE_SOURCE(PARAMS)
+
+#define CMC_TSC_QUEUE_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_TSC_QUEUE_CORE_HEADER(PARAMS)
+
+#define CMC_TSC_QUEUE_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_TSC_QUEUE_CORE_STRUCT(PARAMS) \
+    CMC_TSC_QUEUE_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_TSC_QUEUE_CORE_STRUCT(PARAMS) \
+    CMC_TSC_QUEUE_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_TSC_QUEUE_CORE_HEADER(PARAMS) \
+    CMC_TSC_QUEUE_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_TSC_QUEUE_CORE_SOURCE(PARAMS) \
+    CMC_TSC_QUEUE_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_TSC_QUEUE_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* Queue Structure */ \
+    struct SNAME \
+    { \
+        /* Fixed size circular array of elements */ \
+        V *buffer; \
+\
+        /* Circular array capacity */ \
+        size_t capacity; \
+\
+        /* Current amount of elements */ \
+        size_t count; \
+\
+        /* Index representing the front of the queue */ \
+        size_t front; \
+\
+        /* Index representing the back of the queue */ \
+        size_t back; \
+\
+        /* Amount of threads blocked waiting for an element */ \
+        size_t consumers; \
+\
+        /* Amount of threads blocked waiting for a free slot */ \
+        size_t producers; \
+\
+        /* Protects every other member of the queue */ \
+        struct cmc_mutex mutex; \
+\
+        /* Signaled when an element is added to the queue */ \
+        struct cmc_condvar not_empty; \
+\
+        /* Signaled when an element is removed from the queue */ \
+        struct cmc_condvar not_full; \
+\
+        /* Flags indicating errors or success */ \
+        int flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_TSC_QUEUE_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    bool CMC_(PFX, _clear)(struct SNAME * _queue_); \
+    void CMC_(PFX, _free)(struct SNAME * _queue_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _queue_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _enqueue)(struct SNAME * _queue_, V value); \
+    bool CMC_(PFX, _enqueue_wait)(struct SNAME * _queue_, V value); \
+    bool CMC_(PFX, _enqueue_timed)(struct SNAME * _queue_, V value, size_t timeout); \
+    bool CMC_(PFX, _dequeue)(struct SNAME * _queue_, V * value); \
+    bool CMC_(PFX, _dequeue_wait)(struct SNAME * _queue_, V * value); \
+    bool CMC_(PFX, _dequeue_timed)(struct SNAME * _queue_, V * value, size_t timeout); \
+    size_t CMC_(PFX, _dequeue_many)(struct SNAME * _queue_, V * values, size_t max); \
+    size_t CMC_(PFX, _dequeue_wait_many)(struct SNAME * _queue_, V * values, size_t max); \
+    size_t CMC_(PFX, _dequeue_timed_many)(struct SNAME * _queue_, V * values, size_t max, size_t timeout); \
+    /* Collection State */ \
+    bool CMC_(PFX, _empty)(struct SNAME * _queue_); \
+    bool CMC_(PFX, _full)(struct SNAME * _queue_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _queue_); \
+    size_t CMC_(PFX, _capacity)(struct SNAME * _queue_); \
+    int CMC_(PFX, _flag)(struct SNAME * _queue_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_TSC_QUEUE_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static bool CMC_(PFX, _impl_enqueue)(struct SNAME * _queue_, V value, bool block, size_t * timeout); \
+    static size_t CMC_(PFX, _impl_dequeue)(struct SNAME * _queue_, V * values, size_t max, bool block, \
+                                           size_t * timeout); \
+    static bool CMC_(PFX, _impl_wait)(struct SNAME * _queue_, struct cmc_condvar * cnd, size_t * waiters, \
+                                      size_t * deadline); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(capacity, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (capacity < 1) \
+            return NULL; \
+\
+        if (!f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_queue_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_queue_) \
+            return NULL; \
+\
+        _queue_->buffer = alloc->calloc(capacity, sizeof(V)); \
+\
+        if (!_queue_->buffer) \
+        { \
+            alloc->free(_queue_); \
+            return NULL; \
+        } \
+\
+        if (!cmc_mtx_init(&_queue_->mutex)) \
+            goto mutex_error; \
+\
+        if (!cmc_cnd_init(&_queue_->not_empty)) \
+            goto not_empty_error; \
+\
+        if (!cmc_cnd_init(&_queue_->not_full)) \
+            goto not_full_error; \
+\
+        _queue_->capacity = capacity; \
+        _queue_->count = 0; \
+        _queue_->front = 0; \
+        _queue_->back = 0; \
+        _queue_->consumers = 0; \
+        _queue_->producers = 0; \
+        _queue_->flag = CMC_FLAG_OK; \
+        _queue_->f_val = f_val; \
+        _queue_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_queue_, callbacks); \
+\
+        return _queue_; \
+\
+    not_full_error: \
+        cmc_cnd_destroy(&_queue_->not_empty); \
+    not_empty_error: \
+        cmc_mtx_destroy(&_queue_->mutex); \
+    mutex_error: \
+        alloc->free(_queue_->buffer); \
+        alloc->free(_queue_); \
+        return NULL; \
+    } \
+\
+    bool CMC_(PFX, _clear)(struct SNAME * _queue_) \
+    { \
+        if (!cmc_mtx_lock(&_queue_->mutex)) \
+        { \
+            _queue_->flag = CMC_FLAG_MUTEX; \
+            return false; \
+        } \
+\
+        if (_queue_->f_val->free) \
+        { \
+            for (size_t i = _queue_->front, j = 0; j < _queue_->count; j++) \
+            { \
+                _queue_->f_val->free(_queue_->buffer[i]); \
+\
+                i = (i + 1) % _queue_->capacity; \
+            } \
+        } \
+\
+        memset(_queue_->buffer, 0, sizeof(V) * _queue_->capacity); \
+\
+        _queue_->count = 0; \
+        _queue_->front = 0; \
+        _queue_->back = 0; \
+        _queue_->flag = CMC_FLAG_OK; \
+\
+        /* Every blocked producer can now make progress */ \
+        if (_queue_->producers > 0) \
+            cmc_cnd_broadcast(&_queue_->not_full); \
+\
+        cmc_mtx_unlock(&_queue_->mutex); \
+\
+        return true; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _queue_) \
+    { \
+        if (_queue_->f_val->free) \
+        { \
+            for (size_t i = _queue_->front, j = 0; j < _queue_->count; j++) \
+            { \
+                _queue_->f_val->free(_queue_->buffer[i]); \
+\
+                i = (i + 1) % _queue_->capacity; \
+            } \
+        } \
+\
+        cmc_cnd_destroy(&_queue_->not_full); \
+        cmc_cnd_destroy(&_queue_->not_empty); \
+        cmc_mtx_destroy(&_queue_->mutex); \
+\
+        _queue_->alloc->free(_queue_->buffer); \
+        _queue_->alloc->free(_queue_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _queue_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _queue_->alloc = &cmc_alloc_node_default; \
+        else \
+            _queue_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_queue_, callbacks); \
+\
+        _queue_->flag = CMC_FLAG_OK; \
+    } \
+\
+    bool CMC_(PFX, _enqueue)(struct SNAME * _queue_, V value) \
+    { \
+        return CMC_(PFX, _impl_enqueue)(_queue_, value, false, NULL); \
+    } \
+\
+    bool CMC_(PFX, _enqueue_wait)(struct SNAME * _queue_, V value) \
+    { \
+        return CMC_(PFX, _impl_enqueue)(_queue_, value, true, NULL); \
+    } \
+\
+    bool CMC_(PFX, _enqueue_timed)(struct SNAME * _queue_, V value, size_t timeout) \
+    { \
+        return CMC_(PFX, _impl_enqueue)(_queue_, value, true, &timeout); \
+    } \
+\
+    bool CMC_(PFX, _dequeue)(struct SNAME * _queue_, V * value) \
+    { \
+        return CMC_(PFX, _impl_dequeue)(_queue_, value, 1, false, NULL) == 1; \
+    } \
+\
+    bool CMC_(PFX, _dequeue_wait)(struct SNAME * _queue_, V * value) \
+    { \
+        return CMC_(PFX, _impl_dequeue)(_queue_, value, 1, true, NULL) == 1; \
+    } \
+\
+    bool CMC_(PFX, _dequeue_timed)(struct SNAME * _queue_, V * value, size_t timeout) \
+    { \
+        return CMC_(PFX, _impl_dequeue)(_queue_, value, 1, true, &timeout) == 1; \
+    } \
+\
+    size_t CMC_(PFX, _dequeue_many)(struct SNAME * _queue_, V * values, size_t max) \
+    { \
+        return CMC_(PFX, _impl_dequeue)(_queue_, values, max, false, NULL); \
+    } \
+\
+    size_t CMC_(PFX, _dequeue_wait_many)(struct SNAME * _queue_, V * values, size_t max) \
+    { \
+        return CMC_(PFX, _impl_dequeue)(_queue_, values, max, true, NULL); \
+    } \
+\
+    size_t CMC_(PFX, _dequeue_timed_many)(struct SNAME * _queue_, V * values, size_t max, size_t timeout) \
+    { \
+        return CMC_(PFX, _impl_dequeue)(_queue_, values, max, true, &timeout); \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _queue_) \
+    { \
+        return CMC_(PFX, _count)(_queue_) == 0; \
+    } \
+\
+    bool CMC_(PFX, _full)(struct SNAME * _queue_) \
+    { \
+        return CMC_(PFX, _count)(_queue_) >= _queue_->capacity; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _queue_) \
+    { \
+        if (!cmc_mtx_lock(&_queue_->mutex)) \
+        { \
+            _queue_->flag = CMC_FLAG_MUTEX; \
+            return 0; \
+        } \
+\
+        size_t count = _queue_->count; \
+\
+        cmc_mtx_unlock(&_queue_->mutex); \
+\
+        return count; \
+    } \
+\
+    size_t CMC_(PFX, _capacity)(struct SNAME * _queue_) \
+    { \
+        return _queue_->capacity; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _queue_) \
+    { \
+        return _queue_->flag; \
+    } \
+\
+    static bool CMC_(PFX, _impl_enqueue)(struct SNAME * _queue_, V value, bool block, size_t * timeout) \
+    { \
+        if (!cmc_mtx_lock(&_queue_->mutex)) \
+        { \
+            _queue_->flag = CMC_FLAG_MUTEX; \
+            return false; \
+        } \
+\
+        /* Wakeups that don't free a slot must not restart the timeout */ \
+        size_t deadline = timeout ? cmc_cnd_deadline(*timeout) : 0; \
+\
+        while (_queue_->count >= _queue_->capacity) \
+        { \
+            if (!block) \
+            { \
+                _queue_->flag = CMC_FLAG_FULL; \
+                cmc_mtx_unlock(&_queue_->mutex); \
+                return false; \
+            } \
+\
+            if (!CMC_(PFX, _impl_wait)(_queue_, &_queue_->not_full, &_queue_->producers, timeout ? &deadline : NULL)) \
+            { \
+                /* Either timed out or the wait itself failed */ \
+                if (_queue_->flag == CMC_FLAG_OK) \
+                    _queue_->flag = CMC_FLAG_FULL; \
+\
+                cmc_mtx_unlock(&_queue_->mutex); \
+                return false; \
+            } \
+        } \
+\
+        _queue_->buffer[_queue_->back] = value; \
+\
+        _queue_->back = (_queue_->back == _queue_->capacity - 1) ? 0 : _queue_->back + 1; \
+        _queue_->count++; \
+        _queue_->flag = CMC_FLAG_OK; \
+\
+        if (_queue_->consumers > 0) \
+            cmc_cnd_signal(&_queue_->not_empty); \
+\
+        cmc_mtx_unlock(&_queue_->mutex); \
+\
+        CMC_CALLBACKS_CALL(_queue_, create); \
+\
+        return true; \
+    } \
+\
+    static size_t CMC_(PFX, _impl_dequeue)(struct SNAME * _queue_, V * values, size_t max, bool block, \
+                                           size_t * timeout) \
+    { \
+        if (!values || max == 0) \
+        { \
+            _queue_->flag = CMC_FLAG_INVALID; \
+            return 0; \
+        } \
+\
+        if (!cmc_mtx_lock(&_queue_->mutex)) \
+        { \
+            _queue_->flag = CMC_FLAG_MUTEX; \
+            return 0; \
+        } \
+\
+        /* Wakeups that don't bring an element must not restart the timeout */ \
+        size_t deadline = timeout ? cmc_cnd_deadline(*timeout) : 0; \
+\
+        while (_queue_->count == 0) \
+        { \
+            if (!block) \
+            { \
+                _queue_->flag = CMC_FLAG_EMPTY; \
+                cmc_mtx_unlock(&_queue_->mutex); \
+                return 0; \
+            } \
+\
+            if (!CMC_(PFX, _impl_wait)(_queue_, &_queue_->not_empty, &_queue_->consumers, timeout ? &deadline : NULL)) \
+            { \
+                /* Either timed out or the wait itself failed */ \
+                if (_queue_->flag == CMC_FLAG_OK) \
+                    _queue_->flag = CMC_FLAG_EMPTY; \
+\
+                cmc_mtx_unlock(&_queue_->mutex); \
+                return 0; \
+            } \
+        } \
+\
+        size_t total = max < _queue_->count ? max : _queue_->count; \
+\
+        /* At most two contiguous copies since the buffer might wrap around */ \
+        size_t first = _queue_->capacity - _queue_->front; \
+\
+        if (first > total) \
+            first = total; \
+\
+        memcpy(values, _queue_->buffer + _queue_->front, sizeof(V) * first); \
+        memcpy(values + first, _queue_->buffer, sizeof(V) * (total - first)); \
+\
+        _queue_->front = (_queue_->front + total) % _queue_->capacity; \
+        _queue_->count -= total; \
+        _queue_->flag = CMC_FLAG_OK; \
+\
+        /* Wake up as many producers as there are new free slots */ \
+        if (_queue_->producers > 0) \
+        { \
+            if (total == 1) \
+                cmc_cnd_signal(&_queue_->not_full); \
+            else \
+                cmc_cnd_broadcast(&_queue_->not_full); \
+        } \
+\
+        cmc_mtx_unlock(&_queue_->mutex); \
+\
+        CMC_CALLBACKS_CALL(_queue_, delete); \
+\
+        return total; \
+    } \
+\
+    /* Waits on a condition variable with the queue's mutex held, until the */ \
+    /* deadline if there is one. Returns false if the deadline has passed */ \
+    /* (flag is OK) or if the wait failed. */ \
+    static bool CMC_(PFX, _impl_wait)(struct SNAME * _queue_, struct cmc_condvar * cnd, size_t * waiters, \
+                                      size_t * deadline) \
+    { \
+        bool woken; \
+        size_t remaining = 0; \
+\
+        if (deadline) \
+        { \
+            remaining = cmc_cnd_remaining(*deadline); \
+\
+            if (remaining == 0) \
+            { \
+                _queue_->flag = CMC_FLAG_OK; \
+                return false; \
+            } \
+        } \
+\
+        *waiters += 1; \
+\
+        if (deadline) \
+            woken = cmc_cnd_timedwait(cnd, &_queue_->mutex, remaining); \
+        else \
+            woken = cmc_cnd_wait(cnd, &_queue_->mutex); \
+\
+        *waiters -= 1; \
+\
+        _queue_->flag = cnd->flag; \
+\
+        return woken; \
+    }
+
+#endif /* CMC_TSC_QUEUE_H */
@@ -0,0 +1,461 @@
+/**
+ * Copyright (c) 2019 Leonardo Vencovsky
+ *
+ * This file is part of the C Macro Collections Libray.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * tsc_stack.h
+ *
+ * Creation Date: 18/10/2026
+ *
+ * Authors:
+ * Leonardo Vencovsky (https://github.com/LeoVen)
+ *
+ */
+
+/**
+ * Stack
+ *
+ * A thread-safe lock-free Stack (also known as Treiber Stack) with a fixed
+ * capacity. It is ideal as a shared pool of reusable objects where many
+ * threads constantly push and pop elements.
+ *
+ * All nodes are allocated upfront in a single buffer and are never freed while
+ * the Stack is alive. Unused nodes are kept in a second lock-free stack, the
+ * free list, so pushing and popping never allocate memory. Nodes refer to each
+ * other by their index in the buffer, which allows the head of each stack to
+ * be stored in a single 64-bit word together with a 32-bit tag that is
+ * incremented on every successful update. This defeats the ABA problem without
+ * requiring a double-width compare-and-swap.
+ *
+ * Nodes are also exposed through the NODE part at EXT. A node can be popped,
+ * have its value used and modified in place and then be pushed back, without
+ * ever copying the value around.
+ *
+ * Requires C11 atomics (<stdatomic.h>).
+ */
+
+#ifndef CMC_TSC_STACK_H
+#define CMC_TSC_STACK_H
+
+/* -------------------------------------------------------------------------
+ * Core functionalities of the C Macro Collections Library
+ * ------------------------------------------------------------------------- */
+#include "cor_core.h"
+
+#if defined(__STDC_NO_ATOMICS__)
+#error "TSC Stack requires C11 atomics"
+#endif
+
+#include <stdatomic.h>
+
+/**
+ * Core Stack implementation
+ *
+ * \param ACCESS Either PUBLIC or PRIVATE
+ * \param FILE   Either HEADER or SOURCE
+ * \param PARAMS A tuple of form (PFX, SNAME, SIZE, K, V)
+ */
+#define CMC_TSC_STACK_CORE(ACCESS, FILE, PARAMS) CMC_(CMC_(CMC_TSC_STACK_CORE_, ACCESS), CMC_(_, FILE))(PARAMS)
+
+/* PRIVATE or PUBLIC solver */
+#define CMC_TSC_STACK_CORE_PUBLIC_HEADER(PARAMS) \
+    CMC_TSC_STACK_CORE_STRUCT(PARAMS) \
+    CMC_TSC_STACK_CORE_HEADER(PARAMS)
+
+#define CMC_TSC_STACK_CORE_PUBLIC_SOURCE(PARAMS) CMC_TSC_STACK_CORE_SOURCE(PARAMS)
+
+#define CMC_TSC_STACK_CORE_PRIVATE_HEADER(PARAMS) \
+    struct CMC_PARAM_SNAME(PARAMS); \
+    CMC_TSC_STACK_CORE_HEADER(PARAMS)
+
+#define CMC_TSC_STACK_CORE_PRIVATE_SOURCE(PARAMS) \
+    CMC_TSC_STACK_CORE_STRUCT(PARAMS) \
+    CMC_TSC_STACK_CORE_SOURCE(PARAMS)
+
+/* Lowest level API */
+#define CMC_TSC_STACK_CORE_STRUCT(PARAMS) \
+    CMC_TSC_STACK_CORE_STRUCT_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_TSC_STACK_CORE_HEADER(PARAMS) \
+    CMC_TSC_STACK_CORE_HEADER_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+#define CMC_TSC_STACK_CORE_SOURCE(PARAMS) \
+    CMC_TSC_STACK_CORE_SOURCE_(CMC_PARAM_PFX(PARAMS), CMC_PARAM_SNAME(PARAMS), CMC_PARAM_V(PARAMS))
+
+/* -------------------------------------------------------------------------
+ * Struct
+ * ------------------------------------------------------------------------- */
+#define CMC_TSC_STACK_CORE_STRUCT_(PFX, SNAME, V) \
+\
+    /* Stack Structure */ \
+    struct SNAME \
+    { \
+        /* Fixed size array of nodes */ \
+        struct CMC_DEF_NODE(SNAME) * buffer; \
+\
+        /* Amount of nodes in the buffer */ \
+        size_t capacity; \
+\
+        /* Current amount of elements (might be temporarily overestimated) */ \
+        _Atomic(size_t) count; \
+\
+        /* Tagged index of the top node of the stack */ \
+        _Atomic(uint64_t) head; \
+\
+        /* Tagged index of the first unused node */ \
+        _Atomic(uint64_t) free; \
+\
+        /* Flags indicating errors or success */ \
+        _Atomic(int) flag; \
+\
+        /* Value function table */ \
+        struct CMC_DEF_FVAL(SNAME) * f_val; \
+\
+        /* Custom allocation functions */ \
+        struct CMC_ALLOC_NODE_NAME *alloc; \
+\
+        /* Custom callback functions */ \
+        CMC_CALLBACKS_DECL; \
+    }; \
+\
+    /* Stack Node */ \
+    struct CMC_DEF_NODE(SNAME) \
+    { \
+        /* Node's value */ \
+        V value; \
+\
+        /* Index of the next node in the stack or in the free list */ \
+        _Atomic(uint32_t) next; \
+    };
+
+/* -------------------------------------------------------------------------
+ * Header
+ * ------------------------------------------------------------------------- */
+#define CMC_TSC_STACK_CORE_HEADER_(PFX, SNAME, V) \
+\
+    /* Value struct function table */ \
+    struct CMC_DEF_FVAL(SNAME) \
+    { \
+        /* Comparator function */ \
+        CMC_DEF_FTAB_CMP(V); \
+\
+        /* Copy function */ \
+        CMC_DEF_FTAB_CPY(V); \
+\
+        /* To string function */ \
+        CMC_DEF_FTAB_STR(V); \
+\
+        /* Free from memory function */ \
+        CMC_DEF_FTAB_FREE(V); \
+\
+        /* Hash function */ \
+        CMC_DEF_FTAB_HASH(V); \
+\
+        /* Priority function */ \
+        CMC_DEF_FTAB_PRI(V); \
+    }; \
+\
+    /* Collection Functions */ \
+    /* Collection Allocation and Deallocation */ \
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val); \
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks); \
+    void CMC_(PFX, _free)(struct SNAME * _stack_); \
+    /* Customization of Allocation and Callbacks */ \
+    void CMC_(PFX, _customize)(struct SNAME * _stack_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks); \
+    /* Collection Input and Output */ \
+    bool CMC_(PFX, _push)(struct SNAME * _stack_, V value); \
+    bool CMC_(PFX, _push_many)(struct SNAME * _stack_, V * values, size_t count); \
+    bool CMC_(PFX, _pop)(struct SNAME * _stack_, V * value); \
+    /* Collection State */ \
+    bool CMC_(PFX, _empty)(struct SNAME * _stack_); \
+    bool CMC_(PFX, _full)(struct SNAME * _stack_); \
+    size_t CMC_(PFX, _count)(struct SNAME * _stack_); \
+    size_t CMC_(PFX, _capacity)(struct SNAME * _stack_); \
+    int CMC_(PFX, _flag)(struct SNAME * _stack_);
+
+/* -------------------------------------------------------------------------
+ * Source
+ * ------------------------------------------------------------------------- */
+#define CMC_TSC_STACK_CORE_SOURCE_(PFX, SNAME, V) \
+\
+    /* Implementation Detail Functions */ \
+    static uint32_t CMC_(PFX, _impl_pop)(struct SNAME * _stack_, _Atomic(uint64_t) * head); \
+    static void CMC_(PFX, _impl_push)(struct SNAME * _stack_, _Atomic(uint64_t) * head, uint32_t first, \
+                                      uint32_t last); \
+\
+    struct SNAME *CMC_(PFX, _new)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val) \
+    { \
+        return CMC_(PFX, _new_custom)(capacity, f_val, NULL, NULL); \
+    } \
+\
+    struct SNAME *CMC_(PFX, _new_custom)(size_t capacity, struct CMC_DEF_FVAL(SNAME) * f_val, \
+                                         struct CMC_ALLOC_NODE_NAME * alloc, struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        /* UINT32_MAX is reserved to represent the end of a list */ \
+        if (capacity < 1 || capacity >= UINT32_MAX) \
+            return NULL; \
+\
+        if (!f_val) \
+            return NULL; \
+\
+        if (!alloc) \
+            alloc = &cmc_alloc_node_default; \
+\
+        struct SNAME *_stack_ = alloc->malloc(sizeof(struct SNAME)); \
+\
+        if (!_stack_) \
+            return NULL; \
+\
+        _stack_->buffer = alloc->calloc(capacity, sizeof(struct CMC_DEF_NODE(SNAME))); \
+\
+        if (!_stack_->buffer) \
+        { \
+            alloc->free(_stack_); \
+            return NULL; \
+        } \
+\
+        /* Every node starts in the free list */ \
+        for (size_t i = 0; i < capacity; i++) \
+            atomic_init(&_stack_->buffer[i].next, i + 1 < capacity ? (uint32_t)(i + 1) : UINT32_MAX); \
+\
+        _stack_->capacity = capacity; \
+        atomic_init(&_stack_->count, 0); \
+        atomic_init(&_stack_->head, UINT32_MAX); \
+        atomic_init(&_stack_->free, 0); \
+        atomic_init(&_stack_->flag, CMC_FLAG_OK); \
+        _stack_->f_val = f_val; \
+        _stack_->alloc = alloc; \
+        CMC_CALLBACKS_ASSIGN(_stack_, callbacks); \
+\
+        return _stack_; \
+    } \
+\
+    void CMC_(PFX, _free)(struct SNAME * _stack_) \
+    { \
+        if (_stack_->f_val->free) \
+        { \
+            uint32_t index = (uint32_t)atomic_load(&_stack_->head); \
+\
+            while (index != UINT32_MAX) \
+            { \
+                _stack_->f_val->free(_stack_->buffer[index].value); \
+\
+                index = atomic_load(&_stack_->buffer[index].next); \
+            } \
+        } \
+\
+        _stack_->alloc->free(_stack_->buffer); \
+        _stack_->alloc->free(_stack_); \
+    } \
+\
+    void CMC_(PFX, _customize)(struct SNAME * _stack_, struct CMC_ALLOC_NODE_NAME * alloc, \
+                               struct CMC_CALLBACKS_NAME * callbacks) \
+    { \
+        CMC_CALLBACKS_MAYBE_UNUSED(callbacks); \
+\
+        if (!alloc) \
+            _stack_->alloc = &cmc_alloc_node_default; \
+        else \
+            _stack_->alloc = alloc; \
+\
+        CMC_CALLBACKS_ASSIGN(_stack_, callbacks); \
+\
+        atomic_store_explicit(&_stack_->flag, CMC_FLAG_OK, memory_order_relaxed); \
+    } \
+\
+    bool CMC_(PFX, _push)(struct SNAME * _stack_, V value) \
+    { \
+        uint32_t index = CMC_(PFX, _impl_pop)(_stack_, &_stack_->free); \
+\
+        if (index == UINT32_MAX) \
+        { \
+            atomic_store_explicit(&_stack_->flag, CMC_FLAG_FULL, memory_order_relaxed); \
+            return false; \
+        } \
+\
+        _stack_->buffer[index].value = value; \
+\
+        /* Incremented before the node is visible so the count never underflows */ \
+        atomic_fetch_add_explicit(&_stack_->count, 1, memory_order_relaxed); \
+\
+        CMC_(PFX, _impl_push)(_stack_, &_stack_->head, index, index); \
+\
+        atomic_store_explicit(&_stack_->flag, CMC_FLAG_OK, memory_order_relaxed); \
+\
+        CMC_CALLBACKS_CALL(_stack_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _push_many)(struct SNAME * _stack_, V * values, size_t count) \
+    { \
+        if (count == 0) \
+        { \
+            atomic_store_explicit(&_stack_->flag, CMC_FLAG_OK, memory_order_relaxed); \
+            return true; \
+        } \
+\
+        if (count > _stack_->capacity) \
+        { \
+            atomic_store_explicit(&_stack_->flag, CMC_FLAG_FULL, memory_order_relaxed); \
+            return false; \
+        } \
+\
+        /* Build a private chain where values[count - 1] is at the top */ \
+        uint32_t first = UINT32_MAX; \
+        uint32_t last = UINT32_MAX; \
+\
+        for (size_t i = 0; i < count; i++) \
+        { \
+            uint32_t index = CMC_(PFX, _impl_pop)(_stack_, &_stack_->free); \
+\
+            if (index == UINT32_MAX) \
+            { \
+                /* Not enough free nodes so give back the ones taken */ \
+                if (first != UINT32_MAX) \
+                    CMC_(PFX, _impl_push)(_stack_, &_stack_->free, first, last); \
+\
+                atomic_store_explicit(&_stack_->flag, CMC_FLAG_FULL, memory_order_relaxed); \
+                return false; \
+            } \
+\
+            _stack_->buffer[index].value = values[i]; \
+            atomic_store_explicit(&_stack_->buffer[index].next, first, memory_order_relaxed); \
+\
+            if (first == UINT32_MAX) \
+                last = index; \
+\
+            first = index; \
+        } \
+\
+        atomic_fetch_add_explicit(&_stack_->count, count, memory_order_relaxed); \
+\
+        /* A single successful CAS publishes the whole chain */ \
+        CMC_(PFX, _impl_push)(_stack_, &_stack_->head, first, last); \
+\
+        atomic_store_explicit(&_stack_->flag, CMC_FLAG_OK, memory_order_relaxed); \
+\
+        CMC_CALLBACKS_CALL(_stack_, create); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _pop)(struct SNAME * _stack_, V * value) \
+    { \
+        uint32_t index = CMC_(PFX, _impl_pop)(_stack_, &_stack_->head); \
+\
+        if (index == UINT32_MAX) \
+        { \
+            atomic_store_explicit(&_stack_->flag, CMC_FLAG_EMPTY, memory_order_relaxed); \
+            return false; \
+        } \
+\
+        atomic_fetch_sub_explicit(&_stack_->count, 1, memory_order_relaxed); \
+\
+        if (value) \
+            *value = _stack_->buffer[index].value; \
+\
+        CMC_(PFX, _impl_push)(_stack_, &_stack_->free, index, index); \
+\
+        atomic_store_explicit(&_stack_->flag, CMC_FLAG_OK, memory_order_relaxed); \
+\
+        CMC_CALLBACKS_CALL(_stack_, delete); \
+\
+        return true; \
+    } \
+\
+    bool CMC_(PFX, _empty)(struct SNAME * _stack_) \
+    { \
+        return (uint32_t)atomic_load_explicit(&_stack_->head, memory_order_relaxed) == UINT32_MAX; \
+    } \
+\
+    bool CMC_(PFX, _full)(struct SNAME * _stack_) \
+    { \
+        return (uint32_t)atomic_load_explicit(&_stack_->free, memory_order_relaxed) == UINT32_MAX; \
+    } \
+\
+    size_t CMC_(PFX, _count)(struct SNAME * _stack_) \
+    { \
+        return atomic_load_explicit(&_stack_->count, memory_order_relaxed); \
+    } \
+\
+    size_t CMC_(PFX, _capacity)(struct SNAME * _stack_) \
+    { \
+        return _stack_->capacity; \
+    } \
+\
+    int CMC_(PFX, _flag)(struct SNAME * _stack_) \
+    { \
+        return atomic_load_explicit(&_stack_->flag, memory_order_relaxed); \
+    } \
+\
+    /* Pops the top node of a list (either the stack or the free list) and */ \
+    /* returns its index or UINT32_MAX if the list is empty. The lower 32 */ \
+    /* bits of a head hold an index and the upper 32 bits a tag that */ \
+    /* changes on every update, so a head that was popped and pushed back */ \
+    /* by other threads in the meantime is never mistaken as unchanged. */ \
+    static uint32_t CMC_(PFX, _impl_pop)(struct SNAME * _stack_, _Atomic(uint64_t) * head) \
+    { \
+        uint64_t old_head = atomic_load_explicit(head, memory_order_acquire); \
+        uint64_t new_head; \
+        uint32_t index; \
+\
+        do \
+        { \
+            index = (uint32_t)old_head; \
+\
+            if (index == UINT32_MAX) \
+                return UINT32_MAX; \
+\
+            /* Might be stale if the node was taken, but then the CAS fails */ \
+            uint32_t next = atomic_load_explicit(&_stack_->buffer[index].next, memory_order_relaxed); \
+\
+            new_head = (((old_head >> 32) + 1) << 32) | next; \
+        } while (!atomic_compare_exchange_weak_explicit(head, &old_head, new_head, memory_order_acq_rel, \
+                                                        memory_order_acquire)); \
+\
+        return index; \
+    } \
+\
+    /* Pushes a chain of nodes, from first to last, to a list. The chain */ \
+    /* must already be linked and owned by the calling thread. */ \
+    static void CMC_(PFX, _impl_push)(struct SNAME * _stack_, _Atomic(uint64_t) * head, uint32_t first, \
+                                      uint32_t last) \
+    { \
+        uint64_t old_head = atomic_load_explicit(head, memory_order_relaxed); \
+        uint64_t new_head; \
+\
+        do \
+        { \
+            atomic_store_explicit(&_stack_->buffer[last].next, (uint32_t)old_head, memory_order_relaxed); \
+\
+            new_head = (((old_head >> 32) + 1) << 32) | first; \
+        } while (!atomic_compare_exchange_weak_explicit(head, &old_head, new_head, memory_order_release, \
+                                                        memory_order_relaxed)); \
+    }
+
+#endif /* CMC_TSC_STACK_H */
@@ -45,6 +45,12 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 /**
  * cmp
  */
@@ -487,4 +493,283 @@ static inline size_t cmc_u64_hash_mix(uint64_t element)
 
 /* Can simply use cmp for basic data types */
 
+/**
+ * bytes
+ *
+ * Binary-comparable representation of a key, as used by radix trees. The
+ * result is either written to buffer (which holds at least 16 bytes) or points
+ * to the key's own memory.
+ */
+
+// Signed Integers
+
+static inline const unsigned char *cmc_i64_bytes(int64_t *key, unsigned char *buffer, size_t *length)
+{
+    // Flipping the sign bit makes negative numbers sort before positive ones
+    uint64_t k = (uint64_t)*key ^ UINT64_C(0x8000000000000000);
+
+    for (size_t i = 0; i < 8; i++)
+        buffer[i] = (unsigned char)(k >> (56 - i * 8));
+
+    *length = 8;
+    return buffer;
+}
+
+static inline const unsigned char *cmc_i32_bytes(int32_t *key, unsigned char *buffer, size_t *length)
+{
+    uint32_t k = (uint32_t)*key ^ UINT32_C(0x80000000);
+
+    for (size_t i = 0; i < 4; i++)
+        buffer[i] = (unsigned char)(k >> (24 - i * 8));
+
+    *length = 4;
+    return buffer;
+}
+
+// Unsigned Integers
+
+static inline const unsigned char *cmc_u64_bytes(uint64_t *key, unsigned char *buffer, size_t *length)
+{
+    for (size_t i = 0; i < 8; i++)
+        buffer[i] = (unsigned char)(*key >> (56 - i * 8));
+
+    *length = 8;
+    return buffer;
+}
+
+static inline const unsigned char *cmc_u32_bytes(uint32_t *key, unsigned char *buffer, size_t *length)
+{
+    for (size_t i = 0; i < 4; i++)
+        buffer[i] = (unsigned char)(*key >> (24 - i * 8));
+
+    *length = 4;
+    return buffer;
+}
+
+static inline const unsigned char *cmc_size_bytes(size_t *key, unsigned char *buffer, size_t *length)
+{
+    for (size_t i = 0; i < sizeof(size_t); i++)
+        buffer[i] = (unsigned char)(*key >> ((sizeof(size_t) - 1 - i) * 8));
+
+    *length = sizeof(size_t);
+    return buffer;
+}
+
+// String
+
+static inline const unsigned char *cmc_str_bytes(char **key, unsigned char *buffer, size_t *length)
+{
+    (void)buffer;
+
+    // The bytes of a null terminated string already sort like strcmp
+    *length = strlen(*key);
+    return (const unsigned char *)*key;
+}
+
+/**
+ * find
+ *
+ * Index of the first element of an array equal to value, or count if there is
+ * none. Blocks of elements are compared at once with AVX2 or SSE2 when the
+ * compiler targets them, the rest is compared one by one. Floating point
+ * values are equal whenever cmc_float_cmp and cmc_double_cmp return 0, which
+ * includes every comparison with NaN, so that find always agrees with cmp.
+ */
+
+// Position of the lowest set bit of a non-zero comparison mask
+static inline size_t cmc_find_first_bit(unsigned mask)
+{
+    size_t i = 0;
+
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        i++;
+    }
+
+    return i;
+}
+
+// Integers
+
+static inline size_t cmc_u32_find(uint32_t *array, size_t count, uint32_t value)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i needle = _mm256_set1_epi32((int)value);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(array + i));
+        unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+
+        if (mask != 0)
+            return i + cmc_find_first_bit(mask);
+    }
+#elif defined(__SSE2__)
+    __m128i needle = _mm_set1_epi32((int)value);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(array + i));
+        unsigned mask = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+
+        if (mask != 0)
+            return i + cmc_find_first_bit(mask);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (array[i] == value)
+            return i;
+    }
+
+    return count;
+}
+
+static inline size_t cmc_u64_find(uint64_t *array, size_t count, uint64_t value)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i needle = _mm256_set1_epi64x((long long)value);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(array + i));
+        unsigned mask = (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(block, needle)));
+
+        if (mask != 0)
+            return i + cmc_find_first_bit(mask);
+    }
+#elif defined(__SSE2__)
+    // SSE2 has no 64-bit comparison, so both 32-bit halves must be equal
+    __m128i needle = _mm_set1_epi64x((long long)value);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(array + i));
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi32(block, needle));
+
+        if ((mask & 0x00FF) == 0x00FF)
+            return i;
+        if ((mask & 0xFF00) == 0xFF00)
+            return i + 1;
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (array[i] == value)
+            return i;
+    }
+
+    return count;
+}
+
+static inline size_t cmc_i32_find(int32_t *array, size_t count, int32_t value)
+{
+    return cmc_u32_find((uint32_t *)array, count, (uint32_t)value);
+}
+
+static inline size_t cmc_i64_find(int64_t *array, size_t count, int64_t value)
+{
+    return cmc_u64_find((uint64_t *)array, count, (uint64_t)value);
+}
+
+static inline size_t cmc_size_find(size_t *array, size_t count, size_t value)
+{
+#if SIZE_MAX == UINT64_MAX
+    return cmc_u64_find((uint64_t *)array, count, (uint64_t)value);
+#elif SIZE_MAX == UINT32_MAX
+    return cmc_u32_find((uint32_t *)array, count, (uint32_t)value);
+#else
+    for (size_t i = 0; i < count; i++)
+    {
+        if (array[i] == value)
+            return i;
+    }
+
+    return count;
+#endif
+}
+
+// Floating Point
+
+static inline size_t cmc_float_find(float *array, size_t count, float value)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256 needle = _mm256_set1_ps(value);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(array + i), needle, _CMP_EQ_UQ));
+
+        if (mask != 0)
+            return i + cmc_find_first_bit(mask);
+    }
+#elif defined(__SSE2__)
+    __m128 needle = _mm_set1_ps(value);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 block = _mm_loadu_ps(array + i);
+        __m128 equal = _mm_or_ps(_mm_cmpeq_ps(block, needle), _mm_cmpunord_ps(block, needle));
+        unsigned mask = (unsigned)_mm_movemask_ps(equal);
+
+        if (mask != 0)
+            return i + cmc_find_first_bit(mask);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (!(array[i] < value) && !(array[i] > value))
+            return i;
+    }
+
+    return count;
+}
+
+static inline size_t cmc_double_find(double *array, size_t count, double value)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256d needle = _mm256_set1_pd(value);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        unsigned mask = (unsigned)_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(array + i), needle, _CMP_EQ_UQ));
+
+        if (mask != 0)
+            return i + cmc_find_first_bit(mask);
+    }
+#elif defined(__SSE2__)
+    __m128d needle = _mm_set1_pd(value);
+
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128d block = _mm_loadu_pd(array + i);
+        __m128d equal = _mm_or_pd(_mm_cmpeq_pd(block, needle), _mm_cmpunord_pd(block, needle));
+        unsigned mask = (unsigned)_mm_movemask_pd(equal);
+
+        if (mask != 0)
+            return i + cmc_find_first_bit(mask);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (!(array[i] < value) && !(array[i] > value))
+            return i;
+    }
+
+    return count;
+}
+
 #endif /* CMC_UTL_FUTILS_H */
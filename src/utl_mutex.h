@@ -33,10 +33,12 @@
  */
 
 /**
- * A very simple, header-only and minimalistic cross-platform mutex
+ * A very simple, header-only and minimalistic cross-platform mutex and
+ * condition variable
  *
  * Types
  *  - cmc_mutex
+ *  - cmc_condvar
  *
  * Functions
  *  - cmc_mtx_init
@@ -44,12 +46,21 @@
  *  - cmc_mtx_lock
  *  - cmc_mtx_unlock
  *  - cmc_mtx_trylock
+ *  - cmc_cnd_init
+ *  - cmc_cnd_destroy
+ *  - cmc_cnd_wait
+ *  - cmc_cnd_timedwait
+ *  - cmc_cnd_deadline
+ *  - cmc_cnd_remaining
+ *  - cmc_cnd_signal
+ *  - cmc_cnd_broadcast
  */
 
 #ifndef CMC_UTL_MUTEX_H
 #define CMC_UTL_MUTEX_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "cor_flags.h"
 
@@ -67,17 +78,26 @@
 #elif defined(CMC_MUTEX_UNIX)
 #include <errno.h>
 #include <pthread.h>
+#include <time.h>
+#endif
+
+/* Timed waits on Unix use a monotonic clock when the POSIX clock functions */
+/* are available. Otherwise, like with -std=c11 and no feature test macros, */
+/* they fall back to the realtime clock of the standard C library. */
+#if defined(CMC_MUTEX_UNIX) && defined(CLOCK_MONOTONIC) && defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L
+#define CMC_MUTEX_MONOTONIC
 #endif
 
 /**
  * struct cmc_mutex
  *
- * A mutex wrapper.
+ * A mutex wrapper. On Windows a critical section is used so that the mutex
+ * can be paired with a cmc_condvar.
  */
 struct cmc_mutex
 {
 #if defined(CMC_MUTEX_WINDOWS)
-    HANDLE mutex;
+    CRITICAL_SECTION mutex;
 #elif defined(CMC_MUTEX_UNIX)
     pthread_mutex_t mutex;
 #endif
@@ -93,14 +113,10 @@ struct cmc_mutex
 static inline bool cmc_mtx_init(struct cmc_mutex *mtx)
 {
 #if defined(CMC_MUTEX_WINDOWS)
-    mtx->mutex = CreateMutex(NULL, FALSE, NULL);
+    InitializeCriticalSection(&(mtx->mutex));
 
-    if (mtx->mutex == NULL)
-        mtx->flag = CMC_FLAG_MUTEX;
-    else
-        mtx->flag = CMC_FLAG_OK;
-
-    return mtx->mutex != NULL;
+    mtx->flag = CMC_FLAG_OK;
+    return true;
 
 #elif defined(CMC_MUTEX_UNIX)
     int err = pthread_mutex_init(&(mtx->mutex), NULL);
@@ -124,11 +140,7 @@ static inline bool cmc_mtx_init(struct cmc_mutex *mtx)
 static inline bool cmc_mtx_destroy(struct cmc_mutex *mtx)
 {
 #if defined(CMC_MUTEX_WINDOWS)
-    if (!CloseHandle(mtx->mutex))
-    {
-        mtx->flag = CMC_FLAG_MUTEX;
-        return false;
-    }
+    DeleteCriticalSection(&(mtx->mutex));
 
     mtx->flag = CMC_FLAG_OK;
     return true;
@@ -155,13 +167,7 @@ static inline bool cmc_mtx_destroy(struct cmc_mutex *mtx)
 static inline bool cmc_mtx_lock(struct cmc_mutex *mtx)
 {
 #if defined(CMC_MUTEX_WINDOWS)
-    DWORD result = WaitForSingleObject(mtx->mutex, INFINITE);
-
-    if (result == WAIT_FAILED || result == WAIT_ABANDONED)
-    {
-        mtx->flag = CMC_FLAG_MUTEX;
-        return false;
-    }
+    EnterCriticalSection(&(mtx->mutex));
 
     mtx->flag = CMC_FLAG_OK;
     return true;
@@ -188,20 +194,23 @@ static inline bool cmc_mtx_lock(struct cmc_mutex *mtx)
 static inline bool cmc_mtx_unlock(struct cmc_mutex *mtx)
 {
 #if defined(CMC_MUTEX_WINDOWS)
-    if (!ReleaseMutex(mtx->mutex))
-        mtx->flag = CMC_FLAG_MUTEX;
-    else
-        mtx->flag = CMC_FLAG_OK;
+    mtx->flag = CMC_FLAG_OK;
+
+    LeaveCriticalSection(&(mtx->mutex));
 
-    return mtx->flag == CMC_FLAG_OK;
+    return true;
 
 #elif defined(CMC_MUTEX_UNIX)
+    /* The flag can only be safely written while the mutex is still locked */
+    mtx->flag = CMC_FLAG_OK;
+
     if (pthread_mutex_unlock(&mtx->mutex) != 0)
+    {
         mtx->flag = CMC_FLAG_MUTEX;
-    else
-        mtx->flag = CMC_FLAG_OK;
+        return false;
+    }
 
-    return mtx->flag == CMC_FLAG_OK;
+    return true;
 #endif
 }
 
@@ -215,27 +224,331 @@ static inline bool cmc_mtx_unlock(struct cmc_mutex *mtx)
 static inline bool cmc_mtx_trylock(struct cmc_mutex *mtx)
 {
 #if defined(CMC_MUTEX_WINDOWS)
-    DWORD result = WaitForSingleObject(mtx->mutex, 0);
-
-    if (result == WAIT_FAILED || result == WAIT_ABANDONED)
-    {
-        mtx->flag = CMC_FLAG_MUTEX;
+    if (!TryEnterCriticalSection(&(mtx->mutex)))
         return false;
-    }
 
     mtx->flag = CMC_FLAG_OK;
-    return result != WAIT_TIMEOUT;
+    return true;
 
 #elif defined(CMC_MUTEX_UNIX)
     int err = pthread_mutex_trylock(&mtx->mutex);
 
+    /* Another thread might own the mutex so the flag is left untouched */
     if (err == EINVAL || err == EFAULT)
         mtx->flag = CMC_FLAG_MUTEX;
-    else
+    else if (err == 0)
         mtx->flag = CMC_FLAG_OK;
 
     return err == 0;
 #endif
 }
 
+/**
+ * struct cmc_condvar
+ *
+ * A condition variable wrapper. It is always used together with a cmc_mutex.
+ */
+struct cmc_condvar
+{
+#if defined(CMC_MUTEX_WINDOWS)
+    CONDITION_VARIABLE condvar;
+#elif defined(CMC_MUTEX_UNIX)
+    pthread_cond_t condvar;
+#endif
+    int flag;
+};
+
+/**
+ * Acquire resources for a condition variable. On Unix the condition variable
+ * measures timeouts using a monotonic clock, if available, so that changes to
+ * the system time do not affect cmc_cnd_timedwait.
+ *
+ * \param cnd An uninitialized condition variable wrapper.
+ * \return True or false if the condition variable was successfully initialized.
+ */
+static inline bool cmc_cnd_init(struct cmc_condvar *cnd)
+{
+#if defined(CMC_MUTEX_WINDOWS)
+    InitializeConditionVariable(&(cnd->condvar));
+
+    cnd->flag = CMC_FLAG_OK;
+    return true;
+
+#elif defined(CMC_MUTEX_MONOTONIC)
+    pthread_condattr_t attr;
+
+    if (pthread_condattr_init(&attr) != 0)
+    {
+        cnd->flag = CMC_FLAG_MUTEX;
+        return false;
+    }
+
+    int err = pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+
+    if (err == 0)
+        err = pthread_cond_init(&(cnd->condvar), &attr);
+
+    pthread_condattr_destroy(&attr);
+
+    if (err != 0)
+        cnd->flag = CMC_FLAG_MUTEX;
+    else
+        cnd->flag = CMC_FLAG_OK;
+
+    return err == 0;
+
+#elif defined(CMC_MUTEX_UNIX)
+    /* The default clock of a condition variable is the realtime clock */
+    int err = pthread_cond_init(&(cnd->condvar), NULL);
+
+    if (err != 0)
+        cnd->flag = CMC_FLAG_MUTEX;
+    else
+        cnd->flag = CMC_FLAG_OK;
+
+    return err == 0;
+#endif
+}
+
+/**
+ * Release all resources from a condition variable. Calling this function while
+ * there are threads waiting on the condition variable causes undefined
+ * behavior.
+ *
+ * \param cnd A condition variable to be destroyed.
+ * \return True or false if the condition variable was successfully destroyed.
+ */
+static inline bool cmc_cnd_destroy(struct cmc_condvar *cnd)
+{
+#if defined(CMC_MUTEX_WINDOWS)
+    /* Windows condition variables don't need to be destroyed */
+    cnd->flag = CMC_FLAG_OK;
+    return true;
+
+#elif defined(CMC_MUTEX_UNIX)
+    if (pthread_cond_destroy(&(cnd->condvar)) != 0)
+    {
+        cnd->flag = CMC_FLAG_MUTEX;
+        return false;
+    }
+
+    cnd->flag = CMC_FLAG_OK;
+    return true;
+#endif
+}
+
+/**
+ * Atomically unlocks a mutex and blocks the current thread until the condition
+ * variable is signaled. The mutex is locked again before the function returns.
+ * Spurious wakeups may happen so the condition being waited on must always be
+ * checked again by the caller.
+ *
+ * \param cnd A condition variable to wait on.
+ * \param mtx A mutex locked by the calling thread.
+ * \return True or false if the thread was successfully woken up.
+ */
+static inline bool cmc_cnd_wait(struct cmc_condvar *cnd, struct cmc_mutex *mtx)
+{
+#if defined(CMC_MUTEX_WINDOWS)
+    if (!SleepConditionVariableCS(&(cnd->condvar), &(mtx->mutex), INFINITE))
+    {
+        cnd->flag = CMC_FLAG_MUTEX;
+        return false;
+    }
+
+    cnd->flag = CMC_FLAG_OK;
+    return true;
+
+#elif defined(CMC_MUTEX_UNIX)
+    if (pthread_cond_wait(&(cnd->condvar), &(mtx->mutex)) != 0)
+    {
+        cnd->flag = CMC_FLAG_MUTEX;
+        return false;
+    }
+
+    cnd->flag = CMC_FLAG_OK;
+    return true;
+#endif
+}
+
+#if defined(CMC_MUTEX_UNIX)
+/* Current time of the clock used by the condition variables */
+static inline bool cmc_cnd_now(struct timespec *now)
+{
+#if defined(CMC_MUTEX_MONOTONIC)
+    return clock_gettime(CLOCK_MONOTONIC, now) == 0;
+#elif defined(TIME_UTC)
+    return timespec_get(now, TIME_UTC) == TIME_UTC;
+#else
+    now->tv_sec = time(NULL);
+    now->tv_nsec = 0;
+
+    return now->tv_sec != (time_t)-1;
+#endif
+}
+#endif
+
+/**
+ * Same as cmc_cnd_wait but gives up after a certain amount of time. If the
+ * time runs out the function returns false and the flag is set to
+ * CMC_FLAG_OK. Otherwise, if an error occurs, the flag is set to
+ * CMC_FLAG_MUTEX.
+ *
+ * \param cnd          A condition variable to wait on.
+ * \param mtx          A mutex locked by the calling thread.
+ * \param milliseconds For how long the thread is allowed to wait.
+ * \return True if the thread was woken up before the time ran out.
+ */
+static inline bool cmc_cnd_timedwait(struct cmc_condvar *cnd, struct cmc_mutex *mtx, size_t milliseconds)
+{
+#if defined(CMC_MUTEX_WINDOWS)
+    DWORD ms = milliseconds >= INFINITE ? INFINITE - 1 : (DWORD)milliseconds;
+
+    if (!SleepConditionVariableCS(&(cnd->condvar), &(mtx->mutex), ms))
+    {
+        if (GetLastError() == ERROR_TIMEOUT)
+            cnd->flag = CMC_FLAG_OK;
+        else
+            cnd->flag = CMC_FLAG_MUTEX;
+
+        return false;
+    }
+
+    cnd->flag = CMC_FLAG_OK;
+    return true;
+
+#elif defined(CMC_MUTEX_UNIX)
+    struct timespec deadline;
+
+    if (!cmc_cnd_now(&deadline))
+    {
+        cnd->flag = CMC_FLAG_MUTEX;
+        return false;
+    }
+
+    deadline.tv_sec += (time_t)(milliseconds / 1000);
+    deadline.tv_nsec += (long)(milliseconds % 1000) * 1000000L;
+
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    int err = pthread_cond_timedwait(&(cnd->condvar), &(mtx->mutex), &deadline);
+
+    if (err != 0 && err != ETIMEDOUT)
+        cnd->flag = CMC_FLAG_MUTEX;
+    else
+        cnd->flag = CMC_FLAG_OK;
+
+    return err == 0;
+#endif
+}
+
+/* Milliseconds on the clock used by condition variables */
+static inline bool cmc_cnd_clock(size_t *now)
+{
+#if defined(CMC_MUTEX_WINDOWS)
+    *now = (size_t)GetTickCount64();
+
+    return true;
+
+#elif defined(CMC_MUTEX_UNIX)
+    struct timespec ts;
+
+    if (!cmc_cnd_now(&ts))
+        return false;
+
+    *now = (size_t)ts.tv_sec * 1000 + (size_t)ts.tv_nsec / 1000000;
+
+    return true;
+#endif
+}
+
+/**
+ * Computes the deadline, in milliseconds of the clock used by condition
+ * variables, of a wait that starts now and lasts for a certain amount of time.
+ * It is meant to be used with cmc_cnd_remaining when a thread waits on a
+ * condition variable in a loop, so that wakeups that don't end the loop don't
+ * restart the timeout.
+ *
+ * \param milliseconds For how long the thread is allowed to wait in total.
+ * \return The deadline, saturated to SIZE_MAX, or 0 if the clock failed.
+ */
+static inline size_t cmc_cnd_deadline(size_t milliseconds)
+{
+    size_t now;
+
+    if (!cmc_cnd_clock(&now))
+        return 0;
+
+    return now > SIZE_MAX - milliseconds ? SIZE_MAX : now + milliseconds;
+}
+
+/**
+ * How many milliseconds are left until a deadline computed by
+ * cmc_cnd_deadline.
+ *
+ * \param deadline A deadline returned by cmc_cnd_deadline.
+ * \return The time left, or 0 if the deadline has passed or the clock failed.
+ */
+static inline size_t cmc_cnd_remaining(size_t deadline)
+{
+    size_t now;
+
+    if (!cmc_cnd_clock(&now) || now >= deadline)
+        return 0;
+
+    return deadline - now;
+}
+
+/**
+ * Wakes up at least one of the threads waiting on a condition variable, if any.
+ *
+ * \param cnd A condition variable to signal.
+ * \return True or false if the condition variable was successfully signaled.
+ */
+static inline bool cmc_cnd_signal(struct cmc_condvar *cnd)
+{
+#if defined(CMC_MUTEX_WINDOWS)
+    WakeConditionVariable(&(cnd->condvar));
+
+    cnd->flag = CMC_FLAG_OK;
+    return true;
+
+#elif defined(CMC_MUTEX_UNIX)
+    if (pthread_cond_signal(&(cnd->condvar)) != 0)
+        cnd->flag = CMC_FLAG_MUTEX;
+    else
+        cnd->flag = CMC_FLAG_OK;
+
+    return cnd->flag == CMC_FLAG_OK;
+#endif
+}
+
+/**
+ * Wakes up all threads waiting on a condition variable.
+ *
+ * \param cnd A condition variable to broadcast.
+ * \return True or false if the condition variable was successfully broadcast.
+ */
+static inline bool cmc_cnd_broadcast(struct cmc_condvar *cnd)
+{
+#if defined(CMC_MUTEX_WINDOWS)
+    WakeAllConditionVariable(&(cnd->condvar));
+
+    cnd->flag = CMC_FLAG_OK;
+    return true;
+
+#elif defined(CMC_MUTEX_UNIX)
+    if (pthread_cond_broadcast(&(cnd->condvar)) != 0)
+        cnd->flag = CMC_FLAG_MUTEX;
+    else
+        cnd->flag = CMC_FLAG_OK;
+
+    return cnd->flag == CMC_FLAG_OK;
+#endif
+}
+
 #endif /* CMC_UTL_MUTEX_H */
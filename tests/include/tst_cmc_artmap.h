@@ -0,0 +1,131 @@
+
+#ifndef CMC_CMC_ARTMAP_TEST_H
+#define CMC_CMC_ARTMAP_TEST_H
+
+#include "macro_collections.h"
+
+struct artmap
+{
+    struct artmap_node *root;
+    struct artmap_entry *head;
+    struct artmap_entry *tail;
+    size_t count;
+    int flag;
+    struct artmap_fkey *f_key;
+    struct artmap_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct artmap_node
+{
+    unsigned char kind;
+    uint16_t count;
+    size_t prefix_len;
+    union
+    {
+        unsigned char bytes[8];
+        unsigned char *heap;
+    } prefix;
+    struct artmap_entry *entry;
+};
+struct artmap_node4
+{
+    struct artmap_node header;
+    unsigned char keys[4];
+    struct artmap_node *children[4];
+};
+struct artmap_node16
+{
+    struct artmap_node header;
+    unsigned char keys[16];
+    struct artmap_node *children[16];
+};
+struct artmap_node48
+{
+    struct artmap_node header;
+    unsigned char index[256];
+    struct artmap_node *children[48];
+};
+struct artmap_node256
+{
+    struct artmap_node header;
+    struct artmap_node *children[256];
+};
+struct artmap_entry
+{
+    char *key;
+    size_t value;
+    struct artmap_entry *prev;
+    struct artmap_entry *next;
+};
+struct artmap_fkey
+{
+    int (*cmp)(char *, char *);
+    char *(*cpy)(char *);
+    _Bool (*str)(FILE *, char *);
+    void (*free)(char *);
+    size_t (*hash)(char *);
+    int (*pri)(char *, char *);
+    const unsigned char *(*bytes)(char **, unsigned char *, size_t *);
+};
+struct artmap_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct artmap *am_new(struct artmap_fkey *f_key, struct artmap_fval *f_val);
+struct artmap *am_new_custom(struct artmap_fkey *f_key, struct artmap_fval *f_val, struct cmc_alloc_node *alloc,
+                             struct cmc_callbacks *callbacks);
+void am_clear(struct artmap *_map_);
+void am_free(struct artmap *_map_);
+void am_customize(struct artmap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool am_insert(struct artmap *_map_, char *key, size_t value);
+_Bool am_update(struct artmap *_map_, char *key, size_t new_value, size_t *old_value);
+_Bool am_remove(struct artmap *_map_, char *key, size_t *out_value);
+_Bool am_max(struct artmap *_map_, char **key, size_t *value);
+_Bool am_min(struct artmap *_map_, char **key, size_t *value);
+size_t am_get(struct artmap *_map_, char *key);
+size_t *am_get_ref(struct artmap *_map_, char *key);
+_Bool am_longest_prefix(struct artmap *_map_, char *key, char **out_key, size_t *out_value);
+_Bool am_contains(struct artmap *_map_, char *key);
+_Bool am_empty(struct artmap *_map_);
+size_t am_count(struct artmap *_map_);
+int am_flag(struct artmap *_map_);
+struct artmap *am_copy_of(struct artmap *_map_);
+_Bool am_equals(struct artmap *_map1_, struct artmap *_map2_);
+struct artmap_iter
+{
+    struct artmap *target;
+    struct artmap_entry *cursor;
+    struct artmap_entry *first;
+    struct artmap_entry *last;
+    size_t count;
+    size_t index;
+    _Bool start;
+    _Bool end;
+};
+struct artmap_iter am_iter_start(struct artmap *target);
+struct artmap_iter am_iter_end(struct artmap *target);
+struct artmap_iter am_iter_prefix(struct artmap *target, char *prefix);
+_Bool am_iter_at_start(struct artmap_iter *iter);
+_Bool am_iter_at_end(struct artmap_iter *iter);
+_Bool am_iter_to_start(struct artmap_iter *iter);
+_Bool am_iter_to_end(struct artmap_iter *iter);
+_Bool am_iter_next(struct artmap_iter *iter);
+_Bool am_iter_prev(struct artmap_iter *iter);
+_Bool am_iter_advance(struct artmap_iter *iter, size_t steps);
+_Bool am_iter_rewind(struct artmap_iter *iter, size_t steps);
+_Bool am_iter_go_to(struct artmap_iter *iter, size_t index);
+char *am_iter_key(struct artmap_iter *iter);
+size_t am_iter_value(struct artmap_iter *iter);
+size_t *am_iter_rvalue(struct artmap_iter *iter);
+size_t am_iter_index(struct artmap_iter *iter);
+_Bool am_to_string(struct artmap *_map_, FILE *fptr);
+_Bool am_print(struct artmap *_map_, FILE *fptr, const char *start, const char *separator, const char *end,
+               const char *key_val_sep);
+
+#endif /* CMC_CMC_ARTMAP_TEST_H */
@@ -11,6 +11,8 @@ struct deque
     size_t count;
     size_t front;
     size_t back;
+    _Bool overwrite;
+    void (*evict)(size_t);
     int flag;
     struct deque_fval *f_val;
     struct cmc_alloc_node *alloc;
@@ -24,6 +26,7 @@ struct deque_fval
     void (*free)(size_t);
     size_t (*hash)(size_t);
     int (*pri)(size_t, size_t);
+    size_t (*find)(size_t *, size_t, size_t);
 };
 struct deque *d_new(size_t capacity, struct deque_fval *f_val);
 struct deque *d_new_custom(size_t capacity, struct deque_fval *f_val, struct cmc_alloc_node *alloc,
@@ -35,6 +38,7 @@ _Bool d_push_front(struct deque *_deque_, size_t value);
 _Bool d_push_back(struct deque *_deque_, size_t value);
 _Bool d_pop_front(struct deque *_deque_);
 _Bool d_pop_back(struct deque *_deque_);
+_Bool d_push_back_many(struct deque *_deque_, size_t *values, size_t count);
 size_t d_front(struct deque *_deque_);
 size_t d_back(struct deque *_deque_);
 _Bool d_contains(struct deque *_deque_, size_t value);
@@ -43,7 +47,10 @@ _Bool d_full(struct deque *_deque_);
 size_t d_count(struct deque *_deque_);
 size_t d_capacity(struct deque *_deque_);
 int d_flag(struct deque *_deque_);
+void d_sort(struct deque *_deque_);
+_Bool d_stable_sort(struct deque *_deque_);
 _Bool d_resize(struct deque *_deque_, size_t capacity);
+void d_set_overwrite(struct deque *_deque_, _Bool overwrite, void (*evict)(size_t));
 struct deque *d_copy_of(struct deque *_deque_);
 _Bool d_equals(struct deque *_deque1_, struct deque *_deque2_);
 struct deque d_init(size_t capacity, struct deque_fval *f_val);
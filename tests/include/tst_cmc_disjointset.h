@@ -0,0 +1,72 @@
+
+#ifndef CMC_CMC_DISJOINTSET_TEST_H
+#define CMC_CMC_DISJOINTSET_TEST_H
+
+#include "macro_collections.h"
+
+struct disjointset
+{
+    size_t *parent;
+    unsigned char *rank;
+    size_t *size;
+    size_t *next;
+    size_t *prev;
+    size_t count;
+    size_t sets;
+    int flag;
+    struct disjointset_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct disjointset_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct disjointset *djs_new(size_t count, struct disjointset_fval *f_val);
+struct disjointset *djs_new_custom(size_t count, struct disjointset_fval *f_val, struct cmc_alloc_node *alloc,
+                                   struct cmc_callbacks *callbacks);
+void djs_clear(struct disjointset *_set_);
+void djs_free(struct disjointset *_set_);
+void djs_customize(struct disjointset *_set_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool djs_union(struct disjointset *_set_, size_t value1, size_t value2);
+_Bool djs_find(struct disjointset *_set_, size_t value, size_t *root);
+_Bool djs_connected(struct disjointset *_set_, size_t value1, size_t value2);
+size_t djs_set_size(struct disjointset *_set_, size_t value);
+size_t djs_set_count(struct disjointset *_set_);
+size_t djs_count(struct disjointset *_set_);
+int djs_flag(struct disjointset *_set_);
+_Bool djs_resize(struct disjointset *_set_, size_t count);
+struct disjointset *djs_copy_of(struct disjointset *_set_);
+_Bool djs_equals(struct disjointset *_set1_, struct disjointset *_set2_);
+struct disjointset_iter
+{
+    struct disjointset *target;
+    size_t first;
+    size_t cursor;
+    size_t index;
+    size_t count;
+    _Bool start;
+    _Bool end;
+};
+struct disjointset_iter djs_iter_start(struct disjointset *target, size_t value);
+struct disjointset_iter djs_iter_end(struct disjointset *target, size_t value);
+_Bool djs_iter_at_start(struct disjointset_iter *iter);
+_Bool djs_iter_at_end(struct disjointset_iter *iter);
+_Bool djs_iter_to_start(struct disjointset_iter *iter);
+_Bool djs_iter_to_end(struct disjointset_iter *iter);
+_Bool djs_iter_next(struct disjointset_iter *iter);
+_Bool djs_iter_prev(struct disjointset_iter *iter);
+_Bool djs_iter_advance(struct disjointset_iter *iter, size_t steps);
+_Bool djs_iter_rewind(struct disjointset_iter *iter, size_t steps);
+_Bool djs_iter_go_to(struct disjointset_iter *iter, size_t index);
+size_t djs_iter_value(struct disjointset_iter *iter);
+size_t djs_iter_index(struct disjointset_iter *iter);
+_Bool djs_to_string(struct disjointset *_set_, FILE *fptr);
+_Bool djs_print(struct disjointset *_set_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_DISJOINTSET_TEST_H */
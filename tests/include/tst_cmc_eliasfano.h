@@ -0,0 +1,60 @@
+
+#ifndef CMC_CMC_ELIASFANO_TEST_H
+#define CMC_CMC_ELIASFANO_TEST_H
+
+#include "macro_collections.h"
+
+struct eliasfano
+{
+    uint64_t *lower;
+    uint64_t *upper;
+    size_t *ones;
+    size_t *zeros;
+    size_t count;
+    size_t low_bits;
+    size_t length;
+    size_t lower_words;
+    int flag;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct eliasfano *ef_new(size_t *values, size_t count);
+struct eliasfano *ef_new_custom(size_t *values, size_t count, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks);
+void ef_free(struct eliasfano *_ef_);
+void ef_customize(struct eliasfano *_ef_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+size_t ef_get(struct eliasfano *_ef_, size_t index);
+_Bool ef_next_geq(struct eliasfano *_ef_, size_t value, size_t *index, size_t *result);
+_Bool ef_contains(struct eliasfano *_ef_, size_t value);
+_Bool ef_empty(struct eliasfano *_ef_);
+size_t ef_count(struct eliasfano *_ef_);
+size_t ef_memory(struct eliasfano *_ef_);
+int ef_flag(struct eliasfano *_ef_);
+struct eliasfano *ef_copy_of(struct eliasfano *_ef_);
+_Bool ef_equals(struct eliasfano *_ef1_, struct eliasfano *_ef2_);
+struct eliasfano *ef_intersection(struct eliasfano *_ef1_, struct eliasfano *_ef2_);
+struct eliasfano_iter
+{
+    struct eliasfano *target;
+    size_t cursor;
+    size_t index;
+    _Bool start;
+    _Bool end;
+};
+struct eliasfano_iter ef_iter_start(struct eliasfano *target);
+struct eliasfano_iter ef_iter_end(struct eliasfano *target);
+_Bool ef_iter_at_start(struct eliasfano_iter *iter);
+_Bool ef_iter_at_end(struct eliasfano_iter *iter);
+_Bool ef_iter_to_start(struct eliasfano_iter *iter);
+_Bool ef_iter_to_end(struct eliasfano_iter *iter);
+_Bool ef_iter_next(struct eliasfano_iter *iter);
+_Bool ef_iter_prev(struct eliasfano_iter *iter);
+_Bool ef_iter_advance(struct eliasfano_iter *iter, size_t steps);
+_Bool ef_iter_rewind(struct eliasfano_iter *iter, size_t steps);
+_Bool ef_iter_go_to(struct eliasfano_iter *iter, size_t index);
+size_t ef_iter_value(struct eliasfano_iter *iter);
+size_t ef_iter_index(struct eliasfano_iter *iter);
+_Bool ef_to_string(struct eliasfano *_ef_, FILE *fptr);
+_Bool ef_print(struct eliasfano *_ef_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_ELIASFANO_TEST_H */
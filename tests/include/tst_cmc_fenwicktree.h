@@ -0,0 +1,44 @@
+
+#ifndef CMC_CMC_FENWICKTREE_TEST_H
+#define CMC_CMC_FENWICKTREE_TEST_H
+
+#include "macro_collections.h"
+
+struct fenwicktree
+{
+    size_t *values;
+    size_t *tree;
+    size_t *mirror;
+    size_t count;
+    int flag;
+    struct fenwicktree_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct fenwicktree_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+    size_t (*combine)(size_t, size_t);
+};
+struct fenwicktree *fwt_new(size_t *values, size_t count, struct fenwicktree_fval *f_val);
+struct fenwicktree *fwt_new_custom(size_t *values, size_t count, struct fenwicktree_fval *f_val,
+                                   struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+void fwt_free(struct fenwicktree *_tree_);
+void fwt_customize(struct fenwicktree *_tree_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool fwt_update(struct fenwicktree *_tree_, size_t index, size_t value);
+size_t fwt_get(struct fenwicktree *_tree_, size_t index);
+size_t fwt_prefix(struct fenwicktree *_tree_, size_t index);
+size_t fwt_query(struct fenwicktree *_tree_, size_t from, size_t to);
+size_t fwt_count(struct fenwicktree *_tree_);
+int fwt_flag(struct fenwicktree *_tree_);
+struct fenwicktree *fwt_copy_of(struct fenwicktree *_tree_);
+_Bool fwt_equals(struct fenwicktree *_tree1_, struct fenwicktree *_tree2_);
+_Bool fwt_to_string(struct fenwicktree *_tree_, FILE *fptr);
+_Bool fwt_print(struct fenwicktree *_tree_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_FENWICKTREE_TEST_H */
@@ -0,0 +1,80 @@
+
+#ifndef CMC_CMC_GAPBUFFER_TEST_H
+#define CMC_CMC_GAPBUFFER_TEST_H
+
+#include "macro_collections.h"
+
+struct gapbuffer
+{
+    size_t *buffer;
+    size_t capacity;
+    size_t count;
+    size_t gap;
+    int flag;
+    struct gapbuffer_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct gapbuffer_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct gapbuffer *gb_new(size_t capacity, struct gapbuffer_fval *f_val);
+struct gapbuffer *gb_new_custom(size_t capacity, struct gapbuffer_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks);
+void gb_clear(struct gapbuffer *_gb_);
+void gb_free(struct gapbuffer *_gb_);
+void gb_customize(struct gapbuffer *_gb_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool gb_push_front(struct gapbuffer *_gb_, size_t value);
+_Bool gb_push_at(struct gapbuffer *_gb_, size_t value, size_t index);
+_Bool gb_push_back(struct gapbuffer *_gb_, size_t value);
+_Bool gb_pop_front(struct gapbuffer *_gb_);
+_Bool gb_pop_at(struct gapbuffer *_gb_, size_t index);
+_Bool gb_pop_back(struct gapbuffer *_gb_);
+_Bool gb_move_cursor(struct gapbuffer *_gb_, size_t index);
+size_t gb_cursor(struct gapbuffer *_gb_);
+size_t gb_front(struct gapbuffer *_gb_);
+size_t gb_get(struct gapbuffer *_gb_, size_t index);
+size_t *gb_get_ref(struct gapbuffer *_gb_, size_t index);
+size_t gb_back(struct gapbuffer *_gb_);
+size_t gb_index_of(struct gapbuffer *_gb_, size_t value, _Bool from_start);
+_Bool gb_contains(struct gapbuffer *_gb_, size_t value);
+_Bool gb_empty(struct gapbuffer *_gb_);
+_Bool gb_full(struct gapbuffer *_gb_);
+size_t gb_count(struct gapbuffer *_gb_);
+_Bool gb_fits(struct gapbuffer *_gb_, size_t size);
+size_t gb_capacity(struct gapbuffer *_gb_);
+int gb_flag(struct gapbuffer *_gb_);
+_Bool gb_resize(struct gapbuffer *_gb_, size_t capacity);
+struct gapbuffer *gb_copy_of(struct gapbuffer *_gb_);
+_Bool gb_equals(struct gapbuffer *_gb1_, struct gapbuffer *_gb2_);
+struct gapbuffer_iter
+{
+    struct gapbuffer *target;
+    size_t cursor;
+    _Bool start;
+    _Bool end;
+};
+struct gapbuffer_iter gb_iter_start(struct gapbuffer *target);
+struct gapbuffer_iter gb_iter_end(struct gapbuffer *target);
+_Bool gb_iter_at_start(struct gapbuffer_iter *iter);
+_Bool gb_iter_at_end(struct gapbuffer_iter *iter);
+_Bool gb_iter_to_start(struct gapbuffer_iter *iter);
+_Bool gb_iter_to_end(struct gapbuffer_iter *iter);
+_Bool gb_iter_next(struct gapbuffer_iter *iter);
+_Bool gb_iter_prev(struct gapbuffer_iter *iter);
+_Bool gb_iter_advance(struct gapbuffer_iter *iter, size_t steps);
+_Bool gb_iter_rewind(struct gapbuffer_iter *iter, size_t steps);
+_Bool gb_iter_go_to(struct gapbuffer_iter *iter, size_t index);
+size_t gb_iter_value(struct gapbuffer_iter *iter);
+size_t *gb_iter_rvalue(struct gapbuffer_iter *iter);
+size_t gb_iter_index(struct gapbuffer_iter *iter);
+_Bool gb_to_string(struct gapbuffer *_gb_, FILE *fptr);
+_Bool gb_print(struct gapbuffer *_gb_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_GAPBUFFER_TEST_H */
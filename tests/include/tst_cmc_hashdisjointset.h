@@ -0,0 +1,81 @@
+
+#ifndef CMC_CMC_HASHDISJOINTSET_TEST_H
+#define CMC_CMC_HASHDISJOINTSET_TEST_H
+
+#include "macro_collections.h"
+
+struct hashdisjointset
+{
+    size_t *keys;
+    size_t *parent;
+    unsigned char *rank;
+    size_t *size;
+    size_t *next;
+    size_t *prev;
+    size_t *buckets;
+    size_t bucket_count;
+    size_t capacity;
+    size_t count;
+    size_t sets;
+    double load;
+    int flag;
+    struct hashdisjointset_fkey *f_key;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct hashdisjointset_fkey
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct hashdisjointset *hdjs_new(size_t capacity, double load, struct hashdisjointset_fkey *f_key);
+struct hashdisjointset *hdjs_new_custom(size_t capacity, double load, struct hashdisjointset_fkey *f_key,
+                                        struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+void hdjs_clear(struct hashdisjointset *_set_);
+void hdjs_free(struct hashdisjointset *_set_);
+void hdjs_customize(struct hashdisjointset *_set_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool hdjs_insert(struct hashdisjointset *_set_, size_t key);
+_Bool hdjs_union(struct hashdisjointset *_set_, size_t key1, size_t key2);
+_Bool hdjs_find(struct hashdisjointset *_set_, size_t key, size_t *root);
+_Bool hdjs_contains(struct hashdisjointset *_set_, size_t key);
+_Bool hdjs_connected(struct hashdisjointset *_set_, size_t key1, size_t key2);
+size_t hdjs_set_size(struct hashdisjointset *_set_, size_t key);
+size_t hdjs_set_count(struct hashdisjointset *_set_);
+_Bool hdjs_empty(struct hashdisjointset *_set_);
+size_t hdjs_count(struct hashdisjointset *_set_);
+size_t hdjs_capacity(struct hashdisjointset *_set_);
+int hdjs_flag(struct hashdisjointset *_set_);
+_Bool hdjs_resize(struct hashdisjointset *_set_, size_t capacity);
+struct hashdisjointset *hdjs_copy_of(struct hashdisjointset *_set_);
+_Bool hdjs_equals(struct hashdisjointset *_set1_, struct hashdisjointset *_set2_);
+struct hashdisjointset_iter
+{
+    struct hashdisjointset *target;
+    size_t first;
+    size_t cursor;
+    size_t index;
+    size_t count;
+    _Bool start;
+    _Bool end;
+};
+struct hashdisjointset_iter hdjs_iter_start(struct hashdisjointset *target, size_t key);
+struct hashdisjointset_iter hdjs_iter_end(struct hashdisjointset *target, size_t key);
+_Bool hdjs_iter_at_start(struct hashdisjointset_iter *iter);
+_Bool hdjs_iter_at_end(struct hashdisjointset_iter *iter);
+_Bool hdjs_iter_to_start(struct hashdisjointset_iter *iter);
+_Bool hdjs_iter_to_end(struct hashdisjointset_iter *iter);
+_Bool hdjs_iter_next(struct hashdisjointset_iter *iter);
+_Bool hdjs_iter_prev(struct hashdisjointset_iter *iter);
+_Bool hdjs_iter_advance(struct hashdisjointset_iter *iter, size_t steps);
+_Bool hdjs_iter_rewind(struct hashdisjointset_iter *iter, size_t steps);
+_Bool hdjs_iter_go_to(struct hashdisjointset_iter *iter, size_t index);
+size_t hdjs_iter_key(struct hashdisjointset_iter *iter);
+size_t hdjs_iter_index(struct hashdisjointset_iter *iter);
+_Bool hdjs_to_string(struct hashdisjointset *_set_, FILE *fptr);
+_Bool hdjs_print(struct hashdisjointset *_set_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_HASHDISJOINTSET_TEST_H */
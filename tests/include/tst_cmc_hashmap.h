@@ -10,6 +10,8 @@ struct hashmap
     size_t capacity;
     size_t count;
     double load;
+    double shrink;
+    uint16_t epoch;
     int flag;
     struct hashmap_fkey *f_key;
     struct hashmap_fval *f_val;
@@ -22,6 +24,7 @@ struct hashmap_entry
     size_t value;
     size_t dist;
     enum cmc_entry_state state;
+    uint16_t epoch;
 };
 struct hashmap_fkey
 {
@@ -48,6 +51,8 @@ void hm_clear(struct hashmap *_map_);
 void hm_free(struct hashmap *_map_);
 void hm_customize(struct hashmap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
 _Bool hm_insert(struct hashmap *_map_, size_t key, size_t value);
+_Bool hm_insert_ptr(struct hashmap *_map_, const size_t *key, const size_t *value);
+size_t *hm_emplace(struct hashmap *_map_, size_t key);
 _Bool hm_update(struct hashmap *_map_, size_t key, size_t new_value, size_t *old_value);
 _Bool hm_remove(struct hashmap *_map_, size_t key, size_t *out_value);
 _Bool hm_max(struct hashmap *_map_, size_t *key, size_t *value);
@@ -62,6 +67,8 @@ size_t hm_capacity(struct hashmap *_map_);
 double hm_load(struct hashmap *_map_);
 int hm_flag(struct hashmap *_map_);
 _Bool hm_resize(struct hashmap *_map_, size_t capacity);
+_Bool hm_shrink_to_fit(struct hashmap *_map_);
+_Bool hm_set_shrink(struct hashmap *_map_, double shrink);
 struct hashmap *hm_copy_of(struct hashmap *_map_);
 _Bool hm_equals(struct hashmap *_map1_, struct hashmap *_map2_);
 struct hashmap hm_init(size_t capacity, double load, struct hashmap_fkey *f_key, struct hashmap_fval *f_val);
@@ -10,6 +10,7 @@ struct hashmultimap
     size_t capacity;
     size_t count;
     double load;
+    double shrink;
     int flag;
     struct hashmultimap_fkey *f_key;
     struct hashmultimap_fval *f_val;
@@ -67,6 +68,8 @@ size_t hmm_capacity(struct hashmultimap *_map_);
 double hmm_load(struct hashmultimap *_map_);
 int hmm_flag(struct hashmultimap *_map_);
 _Bool hmm_resize(struct hashmultimap *_map_, size_t capacity);
+_Bool hmm_shrink_to_fit(struct hashmultimap *_map_);
+_Bool hmm_set_shrink(struct hashmultimap *_map_, double shrink);
 struct hashmultimap *hmm_copy_of(struct hashmultimap *_map_);
 _Bool hmm_equals(struct hashmultimap *_map1_, struct hashmultimap *_map2_);
 struct hashmultimap_iter
@@ -11,6 +11,7 @@ struct hashmultiset
     size_t count;
     size_t cardinality;
     double load;
+    uint16_t epoch;
     int flag;
     struct hashmultiset_fval *f_val;
     struct cmc_alloc_node *alloc;
@@ -22,6 +23,7 @@ struct hashmultiset_entry
     size_t multiplicity;
     size_t dist;
     enum cmc_entry_state state;
+    uint16_t epoch;
 };
 struct hashmultiset_fval
 {
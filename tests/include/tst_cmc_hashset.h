@@ -10,6 +10,8 @@ struct hashset
     size_t capacity;
     size_t count;
     double load;
+    double shrink;
+    uint16_t epoch;
     int flag;
     struct hashset_fval *f_val;
     struct cmc_alloc_node *alloc;
@@ -20,6 +22,7 @@ struct hashset_entry
     size_t value;
     size_t dist;
     enum cmc_entry_state state;
+    uint16_t epoch;
 };
 struct hashset_fval
 {
@@ -48,6 +51,8 @@ size_t hs_capacity(struct hashset *_set_);
 double hs_load(struct hashset *_set_);
 int hs_flag(struct hashset *_set_);
 _Bool hs_resize(struct hashset *_set_, size_t capacity);
+_Bool hs_shrink_to_fit(struct hashset *_set_);
+_Bool hs_set_shrink(struct hashset *_set_, double shrink);
 struct hashset *hs_copy_of(struct hashset *_set_);
 _Bool hs_equals(struct hashset *_set1_, struct hashset *_set2_);
 struct hashset_iter
@@ -23,6 +23,7 @@ struct heap_fval
     void (*free)(size_t);
     size_t (*hash)(size_t);
     int (*pri)(size_t, size_t);
+    size_t (*find)(size_t *, size_t, size_t);
 };
 struct heap *h_new(size_t capacity, enum cmc_heap_order HO, struct heap_fval *f_val);
 struct heap *h_new_custom(size_t capacity, enum cmc_heap_order HO, struct heap_fval *f_val,
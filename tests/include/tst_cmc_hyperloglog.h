@@ -0,0 +1,46 @@
+
+#ifndef CMC_CMC_HYPERLOGLOG_TEST_H
+#define CMC_CMC_HYPERLOGLOG_TEST_H
+
+#include "macro_collections.h"
+
+struct hyperloglog
+{
+    unsigned char *registers;
+    uint32_t *sparse;
+    size_t sparse_count;
+    size_t sparse_capacity;
+    size_t precision;
+    int flag;
+    struct hyperloglog_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct hyperloglog_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct hyperloglog *hll_new(size_t precision, struct hyperloglog_fval *f_val);
+struct hyperloglog *hll_new_custom(size_t precision, struct hyperloglog_fval *f_val, struct cmc_alloc_node *alloc,
+                                   struct cmc_callbacks *callbacks);
+void hll_clear(struct hyperloglog *_hll_);
+void hll_free(struct hyperloglog *_hll_);
+void hll_customize(struct hyperloglog *_hll_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool hll_add(struct hyperloglog *_hll_, size_t value);
+_Bool hll_add_many(struct hyperloglog *_hll_, size_t *values, size_t count);
+_Bool hll_merge(struct hyperloglog *_hll1_, struct hyperloglog *_hll2_);
+size_t hll_estimate(struct hyperloglog *_hll_);
+_Bool hll_sparse(struct hyperloglog *_hll_);
+size_t hll_precision(struct hyperloglog *_hll_);
+int hll_flag(struct hyperloglog *_hll_);
+struct hyperloglog *hll_copy_of(struct hyperloglog *_hll_);
+_Bool hll_equals(struct hyperloglog *_hll1_, struct hyperloglog *_hll2_);
+_Bool hll_to_string(struct hyperloglog *_hll_, FILE *fptr);
+_Bool hll_print(struct hyperloglog *_hll_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_HYPERLOGLOG_TEST_H */
@@ -10,6 +10,7 @@ struct intervalheap
     size_t capacity;
     size_t size;
     size_t count;
+    size_t limit;
     int flag;
     struct intervalheap_fval *f_val;
     struct cmc_alloc_node *alloc;
@@ -33,6 +34,10 @@ void ih_customize(struct intervalheap *_heap_, struct cmc_alloc_node *alloc, str
 _Bool ih_insert(struct intervalheap *_heap_, size_t value);
 _Bool ih_remove_max(struct intervalheap *_heap_);
 _Bool ih_remove_min(struct intervalheap *_heap_);
+_Bool ih_offer_max(struct intervalheap *_heap_, size_t value);
+_Bool ih_offer_min(struct intervalheap *_heap_, size_t value);
+size_t ih_offer_many_max(struct intervalheap *_heap_, size_t *values, size_t count);
+size_t ih_offer_many_min(struct intervalheap *_heap_, size_t *values, size_t count);
 _Bool ih_update_max(struct intervalheap *_heap_, size_t value);
 _Bool ih_update_min(struct intervalheap *_heap_, size_t value);
 size_t ih_max(struct intervalheap *_heap_);
@@ -42,8 +47,10 @@ _Bool ih_empty(struct intervalheap *_heap_);
 _Bool ih_full(struct intervalheap *_heap_);
 size_t ih_count(struct intervalheap *_heap_);
 size_t ih_capacity(struct intervalheap *_heap_);
+size_t ih_limit(struct intervalheap *_heap_);
 int ih_flag(struct intervalheap *_heap_);
 _Bool ih_resize(struct intervalheap *_heap_, size_t capacity);
+_Bool ih_set_limit(struct intervalheap *_heap_, size_t limit);
 struct intervalheap *ih_copy_of(struct intervalheap *_heap_);
 _Bool ih_equals(struct intervalheap *_heap1_, struct intervalheap *_heap2_);
 struct intervalheap_iter
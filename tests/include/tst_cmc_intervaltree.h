@@ -0,0 +1,95 @@
+
+#ifndef CMC_CMC_INTERVALTREE_TEST_H
+#define CMC_CMC_INTERVALTREE_TEST_H
+
+#include "macro_collections.h"
+
+struct intervaltree
+{
+    struct intervaltree_node *root;
+    size_t count;
+    int flag;
+    struct intervaltree_fkey *f_key;
+    struct intervaltree_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct intervaltree_node
+{
+    size_t low;
+    size_t high;
+    size_t max;
+    size_t value;
+    unsigned char height;
+    struct intervaltree_node *right;
+    struct intervaltree_node *left;
+    struct intervaltree_node *parent;
+};
+struct intervaltree_fkey
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct intervaltree_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct intervaltree *itv_new(struct intervaltree_fkey *f_key, struct intervaltree_fval *f_val);
+struct intervaltree *itv_new_custom(struct intervaltree_fkey *f_key, struct intervaltree_fval *f_val,
+                                    struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+void itv_clear(struct intervaltree *_tree_);
+void itv_free(struct intervaltree *_tree_);
+void itv_customize(struct intervaltree *_tree_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool itv_insert(struct intervaltree *_tree_, size_t low, size_t high, size_t value);
+_Bool itv_update(struct intervaltree *_tree_, size_t low, size_t high, size_t new_value, size_t *old_value);
+_Bool itv_remove(struct intervaltree *_tree_, size_t low, size_t high, size_t *out_value);
+size_t itv_get(struct intervaltree *_tree_, size_t low, size_t high);
+size_t *itv_get_ref(struct intervaltree *_tree_, size_t low, size_t high);
+size_t itv_overlaps(struct intervaltree *_tree_, size_t low, size_t high, void (*match)(size_t, size_t, size_t));
+size_t itv_stab(struct intervaltree *_tree_, size_t point, void (*match)(size_t, size_t, size_t));
+_Bool itv_contains(struct intervaltree *_tree_, size_t low, size_t high);
+_Bool itv_empty(struct intervaltree *_tree_);
+size_t itv_count(struct intervaltree *_tree_);
+int itv_flag(struct intervaltree *_tree_);
+struct intervaltree *itv_copy_of(struct intervaltree *_tree_);
+_Bool itv_equals(struct intervaltree *_tree1_, struct intervaltree *_tree2_);
+struct intervaltree_iter
+{
+    struct intervaltree *target;
+    struct intervaltree_node *cursor;
+    struct intervaltree_node *first;
+    struct intervaltree_node *last;
+    size_t index;
+    _Bool start;
+    _Bool end;
+};
+struct intervaltree_iter itv_iter_start(struct intervaltree *target);
+struct intervaltree_iter itv_iter_end(struct intervaltree *target);
+_Bool itv_iter_at_start(struct intervaltree_iter *iter);
+_Bool itv_iter_at_end(struct intervaltree_iter *iter);
+_Bool itv_iter_to_start(struct intervaltree_iter *iter);
+_Bool itv_iter_to_end(struct intervaltree_iter *iter);
+_Bool itv_iter_next(struct intervaltree_iter *iter);
+_Bool itv_iter_prev(struct intervaltree_iter *iter);
+_Bool itv_iter_advance(struct intervaltree_iter *iter, size_t steps);
+_Bool itv_iter_rewind(struct intervaltree_iter *iter, size_t steps);
+_Bool itv_iter_go_to(struct intervaltree_iter *iter, size_t index);
+size_t itv_iter_low(struct intervaltree_iter *iter);
+size_t itv_iter_high(struct intervaltree_iter *iter);
+size_t itv_iter_value(struct intervaltree_iter *iter);
+size_t *itv_iter_rvalue(struct intervaltree_iter *iter);
+size_t itv_iter_index(struct intervaltree_iter *iter);
+_Bool itv_to_string(struct intervaltree *_tree_, FILE *fptr);
+_Bool itv_print(struct intervaltree *_tree_, FILE *fptr, const char *start, const char *separator, const char *end,
+                const char *key_val_sep);
+
+#endif /* CMC_CMC_INTERVALTREE_TEST_H */
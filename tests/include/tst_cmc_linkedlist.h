@@ -49,6 +49,7 @@ _Bool ll_contains(struct linkedlist *_list_, size_t value);
 _Bool ll_empty(struct linkedlist *_list_);
 size_t ll_count(struct linkedlist *_list_);
 int ll_flag(struct linkedlist *_list_);
+void ll_sort(struct linkedlist *_list_);
 struct linkedlist *ll_copy_of(struct linkedlist *_list_);
 _Bool ll_equals(struct linkedlist *_list1_, struct linkedlist *_list2_);
 struct linkedlist_iter
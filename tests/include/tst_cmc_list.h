@@ -13,6 +13,7 @@ struct list
     struct list_fval *f_val;
     struct cmc_alloc_node *alloc;
     struct cmc_callbacks *callbacks;
+    size_t inline_buffer[];
 };
 struct list_fval
 {
@@ -22,6 +23,7 @@ struct list_fval
     void (*free)(size_t);
     size_t (*hash)(size_t);
     int (*pri)(size_t, size_t);
+    size_t (*find)(size_t *, size_t, size_t);
 };
 struct list *l_new(size_t capacity, struct list_fval *f_val);
 struct list *l_new_custom(size_t capacity, struct list_fval *f_val, struct cmc_alloc_node *alloc,
@@ -47,6 +49,8 @@ size_t l_count(struct list *_list_);
 _Bool l_fits(struct list *_list_, size_t size);
 size_t l_capacity(struct list *_list_);
 int l_flag(struct list *_list_);
+void l_sort(struct list *_list_);
+_Bool l_stable_sort(struct list *_list_);
 _Bool l_resize(struct list *_list_, size_t capacity);
 struct list *l_copy_of(struct list *_list_);
 _Bool l_equals(struct list *_list1_, struct list *_list2_);
@@ -0,0 +1,93 @@
+
+#ifndef CMC_CMC_PHASHMAP_TEST_H
+#define CMC_CMC_PHASHMAP_TEST_H
+
+#include "macro_collections.h"
+
+struct phashmap
+{
+    struct phashmap_node *root;
+    size_t count;
+    int flag;
+    struct phashmap_fkey *f_key;
+    struct phashmap_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct phashmap_entry
+{
+    size_t key;
+    size_t value;
+    size_t hash;
+};
+struct phashmap_node
+{
+    size_t refcount;
+    size_t length;
+    uint32_t datamap;
+    uint32_t nodemap;
+    struct phashmap_entry *entries;
+    struct phashmap_node **children;
+};
+struct phashmap_fkey
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct phashmap_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct phashmap *phm_new(struct phashmap_fkey *f_key, struct phashmap_fval *f_val);
+struct phashmap *phm_new_custom(struct phashmap_fkey *f_key, struct phashmap_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks);
+void phm_free(struct phashmap *_map_);
+void phm_customize(struct phashmap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+struct phashmap *phm_insert(struct phashmap *_map_, size_t key, size_t value);
+struct phashmap *phm_update(struct phashmap *_map_, size_t key, size_t new_value, size_t *old_value);
+struct phashmap *phm_remove(struct phashmap *_map_, size_t key, size_t *out_value);
+size_t phm_get(struct phashmap *_map_, size_t key);
+_Bool phm_contains(struct phashmap *_map_, size_t key);
+_Bool phm_empty(struct phashmap *_map_);
+size_t phm_count(struct phashmap *_map_);
+int phm_flag(struct phashmap *_map_);
+struct phashmap *phm_copy_of(struct phashmap *_map_);
+_Bool phm_equals(struct phashmap *_map1_, struct phashmap *_map2_);
+struct phashmap_iter
+{
+    struct phashmap *target;
+    struct phashmap_node *path[((sizeof(size_t) * 8 + 4) / 5 + 1)];
+    size_t slots[((sizeof(size_t) * 8 + 4) / 5 + 1)];
+    size_t depth;
+    size_t index;
+    _Bool start;
+    _Bool end;
+};
+struct phashmap_iter phm_iter_start(struct phashmap *target);
+struct phashmap_iter phm_iter_end(struct phashmap *target);
+_Bool phm_iter_at_start(struct phashmap_iter *iter);
+_Bool phm_iter_at_end(struct phashmap_iter *iter);
+_Bool phm_iter_to_start(struct phashmap_iter *iter);
+_Bool phm_iter_to_end(struct phashmap_iter *iter);
+_Bool phm_iter_next(struct phashmap_iter *iter);
+_Bool phm_iter_prev(struct phashmap_iter *iter);
+_Bool phm_iter_advance(struct phashmap_iter *iter, size_t steps);
+_Bool phm_iter_rewind(struct phashmap_iter *iter, size_t steps);
+_Bool phm_iter_go_to(struct phashmap_iter *iter, size_t index);
+size_t phm_iter_key(struct phashmap_iter *iter);
+size_t phm_iter_value(struct phashmap_iter *iter);
+size_t phm_iter_index(struct phashmap_iter *iter);
+_Bool phm_to_string(struct phashmap *_map_, FILE *fptr);
+_Bool phm_print(struct phashmap *_map_, FILE *fptr, const char *start, const char *separator, const char *end,
+                const char *key_val_sep);
+
+#endif /* CMC_CMC_PHASHMAP_TEST_H */
@@ -0,0 +1,88 @@
+
+#ifndef CMC_CMC_PTREEMAP_TEST_H
+#define CMC_CMC_PTREEMAP_TEST_H
+
+#include "macro_collections.h"
+
+struct ptreemap
+{
+    struct ptreemap_node *root;
+    size_t count;
+    int flag;
+    struct ptreemap_fkey *f_key;
+    struct ptreemap_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct ptreemap_node
+{
+    size_t key;
+    size_t value;
+    size_t refcount;
+    unsigned char height;
+    struct ptreemap_node *right;
+    struct ptreemap_node *left;
+};
+struct ptreemap_fkey
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct ptreemap_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct ptreemap *ptm_new(struct ptreemap_fkey *f_key, struct ptreemap_fval *f_val);
+struct ptreemap *ptm_new_custom(struct ptreemap_fkey *f_key, struct ptreemap_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks);
+void ptm_free(struct ptreemap *_map_);
+void ptm_customize(struct ptreemap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+struct ptreemap *ptm_insert(struct ptreemap *_map_, size_t key, size_t value);
+struct ptreemap *ptm_update(struct ptreemap *_map_, size_t key, size_t new_value, size_t *old_value);
+struct ptreemap *ptm_remove(struct ptreemap *_map_, size_t key, size_t *out_value);
+_Bool ptm_max(struct ptreemap *_map_, size_t *key, size_t *value);
+_Bool ptm_min(struct ptreemap *_map_, size_t *key, size_t *value);
+size_t ptm_get(struct ptreemap *_map_, size_t key);
+_Bool ptm_contains(struct ptreemap *_map_, size_t key);
+_Bool ptm_empty(struct ptreemap *_map_);
+size_t ptm_count(struct ptreemap *_map_);
+int ptm_flag(struct ptreemap *_map_);
+struct ptreemap *ptm_copy_of(struct ptreemap *_map_);
+_Bool ptm_equals(struct ptreemap *_map1_, struct ptreemap *_map2_);
+struct ptreemap_iter
+{
+    struct ptreemap *target;
+    struct ptreemap_node *path[(sizeof(size_t) * 8 * 3 / 2)];
+    size_t depth;
+    size_t index;
+    _Bool start;
+    _Bool end;
+};
+struct ptreemap_iter ptm_iter_start(struct ptreemap *target);
+struct ptreemap_iter ptm_iter_end(struct ptreemap *target);
+_Bool ptm_iter_at_start(struct ptreemap_iter *iter);
+_Bool ptm_iter_at_end(struct ptreemap_iter *iter);
+_Bool ptm_iter_to_start(struct ptreemap_iter *iter);
+_Bool ptm_iter_to_end(struct ptreemap_iter *iter);
+_Bool ptm_iter_next(struct ptreemap_iter *iter);
+_Bool ptm_iter_prev(struct ptreemap_iter *iter);
+_Bool ptm_iter_advance(struct ptreemap_iter *iter, size_t steps);
+_Bool ptm_iter_rewind(struct ptreemap_iter *iter, size_t steps);
+_Bool ptm_iter_go_to(struct ptreemap_iter *iter, size_t index);
+size_t ptm_iter_key(struct ptreemap_iter *iter);
+size_t ptm_iter_value(struct ptreemap_iter *iter);
+size_t ptm_iter_index(struct ptreemap_iter *iter);
+_Bool ptm_to_string(struct ptreemap *_map_, FILE *fptr);
+_Bool ptm_print(struct ptreemap *_map_, FILE *fptr, const char *start, const char *separator, const char *end,
+                const char *key_val_sep);
+
+#endif /* CMC_CMC_PTREEMAP_TEST_H */
@@ -11,6 +11,8 @@ struct queue
     size_t count;
     size_t front;
     size_t back;
+    _Bool overwrite;
+    void (*evict)(size_t);
     int flag;
     struct queue_fval *f_val;
     struct cmc_alloc_node *alloc;
@@ -24,6 +26,7 @@ struct queue_fval
     void (*free)(size_t);
     size_t (*hash)(size_t);
     int (*pri)(size_t, size_t);
+    size_t (*find)(size_t *, size_t, size_t);
 };
 struct queue *q_new(size_t capacity, struct queue_fval *f_val);
 struct queue *q_new_custom(size_t capacity, struct queue_fval *f_val, struct cmc_alloc_node *alloc,
@@ -33,6 +36,7 @@ void q_free(struct queue *_queue_);
 void q_customize(struct queue *_queue_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
 _Bool q_enqueue(struct queue *_queue_, size_t value);
 _Bool q_dequeue(struct queue *_queue_);
+_Bool q_enqueue_many(struct queue *_queue_, size_t *values, size_t count);
 size_t q_peek(struct queue *_queue_);
 _Bool q_contains(struct queue *_queue_, size_t value);
 _Bool q_empty(struct queue *_queue_);
@@ -41,6 +45,7 @@ size_t q_count(struct queue *_queue_);
 size_t q_capacity(struct queue *_queue_);
 int q_flag(struct queue *_queue_);
 _Bool q_resize(struct queue *_queue_, size_t capacity);
+void q_set_overwrite(struct queue *_queue_, _Bool overwrite, void (*evict)(size_t));
 struct queue *q_copy_of(struct queue *_queue_);
 _Bool q_equals(struct queue *_queue1_, struct queue *_queue2_);
 struct queue_iter
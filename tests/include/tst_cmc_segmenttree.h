@@ -0,0 +1,46 @@
+
+#ifndef CMC_CMC_SEGMENTTREE_TEST_H
+#define CMC_CMC_SEGMENTTREE_TEST_H
+
+#include "macro_collections.h"
+
+struct segmenttree
+{
+    size_t *tree;
+    size_t *lazy;
+    _Bool *pending;
+    size_t nodes;
+    size_t count;
+    int flag;
+    struct segmenttree_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct segmenttree_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+    size_t (*combine)(size_t, size_t);
+    size_t (*apply)(size_t, size_t, size_t);
+};
+struct segmenttree *sgt_new(size_t *values, size_t count, struct segmenttree_fval *f_val);
+struct segmenttree *sgt_new_custom(size_t *values, size_t count, struct segmenttree_fval *f_val,
+                                   struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+void sgt_free(struct segmenttree *_tree_);
+void sgt_customize(struct segmenttree *_tree_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool sgt_set(struct segmenttree *_tree_, size_t index, size_t value);
+_Bool sgt_update(struct segmenttree *_tree_, size_t from, size_t to, size_t update);
+size_t sgt_get(struct segmenttree *_tree_, size_t index);
+size_t sgt_query(struct segmenttree *_tree_, size_t from, size_t to);
+size_t sgt_count(struct segmenttree *_tree_);
+int sgt_flag(struct segmenttree *_tree_);
+struct segmenttree *sgt_copy_of(struct segmenttree *_tree_);
+_Bool sgt_equals(struct segmenttree *_tree1_, struct segmenttree *_tree2_);
+_Bool sgt_to_string(struct segmenttree *_tree_, FILE *fptr);
+_Bool sgt_print(struct segmenttree *_tree_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_SEGMENTTREE_TEST_H */
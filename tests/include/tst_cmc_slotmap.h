@@ -0,0 +1,81 @@
+
+#ifndef CMC_CMC_SLOTMAP_TEST_H
+#define CMC_CMC_SLOTMAP_TEST_H
+
+#include "macro_collections.h"
+
+struct slotmap
+{
+    size_t *buffer;
+    uint32_t *owner;
+    struct slotmap_entry *slots;
+    size_t capacity;
+    size_t count;
+    size_t used;
+    uint32_t free;
+    int flag;
+    struct slotmap_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct slotmap_entry
+{
+    uint32_t index;
+    uint32_t generation;
+};
+struct slotmap_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct slotmap *sm_new(size_t capacity, struct slotmap_fval *f_val);
+struct slotmap *sm_new_custom(size_t capacity, struct slotmap_fval *f_val, struct cmc_alloc_node *alloc,
+                              struct cmc_callbacks *callbacks);
+void sm_clear(struct slotmap *_map_);
+void sm_free(struct slotmap *_map_);
+void sm_customize(struct slotmap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool sm_insert(struct slotmap *_map_, size_t value, uint64_t *handle);
+_Bool sm_update(struct slotmap *_map_, uint64_t handle, size_t new_value, size_t *old_value);
+_Bool sm_remove(struct slotmap *_map_, uint64_t handle, size_t *out_value);
+size_t sm_get(struct slotmap *_map_, uint64_t handle);
+size_t *sm_get_ref(struct slotmap *_map_, uint64_t handle);
+uint64_t sm_handle_at(struct slotmap *_map_, size_t index);
+_Bool sm_contains(struct slotmap *_map_, uint64_t handle);
+_Bool sm_empty(struct slotmap *_map_);
+_Bool sm_full(struct slotmap *_map_);
+size_t sm_count(struct slotmap *_map_);
+size_t sm_capacity(struct slotmap *_map_);
+int sm_flag(struct slotmap *_map_);
+_Bool sm_resize(struct slotmap *_map_, size_t capacity);
+struct slotmap *sm_copy_of(struct slotmap *_map_);
+_Bool sm_equals(struct slotmap *_map1_, struct slotmap *_map2_);
+struct slotmap_iter
+{
+    struct slotmap *target;
+    size_t cursor;
+    _Bool start;
+    _Bool end;
+};
+struct slotmap_iter sm_iter_start(struct slotmap *target);
+struct slotmap_iter sm_iter_end(struct slotmap *target);
+_Bool sm_iter_at_start(struct slotmap_iter *iter);
+_Bool sm_iter_at_end(struct slotmap_iter *iter);
+_Bool sm_iter_to_start(struct slotmap_iter *iter);
+_Bool sm_iter_to_end(struct slotmap_iter *iter);
+_Bool sm_iter_next(struct slotmap_iter *iter);
+_Bool sm_iter_prev(struct slotmap_iter *iter);
+_Bool sm_iter_advance(struct slotmap_iter *iter, size_t steps);
+_Bool sm_iter_rewind(struct slotmap_iter *iter, size_t steps);
+_Bool sm_iter_go_to(struct slotmap_iter *iter, size_t index);
+size_t sm_iter_value(struct slotmap_iter *iter);
+size_t *sm_iter_rvalue(struct slotmap_iter *iter);
+uint64_t sm_iter_handle(struct slotmap_iter *iter);
+size_t sm_iter_index(struct slotmap_iter *iter);
+_Bool sm_to_string(struct slotmap *_map_, FILE *fptr);
+_Bool sm_print(struct slotmap *_map_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_SLOTMAP_TEST_H */
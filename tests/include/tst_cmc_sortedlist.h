@@ -32,6 +32,8 @@ void sl_free(struct sortedlist *_list_);
 void sl_customize(struct sortedlist *_list_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
 _Bool sl_insert(struct sortedlist *_list_, size_t value);
 _Bool sl_remove(struct sortedlist *_list_, size_t index);
+size_t sl_remove_range(struct sortedlist *_list_, size_t low, size_t high);
+size_t sl_remove_below(struct sortedlist *_list_, size_t value);
 size_t sl_max(struct sortedlist *_list_);
 size_t sl_min(struct sortedlist *_list_);
 size_t sl_get(struct sortedlist *_list_, size_t index);
@@ -0,0 +1,94 @@
+
+#ifndef CMC_CMC_SORTEDMAP_TEST_H
+#define CMC_CMC_SORTEDMAP_TEST_H
+
+#include "macro_collections.h"
+
+struct sortedmap
+{
+    size_t *keys;
+    size_t *values;
+    size_t capacity;
+    size_t count;
+    size_t pending;
+    int flag;
+    struct sortedmap_fkey *f_key;
+    struct sortedmap_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct sortedmap_fkey
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct sortedmap_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct sortedmap *smp_new(size_t capacity, struct sortedmap_fkey *f_key, struct sortedmap_fval *f_val);
+struct sortedmap *smp_new_custom(size_t capacity, struct sortedmap_fkey *f_key, struct sortedmap_fval *f_val,
+                                 struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+struct sortedmap *smp_from_pairs(size_t *keys, size_t *values, size_t count, struct sortedmap_fkey *f_key,
+                                 struct sortedmap_fval *f_val);
+void smp_clear(struct sortedmap *_map_);
+void smp_free(struct sortedmap *_map_);
+void smp_customize(struct sortedmap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool smp_insert(struct sortedmap *_map_, size_t key, size_t value);
+_Bool smp_push(struct sortedmap *_map_, size_t key, size_t value);
+_Bool smp_update(struct sortedmap *_map_, size_t key, size_t new_value, size_t *old_value);
+_Bool smp_remove(struct sortedmap *_map_, size_t key, size_t *out_value);
+_Bool smp_max(struct sortedmap *_map_, size_t *key, size_t *value);
+_Bool smp_min(struct sortedmap *_map_, size_t *key, size_t *value);
+size_t smp_get(struct sortedmap *_map_, size_t key);
+size_t *smp_get_ref(struct sortedmap *_map_, size_t key);
+_Bool smp_lower_bound(struct sortedmap *_map_, size_t key, size_t *out_key, size_t *out_value);
+_Bool smp_contains(struct sortedmap *_map_, size_t key);
+_Bool smp_empty(struct sortedmap *_map_);
+_Bool smp_full(struct sortedmap *_map_);
+size_t smp_count(struct sortedmap *_map_);
+size_t smp_capacity(struct sortedmap *_map_);
+int smp_flag(struct sortedmap *_map_);
+_Bool smp_merge(struct sortedmap *_map_);
+_Bool smp_resize(struct sortedmap *_map_, size_t capacity);
+struct sortedmap *smp_copy_of(struct sortedmap *_map_);
+_Bool smp_equals(struct sortedmap *_map1_, struct sortedmap *_map2_);
+struct sortedmap_iter
+{
+    struct sortedmap *target;
+    size_t cursor;
+    size_t first;
+    size_t count;
+    _Bool start;
+    _Bool end;
+};
+struct sortedmap_iter smp_iter_start(struct sortedmap *target);
+struct sortedmap_iter smp_iter_end(struct sortedmap *target);
+struct sortedmap_iter smp_iter_range(struct sortedmap *target, size_t from, size_t to);
+_Bool smp_iter_at_start(struct sortedmap_iter *iter);
+_Bool smp_iter_at_end(struct sortedmap_iter *iter);
+_Bool smp_iter_to_start(struct sortedmap_iter *iter);
+_Bool smp_iter_to_end(struct sortedmap_iter *iter);
+_Bool smp_iter_next(struct sortedmap_iter *iter);
+_Bool smp_iter_prev(struct sortedmap_iter *iter);
+_Bool smp_iter_advance(struct sortedmap_iter *iter, size_t steps);
+_Bool smp_iter_rewind(struct sortedmap_iter *iter, size_t steps);
+_Bool smp_iter_go_to(struct sortedmap_iter *iter, size_t index);
+size_t smp_iter_key(struct sortedmap_iter *iter);
+size_t smp_iter_value(struct sortedmap_iter *iter);
+size_t *smp_iter_rvalue(struct sortedmap_iter *iter);
+size_t smp_iter_index(struct sortedmap_iter *iter);
+_Bool smp_to_string(struct sortedmap *_map_, FILE *fptr);
+_Bool smp_print(struct sortedmap *_map_, FILE *fptr, const char *start, const char *separator, const char *end,
+                const char *key_val_sep);
+
+#endif /* CMC_CMC_SORTEDMAP_TEST_H */
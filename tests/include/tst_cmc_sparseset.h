@@ -0,0 +1,78 @@
+
+#ifndef CMC_CMC_SPARSESET_TEST_H
+#define CMC_CMC_SPARSESET_TEST_H
+
+#include "macro_collections.h"
+
+struct sparseset
+{
+    size_t *dense;
+    size_t *sparse;
+    size_t capacity;
+    size_t count;
+    int flag;
+    struct sparseset_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct sparseset_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct sparseset *ss_new(size_t capacity, struct sparseset_fval *f_val);
+struct sparseset *ss_new_custom(size_t capacity, struct sparseset_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks);
+void ss_clear(struct sparseset *_set_);
+void ss_free(struct sparseset *_set_);
+void ss_customize(struct sparseset *_set_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool ss_insert(struct sparseset *_set_, size_t value);
+_Bool ss_remove(struct sparseset *_set_, size_t value);
+_Bool ss_max(struct sparseset *_set_, size_t *value);
+_Bool ss_min(struct sparseset *_set_, size_t *value);
+_Bool ss_contains(struct sparseset *_set_, size_t value);
+_Bool ss_empty(struct sparseset *_set_);
+_Bool ss_full(struct sparseset *_set_);
+size_t ss_count(struct sparseset *_set_);
+size_t ss_capacity(struct sparseset *_set_);
+int ss_flag(struct sparseset *_set_);
+_Bool ss_resize(struct sparseset *_set_, size_t capacity);
+struct sparseset *ss_copy_of(struct sparseset *_set_);
+_Bool ss_equals(struct sparseset *_set1_, struct sparseset *_set2_);
+struct sparseset_iter
+{
+    struct sparseset *target;
+    size_t cursor;
+    _Bool start;
+    _Bool end;
+};
+struct sparseset_iter ss_iter_start(struct sparseset *target);
+struct sparseset_iter ss_iter_end(struct sparseset *target);
+_Bool ss_iter_at_start(struct sparseset_iter *iter);
+_Bool ss_iter_at_end(struct sparseset_iter *iter);
+_Bool ss_iter_to_start(struct sparseset_iter *iter);
+_Bool ss_iter_to_end(struct sparseset_iter *iter);
+_Bool ss_iter_next(struct sparseset_iter *iter);
+_Bool ss_iter_prev(struct sparseset_iter *iter);
+_Bool ss_iter_advance(struct sparseset_iter *iter, size_t steps);
+_Bool ss_iter_rewind(struct sparseset_iter *iter, size_t steps);
+_Bool ss_iter_go_to(struct sparseset_iter *iter, size_t index);
+size_t ss_iter_value(struct sparseset_iter *iter);
+size_t ss_iter_index(struct sparseset_iter *iter);
+struct sparseset *ss_union(struct sparseset *_set1_, struct sparseset *_set2_);
+struct sparseset *ss_intersection(struct sparseset *_set1_, struct sparseset *_set2_);
+struct sparseset *ss_difference(struct sparseset *_set1_, struct sparseset *_set2_);
+struct sparseset *ss_symmetric_difference(struct sparseset *_set1_, struct sparseset *_set2_);
+_Bool ss_is_subset(struct sparseset *_set1_, struct sparseset *_set2_);
+_Bool ss_is_superset(struct sparseset *_set1_, struct sparseset *_set2_);
+_Bool ss_is_proper_subset(struct sparseset *_set1_, struct sparseset *_set2_);
+_Bool ss_is_proper_superset(struct sparseset *_set1_, struct sparseset *_set2_);
+_Bool ss_is_disjointset(struct sparseset *_set1_, struct sparseset *_set2_);
+_Bool ss_to_string(struct sparseset *_set_, FILE *fptr);
+_Bool ss_print(struct sparseset *_set_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_SPARSESET_TEST_H */
@@ -13,6 +13,7 @@ struct stack
     struct stack_fval *f_val;
     struct cmc_alloc_node *alloc;
     struct cmc_callbacks *callbacks;
+    size_t inline_buffer[];
 };
 struct stack_fval
 {
@@ -22,6 +23,7 @@ struct stack_fval
     void (*free)(size_t);
     size_t (*hash)(size_t);
     int (*pri)(size_t, size_t);
+    size_t (*find)(size_t *, size_t, size_t);
 };
 struct stack *s_new(size_t capacity, struct stack_fval *f_val);
 struct stack *s_new_custom(size_t capacity, struct stack_fval *f_val, struct cmc_alloc_node *alloc,
@@ -0,0 +1,65 @@
+
+#ifndef CMC_CMC_TIMERWHEEL_TEST_H
+#define CMC_CMC_TIMERWHEEL_TEST_H
+
+#include "macro_collections.h"
+
+struct timerwheel
+{
+    struct timerwheel_entry *timers;
+    size_t capacity;
+    size_t count;
+    size_t used;
+    uint32_t free;
+    uint64_t now;
+    uint32_t lists[((11 * (1 << 6)) + 1) + 1];
+    uint64_t occupied[11];
+    int flag;
+    struct timerwheel_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct timerwheel_entry
+{
+    size_t value;
+    uint64_t deadline;
+    uint32_t next;
+    uint32_t prev;
+    uint32_t generation;
+    uint16_t list;
+};
+struct timerwheel_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct timerwheel *tmw_new(size_t capacity, uint64_t now, struct timerwheel_fval *f_val);
+struct timerwheel *tmw_new_custom(size_t capacity, uint64_t now, struct timerwheel_fval *f_val,
+                                  struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+void tmw_clear(struct timerwheel *_wheel_);
+void tmw_free(struct timerwheel *_wheel_);
+void tmw_customize(struct timerwheel *_wheel_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool tmw_schedule(struct timerwheel *_wheel_, uint64_t deadline, size_t value, uint64_t *handle);
+_Bool tmw_cancel(struct timerwheel *_wheel_, uint64_t handle, size_t *out_value);
+_Bool tmw_reschedule(struct timerwheel *_wheel_, uint64_t handle, uint64_t deadline);
+size_t tmw_advance(struct timerwheel *_wheel_, uint64_t now, void (*expire)(size_t, uint64_t));
+size_t tmw_get(struct timerwheel *_wheel_, uint64_t handle);
+uint64_t tmw_deadline(struct timerwheel *_wheel_, uint64_t handle);
+_Bool tmw_next_tick(struct timerwheel *_wheel_, uint64_t *tick);
+_Bool tmw_contains(struct timerwheel *_wheel_, uint64_t handle);
+_Bool tmw_empty(struct timerwheel *_wheel_);
+size_t tmw_count(struct timerwheel *_wheel_);
+size_t tmw_capacity(struct timerwheel *_wheel_);
+uint64_t tmw_now(struct timerwheel *_wheel_);
+int tmw_flag(struct timerwheel *_wheel_);
+_Bool tmw_resize(struct timerwheel *_wheel_, size_t capacity);
+struct timerwheel *tmw_copy_of(struct timerwheel *_wheel_);
+_Bool tmw_equals(struct timerwheel *_wheel1_, struct timerwheel *_wheel2_);
+_Bool tmw_to_string(struct timerwheel *_wheel_, FILE *fptr);
+_Bool tmw_print(struct timerwheel *_wheel_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_CMC_TIMERWHEEL_TEST_H */
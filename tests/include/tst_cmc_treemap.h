@@ -50,6 +50,8 @@ void tm_customize(struct treemap *_map_, struct cmc_alloc_node *alloc, struct cm
 _Bool tm_insert(struct treemap *_map_, size_t key, size_t value);
 _Bool tm_update(struct treemap *_map_, size_t key, size_t new_value, size_t *old_value);
 _Bool tm_remove(struct treemap *_map_, size_t key, size_t *out_value);
+size_t tm_remove_range(struct treemap *_map_, size_t low, size_t high);
+size_t tm_remove_below(struct treemap *_map_, size_t key);
 _Bool tm_max(struct treemap *_map_, size_t *key, size_t *value);
 _Bool tm_min(struct treemap *_map_, size_t *key, size_t *value);
 size_t tm_get(struct treemap *_map_, size_t key);
@@ -85,6 +87,7 @@ size_t tm_iter_key(struct treemap_iter *iter);
 size_t tm_iter_value(struct treemap_iter *iter);
 size_t *tm_iter_rvalue(struct treemap_iter *iter);
 size_t tm_iter_index(struct treemap_iter *iter);
+_Bool tm_insert_hint(struct treemap *_map_, struct treemap_iter *hint, size_t key, size_t value);
 _Bool tm_to_string(struct treemap *_map_, FILE *fptr);
 _Bool tm_print(struct treemap *_map_, FILE *fptr, const char *start, const char *separator, const char *end,
                const char *key_val_sep);
@@ -38,6 +38,8 @@ void ts_free(struct treeset *_set_);
 void ts_customize(struct treeset *_set_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
 _Bool ts_insert(struct treeset *_set_, size_t value);
 _Bool ts_remove(struct treeset *_set_, size_t value);
+size_t ts_remove_range(struct treeset *_set_, size_t low, size_t high);
+size_t ts_remove_below(struct treeset *_set_, size_t value);
 _Bool ts_max(struct treeset *_set_, size_t *value);
 _Bool ts_min(struct treeset *_set_, size_t *value);
 _Bool ts_contains(struct treeset *_set_, size_t value);
@@ -69,6 +71,7 @@ _Bool ts_iter_rewind(struct treeset_iter *iter, size_t steps);
 _Bool ts_iter_go_to(struct treeset_iter *iter, size_t index);
 size_t ts_iter_value(struct treeset_iter *iter);
 size_t ts_iter_index(struct treeset_iter *iter);
+_Bool ts_insert_hint(struct treeset *_set_, struct treeset_iter *hint, size_t value);
 struct treeset *ts_union(struct treeset *_set1_, struct treeset *_set2_);
 struct treeset *ts_intersection(struct treeset *_set1_, struct treeset *_set2_);
 struct treeset *ts_difference(struct treeset *_set1_, struct treeset *_set2_);
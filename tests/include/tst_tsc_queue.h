@@ -0,0 +1,56 @@
+
+#ifndef CMC_TSC_QUEUE_TEST_H
+#define CMC_TSC_QUEUE_TEST_H
+
+#include "macro_collections.h"
+
+struct tsc_queue
+{
+    size_t *buffer;
+    size_t capacity;
+    size_t count;
+    size_t front;
+    size_t back;
+    size_t consumers;
+    size_t producers;
+    struct cmc_mutex mutex;
+    struct cmc_condvar not_empty;
+    struct cmc_condvar not_full;
+    int flag;
+    struct tsc_queue_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct tsc_queue_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct tsc_queue *tq_new(size_t capacity, struct tsc_queue_fval *f_val);
+struct tsc_queue *tq_new_custom(size_t capacity, struct tsc_queue_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks);
+_Bool tq_clear(struct tsc_queue *_queue_);
+void tq_free(struct tsc_queue *_queue_);
+void tq_customize(struct tsc_queue *_queue_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool tq_enqueue(struct tsc_queue *_queue_, size_t value);
+_Bool tq_enqueue_wait(struct tsc_queue *_queue_, size_t value);
+_Bool tq_enqueue_timed(struct tsc_queue *_queue_, size_t value, size_t timeout);
+_Bool tq_dequeue(struct tsc_queue *_queue_, size_t *value);
+_Bool tq_dequeue_wait(struct tsc_queue *_queue_, size_t *value);
+_Bool tq_dequeue_timed(struct tsc_queue *_queue_, size_t *value, size_t timeout);
+size_t tq_dequeue_many(struct tsc_queue *_queue_, size_t *values, size_t max);
+size_t tq_dequeue_wait_many(struct tsc_queue *_queue_, size_t *values, size_t max);
+size_t tq_dequeue_timed_many(struct tsc_queue *_queue_, size_t *values, size_t max, size_t timeout);
+_Bool tq_empty(struct tsc_queue *_queue_);
+_Bool tq_full(struct tsc_queue *_queue_);
+size_t tq_count(struct tsc_queue *_queue_);
+size_t tq_capacity(struct tsc_queue *_queue_);
+int tq_flag(struct tsc_queue *_queue_);
+_Bool tq_to_string(struct tsc_queue *_queue_, FILE *fptr);
+_Bool tq_print(struct tsc_queue *_queue_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_TSC_QUEUE_TEST_H */
@@ -0,0 +1,53 @@
+
+#ifndef CMC_TSC_STACK_TEST_H
+#define CMC_TSC_STACK_TEST_H
+
+#include "macro_collections.h"
+
+struct tsc_stack
+{
+    struct tsc_stack_node *buffer;
+    size_t capacity;
+    _Atomic(size_t) count;
+    _Atomic(uint64_t) head;
+    _Atomic(uint64_t) free;
+    _Atomic(int) flag;
+    struct tsc_stack_fval *f_val;
+    struct cmc_alloc_node *alloc;
+    struct cmc_callbacks *callbacks;
+};
+struct tsc_stack_node
+{
+    size_t value;
+    _Atomic(uint32_t) next;
+};
+struct tsc_stack_fval
+{
+    int (*cmp)(size_t, size_t);
+    size_t (*cpy)(size_t);
+    _Bool (*str)(FILE *, size_t);
+    void (*free)(size_t);
+    size_t (*hash)(size_t);
+    int (*pri)(size_t, size_t);
+};
+struct tsc_stack *tsk_new(size_t capacity, struct tsc_stack_fval *f_val);
+struct tsc_stack *tsk_new_custom(size_t capacity, struct tsc_stack_fval *f_val, struct cmc_alloc_node *alloc,
+                                 struct cmc_callbacks *callbacks);
+void tsk_free(struct tsc_stack *_stack_);
+void tsk_customize(struct tsc_stack *_stack_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks);
+_Bool tsk_push(struct tsc_stack *_stack_, size_t value);
+_Bool tsk_push_many(struct tsc_stack *_stack_, size_t *values, size_t count);
+_Bool tsk_pop(struct tsc_stack *_stack_, size_t *value);
+_Bool tsk_empty(struct tsc_stack *_stack_);
+_Bool tsk_full(struct tsc_stack *_stack_);
+size_t tsk_count(struct tsc_stack *_stack_);
+size_t tsk_capacity(struct tsc_stack *_stack_);
+int tsk_flag(struct tsc_stack *_stack_);
+struct tsc_stack_node *tsk_new_node(struct tsc_stack *_stack_, size_t value);
+void tsk_free_node(struct tsc_stack *_stack_, struct tsc_stack_node *_node_);
+_Bool tsk_push_node(struct tsc_stack *_stack_, struct tsc_stack_node *_node_);
+struct tsc_stack_node *tsk_pop_node(struct tsc_stack *_stack_);
+_Bool tsk_to_string(struct tsc_stack *_stack_, FILE *fptr);
+_Bool tsk_print(struct tsc_stack *_stack_, FILE *fptr, const char *start, const char *separator, const char *end);
+
+#endif /* CMC_TSC_STACK_TEST_H */
@@ -1,23 +1,41 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#include "unt_cmc_artmap.h"
 #include "unt_cmc_bitset.h"
 #include "unt_cmc_deque.h"
+#include "unt_cmc_disjointset.h"
+#include "unt_cmc_eliasfano.h"
+#include "unt_cmc_fenwicktree.h"
+#include "unt_cmc_gapbuffer.h"
 #include "unt_cmc_hashbidimap.h"
+#include "unt_cmc_hashdisjointset.h"
 #include "unt_cmc_hashmap.h"
 #include "unt_cmc_hashmultimap.h"
 #include "unt_cmc_hashmultiset.h"
 #include "unt_cmc_hashset.h"
 #include "unt_cmc_heap.h"
+#include "unt_cmc_hyperloglog.h"
 #include "unt_cmc_intervalheap.h"
+#include "unt_cmc_intervaltree.h"
 #include "unt_cmc_linkedlist.h"
 #include "unt_cmc_list.h"
+#include "unt_cmc_phashmap.h"
+#include "unt_cmc_ptreemap.h"
 #include "unt_cmc_queue.h"
+#include "unt_cmc_segmenttree.h"
+#include "unt_cmc_slotmap.h"
 #include "unt_cmc_sortedlist.h"
+#include "unt_cmc_sortedmap.h"
+#include "unt_cmc_sparseset.h"
 #include "unt_cmc_stack.h"
+#include "unt_cmc_timerwheel.h"
 #include "unt_cmc_treemap.h"
 #include "unt_cmc_treeset.h"
 
+#include "unt_tsc_queue.h"
+#include "unt_tsc_stack.h"
+
 #include "unt_utl_foreach.h"
 
 #include "utl_assert.h"
@@ -52,12 +70,23 @@ int main(void)
     cmc_timer_start(timer);
     uintmax_t tests = 0, units = 0;
 
+    cmc_run(CMCArtMap, units, tests);
+    cmc_run(CMCArtMapIter, units, tests);
     cmc_run(CMCBitSet, units, tests);
     cmc_run(CMCBitSetIter, units, tests);
     cmc_run(CMCDeque, units, tests);
     cmc_run(CMCDequeIter, units, tests);
+    cmc_run(CMCDisjointSet, units, tests);
+    cmc_run(CMCDisjointSetIter, units, tests);
+    cmc_run(CMCEliasFano, units, tests);
+    cmc_run(CMCEliasFanoIter, units, tests);
+    cmc_run(CMCFenwickTree, units, tests);
+    cmc_run(CMCGapBuffer, units, tests);
+    cmc_run(CMCGapBufferIter, units, tests);
     cmc_run(CMCHashBidiMap, units, tests);
     cmc_run(CMCHashBidiMapIter, units, tests);
+    cmc_run(CMCHashDisjointSet, units, tests);
+    cmc_run(CMCHashDisjointSetIter, units, tests);
     cmc_run(CMCHashMap, units, tests);
     cmc_run(CMCHashMapIter, units, tests);
     cmc_run(CMCHashMultiMap, units, tests);
@@ -68,23 +97,41 @@ int main(void)
     cmc_run(CMCHashSetIter, units, tests);
     cmc_run(CMCHeap, units, tests);
     cmc_run(CMCHeapIter, units, tests);
+    cmc_run(CMCHyperLogLog, units, tests);
     cmc_run(CMCIntervalHeap, units, tests);
     cmc_run(CMCIntervalHeapIter, units, tests);
+    cmc_run(CMCIntervalTree, units, tests);
+    cmc_run(CMCIntervalTreeIter, units, tests);
     cmc_run(CMCLinkedList, units, tests);
     cmc_run(CMCLinkedListIter, units, tests);
     cmc_run(CMCList, units, tests);
     cmc_run(CMCListIter, units, tests);
+    cmc_run(CMCPHashMap, units, tests);
+    cmc_run(CMCPHashMapIter, units, tests);
+    cmc_run(CMCPTreeMap, units, tests);
+    cmc_run(CMCPTreeMapIter, units, tests);
     cmc_run(CMCQueue, units, tests);
     cmc_run(CMCQueueIter, units, tests);
+    cmc_run(CMCSegmentTree, units, tests);
+    cmc_run(CMCSlotMap, units, tests);
+    cmc_run(CMCSlotMapIter, units, tests);
     cmc_run(CMCSortedList, units, tests);
     cmc_run(CMCSortedListIter, units, tests);
+    cmc_run(CMCSortedMap, units, tests);
+    cmc_run(CMCSortedMapIter, units, tests);
+    cmc_run(CMCSparseSet, units, tests);
+    cmc_run(CMCSparseSetIter, units, tests);
     cmc_run(CMCStack, units, tests);
     cmc_run(CMCStackIter, units, tests);
+    cmc_run(CMCTimerWheel, units, tests);
     cmc_run(CMCTreeMap, units, tests);
     cmc_run(CMCTreeMapIter, units, tests);
     cmc_run(CMCTreeSet, units, tests);
     cmc_run(CMCTreeSetIter, units, tests);
 
+    cmc_run(TSCQueue, units, tests);
+    cmc_run(TSCStack, units, tests);
+
     cmc_run(ForEach, units, tests);
 
     cmc_timer_stop(timer);
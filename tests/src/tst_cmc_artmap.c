@@ -0,0 +1,1292 @@
+
+#include "tst_cmc_artmap.h"
+
+static struct artmap_node *am_impl_new_node(struct artmap *_map_, unsigned char kind);
+static void am_impl_free_node(struct artmap *_map_, struct artmap_node *node);
+static void am_impl_free_tree(struct artmap *_map_, struct artmap_node *node);
+static _Bool am_impl_set_prefix(struct artmap *_map_, struct artmap_node *node, const unsigned char *bytes,
+                                size_t length);
+static struct artmap_node **am_impl_find_child(struct artmap_node *node, unsigned char byte);
+static struct artmap_node *am_impl_child_from(struct artmap_node *node, size_t from);
+static struct artmap_node *am_impl_last_child(struct artmap_node *node);
+static _Bool am_impl_add_child(struct artmap *_map_, struct artmap_node **ref, unsigned char byte,
+                               struct artmap_node *child);
+static void am_impl_remove_child(struct artmap *_map_, struct artmap_node **ref, unsigned char byte);
+static void am_impl_compact(struct artmap *_map_, struct artmap_node **ref);
+static struct artmap_entry *am_impl_min(struct artmap_node *node);
+static _Bool am_impl_insert(struct artmap *_map_, struct artmap_entry *entry);
+static struct artmap_entry *am_impl_get_entry(struct artmap *_map_, char *key);
+static struct artmap_entry *am_impl_upper(struct artmap *_map_, const unsigned char *bytes, size_t length);
+struct artmap *am_new(struct artmap_fkey *f_key, struct artmap_fval *f_val)
+{
+    return am_new_custom(f_key, f_val, ((void *)0), ((void *)0));
+}
+struct artmap *am_new_custom(struct artmap_fkey *f_key, struct artmap_fval *f_val, struct cmc_alloc_node *alloc,
+                             struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!f_key || !f_val || !f_key->bytes)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct artmap *_map_ = alloc->malloc(sizeof(struct artmap));
+    if (!_map_)
+        return ((void *)0);
+    _map_->root = ((void *)0);
+    _map_->head = ((void *)0);
+    _map_->tail = ((void *)0);
+    _map_->count = 0;
+    _map_->flag = CMC_FLAG_OK;
+    _map_->f_key = f_key;
+    _map_->f_val = f_val;
+    _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    return _map_;
+}
+void am_clear(struct artmap *_map_)
+{
+    struct artmap_entry *scan = _map_->head;
+    while (scan != ((void *)0))
+    {
+        struct artmap_entry *next = scan->next;
+        if (_map_->f_key->free)
+            _map_->f_key->free(scan->key);
+        if (_map_->f_val->free)
+            _map_->f_val->free(scan->value);
+        _map_->alloc->free(scan);
+        scan = next;
+    }
+    am_impl_free_tree(_map_, _map_->root);
+    _map_->root = ((void *)0);
+    _map_->head = ((void *)0);
+    _map_->tail = ((void *)0);
+    _map_->count = 0;
+    _map_->flag = CMC_FLAG_OK;
+}
+void am_free(struct artmap *_map_)
+{
+    am_clear(_map_);
+    _map_->alloc->free(_map_);
+}
+void am_customize(struct artmap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _map_->alloc = &cmc_alloc_node_default;
+    else
+        _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    _map_->flag = CMC_FLAG_OK;
+}
+_Bool am_insert(struct artmap *_map_, char *key, size_t value)
+{
+    struct artmap_entry *entry = _map_->alloc->malloc(sizeof(struct artmap_entry));
+    if (!entry)
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    entry->key = key;
+    entry->value = value;
+    entry->prev = ((void *)0);
+    entry->next = ((void *)0);
+    if (!am_impl_insert(_map_, entry))
+    {
+        _map_->alloc->free(entry);
+        return 0;
+    }
+    _map_->count++;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->create)
+        (_map_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool am_update(struct artmap *_map_, char *key, size_t new_value, size_t *old_value)
+{
+    if (am_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct artmap_entry *entry = am_impl_get_entry(_map_, key);
+    if (!entry)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (old_value)
+        *old_value = entry->value;
+    entry->value = new_value;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->update)
+        (_map_)->callbacks->update();
+    ;
+    return 1;
+}
+_Bool am_remove(struct artmap *_map_, char *key, size_t *out_value)
+{
+    if (am_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    unsigned char buffer[16];
+    size_t length;
+    const unsigned char *bytes = _map_->f_key->bytes(&key, buffer, &length);
+    struct artmap_node **ref = &_map_->root;
+    struct artmap_node **parent = ((void *)0);
+    struct artmap_entry *entry = ((void *)0);
+    unsigned char byte = 0;
+    size_t depth = 0;
+    while (*ref)
+    {
+        struct artmap_node *node = *ref;
+        if ((((uintptr_t)(node)) & 1))
+        {
+            struct artmap_entry *leaf = ((void *)((uintptr_t)(node) & ~(uintptr_t)1));
+            if (_map_->f_key->cmp(leaf->key, key) != 0)
+                break;
+            entry = leaf;
+            if (!parent)
+                _map_->root = ((void *)0);
+            else
+                am_impl_remove_child(_map_, parent, byte);
+            break;
+        }
+        if (length - depth < node->prefix_len ||
+            memcmp(((node)->prefix_len <= 8 ? (node)->prefix.bytes : (node)->prefix.heap), bytes + depth,
+                   node->prefix_len) != 0)
+            break;
+        depth += node->prefix_len;
+        if (depth == length)
+        {
+            entry = node->entry;
+            if (entry)
+            {
+                node->entry = ((void *)0);
+                am_impl_compact(_map_, ref);
+            }
+            break;
+        }
+        struct artmap_node **child = am_impl_find_child(node, bytes[depth]);
+        if (!child)
+            break;
+        parent = ref;
+        byte = bytes[depth];
+        ref = child;
+        depth++;
+    }
+    if (!entry)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (entry->prev)
+        entry->prev->next = entry->next;
+    else
+        _map_->head = entry->next;
+    if (entry->next)
+        entry->next->prev = entry->prev;
+    else
+        _map_->tail = entry->prev;
+    if (out_value)
+        *out_value = entry->value;
+    _map_->alloc->free(entry);
+    _map_->count--;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->delete)
+        (_map_)->callbacks->delete ();
+    ;
+    return 1;
+}
+_Bool am_max(struct artmap *_map_, char **key, size_t *value)
+{
+    if (am_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    if (key)
+        *key = _map_->tail->key;
+    if (value)
+        *value = _map_->tail->value;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool am_min(struct artmap *_map_, char **key, size_t *value)
+{
+    if (am_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    if (key)
+        *key = _map_->head->key;
+    if (value)
+        *value = _map_->head->value;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return 1;
+}
+size_t am_get(struct artmap *_map_, char *key)
+{
+    if (am_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    struct artmap_entry *entry = am_impl_get_entry(_map_, key);
+    if (!entry)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return (size_t){ 0 };
+    }
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return entry->value;
+}
+size_t *am_get_ref(struct artmap *_map_, char *key)
+{
+    if (am_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return ((void *)0);
+    }
+    struct artmap_entry *entry = am_impl_get_entry(_map_, key);
+    if (!entry)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return ((void *)0);
+    }
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return &(entry->value);
+}
+_Bool am_longest_prefix(struct artmap *_map_, char *key, char **out_key, size_t *out_value)
+{
+    if (am_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    unsigned char buffer[16];
+    unsigned char other[16];
+    size_t length, other_length;
+    const unsigned char *bytes = _map_->f_key->bytes(&key, buffer, &length);
+    struct artmap_node *node = _map_->root;
+    struct artmap_entry *best = ((void *)0);
+    size_t depth = 0;
+    while (node)
+    {
+        if ((((uintptr_t)(node)) & 1))
+        {
+            struct artmap_entry *leaf = ((void *)((uintptr_t)(node) & ~(uintptr_t)1));
+            const unsigned char *leaf_bytes = _map_->f_key->bytes(&leaf->key, other, &other_length);
+            if (other_length <= length && memcmp(leaf_bytes, bytes, other_length) == 0)
+                best = leaf;
+            break;
+        }
+        if (length - depth < node->prefix_len ||
+            memcmp(((node)->prefix_len <= 8 ? (node)->prefix.bytes : (node)->prefix.heap), bytes + depth,
+                   node->prefix_len) != 0)
+            break;
+        depth += node->prefix_len;
+        if (node->entry)
+            best = node->entry;
+        if (depth == length)
+            break;
+        struct artmap_node **child = am_impl_find_child(node, bytes[depth]);
+        if (!child)
+            break;
+        node = *child;
+        depth++;
+    }
+    if (!best)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (out_key)
+        *out_key = best->key;
+    if (out_value)
+        *out_value = best->value;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool am_contains(struct artmap *_map_, char *key)
+{
+    _map_->flag = CMC_FLAG_OK;
+    _Bool result = am_impl_get_entry(_map_, key) != ((void *)0);
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool am_empty(struct artmap *_map_)
+{
+    return _map_->count == 0;
+}
+size_t am_count(struct artmap *_map_)
+{
+    return _map_->count;
+}
+int am_flag(struct artmap *_map_)
+{
+    return _map_->flag;
+}
+struct artmap *am_copy_of(struct artmap *_map_)
+{
+    struct artmap *result = am_new_custom(_map_->f_key, _map_->f_val, _map_->alloc, ((void *)0));
+    if (!result)
+    {
+        _map_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    for (struct artmap_entry *scan = _map_->head; scan; scan = scan->next)
+    {
+        char *key = _map_->f_key->cpy ? _map_->f_key->cpy(scan->key) : scan->key;
+        size_t value = _map_->f_val->cpy ? _map_->f_val->cpy(scan->value) : scan->value;
+        if (!am_insert(result, key, value))
+        {
+            if (_map_->f_key->cpy && _map_->f_key->free)
+                _map_->f_key->free(key);
+            if (_map_->f_val->cpy && _map_->f_val->free)
+                _map_->f_val->free(value);
+            am_free(result);
+            _map_->flag = CMC_FLAG_ALLOC;
+            return ((void *)0);
+        }
+    }
+    _map_->flag = CMC_FLAG_OK;
+    (result)->callbacks = _map_->callbacks;
+    return result;
+}
+_Bool am_equals(struct artmap *_map1_, struct artmap *_map2_)
+{
+    _map1_->flag = CMC_FLAG_OK;
+    _map2_->flag = CMC_FLAG_OK;
+    if (_map1_->count != _map2_->count)
+        return 0;
+    struct artmap_entry *scan1 = _map1_->head;
+    struct artmap_entry *scan2 = _map2_->head;
+    while (scan1 && scan2)
+    {
+        if (_map1_->f_key->cmp(scan1->key, scan2->key) != 0)
+            return 0;
+        if (_map1_->f_val->cmp(scan1->value, scan2->value) != 0)
+            return 0;
+        scan1 = scan1->next;
+        scan2 = scan2->next;
+    }
+    return 1;
+}
+static struct artmap_node *am_impl_new_node(struct artmap *_map_, unsigned char kind)
+{
+    size_t size;
+    switch (kind)
+    {
+        case CMC_ART_NODE4:
+            size = sizeof(struct artmap_node4);
+            break;
+        case CMC_ART_NODE16:
+            size = sizeof(struct artmap_node16);
+            break;
+        case CMC_ART_NODE48:
+            size = sizeof(struct artmap_node48);
+            break;
+        default:
+            size = sizeof(struct artmap_node256);
+            break;
+    }
+    struct artmap_node *node = _map_->alloc->calloc(1, size);
+    if (!node)
+        return ((void *)0);
+    node->kind = kind;
+    return node;
+}
+static void am_impl_free_node(struct artmap *_map_, struct artmap_node *node)
+{
+    if (node->prefix_len > 8)
+        _map_->alloc->free(node->prefix.heap);
+    _map_->alloc->free(node);
+}
+static void am_impl_free_tree(struct artmap *_map_, struct artmap_node *node)
+{
+    if (!node || (((uintptr_t)(node)) & 1))
+        return;
+    struct artmap_node **children;
+    size_t slots;
+    switch (node->kind)
+    {
+        case CMC_ART_NODE4:
+            children = ((struct artmap_node4 *)node)->children;
+            slots = node->count;
+            break;
+        case CMC_ART_NODE16:
+            children = ((struct artmap_node16 *)node)->children;
+            slots = node->count;
+            break;
+        case CMC_ART_NODE48:
+            children = ((struct artmap_node48 *)node)->children;
+            slots = 48;
+            break;
+        default:
+            children = ((struct artmap_node256 *)node)->children;
+            slots = 256;
+            break;
+    }
+    for (size_t i = 0; i < slots; i++)
+        am_impl_free_tree(_map_, children[i]);
+    am_impl_free_node(_map_, node);
+}
+static _Bool am_impl_set_prefix(struct artmap *_map_, struct artmap_node *node, const unsigned char *bytes,
+                                size_t length)
+{
+    unsigned char *old = node->prefix_len > 8 ? node->prefix.heap : ((void *)0);
+    if (length > 8)
+    {
+        unsigned char *heap = _map_->alloc->malloc(length);
+        if (!heap)
+            return 0;
+        memcpy(heap, bytes, length);
+        node->prefix.heap = heap;
+    }
+    else
+        memmove(node->prefix.bytes, bytes, length);
+    node->prefix_len = length;
+    if (old)
+        _map_->alloc->free(old);
+    return 1;
+}
+static struct artmap_node **am_impl_find_child(struct artmap_node *node, unsigned char byte)
+{
+    switch (node->kind)
+    {
+        case CMC_ART_NODE4:
+            {
+                struct artmap_node4 *n = (struct artmap_node4 *)node;
+                for (size_t i = 0; i < node->count; i++)
+                {
+                    if (n->keys[i] == byte)
+                        return &n->children[i];
+                }
+                return ((void *)0);
+            }
+        case CMC_ART_NODE16:
+            {
+                struct artmap_node16 *n = (struct artmap_node16 *)node;
+                for (size_t i = 0; i < node->count; i++)
+                {
+                    if (n->keys[i] == byte)
+                        return &n->children[i];
+                }
+                return ((void *)0);
+            }
+        case CMC_ART_NODE48:
+            {
+                struct artmap_node48 *n = (struct artmap_node48 *)node;
+                return n->index[byte] ? &n->children[n->index[byte] - 1] : ((void *)0);
+            }
+        default:
+            {
+                struct artmap_node256 *n = (struct artmap_node256 *)node;
+                return n->children[byte] ? &n->children[byte] : ((void *)0);
+            }
+    }
+}
+static struct artmap_node *am_impl_child_from(struct artmap_node *node, size_t from)
+{
+    switch (node->kind)
+    {
+        case CMC_ART_NODE4:
+            {
+                struct artmap_node4 *n = (struct artmap_node4 *)node;
+                for (size_t i = 0; i < node->count; i++)
+                {
+                    if (n->keys[i] >= from)
+                        return n->children[i];
+                }
+                return ((void *)0);
+            }
+        case CMC_ART_NODE16:
+            {
+                struct artmap_node16 *n = (struct artmap_node16 *)node;
+                for (size_t i = 0; i < node->count; i++)
+                {
+                    if (n->keys[i] >= from)
+                        return n->children[i];
+                }
+                return ((void *)0);
+            }
+        case CMC_ART_NODE48:
+            {
+                struct artmap_node48 *n = (struct artmap_node48 *)node;
+                for (size_t b = from; b < 256; b++)
+                {
+                    if (n->index[b])
+                        return n->children[n->index[b] - 1];
+                }
+                return ((void *)0);
+            }
+        default:
+            {
+                struct artmap_node256 *n = (struct artmap_node256 *)node;
+                for (size_t b = from; b < 256; b++)
+                {
+                    if (n->children[b])
+                        return n->children[b];
+                }
+                return ((void *)0);
+            }
+    }
+}
+static struct artmap_node *am_impl_last_child(struct artmap_node *node)
+{
+    switch (node->kind)
+    {
+        case CMC_ART_NODE4:
+            return node->count ? ((struct artmap_node4 *)node)->children[node->count - 1] : ((void *)0);
+        case CMC_ART_NODE16:
+            return node->count ? ((struct artmap_node16 *)node)->children[node->count - 1] : ((void *)0);
+        case CMC_ART_NODE48:
+            {
+                struct artmap_node48 *n = (struct artmap_node48 *)node;
+                for (size_t b = 256; b > 0; b--)
+                {
+                    if (n->index[b - 1])
+                        return n->children[n->index[b - 1] - 1];
+                }
+                return ((void *)0);
+            }
+        default:
+            {
+                struct artmap_node256 *n = (struct artmap_node256 *)node;
+                for (size_t b = 256; b > 0; b--)
+                {
+                    if (n->children[b - 1])
+                        return n->children[b - 1];
+                }
+                return ((void *)0);
+            }
+    }
+}
+static _Bool am_impl_add_child(struct artmap *_map_, struct artmap_node **ref, unsigned char byte,
+                               struct artmap_node *child)
+{
+    struct artmap_node *node = *ref;
+    switch (node->kind)
+    {
+        case CMC_ART_NODE4:
+            {
+                struct artmap_node4 *n = (struct artmap_node4 *)node;
+                if (node->count < 4)
+                {
+                    size_t i = 0;
+                    while (i < node->count && n->keys[i] < byte)
+                        i++;
+                    memmove(n->keys + i + 1, n->keys + i, node->count - i);
+                    memmove(n->children + i + 1, n->children + i, (node->count - i) * sizeof(n->children[0]));
+                    n->keys[i] = byte;
+                    n->children[i] = child;
+                    node->count++;
+                    return 1;
+                }
+                struct artmap_node16 *bigger = (struct artmap_node16 *)am_impl_new_node(_map_, CMC_ART_NODE16);
+                if (!bigger)
+                    return 0;
+                bigger->header = n->header;
+                bigger->header.kind = CMC_ART_NODE16;
+                memcpy(bigger->keys, n->keys, 4);
+                memcpy(bigger->children, n->children, 4 * sizeof(n->children[0]));
+                *ref = &bigger->header;
+                _map_->alloc->free(n);
+                return am_impl_add_child(_map_, ref, byte, child);
+            }
+        case CMC_ART_NODE16:
+            {
+                struct artmap_node16 *n = (struct artmap_node16 *)node;
+                if (node->count < 16)
+                {
+                    size_t i = 0;
+                    while (i < node->count && n->keys[i] < byte)
+                        i++;
+                    memmove(n->keys + i + 1, n->keys + i, node->count - i);
+                    memmove(n->children + i + 1, n->children + i, (node->count - i) * sizeof(n->children[0]));
+                    n->keys[i] = byte;
+                    n->children[i] = child;
+                    node->count++;
+                    return 1;
+                }
+                struct artmap_node48 *bigger = (struct artmap_node48 *)am_impl_new_node(_map_, CMC_ART_NODE48);
+                if (!bigger)
+                    return 0;
+                bigger->header = n->header;
+                bigger->header.kind = CMC_ART_NODE48;
+                for (size_t i = 0; i < 16; i++)
+                {
+                    bigger->index[n->keys[i]] = (unsigned char)(i + 1);
+                    bigger->children[i] = n->children[i];
+                }
+                *ref = &bigger->header;
+                _map_->alloc->free(n);
+                return am_impl_add_child(_map_, ref, byte, child);
+            }
+        case CMC_ART_NODE48:
+            {
+                struct artmap_node48 *n = (struct artmap_node48 *)node;
+                if (node->count < 48)
+                {
+                    size_t slot = 0;
+                    while (n->children[slot])
+                        slot++;
+                    n->index[byte] = (unsigned char)(slot + 1);
+                    n->children[slot] = child;
+                    node->count++;
+                    return 1;
+                }
+                struct artmap_node256 *bigger = (struct artmap_node256 *)am_impl_new_node(_map_, CMC_ART_NODE256);
+                if (!bigger)
+                    return 0;
+                bigger->header = n->header;
+                bigger->header.kind = CMC_ART_NODE256;
+                for (size_t b = 0; b < 256; b++)
+                {
+                    if (n->index[b])
+                        bigger->children[b] = n->children[n->index[b] - 1];
+                }
+                *ref = &bigger->header;
+                _map_->alloc->free(n);
+                return am_impl_add_child(_map_, ref, byte, child);
+            }
+        default:
+            {
+                struct artmap_node256 *n = (struct artmap_node256 *)node;
+                n->children[byte] = child;
+                node->count++;
+                return 1;
+            }
+    }
+}
+static void am_impl_remove_child(struct artmap *_map_, struct artmap_node **ref, unsigned char byte)
+{
+    struct artmap_node *node = *ref;
+    switch (node->kind)
+    {
+        case CMC_ART_NODE4:
+            {
+                struct artmap_node4 *n = (struct artmap_node4 *)node;
+                size_t i = 0;
+                while (n->keys[i] != byte)
+                    i++;
+                memmove(n->keys + i, n->keys + i + 1, node->count - i - 1);
+                memmove(n->children + i, n->children + i + 1, (node->count - i - 1) * sizeof(n->children[0]));
+                node->count--;
+                break;
+            }
+        case CMC_ART_NODE16:
+            {
+                struct artmap_node16 *n = (struct artmap_node16 *)node;
+                size_t i = 0;
+                while (n->keys[i] != byte)
+                    i++;
+                memmove(n->keys + i, n->keys + i + 1, node->count - i - 1);
+                memmove(n->children + i, n->children + i + 1, (node->count - i - 1) * sizeof(n->children[0]));
+                node->count--;
+                if (node->count == 3)
+                {
+                    struct artmap_node4 *smaller = (struct artmap_node4 *)am_impl_new_node(_map_, CMC_ART_NODE4);
+                    if (smaller)
+                    {
+                        smaller->header = n->header;
+                        smaller->header.kind = CMC_ART_NODE4;
+                        memcpy(smaller->keys, n->keys, 3);
+                        memcpy(smaller->children, n->children, 3 * sizeof(n->children[0]));
+                        *ref = &smaller->header;
+                        _map_->alloc->free(n);
+                    }
+                }
+                break;
+            }
+        case CMC_ART_NODE48:
+            {
+                struct artmap_node48 *n = (struct artmap_node48 *)node;
+                n->children[n->index[byte] - 1] = ((void *)0);
+                n->index[byte] = 0;
+                node->count--;
+                if (node->count == 12)
+                {
+                    struct artmap_node16 *smaller = (struct artmap_node16 *)am_impl_new_node(_map_, CMC_ART_NODE16);
+                    if (smaller)
+                    {
+                        smaller->header = n->header;
+                        smaller->header.kind = CMC_ART_NODE16;
+                        size_t i = 0;
+                        for (size_t b = 0; b < 256; b++)
+                        {
+                            if (n->index[b])
+                            {
+                                smaller->keys[i] = (unsigned char)b;
+                                smaller->children[i] = n->children[n->index[b] - 1];
+                                i++;
+                            }
+                        }
+                        *ref = &smaller->header;
+                        _map_->alloc->free(n);
+                    }
+                }
+                break;
+            }
+        default:
+            {
+                struct artmap_node256 *n = (struct artmap_node256 *)node;
+                n->children[byte] = ((void *)0);
+                node->count--;
+                if (node->count == 37)
+                {
+                    struct artmap_node48 *smaller = (struct artmap_node48 *)am_impl_new_node(_map_, CMC_ART_NODE48);
+                    if (smaller)
+                    {
+                        smaller->header = n->header;
+                        smaller->header.kind = CMC_ART_NODE48;
+                        size_t slot = 0;
+                        for (size_t b = 0; b < 256; b++)
+                        {
+                            if (n->children[b])
+                            {
+                                smaller->children[slot] = n->children[b];
+                                smaller->index[b] = (unsigned char)(++slot);
+                            }
+                        }
+                        *ref = &smaller->header;
+                        _map_->alloc->free(n);
+                    }
+                }
+                break;
+            }
+    }
+    am_impl_compact(_map_, ref);
+}
+static void am_impl_compact(struct artmap *_map_, struct artmap_node **ref)
+{
+    struct artmap_node *node = *ref;
+    if (node->count == 0)
+    {
+        *ref = node->entry ? ((void *)((uintptr_t)(node->entry) | 1)) : ((void *)0);
+        am_impl_free_node(_map_, node);
+    }
+    else if (node->count == 1 && !node->entry && node->kind == CMC_ART_NODE4)
+    {
+        struct artmap_node4 *n = (struct artmap_node4 *)node;
+        struct artmap_node *child = n->children[0];
+        if ((((uintptr_t)(child)) & 1))
+        {
+            *ref = child;
+            am_impl_free_node(_map_, node);
+            return;
+        }
+        size_t length = node->prefix_len + 1 + child->prefix_len;
+        unsigned char small[8];
+        unsigned char *path = small;
+        if (length > 8)
+        {
+            path = _map_->alloc->malloc(length);
+            if (!path)
+                return;
+        }
+        memcpy(path, ((node)->prefix_len <= 8 ? (node)->prefix.bytes : (node)->prefix.heap), node->prefix_len);
+        path[node->prefix_len] = n->keys[0];
+        memcpy(path + node->prefix_len + 1, ((child)->prefix_len <= 8 ? (child)->prefix.bytes : (child)->prefix.heap),
+               child->prefix_len);
+        if (am_impl_set_prefix(_map_, child, path, length))
+        {
+            *ref = child;
+            am_impl_free_node(_map_, node);
+        }
+        if (path != small)
+            _map_->alloc->free(path);
+    }
+}
+static struct artmap_entry *am_impl_min(struct artmap_node *node)
+{
+    while (node && !(((uintptr_t)(node)) & 1))
+    {
+        if (node->entry)
+            return node->entry;
+        node = am_impl_child_from(node, 0);
+    }
+    return node ? ((void *)((uintptr_t)(node) & ~(uintptr_t)1)) : ((void *)0);
+}
+static _Bool am_impl_insert(struct artmap *_map_, struct artmap_entry *entry)
+{
+    unsigned char buffer[16];
+    unsigned char other[16];
+    size_t length, other_length;
+    const unsigned char *bytes = _map_->f_key->bytes(&entry->key, buffer, &length);
+    struct artmap_node **ref = &_map_->root;
+    size_t depth = 0;
+    while (1)
+    {
+        struct artmap_node *node = *ref;
+        if (!node)
+        {
+            *ref = ((void *)((uintptr_t)(entry) | 1));
+            break;
+        }
+        if ((((uintptr_t)(node)) & 1))
+        {
+            struct artmap_entry *leaf = ((void *)((uintptr_t)(node) & ~(uintptr_t)1));
+            const unsigned char *leaf_bytes = _map_->f_key->bytes(&leaf->key, other, &other_length);
+            size_t limit = length < other_length ? length : other_length;
+            size_t common = depth;
+            while (common < limit && bytes[common] == leaf_bytes[common])
+                common++;
+            if (common == length && common == other_length)
+            {
+                _map_->flag = CMC_FLAG_DUPLICATE;
+                return 0;
+            }
+            struct artmap_node *split = am_impl_new_node(_map_, CMC_ART_NODE4);
+            if (!split)
+            {
+                _map_->flag = CMC_FLAG_ALLOC;
+                return 0;
+            }
+            if (!am_impl_set_prefix(_map_, split, bytes + depth, common - depth))
+            {
+                am_impl_free_node(_map_, split);
+                _map_->flag = CMC_FLAG_ALLOC;
+                return 0;
+            }
+            if (common == other_length)
+                split->entry = leaf;
+            else
+                am_impl_add_child(_map_, &split, leaf_bytes[common], node);
+            if (common == length)
+                split->entry = entry;
+            else
+                am_impl_add_child(_map_, &split, bytes[common], ((void *)((uintptr_t)(entry) | 1)));
+            *ref = split;
+            break;
+        }
+        const unsigned char *prefix = ((node)->prefix_len <= 8 ? (node)->prefix.bytes : (node)->prefix.heap);
+        size_t limit = node->prefix_len < length - depth ? node->prefix_len : length - depth;
+        size_t p = 0;
+        while (p < limit && prefix[p] == bytes[depth + p])
+            p++;
+        if (p < node->prefix_len)
+        {
+            struct artmap_node *split = am_impl_new_node(_map_, CMC_ART_NODE4);
+            if (!split)
+            {
+                _map_->flag = CMC_FLAG_ALLOC;
+                return 0;
+            }
+            if (!am_impl_set_prefix(_map_, split, prefix, p))
+            {
+                am_impl_free_node(_map_, split);
+                _map_->flag = CMC_FLAG_ALLOC;
+                return 0;
+            }
+            unsigned char byte = prefix[p];
+            if (!am_impl_set_prefix(_map_, node, prefix + p + 1, node->prefix_len - p - 1))
+            {
+                am_impl_free_node(_map_, split);
+                _map_->flag = CMC_FLAG_ALLOC;
+                return 0;
+            }
+            am_impl_add_child(_map_, &split, byte, node);
+            if (depth + p == length)
+                split->entry = entry;
+            else
+                am_impl_add_child(_map_, &split, bytes[depth + p], ((void *)((uintptr_t)(entry) | 1)));
+            *ref = split;
+            break;
+        }
+        depth += node->prefix_len;
+        if (depth == length)
+        {
+            if (node->entry)
+            {
+                _map_->flag = CMC_FLAG_DUPLICATE;
+                return 0;
+            }
+            node->entry = entry;
+            break;
+        }
+        struct artmap_node **child = am_impl_find_child(node, bytes[depth]);
+        if (!child)
+        {
+            if (!am_impl_add_child(_map_, ref, bytes[depth], ((void *)((uintptr_t)(entry) | 1))))
+            {
+                _map_->flag = CMC_FLAG_ALLOC;
+                return 0;
+            }
+            break;
+        }
+        ref = child;
+        depth++;
+    }
+    struct artmap_entry *next = am_impl_upper(_map_, bytes, length);
+    entry->next = next;
+    entry->prev = next ? next->prev : _map_->tail;
+    if (entry->prev)
+        entry->prev->next = entry;
+    else
+        _map_->head = entry;
+    if (next)
+        next->prev = entry;
+    else
+        _map_->tail = entry;
+    return 1;
+}
+static struct artmap_entry *am_impl_get_entry(struct artmap *_map_, char *key)
+{
+    unsigned char buffer[16];
+    size_t length;
+    const unsigned char *bytes = _map_->f_key->bytes(&key, buffer, &length);
+    struct artmap_node *node = _map_->root;
+    size_t depth = 0;
+    while (node)
+    {
+        if ((((uintptr_t)(node)) & 1))
+        {
+            struct artmap_entry *leaf = ((void *)((uintptr_t)(node) & ~(uintptr_t)1));
+            return _map_->f_key->cmp(leaf->key, key) == 0 ? leaf : ((void *)0);
+        }
+        if (length - depth < node->prefix_len ||
+            memcmp(((node)->prefix_len <= 8 ? (node)->prefix.bytes : (node)->prefix.heap), bytes + depth,
+                   node->prefix_len) != 0)
+            return ((void *)0);
+        depth += node->prefix_len;
+        if (depth == length)
+            return node->entry;
+        struct artmap_node **child = am_impl_find_child(node, bytes[depth]);
+        if (!child)
+            return ((void *)0);
+        node = *child;
+        depth++;
+    }
+    return ((void *)0);
+}
+static struct artmap_entry *am_impl_upper(struct artmap *_map_, const unsigned char *bytes, size_t length)
+{
+    unsigned char other[16];
+    size_t other_length;
+    struct artmap_node *greater = ((void *)0);
+    struct artmap_node *node = _map_->root;
+    size_t depth = 0;
+    while (node)
+    {
+        if ((((uintptr_t)(node)) & 1))
+        {
+            struct artmap_entry *leaf = ((void *)((uintptr_t)(node) & ~(uintptr_t)1));
+            const unsigned char *leaf_bytes = _map_->f_key->bytes(&leaf->key, other, &other_length);
+            int cmp = memcmp(leaf_bytes, bytes, length < other_length ? length : other_length);
+            if (cmp == 0)
+                cmp = (other_length > length) - (other_length < length);
+            if (cmp > 0)
+                return leaf;
+            break;
+        }
+        const unsigned char *prefix = ((node)->prefix_len <= 8 ? (node)->prefix.bytes : (node)->prefix.heap);
+        for (size_t i = 0; i < node->prefix_len; i++)
+        {
+            if (depth + i == length)
+                return am_impl_min(node);
+            if (prefix[i] != bytes[depth + i])
+            {
+                if (prefix[i] > bytes[depth + i])
+                    return am_impl_min(node);
+                return am_impl_min(greater);
+            }
+        }
+        depth += node->prefix_len;
+        if (depth == length)
+        {
+            struct artmap_node *first = am_impl_child_from(node, 0);
+            return am_impl_min(first ? first : greater);
+        }
+        struct artmap_node *next = am_impl_child_from(node, (size_t)bytes[depth] + 1);
+        if (next)
+            greater = next;
+        struct artmap_node **child = am_impl_find_child(node, bytes[depth]);
+        if (!child)
+            break;
+        node = *child;
+        depth++;
+    }
+    return am_impl_min(greater);
+}
+static struct artmap_entry *am_impl_max(struct artmap_node *node);
+static _Bool am_impl_prefix_range(struct artmap *_map_, const unsigned char *bytes, size_t length,
+                                  struct artmap_entry **first, struct artmap_entry **last);
+struct artmap_iter am_iter_start(struct artmap *target)
+{
+    struct artmap_iter iter;
+    iter.target = target;
+    iter.cursor = target->head;
+    iter.first = target->head;
+    iter.last = target->tail;
+    iter.count = target->count;
+    iter.index = 0;
+    iter.start = 1;
+    iter.end = iter.count == 0;
+    return iter;
+}
+struct artmap_iter am_iter_end(struct artmap *target)
+{
+    struct artmap_iter iter;
+    iter.target = target;
+    iter.cursor = target->tail;
+    iter.first = target->head;
+    iter.last = target->tail;
+    iter.count = target->count;
+    iter.index = iter.count == 0 ? 0 : iter.count - 1;
+    iter.start = iter.count == 0;
+    iter.end = 1;
+    return iter;
+}
+struct artmap_iter am_iter_prefix(struct artmap *target, char *prefix)
+{
+    struct artmap_iter iter;
+    unsigned char buffer[16];
+    size_t length;
+    const unsigned char *bytes = target->f_key->bytes(&prefix, buffer, &length);
+    iter.target = target;
+    iter.first = ((void *)0);
+    iter.last = ((void *)0);
+    iter.count = 0;
+    iter.index = 0;
+    iter.start = 1;
+    iter.end = 1;
+    if (am_impl_prefix_range(target, bytes, length, &iter.first, &iter.last))
+    {
+        iter.count = 1;
+        for (struct artmap_entry *scan = iter.first; scan != iter.last; scan = scan->next)
+            iter.count++;
+        iter.end = 0;
+    }
+    iter.cursor = iter.first;
+    return iter;
+}
+_Bool am_iter_at_start(struct artmap_iter *iter)
+{
+    return iter->count == 0 || iter->start;
+}
+_Bool am_iter_at_end(struct artmap_iter *iter)
+{
+    return iter->count == 0 || iter->end;
+}
+_Bool am_iter_to_start(struct artmap_iter *iter)
+{
+    if (iter->count != 0)
+    {
+        iter->index = 0;
+        iter->start = 1;
+        iter->end = 0;
+        iter->cursor = iter->first;
+        return 1;
+    }
+    return 0;
+}
+_Bool am_iter_to_end(struct artmap_iter *iter)
+{
+    if (iter->count != 0)
+    {
+        iter->index = iter->count - 1;
+        iter->start = 0;
+        iter->end = 1;
+        iter->cursor = iter->last;
+        return 1;
+    }
+    return 0;
+}
+_Bool am_iter_next(struct artmap_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor == iter->last)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = 0;
+    iter->cursor = iter->cursor->next;
+    iter->index++;
+    return 1;
+}
+_Bool am_iter_prev(struct artmap_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == iter->first)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = 0;
+    iter->cursor = iter->cursor->prev;
+    iter->index--;
+    return 1;
+}
+_Bool am_iter_advance(struct artmap_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor == iter->last)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index + steps >= iter->count)
+        return 0;
+    for (size_t i = 0; i < steps; i++)
+        am_iter_next(iter);
+    return 1;
+}
+_Bool am_iter_rewind(struct artmap_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == iter->first)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index < steps)
+        return 0;
+    for (size_t i = 0; i < steps; i++)
+        am_iter_prev(iter);
+    return 1;
+}
+_Bool am_iter_go_to(struct artmap_iter *iter, size_t index)
+{
+    if (index >= iter->count)
+        return 0;
+    if (iter->index > index)
+        return am_iter_rewind(iter, iter->index - index);
+    else if (iter->index < index)
+        return am_iter_advance(iter, index - iter->index);
+    return 1;
+}
+char *am_iter_key(struct artmap_iter *iter)
+{
+    if (iter->count == 0)
+        return (char *){ 0 };
+    return iter->cursor->key;
+}
+size_t am_iter_value(struct artmap_iter *iter)
+{
+    if (iter->count == 0)
+        return (size_t){ 0 };
+    return iter->cursor->value;
+}
+size_t *am_iter_rvalue(struct artmap_iter *iter)
+{
+    if (iter->count == 0)
+        return ((void *)0);
+    return &(iter->cursor->value);
+}
+size_t am_iter_index(struct artmap_iter *iter)
+{
+    return iter->index;
+}
+static struct artmap_entry *am_impl_max(struct artmap_node *node)
+{
+    while (node && !(((uintptr_t)(node)) & 1))
+    {
+        struct artmap_node *last = am_impl_last_child(node);
+        if (!last)
+            return node->entry;
+        node = last;
+    }
+    return node ? ((void *)((uintptr_t)(node) & ~(uintptr_t)1)) : ((void *)0);
+}
+static _Bool am_impl_prefix_range(struct artmap *_map_, const unsigned char *bytes, size_t length,
+                                  struct artmap_entry **first, struct artmap_entry **last)
+{
+    unsigned char other[16];
+    size_t other_length;
+    struct artmap_node *node = _map_->root;
+    size_t depth = 0;
+    while (node)
+    {
+        if ((((uintptr_t)(node)) & 1))
+        {
+            struct artmap_entry *leaf = ((void *)((uintptr_t)(node) & ~(uintptr_t)1));
+            const unsigned char *leaf_bytes = _map_->f_key->bytes(&leaf->key, other, &other_length);
+            if (other_length < length || memcmp(leaf_bytes, bytes, length) != 0)
+                return 0;
+            *first = leaf;
+            *last = leaf;
+            return 1;
+        }
+        size_t remaining = length - depth;
+        size_t compare = node->prefix_len < remaining ? node->prefix_len : remaining;
+        if (memcmp(((node)->prefix_len <= 8 ? (node)->prefix.bytes : (node)->prefix.heap), bytes + depth, compare) != 0)
+            return 0;
+        if (node->prefix_len >= remaining)
+        {
+            *first = am_impl_min(node);
+            *last = am_impl_max(node);
+            return 1;
+        }
+        depth += node->prefix_len;
+        struct artmap_node **child = am_impl_find_child(node, bytes[depth]);
+        if (!child)
+            return 0;
+        node = *child;
+        depth++;
+    }
+    return 0;
+}
+_Bool am_to_string(struct artmap *_map_, FILE *fptr)
+{
+    struct artmap *m_ = _map_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s, %s> "
+                        "at %p { "
+                        "root:%p, "
+                        "head:%p, "
+                        "tail:%p, "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "f_key:%p, "
+                        "alloc:%p, "
+                        "callbacks:%p }",
+                        "artmap", "char *", "size_t", m_, m_->root, m_->head, m_->tail, m_->count, m_->flag, m_->f_key,
+                        m_->f_val, m_->alloc, (m_)->callbacks);
+}
+_Bool am_print(struct artmap *_map_, FILE *fptr, const char *start, const char *separator, const char *end,
+               const char *key_val_sep)
+{
+    fprintf(fptr, "%s", start);
+    for (struct artmap_entry *scan = _map_->head; scan; scan = scan->next)
+    {
+        if (!_map_->f_key->str(fptr, scan->key))
+            return 0;
+        fprintf(fptr, "%s", key_val_sep);
+        if (!_map_->f_val->str(fptr, scan->value))
+            return 0;
+        if (scan->next)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
@@ -1,6 +1,180 @@
 
 #include "tst_cmc_deque.h"
 
+static size_t *d_impl_contiguous(struct deque *_deque_);
+static void d_impl_evict(struct deque *_deque_, size_t value);
+static void d_impl_sort_insertion(size_t *array, size_t count, int (*cmp)(size_t, size_t))
+{
+    for (size_t i = 1; i < count; i++)
+    {
+        size_t _tmp_ = array[i];
+        size_t j = i;
+        while (j > 0 && cmp(array[j - 1], _tmp_) > 0)
+        {
+            array[j] = array[j - 1];
+            j--;
+        }
+        array[j] = _tmp_;
+    }
+}
+static void d_impl_sort_heap(size_t *array, size_t count, int (*cmp)(size_t, size_t))
+{
+    for (size_t end = count, i = count / 2; end > 1;)
+    {
+        if (i > 0)
+            i--;
+        else
+        {
+            end--;
+            size_t _tmp_ = array[0];
+            array[0] = array[end];
+            array[end] = _tmp_;
+        }
+        for (size_t node = i, child = i * 2 + 1; child < end; node = child, child = child * 2 + 1)
+        {
+            if (child + 1 < end && cmp(array[child + 1], array[child]) > 0)
+                child++;
+            if (cmp(array[child], array[node]) <= 0)
+                break;
+            size_t _tmp_ = array[node];
+            array[node] = array[child];
+            array[child] = _tmp_;
+        }
+    }
+}
+static void d_impl_sort_intro(size_t *array, size_t count, int (*cmp)(size_t, size_t), size_t depth)
+{
+    while (count > 16)
+    {
+        if (depth == 0)
+        {
+            d_impl_sort_heap(array, count, cmp);
+            return;
+        }
+        depth--;
+        size_t mid = count / 2;
+        if (cmp(array[mid], array[0]) < 0)
+        {
+            size_t _tmp_ = array[mid];
+            array[mid] = array[0];
+            array[0] = _tmp_;
+        }
+        if (cmp(array[count - 1], array[0]) < 0)
+        {
+            size_t _tmp_ = array[count - 1];
+            array[count - 1] = array[0];
+            array[0] = _tmp_;
+        }
+        if (cmp(array[count - 1], array[mid]) < 0)
+        {
+            size_t _tmp_ = array[count - 1];
+            array[count - 1] = array[mid];
+            array[mid] = _tmp_;
+        }
+        size_t pivot = array[mid];
+        size_t lt = 0, i = 0, gt = count;
+        while (i < gt)
+        {
+            int c = cmp(array[i], pivot);
+            if (c < 0)
+            {
+                size_t _tmp_ = array[i];
+                array[i++] = array[lt];
+                array[lt++] = _tmp_;
+            }
+            else if (c > 0)
+            {
+                size_t _tmp_ = array[i];
+                array[i] = array[--gt];
+                array[gt] = _tmp_;
+            }
+            else
+                i++;
+        }
+        if (lt < count - gt)
+        {
+            d_impl_sort_intro(array, lt, cmp, depth);
+            array += gt;
+            count -= gt;
+        }
+        else
+        {
+            d_impl_sort_intro(array + gt, count - gt, cmp, depth);
+            count = lt;
+        }
+    }
+    d_impl_sort_insertion(array, count, cmp);
+}
+static void d_impl_sort_merge(size_t *array, size_t *temp, size_t half, size_t count, int (*cmp)(size_t, size_t))
+{
+    if (half == 0 || half == count || cmp(array[half - 1], array[half]) <= 0)
+        return;
+    memcpy(temp, array, half * sizeof(size_t));
+    size_t i = 0, j = half, k = 0;
+    while (i < half && j < count)
+    {
+        if (cmp(array[j], temp[i]) < 0)
+            array[k++] = array[j++];
+        else
+            array[k++] = temp[i++];
+    }
+    while (i < half)
+        array[k++] = temp[i++];
+}
+static void d_impl_sort_mergesort(size_t *array, size_t *temp, size_t count, int (*cmp)(size_t, size_t))
+{
+    if (count <= 16)
+    {
+        d_impl_sort_insertion(array, count, cmp);
+        return;
+    }
+    size_t half = count / 2;
+    d_impl_sort_mergesort(array, temp, half, cmp);
+    d_impl_sort_mergesort(array + half, temp, count - half, cmp);
+    d_impl_sort_merge(array, temp, half, count, cmp);
+}
+static size_t d_impl_sort_depth(size_t count)
+{
+    size_t depth = 0;
+    while (count > 1)
+    {
+        count /= 2;
+        depth += 2;
+    }
+    return depth;
+}
+static _Bool d_impl_sort_parallel(size_t *array, size_t count, int (*cmp)(size_t, size_t), struct cmc_alloc_node *alloc,
+                                  _Bool stable)
+{
+    (void)array;
+    (void)count;
+    (void)cmp;
+    (void)alloc;
+    (void)stable;
+    return 0;
+}
+static void d_impl_sort(size_t *array, size_t count, int (*cmp)(size_t, size_t), struct cmc_alloc_node *alloc)
+{
+    if (count >= 65536 && d_impl_sort_parallel(array, count, cmp, alloc, 0))
+        return;
+    d_impl_sort_intro(array, count, cmp, d_impl_sort_depth(count));
+}
+static _Bool d_impl_stable_sort(size_t *array, size_t count, int (*cmp)(size_t, size_t), struct cmc_alloc_node *alloc)
+{
+    if (count <= 16)
+    {
+        d_impl_sort_insertion(array, count, cmp);
+        return 1;
+    }
+    if (count >= 65536 && d_impl_sort_parallel(array, count, cmp, alloc, 1))
+        return 1;
+    size_t *temp = alloc->malloc((count / 2) * sizeof(size_t));
+    if (!temp)
+        return 0;
+    d_impl_sort_mergesort(array, temp, count, cmp);
+    alloc->free(temp);
+    return 1;
+}
 struct deque *d_new(size_t capacity, struct deque_fval *f_val)
 {
     return d_new_custom(capacity, f_val, ((void *)0), ((void *)0));
@@ -28,6 +202,8 @@ struct deque *d_new_custom(size_t capacity, struct deque_fval *f_val, struct cmc
     _deque_->count = 0;
     _deque_->front = 0;
     _deque_->back = 0;
+    _deque_->overwrite = 0;
+    _deque_->evict = ((void *)0);
     _deque_->flag = CMC_FLAG_OK;
     _deque_->f_val = f_val;
     _deque_->alloc = alloc;
@@ -77,7 +253,16 @@ _Bool d_push_front(struct deque *_deque_, size_t value)
 {
     if (d_full(_deque_))
     {
-        if (!d_resize(_deque_, _deque_->capacity * 2))
+        if (_deque_->overwrite)
+        {
+            _deque_->back = (_deque_->back == 0) ? _deque_->capacity - 1 : _deque_->back - 1;
+            _deque_->count--;
+            d_impl_evict(_deque_, _deque_->buffer[_deque_->back]);
+            if ((_deque_)->callbacks && (_deque_)->callbacks->delete)
+                (_deque_)->callbacks->delete ();
+            ;
+        }
+        else if (!d_resize(_deque_, _deque_->capacity * 2))
             return 0;
     }
     _deque_->front = (_deque_->front == 0) ? _deque_->capacity - 1 : _deque_->front - 1;
@@ -93,7 +278,16 @@ _Bool d_push_back(struct deque *_deque_, size_t value)
 {
     if (d_full(_deque_))
     {
-        if (!d_resize(_deque_, _deque_->capacity * 2))
+        if (_deque_->overwrite)
+        {
+            d_impl_evict(_deque_, _deque_->buffer[_deque_->front]);
+            _deque_->front = (_deque_->front == _deque_->capacity - 1) ? 0 : _deque_->front + 1;
+            _deque_->count--;
+            if ((_deque_)->callbacks && (_deque_)->callbacks->delete)
+                (_deque_)->callbacks->delete ();
+            ;
+        }
+        else if (!d_resize(_deque_, _deque_->capacity * 2))
             return 0;
     }
     _deque_->buffer[_deque_->back] = value;
@@ -137,6 +331,56 @@ _Bool d_pop_back(struct deque *_deque_)
     ;
     return 1;
 }
+_Bool d_push_back_many(struct deque *_deque_, size_t *values, size_t count)
+{
+    if (count == 0)
+    {
+        _deque_->flag = CMC_FLAG_OK;
+        return 1;
+    }
+    if (_deque_->overwrite)
+    {
+        size_t skipped = count > _deque_->capacity ? count - _deque_->capacity : 0;
+        size_t evicted = _deque_->count + count - skipped;
+        evicted = evicted > _deque_->capacity ? evicted - _deque_->capacity : 0;
+        for (size_t i = 0; i < evicted; i++)
+        {
+            d_impl_evict(_deque_, _deque_->buffer[_deque_->front]);
+            _deque_->front = (_deque_->front == _deque_->capacity - 1) ? 0 : _deque_->front + 1;
+        }
+        for (size_t i = 0; i < skipped; i++)
+            d_impl_evict(_deque_, values[i]);
+        if (evicted + skipped > 0)
+        {
+            if ((_deque_)->callbacks && (_deque_)->callbacks->delete)
+                (_deque_)->callbacks->delete ();
+            ;
+        }
+        _deque_->count -= evicted;
+        values += skipped;
+        count -= skipped;
+    }
+    else if (_deque_->count + count > _deque_->capacity)
+    {
+        size_t capacity = _deque_->capacity * 2;
+        if (capacity < _deque_->count + count)
+            capacity = _deque_->count + count;
+        if (!d_resize(_deque_, capacity))
+            return 0;
+    }
+    size_t first = _deque_->capacity - _deque_->back;
+    if (first > count)
+        first = count;
+    memcpy(_deque_->buffer + _deque_->back, values, sizeof(size_t) * first);
+    memcpy(_deque_->buffer, values + first, sizeof(size_t) * (count - first));
+    _deque_->back = (_deque_->back + count) % _deque_->capacity;
+    _deque_->count += count;
+    _deque_->flag = CMC_FLAG_OK;
+    if ((_deque_)->callbacks && (_deque_)->callbacks->create)
+        (_deque_)->callbacks->create();
+    ;
+    return 1;
+}
 size_t d_front(struct deque *_deque_)
 {
     if (d_empty(_deque_))
@@ -167,14 +411,27 @@ _Bool d_contains(struct deque *_deque_, size_t value)
 {
     _deque_->flag = CMC_FLAG_OK;
     _Bool result = 0;
-    for (size_t i = _deque_->front, j = 0; j < _deque_->count; j++)
+    if (_deque_->f_val->find)
+    {
+        size_t first = _deque_->capacity - _deque_->front;
+        if (first > _deque_->count)
+            first = _deque_->count;
+        size_t second = _deque_->count - first;
+        result = _deque_->f_val->find(_deque_->buffer + _deque_->front, first, value) < first || _deque_->f_val->find(_deque_->buffer,
+                                                                                                                      second,
+                                                                                                                      value) < second;
+    }
+    else
     {
-        if (_deque_->f_val->cmp(_deque_->buffer[i], value) == 0)
+        for (size_t i = _deque_->front, j = 0; j < _deque_->count; j++)
         {
-            result = 1;
-            break;
+            if (_deque_->f_val->cmp(_deque_->buffer[i], value) == 0)
+            {
+                result = 1;
+                break;
+            }
+            i = (i + 1) % _deque_->capacity;
         }
-        i = (i + 1) % _deque_->capacity;
     }
     if ((_deque_)->callbacks && (_deque_)->callbacks->read)
         (_deque_)->callbacks->read();
@@ -201,6 +458,29 @@ int d_flag(struct deque *_deque_)
 {
     return _deque_->flag;
 }
+void d_sort(struct deque *_deque_)
+{
+    size_t *array = d_impl_contiguous(_deque_);
+    d_impl_sort(array, _deque_->count, _deque_->f_val->cmp, _deque_->alloc);
+    _deque_->flag = CMC_FLAG_OK;
+    if ((_deque_)->callbacks && (_deque_)->callbacks->update)
+        (_deque_)->callbacks->update();
+    ;
+}
+_Bool d_stable_sort(struct deque *_deque_)
+{
+    size_t *array = d_impl_contiguous(_deque_);
+    if (!d_impl_stable_sort(array, _deque_->count, _deque_->f_val->cmp, _deque_->alloc))
+    {
+        _deque_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    _deque_->flag = CMC_FLAG_OK;
+    if ((_deque_)->callbacks && (_deque_)->callbacks->update)
+        (_deque_)->callbacks->update();
+    ;
+    return 1;
+}
 _Bool d_resize(struct deque *_deque_, size_t capacity)
 {
     _deque_->flag = CMC_FLAG_OK;
@@ -233,6 +513,12 @@ success:
     ;
     return 1;
 }
+void d_set_overwrite(struct deque *_deque_, _Bool overwrite, void (*evict)(size_t))
+{
+    _deque_->overwrite = overwrite;
+    _deque_->evict = evict;
+    _deque_->flag = CMC_FLAG_OK;
+}
 struct deque *d_copy_of(struct deque *_deque_)
 {
     struct deque *result = d_new_custom(_deque_->capacity, _deque_->f_val, _deque_->alloc, ((void *)0));
@@ -260,7 +546,9 @@ struct deque *d_copy_of(struct deque *_deque_)
     }
     result->count = _deque_->count;
     result->front = 0;
-    result->back = _deque_->count;
+    result->back = _deque_->count % _deque_->capacity;
+    result->overwrite = _deque_->overwrite;
+    result->evict = _deque_->evict;
     _deque_->flag = CMC_FLAG_OK;
     return result;
 }
@@ -280,6 +568,31 @@ _Bool d_equals(struct deque *_deque1_, struct deque *_deque2_)
     }
     return 1;
 }
+static size_t *d_impl_contiguous(struct deque *_deque_)
+{
+    if (_deque_->front + _deque_->count <= _deque_->capacity)
+        return _deque_->buffer + _deque_->front;
+    size_t ranges[3][2] = { { 0, _deque_->front }, { _deque_->front, _deque_->capacity }, { 0, _deque_->capacity } };
+    for (size_t r = 0; r < 3; r++)
+    {
+        for (size_t i = ranges[r][0], j = ranges[r][1]; i + 1 < j; i++, j--)
+        {
+            size_t _tmp_ = _deque_->buffer[i];
+            _deque_->buffer[i] = _deque_->buffer[j - 1];
+            _deque_->buffer[j - 1] = _tmp_;
+        }
+    }
+    _deque_->front = 0;
+    _deque_->back = _deque_->count % _deque_->capacity;
+    return _deque_->buffer;
+}
+static void d_impl_evict(struct deque *_deque_, size_t value)
+{
+    if (_deque_->evict)
+        _deque_->evict(value);
+    else if (_deque_->f_val->free)
+        _deque_->f_val->free(value);
+}
 struct deque d_init(size_t capacity, struct deque_fval *f_val)
 {
     return d_init_custom(capacity, f_val, ((void *)0), ((void *)0));
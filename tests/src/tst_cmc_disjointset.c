@@ -0,0 +1,456 @@
+
+#include "tst_cmc_disjointset.h"
+
+static void djs_impl_reset(struct disjointset *_set_, size_t from, size_t to);
+static size_t djs_impl_find(struct disjointset *_set_, size_t index);
+static void djs_impl_link(struct disjointset *_set_, size_t root1, size_t root2);
+struct disjointset *djs_new(size_t count, struct disjointset_fval *f_val)
+{
+    return djs_new_custom(count, f_val, ((void *)0), ((void *)0));
+}
+struct disjointset *djs_new_custom(size_t count, struct disjointset_fval *f_val, struct cmc_alloc_node *alloc,
+                                   struct cmc_callbacks *callbacks)
+{
+    ;
+    if (count == 0 || !f_val)
+        return ((void *)0);
+    if (count > 0xffffffffffffffffULL / sizeof(size_t))
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct disjointset *_set_ = alloc->malloc(sizeof(struct disjointset));
+    if (!_set_)
+        return ((void *)0);
+    _set_->parent = alloc->malloc(sizeof(size_t) * count);
+    _set_->rank = alloc->malloc(sizeof(unsigned char) * count);
+    _set_->size = alloc->malloc(sizeof(size_t) * count);
+    _set_->next = alloc->malloc(sizeof(size_t) * count);
+    _set_->prev = alloc->malloc(sizeof(size_t) * count);
+    if (!_set_->parent || !_set_->rank || !_set_->size || !_set_->next || !_set_->prev)
+    {
+        alloc->free(_set_->parent);
+        alloc->free(_set_->rank);
+        alloc->free(_set_->size);
+        alloc->free(_set_->next);
+        alloc->free(_set_->prev);
+        alloc->free(_set_);
+        return ((void *)0);
+    }
+    _set_->count = count;
+    _set_->flag = CMC_FLAG_OK;
+    _set_->f_val = f_val;
+    _set_->alloc = alloc;
+    (_set_)->callbacks = callbacks;
+    djs_impl_reset(_set_, 0, count);
+    _set_->sets = count;
+    return _set_;
+}
+void djs_clear(struct disjointset *_set_)
+{
+    djs_impl_reset(_set_, 0, _set_->count);
+    _set_->sets = _set_->count;
+    _set_->flag = CMC_FLAG_OK;
+}
+void djs_free(struct disjointset *_set_)
+{
+    _set_->alloc->free(_set_->parent);
+    _set_->alloc->free(_set_->rank);
+    _set_->alloc->free(_set_->size);
+    _set_->alloc->free(_set_->next);
+    _set_->alloc->free(_set_->prev);
+    _set_->alloc->free(_set_);
+}
+void djs_customize(struct disjointset *_set_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _set_->alloc = &cmc_alloc_node_default;
+    else
+        _set_->alloc = alloc;
+    (_set_)->callbacks = callbacks;
+    _set_->flag = CMC_FLAG_OK;
+}
+_Bool djs_union(struct disjointset *_set_, size_t value1, size_t value2)
+{
+    if ((size_t)value1 >= _set_->count || (size_t)value2 >= _set_->count)
+    {
+        _set_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    size_t root1 = djs_impl_find(_set_, (size_t)value1);
+    size_t root2 = djs_impl_find(_set_, (size_t)value2);
+    if (root1 == root2)
+    {
+        _set_->flag = CMC_FLAG_DUPLICATE;
+        return 0;
+    }
+    djs_impl_link(_set_, root1, root2);
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->update)
+        (_set_)->callbacks->update();
+    ;
+    return 1;
+}
+_Bool djs_find(struct disjointset *_set_, size_t value, size_t *root)
+{
+    if ((size_t)value >= _set_->count)
+    {
+        _set_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    size_t result = djs_impl_find(_set_, (size_t)value);
+    if (root)
+        *root = (size_t)result;
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool djs_connected(struct disjointset *_set_, size_t value1, size_t value2)
+{
+    if ((size_t)value1 >= _set_->count || (size_t)value2 >= _set_->count)
+    {
+        _set_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    size_t root1 = djs_impl_find(_set_, (size_t)value1);
+    size_t root2 = djs_impl_find(_set_, (size_t)value2);
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return root1 == root2;
+}
+size_t djs_set_size(struct disjointset *_set_, size_t value)
+{
+    if ((size_t)value >= _set_->count)
+    {
+        _set_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    size_t result = _set_->size[djs_impl_find(_set_, (size_t)value)];
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return result;
+}
+size_t djs_set_count(struct disjointset *_set_)
+{
+    return _set_->sets;
+}
+size_t djs_count(struct disjointset *_set_)
+{
+    return _set_->count;
+}
+int djs_flag(struct disjointset *_set_)
+{
+    return _set_->flag;
+}
+_Bool djs_resize(struct disjointset *_set_, size_t count)
+{
+    _set_->flag = CMC_FLAG_OK;
+    if (_set_->count == count)
+        goto success;
+    if (count < _set_->count)
+    {
+        _set_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    if (count > 0xffffffffffffffffULL / sizeof(size_t))
+    {
+        _set_->flag = CMC_FLAG_ERROR;
+        return 0;
+    }
+    size_t *new_parent = _set_->alloc->realloc(_set_->parent, sizeof(size_t) * count);
+    if (!new_parent)
+        goto alloc_error;
+    _set_->parent = new_parent;
+    unsigned char *new_rank = _set_->alloc->realloc(_set_->rank, sizeof(unsigned char) * count);
+    if (!new_rank)
+        goto alloc_error;
+    _set_->rank = new_rank;
+    size_t *new_size = _set_->alloc->realloc(_set_->size, sizeof(size_t) * count);
+    if (!new_size)
+        goto alloc_error;
+    _set_->size = new_size;
+    size_t *new_next = _set_->alloc->realloc(_set_->next, sizeof(size_t) * count);
+    if (!new_next)
+        goto alloc_error;
+    _set_->next = new_next;
+    size_t *new_prev = _set_->alloc->realloc(_set_->prev, sizeof(size_t) * count);
+    if (!new_prev)
+        goto alloc_error;
+    _set_->prev = new_prev;
+    djs_impl_reset(_set_, _set_->count, count);
+    _set_->sets += count - _set_->count;
+    _set_->count = count;
+success:
+    if ((_set_)->callbacks && (_set_)->callbacks->resize)
+        (_set_)->callbacks->resize();
+    ;
+    return 1;
+alloc_error:
+    _set_->flag = CMC_FLAG_ALLOC;
+    return 0;
+}
+struct disjointset *djs_copy_of(struct disjointset *_set_)
+{
+    struct disjointset *result = djs_new_custom(_set_->count, _set_->f_val, _set_->alloc, ((void *)0));
+    if (!result)
+    {
+        _set_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    (result)->callbacks = _set_->callbacks;
+    memcpy(result->parent, _set_->parent, sizeof(size_t) * _set_->count);
+    memcpy(result->rank, _set_->rank, sizeof(unsigned char) * _set_->count);
+    memcpy(result->size, _set_->size, sizeof(size_t) * _set_->count);
+    memcpy(result->next, _set_->next, sizeof(size_t) * _set_->count);
+    memcpy(result->prev, _set_->prev, sizeof(size_t) * _set_->count);
+    result->sets = _set_->sets;
+    _set_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool djs_equals(struct disjointset *_set1_, struct disjointset *_set2_)
+{
+    _set1_->flag = CMC_FLAG_OK;
+    _set2_->flag = CMC_FLAG_OK;
+    if (_set1_->count != _set2_->count || _set1_->sets != _set2_->sets)
+        return 0;
+    for (size_t i = 0; i < _set1_->count; i++)
+    {
+        size_t root1 = djs_impl_find(_set1_, i);
+        if (djs_impl_find(_set2_, i) != djs_impl_find(_set2_, root1))
+            return 0;
+    }
+    return 1;
+}
+static void djs_impl_reset(struct disjointset *_set_, size_t from, size_t to)
+{
+    for (size_t i = from; i < to; i++)
+    {
+        _set_->parent[i] = i;
+        _set_->rank[i] = 0;
+        _set_->size[i] = 1;
+        _set_->next[i] = i;
+        _set_->prev[i] = i;
+    }
+}
+static size_t djs_impl_find(struct disjointset *_set_, size_t index)
+{
+    while (_set_->parent[index] != index)
+    {
+        _set_->parent[index] = _set_->parent[_set_->parent[index]];
+        index = _set_->parent[index];
+    }
+    return index;
+}
+static void djs_impl_link(struct disjointset *_set_, size_t root1, size_t root2)
+{
+    if (_set_->rank[root1] < _set_->rank[root2])
+    {
+        size_t tmp = root1;
+        root1 = root2;
+        root2 = tmp;
+    }
+    else if (_set_->rank[root1] == _set_->rank[root2])
+        _set_->rank[root1]++;
+    _set_->parent[root2] = root1;
+    _set_->size[root1] += _set_->size[root2];
+    size_t next1 = _set_->next[root1];
+    size_t next2 = _set_->next[root2];
+    _set_->next[root1] = next2;
+    _set_->prev[next2] = root1;
+    _set_->next[root2] = next1;
+    _set_->prev[next1] = root2;
+    _set_->sets--;
+}
+struct disjointset_iter djs_iter_start(struct disjointset *target, size_t value)
+{
+    struct disjointset_iter iter;
+    iter.target = target;
+    iter.first = (size_t)value;
+    iter.cursor = (size_t)value;
+    iter.index = 0;
+    iter.count = 0;
+    iter.start = 1;
+    iter.end = 1;
+    if ((size_t)value < target->count)
+    {
+        iter.count = target->size[djs_impl_find(target, (size_t)value)];
+        iter.end = 0;
+    }
+    return iter;
+}
+struct disjointset_iter djs_iter_end(struct disjointset *target, size_t value)
+{
+    struct disjointset_iter iter = djs_iter_start(target, value);
+    if (iter.count > 0)
+    {
+        iter.cursor = target->prev[iter.first];
+        iter.index = iter.count - 1;
+        iter.start = 0;
+        iter.end = 1;
+    }
+    return iter;
+}
+_Bool djs_iter_at_start(struct disjointset_iter *iter)
+{
+    return iter->count == 0 || iter->start;
+}
+_Bool djs_iter_at_end(struct disjointset_iter *iter)
+{
+    return iter->count == 0 || iter->end;
+}
+_Bool djs_iter_to_start(struct disjointset_iter *iter)
+{
+    if (iter->count > 0)
+    {
+        iter->cursor = iter->first;
+        iter->index = 0;
+        iter->start = 1;
+        iter->end = 0;
+        return 1;
+    }
+    return 0;
+}
+_Bool djs_iter_to_end(struct disjointset_iter *iter)
+{
+    if (iter->count > 0)
+    {
+        iter->cursor = iter->target->prev[iter->first];
+        iter->index = iter->count - 1;
+        iter->start = 0;
+        iter->end = 1;
+        return 1;
+    }
+    return 0;
+}
+_Bool djs_iter_next(struct disjointset_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 == iter->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = 0;
+    iter->cursor = iter->target->next[iter->cursor];
+    iter->index++;
+    return 1;
+}
+_Bool djs_iter_prev(struct disjointset_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = 0;
+    iter->cursor = iter->target->prev[iter->cursor];
+    iter->index--;
+    return 1;
+}
+_Bool djs_iter_advance(struct disjointset_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 == iter->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index + steps >= iter->count)
+        return 0;
+    iter->start = 0;
+    for (size_t i = 0; i < steps; i++)
+        iter->cursor = iter->target->next[iter->cursor];
+    iter->index += steps;
+    return 1;
+}
+_Bool djs_iter_rewind(struct disjointset_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index < steps)
+        return 0;
+    iter->end = 0;
+    for (size_t i = 0; i < steps; i++)
+        iter->cursor = iter->target->prev[iter->cursor];
+    iter->index -= steps;
+    return 1;
+}
+_Bool djs_iter_go_to(struct disjointset_iter *iter, size_t index)
+{
+    if (index >= iter->count)
+        return 0;
+    if (iter->index > index)
+        return djs_iter_rewind(iter, iter->index - index);
+    else if (iter->index < index)
+        return djs_iter_advance(iter, index - iter->index);
+    return 1;
+}
+size_t djs_iter_value(struct disjointset_iter *iter)
+{
+    if (iter->count == 0)
+        return (size_t){ 0 };
+    return (size_t)iter->cursor;
+}
+size_t djs_iter_index(struct disjointset_iter *iter)
+{
+    return iter->index;
+}
+_Bool djs_to_string(struct disjointset *_set_, FILE *fptr)
+{
+    struct disjointset *s_ = _set_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "parent:%p, "
+                        "rank:%p, "
+                        "size:%p, "
+                        "next:%p, "
+                        "prev:%p, "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "sets:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks: %p }",
+                        "disjointset", "size_t", s_, s_->parent, s_->rank, s_->size, s_->next, s_->prev, s_->count,
+                        s_->sets, s_->flag, s_->f_val, s_->alloc, (s_)->callbacks);
+}
+_Bool djs_print(struct disjointset *_set_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    for (size_t i = 0; i < _set_->count; i++)
+    {
+        if (_set_->parent[i] != i)
+            continue;
+        fprintf(fptr, "%s", start);
+        size_t cursor = i;
+        do
+        {
+            if (!_set_->f_val->str(fptr, (size_t)cursor))
+                return 0;
+            cursor = _set_->next[cursor];
+            if (cursor != i)
+                fprintf(fptr, "%s", separator);
+        } while (cursor != i);
+        fprintf(fptr, "%s", end);
+    }
+    return 1;
+}
@@ -0,0 +1,522 @@
+
+#include "tst_cmc_eliasfano.h"
+
+static uint64_t ef_impl_low(struct eliasfano *_ef_, size_t index);
+static size_t ef_impl_select(struct eliasfano *_ef_, size_t rank, _Bool bit);
+static size_t ef_impl_popcount(uint64_t bits);
+static size_t ef_impl_lowest_bit(uint64_t bits);
+struct eliasfano *ef_new(size_t *values, size_t count)
+{
+    return ef_new_custom(values, count, ((void *)0), ((void *)0));
+}
+struct eliasfano *ef_new_custom(size_t *values, size_t count, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!values && count > 0)
+        return ((void *)0);
+    for (size_t i = 1; i < count; i++)
+    {
+        if (values[i] < values[i - 1])
+            return ((void *)0);
+    }
+    uint64_t universe = count > 0 ? (uint64_t)values[count - 1] : 0;
+    size_t low_bits = 0;
+    for (uint64_t q = count > 0 ? universe / count : 0; q > 1; q >>= 1)
+        low_bits++;
+    size_t high = (size_t)(universe >> low_bits) + 1;
+    if (count > 0xffffffffffffffffULL / 64 || high > 0xffffffffffffffffULL - count - 64)
+        return ((void *)0);
+    size_t length = count + high;
+    size_t lower_words = (count * low_bits + 63) / 64;
+    size_t upper_words = (length + 63) / 64;
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct eliasfano *_ef_ = alloc->malloc(sizeof(struct eliasfano));
+    if (!_ef_)
+        return ((void *)0);
+    _ef_->lower = alloc->calloc(lower_words + 1, sizeof(uint64_t));
+    _ef_->upper = alloc->calloc(upper_words, sizeof(uint64_t));
+    _ef_->ones = alloc->malloc(sizeof(size_t) * (count / 256 + 1));
+    _ef_->zeros = alloc->malloc(sizeof(size_t) * (high / 256 + 1));
+    if (!_ef_->lower || !_ef_->upper || !_ef_->ones || !_ef_->zeros)
+    {
+        alloc->free(_ef_->lower);
+        alloc->free(_ef_->upper);
+        alloc->free(_ef_->ones);
+        alloc->free(_ef_->zeros);
+        alloc->free(_ef_);
+        return ((void *)0);
+    }
+    uint64_t low_mask = ((uint64_t)1 << low_bits) - 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t value = (uint64_t)values[i];
+        size_t position = (size_t)(value >> low_bits) + i;
+        _ef_->upper[position / 64] |= (uint64_t)1 << (position % 64);
+        if (low_bits > 0)
+        {
+            uint64_t low = value & low_mask;
+            size_t offset = i * low_bits;
+            _ef_->lower[offset / 64] |= low << (offset % 64);
+            if (offset % 64 + low_bits > 64)
+                _ef_->lower[offset / 64 + 1] |= low >> (64 - offset % 64);
+        }
+    }
+    size_t ones = 0;
+    size_t zeros = 0;
+    for (size_t position = 0; position < length; position++)
+    {
+        if (_ef_->upper[position / 64] & ((uint64_t)1 << (position % 64)))
+        {
+            if (ones % 256 == 0)
+                _ef_->ones[ones / 256] = position;
+            ones++;
+        }
+        else
+        {
+            if (zeros % 256 == 0)
+                _ef_->zeros[zeros / 256] = position;
+            zeros++;
+        }
+    }
+    _ef_->count = count;
+    _ef_->low_bits = low_bits;
+    _ef_->length = length;
+    _ef_->lower_words = lower_words + 1;
+    _ef_->flag = CMC_FLAG_OK;
+    _ef_->alloc = alloc;
+    (_ef_)->callbacks = callbacks;
+    return _ef_;
+}
+void ef_free(struct eliasfano *_ef_)
+{
+    _ef_->alloc->free(_ef_->lower);
+    _ef_->alloc->free(_ef_->upper);
+    _ef_->alloc->free(_ef_->ones);
+    _ef_->alloc->free(_ef_->zeros);
+    _ef_->alloc->free(_ef_);
+}
+void ef_customize(struct eliasfano *_ef_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _ef_->alloc = &cmc_alloc_node_default;
+    else
+        _ef_->alloc = alloc;
+    (_ef_)->callbacks = callbacks;
+    _ef_->flag = CMC_FLAG_OK;
+}
+size_t ef_get(struct eliasfano *_ef_, size_t index)
+{
+    if (ef_empty(_ef_))
+    {
+        _ef_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    if (index >= _ef_->count)
+    {
+        _ef_->flag = CMC_FLAG_RANGE;
+        return (size_t){ 0 };
+    }
+    uint64_t high = ef_impl_select(_ef_, index, 1) - index;
+    _ef_->flag = CMC_FLAG_OK;
+    if ((_ef_)->callbacks && (_ef_)->callbacks->read)
+        (_ef_)->callbacks->read();
+    ;
+    return (size_t)((high << _ef_->low_bits) | ef_impl_low(_ef_, index));
+}
+_Bool ef_next_geq(struct eliasfano *_ef_, size_t value, size_t *index, size_t *result)
+{
+    if (ef_empty(_ef_))
+    {
+        _ef_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    _ef_->flag = CMC_FLAG_OK;
+    uint64_t high = (uint64_t)value >> _ef_->low_bits;
+    uint64_t low = (uint64_t)value & (((uint64_t)1 << _ef_->low_bits) - 1);
+    if (high >= _ef_->length - _ef_->count)
+    {
+        _ef_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    size_t position = high == 0 ? 0 : ef_impl_select(_ef_, (size_t)high - 1, 0) + 1;
+    size_t i = position - (size_t)high;
+    while (position < _ef_->length && (_ef_->upper[position / 64] & ((uint64_t)1 << (position % 64))))
+    {
+        if (ef_impl_low(_ef_, i) >= low)
+            break;
+        position++;
+        i++;
+    }
+    if (i == _ef_->count)
+    {
+        _ef_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (index)
+        *index = i;
+    if (result)
+    {
+        uint64_t value_high = ef_impl_select(_ef_, i, 1) - i;
+        *result = (size_t)((value_high << _ef_->low_bits) | ef_impl_low(_ef_, i));
+    }
+    if ((_ef_)->callbacks && (_ef_)->callbacks->read)
+        (_ef_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool ef_contains(struct eliasfano *_ef_, size_t value)
+{
+    size_t result;
+    if (ef_empty(_ef_))
+    {
+        _ef_->flag = CMC_FLAG_OK;
+        return 0;
+    }
+    _Bool found = ef_next_geq(_ef_, value, ((void *)0), &result) && result == value;
+    _ef_->flag = CMC_FLAG_OK;
+    return found;
+}
+_Bool ef_empty(struct eliasfano *_ef_)
+{
+    return _ef_->count == 0;
+}
+size_t ef_count(struct eliasfano *_ef_)
+{
+    return _ef_->count;
+}
+size_t ef_memory(struct eliasfano *_ef_)
+{
+    size_t upper_words = (_ef_->length + 63) / 64;
+    size_t samples = _ef_->count / 256 + (_ef_->length - _ef_->count) / 256 + 2;
+    return sizeof(uint64_t) * (_ef_->lower_words + upper_words) + sizeof(size_t) * samples;
+}
+int ef_flag(struct eliasfano *_ef_)
+{
+    return _ef_->flag;
+}
+struct eliasfano *ef_copy_of(struct eliasfano *_ef_)
+{
+    struct cmc_alloc_node *alloc = _ef_->alloc;
+    struct eliasfano *result = alloc->malloc(sizeof(struct eliasfano));
+    if (!result)
+    {
+        _ef_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    size_t upper_words = (_ef_->length + 63) / 64;
+    size_t ones = _ef_->count / 256 + 1;
+    size_t zeros = (_ef_->length - _ef_->count) / 256 + 1;
+    result->lower = alloc->malloc(sizeof(uint64_t) * _ef_->lower_words);
+    result->upper = alloc->malloc(sizeof(uint64_t) * upper_words);
+    result->ones = alloc->malloc(sizeof(size_t) * ones);
+    result->zeros = alloc->malloc(sizeof(size_t) * zeros);
+    if (!result->lower || !result->upper || !result->ones || !result->zeros)
+    {
+        alloc->free(result->lower);
+        alloc->free(result->upper);
+        alloc->free(result->ones);
+        alloc->free(result->zeros);
+        alloc->free(result);
+        _ef_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    memcpy(result->lower, _ef_->lower, sizeof(uint64_t) * _ef_->lower_words);
+    memcpy(result->upper, _ef_->upper, sizeof(uint64_t) * upper_words);
+    memcpy(result->ones, _ef_->ones, sizeof(size_t) * ones);
+    memcpy(result->zeros, _ef_->zeros, sizeof(size_t) * zeros);
+    result->count = _ef_->count;
+    result->low_bits = _ef_->low_bits;
+    result->length = _ef_->length;
+    result->lower_words = _ef_->lower_words;
+    result->flag = CMC_FLAG_OK;
+    result->alloc = alloc;
+    (result)->callbacks = _ef_->callbacks;
+    _ef_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool ef_equals(struct eliasfano *_ef1_, struct eliasfano *_ef2_)
+{
+    _ef1_->flag = CMC_FLAG_OK;
+    _ef2_->flag = CMC_FLAG_OK;
+    if (_ef1_->count != _ef2_->count || _ef1_->low_bits != _ef2_->low_bits || _ef1_->length != _ef2_->length)
+        return 0;
+    if (memcmp(_ef1_->lower, _ef2_->lower, sizeof(uint64_t) * _ef1_->lower_words) != 0)
+        return 0;
+    return memcmp(_ef1_->upper, _ef2_->upper, sizeof(uint64_t) * ((_ef1_->length + 63) / 64)) == 0;
+}
+struct eliasfano *ef_intersection(struct eliasfano *_ef1_, struct eliasfano *_ef2_)
+{
+    size_t capacity = _ef1_->count < _ef2_->count ? _ef1_->count : _ef2_->count;
+    size_t *buffer = _ef1_->alloc->malloc(sizeof(size_t) * (capacity + 1));
+    if (!buffer)
+    {
+        _ef1_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    size_t count = 0;
+    size_t i = 0;
+    size_t j = 0;
+    size_t value1;
+    size_t value2;
+    if (ef_next_geq(_ef1_, (size_t){ 0 }, &i, &value1))
+    {
+        while (ef_next_geq(_ef2_, value1, &j, &value2))
+        {
+            if (value1 == value2)
+            {
+                if (count == 0 || buffer[count - 1] != value1)
+                    buffer[count++] = value1;
+                if (++i == _ef1_->count)
+                    break;
+                value1 = ef_get(_ef1_, i);
+            }
+            else if (!ef_next_geq(_ef1_, value2, &i, &value1))
+                break;
+        }
+    }
+    struct eliasfano *result = ef_new_custom(buffer, count, _ef1_->alloc, ((void *)0));
+    _ef1_->alloc->free(buffer);
+    if (!result)
+    {
+        _ef1_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    (result)->callbacks = _ef1_->callbacks;
+    _ef1_->flag = CMC_FLAG_OK;
+    _ef2_->flag = CMC_FLAG_OK;
+    return result;
+}
+static uint64_t ef_impl_low(struct eliasfano *_ef_, size_t index)
+{
+    if (_ef_->low_bits == 0)
+        return 0;
+    size_t offset = index * _ef_->low_bits;
+    uint64_t low = _ef_->lower[offset / 64] >> (offset % 64);
+    if (offset % 64 + _ef_->low_bits > 64)
+        low |= _ef_->lower[offset / 64 + 1] << (64 - offset % 64);
+    return low & (((uint64_t)1 << _ef_->low_bits) - 1);
+}
+static size_t ef_impl_select(struct eliasfano *_ef_, size_t rank, _Bool bit)
+{
+    size_t *samples = bit ? _ef_->ones : _ef_->zeros;
+    size_t position = samples[rank / 256];
+    rank %= 256;
+    size_t w = position / 64;
+    uint64_t word = bit ? _ef_->upper[w] : ~_ef_->upper[w];
+    word &= ~(uint64_t)0 << (position % 64);
+    while (1)
+    {
+        size_t popcount = ef_impl_popcount(word);
+        if (rank < popcount)
+            break;
+        rank -= popcount;
+        w++;
+        word = bit ? _ef_->upper[w] : ~_ef_->upper[w];
+    }
+    for (size_t i = 0; i < rank; i++)
+        word &= word - 1;
+    return w * 64 + ef_impl_lowest_bit(word);
+}
+static size_t ef_impl_popcount(uint64_t bits)
+{
+    bits = bits - ((bits >> 1) & 0x5555555555555555UL);
+    bits = (bits & 0x3333333333333333UL) + ((bits >> 2) & 0x3333333333333333UL);
+    bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0fUL;
+    return (size_t)((bits * 0x0101010101010101UL) >> 56);
+}
+static size_t ef_impl_lowest_bit(uint64_t bits)
+{
+    static const unsigned char table[64] = { 0, 1, 56, 2, 57, 49, 28, 3, 61, 58, 42, 50, 38, 29, 17, 4, 62, 47, 59, 36, 45, 43, 51, 22, 53, 39, 33, 30, 24, 18, 12, 5, 63, 55, 48, 27, 60, 41, 37, 16, 46, 35, 44, 21, 52, 32, 23, 11, 54, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6 };
+    return table[((bits & (~bits + 1)) * 0x03f79d71b4ca8b09UL) >> 58];
+}
+struct eliasfano_iter ef_iter_start(struct eliasfano *target)
+{
+    struct eliasfano_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.index = 0;
+    iter.start = 1;
+    iter.end = ef_empty(target);
+    if (!iter.end)
+        iter.cursor = ef_impl_select(target, 0, 1);
+    return iter;
+}
+struct eliasfano_iter ef_iter_end(struct eliasfano *target)
+{
+    struct eliasfano_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.index = 0;
+    iter.start = ef_empty(target);
+    iter.end = 1;
+    if (!iter.start)
+    {
+        iter.index = target->count - 1;
+        iter.cursor = ef_impl_select(target, iter.index, 1);
+    }
+    return iter;
+}
+_Bool ef_iter_at_start(struct eliasfano_iter *iter)
+{
+    return ef_empty(iter->target) || iter->start;
+}
+_Bool ef_iter_at_end(struct eliasfano_iter *iter)
+{
+    return ef_empty(iter->target) || iter->end;
+}
+_Bool ef_iter_to_start(struct eliasfano_iter *iter)
+{
+    if (!ef_empty(iter->target))
+    {
+        iter->cursor = ef_impl_select(iter->target, 0, 1);
+        iter->index = 0;
+        iter->start = 1;
+        iter->end = 0;
+        return 1;
+    }
+    return 0;
+}
+_Bool ef_iter_to_end(struct eliasfano_iter *iter)
+{
+    if (!ef_empty(iter->target))
+    {
+        iter->index = iter->target->count - 1;
+        iter->cursor = ef_impl_select(iter->target, iter->index, 1);
+        iter->start = 0;
+        iter->end = 1;
+        return 1;
+    }
+    return 0;
+}
+_Bool ef_iter_next(struct eliasfano_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 == iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = 0;
+    size_t position = iter->cursor + 1;
+    size_t w = position / 64;
+    uint64_t word = iter->target->upper[w] & (~(uint64_t)0 << (position % 64));
+    while (!word)
+        word = iter->target->upper[++w];
+    iter->cursor = w * 64 + ef_impl_lowest_bit(word);
+    iter->index++;
+    return 1;
+}
+_Bool ef_iter_prev(struct eliasfano_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = 0;
+    iter->index--;
+    iter->cursor = ef_impl_select(iter->target, iter->index, 1);
+    return 1;
+}
+_Bool ef_iter_advance(struct eliasfano_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 == iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index + steps >= iter->target->count)
+        return 0;
+    iter->start = 0;
+    iter->index += steps;
+    iter->cursor = ef_impl_select(iter->target, iter->index, 1);
+    return 1;
+}
+_Bool ef_iter_rewind(struct eliasfano_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index < steps)
+        return 0;
+    iter->end = 0;
+    iter->index -= steps;
+    iter->cursor = ef_impl_select(iter->target, iter->index, 1);
+    return 1;
+}
+_Bool ef_iter_go_to(struct eliasfano_iter *iter, size_t index)
+{
+    if (index >= iter->target->count)
+        return 0;
+    if (iter->index > index)
+        return ef_iter_rewind(iter, iter->index - index);
+    else if (iter->index < index)
+        return ef_iter_advance(iter, index - iter->index);
+    return 1;
+}
+size_t ef_iter_value(struct eliasfano_iter *iter)
+{
+    if (ef_empty(iter->target))
+        return (size_t){ 0 };
+    uint64_t high = iter->cursor - iter->index;
+    return (size_t)((high << iter->target->low_bits) | ef_impl_low(iter->target, iter->index));
+}
+size_t ef_iter_index(struct eliasfano_iter *iter)
+{
+    return iter->index;
+}
+_Bool ef_to_string(struct eliasfano *_ef_, FILE *fptr)
+{
+    struct eliasfano *e_ = _ef_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "lower:%p, "
+                        "upper:%p, "
+                        "ones:%p, "
+                        "zeros:%p, "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "low_bits:%"
+                        "I64u"
+                        ", "
+                        "length:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "alloc:%p, "
+                        "callbacks: %p }",
+                        "eliasfano", "size_t", e_, e_->lower, e_->upper, e_->ones, e_->zeros, e_->count, e_->low_bits,
+                        e_->length, e_->flag, e_->alloc, (e_)->callbacks);
+}
+_Bool ef_print(struct eliasfano *_ef_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    fprintf(fptr, "%s", start);
+    for (size_t i = 0; i < _ef_->count; i++)
+    {
+        uint64_t high = ef_impl_select(_ef_, i, 1) - i;
+        size_t value = (size_t)((high << _ef_->low_bits) | ef_impl_low(_ef_, i));
+        if (fprintf(fptr,
+                    "%"
+                    "I64u",
+                    (uintmax_t)value) < 0)
+            return 0;
+        if (i + 1 < _ef_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
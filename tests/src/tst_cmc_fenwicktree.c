@@ -0,0 +1,240 @@
+
+#include "tst_cmc_fenwicktree.h"
+
+struct fenwicktree *fwt_new(size_t *values, size_t count, struct fenwicktree_fval *f_val)
+{
+    return fwt_new_custom(values, count, f_val, ((void *)0), ((void *)0));
+}
+struct fenwicktree *fwt_new_custom(size_t *values, size_t count, struct fenwicktree_fval *f_val,
+                                   struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!values || count == 0 || !f_val || !f_val->combine)
+        return ((void *)0);
+    if (count > 0xffffffffffffffffULL / sizeof(size_t))
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct fenwicktree *_tree_ = alloc->malloc(sizeof(struct fenwicktree));
+    if (!_tree_)
+        return ((void *)0);
+    _tree_->values = alloc->malloc(sizeof(size_t) * count);
+    if (!_tree_->values)
+    {
+        alloc->free(_tree_);
+        return ((void *)0);
+    }
+    _tree_->tree = alloc->malloc(sizeof(size_t) * count);
+    if (!_tree_->tree)
+    {
+        alloc->free(_tree_->values);
+        alloc->free(_tree_);
+        return ((void *)0);
+    }
+    _tree_->mirror = alloc->malloc(sizeof(size_t) * count);
+    if (!_tree_->mirror)
+    {
+        alloc->free(_tree_->values);
+        alloc->free(_tree_->tree);
+        alloc->free(_tree_);
+        return ((void *)0);
+    }
+    memcpy(_tree_->values, values, sizeof(size_t) * count);
+    memcpy(_tree_->tree, values, sizeof(size_t) * count);
+    memcpy(_tree_->mirror, values, sizeof(size_t) * count);
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t parent = i | (i + 1);
+        if (parent < count)
+            _tree_->tree[parent] = f_val->combine(_tree_->tree[parent], _tree_->tree[i]);
+    }
+    for (size_t i = count; i > 0; i--)
+    {
+        size_t parent = i & (i - 1);
+        if (parent > 0)
+            _tree_->mirror[parent - 1] = f_val->combine(_tree_->mirror[parent - 1], _tree_->mirror[i - 1]);
+    }
+    _tree_->count = count;
+    _tree_->flag = CMC_FLAG_OK;
+    _tree_->f_val = f_val;
+    _tree_->alloc = alloc;
+    (_tree_)->callbacks = callbacks;
+    return _tree_;
+}
+void fwt_free(struct fenwicktree *_tree_)
+{
+    _tree_->alloc->free(_tree_->values);
+    _tree_->alloc->free(_tree_->tree);
+    _tree_->alloc->free(_tree_->mirror);
+    _tree_->alloc->free(_tree_);
+}
+void fwt_customize(struct fenwicktree *_tree_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _tree_->alloc = &cmc_alloc_node_default;
+    else
+        _tree_->alloc = alloc;
+    (_tree_)->callbacks = callbacks;
+    _tree_->flag = CMC_FLAG_OK;
+}
+_Bool fwt_update(struct fenwicktree *_tree_, size_t index, size_t value)
+{
+    if (index >= _tree_->count)
+    {
+        _tree_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    _tree_->values[index] = _tree_->f_val->combine(_tree_->values[index], value);
+    for (size_t i = index; i < _tree_->count; i |= i + 1)
+        _tree_->tree[i] = _tree_->f_val->combine(_tree_->tree[i], value);
+    for (size_t i = index + 1; i > 0; i &= i - 1)
+        _tree_->mirror[i - 1] = _tree_->f_val->combine(_tree_->mirror[i - 1], value);
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->update)
+        (_tree_)->callbacks->update();
+    ;
+    return 1;
+}
+size_t fwt_get(struct fenwicktree *_tree_, size_t index)
+{
+    if (index >= _tree_->count)
+    {
+        _tree_->flag = CMC_FLAG_RANGE;
+        return (size_t){ 0 };
+    }
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->read)
+        (_tree_)->callbacks->read();
+    ;
+    return _tree_->values[index];
+}
+size_t fwt_prefix(struct fenwicktree *_tree_, size_t index)
+{
+    return fwt_query(_tree_, 0, index);
+}
+size_t fwt_query(struct fenwicktree *_tree_, size_t from, size_t to)
+{
+    if (from > to)
+    {
+        _tree_->flag = CMC_FLAG_INVALID;
+        return (size_t){ 0 };
+    }
+    if (to >= _tree_->count)
+    {
+        _tree_->flag = CMC_FLAG_RANGE;
+        return (size_t){ 0 };
+    }
+    size_t start = from + 1;
+    size_t end = to + 1;
+    size_t left = (size_t){ 0 };
+    size_t right = (size_t){ 0 };
+    _Bool has_left = 0;
+    _Bool has_right = 0;
+    while (start + (start & (~start + 1)) - 1 <= end)
+    {
+        size_t block = _tree_->mirror[start - 1];
+        left = has_left ? _tree_->f_val->combine(left, block) : block;
+        has_left = 1;
+        start += start & (~start + 1);
+    }
+    while (end >= start && (end & (end - 1)) + 1 >= start)
+    {
+        size_t block = _tree_->tree[end - 1];
+        right = has_right ? _tree_->f_val->combine(block, right) : block;
+        has_right = 1;
+        end &= end - 1;
+    }
+    if (end >= start)
+    {
+        size_t value = _tree_->values[end - 1];
+        right = has_right ? _tree_->f_val->combine(value, right) : value;
+        has_right = 1;
+    }
+    size_t result;
+    if (has_left && has_right)
+        result = _tree_->f_val->combine(left, right);
+    else if (has_left)
+        result = left;
+    else
+        result = right;
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->read)
+        (_tree_)->callbacks->read();
+    ;
+    return result;
+}
+size_t fwt_count(struct fenwicktree *_tree_)
+{
+    return _tree_->count;
+}
+int fwt_flag(struct fenwicktree *_tree_)
+{
+    return _tree_->flag;
+}
+struct fenwicktree *fwt_copy_of(struct fenwicktree *_tree_)
+{
+    struct fenwicktree *result =
+        fwt_new_custom(_tree_->values, _tree_->count, _tree_->f_val, _tree_->alloc, ((void *)0));
+    if (!result)
+    {
+        _tree_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    (result)->callbacks = _tree_->callbacks;
+    if (_tree_->f_val->cpy)
+    {
+        for (size_t i = 0; i < _tree_->count; i++)
+        {
+            result->values[i] = _tree_->f_val->cpy(_tree_->values[i]);
+            result->tree[i] = _tree_->f_val->cpy(_tree_->tree[i]);
+            result->mirror[i] = _tree_->f_val->cpy(_tree_->mirror[i]);
+        }
+    }
+    _tree_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool fwt_equals(struct fenwicktree *_tree1_, struct fenwicktree *_tree2_)
+{
+    _tree1_->flag = CMC_FLAG_OK;
+    _tree2_->flag = CMC_FLAG_OK;
+    if (_tree1_->count != _tree2_->count)
+        return 0;
+    for (size_t i = 0; i < _tree1_->count; i++)
+    {
+        if (_tree1_->f_val->cmp(_tree1_->values[i], _tree2_->values[i]) != 0)
+            return 0;
+    }
+    return 1;
+}
+_Bool fwt_to_string(struct fenwicktree *_tree_, FILE *fptr)
+{
+    struct fenwicktree *t_ = _tree_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "values:%p, "
+                        "tree:%p, "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks: %p }",
+                        "fenwicktree", "size_t", t_, t_->values, t_->tree, t_->count, t_->flag, t_->f_val, t_->alloc,
+                        (t_)->callbacks);
+}
+_Bool fwt_print(struct fenwicktree *_tree_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    fprintf(fptr, "%s", start);
+    for (size_t i = 0; i < _tree_->count; i++)
+    {
+        if (!_tree_->f_val->str(fptr, _tree_->values[i]))
+            return 0;
+        if (i + 1 < _tree_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
@@ -0,0 +1,543 @@
+
+#include "tst_cmc_gapbuffer.h"
+
+static size_t gb_impl_position(struct gapbuffer *_gb_, size_t index);
+static void gb_impl_move_gap(struct gapbuffer *_gb_, size_t index);
+struct gapbuffer *gb_new(size_t capacity, struct gapbuffer_fval *f_val)
+{
+    return gb_new_custom(capacity, f_val, ((void *)0), ((void *)0));
+}
+struct gapbuffer *gb_new_custom(size_t capacity, struct gapbuffer_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks)
+{
+    ;
+    if (capacity < 1)
+        return ((void *)0);
+    if (!f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct gapbuffer *_gb_ = alloc->malloc(sizeof(struct gapbuffer));
+    if (!_gb_)
+        return ((void *)0);
+    _gb_->buffer = alloc->calloc(capacity, sizeof(size_t));
+    if (!_gb_->buffer)
+    {
+        alloc->free(_gb_);
+        return ((void *)0);
+    }
+    _gb_->capacity = capacity;
+    _gb_->count = 0;
+    _gb_->gap = 0;
+    _gb_->flag = CMC_FLAG_OK;
+    _gb_->f_val = f_val;
+    _gb_->alloc = alloc;
+    (_gb_)->callbacks = callbacks;
+    return _gb_;
+}
+void gb_clear(struct gapbuffer *_gb_)
+{
+    if (_gb_->f_val->free)
+    {
+        for (size_t i = 0; i < _gb_->count; i++)
+            _gb_->f_val->free(_gb_->buffer[gb_impl_position(_gb_, i)]);
+    }
+    memset(_gb_->buffer, 0, sizeof(size_t) * _gb_->capacity);
+    _gb_->count = 0;
+    _gb_->gap = 0;
+    _gb_->flag = CMC_FLAG_OK;
+}
+void gb_free(struct gapbuffer *_gb_)
+{
+    if (_gb_->f_val->free)
+    {
+        for (size_t i = 0; i < _gb_->count; i++)
+            _gb_->f_val->free(_gb_->buffer[gb_impl_position(_gb_, i)]);
+    }
+    _gb_->alloc->free(_gb_->buffer);
+    _gb_->alloc->free(_gb_);
+}
+void gb_customize(struct gapbuffer *_gb_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _gb_->alloc = &cmc_alloc_node_default;
+    else
+        _gb_->alloc = alloc;
+    (_gb_)->callbacks = callbacks;
+    _gb_->flag = CMC_FLAG_OK;
+}
+_Bool gb_push_front(struct gapbuffer *_gb_, size_t value)
+{
+    return gb_push_at(_gb_, value, 0);
+}
+_Bool gb_push_at(struct gapbuffer *_gb_, size_t value, size_t index)
+{
+    if (index > _gb_->count)
+    {
+        _gb_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    if (gb_full(_gb_))
+    {
+        if (!gb_resize(_gb_, _gb_->count * 2))
+            return 0;
+    }
+    gb_impl_move_gap(_gb_, index);
+    _gb_->buffer[_gb_->gap++] = value;
+    _gb_->count++;
+    _gb_->flag = CMC_FLAG_OK;
+    if ((_gb_)->callbacks && (_gb_)->callbacks->create)
+        (_gb_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool gb_push_back(struct gapbuffer *_gb_, size_t value)
+{
+    return gb_push_at(_gb_, value, _gb_->count);
+}
+_Bool gb_pop_front(struct gapbuffer *_gb_)
+{
+    return gb_pop_at(_gb_, 0);
+}
+_Bool gb_pop_at(struct gapbuffer *_gb_, size_t index)
+{
+    if (gb_empty(_gb_))
+    {
+        _gb_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    if (index >= _gb_->count)
+    {
+        _gb_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    gb_impl_move_gap(_gb_, index);
+    _gb_->buffer[_gb_->gap + _gb_->capacity - _gb_->count] = (size_t){ 0 };
+    _gb_->count--;
+    _gb_->flag = CMC_FLAG_OK;
+    if ((_gb_)->callbacks && (_gb_)->callbacks->delete)
+        (_gb_)->callbacks->delete ();
+    ;
+    return 1;
+}
+_Bool gb_pop_back(struct gapbuffer *_gb_)
+{
+    if (gb_empty(_gb_))
+    {
+        _gb_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    return gb_pop_at(_gb_, _gb_->count - 1);
+}
+_Bool gb_move_cursor(struct gapbuffer *_gb_, size_t index)
+{
+    if (index > _gb_->count)
+    {
+        _gb_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    gb_impl_move_gap(_gb_, index);
+    _gb_->flag = CMC_FLAG_OK;
+    return 1;
+}
+size_t gb_cursor(struct gapbuffer *_gb_)
+{
+    return _gb_->gap;
+}
+size_t gb_front(struct gapbuffer *_gb_)
+{
+    if (gb_empty(_gb_))
+    {
+        _gb_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    _gb_->flag = CMC_FLAG_OK;
+    if ((_gb_)->callbacks && (_gb_)->callbacks->read)
+        (_gb_)->callbacks->read();
+    ;
+    return _gb_->buffer[gb_impl_position(_gb_, 0)];
+}
+size_t gb_get(struct gapbuffer *_gb_, size_t index)
+{
+    if (gb_empty(_gb_))
+    {
+        _gb_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    if (index >= _gb_->count)
+    {
+        _gb_->flag = CMC_FLAG_RANGE;
+        return (size_t){ 0 };
+    }
+    _gb_->flag = CMC_FLAG_OK;
+    if ((_gb_)->callbacks && (_gb_)->callbacks->read)
+        (_gb_)->callbacks->read();
+    ;
+    return _gb_->buffer[gb_impl_position(_gb_, index)];
+}
+size_t *gb_get_ref(struct gapbuffer *_gb_, size_t index)
+{
+    if (gb_empty(_gb_))
+    {
+        _gb_->flag = CMC_FLAG_EMPTY;
+        return ((void *)0);
+    }
+    if (index >= _gb_->count)
+    {
+        _gb_->flag = CMC_FLAG_RANGE;
+        return ((void *)0);
+    }
+    _gb_->flag = CMC_FLAG_OK;
+    if ((_gb_)->callbacks && (_gb_)->callbacks->read)
+        (_gb_)->callbacks->read();
+    ;
+    return &(_gb_->buffer[gb_impl_position(_gb_, index)]);
+}
+size_t gb_back(struct gapbuffer *_gb_)
+{
+    if (gb_empty(_gb_))
+    {
+        _gb_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    _gb_->flag = CMC_FLAG_OK;
+    if ((_gb_)->callbacks && (_gb_)->callbacks->read)
+        (_gb_)->callbacks->read();
+    ;
+    return _gb_->buffer[gb_impl_position(_gb_, _gb_->count - 1)];
+}
+size_t gb_index_of(struct gapbuffer *_gb_, size_t value, _Bool from_start)
+{
+    _gb_->flag = CMC_FLAG_OK;
+    size_t result = _gb_->count;
+    if (from_start)
+    {
+        for (size_t i = 0; i < _gb_->count; i++)
+        {
+            if (_gb_->f_val->cmp(_gb_->buffer[gb_impl_position(_gb_, i)], value) == 0)
+            {
+                result = i;
+                break;
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = _gb_->count; i > 0; i--)
+        {
+            if (_gb_->f_val->cmp(_gb_->buffer[gb_impl_position(_gb_, i - 1)], value) == 0)
+            {
+                result = i - 1;
+                break;
+            }
+        }
+    }
+    if ((_gb_)->callbacks && (_gb_)->callbacks->read)
+        (_gb_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool gb_contains(struct gapbuffer *_gb_, size_t value)
+{
+    _gb_->flag = CMC_FLAG_OK;
+    _Bool result = 0;
+    for (size_t i = 0; i < _gb_->count; i++)
+    {
+        if (_gb_->f_val->cmp(_gb_->buffer[gb_impl_position(_gb_, i)], value) == 0)
+        {
+            result = 1;
+            break;
+        }
+    }
+    if ((_gb_)->callbacks && (_gb_)->callbacks->read)
+        (_gb_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool gb_empty(struct gapbuffer *_gb_)
+{
+    return _gb_->count == 0;
+}
+_Bool gb_full(struct gapbuffer *_gb_)
+{
+    return _gb_->count >= _gb_->capacity;
+}
+size_t gb_count(struct gapbuffer *_gb_)
+{
+    return _gb_->count;
+}
+_Bool gb_fits(struct gapbuffer *_gb_, size_t size)
+{
+    return _gb_->count + size <= _gb_->capacity;
+}
+size_t gb_capacity(struct gapbuffer *_gb_)
+{
+    return _gb_->capacity;
+}
+int gb_flag(struct gapbuffer *_gb_)
+{
+    return _gb_->flag;
+}
+_Bool gb_resize(struct gapbuffer *_gb_, size_t capacity)
+{
+    _gb_->flag = CMC_FLAG_OK;
+    if (_gb_->capacity == capacity)
+        return 1;
+    if (capacity < _gb_->count || capacity < 1)
+    {
+        _gb_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    size_t tail = _gb_->count - _gb_->gap;
+    if (capacity < _gb_->capacity)
+    {
+        memmove(_gb_->buffer + capacity - tail, _gb_->buffer + _gb_->capacity - tail, sizeof(size_t) * tail);
+    }
+    size_t *new_buffer = _gb_->alloc->realloc(_gb_->buffer, sizeof(size_t) * capacity);
+    if (!new_buffer)
+    {
+        if (capacity < _gb_->capacity)
+        {
+            memmove(_gb_->buffer + _gb_->capacity - tail, _gb_->buffer + capacity - tail, sizeof(size_t) * tail);
+        }
+        _gb_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    if (capacity > _gb_->capacity)
+    {
+        memmove(new_buffer + capacity - tail, new_buffer + _gb_->capacity - tail, sizeof(size_t) * tail);
+    }
+    _gb_->buffer = new_buffer;
+    _gb_->capacity = capacity;
+    if ((_gb_)->callbacks && (_gb_)->callbacks->resize)
+        (_gb_)->callbacks->resize();
+    ;
+    return 1;
+}
+struct gapbuffer *gb_copy_of(struct gapbuffer *_gb_)
+{
+    struct gapbuffer *result = gb_new_custom(_gb_->capacity, _gb_->f_val, _gb_->alloc, ((void *)0));
+    if (!result)
+    {
+        _gb_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    (result)->callbacks = _gb_->callbacks;
+    for (size_t i = 0; i < _gb_->count; i++)
+    {
+        size_t value = _gb_->buffer[gb_impl_position(_gb_, i)];
+        if (_gb_->f_val->cpy)
+            result->buffer[i] = _gb_->f_val->cpy(value);
+        else
+            result->buffer[i] = value;
+    }
+    result->count = _gb_->count;
+    result->gap = _gb_->count;
+    _gb_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool gb_equals(struct gapbuffer *_gb1_, struct gapbuffer *_gb2_)
+{
+    _gb1_->flag = CMC_FLAG_OK;
+    _gb2_->flag = CMC_FLAG_OK;
+    if (_gb1_->count != _gb2_->count)
+        return 0;
+    for (size_t i = 0; i < _gb1_->count; i++)
+    {
+        size_t value1 = _gb1_->buffer[gb_impl_position(_gb1_, i)];
+        size_t value2 = _gb2_->buffer[gb_impl_position(_gb2_, i)];
+        if (0 != _gb1_->f_val->cmp(value1, value2))
+            return 0;
+    }
+    return 1;
+}
+static size_t gb_impl_position(struct gapbuffer *_gb_, size_t index)
+{
+    return index < _gb_->gap ? index : index + _gb_->capacity - _gb_->count;
+}
+static void gb_impl_move_gap(struct gapbuffer *_gb_, size_t index)
+{
+    size_t gap_size = _gb_->capacity - _gb_->count;
+    if (gap_size > 0)
+    {
+        if (index < _gb_->gap)
+        {
+            memmove(_gb_->buffer + index + gap_size, _gb_->buffer + index, sizeof(size_t) * (_gb_->gap - index));
+        }
+        else if (index > _gb_->gap)
+        {
+            size_t *tail = _gb_->buffer + _gb_->gap + gap_size;
+            memmove(_gb_->buffer + _gb_->gap, tail, sizeof(size_t) * (index - _gb_->gap));
+        }
+    }
+    _gb_->gap = index;
+}
+struct gapbuffer_iter gb_iter_start(struct gapbuffer *target)
+{
+    struct gapbuffer_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.start = 1;
+    iter.end = gb_empty(target);
+    return iter;
+}
+struct gapbuffer_iter gb_iter_end(struct gapbuffer *target)
+{
+    struct gapbuffer_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.start = gb_empty(target);
+    iter.end = 1;
+    if (!gb_empty(target))
+        iter.cursor = target->count - 1;
+    return iter;
+}
+_Bool gb_iter_at_start(struct gapbuffer_iter *iter)
+{
+    return gb_empty(iter->target) || iter->start;
+}
+_Bool gb_iter_at_end(struct gapbuffer_iter *iter)
+{
+    return gb_empty(iter->target) || iter->end;
+}
+_Bool gb_iter_to_start(struct gapbuffer_iter *iter)
+{
+    if (!gb_empty(iter->target))
+    {
+        iter->cursor = 0;
+        iter->start = 1;
+        iter->end = gb_empty(iter->target);
+        return 1;
+    }
+    return 0;
+}
+_Bool gb_iter_to_end(struct gapbuffer_iter *iter)
+{
+    if (!gb_empty(iter->target))
+    {
+        iter->start = gb_empty(iter->target);
+        iter->cursor = iter->target->count - 1;
+        iter->end = 1;
+        return 1;
+    }
+    return 0;
+}
+_Bool gb_iter_next(struct gapbuffer_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor + 1 == iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = gb_empty(iter->target);
+    iter->cursor++;
+    return 1;
+}
+_Bool gb_iter_prev(struct gapbuffer_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = gb_empty(iter->target);
+    iter->cursor--;
+    return 1;
+}
+_Bool gb_iter_advance(struct gapbuffer_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor + 1 == iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->cursor + steps >= iter->target->count)
+        return 0;
+    iter->start = gb_empty(iter->target);
+    iter->cursor += steps;
+    return 1;
+}
+_Bool gb_iter_rewind(struct gapbuffer_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->cursor < steps)
+        return 0;
+    iter->end = gb_empty(iter->target);
+    iter->cursor -= steps;
+    return 1;
+}
+_Bool gb_iter_go_to(struct gapbuffer_iter *iter, size_t index)
+{
+    if (index >= iter->target->count)
+        return 0;
+    if (iter->cursor > index)
+        return gb_iter_rewind(iter, iter->cursor - index);
+    else if (iter->cursor < index)
+        return gb_iter_advance(iter, index - iter->cursor);
+    return 1;
+}
+size_t gb_iter_value(struct gapbuffer_iter *iter)
+{
+    if (gb_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->target->buffer[gb_impl_position(iter->target, iter->cursor)];
+}
+size_t *gb_iter_rvalue(struct gapbuffer_iter *iter)
+{
+    if (gb_empty(iter->target))
+        return ((void *)0);
+    return &(iter->target->buffer[gb_impl_position(iter->target, iter->cursor)]);
+}
+size_t gb_iter_index(struct gapbuffer_iter *iter)
+{
+    return iter->cursor;
+}
+_Bool gb_to_string(struct gapbuffer *_gb_, FILE *fptr)
+{
+    struct gapbuffer *g_ = _gb_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "buffer:%p, "
+                        "capacity:%"
+                        "I64u"
+                        ", "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "gap:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks:%p }",
+                        "gapbuffer", "size_t", g_, g_->buffer, g_->capacity, g_->count, g_->gap, g_->flag, g_->f_val,
+                        g_->alloc, (g_)->callbacks);
+}
+_Bool gb_print(struct gapbuffer *_gb_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    fprintf(fptr, "%s", start);
+    for (size_t i = 0; i < _gb_->count; i++)
+    {
+        if (!_gb_->f_val->str(fptr, _gb_->buffer[gb_impl_position(_gb_, i)]))
+            return 0;
+        if (i + 1 < _gb_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
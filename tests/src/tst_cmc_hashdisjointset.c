@@ -0,0 +1,611 @@
+
+#include "tst_cmc_hashdisjointset.h"
+
+static size_t hdjs_impl_get_index(struct hashdisjointset *_set_, size_t key);
+static void hdjs_impl_add_bucket(struct hashdisjointset *_set_, size_t index);
+static size_t hdjs_impl_find(struct hashdisjointset *_set_, size_t index);
+static void hdjs_impl_link(struct hashdisjointset *_set_, size_t root1, size_t root2);
+static size_t hdjs_impl_calculate_size(size_t required);
+struct hashdisjointset *hdjs_new(size_t capacity, double load, struct hashdisjointset_fkey *f_key)
+{
+    return hdjs_new_custom(capacity, load, f_key, ((void *)0), ((void *)0));
+}
+struct hashdisjointset *hdjs_new_custom(size_t capacity, double load, struct hashdisjointset_fkey *f_key,
+                                        struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (capacity == 0 || load <= 0 || load >= 1)
+        return ((void *)0);
+    if (capacity >= 0xffffffffffffffffULL * load || capacity > 0xffffffffffffffffULL / sizeof(size_t) ||
+        capacity > 0xffffffffffffffffULL / sizeof(size_t))
+        return ((void *)0);
+    if (!f_key)
+        return ((void *)0);
+    size_t bucket_count = hdjs_impl_calculate_size(capacity / load);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct hashdisjointset *_set_ = alloc->malloc(sizeof(struct hashdisjointset));
+    if (!_set_)
+        return ((void *)0);
+    _set_->keys = alloc->malloc(sizeof(size_t) * capacity);
+    _set_->parent = alloc->malloc(sizeof(size_t) * capacity);
+    _set_->rank = alloc->malloc(sizeof(unsigned char) * capacity);
+    _set_->size = alloc->malloc(sizeof(size_t) * capacity);
+    _set_->next = alloc->malloc(sizeof(size_t) * capacity);
+    _set_->prev = alloc->malloc(sizeof(size_t) * capacity);
+    _set_->buckets = alloc->calloc(bucket_count, sizeof(size_t));
+    if (!_set_->keys || !_set_->parent || !_set_->rank || !_set_->size || !_set_->next || !_set_->prev ||
+        !_set_->buckets)
+    {
+        alloc->free(_set_->keys);
+        alloc->free(_set_->parent);
+        alloc->free(_set_->rank);
+        alloc->free(_set_->size);
+        alloc->free(_set_->next);
+        alloc->free(_set_->prev);
+        alloc->free(_set_->buckets);
+        alloc->free(_set_);
+        return ((void *)0);
+    }
+    _set_->bucket_count = bucket_count;
+    _set_->capacity = capacity;
+    _set_->count = 0;
+    _set_->sets = 0;
+    _set_->load = load;
+    _set_->flag = CMC_FLAG_OK;
+    _set_->f_key = f_key;
+    _set_->alloc = alloc;
+    (_set_)->callbacks = callbacks;
+    return _set_;
+}
+void hdjs_clear(struct hashdisjointset *_set_)
+{
+    if (_set_->f_key->free)
+    {
+        for (size_t i = 0; i < _set_->count; i++)
+            _set_->f_key->free(_set_->keys[i]);
+    }
+    memset(_set_->buckets, 0, sizeof(size_t) * _set_->bucket_count);
+    _set_->count = 0;
+    _set_->sets = 0;
+    _set_->flag = CMC_FLAG_OK;
+}
+void hdjs_free(struct hashdisjointset *_set_)
+{
+    if (_set_->f_key->free)
+    {
+        for (size_t i = 0; i < _set_->count; i++)
+            _set_->f_key->free(_set_->keys[i]);
+    }
+    _set_->alloc->free(_set_->keys);
+    _set_->alloc->free(_set_->parent);
+    _set_->alloc->free(_set_->rank);
+    _set_->alloc->free(_set_->size);
+    _set_->alloc->free(_set_->next);
+    _set_->alloc->free(_set_->prev);
+    _set_->alloc->free(_set_->buckets);
+    _set_->alloc->free(_set_);
+}
+void hdjs_customize(struct hashdisjointset *_set_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _set_->alloc = &cmc_alloc_node_default;
+    else
+        _set_->alloc = alloc;
+    (_set_)->callbacks = callbacks;
+    _set_->flag = CMC_FLAG_OK;
+}
+_Bool hdjs_insert(struct hashdisjointset *_set_, size_t key)
+{
+    if (hdjs_impl_get_index(_set_, key) != 0xffffffffffffffffULL)
+    {
+        _set_->flag = CMC_FLAG_DUPLICATE;
+        return 0;
+    }
+    if (_set_->count == _set_->capacity)
+    {
+        if (_set_->capacity > 0xffffffffffffffffULL / 2)
+        {
+            _set_->flag = CMC_FLAG_ERROR;
+            return 0;
+        }
+        if (!hdjs_resize(_set_, _set_->capacity * 2))
+            return 0;
+    }
+    size_t index = _set_->count;
+    _set_->keys[index] = key;
+    _set_->parent[index] = index;
+    _set_->rank[index] = 0;
+    _set_->size[index] = 1;
+    _set_->next[index] = index;
+    _set_->prev[index] = index;
+    hdjs_impl_add_bucket(_set_, index);
+    _set_->count++;
+    _set_->sets++;
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->create)
+        (_set_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool hdjs_union(struct hashdisjointset *_set_, size_t key1, size_t key2)
+{
+    if (hdjs_empty(_set_))
+    {
+        _set_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    size_t index1 = hdjs_impl_get_index(_set_, key1);
+    size_t index2 = hdjs_impl_get_index(_set_, key2);
+    if (index1 == 0xffffffffffffffffULL || index2 == 0xffffffffffffffffULL)
+    {
+        _set_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    size_t root1 = hdjs_impl_find(_set_, index1);
+    size_t root2 = hdjs_impl_find(_set_, index2);
+    if (root1 == root2)
+    {
+        _set_->flag = CMC_FLAG_DUPLICATE;
+        return 0;
+    }
+    hdjs_impl_link(_set_, root1, root2);
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->update)
+        (_set_)->callbacks->update();
+    ;
+    return 1;
+}
+_Bool hdjs_find(struct hashdisjointset *_set_, size_t key, size_t *root)
+{
+    if (hdjs_empty(_set_))
+    {
+        _set_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    size_t index = hdjs_impl_get_index(_set_, key);
+    if (index == 0xffffffffffffffffULL)
+    {
+        _set_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (root)
+        *root = _set_->keys[hdjs_impl_find(_set_, index)];
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool hdjs_contains(struct hashdisjointset *_set_, size_t key)
+{
+    _set_->flag = CMC_FLAG_OK;
+    _Bool result = hdjs_impl_get_index(_set_, key) != 0xffffffffffffffffULL;
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool hdjs_connected(struct hashdisjointset *_set_, size_t key1, size_t key2)
+{
+    size_t index1 = hdjs_impl_get_index(_set_, key1);
+    size_t index2 = hdjs_impl_get_index(_set_, key2);
+    if (index1 == 0xffffffffffffffffULL || index2 == 0xffffffffffffffffULL)
+    {
+        _set_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    size_t root1 = hdjs_impl_find(_set_, index1);
+    size_t root2 = hdjs_impl_find(_set_, index2);
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return root1 == root2;
+}
+size_t hdjs_set_size(struct hashdisjointset *_set_, size_t key)
+{
+    size_t index = hdjs_impl_get_index(_set_, key);
+    if (index == 0xffffffffffffffffULL)
+    {
+        _set_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    size_t result = _set_->size[hdjs_impl_find(_set_, index)];
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return result;
+}
+size_t hdjs_set_count(struct hashdisjointset *_set_)
+{
+    return _set_->sets;
+}
+_Bool hdjs_empty(struct hashdisjointset *_set_)
+{
+    return _set_->count == 0;
+}
+size_t hdjs_count(struct hashdisjointset *_set_)
+{
+    return _set_->count;
+}
+size_t hdjs_capacity(struct hashdisjointset *_set_)
+{
+    return _set_->capacity;
+}
+int hdjs_flag(struct hashdisjointset *_set_)
+{
+    return _set_->flag;
+}
+_Bool hdjs_resize(struct hashdisjointset *_set_, size_t capacity)
+{
+    _set_->flag = CMC_FLAG_OK;
+    if (_set_->capacity == capacity)
+        goto success;
+    if (capacity < _set_->count || capacity == 0)
+    {
+        _set_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    if (capacity >= 0xffffffffffffffffULL * _set_->load || capacity > 0xffffffffffffffffULL / sizeof(size_t) ||
+        capacity > 0xffffffffffffffffULL / sizeof(size_t))
+    {
+        _set_->flag = CMC_FLAG_ERROR;
+        return 0;
+    }
+    size_t bucket_count = hdjs_impl_calculate_size(capacity / _set_->load);
+    size_t *new_buckets = _set_->alloc->calloc(bucket_count, sizeof(size_t));
+    if (!new_buckets)
+        goto alloc_error;
+    _Bool grow = capacity > _set_->capacity;
+    size_t *new_keys = _set_->alloc->realloc(_set_->keys, sizeof(size_t) * capacity);
+    if (new_keys)
+        _set_->keys = new_keys;
+    else if (grow)
+        goto buckets_error;
+    size_t *new_parent = _set_->alloc->realloc(_set_->parent, sizeof(size_t) * capacity);
+    if (new_parent)
+        _set_->parent = new_parent;
+    else if (grow)
+        goto buckets_error;
+    unsigned char *new_rank = _set_->alloc->realloc(_set_->rank, sizeof(unsigned char) * capacity);
+    if (new_rank)
+        _set_->rank = new_rank;
+    else if (grow)
+        goto buckets_error;
+    size_t *new_size = _set_->alloc->realloc(_set_->size, sizeof(size_t) * capacity);
+    if (new_size)
+        _set_->size = new_size;
+    else if (grow)
+        goto buckets_error;
+    size_t *new_next = _set_->alloc->realloc(_set_->next, sizeof(size_t) * capacity);
+    if (new_next)
+        _set_->next = new_next;
+    else if (grow)
+        goto buckets_error;
+    size_t *new_prev = _set_->alloc->realloc(_set_->prev, sizeof(size_t) * capacity);
+    if (new_prev)
+        _set_->prev = new_prev;
+    else if (grow)
+        goto buckets_error;
+    _set_->alloc->free(_set_->buckets);
+    _set_->buckets = new_buckets;
+    _set_->bucket_count = bucket_count;
+    _set_->capacity = capacity;
+    for (size_t i = 0; i < _set_->count; i++)
+        hdjs_impl_add_bucket(_set_, i);
+success:
+    if ((_set_)->callbacks && (_set_)->callbacks->resize)
+        (_set_)->callbacks->resize();
+    ;
+    return 1;
+buckets_error:
+    _set_->alloc->free(new_buckets);
+alloc_error:
+    _set_->flag = CMC_FLAG_ALLOC;
+    return 0;
+}
+struct hashdisjointset *hdjs_copy_of(struct hashdisjointset *_set_)
+{
+    struct hashdisjointset *result =
+        hdjs_new_custom(_set_->capacity, _set_->load, _set_->f_key, _set_->alloc, ((void *)0));
+    if (!result)
+    {
+        _set_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    (result)->callbacks = _set_->callbacks;
+    if (_set_->f_key->cpy)
+    {
+        for (size_t i = 0; i < _set_->count; i++)
+            result->keys[i] = _set_->f_key->cpy(_set_->keys[i]);
+    }
+    else
+        memcpy(result->keys, _set_->keys, sizeof(size_t) * _set_->count);
+    memcpy(result->parent, _set_->parent, sizeof(size_t) * _set_->count);
+    memcpy(result->rank, _set_->rank, sizeof(unsigned char) * _set_->count);
+    memcpy(result->size, _set_->size, sizeof(size_t) * _set_->count);
+    memcpy(result->next, _set_->next, sizeof(size_t) * _set_->count);
+    memcpy(result->prev, _set_->prev, sizeof(size_t) * _set_->count);
+    memcpy(result->buckets, _set_->buckets, sizeof(size_t) * _set_->bucket_count);
+    result->count = _set_->count;
+    result->sets = _set_->sets;
+    _set_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool hdjs_equals(struct hashdisjointset *_set1_, struct hashdisjointset *_set2_)
+{
+    _set1_->flag = CMC_FLAG_OK;
+    _set2_->flag = CMC_FLAG_OK;
+    if (_set1_->count != _set2_->count || _set1_->sets != _set2_->sets)
+        return 0;
+    for (size_t i = 0; i < _set1_->count; i++)
+    {
+        size_t root1 = hdjs_impl_find(_set1_, i);
+        size_t index = hdjs_impl_get_index(_set2_, _set1_->keys[i]);
+        if (index == 0xffffffffffffffffULL)
+            return 0;
+        size_t root_index = hdjs_impl_get_index(_set2_, _set1_->keys[root1]);
+        if (hdjs_impl_find(_set2_, index) != hdjs_impl_find(_set2_, root_index))
+            return 0;
+    }
+    return 1;
+}
+static size_t hdjs_impl_get_index(struct hashdisjointset *_set_, size_t key)
+{
+    size_t pos = _set_->f_key->hash(key) % _set_->bucket_count;
+    while (_set_->buckets[pos] != 0)
+    {
+        size_t index = _set_->buckets[pos] - 1;
+        if (_set_->f_key->cmp(_set_->keys[index], key) == 0)
+            return index;
+        pos = (pos + 1) % _set_->bucket_count;
+    }
+    return 0xffffffffffffffffULL;
+}
+static void hdjs_impl_add_bucket(struct hashdisjointset *_set_, size_t index)
+{
+    size_t pos = _set_->f_key->hash(_set_->keys[index]) % _set_->bucket_count;
+    while (_set_->buckets[pos] != 0)
+        pos = (pos + 1) % _set_->bucket_count;
+    _set_->buckets[pos] = index + 1;
+}
+static size_t hdjs_impl_find(struct hashdisjointset *_set_, size_t index)
+{
+    while (_set_->parent[index] != index)
+    {
+        _set_->parent[index] = _set_->parent[_set_->parent[index]];
+        index = _set_->parent[index];
+    }
+    return index;
+}
+static void hdjs_impl_link(struct hashdisjointset *_set_, size_t root1, size_t root2)
+{
+    if (_set_->rank[root1] < _set_->rank[root2])
+    {
+        size_t tmp = root1;
+        root1 = root2;
+        root2 = tmp;
+    }
+    else if (_set_->rank[root1] == _set_->rank[root2])
+        _set_->rank[root1]++;
+    _set_->parent[root2] = root1;
+    _set_->size[root1] += _set_->size[root2];
+    size_t next1 = _set_->next[root1];
+    size_t next2 = _set_->next[root2];
+    _set_->next[root1] = next2;
+    _set_->prev[next2] = root1;
+    _set_->next[root2] = next1;
+    _set_->prev[next1] = root2;
+    _set_->sets--;
+}
+static size_t hdjs_impl_calculate_size(size_t required)
+{
+    const size_t count = sizeof(cmc_hashtable_primes) / sizeof(cmc_hashtable_primes[0]);
+    if (cmc_hashtable_primes[count - 1] < required)
+        return required;
+    size_t i = 0;
+    while (cmc_hashtable_primes[i] < required)
+        i++;
+    return cmc_hashtable_primes[i];
+}
+struct hashdisjointset_iter hdjs_iter_start(struct hashdisjointset *target, size_t key)
+{
+    struct hashdisjointset_iter iter;
+    size_t first = hdjs_impl_get_index(target, key);
+    iter.target = target;
+    iter.first = first;
+    iter.cursor = first;
+    iter.index = 0;
+    iter.count = 0;
+    iter.start = 1;
+    iter.end = 1;
+    if (first != 0xffffffffffffffffULL)
+    {
+        iter.count = target->size[hdjs_impl_find(target, first)];
+        iter.end = 0;
+    }
+    return iter;
+}
+struct hashdisjointset_iter hdjs_iter_end(struct hashdisjointset *target, size_t key)
+{
+    struct hashdisjointset_iter iter = hdjs_iter_start(target, key);
+    if (iter.count > 0)
+    {
+        iter.cursor = target->prev[iter.first];
+        iter.index = iter.count - 1;
+        iter.start = 0;
+        iter.end = 1;
+    }
+    return iter;
+}
+_Bool hdjs_iter_at_start(struct hashdisjointset_iter *iter)
+{
+    return iter->count == 0 || iter->start;
+}
+_Bool hdjs_iter_at_end(struct hashdisjointset_iter *iter)
+{
+    return iter->count == 0 || iter->end;
+}
+_Bool hdjs_iter_to_start(struct hashdisjointset_iter *iter)
+{
+    if (iter->count > 0)
+    {
+        iter->cursor = iter->first;
+        iter->index = 0;
+        iter->start = 1;
+        iter->end = 0;
+        return 1;
+    }
+    return 0;
+}
+_Bool hdjs_iter_to_end(struct hashdisjointset_iter *iter)
+{
+    if (iter->count > 0)
+    {
+        iter->cursor = iter->target->prev[iter->first];
+        iter->index = iter->count - 1;
+        iter->start = 0;
+        iter->end = 1;
+        return 1;
+    }
+    return 0;
+}
+_Bool hdjs_iter_next(struct hashdisjointset_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 == iter->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = 0;
+    iter->cursor = iter->target->next[iter->cursor];
+    iter->index++;
+    return 1;
+}
+_Bool hdjs_iter_prev(struct hashdisjointset_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = 0;
+    iter->cursor = iter->target->prev[iter->cursor];
+    iter->index--;
+    return 1;
+}
+_Bool hdjs_iter_advance(struct hashdisjointset_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 == iter->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index + steps >= iter->count)
+        return 0;
+    iter->start = 0;
+    for (size_t i = 0; i < steps; i++)
+        iter->cursor = iter->target->next[iter->cursor];
+    iter->index += steps;
+    return 1;
+}
+_Bool hdjs_iter_rewind(struct hashdisjointset_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index < steps)
+        return 0;
+    iter->end = 0;
+    for (size_t i = 0; i < steps; i++)
+        iter->cursor = iter->target->prev[iter->cursor];
+    iter->index -= steps;
+    return 1;
+}
+_Bool hdjs_iter_go_to(struct hashdisjointset_iter *iter, size_t index)
+{
+    if (index >= iter->count)
+        return 0;
+    if (iter->index > index)
+        return hdjs_iter_rewind(iter, iter->index - index);
+    else if (iter->index < index)
+        return hdjs_iter_advance(iter, index - iter->index);
+    return 1;
+}
+size_t hdjs_iter_key(struct hashdisjointset_iter *iter)
+{
+    if (iter->count == 0)
+        return (size_t){ 0 };
+    return iter->target->keys[iter->cursor];
+}
+size_t hdjs_iter_index(struct hashdisjointset_iter *iter)
+{
+    return iter->index;
+}
+_Bool hdjs_to_string(struct hashdisjointset *_set_, FILE *fptr)
+{
+    struct hashdisjointset *s_ = _set_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "keys:%p, "
+                        "parent:%p, "
+                        "rank:%p, "
+                        "size:%p, "
+                        "next:%p, "
+                        "prev:%p, "
+                        "buckets:%p, "
+                        "bucket_count:%"
+                        "I64u"
+                        ", "
+                        "capacity:%"
+                        "I64u"
+                        ", "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "sets:%"
+                        "I64u"
+                        ", "
+                        "load:%lf, "
+                        "flag:%d, "
+                        "f_key:%p, "
+                        "alloc:%p, "
+                        "callbacks: %p }",
+                        "hashdisjointset", "size_t", s_, s_->keys, s_->parent, s_->rank, s_->size, s_->next, s_->prev,
+                        s_->buckets, s_->bucket_count, s_->capacity, s_->count, s_->sets, s_->load, s_->flag, s_->f_key,
+                        s_->alloc, (s_)->callbacks);
+}
+_Bool hdjs_print(struct hashdisjointset *_set_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    for (size_t i = 0; i < _set_->count; i++)
+    {
+        if (_set_->parent[i] != i)
+            continue;
+        fprintf(fptr, "%s", start);
+        size_t cursor = i;
+        do
+        {
+            if (!_set_->f_key->str(fptr, _set_->keys[cursor]))
+                return 0;
+            cursor = _set_->next[cursor];
+            if (cursor != i)
+                fprintf(fptr, "%s", separator);
+        } while (cursor != i);
+        fprintf(fptr, "%s", end);
+    }
+    return 1;
+}
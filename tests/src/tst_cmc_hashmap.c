@@ -2,6 +2,9 @@
 #include "tst_cmc_hashmap.h"
 
 static struct hashmap_entry *hm_impl_get_entry(struct hashmap *_map_, size_t key);
+static struct hashmap_entry *hm_impl_insert(struct hashmap *_map_, const size_t *key);
+static _Bool hm_impl_rehash(struct hashmap *_map_, size_t capacity);
+static void hm_impl_shrink(struct hashmap *_map_);
 static size_t hm_impl_calculate_size(size_t required);
 struct hashmap *hm_new(size_t capacity, double load, struct hashmap_fkey *f_key, struct hashmap_fval *f_val)
 {
@@ -32,6 +35,8 @@ struct hashmap *hm_new_custom(size_t capacity, double load, struct hashmap_fkey
     _map_->count = 0;
     _map_->capacity = real_capacity;
     _map_->load = load;
+    _map_->shrink = 0;
+    _map_->epoch = 0;
     _map_->flag = CMC_FLAG_OK;
     _map_->f_key = f_key;
     _map_->f_val = f_val;
@@ -46,7 +51,7 @@ void hm_clear(struct hashmap *_map_)
         for (size_t i = 0; i < _map_->capacity; i++)
         {
             struct hashmap_entry *entry = &(_map_->buffer[i]);
-            if (entry->state == CMC_ES_FILLED)
+            if (((*entry).epoch == (_map_->epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 if (_map_->f_key->free)
                     _map_->f_key->free(entry->key);
@@ -55,7 +60,13 @@ void hm_clear(struct hashmap *_map_)
             }
         }
     }
-    memset(_map_->buffer, 0, sizeof(struct hashmap_entry) * _map_->capacity);
+    if (_map_->epoch == (65535))
+    {
+        memset(_map_->buffer, 0, sizeof(struct hashmap_entry) * _map_->capacity);
+        _map_->epoch = 0;
+    }
+    else
+        _map_->epoch++;
     _map_->count = 0;
     _map_->flag = CMC_FLAG_OK;
 }
@@ -66,7 +77,7 @@ void hm_free(struct hashmap *_map_)
         for (size_t i = 0; i < _map_->capacity; i++)
         {
             struct hashmap_entry *entry = &(_map_->buffer[i]);
-            if (entry->state == CMC_ES_FILLED)
+            if (((*entry).epoch == (_map_->epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 if (_map_->f_key->free)
                     _map_->f_key->free(entry->key);
@@ -90,62 +101,37 @@ void hm_customize(struct hashmap *_map_, struct cmc_alloc_node *alloc, struct cm
 }
 _Bool hm_insert(struct hashmap *_map_, size_t key, size_t value)
 {
-    if (hm_full(_map_))
-    {
-        if (!hm_resize(_map_, _map_->capacity + 1))
-            return 0;
-    }
-    if (hm_impl_get_entry(_map_, key) != ((void *)0))
-    {
-        _map_->flag = CMC_FLAG_DUPLICATE;
+    struct hashmap_entry *entry = hm_impl_insert(_map_, &key);
+    if (!entry)
         return 0;
-    }
-    size_t hash = _map_->f_key->hash(key);
-    size_t original_pos = hash % _map_->capacity;
-    size_t pos = original_pos;
-    struct hashmap_entry *target = &(_map_->buffer[pos]);
-    if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED)
-    {
-        target->key = key;
-        target->value = value;
-        target->dist = 0;
-        target->state = CMC_ES_FILLED;
-    }
-    else
-    {
-        while (1)
-        {
-            pos++;
-            target = &(_map_->buffer[pos % _map_->capacity]);
-            if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED)
-            {
-                target->key = key;
-                target->value = value;
-                target->dist = pos - original_pos;
-                target->state = CMC_ES_FILLED;
-                break;
-            }
-            else if (target->dist < pos - original_pos)
-            {
-                size_t tmp_k = target->key;
-                size_t tmp_v = target->value;
-                size_t tmp_dist = target->dist;
-                target->key = key;
-                target->value = value;
-                target->dist = pos - original_pos;
-                key = tmp_k;
-                value = tmp_v;
-                original_pos = pos - tmp_dist;
-            }
-        }
-    }
-    _map_->count++;
-    _map_->flag = CMC_FLAG_OK;
+    entry->value = value;
     if ((_map_)->callbacks && (_map_)->callbacks->create)
         (_map_)->callbacks->create();
     ;
     return 1;
 }
+_Bool hm_insert_ptr(struct hashmap *_map_, const size_t *key, const size_t *value)
+{
+    struct hashmap_entry *entry = hm_impl_insert(_map_, key);
+    if (!entry)
+        return 0;
+    entry->value = *value;
+    if ((_map_)->callbacks && (_map_)->callbacks->create)
+        (_map_)->callbacks->create();
+    ;
+    return 1;
+}
+size_t *hm_emplace(struct hashmap *_map_, size_t key)
+{
+    struct hashmap_entry *entry = hm_impl_insert(_map_, &key);
+    if (!entry)
+        return ((void *)0);
+    memset(&(entry->value), 0, sizeof(size_t));
+    if ((_map_)->callbacks && (_map_)->callbacks->create)
+        (_map_)->callbacks->create();
+    ;
+    return &(entry->value);
+}
 _Bool hm_update(struct hashmap *_map_, size_t key, size_t new_value, size_t *old_value)
 {
     if (hm_empty(_map_))
@@ -192,6 +178,8 @@ _Bool hm_remove(struct hashmap *_map_, size_t key, size_t *out_value)
     if ((_map_)->callbacks && (_map_)->callbacks->delete)
         (_map_)->callbacks->delete ();
     ;
+    if ((double)_map_->count < (double)_map_->capacity * _map_->shrink)
+        hm_impl_shrink(_map_);
     return 1;
 }
 _Bool hm_max(struct hashmap *_map_, size_t *key, size_t *value)
@@ -206,7 +194,7 @@ _Bool hm_max(struct hashmap *_map_, size_t *key, size_t *value)
     size_t max_val = (size_t){ 0 };
     for (size_t i = 0; i < _map_->capacity; i++)
     {
-        if (_map_->buffer[i].state == CMC_ES_FILLED)
+        if (((_map_->buffer[i]).epoch == (_map_->epoch) ? (_map_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (first)
             {
@@ -243,7 +231,7 @@ _Bool hm_min(struct hashmap *_map_, size_t *key, size_t *value)
     size_t min_val = (size_t){ 0 };
     for (size_t i = 0; i < _map_->capacity; i++)
     {
-        if (_map_->buffer[i].state == CMC_ES_FILLED)
+        if (((_map_->buffer[i]).epoch == (_map_->epoch) ? (_map_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (first)
             {
@@ -357,43 +345,37 @@ _Bool hm_resize(struct hashmap *_map_, size_t capacity)
         _map_->flag = CMC_FLAG_INVALID;
         return 0;
     }
-    struct hashmap *_new_map_ =
-        hm_new_custom(capacity, _map_->load, _map_->f_key, _map_->f_val, _map_->alloc, ((void *)0));
-    if (!_new_map_)
-    {
-        _map_->flag = CMC_FLAG_ALLOC;
-        return 0;
-    }
-    for (size_t i = 0; i < _map_->capacity; i++)
-    {
-        if (_map_->buffer[i].state == CMC_ES_FILLED)
-        {
-            size_t key = _map_->buffer[i].key;
-            size_t value = _map_->buffer[i].value;
-            hm_insert(_new_map_, key, value);
-        }
-    }
-    if (_map_->count != _new_map_->count)
-    {
-        hm_free(_new_map_);
-        _map_->flag = CMC_FLAG_ERROR;
+    if (!hm_impl_rehash(_map_, capacity))
         return 0;
-    }
-    struct hashmap_entry *tmp_b = _map_->buffer;
-    _map_->buffer = _new_map_->buffer;
-    _new_map_->buffer = tmp_b;
-    size_t tmp_c = _map_->capacity;
-    _map_->capacity = _new_map_->capacity;
-    _new_map_->capacity = tmp_c;
-    _new_map_->f_key = &(struct hashmap_fkey){ ((void *)0) };
-    _new_map_->f_val = &(struct hashmap_fval){ ((void *)0) };
-    hm_free(_new_map_);
 success:
     if ((_map_)->callbacks && (_map_)->callbacks->resize)
         (_map_)->callbacks->resize();
     ;
     return 1;
 }
+_Bool hm_shrink_to_fit(struct hashmap *_map_)
+{
+    _map_->flag = CMC_FLAG_OK;
+    if (hm_impl_calculate_size(_map_->count / _map_->load) >= _map_->capacity)
+        return 1;
+    if (!hm_impl_rehash(_map_, _map_->count))
+        return 0;
+    if ((_map_)->callbacks && (_map_)->callbacks->resize)
+        (_map_)->callbacks->resize();
+    ;
+    return 1;
+}
+_Bool hm_set_shrink(struct hashmap *_map_, double shrink)
+{
+    if (shrink < 0 || shrink >= _map_->load / 2)
+    {
+        _map_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    _map_->shrink = shrink;
+    _map_->flag = CMC_FLAG_OK;
+    return 1;
+}
 struct hashmap *hm_copy_of(struct hashmap *_map_)
 {
     struct hashmap *result = hm_new_custom(_map_->capacity * _map_->load, _map_->load, _map_->f_key, _map_->f_val,
@@ -409,14 +391,15 @@ struct hashmap *hm_copy_of(struct hashmap *_map_)
         for (size_t i = 0; i < _map_->capacity; i++)
         {
             struct hashmap_entry *scan = &(_map_->buffer[i]);
-            if (scan->state != CMC_ES_EMPTY)
+            if (((*scan).epoch == (_map_->epoch) ? (*scan).state : CMC_ES_EMPTY) != CMC_ES_EMPTY)
             {
                 struct hashmap_entry *target = &(result->buffer[i]);
-                if (scan->state == CMC_ES_DELETED)
+                target->epoch = result->epoch;
+                if (((*scan).epoch == (_map_->epoch) ? (*scan).state : CMC_ES_EMPTY) == CMC_ES_DELETED)
                     target->state = CMC_ES_DELETED;
                 else
                 {
-                    target->state = scan->state;
+                    target->state = CMC_ES_FILLED;
                     target->dist = scan->dist;
                     if (_map_->f_key->cpy)
                         target->key = _map_->f_key->cpy(scan->key);
@@ -431,8 +414,12 @@ struct hashmap *hm_copy_of(struct hashmap *_map_)
         }
     }
     else
+    {
         memcpy(result->buffer, _map_->buffer, sizeof(struct hashmap_entry) * _map_->capacity);
+        result->epoch = _map_->epoch;
+    }
     result->count = _map_->count;
+    result->shrink = _map_->shrink;
     _map_->flag = CMC_FLAG_OK;
     return result;
 }
@@ -448,7 +435,7 @@ _Bool hm_equals(struct hashmap *_map1_, struct hashmap *_map2_)
     _map_b_ = _map_a_ == _map1_ ? _map2_ : _map1_;
     for (size_t i = 0; i < _map_a_->capacity; i++)
     {
-        if (_map_a_->buffer[i].state == CMC_ES_FILLED)
+        if (((_map_a_->buffer[i]).epoch == (_map_a_->epoch) ? (_map_a_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             struct hashmap_entry *entry_a = &(_map_a_->buffer[i]);
             struct hashmap_entry *entry_b = hm_impl_get_entry(_map_b_, entry_a->key);
@@ -465,7 +452,7 @@ static struct hashmap_entry *hm_impl_get_entry(struct hashmap *_map_, size_t key
     size_t hash = _map_->f_key->hash(key);
     size_t pos = hash % _map_->capacity;
     struct hashmap_entry *target = &(_map_->buffer[pos]);
-    while (target->state == CMC_ES_FILLED || target->state == CMC_ES_DELETED)
+    while (((*target).epoch == (_map_->epoch) ? (*target).state : CMC_ES_EMPTY) != CMC_ES_EMPTY)
     {
         if (_map_->f_key->cmp(target->key, key) == 0)
             return target;
@@ -474,6 +461,100 @@ static struct hashmap_entry *hm_impl_get_entry(struct hashmap *_map_, size_t key
     }
     return ((void *)0);
 }
+static struct hashmap_entry *hm_impl_insert(struct hashmap *_map_, const size_t *key)
+{
+    if (hm_full(_map_))
+    {
+        if (!hm_resize(_map_, _map_->capacity + 1))
+            return ((void *)0);
+    }
+    if (hm_impl_get_entry(_map_, *key) != ((void *)0))
+    {
+        _map_->flag = CMC_FLAG_DUPLICATE;
+        return ((void *)0);
+    }
+    size_t hash = _map_->f_key->hash(*key);
+    size_t original_pos = hash % _map_->capacity;
+    size_t pos = original_pos;
+    struct hashmap_entry *target = &(_map_->buffer[pos]);
+    while (((*target).epoch == (_map_->epoch) ? (*target).state : CMC_ES_EMPTY) == CMC_ES_FILLED &&
+           target->dist >= pos - original_pos)
+    {
+        pos++;
+        target = &(_map_->buffer[pos % _map_->capacity]);
+    }
+    if (((*target).epoch == (_map_->epoch) ? (*target).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
+    {
+        size_t last = pos + 1;
+        while (((_map_->buffer[last % _map_->capacity]).epoch == (_map_->epoch) ? (_map_->buffer[last % _map_->capacity]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
+            last++;
+        for (size_t i = last; i > pos; i--)
+        {
+            struct hashmap_entry *next = &(_map_->buffer[i % _map_->capacity]);
+            *next = _map_->buffer[(i - 1) % _map_->capacity];
+            next->dist++;
+        }
+    }
+    target->key = *key;
+    target->dist = pos - original_pos;
+    target->state = CMC_ES_FILLED;
+    target->epoch = _map_->epoch;
+    _map_->count++;
+    _map_->flag = CMC_FLAG_OK;
+    return target;
+}
+static _Bool hm_impl_rehash(struct hashmap *_map_, size_t capacity)
+{
+    if (capacity == 0)
+        capacity = 1;
+    struct hashmap *_new_map_ =
+        hm_new_custom(capacity, _map_->load, _map_->f_key, _map_->f_val, _map_->alloc, ((void *)0));
+    if (!_new_map_)
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    for (size_t i = 0; i < _map_->capacity; i++)
+    {
+        if (((_map_->buffer[i]).epoch == (_map_->epoch) ? (_map_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
+        {
+            size_t key = _map_->buffer[i].key;
+            size_t value = _map_->buffer[i].value;
+            hm_insert(_new_map_, key, value);
+        }
+    }
+    if (_map_->count != _new_map_->count)
+    {
+        hm_free(_new_map_);
+        _map_->flag = CMC_FLAG_ERROR;
+        return 0;
+    }
+    struct hashmap_entry *tmp_b = _map_->buffer;
+    _map_->buffer = _new_map_->buffer;
+    _new_map_->buffer = tmp_b;
+    size_t tmp_c = _map_->capacity;
+    _map_->capacity = _new_map_->capacity;
+    _new_map_->capacity = tmp_c;
+    uint16_t tmp_e = _map_->epoch;
+    _map_->epoch = _new_map_->epoch;
+    _new_map_->epoch = tmp_e;
+    _new_map_->f_key = &(struct hashmap_fkey){ ((void *)0) };
+    _new_map_->f_val = &(struct hashmap_fval){ ((void *)0) };
+    hm_free(_new_map_);
+    return 1;
+}
+static void hm_impl_shrink(struct hashmap *_map_)
+{
+    size_t capacity = _map_->count * 2;
+    if (hm_impl_calculate_size(capacity / _map_->load) < _map_->capacity)
+    {
+        if (hm_impl_rehash(_map_, capacity))
+            if ((_map_)->callbacks && (_map_)->callbacks->resize)
+                (_map_)->callbacks->resize();
+        ;
+    }
+    _map_->flag = CMC_FLAG_OK;
+}
 static size_t hm_impl_calculate_size(size_t required)
 {
     const size_t count = sizeof(cmc_hashtable_primes) / sizeof(cmc_hashtable_primes[0]);
@@ -522,7 +603,7 @@ void hm_release(struct hashmap _map_)
         for (size_t i = 0; i < _map_.capacity; i++)
         {
             struct hashmap_entry *entry = &(_map_.buffer[i]);
-            if (entry->state == CMC_ES_FILLED)
+            if (((*entry).epoch == (_map_.epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 if (_map_.f_key->free)
                     _map_.f_key->free(entry->key);
@@ -547,7 +628,7 @@ struct hashmap_iter hm_iter_start(struct hashmap *target)
     {
         for (size_t i = 0; i < target->capacity; i++)
         {
-            if (target->buffer[i].state == CMC_ES_FILLED)
+            if (((target->buffer[i]).epoch == (target->epoch) ? (target->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.first = i;
                 break;
@@ -556,7 +637,7 @@ struct hashmap_iter hm_iter_start(struct hashmap *target)
         iter.cursor = iter.first;
         for (size_t i = target->capacity; i > 0; i--)
         {
-            if (target->buffer[i - 1].state == CMC_ES_FILLED)
+            if (((target->buffer[i - 1]).epoch == (target->epoch) ? (target->buffer[i - 1]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.last = i - 1;
                 break;
@@ -579,7 +660,7 @@ struct hashmap_iter hm_iter_end(struct hashmap *target)
     {
         for (size_t i = 0; i < target->capacity; i++)
         {
-            if (target->buffer[i].state == CMC_ES_FILLED)
+            if (((target->buffer[i]).epoch == (target->epoch) ? (target->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.first = i;
                 break;
@@ -587,7 +668,7 @@ struct hashmap_iter hm_iter_end(struct hashmap *target)
         }
         for (size_t i = target->capacity; i > 0; i--)
         {
-            if (target->buffer[i - 1].state == CMC_ES_FILLED)
+            if (((target->buffer[i - 1]).epoch == (target->epoch) ? (target->buffer[i - 1]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.last = i - 1;
                 break;
@@ -646,7 +727,7 @@ _Bool hm_iter_next(struct hashmap_iter *iter)
     {
         iter->cursor++;
         scan = &(iter->target->buffer[iter->cursor]);
-        if (scan->state == CMC_ES_FILLED)
+        if (((*scan).epoch == (iter->target->epoch) ? (*scan).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             break;
     }
     return 1;
@@ -667,7 +748,7 @@ _Bool hm_iter_prev(struct hashmap_iter *iter)
     {
         iter->cursor--;
         scan = &(iter->target->buffer[iter->cursor]);
-        if (scan->state == CMC_ES_FILLED)
+        if (((*scan).epoch == (iter->target->epoch) ? (*scan).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             break;
     }
     return 1;
@@ -763,7 +844,7 @@ _Bool hm_print(struct hashmap *_map_, FILE *fptr, const char *start, const char
     size_t last = 0;
     for (size_t i = _map_->capacity; i > 0; i--)
     {
-        if ((_map_->buffer[i - 1]).state == CMC_ES_FILLED)
+        if (((_map_->buffer[i - 1]).epoch == (_map_->epoch) ? (_map_->buffer[i - 1]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             last = i - 1;
             break;
@@ -772,7 +853,7 @@ _Bool hm_print(struct hashmap *_map_, FILE *fptr, const char *start, const char
     for (size_t i = 0; i < _map_->capacity; i++)
     {
         struct hashmap_entry *entry = &(_map_->buffer[i]);
-        if (entry->state == CMC_ES_FILLED)
+        if (((*entry).epoch == (_map_->epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (!_map_->f_key->str(fptr, entry->key))
                 return 0;
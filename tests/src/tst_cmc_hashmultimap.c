@@ -4,6 +4,8 @@
 struct hashmultimap_entry *hmm_impl_new_entry(struct hashmultimap *_map_, size_t key, size_t value);
 struct hashmultimap_entry *hmm_impl_get_entry(struct hashmultimap *_map_, size_t key);
 size_t hmm_impl_key_count(struct hashmultimap *_map_, size_t key);
+_Bool hmm_impl_rehash(struct hashmultimap *_map_, size_t capacity);
+void hmm_impl_shrink(struct hashmultimap *_map_);
 size_t hmm_impl_calculate_size(size_t required);
 struct hashmultimap *hmm_new(size_t capacity, double load, struct hashmultimap_fkey *f_key,
                              struct hashmultimap_fval *f_val)
@@ -36,6 +38,7 @@ struct hashmultimap *hmm_new_custom(size_t capacity, double load, struct hashmul
     _map_->count = 0;
     _map_->capacity = real_capacity;
     _map_->load = load;
+    _map_->shrink = 0;
     _map_->flag = CMC_FLAG_OK;
     _map_->f_key = f_key;
     _map_->f_val = f_val;
@@ -271,6 +274,8 @@ _Bool hmm_remove(struct hashmultimap *_map_, size_t key, size_t *out_value)
     if ((_map_)->callbacks && (_map_)->callbacks->delete)
         (_map_)->callbacks->delete ();
     ;
+    if ((double)_map_->count < (double)_map_->capacity * _map_->shrink)
+        hmm_impl_shrink(_map_);
     return 1;
 }
 size_t hmm_remove_all(struct hashmultimap *_map_, size_t key, size_t **out_values)
@@ -344,6 +349,8 @@ size_t hmm_remove_all(struct hashmultimap *_map_, size_t key, size_t **out_value
     if ((_map_)->callbacks && (_map_)->callbacks->delete)
         (_map_)->callbacks->delete ();
     ;
+    if ((double)_map_->count < (double)_map_->capacity * _map_->shrink)
+        hmm_impl_shrink(_map_);
     return index;
 }
 _Bool hmm_max(struct hashmultimap *_map_, size_t *key, size_t *value)
@@ -517,43 +524,37 @@ _Bool hmm_resize(struct hashmultimap *_map_, size_t capacity)
         _map_->flag = CMC_FLAG_INVALID;
         return 0;
     }
-    struct hashmultimap *_new_map_ =
-        hmm_new_custom(capacity, _map_->load, _map_->f_key, _map_->f_val, _map_->alloc, ((void *)0));
-    if (!_new_map_)
-    {
-        _map_->flag = CMC_FLAG_ALLOC;
-        return 0;
-    }
-    for (size_t i = 0; i < _map_->capacity; i++)
-    {
-        struct hashmultimap_entry *scan = _map_->buffer[i][0];
-        while (scan)
-        {
-            hmm_insert(_new_map_, scan->key, scan->value);
-            scan = scan->next;
-        }
-    }
-    if (_map_->count != _new_map_->count)
-    {
-        hmm_free(_new_map_);
-        _map_->flag = CMC_FLAG_ERROR;
+    if (!hmm_impl_rehash(_map_, capacity))
         return 0;
-    }
-    struct hashmultimap_entry *(*tmp_b)[2] = _map_->buffer;
-    _map_->buffer = _new_map_->buffer;
-    _new_map_->buffer = tmp_b;
-    size_t tmp_c = _map_->capacity;
-    _map_->capacity = _new_map_->capacity;
-    _new_map_->capacity = tmp_c;
-    _new_map_->f_key = &(struct hashmultimap_fkey){ ((void *)0) };
-    _new_map_->f_val = &(struct hashmultimap_fval){ ((void *)0) };
-    hmm_free(_new_map_);
 success:
     if ((_map_)->callbacks && (_map_)->callbacks->resize)
         (_map_)->callbacks->resize();
     ;
     return 1;
 }
+_Bool hmm_shrink_to_fit(struct hashmultimap *_map_)
+{
+    _map_->flag = CMC_FLAG_OK;
+    if (hmm_impl_calculate_size(_map_->count / _map_->load) >= _map_->capacity)
+        return 1;
+    if (!hmm_impl_rehash(_map_, _map_->count))
+        return 0;
+    if ((_map_)->callbacks && (_map_)->callbacks->resize)
+        (_map_)->callbacks->resize();
+    ;
+    return 1;
+}
+_Bool hmm_set_shrink(struct hashmultimap *_map_, double shrink)
+{
+    if (shrink < 0 || shrink >= _map_->load / 2)
+    {
+        _map_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    _map_->shrink = shrink;
+    _map_->flag = CMC_FLAG_OK;
+    return 1;
+}
 struct hashmultimap *hmm_copy_of(struct hashmultimap *_map_)
 {
     struct hashmultimap *result = hmm_new_custom(_map_->capacity * _map_->load, _map_->load, _map_->f_key, _map_->f_val,
@@ -582,6 +583,7 @@ struct hashmultimap *hmm_copy_of(struct hashmultimap *_map_)
             scan = scan->next;
         }
     }
+    result->shrink = _map_->shrink;
     (result)->callbacks = _map_->callbacks;
     _map_->flag = CMC_FLAG_OK;
     return result;
@@ -646,6 +648,55 @@ size_t hmm_impl_key_count(struct hashmultimap *_map_, size_t key)
     }
     return total_count;
 }
+_Bool hmm_impl_rehash(struct hashmultimap *_map_, size_t capacity)
+{
+    if (capacity == 0)
+        capacity = 1;
+    struct hashmultimap *_new_map_ =
+        hmm_new_custom(capacity, _map_->load, _map_->f_key, _map_->f_val, _map_->alloc, ((void *)0));
+    if (!_new_map_)
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    for (size_t i = 0; i < _map_->capacity; i++)
+    {
+        struct hashmultimap_entry *scan = _map_->buffer[i][0];
+        while (scan)
+        {
+            hmm_insert(_new_map_, scan->key, scan->value);
+            scan = scan->next;
+        }
+    }
+    if (_map_->count != _new_map_->count)
+    {
+        hmm_free(_new_map_);
+        _map_->flag = CMC_FLAG_ERROR;
+        return 0;
+    }
+    struct hashmultimap_entry *(*tmp_b)[2] = _map_->buffer;
+    _map_->buffer = _new_map_->buffer;
+    _new_map_->buffer = tmp_b;
+    size_t tmp_c = _map_->capacity;
+    _map_->capacity = _new_map_->capacity;
+    _new_map_->capacity = tmp_c;
+    _new_map_->f_key = &(struct hashmultimap_fkey){ ((void *)0) };
+    _new_map_->f_val = &(struct hashmultimap_fval){ ((void *)0) };
+    hmm_free(_new_map_);
+    return 1;
+}
+void hmm_impl_shrink(struct hashmultimap *_map_)
+{
+    size_t capacity = _map_->count * 2;
+    if (hmm_impl_calculate_size(capacity / _map_->load) < _map_->capacity)
+    {
+        if (hmm_impl_rehash(_map_, capacity))
+            if ((_map_)->callbacks && (_map_)->callbacks->resize)
+                (_map_)->callbacks->resize();
+        ;
+    }
+    _map_->flag = CMC_FLAG_OK;
+}
 size_t hmm_impl_calculate_size(size_t required)
 {
     const size_t count = sizeof(cmc_hashtable_primes) / sizeof(cmc_hashtable_primes[0]);
@@ -35,6 +35,7 @@ struct hashmultiset *hms_new_custom(size_t capacity, double load, struct hashmul
     _set_->cardinality = 0;
     _set_->capacity = real_capacity;
     _set_->load = load;
+    _set_->epoch = 0;
     _set_->flag = CMC_FLAG_OK;
     _set_->f_val = f_val;
     _set_->alloc = alloc;
@@ -48,13 +49,19 @@ void hms_clear(struct hashmultiset *_set_)
         for (size_t i = 0; i < _set_->capacity; i++)
         {
             struct hashmultiset_entry *entry = &(_set_->buffer[i]);
-            if (entry->state == CMC_ES_FILLED)
+            if (((*entry).epoch == (_set_->epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 _set_->f_val->free(entry->value);
             }
         }
     }
-    memset(_set_->buffer, 0, sizeof(struct hashmultiset_entry) * _set_->capacity);
+    if (_set_->epoch == (65535))
+    {
+        memset(_set_->buffer, 0, sizeof(struct hashmultiset_entry) * _set_->capacity);
+        _set_->epoch = 0;
+    }
+    else
+        _set_->epoch++;
     _set_->count = 0;
     _set_->flag = CMC_FLAG_OK;
 }
@@ -65,7 +72,7 @@ void hms_free(struct hashmultiset *_set_)
         for (size_t i = 0; i < _set_->capacity; i++)
         {
             struct hashmultiset_entry *entry = &(_set_->buffer[i]);
-            if (entry->state == CMC_ES_FILLED)
+            if (((*entry).epoch == (_set_->epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 _set_->f_val->free(entry->value);
             }
@@ -222,7 +229,7 @@ _Bool hms_max(struct hashmultiset *_set_, size_t *value)
     size_t max_val = (size_t){ 0 };
     for (size_t i = 0; i < _set_->capacity; i++)
     {
-        if (_set_->buffer[i].state == CMC_ES_FILLED)
+        if (((_set_->buffer[i]).epoch == (_set_->epoch) ? (_set_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (first)
             {
@@ -254,7 +261,7 @@ _Bool hms_min(struct hashmultiset *_set_, size_t *value)
     size_t min_val = (size_t){ 0 };
     for (size_t i = 0; i < _set_->capacity; i++)
     {
-        if (_set_->buffer[i].state == CMC_ES_FILLED)
+        if (((_set_->buffer[i]).epoch == (_set_->epoch) ? (_set_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (first)
             {
@@ -349,7 +356,7 @@ _Bool hms_resize(struct hashmultiset *_set_, size_t capacity)
     }
     for (size_t i = 0; i < _set_->capacity; i++)
     {
-        if (_set_->buffer[i].state == CMC_ES_FILLED)
+        if (((_set_->buffer[i]).epoch == (_set_->epoch) ? (_set_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             size_t value = _set_->buffer[i].value;
             size_t multiplicity = _set_->buffer[i].multiplicity;
@@ -369,6 +376,9 @@ _Bool hms_resize(struct hashmultiset *_set_, size_t capacity)
     size_t tmp_c = _set_->capacity;
     _set_->capacity = _new_set_->capacity;
     _new_set_->capacity = tmp_c;
+    uint16_t tmp_e = _set_->epoch;
+    _set_->epoch = _new_set_->epoch;
+    _new_set_->epoch = tmp_e;
     _new_set_->f_val = &(struct hashmultiset_fval){ ((void *)0) };
     hms_free(_new_set_);
 success:
@@ -392,14 +402,15 @@ struct hashmultiset *hms_copy_of(struct hashmultiset *_set_)
         for (size_t i = 0; i < _set_->capacity; i++)
         {
             struct hashmultiset_entry *scan = &(_set_->buffer[i]);
-            if (scan->state != CMC_ES_EMPTY)
+            if (((*scan).epoch == (_set_->epoch) ? (*scan).state : CMC_ES_EMPTY) != CMC_ES_EMPTY)
             {
                 struct hashmultiset_entry *target = &(result->buffer[i]);
-                if (scan->state == CMC_ES_DELETED)
+                target->epoch = result->epoch;
+                if (((*scan).epoch == (_set_->epoch) ? (*scan).state : CMC_ES_EMPTY) == CMC_ES_DELETED)
                     target->state = CMC_ES_DELETED;
                 else
                 {
-                    target->state = scan->state;
+                    target->state = CMC_ES_FILLED;
                     target->dist = scan->dist;
                     target->multiplicity = scan->multiplicity;
                     target->value = _set_->f_val->cpy(scan->value);
@@ -408,7 +419,10 @@ struct hashmultiset *hms_copy_of(struct hashmultiset *_set_)
         }
     }
     else
+    {
         memcpy(result->buffer, _set_->buffer, sizeof(struct hashmultiset_entry) * _set_->capacity);
+        result->epoch = _set_->epoch;
+    }
     result->count = _set_->count;
     result->cardinality = _set_->cardinality;
     _set_->flag = CMC_FLAG_OK;
@@ -430,7 +444,7 @@ _Bool hms_equals(struct hashmultiset *_set1_, struct hashmultiset *_set2_)
     _set_b_ = _set_a_ == _set1_ ? _set2_ : _set1_;
     for (size_t i = 0; i < _set_a_->capacity; i++)
     {
-        if (_set_a_->buffer[i].state == CMC_ES_FILLED)
+        if (((_set_a_->buffer[i]).epoch == (_set_a_->epoch) ? (_set_a_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             struct hashmultiset_entry *entry_a = &(_set_a_->buffer[i]);
             struct hashmultiset_entry *entry_b = hms_impl_get_entry(_set_b_, entry_a->value);
@@ -469,12 +483,13 @@ static struct hashmultiset_entry *hms_impl_insert_and_return(struct hashmultiset
     size_t curr_mul = 1;
     struct hashmultiset_entry *target = &(_set_->buffer[pos]);
     struct hashmultiset_entry *to_return = ((void *)0);
-    if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED)
+    if (((*target).epoch == (_set_->epoch) ? (*target).state : CMC_ES_EMPTY) != CMC_ES_FILLED)
     {
         target->value = value;
         target->multiplicity = curr_mul;
         target->dist = pos - original_pos;
         target->state = CMC_ES_FILLED;
+        target->epoch = _set_->epoch;
         to_return = target;
     }
     else
@@ -483,12 +498,13 @@ static struct hashmultiset_entry *hms_impl_insert_and_return(struct hashmultiset
         {
             pos++;
             target = &(_set_->buffer[pos % _set_->capacity]);
-            if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED)
+            if (((*target).epoch == (_set_->epoch) ? (*target).state : CMC_ES_EMPTY) != CMC_ES_FILLED)
             {
                 target->value = value;
                 target->multiplicity = curr_mul;
                 target->dist = pos - original_pos;
                 target->state = CMC_ES_FILLED;
+                target->epoch = _set_->epoch;
                 if (!to_return)
                     to_return = target;
                 break;
@@ -517,7 +533,7 @@ static struct hashmultiset_entry *hms_impl_get_entry(struct hashmultiset *_set_,
     size_t hash = _set_->f_val->hash(value);
     size_t pos = hash % _set_->capacity;
     struct hashmultiset_entry *target = &(_set_->buffer[pos]);
-    while (target->state == CMC_ES_FILLED || target->state == CMC_ES_DELETED)
+    while (((*target).epoch == (_set_->epoch) ? (*target).state : CMC_ES_EMPTY) != CMC_ES_EMPTY)
     {
         if (_set_->f_val->cmp(target->value, value) == 0)
             return target;
@@ -550,7 +566,7 @@ struct hashmultiset_iter hms_iter_start(struct hashmultiset *target)
     {
         for (size_t i = 0; i < target->capacity; i++)
         {
-            if (target->buffer[i].state == CMC_ES_FILLED)
+            if (((target->buffer[i]).epoch == (target->epoch) ? (target->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.first = i;
                 break;
@@ -559,7 +575,7 @@ struct hashmultiset_iter hms_iter_start(struct hashmultiset *target)
         iter.cursor = iter.first;
         for (size_t i = target->capacity; i > 0; i--)
         {
-            if (target->buffer[i - 1].state == CMC_ES_FILLED)
+            if (((target->buffer[i - 1]).epoch == (target->epoch) ? (target->buffer[i - 1]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.last = i - 1;
                 break;
@@ -582,7 +598,7 @@ struct hashmultiset_iter hms_iter_end(struct hashmultiset *target)
     {
         for (size_t i = 0; i < target->capacity; i++)
         {
-            if (target->buffer[i].state == CMC_ES_FILLED)
+            if (((target->buffer[i]).epoch == (target->epoch) ? (target->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.first = i;
                 break;
@@ -590,7 +606,7 @@ struct hashmultiset_iter hms_iter_end(struct hashmultiset *target)
         }
         for (size_t i = target->capacity; i > 0; i--)
         {
-            if (target->buffer[i - 1].state == CMC_ES_FILLED)
+            if (((target->buffer[i - 1]).epoch == (target->epoch) ? (target->buffer[i - 1]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.last = i - 1;
                 break;
@@ -649,7 +665,7 @@ _Bool hms_iter_next(struct hashmultiset_iter *iter)
     {
         iter->cursor++;
         scan = &(iter->target->buffer[iter->cursor]);
-        if (scan->state == CMC_ES_FILLED)
+        if (((*scan).epoch == (iter->target->epoch) ? (*scan).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             break;
     }
     return 1;
@@ -670,7 +686,7 @@ _Bool hms_iter_prev(struct hashmultiset_iter *iter)
     {
         iter->cursor--;
         scan = &(iter->target->buffer[iter->cursor]);
-        if (scan->state == CMC_ES_FILLED)
+        if (((*scan).epoch == (iter->target->epoch) ? (*scan).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             break;
     }
     return 1;
@@ -943,7 +959,7 @@ _Bool hms_print(struct hashmultiset *_set_, FILE *fptr, const char *start, const
     size_t last = 0;
     for (size_t i = _set_->capacity; i > 0; i--)
     {
-        if ((_set_->buffer[i - 1]).state == CMC_ES_FILLED)
+        if (((_set_->buffer[i - 1]).epoch == (_set_->epoch) ? (_set_->buffer[i - 1]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             last = i - 1;
             break;
@@ -952,7 +968,7 @@ _Bool hms_print(struct hashmultiset *_set_, FILE *fptr, const char *start, const
     for (size_t i = 0; i < _set_->capacity; i++)
     {
         struct hashmultiset_entry *entry = &(_set_->buffer[i]);
-        if (entry->state == CMC_ES_FILLED)
+        if (((*entry).epoch == (_set_->epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (!_set_->f_val->str(fptr, entry->value))
                 return 0;
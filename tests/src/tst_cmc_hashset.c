@@ -2,6 +2,8 @@
 #include "tst_cmc_hashset.h"
 
 static struct hashset_entry *hs_impl_get_entry(struct hashset *_set_, size_t value);
+static _Bool hs_impl_rehash(struct hashset *_set_, size_t capacity);
+static void hs_impl_shrink(struct hashset *_set_);
 static size_t hs_impl_calculate_size(size_t required);
 struct hashset *hs_new(size_t capacity, double load, struct hashset_fval *f_val)
 {
@@ -32,6 +34,8 @@ struct hashset *hs_new_custom(size_t capacity, double load, struct hashset_fval
     _set_->count = 0;
     _set_->capacity = real_capacity;
     _set_->load = load;
+    _set_->shrink = 0;
+    _set_->epoch = 0;
     _set_->flag = CMC_FLAG_OK;
     _set_->f_val = f_val;
     _set_->alloc = alloc;
@@ -45,13 +49,19 @@ void hs_clear(struct hashset *_set_)
         for (size_t i = 0; i < _set_->capacity; i++)
         {
             struct hashset_entry *entry = &(_set_->buffer[i]);
-            if (entry->state == CMC_ES_FILLED)
+            if (((*entry).epoch == (_set_->epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 _set_->f_val->free(entry->value);
             }
         }
     }
-    memset(_set_->buffer, 0, sizeof(struct hashset_entry) * _set_->capacity);
+    if (_set_->epoch == (65535))
+    {
+        memset(_set_->buffer, 0, sizeof(struct hashset_entry) * _set_->capacity);
+        _set_->epoch = 0;
+    }
+    else
+        _set_->epoch++;
     _set_->count = 0;
     _set_->flag = CMC_FLAG_OK;
 }
@@ -62,7 +72,7 @@ void hs_free(struct hashset *_set_)
         for (size_t i = 0; i < _set_->capacity; i++)
         {
             struct hashset_entry *entry = &(_set_->buffer[i]);
-            if (entry->state == CMC_ES_FILLED)
+            if (((*entry).epoch == (_set_->epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 _set_->f_val->free(entry->value);
             }
@@ -97,11 +107,12 @@ _Bool hs_insert(struct hashset *_set_, size_t value)
     size_t original_pos = hash % _set_->capacity;
     size_t pos = original_pos;
     struct hashset_entry *target = &(_set_->buffer[pos]);
-    if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED)
+    if (((*target).epoch == (_set_->epoch) ? (*target).state : CMC_ES_EMPTY) != CMC_ES_FILLED)
     {
         target->value = value;
         target->dist = 0;
         target->state = CMC_ES_FILLED;
+        target->epoch = _set_->epoch;
     }
     else
     {
@@ -109,11 +120,12 @@ _Bool hs_insert(struct hashset *_set_, size_t value)
         {
             pos++;
             target = &(_set_->buffer[pos % _set_->capacity]);
-            if (target->state == CMC_ES_EMPTY || target->state == CMC_ES_DELETED)
+            if (((*target).epoch == (_set_->epoch) ? (*target).state : CMC_ES_EMPTY) != CMC_ES_FILLED)
             {
                 target->value = value;
                 target->dist = pos - original_pos;
                 target->state = CMC_ES_FILLED;
+                target->epoch = _set_->epoch;
                 break;
             }
             else if (target->dist < pos - original_pos)
@@ -155,6 +167,8 @@ _Bool hs_remove(struct hashset *_set_, size_t value)
     if ((_set_)->callbacks && (_set_)->callbacks->delete)
         (_set_)->callbacks->delete ();
     ;
+    if ((double)_set_->count < (double)_set_->capacity * _set_->shrink)
+        hs_impl_shrink(_set_);
     return 1;
 }
 _Bool hs_max(struct hashset *_set_, size_t *value)
@@ -168,7 +182,7 @@ _Bool hs_max(struct hashset *_set_, size_t *value)
     size_t max_val = (size_t){ 0 };
     for (size_t i = 0; i < _set_->capacity; i++)
     {
-        if (_set_->buffer[i].state == CMC_ES_FILLED)
+        if (((_set_->buffer[i]).epoch == (_set_->epoch) ? (_set_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (first)
             {
@@ -200,7 +214,7 @@ _Bool hs_min(struct hashset *_set_, size_t *value)
     size_t min_val = (size_t){ 0 };
     for (size_t i = 0; i < _set_->capacity; i++)
     {
-        if (_set_->buffer[i].state == CMC_ES_FILLED)
+        if (((_set_->buffer[i]).epoch == (_set_->epoch) ? (_set_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (first)
             {
@@ -272,40 +286,37 @@ _Bool hs_resize(struct hashset *_set_, size_t capacity)
         _set_->flag = CMC_FLAG_INVALID;
         return 0;
     }
-    struct hashset *_new_set_ = hs_new_custom(capacity, _set_->load, _set_->f_val, _set_->alloc, ((void *)0));
-    if (!_new_set_)
-    {
-        _set_->flag = CMC_FLAG_ALLOC;
+    if (!hs_impl_rehash(_set_, capacity))
         return 0;
-    }
-    for (size_t i = 0; i < _set_->capacity; i++)
-    {
-        if (_set_->buffer[i].state == CMC_ES_FILLED)
-        {
-            size_t value = _set_->buffer[i].value;
-            hs_insert(_new_set_, value);
-        }
-    }
-    if (_set_->count != _new_set_->count)
-    {
-        hs_free(_new_set_);
-        _set_->flag = CMC_FLAG_ERROR;
-        return 0;
-    }
-    struct hashset_entry *tmp_b = _set_->buffer;
-    _set_->buffer = _new_set_->buffer;
-    _new_set_->buffer = tmp_b;
-    size_t tmp_c = _set_->capacity;
-    _set_->capacity = _new_set_->capacity;
-    _new_set_->capacity = tmp_c;
-    _new_set_->f_val = &(struct hashset_fval){ ((void *)0) };
-    hs_free(_new_set_);
 success:
     if ((_set_)->callbacks && (_set_)->callbacks->resize)
         (_set_)->callbacks->resize();
     ;
     return 1;
 }
+_Bool hs_shrink_to_fit(struct hashset *_set_)
+{
+    _set_->flag = CMC_FLAG_OK;
+    if (hs_impl_calculate_size(_set_->count / _set_->load) >= _set_->capacity)
+        return 1;
+    if (!hs_impl_rehash(_set_, _set_->count))
+        return 0;
+    if ((_set_)->callbacks && (_set_)->callbacks->resize)
+        (_set_)->callbacks->resize();
+    ;
+    return 1;
+}
+_Bool hs_set_shrink(struct hashset *_set_, double shrink)
+{
+    if (shrink < 0 || shrink >= _set_->load / 2)
+    {
+        _set_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    _set_->shrink = shrink;
+    _set_->flag = CMC_FLAG_OK;
+    return 1;
+}
 struct hashset *hs_copy_of(struct hashset *_set_)
 {
     struct hashset *result =
@@ -321,14 +332,15 @@ struct hashset *hs_copy_of(struct hashset *_set_)
         for (size_t i = 0; i < _set_->capacity; i++)
         {
             struct hashset_entry *scan = &(_set_->buffer[i]);
-            if (scan->state != CMC_ES_EMPTY)
+            if (((*scan).epoch == (_set_->epoch) ? (*scan).state : CMC_ES_EMPTY) != CMC_ES_EMPTY)
             {
                 struct hashset_entry *target = &(result->buffer[i]);
-                if (scan->state == CMC_ES_DELETED)
+                target->epoch = result->epoch;
+                if (((*scan).epoch == (_set_->epoch) ? (*scan).state : CMC_ES_EMPTY) == CMC_ES_DELETED)
                     target->state = CMC_ES_DELETED;
                 else
                 {
-                    target->state = scan->state;
+                    target->state = CMC_ES_FILLED;
                     target->dist = scan->dist;
                     target->value = _set_->f_val->cpy(scan->value);
                 }
@@ -336,8 +348,12 @@ struct hashset *hs_copy_of(struct hashset *_set_)
         }
     }
     else
+    {
         memcpy(result->buffer, _set_->buffer, sizeof(struct hashset_entry) * _set_->capacity);
+        result->epoch = _set_->epoch;
+    }
     result->count = _set_->count;
+    result->shrink = _set_->shrink;
     _set_->flag = CMC_FLAG_OK;
     return result;
 }
@@ -353,7 +369,7 @@ _Bool hs_equals(struct hashset *_set1_, struct hashset *_set2_)
     _set_b_ = _set_a_ == _set1_ ? _set2_ : _set1_;
     for (size_t i = 0; i < _set_a_->capacity; i++)
     {
-        if (_set_a_->buffer[i].state == CMC_ES_FILLED)
+        if (((_set_a_->buffer[i]).epoch == (_set_a_->epoch) ? (_set_a_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (!hs_impl_get_entry(_set_b_, _set_a_->buffer[i].value))
                 return 0;
@@ -366,7 +382,7 @@ static struct hashset_entry *hs_impl_get_entry(struct hashset *_set_, size_t val
     size_t hash = _set_->f_val->hash(value);
     size_t pos = hash % _set_->capacity;
     struct hashset_entry *target = &(_set_->buffer[pos]);
-    while (target->state == CMC_ES_FILLED || target->state == CMC_ES_DELETED)
+    while (((*target).epoch == (_set_->epoch) ? (*target).state : CMC_ES_EMPTY) != CMC_ES_EMPTY)
     {
         if (_set_->f_val->cmp(target->value, value) == 0)
             return target;
@@ -375,6 +391,55 @@ static struct hashset_entry *hs_impl_get_entry(struct hashset *_set_, size_t val
     }
     return ((void *)0);
 }
+static _Bool hs_impl_rehash(struct hashset *_set_, size_t capacity)
+{
+    if (capacity == 0)
+        capacity = 1;
+    struct hashset *_new_set_ = hs_new_custom(capacity, _set_->load, _set_->f_val, _set_->alloc, ((void *)0));
+    if (!_new_set_)
+    {
+        _set_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    for (size_t i = 0; i < _set_->capacity; i++)
+    {
+        if (((_set_->buffer[i]).epoch == (_set_->epoch) ? (_set_->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
+        {
+            size_t value = _set_->buffer[i].value;
+            hs_insert(_new_set_, value);
+        }
+    }
+    if (_set_->count != _new_set_->count)
+    {
+        hs_free(_new_set_);
+        _set_->flag = CMC_FLAG_ERROR;
+        return 0;
+    }
+    struct hashset_entry *tmp_b = _set_->buffer;
+    _set_->buffer = _new_set_->buffer;
+    _new_set_->buffer = tmp_b;
+    size_t tmp_c = _set_->capacity;
+    _set_->capacity = _new_set_->capacity;
+    _new_set_->capacity = tmp_c;
+    uint16_t tmp_e = _set_->epoch;
+    _set_->epoch = _new_set_->epoch;
+    _new_set_->epoch = tmp_e;
+    _new_set_->f_val = &(struct hashset_fval){ ((void *)0) };
+    hs_free(_new_set_);
+    return 1;
+}
+static void hs_impl_shrink(struct hashset *_set_)
+{
+    size_t capacity = _set_->count * 2;
+    if (hs_impl_calculate_size(capacity / _set_->load) < _set_->capacity)
+    {
+        if (hs_impl_rehash(_set_, capacity))
+            if ((_set_)->callbacks && (_set_)->callbacks->resize)
+                (_set_)->callbacks->resize();
+        ;
+    }
+    _set_->flag = CMC_FLAG_OK;
+}
 static size_t hs_impl_calculate_size(size_t required)
 {
     const size_t count = sizeof(cmc_hashtable_primes) / sizeof(cmc_hashtable_primes[0]);
@@ -399,7 +464,7 @@ struct hashset_iter hs_iter_start(struct hashset *target)
     {
         for (size_t i = 0; i < target->capacity; i++)
         {
-            if (target->buffer[i].state == CMC_ES_FILLED)
+            if (((target->buffer[i]).epoch == (target->epoch) ? (target->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.first = i;
                 break;
@@ -408,7 +473,7 @@ struct hashset_iter hs_iter_start(struct hashset *target)
         iter.cursor = iter.first;
         for (size_t i = target->capacity; i > 0; i--)
         {
-            if (target->buffer[i - 1].state == CMC_ES_FILLED)
+            if (((target->buffer[i - 1]).epoch == (target->epoch) ? (target->buffer[i - 1]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.last = i - 1;
                 break;
@@ -431,7 +496,7 @@ struct hashset_iter hs_iter_end(struct hashset *target)
     {
         for (size_t i = 0; i < target->capacity; i++)
         {
-            if (target->buffer[i].state == CMC_ES_FILLED)
+            if (((target->buffer[i]).epoch == (target->epoch) ? (target->buffer[i]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.first = i;
                 break;
@@ -439,7 +504,7 @@ struct hashset_iter hs_iter_end(struct hashset *target)
         }
         for (size_t i = target->capacity; i > 0; i--)
         {
-            if (target->buffer[i - 1].state == CMC_ES_FILLED)
+            if (((target->buffer[i - 1]).epoch == (target->epoch) ? (target->buffer[i - 1]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             {
                 iter.last = i - 1;
                 break;
@@ -498,7 +563,7 @@ _Bool hs_iter_next(struct hashset_iter *iter)
     {
         iter->cursor++;
         scan = &(iter->target->buffer[iter->cursor]);
-        if (scan->state == CMC_ES_FILLED)
+        if (((*scan).epoch == (iter->target->epoch) ? (*scan).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             break;
     }
     return 1;
@@ -519,7 +584,7 @@ _Bool hs_iter_prev(struct hashset_iter *iter)
     {
         iter->cursor--;
         scan = &(iter->target->buffer[iter->cursor]);
-        if (scan->state == CMC_ES_FILLED)
+        if (((*scan).epoch == (iter->target->epoch) ? (*scan).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
             break;
     }
     return 1;
@@ -751,7 +816,7 @@ _Bool hs_print(struct hashset *_set_, FILE *fptr, const char *start, const char
     size_t last = 0;
     for (size_t i = _set_->capacity; i > 0; i--)
     {
-        if ((_set_->buffer[i - 1]).state == CMC_ES_FILLED)
+        if (((_set_->buffer[i - 1]).epoch == (_set_->epoch) ? (_set_->buffer[i - 1]).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             last = i - 1;
             break;
@@ -760,7 +825,7 @@ _Bool hs_print(struct hashset *_set_, FILE *fptr, const char *start, const char
     for (size_t i = 0; i < _set_->capacity; i++)
     {
         struct hashset_entry *entry = &(_set_->buffer[i]);
-        if (entry->state == CMC_ES_FILLED)
+        if (((*entry).epoch == (_set_->epoch) ? (*entry).state : CMC_ES_EMPTY) == CMC_ES_FILLED)
         {
             if (!_set_->f_val->str(fptr, entry->value))
                 return 0;
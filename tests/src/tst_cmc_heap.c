@@ -124,12 +124,19 @@ _Bool h_contains(struct heap *_heap_, size_t value)
 {
     _heap_->flag = CMC_FLAG_OK;
     _Bool result = 0;
-    for (size_t i = 0; i < _heap_->count; i++)
+    if (_heap_->f_val->find)
+    {
+        result = _heap_->f_val->find(_heap_->buffer, _heap_->count, value) < _heap_->count;
+    }
+    else
     {
-        if (_heap_->f_val->cmp(_heap_->buffer[i], value) == 0)
+        for (size_t i = 0; i < _heap_->count; i++)
         {
-            result = 1;
-            break;
+            if (_heap_->f_val->cmp(_heap_->buffer[i], value) == 0)
+            {
+                result = 1;
+                break;
+            }
         }
     }
     if ((_heap_)->callbacks && (_heap_)->callbacks->read)
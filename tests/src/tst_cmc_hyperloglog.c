@@ -0,0 +1,372 @@
+
+#include "tst_cmc_hyperloglog.h"
+
+static _Bool hll_impl_set(struct hyperloglog *_hll_, size_t index, unsigned char rank);
+static unsigned char hll_impl_get(struct hyperloglog *_hll_, size_t index);
+static size_t hll_impl_search(struct hyperloglog *_hll_, size_t index);
+static _Bool hll_impl_to_dense(struct hyperloglog *_hll_);
+static double hll_impl_log(double x);
+struct hyperloglog *hll_new(size_t precision, struct hyperloglog_fval *f_val)
+{
+    return hll_new_custom(precision, f_val, ((void *)0), ((void *)0));
+}
+struct hyperloglog *hll_new_custom(size_t precision, struct hyperloglog_fval *f_val, struct cmc_alloc_node *alloc,
+                                   struct cmc_callbacks *callbacks)
+{
+    ;
+    if (precision < 4 || precision > 16)
+        return ((void *)0);
+    if (!f_val || !f_val->hash)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct hyperloglog *_hll_ = alloc->malloc(sizeof(struct hyperloglog));
+    if (!_hll_)
+        return ((void *)0);
+    size_t capacity = ((size_t)1 << precision) / 8;
+    if (capacity > 16)
+        capacity = 16;
+    _hll_->sparse = alloc->malloc(sizeof(uint32_t) * capacity);
+    if (!_hll_->sparse)
+    {
+        alloc->free(_hll_);
+        return ((void *)0);
+    }
+    _hll_->registers = ((void *)0);
+    _hll_->sparse_count = 0;
+    _hll_->sparse_capacity = capacity;
+    _hll_->precision = precision;
+    _hll_->flag = CMC_FLAG_OK;
+    _hll_->f_val = f_val;
+    _hll_->alloc = alloc;
+    (_hll_)->callbacks = callbacks;
+    return _hll_;
+}
+void hll_clear(struct hyperloglog *_hll_)
+{
+    if (_hll_->registers)
+        memset(_hll_->registers, 0, (size_t)1 << _hll_->precision);
+    _hll_->sparse_count = 0;
+    _hll_->flag = CMC_FLAG_OK;
+}
+void hll_free(struct hyperloglog *_hll_)
+{
+    _hll_->alloc->free(_hll_->registers);
+    _hll_->alloc->free(_hll_->sparse);
+    _hll_->alloc->free(_hll_);
+}
+void hll_customize(struct hyperloglog *_hll_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _hll_->alloc = &cmc_alloc_node_default;
+    else
+        _hll_->alloc = alloc;
+    (_hll_)->callbacks = callbacks;
+    _hll_->flag = CMC_FLAG_OK;
+}
+_Bool hll_add(struct hyperloglog *_hll_, size_t value)
+{
+    uint64_t hash = (uint64_t)_hll_->f_val->hash(value);
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9UL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebUL;
+    hash = hash ^ (hash >> 31);
+    size_t index = (size_t)(hash & (((uint64_t)1 << _hll_->precision) - 1));
+    uint64_t rest = hash >> _hll_->precision;
+    unsigned char rank = 1;
+    while (rest % 2 == 0 && rank <= 64 - _hll_->precision)
+    {
+        rest >>= 1;
+        rank++;
+    }
+    if (!hll_impl_set(_hll_, index, rank))
+        return 0;
+    _hll_->flag = CMC_FLAG_OK;
+    if ((_hll_)->callbacks && (_hll_)->callbacks->create)
+        (_hll_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool hll_add_many(struct hyperloglog *_hll_, size_t *values, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!hll_add(_hll_, values[i]))
+            return 0;
+    }
+    _hll_->flag = CMC_FLAG_OK;
+    return 1;
+}
+_Bool hll_merge(struct hyperloglog *_hll1_, struct hyperloglog *_hll2_)
+{
+    if (_hll1_->precision != _hll2_->precision)
+    {
+        _hll1_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    if (_hll2_->registers)
+    {
+        if (!_hll1_->registers && !hll_impl_to_dense(_hll1_))
+            return 0;
+        unsigned char *registers1 = _hll1_->registers;
+        unsigned char *registers2 = _hll2_->registers;
+        size_t count = (size_t)1 << _hll1_->precision;
+        for (size_t i = 0; i < count; i++)
+            registers1[i] = registers1[i] < registers2[i] ? registers2[i] : registers1[i];
+    }
+    else
+    {
+        for (size_t i = 0; i < _hll2_->sparse_count; i++)
+        {
+            uint32_t entry = _hll2_->sparse[i];
+            if (!hll_impl_set(_hll1_, ((size_t)((entry) >> 8)), ((unsigned char)((entry)&0xFF))))
+                return 0;
+        }
+    }
+    _hll1_->flag = CMC_FLAG_OK;
+    _hll2_->flag = CMC_FLAG_OK;
+    if ((_hll1_)->callbacks && (_hll1_)->callbacks->update)
+        (_hll1_)->callbacks->update();
+    ;
+    return 1;
+}
+size_t hll_estimate(struct hyperloglog *_hll_)
+{
+    size_t count = (size_t)1 << _hll_->precision;
+    size_t zeros = 0;
+    double sum = 0.0;
+    if (_hll_->registers)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (_hll_->registers[i] == 0)
+                zeros++;
+            sum += 1.0 / (double)((uint64_t)1 << _hll_->registers[i]);
+        }
+    }
+    else
+    {
+        zeros = count - _hll_->sparse_count;
+        sum = (double)zeros;
+        for (size_t i = 0; i < _hll_->sparse_count; i++)
+            sum += 1.0 / (double)((uint64_t)1 << ((unsigned char)((_hll_->sparse[i])&0xFF)));
+    }
+    double m = (double)count;
+    double alpha;
+    if (count == 16)
+        alpha = 0.673;
+    else if (count == 32)
+        alpha = 0.697;
+    else if (count == 64)
+        alpha = 0.709;
+    else
+        alpha = 0.7213 / (1.0 + 1.079 / m);
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zeros > 0)
+        estimate = m * hll_impl_log(m / (double)zeros);
+    _hll_->flag = CMC_FLAG_OK;
+    if ((_hll_)->callbacks && (_hll_)->callbacks->read)
+        (_hll_)->callbacks->read();
+    ;
+    return (size_t)(estimate + 0.5);
+}
+_Bool hll_sparse(struct hyperloglog *_hll_)
+{
+    return _hll_->registers == ((void *)0);
+}
+size_t hll_precision(struct hyperloglog *_hll_)
+{
+    return _hll_->precision;
+}
+int hll_flag(struct hyperloglog *_hll_)
+{
+    return _hll_->flag;
+}
+struct hyperloglog *hll_copy_of(struct hyperloglog *_hll_)
+{
+    struct hyperloglog *result = hll_new_custom(_hll_->precision, _hll_->f_val, _hll_->alloc, ((void *)0));
+    if (!result)
+    {
+        _hll_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    (result)->callbacks = _hll_->callbacks;
+    if (_hll_->registers)
+    {
+        if (!hll_impl_to_dense(result))
+        {
+            hll_free(result);
+            _hll_->flag = CMC_FLAG_ALLOC;
+            return ((void *)0);
+        }
+        memcpy(result->registers, _hll_->registers, (size_t)1 << _hll_->precision);
+    }
+    else
+    {
+        for (size_t i = 0; i < _hll_->sparse_count; i++)
+        {
+            uint32_t entry = _hll_->sparse[i];
+            if (!hll_impl_set(result, ((size_t)((entry) >> 8)), ((unsigned char)((entry)&0xFF))))
+            {
+                hll_free(result);
+                _hll_->flag = CMC_FLAG_ALLOC;
+                return ((void *)0);
+            }
+        }
+    }
+    _hll_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool hll_equals(struct hyperloglog *_hll1_, struct hyperloglog *_hll2_)
+{
+    _hll1_->flag = CMC_FLAG_OK;
+    _hll2_->flag = CMC_FLAG_OK;
+    if (_hll1_->precision != _hll2_->precision)
+        return 0;
+    size_t count = (size_t)1 << _hll1_->precision;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (hll_impl_get(_hll1_, i) != hll_impl_get(_hll2_, i))
+            return 0;
+    }
+    return 1;
+}
+static _Bool hll_impl_set(struct hyperloglog *_hll_, size_t index, unsigned char rank)
+{
+    if (_hll_->registers)
+    {
+        if (_hll_->registers[index] < rank)
+            _hll_->registers[index] = rank;
+        return 1;
+    }
+    size_t i = hll_impl_search(_hll_, index);
+    if (i < _hll_->sparse_count && ((size_t)((_hll_->sparse[i]) >> 8)) == index)
+    {
+        if (((unsigned char)((_hll_->sparse[i])&0xFF)) < rank)
+            _hll_->sparse[i] = (((uint32_t)(index) << 8) | (uint32_t)(rank));
+        return 1;
+    }
+    if (_hll_->sparse_count == _hll_->sparse_capacity)
+    {
+        size_t limit = ((size_t)1 << _hll_->precision) / 8;
+        if (_hll_->sparse_capacity == limit)
+        {
+            if (!hll_impl_to_dense(_hll_))
+                return 0;
+            _hll_->registers[index] = rank;
+            return 1;
+        }
+        size_t capacity = _hll_->sparse_capacity * 2;
+        if (capacity > limit)
+            capacity = limit;
+        uint32_t *new_sparse = _hll_->alloc->realloc(_hll_->sparse, sizeof(uint32_t) * capacity);
+        if (!new_sparse)
+        {
+            _hll_->flag = CMC_FLAG_ALLOC;
+            return 0;
+        }
+        _hll_->sparse = new_sparse;
+        _hll_->sparse_capacity = capacity;
+    }
+    memmove(_hll_->sparse + i + 1, _hll_->sparse + i, sizeof(uint32_t) * (_hll_->sparse_count - i));
+    _hll_->sparse[i] = (((uint32_t)(index) << 8) | (uint32_t)(rank));
+    _hll_->sparse_count++;
+    return 1;
+}
+static unsigned char hll_impl_get(struct hyperloglog *_hll_, size_t index)
+{
+    if (_hll_->registers)
+        return _hll_->registers[index];
+    size_t i = hll_impl_search(_hll_, index);
+    if (i < _hll_->sparse_count && ((size_t)((_hll_->sparse[i]) >> 8)) == index)
+        return ((unsigned char)((_hll_->sparse[i])&0xFF));
+    return 0;
+}
+static size_t hll_impl_search(struct hyperloglog *_hll_, size_t index)
+{
+    size_t low = 0;
+    size_t high = _hll_->sparse_count;
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+        if (((size_t)((_hll_->sparse[mid]) >> 8)) < index)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
+static _Bool hll_impl_to_dense(struct hyperloglog *_hll_)
+{
+    unsigned char *registers = _hll_->alloc->calloc((size_t)1 << _hll_->precision, sizeof(unsigned char));
+    if (!registers)
+    {
+        _hll_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    for (size_t i = 0; i < _hll_->sparse_count; i++)
+    {
+        uint32_t entry = _hll_->sparse[i];
+        registers[((size_t)((entry) >> 8))] = ((unsigned char)((entry)&0xFF));
+    }
+    _hll_->alloc->free(_hll_->sparse);
+    _hll_->registers = registers;
+    _hll_->sparse = ((void *)0);
+    _hll_->sparse_count = 0;
+    _hll_->sparse_capacity = 0;
+    return 1;
+}
+static double hll_impl_log(double x)
+{
+    double result = 0.0;
+    while (x >= 2.0)
+    {
+        x /= 2.0;
+        result += 0.69314718055994530942;
+    }
+    double z = (x - 1.0) / (x + 1.0);
+    double term = z;
+    for (int i = 1; i < 40; i += 2)
+    {
+        result += 2.0 * term / i;
+        term *= z * z;
+    }
+    return result;
+}
+_Bool hll_to_string(struct hyperloglog *_hll_, FILE *fptr)
+{
+    struct hyperloglog *h_ = _hll_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "registers:%p, "
+                        "sparse:%p, "
+                        "sparse_count:%"
+                        "I64u"
+                        ", "
+                        "sparse_capacity:%"
+                        "I64u"
+                        ", "
+                        "precision:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks: %p }",
+                        "hyperloglog", "size_t", h_, h_->registers, h_->sparse, h_->sparse_count, h_->sparse_capacity,
+                        h_->precision, h_->flag, h_->f_val, h_->alloc, (h_)->callbacks);
+}
+_Bool hll_print(struct hyperloglog *_hll_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    fprintf(fptr, "%s", start);
+    size_t count = (size_t)1 << _hll_->precision;
+    for (size_t i = 0; i < count; i++)
+    {
+        fprintf(fptr, "%u", (unsigned)hll_impl_get(_hll_, i));
+        if (i + 1 < count)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
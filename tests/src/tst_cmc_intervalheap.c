@@ -32,6 +32,7 @@ struct intervalheap *ih_new_custom(size_t capacity, struct intervalheap_fval *f_
     _heap_->capacity = capacity;
     _heap_->size = 0;
     _heap_->count = 0;
+    _heap_->limit = 0;
     _heap_->flag = CMC_FLAG_OK;
     _heap_->f_val = f_val;
     _heap_->alloc = alloc;
@@ -185,6 +186,53 @@ success:
     ;
     return 1;
 }
+_Bool ih_offer_max(struct intervalheap *_heap_, size_t value)
+{
+    if (_heap_->limit == 0 || _heap_->count < _heap_->limit)
+        return ih_insert(_heap_, value);
+    if (_heap_->f_val->cmp(value, _heap_->buffer[0][0]) <= 0)
+    {
+        _heap_->flag = CMC_FLAG_OK;
+        return 0;
+    }
+    return ih_update_min(_heap_, value);
+}
+_Bool ih_offer_min(struct intervalheap *_heap_, size_t value)
+{
+    if (_heap_->limit == 0 || _heap_->count < _heap_->limit)
+        return ih_insert(_heap_, value);
+    size_t max = _heap_->count == 1 ? _heap_->buffer[0][0] : _heap_->buffer[0][1];
+    if (_heap_->f_val->cmp(value, max) >= 0)
+    {
+        _heap_->flag = CMC_FLAG_OK;
+        return 0;
+    }
+    return ih_update_max(_heap_, value);
+}
+size_t ih_offer_many_max(struct intervalheap *_heap_, size_t *values, size_t count)
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (ih_offer_max(_heap_, values[i]))
+            kept++;
+        else if (_heap_->flag != CMC_FLAG_OK)
+            break;
+    }
+    return kept;
+}
+size_t ih_offer_many_min(struct intervalheap *_heap_, size_t *values, size_t count)
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (ih_offer_min(_heap_, values[i]))
+            kept++;
+        else if (_heap_->flag != CMC_FLAG_OK)
+            break;
+    }
+    return kept;
+}
 _Bool ih_update_max(struct intervalheap *_heap_, size_t value)
 {
     if (ih_empty(_heap_))
@@ -302,6 +350,10 @@ size_t ih_capacity(struct intervalheap *_heap_)
 {
     return _heap_->capacity;
 }
+size_t ih_limit(struct intervalheap *_heap_)
+{
+    return _heap_->limit;
+}
 int ih_flag(struct intervalheap *_heap_)
 {
     return _heap_->flag;
@@ -310,7 +362,7 @@ _Bool ih_resize(struct intervalheap *_heap_, size_t capacity)
 {
     if (_heap_->capacity == capacity)
         goto success;
-    if (capacity < _heap_->count)
+    if (capacity < _heap_->count / 2 + _heap_->count % 2)
     {
         _heap_->flag = CMC_FLAG_INVALID;
         return 0;
@@ -340,6 +392,20 @@ success:
     ;
     return 1;
 }
+_Bool ih_set_limit(struct intervalheap *_heap_, size_t limit)
+{
+    if (limit != 0 && limit < _heap_->count)
+    {
+        _heap_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    size_t capacity = limit / 2 + limit % 2;
+    if (capacity > _heap_->capacity && !ih_resize(_heap_, capacity))
+        return 0;
+    _heap_->limit = limit;
+    _heap_->flag = CMC_FLAG_OK;
+    return 1;
+}
 struct intervalheap *ih_copy_of(struct intervalheap *_heap_)
 {
     struct intervalheap *result = _heap_->alloc->malloc(sizeof(struct intervalheap));
@@ -366,6 +432,7 @@ struct intervalheap *ih_copy_of(struct intervalheap *_heap_)
     result->capacity = _heap_->capacity;
     result->size = _heap_->size;
     result->count = _heap_->count;
+    result->limit = _heap_->limit;
     result->flag = CMC_FLAG_OK;
     result->f_val = _heap_->f_val;
     result->alloc = _heap_->alloc;
@@ -664,12 +731,15 @@ _Bool ih_to_string(struct intervalheap *_heap_, FILE *fptr)
                         "count:%"
                         "I64u"
                         ", "
+                        "limit:%"
+                        "I64u"
+                        ", "
                         "flag:%d, "
                         "f_val:%p, "
                         "alloc:%p, "
                         "callbacks:%p }",
-                        "intervalheap", "size_t", h_, h_->buffer, h_->capacity, h_->size, h_->count, h_->flag,
-                        h_->f_val, h_->alloc, (h_)->callbacks);
+                        "intervalheap", "size_t", h_, h_->buffer, h_->capacity, h_->size, h_->count, h_->limit,
+                        h_->flag, h_->f_val, h_->alloc, (h_)->callbacks);
 }
 _Bool ih_print(struct intervalheap *_heap_, FILE *fptr, const char *start, const char *separator, const char *end)
 {
@@ -0,0 +1,759 @@
+
+#include "tst_cmc_intervaltree.h"
+
+static struct intervaltree_node *itv_impl_new_node(struct intervaltree *_tree_, size_t low, size_t high, size_t value);
+static struct intervaltree_node *itv_impl_get_node(struct intervaltree *_tree_, size_t low, size_t high);
+static int itv_impl_cmp(struct intervaltree *_tree_, struct intervaltree_node *node, size_t low, size_t high);
+static size_t itv_impl_search(struct intervaltree *_tree_, struct intervaltree_node *node, size_t low, size_t high,
+                              void (*match)(size_t, size_t, size_t));
+static struct intervaltree_node *itv_impl_first(struct intervaltree_node *node);
+static struct intervaltree_node *itv_impl_next(struct intervaltree_node *node);
+static unsigned char itv_impl_h(struct intervaltree_node *node);
+static unsigned char itv_impl_hupdate(struct intervaltree_node *node);
+static void itv_impl_mupdate(struct intervaltree *_tree_, struct intervaltree_node *node);
+static void itv_impl_rotate_right(struct intervaltree *_tree_, struct intervaltree_node **Z);
+static void itv_impl_rotate_left(struct intervaltree *_tree_, struct intervaltree_node **Z);
+static void itv_impl_rebalance(struct intervaltree *_tree_, struct intervaltree_node *node);
+struct intervaltree *itv_new(struct intervaltree_fkey *f_key, struct intervaltree_fval *f_val)
+{
+    return itv_new_custom(f_key, f_val, ((void *)0), ((void *)0));
+}
+struct intervaltree *itv_new_custom(struct intervaltree_fkey *f_key, struct intervaltree_fval *f_val,
+                                    struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!f_key || !f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct intervaltree *_tree_ = alloc->malloc(sizeof(struct intervaltree));
+    if (!_tree_)
+        return ((void *)0);
+    _tree_->count = 0;
+    _tree_->root = ((void *)0);
+    _tree_->flag = CMC_FLAG_OK;
+    _tree_->f_key = f_key;
+    _tree_->f_val = f_val;
+    _tree_->alloc = alloc;
+    (_tree_)->callbacks = callbacks;
+    return _tree_;
+}
+void itv_clear(struct intervaltree *_tree_)
+{
+    struct intervaltree_node *scan = _tree_->root;
+    while (scan != ((void *)0))
+    {
+        if (scan->left != ((void *)0))
+            scan = scan->left;
+        else if (scan->right != ((void *)0))
+            scan = scan->right;
+        else
+        {
+            struct intervaltree_node *parent = scan->parent;
+            if (parent != ((void *)0))
+            {
+                if (parent->left == scan)
+                    parent->left = ((void *)0);
+                else
+                    parent->right = ((void *)0);
+            }
+            if (_tree_->f_key->free)
+            {
+                _tree_->f_key->free(scan->low);
+                _tree_->f_key->free(scan->high);
+            }
+            if (_tree_->f_val->free)
+                _tree_->f_val->free(scan->value);
+            _tree_->alloc->free(scan);
+            scan = parent;
+        }
+    }
+    _tree_->count = 0;
+    _tree_->root = ((void *)0);
+    _tree_->flag = CMC_FLAG_OK;
+}
+void itv_free(struct intervaltree *_tree_)
+{
+    itv_clear(_tree_);
+    _tree_->alloc->free(_tree_);
+}
+void itv_customize(struct intervaltree *_tree_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _tree_->alloc = &cmc_alloc_node_default;
+    else
+        _tree_->alloc = alloc;
+    (_tree_)->callbacks = callbacks;
+    _tree_->flag = CMC_FLAG_OK;
+}
+_Bool itv_insert(struct intervaltree *_tree_, size_t low, size_t high, size_t value)
+{
+    if (_tree_->f_key->cmp(low, high) > 0)
+    {
+        _tree_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    struct intervaltree_node *scan = _tree_->root;
+    struct intervaltree_node *parent = ((void *)0);
+    int cmp = 0;
+    while (scan != ((void *)0))
+    {
+        parent = scan;
+        cmp = itv_impl_cmp(_tree_, scan, low, high);
+        if (cmp > 0)
+            scan = scan->left;
+        else if (cmp < 0)
+            scan = scan->right;
+        else
+        {
+            _tree_->flag = CMC_FLAG_DUPLICATE;
+            return 0;
+        }
+    }
+    struct intervaltree_node *node = itv_impl_new_node(_tree_, low, high, value);
+    if (!node)
+    {
+        _tree_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    node->parent = parent;
+    if (parent == ((void *)0))
+        _tree_->root = node;
+    else if (cmp > 0)
+        parent->left = node;
+    else
+        parent->right = node;
+    itv_impl_rebalance(_tree_, parent);
+    _tree_->count++;
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->create)
+        (_tree_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool itv_update(struct intervaltree *_tree_, size_t low, size_t high, size_t new_value, size_t *old_value)
+{
+    struct intervaltree_node *node = itv_impl_get_node(_tree_, low, high);
+    if (!node)
+    {
+        _tree_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (old_value)
+        *old_value = node->value;
+    node->value = new_value;
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->update)
+        (_tree_)->callbacks->update();
+    ;
+    return 1;
+}
+_Bool itv_remove(struct intervaltree *_tree_, size_t low, size_t high, size_t *out_value)
+{
+    if (itv_empty(_tree_))
+    {
+        _tree_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct intervaltree_node *node = itv_impl_get_node(_tree_, low, high);
+    if (!node)
+    {
+        _tree_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (out_value)
+        *out_value = node->value;
+    if (node->left != ((void *)0) && node->right != ((void *)0))
+    {
+        struct intervaltree_node *successor = itv_impl_first(node->right);
+        node->low = successor->low;
+        node->high = successor->high;
+        node->value = successor->value;
+        node = successor;
+    }
+    struct intervaltree_node *child = node->left != ((void *)0) ? node->left : node->right;
+    struct intervaltree_node *parent = node->parent;
+    if (child != ((void *)0))
+        child->parent = parent;
+    if (parent == ((void *)0))
+        _tree_->root = child;
+    else if (parent->left == node)
+        parent->left = child;
+    else
+        parent->right = child;
+    _tree_->alloc->free(node);
+    itv_impl_rebalance(_tree_, parent);
+    _tree_->count--;
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->delete)
+        (_tree_)->callbacks->delete ();
+    ;
+    return 1;
+}
+size_t itv_get(struct intervaltree *_tree_, size_t low, size_t high)
+{
+    if (itv_empty(_tree_))
+    {
+        _tree_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    struct intervaltree_node *node = itv_impl_get_node(_tree_, low, high);
+    if (!node)
+    {
+        _tree_->flag = CMC_FLAG_NOT_FOUND;
+        return (size_t){ 0 };
+    }
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->read)
+        (_tree_)->callbacks->read();
+    ;
+    return node->value;
+}
+size_t *itv_get_ref(struct intervaltree *_tree_, size_t low, size_t high)
+{
+    if (itv_empty(_tree_))
+    {
+        _tree_->flag = CMC_FLAG_EMPTY;
+        return ((void *)0);
+    }
+    struct intervaltree_node *node = itv_impl_get_node(_tree_, low, high);
+    if (!node)
+    {
+        _tree_->flag = CMC_FLAG_NOT_FOUND;
+        return ((void *)0);
+    }
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->read)
+        (_tree_)->callbacks->read();
+    ;
+    return &(node->value);
+}
+size_t itv_overlaps(struct intervaltree *_tree_, size_t low, size_t high, void (*match)(size_t, size_t, size_t))
+{
+    if (_tree_->f_key->cmp(low, high) > 0)
+    {
+        _tree_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    size_t result = itv_impl_search(_tree_, _tree_->root, low, high, match);
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->read)
+        (_tree_)->callbacks->read();
+    ;
+    return result;
+}
+size_t itv_stab(struct intervaltree *_tree_, size_t point, void (*match)(size_t, size_t, size_t))
+{
+    return itv_overlaps(_tree_, point, point, match);
+}
+_Bool itv_contains(struct intervaltree *_tree_, size_t low, size_t high)
+{
+    _Bool result = itv_impl_get_node(_tree_, low, high) != ((void *)0);
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->read)
+        (_tree_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool itv_empty(struct intervaltree *_tree_)
+{
+    return _tree_->count == 0;
+}
+size_t itv_count(struct intervaltree *_tree_)
+{
+    return _tree_->count;
+}
+int itv_flag(struct intervaltree *_tree_)
+{
+    return _tree_->flag;
+}
+struct intervaltree *itv_copy_of(struct intervaltree *_tree_)
+{
+    struct intervaltree *result = itv_new_custom(_tree_->f_key, _tree_->f_val, _tree_->alloc, ((void *)0));
+    if (!result)
+    {
+        _tree_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    struct intervaltree_node *scan = itv_impl_first(_tree_->root);
+    for (; scan != ((void *)0); scan = itv_impl_next(scan))
+    {
+        size_t low = scan->low;
+        size_t high = scan->high;
+        size_t value = scan->value;
+        if (_tree_->f_key->cpy)
+        {
+            low = _tree_->f_key->cpy(scan->low);
+            high = _tree_->f_key->cpy(scan->high);
+        }
+        if (_tree_->f_val->cpy)
+            value = _tree_->f_val->cpy(scan->value);
+        if (!itv_insert(result, low, high, value))
+        {
+            itv_free(result);
+            _tree_->flag = CMC_FLAG_ALLOC;
+            return ((void *)0);
+        }
+    }
+    (result)->callbacks = _tree_->callbacks;
+    _tree_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool itv_equals(struct intervaltree *_tree1_, struct intervaltree *_tree2_)
+{
+    _tree1_->flag = CMC_FLAG_OK;
+    _tree2_->flag = CMC_FLAG_OK;
+    if (_tree1_->count != _tree2_->count)
+        return 0;
+    struct intervaltree_node *scan1 = itv_impl_first(_tree1_->root);
+    struct intervaltree_node *scan2 = itv_impl_first(_tree2_->root);
+    while (scan1 != ((void *)0) && scan2 != ((void *)0))
+    {
+        if (itv_impl_cmp(_tree1_, scan1, scan2->low, scan2->high) != 0)
+            return 0;
+        if (_tree1_->f_val->cmp(scan1->value, scan2->value) != 0)
+            return 0;
+        scan1 = itv_impl_next(scan1);
+        scan2 = itv_impl_next(scan2);
+    }
+    return 1;
+}
+static struct intervaltree_node *itv_impl_new_node(struct intervaltree *_tree_, size_t low, size_t high, size_t value)
+{
+    struct intervaltree_node *node = _tree_->alloc->malloc(sizeof(struct intervaltree_node));
+    if (!node)
+        return ((void *)0);
+    node->low = low;
+    node->high = high;
+    node->max = high;
+    node->value = value;
+    node->right = ((void *)0);
+    node->left = ((void *)0);
+    node->parent = ((void *)0);
+    node->height = 1;
+    return node;
+}
+static struct intervaltree_node *itv_impl_get_node(struct intervaltree *_tree_, size_t low, size_t high)
+{
+    struct intervaltree_node *scan = _tree_->root;
+    while (scan != ((void *)0))
+    {
+        int cmp = itv_impl_cmp(_tree_, scan, low, high);
+        if (cmp > 0)
+            scan = scan->left;
+        else if (cmp < 0)
+            scan = scan->right;
+        else
+            return scan;
+    }
+    return ((void *)0);
+}
+static int itv_impl_cmp(struct intervaltree *_tree_, struct intervaltree_node *node, size_t low, size_t high)
+{
+    int cmp = _tree_->f_key->cmp(node->low, low);
+    if (cmp != 0)
+        return cmp;
+    return _tree_->f_key->cmp(node->high, high);
+}
+static size_t itv_impl_search(struct intervaltree *_tree_, struct intervaltree_node *node, size_t low, size_t high,
+                              void (*match)(size_t, size_t, size_t))
+{
+    size_t result = 0;
+    while (node != ((void *)0) && _tree_->f_key->cmp(node->max, low) >= 0)
+    {
+        result += itv_impl_search(_tree_, node->left, low, high, match);
+        if (_tree_->f_key->cmp(node->low, high) > 0)
+            break;
+        if (_tree_->f_key->cmp(node->high, low) >= 0)
+        {
+            if (match)
+                match(node->low, node->high, node->value);
+            result++;
+        }
+        node = node->right;
+    }
+    return result;
+}
+static struct intervaltree_node *itv_impl_first(struct intervaltree_node *node)
+{
+    if (node == ((void *)0))
+        return ((void *)0);
+    while (node->left != ((void *)0))
+        node = node->left;
+    return node;
+}
+static struct intervaltree_node *itv_impl_next(struct intervaltree_node *node)
+{
+    if (node->right != ((void *)0))
+        return itv_impl_first(node->right);
+    while (node->parent != ((void *)0) && node->parent->right == node)
+        node = node->parent;
+    return node->parent;
+}
+static unsigned char itv_impl_h(struct intervaltree_node *node)
+{
+    if (node == ((void *)0))
+        return 0;
+    return node->height;
+}
+static unsigned char itv_impl_hupdate(struct intervaltree_node *node)
+{
+    if (node == ((void *)0))
+        return 0;
+    unsigned char h_l = itv_impl_h(node->left);
+    unsigned char h_r = itv_impl_h(node->right);
+    return 1 + (h_l > h_r ? h_l : h_r);
+}
+static void itv_impl_mupdate(struct intervaltree *_tree_, struct intervaltree_node *node)
+{
+    node->max = node->high;
+    if (node->left != ((void *)0) && _tree_->f_key->cmp(node->left->max, node->max) > 0)
+        node->max = node->left->max;
+    if (node->right != ((void *)0) && _tree_->f_key->cmp(node->right->max, node->max) > 0)
+        node->max = node->right->max;
+}
+static void itv_impl_rotate_right(struct intervaltree *_tree_, struct intervaltree_node **Z)
+{
+    struct intervaltree_node *root = *Z;
+    struct intervaltree_node *new_root = root->left;
+    if (root->parent != ((void *)0))
+    {
+        if (root->parent->left == root)
+            root->parent->left = new_root;
+        else
+            root->parent->right = new_root;
+    }
+    new_root->parent = root->parent;
+    root->parent = new_root;
+    root->left = new_root->right;
+    if (root->left)
+        root->left->parent = root;
+    new_root->right = root;
+    root->height = itv_impl_hupdate(root);
+    new_root->height = itv_impl_hupdate(new_root);
+    itv_impl_mupdate(_tree_, root);
+    itv_impl_mupdate(_tree_, new_root);
+    *Z = new_root;
+}
+static void itv_impl_rotate_left(struct intervaltree *_tree_, struct intervaltree_node **Z)
+{
+    struct intervaltree_node *root = *Z;
+    struct intervaltree_node *new_root = root->right;
+    if (root->parent != ((void *)0))
+    {
+        if (root->parent->right == root)
+            root->parent->right = new_root;
+        else
+            root->parent->left = new_root;
+    }
+    new_root->parent = root->parent;
+    root->parent = new_root;
+    root->right = new_root->left;
+    if (root->right)
+        root->right->parent = root;
+    new_root->left = root;
+    root->height = itv_impl_hupdate(root);
+    new_root->height = itv_impl_hupdate(new_root);
+    itv_impl_mupdate(_tree_, root);
+    itv_impl_mupdate(_tree_, new_root);
+    *Z = new_root;
+}
+static void itv_impl_rebalance(struct intervaltree *_tree_, struct intervaltree_node *node)
+{
+    struct intervaltree_node *scan = node, *child = ((void *)0);
+    int balance;
+    _Bool is_root = 0;
+    while (scan != ((void *)0))
+    {
+        if (scan->parent == ((void *)0))
+            is_root = 1;
+        scan->height = itv_impl_hupdate(scan);
+        itv_impl_mupdate(_tree_, scan);
+        balance = itv_impl_h(scan->right) - itv_impl_h(scan->left);
+        if (balance >= 2)
+        {
+            child = scan->right;
+            if (itv_impl_h(child->right) < itv_impl_h(child->left))
+                itv_impl_rotate_right(_tree_, &(scan->right));
+            itv_impl_rotate_left(_tree_, &scan);
+        }
+        else if (balance <= -2)
+        {
+            child = scan->left;
+            if (itv_impl_h(child->left) < itv_impl_h(child->right))
+                itv_impl_rotate_left(_tree_, &(scan->left));
+            itv_impl_rotate_right(_tree_, &scan);
+        }
+        if (is_root)
+        {
+            _tree_->root = scan;
+            is_root = 0;
+        }
+        scan = scan->parent;
+    }
+}
+struct intervaltree_iter itv_iter_start(struct intervaltree *target)
+{
+    struct intervaltree_iter iter;
+    iter.target = target;
+    iter.cursor = target->root;
+    iter.first = ((void *)0);
+    iter.last = ((void *)0);
+    iter.index = 0;
+    iter.start = 1;
+    iter.end = itv_empty(target);
+    if (!itv_empty(target))
+    {
+        while (iter.cursor->left != ((void *)0))
+            iter.cursor = iter.cursor->left;
+        iter.first = iter.cursor;
+        iter.last = target->root;
+        while (iter.last->right != ((void *)0))
+            iter.last = iter.last->right;
+    }
+    return iter;
+}
+struct intervaltree_iter itv_iter_end(struct intervaltree *target)
+{
+    struct intervaltree_iter iter;
+    iter.target = target;
+    iter.cursor = target->root;
+    iter.first = ((void *)0);
+    iter.last = ((void *)0);
+    iter.index = 0;
+    iter.start = itv_empty(target);
+    iter.end = 1;
+    if (!itv_empty(target))
+    {
+        while (iter.cursor->right != ((void *)0))
+            iter.cursor = iter.cursor->right;
+        iter.last = iter.cursor;
+        iter.first = target->root;
+        while (iter.first->left != ((void *)0))
+            iter.first = iter.first->left;
+        iter.index = target->count - 1;
+    }
+    return iter;
+}
+_Bool itv_iter_at_start(struct intervaltree_iter *iter)
+{
+    return itv_empty(iter->target) || iter->start;
+}
+_Bool itv_iter_at_end(struct intervaltree_iter *iter)
+{
+    return itv_empty(iter->target) || iter->end;
+}
+_Bool itv_iter_to_start(struct intervaltree_iter *iter)
+{
+    if (!itv_empty(iter->target))
+    {
+        iter->index = 0;
+        iter->start = 1;
+        iter->end = itv_empty(iter->target);
+        iter->cursor = iter->first;
+        return 1;
+    }
+    return 0;
+}
+_Bool itv_iter_to_end(struct intervaltree_iter *iter)
+{
+    if (!itv_empty(iter->target))
+    {
+        iter->index = iter->target->count - 1;
+        iter->start = itv_empty(iter->target);
+        iter->end = 1;
+        iter->cursor = iter->last;
+        return 1;
+    }
+    return 0;
+}
+_Bool itv_iter_next(struct intervaltree_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor == iter->last)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = itv_empty(iter->target);
+    if (iter->cursor->right != ((void *)0))
+    {
+        iter->cursor = iter->cursor->right;
+        while (iter->cursor->left != ((void *)0))
+            iter->cursor = iter->cursor->left;
+        iter->index++;
+        return 1;
+    }
+    while (1)
+    {
+        if (iter->cursor->parent->left == iter->cursor)
+        {
+            iter->cursor = iter->cursor->parent;
+            iter->index++;
+            return 1;
+        }
+        iter->cursor = iter->cursor->parent;
+    }
+}
+_Bool itv_iter_prev(struct intervaltree_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == iter->first)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = itv_empty(iter->target);
+    if (iter->cursor->left != ((void *)0))
+    {
+        iter->cursor = iter->cursor->left;
+        while (iter->cursor->right != ((void *)0))
+            iter->cursor = iter->cursor->right;
+        iter->index--;
+        return 1;
+    }
+    while (1)
+    {
+        if (iter->cursor->parent->right == iter->cursor)
+        {
+            iter->cursor = iter->cursor->parent;
+            iter->index--;
+            return 1;
+        }
+        iter->cursor = iter->cursor->parent;
+    }
+}
+_Bool itv_iter_advance(struct intervaltree_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor == iter->last)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index + steps >= iter->target->count)
+        return 0;
+    for (size_t i = 0; i < steps; i++)
+        itv_iter_next(iter);
+    return 1;
+}
+_Bool itv_iter_rewind(struct intervaltree_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == iter->first)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index < steps)
+        return 0;
+    for (size_t i = 0; i < steps; i++)
+        itv_iter_prev(iter);
+    return 1;
+}
+_Bool itv_iter_go_to(struct intervaltree_iter *iter, size_t index)
+{
+    if (index >= iter->target->count)
+        return 0;
+    if (iter->index > index)
+        return itv_iter_rewind(iter, iter->index - index);
+    else if (iter->index < index)
+        return itv_iter_advance(iter, index - iter->index);
+    return 1;
+}
+size_t itv_iter_low(struct intervaltree_iter *iter)
+{
+    if (itv_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->cursor->low;
+}
+size_t itv_iter_high(struct intervaltree_iter *iter)
+{
+    if (itv_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->cursor->high;
+}
+size_t itv_iter_value(struct intervaltree_iter *iter)
+{
+    if (itv_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->cursor->value;
+}
+size_t *itv_iter_rvalue(struct intervaltree_iter *iter)
+{
+    if (itv_empty(iter->target))
+        return ((void *)0);
+    return &(iter->cursor->value);
+}
+size_t itv_iter_index(struct intervaltree_iter *iter)
+{
+    return iter->index;
+}
+_Bool itv_to_string(struct intervaltree *_tree_, FILE *fptr)
+{
+    struct intervaltree *t_ = _tree_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s, %s> "
+                        "at %p { "
+                        "root:%p, "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "f_key:%p, "
+                        "alloc:%p, "
+                        "callbacks:%p }",
+                        "intervaltree", "size_t", "size_t", t_, t_->root, t_->count, t_->flag, t_->f_key, t_->f_val,
+                        t_->alloc, (t_)->callbacks);
+}
+_Bool itv_print(struct intervaltree *_tree_, FILE *fptr, const char *start, const char *separator, const char *end,
+                const char *key_val_sep)
+{
+    fprintf(fptr, "%s", start);
+    struct intervaltree_node *root = _tree_->root;
+    _Bool left_done = 0;
+    size_t i = 0;
+    while (root)
+    {
+        if (!left_done)
+        {
+            while (root->left)
+                root = root->left;
+        }
+        fprintf(fptr, "[");
+        if (!_tree_->f_key->str(fptr, root->low))
+            return 0;
+        fprintf(fptr, ", ");
+        if (!_tree_->f_key->str(fptr, root->high))
+            return 0;
+        fprintf(fptr, "]%s", key_val_sep);
+        if (!_tree_->f_val->str(fptr, root->value))
+            return 0;
+        if (++i < _tree_->count)
+            fprintf(fptr, "%s", separator);
+        left_done = 1;
+        if (root->right)
+        {
+            left_done = 0;
+            root = root->right;
+        }
+        else if (root->parent)
+        {
+            while (root->parent && root == root->parent->right)
+                root = root->parent;
+            if (!root->parent)
+                break;
+            root = root->parent;
+        }
+        else
+            break;
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
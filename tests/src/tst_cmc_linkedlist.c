@@ -306,6 +306,65 @@ int ll_flag(struct linkedlist *_list_)
 {
     return _list_->flag;
 }
+void ll_sort(struct linkedlist *_list_)
+{
+    struct linkedlist_node *head = _list_->head;
+    for (size_t width = 1; width < _list_->count; width *= 2)
+    {
+        struct linkedlist_node *left = head;
+        struct linkedlist_node *tail = ((void *)0);
+        head = ((void *)0);
+        while (left)
+        {
+            struct linkedlist_node *right = left;
+            size_t left_size = 0;
+            size_t right_size = width;
+            while (left_size < width && right)
+            {
+                left_size++;
+                right = right->next;
+            }
+            while (left_size > 0 || (right_size > 0 && right))
+            {
+                struct linkedlist_node *next;
+                _Bool take_left = left_size > 0;
+                if (take_left && right_size > 0 && right)
+                    take_left = _list_->f_val->cmp(left->value, right->value) <= 0;
+                if (take_left)
+                {
+                    next = left;
+                    left = left->next;
+                    left_size--;
+                }
+                else
+                {
+                    next = right;
+                    right = right->next;
+                    right_size--;
+                }
+                if (tail)
+                    tail->next = next;
+                else
+                    head = next;
+                tail = next;
+            }
+            left = right;
+        }
+        tail->next = ((void *)0);
+    }
+    struct linkedlist_node *prev = ((void *)0);
+    for (struct linkedlist_node *node = head; node; node = node->next)
+    {
+        node->prev = prev;
+        prev = node;
+    }
+    _list_->head = head;
+    _list_->tail = prev;
+    _list_->flag = CMC_FLAG_OK;
+    if ((_list_)->callbacks && (_list_)->callbacks->update)
+        (_list_)->callbacks->update();
+    ;
+}
 struct linkedlist *ll_copy_of(struct linkedlist *_list_)
 {
     struct linkedlist *result = ll_new_custom(_list_->f_val, _list_->alloc, ((void *)0));
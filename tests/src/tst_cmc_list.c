@@ -1,6 +1,179 @@
 
 #include "tst_cmc_list.h"
 
+static _Bool l_impl_is_inline(struct list *_list_);
+static void l_impl_sort_insertion(size_t *array, size_t count, int (*cmp)(size_t, size_t))
+{
+    for (size_t i = 1; i < count; i++)
+    {
+        size_t _tmp_ = array[i];
+        size_t j = i;
+        while (j > 0 && cmp(array[j - 1], _tmp_) > 0)
+        {
+            array[j] = array[j - 1];
+            j--;
+        }
+        array[j] = _tmp_;
+    }
+}
+static void l_impl_sort_heap(size_t *array, size_t count, int (*cmp)(size_t, size_t))
+{
+    for (size_t end = count, i = count / 2; end > 1;)
+    {
+        if (i > 0)
+            i--;
+        else
+        {
+            end--;
+            size_t _tmp_ = array[0];
+            array[0] = array[end];
+            array[end] = _tmp_;
+        }
+        for (size_t node = i, child = i * 2 + 1; child < end; node = child, child = child * 2 + 1)
+        {
+            if (child + 1 < end && cmp(array[child + 1], array[child]) > 0)
+                child++;
+            if (cmp(array[child], array[node]) <= 0)
+                break;
+            size_t _tmp_ = array[node];
+            array[node] = array[child];
+            array[child] = _tmp_;
+        }
+    }
+}
+static void l_impl_sort_intro(size_t *array, size_t count, int (*cmp)(size_t, size_t), size_t depth)
+{
+    while (count > 16)
+    {
+        if (depth == 0)
+        {
+            l_impl_sort_heap(array, count, cmp);
+            return;
+        }
+        depth--;
+        size_t mid = count / 2;
+        if (cmp(array[mid], array[0]) < 0)
+        {
+            size_t _tmp_ = array[mid];
+            array[mid] = array[0];
+            array[0] = _tmp_;
+        }
+        if (cmp(array[count - 1], array[0]) < 0)
+        {
+            size_t _tmp_ = array[count - 1];
+            array[count - 1] = array[0];
+            array[0] = _tmp_;
+        }
+        if (cmp(array[count - 1], array[mid]) < 0)
+        {
+            size_t _tmp_ = array[count - 1];
+            array[count - 1] = array[mid];
+            array[mid] = _tmp_;
+        }
+        size_t pivot = array[mid];
+        size_t lt = 0, i = 0, gt = count;
+        while (i < gt)
+        {
+            int c = cmp(array[i], pivot);
+            if (c < 0)
+            {
+                size_t _tmp_ = array[i];
+                array[i++] = array[lt];
+                array[lt++] = _tmp_;
+            }
+            else if (c > 0)
+            {
+                size_t _tmp_ = array[i];
+                array[i] = array[--gt];
+                array[gt] = _tmp_;
+            }
+            else
+                i++;
+        }
+        if (lt < count - gt)
+        {
+            l_impl_sort_intro(array, lt, cmp, depth);
+            array += gt;
+            count -= gt;
+        }
+        else
+        {
+            l_impl_sort_intro(array + gt, count - gt, cmp, depth);
+            count = lt;
+        }
+    }
+    l_impl_sort_insertion(array, count, cmp);
+}
+static void l_impl_sort_merge(size_t *array, size_t *temp, size_t half, size_t count, int (*cmp)(size_t, size_t))
+{
+    if (half == 0 || half == count || cmp(array[half - 1], array[half]) <= 0)
+        return;
+    memcpy(temp, array, half * sizeof(size_t));
+    size_t i = 0, j = half, k = 0;
+    while (i < half && j < count)
+    {
+        if (cmp(array[j], temp[i]) < 0)
+            array[k++] = array[j++];
+        else
+            array[k++] = temp[i++];
+    }
+    while (i < half)
+        array[k++] = temp[i++];
+}
+static void l_impl_sort_mergesort(size_t *array, size_t *temp, size_t count, int (*cmp)(size_t, size_t))
+{
+    if (count <= 16)
+    {
+        l_impl_sort_insertion(array, count, cmp);
+        return;
+    }
+    size_t half = count / 2;
+    l_impl_sort_mergesort(array, temp, half, cmp);
+    l_impl_sort_mergesort(array + half, temp, count - half, cmp);
+    l_impl_sort_merge(array, temp, half, count, cmp);
+}
+static size_t l_impl_sort_depth(size_t count)
+{
+    size_t depth = 0;
+    while (count > 1)
+    {
+        count /= 2;
+        depth += 2;
+    }
+    return depth;
+}
+static _Bool l_impl_sort_parallel(size_t *array, size_t count, int (*cmp)(size_t, size_t), struct cmc_alloc_node *alloc,
+                                  _Bool stable)
+{
+    (void)array;
+    (void)count;
+    (void)cmp;
+    (void)alloc;
+    (void)stable;
+    return 0;
+}
+static void l_impl_sort(size_t *array, size_t count, int (*cmp)(size_t, size_t), struct cmc_alloc_node *alloc)
+{
+    if (count >= 65536 && l_impl_sort_parallel(array, count, cmp, alloc, 0))
+        return;
+    l_impl_sort_intro(array, count, cmp, l_impl_sort_depth(count));
+}
+static _Bool l_impl_stable_sort(size_t *array, size_t count, int (*cmp)(size_t, size_t), struct cmc_alloc_node *alloc)
+{
+    if (count <= 16)
+    {
+        l_impl_sort_insertion(array, count, cmp);
+        return 1;
+    }
+    if (count >= 65536 && l_impl_sort_parallel(array, count, cmp, alloc, 1))
+        return 1;
+    size_t *temp = alloc->malloc((count / 2) * sizeof(size_t));
+    if (!temp)
+        return 0;
+    l_impl_sort_mergesort(array, temp, count, cmp);
+    alloc->free(temp);
+    return 1;
+}
 struct list *l_new(size_t capacity, struct list_fval *f_val)
 {
     return l_new_custom(capacity, f_val, ((void *)0), ((void *)0));
@@ -18,11 +191,20 @@ struct list *l_new_custom(size_t capacity, struct list_fval *f_val, struct cmc_a
     struct list *_list_ = alloc->malloc(sizeof(struct list));
     if (!_list_)
         return ((void *)0);
-    _list_->buffer = alloc->calloc(capacity, sizeof(size_t));
-    if (!_list_->buffer)
+    if (capacity <= ( + 0))
     {
-        alloc->free(_list_);
-        return ((void *)0);
+        memset(_list_->inline_buffer, 0, sizeof(size_t) * ( + 0));
+        _list_->buffer = _list_->inline_buffer;
+        capacity = ( + 0);
+    }
+    else
+    {
+        _list_->buffer = alloc->calloc(capacity, sizeof(size_t));
+        if (!_list_->buffer)
+        {
+            alloc->free(_list_);
+            return ((void *)0);
+        }
     }
     _list_->capacity = capacity;
     _list_->count = 0;
@@ -50,7 +232,8 @@ void l_free(struct list *_list_)
         for (size_t i = 0; i < _list_->count; i++)
             _list_->f_val->free(_list_->buffer[i]);
     }
-    _list_->alloc->free(_list_->buffer);
+    if (!l_impl_is_inline(_list_))
+        _list_->alloc->free(_list_->buffer);
     _list_->alloc->free(_list_);
 }
 void l_customize(struct list *_list_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
@@ -229,7 +412,11 @@ size_t l_index_of(struct list *_list_, size_t value, _Bool from_start)
 {
     _list_->flag = CMC_FLAG_OK;
     size_t result = _list_->count;
-    if (from_start)
+    if (from_start && _list_->f_val->find)
+    {
+        result = _list_->f_val->find(_list_->buffer, _list_->count, value);
+    }
+    else if (from_start)
     {
         for (size_t i = 0; i < _list_->count; i++)
         {
@@ -260,12 +447,19 @@ _Bool l_contains(struct list *_list_, size_t value)
 {
     _list_->flag = CMC_FLAG_OK;
     _Bool result = 0;
-    for (size_t i = 0; i < _list_->count; i++)
+    if (_list_->f_val->find)
+    {
+        result = _list_->f_val->find(_list_->buffer, _list_->count, value) < _list_->count;
+    }
+    else
     {
-        if (_list_->f_val->cmp(_list_->buffer[i], value) == 0)
+        for (size_t i = 0; i < _list_->count; i++)
         {
-            result = 1;
-            break;
+            if (_list_->f_val->cmp(_list_->buffer[i], value) == 0)
+            {
+                result = 1;
+                break;
+            }
         }
     }
     if ((_list_)->callbacks && (_list_)->callbacks->read)
@@ -297,6 +491,27 @@ int l_flag(struct list *_list_)
 {
     return _list_->flag;
 }
+void l_sort(struct list *_list_)
+{
+    l_impl_sort(_list_->buffer, _list_->count, _list_->f_val->cmp, _list_->alloc);
+    _list_->flag = CMC_FLAG_OK;
+    if ((_list_)->callbacks && (_list_)->callbacks->update)
+        (_list_)->callbacks->update();
+    ;
+}
+_Bool l_stable_sort(struct list *_list_)
+{
+    if (!l_impl_stable_sort(_list_->buffer, _list_->count, _list_->f_val->cmp, _list_->alloc))
+    {
+        _list_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    _list_->flag = CMC_FLAG_OK;
+    if ((_list_)->callbacks && (_list_)->callbacks->update)
+        (_list_)->callbacks->update();
+    ;
+    return 1;
+}
 _Bool l_resize(struct list *_list_, size_t capacity)
 {
     _list_->flag = CMC_FLAG_OK;
@@ -307,7 +522,28 @@ _Bool l_resize(struct list *_list_, size_t capacity)
         _list_->flag = CMC_FLAG_INVALID;
         return 0;
     }
-    size_t *new_buffer = _list_->alloc->realloc(_list_->buffer, sizeof(size_t) * capacity);
+    if (( + 0) > 0 && capacity <= ( + 0))
+    {
+        if (l_impl_is_inline(_list_))
+            return 1;
+        memcpy(_list_->inline_buffer, _list_->buffer, sizeof(size_t) * _list_->count);
+        _list_->alloc->free(_list_->buffer);
+        _list_->buffer = _list_->inline_buffer;
+        _list_->capacity = ( + 0);
+        if ((_list_)->callbacks && (_list_)->callbacks->resize)
+            (_list_)->callbacks->resize();
+        ;
+        return 1;
+    }
+    size_t *new_buffer;
+    if (l_impl_is_inline(_list_))
+    {
+        new_buffer = _list_->alloc->malloc(sizeof(size_t) * capacity);
+        if (new_buffer)
+            memcpy(new_buffer, _list_->inline_buffer, sizeof(size_t) * _list_->count);
+    }
+    else
+        new_buffer = _list_->alloc->realloc(_list_->buffer, sizeof(size_t) * capacity);
     if (!new_buffer)
     {
         _list_->flag = CMC_FLAG_ALLOC;
@@ -353,6 +589,10 @@ _Bool l_equals(struct list *_list1_, struct list *_list2_)
     }
     return 1;
 }
+static _Bool l_impl_is_inline(struct list *_list_)
+{
+    return ( + 0) > 0 && _list_->buffer == _list_->inline_buffer;
+}
 struct list_iter l_iter_start(struct list *target)
 {
     struct list_iter iter;
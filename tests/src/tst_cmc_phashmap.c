@@ -0,0 +1,809 @@
+
+#include "tst_cmc_phashmap.h"
+
+static struct phashmap *phm_impl_version(struct phashmap *_map_, struct phashmap_node *root, size_t count);
+static struct phashmap_node *phm_impl_new_node(struct phashmap *_map_, size_t length, size_t children);
+static void phm_impl_release(struct phashmap *_map_, struct phashmap_node *node);
+static struct phashmap_node *phm_impl_put(struct phashmap *_map_, struct phashmap_node *node, size_t shift,
+                                          struct phashmap_entry *entry, _Bool update, size_t *old_value);
+static struct phashmap_node *phm_impl_merge(struct phashmap *_map_, struct phashmap_entry *a, struct phashmap_entry *b,
+                                            size_t shift);
+static _Bool phm_impl_delete(struct phashmap *_map_, struct phashmap_node *node, size_t shift, size_t hash, size_t key,
+                             size_t *out_value, struct phashmap_node **result);
+static struct phashmap_node *phm_impl_without_entry(struct phashmap *_map_, struct phashmap_node *node, uint32_t bit,
+                                                    size_t index);
+static struct phashmap_entry *phm_impl_get_entry(struct phashmap *_map_, size_t key);
+static _Bool phm_impl_contains_all(struct phashmap *_map1_, struct phashmap *_map2_, struct phashmap_node *node);
+static size_t phm_impl_children(struct phashmap_node *node);
+static size_t phm_impl_popcount(uint32_t bits);
+struct phashmap *phm_new(struct phashmap_fkey *f_key, struct phashmap_fval *f_val)
+{
+    return phm_new_custom(f_key, f_val, ((void *)0), ((void *)0));
+}
+struct phashmap *phm_new_custom(struct phashmap_fkey *f_key, struct phashmap_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!f_key || !f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct phashmap *_map_ = alloc->malloc(sizeof(struct phashmap));
+    if (!_map_)
+        return ((void *)0);
+    _map_->root = ((void *)0);
+    _map_->count = 0;
+    _map_->flag = CMC_FLAG_OK;
+    _map_->f_key = f_key;
+    _map_->f_val = f_val;
+    _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    return _map_;
+}
+void phm_free(struct phashmap *_map_)
+{
+    if (_map_->root)
+        phm_impl_release(_map_, _map_->root);
+    _map_->alloc->free(_map_);
+}
+void phm_customize(struct phashmap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _map_->alloc = &cmc_alloc_node_default;
+    else
+        _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    _map_->flag = CMC_FLAG_OK;
+}
+struct phashmap *phm_insert(struct phashmap *_map_, size_t key, size_t value)
+{
+    struct phashmap_entry entry = { key, value, _map_->f_key->hash(key) };
+    struct phashmap_node *root = phm_impl_put(_map_, _map_->root, 0, &entry, 0, ((void *)0));
+    if (!root)
+        return ((void *)0);
+    struct phashmap *result = phm_impl_version(_map_, root, _map_->count + 1);
+    if (!result)
+        return ((void *)0);
+    if ((result)->callbacks && (result)->callbacks->create)
+        (result)->callbacks->create();
+    ;
+    return result;
+}
+struct phashmap *phm_update(struct phashmap *_map_, size_t key, size_t new_value, size_t *old_value)
+{
+    if (phm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return ((void *)0);
+    }
+    struct phashmap_entry entry = { key, new_value, _map_->f_key->hash(key) };
+    struct phashmap_node *root = phm_impl_put(_map_, _map_->root, 0, &entry, 1, old_value);
+    if (!root)
+        return ((void *)0);
+    struct phashmap *result = phm_impl_version(_map_, root, _map_->count);
+    if (!result)
+        return ((void *)0);
+    if ((result)->callbacks && (result)->callbacks->update)
+        (result)->callbacks->update();
+    ;
+    return result;
+}
+struct phashmap *phm_remove(struct phashmap *_map_, size_t key, size_t *out_value)
+{
+    if (phm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return ((void *)0);
+    }
+    struct phashmap_node *root = ((void *)0);
+    if (!phm_impl_delete(_map_, _map_->root, 0, _map_->f_key->hash(key), key, out_value, &root))
+        return ((void *)0);
+    struct phashmap *result = phm_impl_version(_map_, root, _map_->count - 1);
+    if (!result)
+        return ((void *)0);
+    if ((result)->callbacks && (result)->callbacks->delete)
+        (result)->callbacks->delete ();
+    ;
+    return result;
+}
+size_t phm_get(struct phashmap *_map_, size_t key)
+{
+    if (phm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    struct phashmap_entry *entry = phm_impl_get_entry(_map_, key);
+    if (!entry)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return (size_t){ 0 };
+    }
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return entry->value;
+}
+_Bool phm_contains(struct phashmap *_map_, size_t key)
+{
+    _Bool result = phm_impl_get_entry(_map_, key) != ((void *)0);
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool phm_empty(struct phashmap *_map_)
+{
+    return _map_->count == 0;
+}
+size_t phm_count(struct phashmap *_map_)
+{
+    return _map_->count;
+}
+int phm_flag(struct phashmap *_map_)
+{
+    return _map_->flag;
+}
+struct phashmap *phm_copy_of(struct phashmap *_map_)
+{
+    if (_map_->root)
+        _map_->root->refcount++;
+    return phm_impl_version(_map_, _map_->root, _map_->count);
+}
+_Bool phm_equals(struct phashmap *_map1_, struct phashmap *_map2_)
+{
+    _map1_->flag = CMC_FLAG_OK;
+    _map2_->flag = CMC_FLAG_OK;
+    if (_map1_->count != _map2_->count)
+        return 0;
+    if (_map1_->root == _map2_->root)
+        return 1;
+    return phm_impl_contains_all(_map1_, _map2_, _map1_->root);
+}
+static struct phashmap *phm_impl_version(struct phashmap *_map_, struct phashmap_node *root, size_t count)
+{
+    struct phashmap *result = _map_->alloc->malloc(sizeof(struct phashmap));
+    if (!result)
+    {
+        if (root)
+            phm_impl_release(_map_, root);
+        _map_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    result->root = root;
+    result->count = count;
+    result->flag = CMC_FLAG_OK;
+    result->f_key = _map_->f_key;
+    result->f_val = _map_->f_val;
+    result->alloc = _map_->alloc;
+    (result)->callbacks = _map_->callbacks;
+    _map_->flag = CMC_FLAG_OK;
+    return result;
+}
+static struct phashmap_node *phm_impl_new_node(struct phashmap *_map_, size_t length, size_t children)
+{
+    size_t entry_size = sizeof(struct phashmap_entry);
+    size_t child_size = sizeof(struct phashmap_node *);
+    size_t entries_at = (sizeof(struct phashmap_node) + entry_size - 1) / entry_size * entry_size;
+    size_t children_at = (entries_at + length * entry_size + child_size - 1) / child_size * child_size;
+    unsigned char *block = _map_->alloc->malloc(children_at + children * child_size);
+    if (!block)
+        return ((void *)0);
+    struct phashmap_node *node = (struct phashmap_node *)block;
+    node->refcount = 1;
+    node->length = length;
+    node->datamap = 0;
+    node->nodemap = 0;
+    node->entries = (struct phashmap_entry *)(block + entries_at);
+    node->children = (struct phashmap_node **)(block + children_at);
+    return node;
+}
+static void phm_impl_release(struct phashmap *_map_, struct phashmap_node *node)
+{
+    if (--node->refcount > 0)
+        return;
+    size_t children = phm_impl_children(node);
+    for (size_t i = 0; i < children; i++)
+        phm_impl_release(_map_, node->children[i]);
+    _map_->alloc->free(node);
+}
+static struct phashmap_node *phm_impl_put(struct phashmap *_map_, struct phashmap_node *node, size_t shift,
+                                          struct phashmap_entry *entry, _Bool update, size_t *old_value)
+{
+    struct phashmap_node *result = ((void *)0);
+    if (!node)
+    {
+        if (!(result = phm_impl_new_node(_map_, 1, 0)))
+        {
+            _map_->flag = CMC_FLAG_ALLOC;
+            return ((void *)0);
+        }
+        result->datamap = (uint32_t)1 << (entry->hash & 31);
+        result->entries[0] = *entry;
+        return result;
+    }
+    size_t children = phm_impl_children(node);
+    if (shift >= sizeof(size_t) * 8)
+    {
+        size_t index = 0;
+        while (index < node->length && _map_->f_key->cmp(node->entries[index].key, entry->key) != 0)
+            index++;
+        if (index < node->length && !update)
+        {
+            _map_->flag = CMC_FLAG_DUPLICATE;
+            return ((void *)0);
+        }
+        else if (index == node->length && update)
+        {
+            _map_->flag = CMC_FLAG_NOT_FOUND;
+            return ((void *)0);
+        }
+        size_t length = update ? node->length : node->length + 1;
+        if (!(result = phm_impl_new_node(_map_, length, 0)))
+        {
+            _map_->flag = CMC_FLAG_ALLOC;
+            return ((void *)0);
+        }
+        memcpy(result->entries, node->entries, node->length * sizeof(struct phashmap_entry));
+        if (update && old_value)
+            *old_value = node->entries[index].value;
+        result->entries[index] = *entry;
+        return result;
+    }
+    uint32_t bit = (uint32_t)1 << ((entry->hash >> shift) & 31);
+    size_t e_index = phm_impl_popcount(node->datamap & (bit - 1));
+    size_t c_index = phm_impl_popcount(node->nodemap & (bit - 1));
+    if (node->datamap & bit)
+    {
+        struct phashmap_entry *current = &(node->entries[e_index]);
+        if (current->hash == entry->hash && _map_->f_key->cmp(current->key, entry->key) == 0)
+        {
+            if (!update)
+            {
+                _map_->flag = CMC_FLAG_DUPLICATE;
+                return ((void *)0);
+            }
+            if (!(result = phm_impl_new_node(_map_, node->length, children)))
+            {
+                _map_->flag = CMC_FLAG_ALLOC;
+                return ((void *)0);
+            }
+            result->datamap = node->datamap;
+            result->nodemap = node->nodemap;
+            memcpy(result->entries, node->entries, node->length * sizeof(struct phashmap_entry));
+            memcpy(result->children, node->children, children * sizeof(struct phashmap_node *));
+            for (size_t i = 0; i < children; i++)
+                node->children[i]->refcount++;
+            if (old_value)
+                *old_value = current->value;
+            result->entries[e_index].value = entry->value;
+            return result;
+        }
+        if (update)
+        {
+            _map_->flag = CMC_FLAG_NOT_FOUND;
+            return ((void *)0);
+        }
+        struct phashmap_node *child = phm_impl_merge(_map_, current, entry, shift + 5);
+        if (!child)
+        {
+            _map_->flag = CMC_FLAG_ALLOC;
+            return ((void *)0);
+        }
+        if (!(result = phm_impl_new_node(_map_, node->length - 1, children + 1)))
+        {
+            phm_impl_release(_map_, child);
+            _map_->flag = CMC_FLAG_ALLOC;
+            return ((void *)0);
+        }
+        result->datamap = node->datamap & ~bit;
+        result->nodemap = node->nodemap | bit;
+        memcpy(result->entries, node->entries, e_index * sizeof(struct phashmap_entry));
+        memcpy(result->entries + e_index, node->entries + e_index + 1,
+               (node->length - e_index - 1) * sizeof(struct phashmap_entry));
+        memcpy(result->children, node->children, c_index * sizeof(struct phashmap_node *));
+        memcpy(result->children + c_index + 1, node->children + c_index,
+               (children - c_index) * sizeof(struct phashmap_node *));
+        for (size_t i = 0; i < children; i++)
+            node->children[i]->refcount++;
+        result->children[c_index] = child;
+        return result;
+    }
+    else if (node->nodemap & bit)
+    {
+        struct phashmap_node *child = phm_impl_put(_map_, node->children[c_index], shift + 5, entry, update, old_value);
+        if (!child)
+            return ((void *)0);
+        if (!(result = phm_impl_new_node(_map_, node->length, children)))
+        {
+            phm_impl_release(_map_, child);
+            _map_->flag = CMC_FLAG_ALLOC;
+            return ((void *)0);
+        }
+        result->datamap = node->datamap;
+        result->nodemap = node->nodemap;
+        memcpy(result->entries, node->entries, node->length * sizeof(struct phashmap_entry));
+        memcpy(result->children, node->children, children * sizeof(struct phashmap_node *));
+        for (size_t i = 0; i < children; i++)
+        {
+            if (i != c_index)
+                node->children[i]->refcount++;
+        }
+        result->children[c_index] = child;
+        return result;
+    }
+    if (update)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return ((void *)0);
+    }
+    if (!(result = phm_impl_new_node(_map_, node->length + 1, children)))
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    result->datamap = node->datamap | bit;
+    result->nodemap = node->nodemap;
+    memcpy(result->entries, node->entries, e_index * sizeof(struct phashmap_entry));
+    memcpy(result->entries + e_index + 1, node->entries + e_index,
+           (node->length - e_index) * sizeof(struct phashmap_entry));
+    memcpy(result->children, node->children, children * sizeof(struct phashmap_node *));
+    for (size_t i = 0; i < children; i++)
+        node->children[i]->refcount++;
+    result->entries[e_index] = *entry;
+    return result;
+}
+static struct phashmap_node *phm_impl_merge(struct phashmap *_map_, struct phashmap_entry *a, struct phashmap_entry *b,
+                                            size_t shift)
+{
+    struct phashmap_node *result = ((void *)0);
+    if (shift >= sizeof(size_t) * 8)
+    {
+        if (!(result = phm_impl_new_node(_map_, 2, 0)))
+            return ((void *)0);
+        result->entries[0] = *a;
+        result->entries[1] = *b;
+        return result;
+    }
+    size_t branch_a = (a->hash >> shift) & 31;
+    size_t branch_b = (b->hash >> shift) & 31;
+    if (branch_a == branch_b)
+    {
+        struct phashmap_node *child = phm_impl_merge(_map_, a, b, shift + 5);
+        if (!child)
+            return ((void *)0);
+        if (!(result = phm_impl_new_node(_map_, 0, 1)))
+        {
+            phm_impl_release(_map_, child);
+            return ((void *)0);
+        }
+        result->nodemap = (uint32_t)1 << branch_a;
+        result->children[0] = child;
+        return result;
+    }
+    if (!(result = phm_impl_new_node(_map_, 2, 0)))
+        return ((void *)0);
+    result->datamap = ((uint32_t)1 << branch_a) | ((uint32_t)1 << branch_b);
+    result->entries[branch_a < branch_b ? 0 : 1] = *a;
+    result->entries[branch_a < branch_b ? 1 : 0] = *b;
+    return result;
+}
+static _Bool phm_impl_delete(struct phashmap *_map_, struct phashmap_node *node, size_t shift, size_t hash, size_t key,
+                             size_t *out_value, struct phashmap_node **result)
+{
+    if (shift >= sizeof(size_t) * 8)
+    {
+        for (size_t i = 0; i < node->length; i++)
+        {
+            if (_map_->f_key->cmp(node->entries[i].key, key) == 0)
+            {
+                if (out_value)
+                    *out_value = node->entries[i].value;
+                *result = ((void *)0);
+                if (node->length == 1)
+                    return 1;
+                if (!(*result = phm_impl_without_entry(_map_, node, 0, i)))
+                {
+                    _map_->flag = CMC_FLAG_ALLOC;
+                    return 0;
+                }
+                return 1;
+            }
+        }
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    size_t children = phm_impl_children(node);
+    uint32_t bit = (uint32_t)1 << ((hash >> shift) & 31);
+    size_t e_index = phm_impl_popcount(node->datamap & (bit - 1));
+    size_t c_index = phm_impl_popcount(node->nodemap & (bit - 1));
+    if (node->datamap & bit)
+    {
+        struct phashmap_entry *current = &(node->entries[e_index]);
+        if (current->hash != hash || _map_->f_key->cmp(current->key, key) != 0)
+        {
+            _map_->flag = CMC_FLAG_NOT_FOUND;
+            return 0;
+        }
+        if (out_value)
+            *out_value = current->value;
+        *result = ((void *)0);
+        if (node->length == 1 && children == 0)
+            return 1;
+        if (!(*result = phm_impl_without_entry(_map_, node, bit, e_index)))
+        {
+            _map_->flag = CMC_FLAG_ALLOC;
+            return 0;
+        }
+        return 1;
+    }
+    else if (!(node->nodemap & bit))
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    struct phashmap_node *child = ((void *)0);
+    if (!phm_impl_delete(_map_, node->children[c_index], shift + 5, hash, key, out_value, &child))
+        return 0;
+    _Bool inline_child = child && child->length == 1 && child->nodemap == 0;
+    size_t length = node->length + (inline_child ? 1 : 0);
+    size_t new_children = children - (child && !inline_child ? 0 : 1);
+    if (length == 0 && new_children == 0)
+    {
+        *result = ((void *)0);
+        return 1;
+    }
+    if (!(*result = phm_impl_new_node(_map_, length, new_children)))
+    {
+        if (child)
+            phm_impl_release(_map_, child);
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    struct phashmap_node *r = *result;
+    r->datamap = node->datamap;
+    r->nodemap = node->nodemap;
+    if (inline_child)
+    {
+        r->datamap |= bit;
+        memcpy(r->entries, node->entries, e_index * sizeof(struct phashmap_entry));
+        memcpy(r->entries + e_index + 1, node->entries + e_index,
+               (node->length - e_index) * sizeof(struct phashmap_entry));
+        r->entries[e_index] = child->entries[0];
+        phm_impl_release(_map_, child);
+        child = ((void *)0);
+    }
+    else
+        memcpy(r->entries, node->entries, node->length * sizeof(struct phashmap_entry));
+    if (child)
+    {
+        memcpy(r->children, node->children, children * sizeof(struct phashmap_node *));
+        r->children[c_index] = child;
+    }
+    else
+    {
+        r->nodemap &= ~bit;
+        memcpy(r->children, node->children, c_index * sizeof(struct phashmap_node *));
+        memcpy(r->children + c_index, node->children + c_index + 1,
+               (children - c_index - 1) * sizeof(struct phashmap_node *));
+    }
+    for (size_t i = 0; i < children; i++)
+    {
+        if (i != c_index)
+            node->children[i]->refcount++;
+    }
+    return 1;
+}
+static struct phashmap_node *phm_impl_without_entry(struct phashmap *_map_, struct phashmap_node *node, uint32_t bit,
+                                                    size_t index)
+{
+    size_t children = phm_impl_children(node);
+    struct phashmap_node *result = phm_impl_new_node(_map_, node->length - 1, children);
+    if (!result)
+        return ((void *)0);
+    result->datamap = node->datamap & ~bit;
+    result->nodemap = node->nodemap;
+    memcpy(result->entries, node->entries, index * sizeof(struct phashmap_entry));
+    memcpy(result->entries + index, node->entries + index + 1,
+           (node->length - index - 1) * sizeof(struct phashmap_entry));
+    memcpy(result->children, node->children, children * sizeof(struct phashmap_node *));
+    for (size_t i = 0; i < children; i++)
+        node->children[i]->refcount++;
+    return result;
+}
+static struct phashmap_entry *phm_impl_get_entry(struct phashmap *_map_, size_t key)
+{
+    struct phashmap_node *node = _map_->root;
+    size_t hash = _map_->f_key->hash(key);
+    size_t shift = 0;
+    while (node)
+    {
+        if (shift >= sizeof(size_t) * 8)
+        {
+            for (size_t i = 0; i < node->length; i++)
+            {
+                if (_map_->f_key->cmp(node->entries[i].key, key) == 0)
+                    return &(node->entries[i]);
+            }
+            return ((void *)0);
+        }
+        uint32_t bit = (uint32_t)1 << ((hash >> shift) & 31);
+        if (node->datamap & bit)
+        {
+            struct phashmap_entry *entry = &(node->entries[phm_impl_popcount(node->datamap & (bit - 1))]);
+            if (entry->hash == hash && _map_->f_key->cmp(entry->key, key) == 0)
+                return entry;
+            return ((void *)0);
+        }
+        else if (node->nodemap & bit)
+            node = node->children[phm_impl_popcount(node->nodemap & (bit - 1))];
+        else
+            return ((void *)0);
+        shift += 5;
+    }
+    return ((void *)0);
+}
+static _Bool phm_impl_contains_all(struct phashmap *_map1_, struct phashmap *_map2_, struct phashmap_node *node)
+{
+    if (!node)
+        return 1;
+    for (size_t i = 0; i < node->length; i++)
+    {
+        struct phashmap_entry *entry = phm_impl_get_entry(_map2_, node->entries[i].key);
+        if (!entry || _map1_->f_val->cmp(node->entries[i].value, entry->value) != 0)
+            return 0;
+    }
+    size_t children = phm_impl_children(node);
+    for (size_t i = 0; i < children; i++)
+    {
+        if (!phm_impl_contains_all(_map1_, _map2_, node->children[i]))
+            return 0;
+    }
+    return 1;
+}
+static size_t phm_impl_children(struct phashmap_node *node)
+{
+    return phm_impl_popcount(node->nodemap);
+}
+static size_t phm_impl_popcount(uint32_t bits)
+{
+    bits = bits - ((bits >> 1) & 0x55555555u);
+    bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+    bits = (bits + (bits >> 4)) & 0x0F0F0F0Fu;
+    return (size_t)((uint32_t)(bits * 0x01010101u) >> 24);
+}
+static void phm_impl_iter_first(struct phashmap_iter *iter, size_t depth, struct phashmap_node *node);
+static void phm_impl_iter_last(struct phashmap_iter *iter, size_t depth, struct phashmap_node *node);
+static size_t phm_impl_iter_slots(struct phashmap_node *node);
+struct phashmap_iter phm_iter_start(struct phashmap *target)
+{
+    struct phashmap_iter iter;
+    iter.target = target;
+    iter.depth = 0;
+    iter.index = 0;
+    iter.start = 1;
+    iter.end = phm_empty(target);
+    if (!phm_empty(target))
+        phm_impl_iter_first(&iter, 0, target->root);
+    return iter;
+}
+struct phashmap_iter phm_iter_end(struct phashmap *target)
+{
+    struct phashmap_iter iter;
+    iter.target = target;
+    iter.depth = 0;
+    iter.index = 0;
+    iter.start = phm_empty(target);
+    iter.end = 1;
+    if (!phm_empty(target))
+    {
+        iter.index = target->count - 1;
+        phm_impl_iter_last(&iter, 0, target->root);
+    }
+    return iter;
+}
+_Bool phm_iter_at_start(struct phashmap_iter *iter)
+{
+    return phm_empty(iter->target) || iter->start;
+}
+_Bool phm_iter_at_end(struct phashmap_iter *iter)
+{
+    return phm_empty(iter->target) || iter->end;
+}
+_Bool phm_iter_to_start(struct phashmap_iter *iter)
+{
+    if (!phm_empty(iter->target))
+    {
+        *iter = phm_iter_start(iter->target);
+        return 1;
+    }
+    return 0;
+}
+_Bool phm_iter_to_end(struct phashmap_iter *iter)
+{
+    if (!phm_empty(iter->target))
+    {
+        *iter = phm_iter_end(iter->target);
+        return 1;
+    }
+    return 0;
+}
+_Bool phm_iter_next(struct phashmap_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 >= iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = phm_empty(iter->target);
+    while (iter->slots[iter->depth] + 1 >= phm_impl_iter_slots(iter->path[iter->depth]))
+        iter->depth--;
+    struct phashmap_node *node = iter->path[iter->depth];
+    size_t slot = ++iter->slots[iter->depth];
+    if (slot >= node->length)
+        phm_impl_iter_first(iter, iter->depth + 1, node->children[slot - node->length]);
+    iter->index++;
+    return 1;
+}
+_Bool phm_iter_prev(struct phashmap_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = phm_empty(iter->target);
+    while (iter->slots[iter->depth] == 0)
+        iter->depth--;
+    struct phashmap_node *node = iter->path[iter->depth];
+    size_t slot = --iter->slots[iter->depth];
+    if (slot >= node->length)
+        phm_impl_iter_last(iter, iter->depth + 1, node->children[slot - node->length]);
+    iter->index--;
+    return 1;
+}
+_Bool phm_iter_advance(struct phashmap_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 >= iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index + steps >= iter->target->count)
+        return 0;
+    for (size_t i = 0; i < steps; i++)
+        phm_iter_next(iter);
+    return 1;
+}
+_Bool phm_iter_rewind(struct phashmap_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index < steps)
+        return 0;
+    for (size_t i = 0; i < steps; i++)
+        phm_iter_prev(iter);
+    return 1;
+}
+_Bool phm_iter_go_to(struct phashmap_iter *iter, size_t index)
+{
+    if (index >= iter->target->count)
+        return 0;
+    if (iter->index > index)
+        return phm_iter_rewind(iter, iter->index - index);
+    else if (iter->index < index)
+        return phm_iter_advance(iter, index - iter->index);
+    return 1;
+}
+size_t phm_iter_key(struct phashmap_iter *iter)
+{
+    if (phm_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->path[iter->depth]->entries[iter->slots[iter->depth]].key;
+}
+size_t phm_iter_value(struct phashmap_iter *iter)
+{
+    if (phm_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->path[iter->depth]->entries[iter->slots[iter->depth]].value;
+}
+size_t phm_iter_index(struct phashmap_iter *iter)
+{
+    return iter->index;
+}
+static void phm_impl_iter_first(struct phashmap_iter *iter, size_t depth, struct phashmap_node *node)
+{
+    while (1)
+    {
+        iter->path[depth] = node;
+        iter->slots[depth] = 0;
+        if (node->length > 0)
+            break;
+        node = node->children[0];
+        depth++;
+    }
+    iter->depth = depth;
+}
+static void phm_impl_iter_last(struct phashmap_iter *iter, size_t depth, struct phashmap_node *node)
+{
+    while (1)
+    {
+        size_t slots = phm_impl_iter_slots(node);
+        iter->path[depth] = node;
+        iter->slots[depth] = slots - 1;
+        if (slots - 1 < node->length)
+            break;
+        node = node->children[slots - 1 - node->length];
+        depth++;
+    }
+    iter->depth = depth;
+}
+static size_t phm_impl_iter_slots(struct phashmap_node *node)
+{
+    return node->length + phm_impl_children(node);
+}
+static _Bool phm_impl_print_node(struct phashmap *_map_, struct phashmap_node *node, FILE *fptr, size_t *printed,
+                                 const char *separator, const char *key_val_sep);
+_Bool phm_to_string(struct phashmap *_map_, FILE *fptr)
+{
+    struct phashmap *m_ = _map_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s, %s> "
+                        "at %p { "
+                        "root:%p, "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "f_key:%p, "
+                        "alloc:%p, "
+                        "callbacks:%p }",
+                        "phashmap", "size_t", "size_t", m_, m_->root, m_->count, m_->flag, m_->f_key, m_->f_val,
+                        m_->alloc, (m_)->callbacks);
+}
+_Bool phm_print(struct phashmap *_map_, FILE *fptr, const char *start, const char *separator, const char *end,
+                const char *key_val_sep)
+{
+    fprintf(fptr, "%s", start);
+    size_t printed = 0;
+    if (_map_->root && !phm_impl_print_node(_map_, _map_->root, fptr, &printed, separator, key_val_sep))
+        return 0;
+    fprintf(fptr, "%s", end);
+    return 1;
+}
+static _Bool phm_impl_print_node(struct phashmap *_map_, struct phashmap_node *node, FILE *fptr, size_t *printed,
+                                 const char *separator, const char *key_val_sep)
+{
+    for (size_t i = 0; i < node->length; i++)
+    {
+        if (!_map_->f_key->str(fptr, node->entries[i].key))
+            return 0;
+        fprintf(fptr, "%s", key_val_sep);
+        if (!_map_->f_val->str(fptr, node->entries[i].value))
+            return 0;
+        if (++(*printed) < _map_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    size_t children = phm_impl_children(node);
+    for (size_t i = 0; i < children; i++)
+    {
+        if (!phm_impl_print_node(_map_, node->children[i], fptr, printed, separator, key_val_sep))
+            return 0;
+    }
+    return 1;
+}
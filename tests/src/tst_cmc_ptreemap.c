@@ -0,0 +1,666 @@
+
+#include "tst_cmc_ptreemap.h"
+
+static struct ptreemap *ptm_impl_version(struct ptreemap *_map_, struct ptreemap_node *root, size_t count);
+static void ptm_impl_acquire(struct ptreemap_node *node);
+static void ptm_impl_release(struct ptreemap *_map_, struct ptreemap_node *node);
+static struct ptreemap_node *ptm_impl_node(struct ptreemap_node *node, size_t key, size_t value,
+                                           struct ptreemap_node *left, struct ptreemap_node *right);
+static struct ptreemap_node *ptm_impl_balance(struct ptreemap *_map_, size_t key, size_t value,
+                                              struct ptreemap_node *left, struct ptreemap_node *right);
+static struct ptreemap_node *ptm_impl_put(struct ptreemap *_map_, struct ptreemap_node *node, size_t key, size_t value,
+                                          _Bool update, size_t *old_value);
+static _Bool ptm_impl_delete(struct ptreemap *_map_, struct ptreemap_node *node, size_t key, size_t *out_value,
+                             struct ptreemap_node **result);
+static _Bool ptm_impl_delete_min(struct ptreemap *_map_, struct ptreemap_node *node, size_t *key, size_t *value,
+                                 struct ptreemap_node **result);
+static struct ptreemap_node *ptm_impl_get_node(struct ptreemap *_map_, size_t key);
+static _Bool ptm_impl_contains_all(struct ptreemap *_map1_, struct ptreemap *_map2_, struct ptreemap_node *node);
+static unsigned char ptm_impl_h(struct ptreemap_node *node);
+struct ptreemap *ptm_new(struct ptreemap_fkey *f_key, struct ptreemap_fval *f_val)
+{
+    return ptm_new_custom(f_key, f_val, ((void *)0), ((void *)0));
+}
+struct ptreemap *ptm_new_custom(struct ptreemap_fkey *f_key, struct ptreemap_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!f_key || !f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct ptreemap *_map_ = alloc->malloc(sizeof(struct ptreemap));
+    if (!_map_)
+        return ((void *)0);
+    _map_->root = ((void *)0);
+    _map_->count = 0;
+    _map_->flag = CMC_FLAG_OK;
+    _map_->f_key = f_key;
+    _map_->f_val = f_val;
+    _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    return _map_;
+}
+void ptm_free(struct ptreemap *_map_)
+{
+    ptm_impl_release(_map_, _map_->root);
+    _map_->alloc->free(_map_);
+}
+void ptm_customize(struct ptreemap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _map_->alloc = &cmc_alloc_node_default;
+    else
+        _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    _map_->flag = CMC_FLAG_OK;
+}
+struct ptreemap *ptm_insert(struct ptreemap *_map_, size_t key, size_t value)
+{
+    struct ptreemap_node *root = ptm_impl_put(_map_, _map_->root, key, value, 0, ((void *)0));
+    if (!root)
+        return ((void *)0);
+    struct ptreemap *result = ptm_impl_version(_map_, root, _map_->count + 1);
+    if (!result)
+        return ((void *)0);
+    if ((result)->callbacks && (result)->callbacks->create)
+        (result)->callbacks->create();
+    ;
+    return result;
+}
+struct ptreemap *ptm_update(struct ptreemap *_map_, size_t key, size_t new_value, size_t *old_value)
+{
+    if (ptm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return ((void *)0);
+    }
+    struct ptreemap_node *root = ptm_impl_put(_map_, _map_->root, key, new_value, 1, old_value);
+    if (!root)
+        return ((void *)0);
+    struct ptreemap *result = ptm_impl_version(_map_, root, _map_->count);
+    if (!result)
+        return ((void *)0);
+    if ((result)->callbacks && (result)->callbacks->update)
+        (result)->callbacks->update();
+    ;
+    return result;
+}
+struct ptreemap *ptm_remove(struct ptreemap *_map_, size_t key, size_t *out_value)
+{
+    if (ptm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return ((void *)0);
+    }
+    struct ptreemap_node *root = ((void *)0);
+    if (!ptm_impl_delete(_map_, _map_->root, key, out_value, &root))
+        return ((void *)0);
+    struct ptreemap *result = ptm_impl_version(_map_, root, _map_->count - 1);
+    if (!result)
+        return ((void *)0);
+    if ((result)->callbacks && (result)->callbacks->delete)
+        (result)->callbacks->delete ();
+    ;
+    return result;
+}
+_Bool ptm_max(struct ptreemap *_map_, size_t *key, size_t *value)
+{
+    if (ptm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct ptreemap_node *node = _map_->root;
+    while (node->right)
+        node = node->right;
+    if (key)
+        *key = node->key;
+    if (value)
+        *value = node->value;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool ptm_min(struct ptreemap *_map_, size_t *key, size_t *value)
+{
+    if (ptm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct ptreemap_node *node = _map_->root;
+    while (node->left)
+        node = node->left;
+    if (key)
+        *key = node->key;
+    if (value)
+        *value = node->value;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return 1;
+}
+size_t ptm_get(struct ptreemap *_map_, size_t key)
+{
+    if (ptm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    struct ptreemap_node *node = ptm_impl_get_node(_map_, key);
+    if (!node)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return (size_t){ 0 };
+    }
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return node->value;
+}
+_Bool ptm_contains(struct ptreemap *_map_, size_t key)
+{
+    _Bool result = ptm_impl_get_node(_map_, key) != ((void *)0);
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool ptm_empty(struct ptreemap *_map_)
+{
+    return _map_->count == 0;
+}
+size_t ptm_count(struct ptreemap *_map_)
+{
+    return _map_->count;
+}
+int ptm_flag(struct ptreemap *_map_)
+{
+    return _map_->flag;
+}
+struct ptreemap *ptm_copy_of(struct ptreemap *_map_)
+{
+    ptm_impl_acquire(_map_->root);
+    return ptm_impl_version(_map_, _map_->root, _map_->count);
+}
+_Bool ptm_equals(struct ptreemap *_map1_, struct ptreemap *_map2_)
+{
+    _map1_->flag = CMC_FLAG_OK;
+    _map2_->flag = CMC_FLAG_OK;
+    if (_map1_->count != _map2_->count)
+        return 0;
+    if (_map1_->root == _map2_->root)
+        return 1;
+    return ptm_impl_contains_all(_map1_, _map2_, _map1_->root);
+}
+static struct ptreemap *ptm_impl_version(struct ptreemap *_map_, struct ptreemap_node *root, size_t count)
+{
+    struct ptreemap *result = _map_->alloc->malloc(sizeof(struct ptreemap));
+    if (!result)
+    {
+        ptm_impl_release(_map_, root);
+        _map_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    result->root = root;
+    result->count = count;
+    result->flag = CMC_FLAG_OK;
+    result->f_key = _map_->f_key;
+    result->f_val = _map_->f_val;
+    result->alloc = _map_->alloc;
+    (result)->callbacks = _map_->callbacks;
+    _map_->flag = CMC_FLAG_OK;
+    return result;
+}
+static void ptm_impl_acquire(struct ptreemap_node *node)
+{
+    if (node)
+        node->refcount++;
+}
+static void ptm_impl_release(struct ptreemap *_map_, struct ptreemap_node *node)
+{
+    if (!node || --node->refcount > 0)
+        return;
+    ptm_impl_release(_map_, node->left);
+    ptm_impl_release(_map_, node->right);
+    _map_->alloc->free(node);
+}
+static struct ptreemap_node *ptm_impl_node(struct ptreemap_node *node, size_t key, size_t value,
+                                           struct ptreemap_node *left, struct ptreemap_node *right)
+{
+    unsigned char h_l = ptm_impl_h(left);
+    unsigned char h_r = ptm_impl_h(right);
+    node->key = key;
+    node->value = value;
+    node->refcount = 1;
+    node->height = 1 + (h_l > h_r ? h_l : h_r);
+    node->left = left;
+    node->right = right;
+    return node;
+}
+static struct ptreemap_node *ptm_impl_balance(struct ptreemap *_map_, size_t key, size_t value,
+                                              struct ptreemap_node *left, struct ptreemap_node *right)
+{
+    int balance = ptm_impl_h(right) - ptm_impl_h(left);
+    struct ptreemap_node *heavy = balance >= 2 ? right : (balance <= -2 ? left : ((void *)0));
+    struct ptreemap_node *inner = ((void *)0);
+    if (!heavy)
+        inner = ((void *)0);
+    else if (heavy == right && ptm_impl_h(right->left) > ptm_impl_h(right->right))
+        inner = right->left;
+    else if (heavy == left && ptm_impl_h(left->right) > ptm_impl_h(left->left))
+        inner = left->right;
+    size_t needed = 1 + (heavy ? 1 : 0) + (inner ? 1 : 0);
+    struct ptreemap_node *nodes[3] = { ((void *)0), ((void *)0), ((void *)0) };
+    for (size_t i = 0; i < needed; i++)
+    {
+        if (!(nodes[i] = _map_->alloc->malloc(sizeof(struct ptreemap_node))))
+        {
+            for (size_t j = 0; j < i; j++)
+                _map_->alloc->free(nodes[j]);
+            ptm_impl_release(_map_, left);
+            ptm_impl_release(_map_, right);
+            _map_->flag = CMC_FLAG_ALLOC;
+            return ((void *)0);
+        }
+    }
+    if (!heavy)
+        return ptm_impl_node(nodes[0], key, value, left, right);
+    struct ptreemap_node *result = ((void *)0);
+    if (heavy == right && !inner)
+    {
+        ptm_impl_acquire(right->left);
+        ptm_impl_acquire(right->right);
+        struct ptreemap_node *l = ptm_impl_node(nodes[1], key, value, left, right->left);
+        result = ptm_impl_node(nodes[0], right->key, right->value, l, right->right);
+    }
+    else if (heavy == left && !inner)
+    {
+        ptm_impl_acquire(left->left);
+        ptm_impl_acquire(left->right);
+        struct ptreemap_node *r = ptm_impl_node(nodes[1], key, value, left->right, right);
+        result = ptm_impl_node(nodes[0], left->key, left->value, left->left, r);
+    }
+    else if (heavy == right)
+    {
+        ptm_impl_acquire(inner->left);
+        ptm_impl_acquire(inner->right);
+        ptm_impl_acquire(right->right);
+        struct ptreemap_node *l = ptm_impl_node(nodes[1], key, value, left, inner->left);
+        struct ptreemap_node *r = ptm_impl_node(nodes[2], right->key, right->value, inner->right, right->right);
+        result = ptm_impl_node(nodes[0], inner->key, inner->value, l, r);
+    }
+    else
+    {
+        ptm_impl_acquire(inner->left);
+        ptm_impl_acquire(inner->right);
+        ptm_impl_acquire(left->left);
+        struct ptreemap_node *l = ptm_impl_node(nodes[1], left->key, left->value, left->left, inner->left);
+        struct ptreemap_node *r = ptm_impl_node(nodes[2], key, value, inner->right, right);
+        result = ptm_impl_node(nodes[0], inner->key, inner->value, l, r);
+    }
+    ptm_impl_release(_map_, heavy);
+    return result;
+}
+static struct ptreemap_node *ptm_impl_put(struct ptreemap *_map_, struct ptreemap_node *node, size_t key, size_t value,
+                                          _Bool update, size_t *old_value)
+{
+    if (!node)
+    {
+        if (update)
+        {
+            _map_->flag = CMC_FLAG_NOT_FOUND;
+            return ((void *)0);
+        }
+        return ptm_impl_balance(_map_, key, value, ((void *)0), ((void *)0));
+    }
+    int cmp = _map_->f_key->cmp(key, node->key);
+    if (cmp == 0)
+    {
+        if (!update)
+        {
+            _map_->flag = CMC_FLAG_DUPLICATE;
+            return ((void *)0);
+        }
+        if (old_value)
+            *old_value = node->value;
+        ptm_impl_acquire(node->left);
+        ptm_impl_acquire(node->right);
+        return ptm_impl_balance(_map_, node->key, value, node->left, node->right);
+    }
+    else if (cmp < 0)
+    {
+        struct ptreemap_node *left = ptm_impl_put(_map_, node->left, key, value, update, old_value);
+        if (!left)
+            return ((void *)0);
+        ptm_impl_acquire(node->right);
+        return ptm_impl_balance(_map_, node->key, node->value, left, node->right);
+    }
+    struct ptreemap_node *right = ptm_impl_put(_map_, node->right, key, value, update, old_value);
+    if (!right)
+        return ((void *)0);
+    ptm_impl_acquire(node->left);
+    return ptm_impl_balance(_map_, node->key, node->value, node->left, right);
+}
+static _Bool ptm_impl_delete(struct ptreemap *_map_, struct ptreemap_node *node, size_t key, size_t *out_value,
+                             struct ptreemap_node **result)
+{
+    if (!node)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    int cmp = _map_->f_key->cmp(key, node->key);
+    struct ptreemap_node *left = node->left;
+    struct ptreemap_node *right = node->right;
+    if (cmp < 0)
+    {
+        if (!ptm_impl_delete(_map_, node->left, key, out_value, &left))
+            return 0;
+        ptm_impl_acquire(right);
+    }
+    else if (cmp > 0)
+    {
+        if (!ptm_impl_delete(_map_, node->right, key, out_value, &right))
+            return 0;
+        ptm_impl_acquire(left);
+    }
+    else
+    {
+        if (out_value)
+            *out_value = node->value;
+        ptm_impl_acquire(left);
+        if (right)
+        {
+            size_t min_key;
+            size_t min_value;
+            if (!ptm_impl_delete_min(_map_, node->right, &min_key, &min_value, &right))
+            {
+                ptm_impl_release(_map_, left);
+                return 0;
+            }
+            *result = ptm_impl_balance(_map_, min_key, min_value, left, right);
+            return *result != ((void *)0);
+        }
+        *result = left;
+        return 1;
+    }
+    *result = ptm_impl_balance(_map_, node->key, node->value, left, right);
+    return *result != ((void *)0);
+}
+static _Bool ptm_impl_delete_min(struct ptreemap *_map_, struct ptreemap_node *node, size_t *key, size_t *value,
+                                 struct ptreemap_node **result)
+{
+    if (!node->left)
+    {
+        *key = node->key;
+        *value = node->value;
+        ptm_impl_acquire(node->right);
+        *result = node->right;
+        return 1;
+    }
+    struct ptreemap_node *left = ((void *)0);
+    if (!ptm_impl_delete_min(_map_, node->left, key, value, &left))
+        return 0;
+    ptm_impl_acquire(node->right);
+    *result = ptm_impl_balance(_map_, node->key, node->value, left, node->right);
+    return *result != ((void *)0);
+}
+static struct ptreemap_node *ptm_impl_get_node(struct ptreemap *_map_, size_t key)
+{
+    struct ptreemap_node *node = _map_->root;
+    while (node)
+    {
+        int cmp = _map_->f_key->cmp(key, node->key);
+        if (cmp < 0)
+            node = node->left;
+        else if (cmp > 0)
+            node = node->right;
+        else
+            return node;
+    }
+    return ((void *)0);
+}
+static _Bool ptm_impl_contains_all(struct ptreemap *_map1_, struct ptreemap *_map2_, struct ptreemap_node *node)
+{
+    if (!node)
+        return 1;
+    struct ptreemap_node *other = ptm_impl_get_node(_map2_, node->key);
+    if (!other || _map1_->f_val->cmp(node->value, other->value) != 0)
+        return 0;
+    return ptm_impl_contains_all(_map1_, _map2_, node->left) && ptm_impl_contains_all(_map1_, _map2_, node->right);
+}
+static unsigned char ptm_impl_h(struct ptreemap_node *node)
+{
+    if (node == ((void *)0))
+        return 0;
+    return node->height;
+}
+static void ptm_impl_iter_first(struct ptreemap_iter *iter, size_t depth, struct ptreemap_node *node);
+static void ptm_impl_iter_last(struct ptreemap_iter *iter, size_t depth, struct ptreemap_node *node);
+struct ptreemap_iter ptm_iter_start(struct ptreemap *target)
+{
+    struct ptreemap_iter iter;
+    iter.target = target;
+    iter.depth = 0;
+    iter.index = 0;
+    iter.start = 1;
+    iter.end = ptm_empty(target);
+    if (!ptm_empty(target))
+        ptm_impl_iter_first(&iter, 0, target->root);
+    return iter;
+}
+struct ptreemap_iter ptm_iter_end(struct ptreemap *target)
+{
+    struct ptreemap_iter iter;
+    iter.target = target;
+    iter.depth = 0;
+    iter.index = 0;
+    iter.start = ptm_empty(target);
+    iter.end = 1;
+    if (!ptm_empty(target))
+    {
+        iter.index = target->count - 1;
+        ptm_impl_iter_last(&iter, 0, target->root);
+    }
+    return iter;
+}
+_Bool ptm_iter_at_start(struct ptreemap_iter *iter)
+{
+    return ptm_empty(iter->target) || iter->start;
+}
+_Bool ptm_iter_at_end(struct ptreemap_iter *iter)
+{
+    return ptm_empty(iter->target) || iter->end;
+}
+_Bool ptm_iter_to_start(struct ptreemap_iter *iter)
+{
+    if (!ptm_empty(iter->target))
+    {
+        *iter = ptm_iter_start(iter->target);
+        return 1;
+    }
+    return 0;
+}
+_Bool ptm_iter_to_end(struct ptreemap_iter *iter)
+{
+    if (!ptm_empty(iter->target))
+    {
+        *iter = ptm_iter_end(iter->target);
+        return 1;
+    }
+    return 0;
+}
+_Bool ptm_iter_next(struct ptreemap_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 >= iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = ptm_empty(iter->target);
+    struct ptreemap_node *node = iter->path[iter->depth];
+    if (node->right)
+        ptm_impl_iter_first(iter, iter->depth + 1, node->right);
+    else
+    {
+        while (iter->path[iter->depth - 1]->right == iter->path[iter->depth])
+            iter->depth--;
+        iter->depth--;
+    }
+    iter->index++;
+    return 1;
+}
+_Bool ptm_iter_prev(struct ptreemap_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = ptm_empty(iter->target);
+    struct ptreemap_node *node = iter->path[iter->depth];
+    if (node->left)
+        ptm_impl_iter_last(iter, iter->depth + 1, node->left);
+    else
+    {
+        while (iter->path[iter->depth - 1]->left == iter->path[iter->depth])
+            iter->depth--;
+        iter->depth--;
+    }
+    iter->index--;
+    return 1;
+}
+_Bool ptm_iter_advance(struct ptreemap_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->index + 1 >= iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index + steps >= iter->target->count)
+        return 0;
+    for (size_t i = 0; i < steps; i++)
+        ptm_iter_next(iter);
+    return 1;
+}
+_Bool ptm_iter_rewind(struct ptreemap_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->index == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->index < steps)
+        return 0;
+    for (size_t i = 0; i < steps; i++)
+        ptm_iter_prev(iter);
+    return 1;
+}
+_Bool ptm_iter_go_to(struct ptreemap_iter *iter, size_t index)
+{
+    if (index >= iter->target->count)
+        return 0;
+    if (iter->index > index)
+        return ptm_iter_rewind(iter, iter->index - index);
+    else if (iter->index < index)
+        return ptm_iter_advance(iter, index - iter->index);
+    return 1;
+}
+size_t ptm_iter_key(struct ptreemap_iter *iter)
+{
+    if (ptm_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->path[iter->depth]->key;
+}
+size_t ptm_iter_value(struct ptreemap_iter *iter)
+{
+    if (ptm_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->path[iter->depth]->value;
+}
+size_t ptm_iter_index(struct ptreemap_iter *iter)
+{
+    return iter->index;
+}
+static void ptm_impl_iter_first(struct ptreemap_iter *iter, size_t depth, struct ptreemap_node *node)
+{
+    iter->path[depth] = node;
+    while (node->left)
+    {
+        node = node->left;
+        iter->path[++depth] = node;
+    }
+    iter->depth = depth;
+}
+static void ptm_impl_iter_last(struct ptreemap_iter *iter, size_t depth, struct ptreemap_node *node)
+{
+    iter->path[depth] = node;
+    while (node->right)
+    {
+        node = node->right;
+        iter->path[++depth] = node;
+    }
+    iter->depth = depth;
+}
+static _Bool ptm_impl_print_node(struct ptreemap *_map_, struct ptreemap_node *node, FILE *fptr, size_t *printed,
+                                 const char *separator, const char *key_val_sep);
+_Bool ptm_to_string(struct ptreemap *_map_, FILE *fptr)
+{
+    struct ptreemap *m_ = _map_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s, %s> "
+                        "at %p { "
+                        "root:%p, "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "f_key:%p, "
+                        "alloc:%p, "
+                        "callbacks:%p }",
+                        "ptreemap", "size_t", "size_t", m_, m_->root, m_->count, m_->flag, m_->f_key, m_->f_val,
+                        m_->alloc, (m_)->callbacks);
+}
+_Bool ptm_print(struct ptreemap *_map_, FILE *fptr, const char *start, const char *separator, const char *end,
+                const char *key_val_sep)
+{
+    fprintf(fptr, "%s", start);
+    size_t printed = 0;
+    if (!ptm_impl_print_node(_map_, _map_->root, fptr, &printed, separator, key_val_sep))
+        return 0;
+    fprintf(fptr, "%s", end);
+    return 1;
+}
+static _Bool ptm_impl_print_node(struct ptreemap *_map_, struct ptreemap_node *node, FILE *fptr, size_t *printed,
+                                 const char *separator, const char *key_val_sep)
+{
+    if (!node)
+        return 1;
+    if (!ptm_impl_print_node(_map_, node->left, fptr, printed, separator, key_val_sep))
+        return 0;
+    if (!_map_->f_key->str(fptr, node->key))
+        return 0;
+    fprintf(fptr, "%s", key_val_sep);
+    if (!_map_->f_val->str(fptr, node->value))
+        return 0;
+    if (++(*printed) < _map_->count)
+        fprintf(fptr, "%s", separator);
+    return ptm_impl_print_node(_map_, node->right, fptr, printed, separator, key_val_sep);
+}
@@ -1,6 +1,7 @@
 
 #include "tst_cmc_queue.h"
 
+static void q_impl_evict(struct queue *_queue_, size_t value);
 struct queue *q_new(size_t capacity, struct queue_fval *f_val)
 {
     return q_new_custom(capacity, f_val, ((void *)0), ((void *)0));
@@ -28,6 +29,8 @@ struct queue *q_new_custom(size_t capacity, struct queue_fval *f_val, struct cmc
     _queue_->count = 0;
     _queue_->front = 0;
     _queue_->back = 0;
+    _queue_->overwrite = 0;
+    _queue_->evict = ((void *)0);
     _queue_->flag = CMC_FLAG_OK;
     _queue_->f_val = f_val;
     _queue_->alloc = alloc;
@@ -77,7 +80,16 @@ _Bool q_enqueue(struct queue *_queue_, size_t value)
 {
     if (q_full(_queue_))
     {
-        if (!q_resize(_queue_, _queue_->capacity * 2))
+        if (_queue_->overwrite)
+        {
+            q_impl_evict(_queue_, _queue_->buffer[_queue_->front]);
+            _queue_->front = (_queue_->front == _queue_->capacity - 1) ? 0 : _queue_->front + 1;
+            _queue_->count--;
+            if ((_queue_)->callbacks && (_queue_)->callbacks->delete)
+                (_queue_)->callbacks->delete ();
+            ;
+        }
+        else if (!q_resize(_queue_, _queue_->capacity * 2))
             return 0;
     }
     _queue_->buffer[_queue_->back] = value;
@@ -105,6 +117,56 @@ _Bool q_dequeue(struct queue *_queue_)
     ;
     return 1;
 }
+_Bool q_enqueue_many(struct queue *_queue_, size_t *values, size_t count)
+{
+    if (count == 0)
+    {
+        _queue_->flag = CMC_FLAG_OK;
+        return 1;
+    }
+    if (_queue_->overwrite)
+    {
+        size_t skipped = count > _queue_->capacity ? count - _queue_->capacity : 0;
+        size_t evicted = _queue_->count + count - skipped;
+        evicted = evicted > _queue_->capacity ? evicted - _queue_->capacity : 0;
+        for (size_t i = 0; i < evicted; i++)
+        {
+            q_impl_evict(_queue_, _queue_->buffer[_queue_->front]);
+            _queue_->front = (_queue_->front == _queue_->capacity - 1) ? 0 : _queue_->front + 1;
+        }
+        for (size_t i = 0; i < skipped; i++)
+            q_impl_evict(_queue_, values[i]);
+        if (evicted + skipped > 0)
+        {
+            if ((_queue_)->callbacks && (_queue_)->callbacks->delete)
+                (_queue_)->callbacks->delete ();
+            ;
+        }
+        _queue_->count -= evicted;
+        values += skipped;
+        count -= skipped;
+    }
+    else if (_queue_->count + count > _queue_->capacity)
+    {
+        size_t capacity = _queue_->capacity * 2;
+        if (capacity < _queue_->count + count)
+            capacity = _queue_->count + count;
+        if (!q_resize(_queue_, capacity))
+            return 0;
+    }
+    size_t first = _queue_->capacity - _queue_->back;
+    if (first > count)
+        first = count;
+    memcpy(_queue_->buffer + _queue_->back, values, sizeof(size_t) * first);
+    memcpy(_queue_->buffer, values + first, sizeof(size_t) * (count - first));
+    _queue_->back = (_queue_->back + count) % _queue_->capacity;
+    _queue_->count += count;
+    _queue_->flag = CMC_FLAG_OK;
+    if ((_queue_)->callbacks && (_queue_)->callbacks->create)
+        (_queue_)->callbacks->create();
+    ;
+    return 1;
+}
 size_t q_peek(struct queue *_queue_)
 {
     if (q_empty(_queue_))
@@ -122,14 +184,27 @@ _Bool q_contains(struct queue *_queue_, size_t value)
 {
     _queue_->flag = CMC_FLAG_OK;
     _Bool result = 0;
-    for (size_t i = _queue_->front, j = 0; j < _queue_->count; j++)
+    if (_queue_->f_val->find)
+    {
+        size_t first = _queue_->capacity - _queue_->front;
+        if (first > _queue_->count)
+            first = _queue_->count;
+        size_t second = _queue_->count - first;
+        result = _queue_->f_val->find(_queue_->buffer + _queue_->front, first, value) < first || _queue_->f_val->find(_queue_->buffer,
+                                                                                                                      second,
+                                                                                                                      value) < second;
+    }
+    else
     {
-        if (_queue_->f_val->cmp(_queue_->buffer[i], value) == 0)
+        for (size_t i = _queue_->front, j = 0; j < _queue_->count; j++)
         {
-            result = 1;
-            break;
+            if (_queue_->f_val->cmp(_queue_->buffer[i], value) == 0)
+            {
+                result = 1;
+                break;
+            }
+            i = (i + 1) % _queue_->capacity;
         }
-        i = (i + 1) % _queue_->capacity;
     }
     if ((_queue_)->callbacks && (_queue_)->callbacks->read)
         (_queue_)->callbacks->read();
@@ -188,6 +263,12 @@ success:
     ;
     return 1;
 }
+void q_set_overwrite(struct queue *_queue_, _Bool overwrite, void (*evict)(size_t))
+{
+    _queue_->overwrite = overwrite;
+    _queue_->evict = evict;
+    _queue_->flag = CMC_FLAG_OK;
+}
 struct queue *q_copy_of(struct queue *_queue_)
 {
     struct queue *result = q_new_custom(_queue_->capacity, _queue_->f_val, _queue_->alloc, ((void *)0));
@@ -215,7 +296,9 @@ struct queue *q_copy_of(struct queue *_queue_)
     }
     result->count = _queue_->count;
     result->front = 0;
-    result->back = _queue_->count;
+    result->back = _queue_->count % _queue_->capacity;
+    result->overwrite = _queue_->overwrite;
+    result->evict = _queue_->evict;
     _queue_->flag = CMC_FLAG_OK;
     return result;
 }
@@ -235,6 +318,13 @@ _Bool q_equals(struct queue *_queue1_, struct queue *_queue2_)
     }
     return 1;
 }
+static void q_impl_evict(struct queue *_queue_, size_t value)
+{
+    if (_queue_->evict)
+        _queue_->evict(value);
+    else if (_queue_->f_val->free)
+        _queue_->f_val->free(value);
+}
 struct queue_iter q_iter_start(struct queue *target)
 {
     struct queue_iter iter;
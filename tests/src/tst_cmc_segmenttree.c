@@ -0,0 +1,319 @@
+
+#include "tst_cmc_segmenttree.h"
+
+static struct segmenttree *sgt_impl_new(size_t count, struct segmenttree_fval *f_val, struct cmc_alloc_node *alloc);
+static void sgt_impl_build(struct segmenttree *_tree_, size_t *values, size_t node, size_t lo, size_t hi);
+static void sgt_impl_apply(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi, size_t update);
+static void sgt_impl_push(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi);
+static void sgt_impl_set(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi, size_t index, size_t value);
+static void sgt_impl_update(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi, size_t from, size_t to,
+                            size_t update);
+static size_t sgt_impl_query(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi, size_t from, size_t to);
+struct segmenttree *sgt_new(size_t *values, size_t count, struct segmenttree_fval *f_val)
+{
+    return sgt_new_custom(values, count, f_val, ((void *)0), ((void *)0));
+}
+struct segmenttree *sgt_new_custom(size_t *values, size_t count, struct segmenttree_fval *f_val,
+                                   struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!values)
+        return ((void *)0);
+    struct segmenttree *_tree_ = sgt_impl_new(count, f_val, alloc);
+    if (!_tree_)
+        return ((void *)0);
+    sgt_impl_build(_tree_, values, 1, 0, count);
+    (_tree_)->callbacks = callbacks;
+    return _tree_;
+}
+void sgt_free(struct segmenttree *_tree_)
+{
+    _tree_->alloc->free(_tree_->tree);
+    _tree_->alloc->free(_tree_->lazy);
+    _tree_->alloc->free(_tree_->pending);
+    _tree_->alloc->free(_tree_);
+}
+void sgt_customize(struct segmenttree *_tree_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _tree_->alloc = &cmc_alloc_node_default;
+    else
+        _tree_->alloc = alloc;
+    (_tree_)->callbacks = callbacks;
+    _tree_->flag = CMC_FLAG_OK;
+}
+_Bool sgt_set(struct segmenttree *_tree_, size_t index, size_t value)
+{
+    if (index >= _tree_->count)
+    {
+        _tree_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    sgt_impl_set(_tree_, 1, 0, _tree_->count, index, value);
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->update)
+        (_tree_)->callbacks->update();
+    ;
+    return 1;
+}
+_Bool sgt_update(struct segmenttree *_tree_, size_t from, size_t to, size_t update)
+{
+    if (!_tree_->f_val->apply || from > to)
+    {
+        _tree_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    if (to >= _tree_->count)
+    {
+        _tree_->flag = CMC_FLAG_RANGE;
+        return 0;
+    }
+    sgt_impl_update(_tree_, 1, 0, _tree_->count, from, to + 1, update);
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->update)
+        (_tree_)->callbacks->update();
+    ;
+    return 1;
+}
+size_t sgt_get(struct segmenttree *_tree_, size_t index)
+{
+    if (index >= _tree_->count)
+    {
+        _tree_->flag = CMC_FLAG_RANGE;
+        return (size_t){ 0 };
+    }
+    size_t result = sgt_impl_query(_tree_, 1, 0, _tree_->count, index, index + 1);
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->read)
+        (_tree_)->callbacks->read();
+    ;
+    return result;
+}
+size_t sgt_query(struct segmenttree *_tree_, size_t from, size_t to)
+{
+    if (from > to)
+    {
+        _tree_->flag = CMC_FLAG_INVALID;
+        return (size_t){ 0 };
+    }
+    if (to >= _tree_->count)
+    {
+        _tree_->flag = CMC_FLAG_RANGE;
+        return (size_t){ 0 };
+    }
+    size_t result = sgt_impl_query(_tree_, 1, 0, _tree_->count, from, to + 1);
+    _tree_->flag = CMC_FLAG_OK;
+    if ((_tree_)->callbacks && (_tree_)->callbacks->read)
+        (_tree_)->callbacks->read();
+    ;
+    return result;
+}
+size_t sgt_count(struct segmenttree *_tree_)
+{
+    return _tree_->count;
+}
+int sgt_flag(struct segmenttree *_tree_)
+{
+    return _tree_->flag;
+}
+struct segmenttree *sgt_copy_of(struct segmenttree *_tree_)
+{
+    struct segmenttree *result = sgt_impl_new(_tree_->count, _tree_->f_val, _tree_->alloc);
+    if (!result)
+    {
+        _tree_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    (result)->callbacks = _tree_->callbacks;
+    if (_tree_->f_val->cpy)
+    {
+        for (size_t i = 0; i < _tree_->nodes; i++)
+            result->tree[i] = _tree_->f_val->cpy(_tree_->tree[i]);
+    }
+    else
+        memcpy(result->tree, _tree_->tree, sizeof(size_t) * _tree_->nodes);
+    if (_tree_->lazy)
+    {
+        memcpy(result->lazy, _tree_->lazy, sizeof(size_t) * _tree_->nodes);
+        memcpy(result->pending, _tree_->pending, sizeof(_Bool) * _tree_->nodes);
+    }
+    _tree_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool sgt_equals(struct segmenttree *_tree1_, struct segmenttree *_tree2_)
+{
+    _tree1_->flag = CMC_FLAG_OK;
+    _tree2_->flag = CMC_FLAG_OK;
+    if (_tree1_->count != _tree2_->count)
+        return 0;
+    for (size_t i = 0; i < _tree1_->count; i++)
+    {
+        size_t value1 = sgt_impl_query(_tree1_, 1, 0, _tree1_->count, i, i + 1);
+        size_t value2 = sgt_impl_query(_tree2_, 1, 0, _tree2_->count, i, i + 1);
+        if (_tree1_->f_val->cmp(value1, value2) != 0)
+            return 0;
+    }
+    return 1;
+}
+static struct segmenttree *sgt_impl_new(size_t count, struct segmenttree_fval *f_val, struct cmc_alloc_node *alloc)
+{
+    if (count == 0 || !f_val || !f_val->combine)
+        return ((void *)0);
+    size_t nodes = 1;
+    while (nodes < count)
+    {
+        if (nodes > 0xffffffffffffffffULL / 4)
+            return ((void *)0);
+        nodes *= 2;
+    }
+    nodes *= 2;
+    if (nodes > 0xffffffffffffffffULL / sizeof(size_t))
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct segmenttree *_tree_ = alloc->malloc(sizeof(struct segmenttree));
+    if (!_tree_)
+        return ((void *)0);
+    _tree_->tree = alloc->malloc(sizeof(size_t) * nodes);
+    _tree_->lazy = ((void *)0);
+    _tree_->pending = ((void *)0);
+    if (!_tree_->tree)
+    {
+        alloc->free(_tree_);
+        return ((void *)0);
+    }
+    if (f_val->apply)
+    {
+        _tree_->lazy = alloc->malloc(sizeof(size_t) * nodes);
+        _tree_->pending = alloc->calloc(nodes, sizeof(_Bool));
+        if (!_tree_->lazy || !_tree_->pending)
+        {
+            alloc->free(_tree_->tree);
+            alloc->free(_tree_->lazy);
+            alloc->free(_tree_->pending);
+            alloc->free(_tree_);
+            return ((void *)0);
+        }
+    }
+    _tree_->nodes = nodes;
+    _tree_->count = count;
+    _tree_->flag = CMC_FLAG_OK;
+    _tree_->f_val = f_val;
+    _tree_->alloc = alloc;
+    (_tree_)->callbacks = ((void *)0);
+    return _tree_;
+}
+static void sgt_impl_build(struct segmenttree *_tree_, size_t *values, size_t node, size_t lo, size_t hi)
+{
+    if (hi - lo == 1)
+    {
+        _tree_->tree[node] = values[lo];
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    sgt_impl_build(_tree_, values, node * 2, lo, mid);
+    sgt_impl_build(_tree_, values, node * 2 + 1, mid, hi);
+    _tree_->tree[node] = _tree_->f_val->combine(_tree_->tree[node * 2], _tree_->tree[node * 2 + 1]);
+}
+static void sgt_impl_apply(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi, size_t update)
+{
+    _tree_->tree[node] = _tree_->f_val->apply(_tree_->tree[node], update, hi - lo);
+    if (hi - lo == 1)
+        return;
+    if (_tree_->pending[node])
+        _tree_->lazy[node] = _tree_->f_val->apply(_tree_->lazy[node], update, 1);
+    else
+        _tree_->lazy[node] = update;
+    _tree_->pending[node] = 1;
+}
+static void sgt_impl_push(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi)
+{
+    if (!_tree_->pending || !_tree_->pending[node])
+        return;
+    size_t mid = lo + (hi - lo) / 2;
+    sgt_impl_apply(_tree_, node * 2, lo, mid, _tree_->lazy[node]);
+    sgt_impl_apply(_tree_, node * 2 + 1, mid, hi, _tree_->lazy[node]);
+    _tree_->pending[node] = 0;
+}
+static void sgt_impl_set(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi, size_t index, size_t value)
+{
+    if (hi - lo == 1)
+    {
+        _tree_->tree[node] = value;
+        return;
+    }
+    sgt_impl_push(_tree_, node, lo, hi);
+    size_t mid = lo + (hi - lo) / 2;
+    if (index < mid)
+        sgt_impl_set(_tree_, node * 2, lo, mid, index, value);
+    else
+        sgt_impl_set(_tree_, node * 2 + 1, mid, hi, index, value);
+    _tree_->tree[node] = _tree_->f_val->combine(_tree_->tree[node * 2], _tree_->tree[node * 2 + 1]);
+}
+static void sgt_impl_update(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi, size_t from, size_t to,
+                            size_t update)
+{
+    if (from <= lo && hi <= to)
+    {
+        sgt_impl_apply(_tree_, node, lo, hi, update);
+        return;
+    }
+    sgt_impl_push(_tree_, node, lo, hi);
+    size_t mid = lo + (hi - lo) / 2;
+    if (from < mid)
+        sgt_impl_update(_tree_, node * 2, lo, mid, from, to, update);
+    if (to > mid)
+        sgt_impl_update(_tree_, node * 2 + 1, mid, hi, from, to, update);
+    _tree_->tree[node] = _tree_->f_val->combine(_tree_->tree[node * 2], _tree_->tree[node * 2 + 1]);
+}
+static size_t sgt_impl_query(struct segmenttree *_tree_, size_t node, size_t lo, size_t hi, size_t from, size_t to)
+{
+    if (from <= lo && hi <= to)
+        return _tree_->tree[node];
+    sgt_impl_push(_tree_, node, lo, hi);
+    size_t mid = lo + (hi - lo) / 2;
+    if (to <= mid)
+        return sgt_impl_query(_tree_, node * 2, lo, mid, from, to);
+    if (from >= mid)
+        return sgt_impl_query(_tree_, node * 2 + 1, mid, hi, from, to);
+    size_t left = sgt_impl_query(_tree_, node * 2, lo, mid, from, to);
+    size_t right = sgt_impl_query(_tree_, node * 2 + 1, mid, hi, from, to);
+    return _tree_->f_val->combine(left, right);
+}
+_Bool sgt_to_string(struct segmenttree *_tree_, FILE *fptr)
+{
+    struct segmenttree *t_ = _tree_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "tree:%p, "
+                        "lazy:%p, "
+                        "pending:%p, "
+                        "nodes:%"
+                        "I64u"
+                        ", "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks: %p }",
+                        "segmenttree", "size_t", t_, t_->tree, t_->lazy, t_->pending, t_->nodes, t_->count, t_->flag,
+                        t_->f_val, t_->alloc, (t_)->callbacks);
+}
+_Bool sgt_print(struct segmenttree *_tree_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    fprintf(fptr, "%s", start);
+    for (size_t i = 0; i < _tree_->count; i++)
+    {
+        size_t value = sgt_impl_query(_tree_, 1, 0, _tree_->count, i, i + 1);
+        if (!_tree_->f_val->str(fptr, value))
+            return 0;
+        if (i + 1 < _tree_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
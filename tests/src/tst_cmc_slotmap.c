@@ -0,0 +1,525 @@
+
+#include "tst_cmc_slotmap.h"
+
+static struct slotmap_entry *sm_impl_get_slot(struct slotmap *_map_, uint64_t handle);
+struct slotmap *sm_new(size_t capacity, struct slotmap_fval *f_val)
+{
+    return sm_new_custom(capacity, f_val, ((void *)0), ((void *)0));
+}
+struct slotmap *sm_new_custom(size_t capacity, struct slotmap_fval *f_val, struct cmc_alloc_node *alloc,
+                              struct cmc_callbacks *callbacks)
+{
+    ;
+    if (capacity == 0 || capacity >= (4294967295U))
+        return ((void *)0);
+    if (!f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct slotmap *_map_ = alloc->malloc(sizeof(struct slotmap));
+    if (!_map_)
+        return ((void *)0);
+    _map_->buffer = alloc->malloc(sizeof(size_t) * capacity);
+    _map_->owner = alloc->malloc(sizeof(uint32_t) * capacity);
+    _map_->slots = alloc->malloc(sizeof(struct slotmap_entry) * capacity);
+    if (!_map_->buffer || !_map_->owner || !_map_->slots)
+    {
+        alloc->free(_map_->buffer);
+        alloc->free(_map_->owner);
+        alloc->free(_map_->slots);
+        alloc->free(_map_);
+        return ((void *)0);
+    }
+    _map_->capacity = capacity;
+    _map_->count = 0;
+    _map_->used = 0;
+    _map_->free = (4294967295U);
+    _map_->flag = CMC_FLAG_OK;
+    _map_->f_val = f_val;
+    _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    return _map_;
+}
+void sm_clear(struct slotmap *_map_)
+{
+    for (size_t i = 0; i < _map_->count; i++)
+    {
+        uint32_t s = _map_->owner[i];
+        struct slotmap_entry *slot = &(_map_->slots[s]);
+        if (_map_->f_val->free)
+            _map_->f_val->free(_map_->buffer[i]);
+        slot->generation++;
+        if (slot->generation != 0)
+        {
+            slot->index = _map_->free;
+            _map_->free = s;
+        }
+    }
+    _map_->count = 0;
+    _map_->flag = CMC_FLAG_OK;
+}
+void sm_free(struct slotmap *_map_)
+{
+    if (_map_->f_val->free)
+    {
+        for (size_t i = 0; i < _map_->count; i++)
+            _map_->f_val->free(_map_->buffer[i]);
+    }
+    _map_->alloc->free(_map_->buffer);
+    _map_->alloc->free(_map_->owner);
+    _map_->alloc->free(_map_->slots);
+    _map_->alloc->free(_map_);
+}
+void sm_customize(struct slotmap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _map_->alloc = &cmc_alloc_node_default;
+    else
+        _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    _map_->flag = CMC_FLAG_OK;
+}
+_Bool sm_insert(struct slotmap *_map_, size_t value, uint64_t *handle)
+{
+    if (_map_->free == (4294967295U) && _map_->used == _map_->capacity)
+    {
+        size_t capacity = _map_->capacity * 2;
+        if (capacity >= (4294967295U))
+            capacity = (4294967295U) - 1;
+        if (capacity == _map_->capacity)
+        {
+            _map_->flag = CMC_FLAG_ERROR;
+            return 0;
+        }
+        if (!sm_resize(_map_, capacity))
+            return 0;
+    }
+    uint32_t s;
+    if (_map_->free != (4294967295U))
+    {
+        s = _map_->free;
+        _map_->free = _map_->slots[s].index;
+    }
+    else
+    {
+        s = (uint32_t)_map_->used++;
+        _map_->slots[s].generation = 0;
+    }
+    struct slotmap_entry *slot = &(_map_->slots[s]);
+    slot->index = (uint32_t)_map_->count;
+    slot->generation++;
+    _map_->buffer[_map_->count] = value;
+    _map_->owner[_map_->count] = s;
+    if (handle)
+        *handle = (((uint64_t)(slot->generation) << 32) | (uint64_t)(s));
+    _map_->count++;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->create)
+        (_map_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool sm_update(struct slotmap *_map_, uint64_t handle, size_t new_value, size_t *old_value)
+{
+    if (sm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct slotmap_entry *slot = sm_impl_get_slot(_map_, handle);
+    if (!slot)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (old_value)
+        *old_value = _map_->buffer[slot->index];
+    _map_->buffer[slot->index] = new_value;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->update)
+        (_map_)->callbacks->update();
+    ;
+    return 1;
+}
+_Bool sm_remove(struct slotmap *_map_, uint64_t handle, size_t *out_value)
+{
+    if (sm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct slotmap_entry *slot = sm_impl_get_slot(_map_, handle);
+    if (!slot)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    uint32_t index = slot->index;
+    size_t last = _map_->count - 1;
+    if (out_value)
+        *out_value = _map_->buffer[index];
+    _map_->buffer[index] = _map_->buffer[last];
+    _map_->owner[index] = _map_->owner[last];
+    _map_->slots[_map_->owner[index]].index = index;
+    slot->generation++;
+    if (slot->generation != 0)
+    {
+        slot->index = _map_->free;
+        _map_->free = ((uint32_t)((handle)&(4294967295U)));
+    }
+    _map_->count--;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->delete)
+        (_map_)->callbacks->delete ();
+    ;
+    return 1;
+}
+size_t sm_get(struct slotmap *_map_, uint64_t handle)
+{
+    if (sm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    struct slotmap_entry *slot = sm_impl_get_slot(_map_, handle);
+    if (!slot)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return (size_t){ 0 };
+    }
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return _map_->buffer[slot->index];
+}
+size_t *sm_get_ref(struct slotmap *_map_, uint64_t handle)
+{
+    if (sm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return ((void *)0);
+    }
+    struct slotmap_entry *slot = sm_impl_get_slot(_map_, handle);
+    if (!slot)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return ((void *)0);
+    }
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return &(_map_->buffer[slot->index]);
+}
+uint64_t sm_handle_at(struct slotmap *_map_, size_t index)
+{
+    if (index >= _map_->count)
+    {
+        _map_->flag = CMC_FLAG_RANGE;
+        return ((uint64_t)0);
+    }
+    uint32_t s = _map_->owner[index];
+    _map_->flag = CMC_FLAG_OK;
+    return (((uint64_t)(_map_->slots[s].generation) << 32) | (uint64_t)(s));
+}
+_Bool sm_contains(struct slotmap *_map_, uint64_t handle)
+{
+    _map_->flag = CMC_FLAG_OK;
+    _Bool result = sm_impl_get_slot(_map_, handle) != ((void *)0);
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool sm_empty(struct slotmap *_map_)
+{
+    return _map_->count == 0;
+}
+_Bool sm_full(struct slotmap *_map_)
+{
+    return _map_->count >= _map_->capacity;
+}
+size_t sm_count(struct slotmap *_map_)
+{
+    return _map_->count;
+}
+size_t sm_capacity(struct slotmap *_map_)
+{
+    return _map_->capacity;
+}
+int sm_flag(struct slotmap *_map_)
+{
+    return _map_->flag;
+}
+_Bool sm_resize(struct slotmap *_map_, size_t capacity)
+{
+    _map_->flag = CMC_FLAG_OK;
+    if (_map_->capacity == capacity)
+        goto success;
+    if (capacity < _map_->used || capacity == 0)
+    {
+        _map_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    if (capacity >= (4294967295U))
+    {
+        _map_->flag = CMC_FLAG_ERROR;
+        return 0;
+    }
+    size_t *new_buffer = _map_->alloc->realloc(_map_->buffer, sizeof(size_t) * capacity);
+    if (!new_buffer)
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    _map_->buffer = new_buffer;
+    uint32_t *new_owner = _map_->alloc->realloc(_map_->owner, sizeof(uint32_t) * capacity);
+    if (!new_owner)
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    _map_->owner = new_owner;
+    struct slotmap_entry *new_slots = _map_->alloc->realloc(_map_->slots, sizeof(struct slotmap_entry) * capacity);
+    if (!new_slots)
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    _map_->slots = new_slots;
+    _map_->capacity = capacity;
+success:
+    if ((_map_)->callbacks && (_map_)->callbacks->resize)
+        (_map_)->callbacks->resize();
+    ;
+    return 1;
+}
+struct slotmap *sm_copy_of(struct slotmap *_map_)
+{
+    struct slotmap *result = sm_new_custom(_map_->capacity, _map_->f_val, _map_->alloc, ((void *)0));
+    if (!result)
+    {
+        _map_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    (result)->callbacks = _map_->callbacks;
+    if (_map_->f_val->cpy)
+    {
+        for (size_t i = 0; i < _map_->count; i++)
+            result->buffer[i] = _map_->f_val->cpy(_map_->buffer[i]);
+    }
+    else
+        memcpy(result->buffer, _map_->buffer, sizeof(size_t) * _map_->count);
+    memcpy(result->owner, _map_->owner, sizeof(uint32_t) * _map_->count);
+    memcpy(result->slots, _map_->slots, sizeof(struct slotmap_entry) * _map_->used);
+    result->count = _map_->count;
+    result->used = _map_->used;
+    result->free = _map_->free;
+    _map_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool sm_equals(struct slotmap *_map1_, struct slotmap *_map2_)
+{
+    _map1_->flag = CMC_FLAG_OK;
+    _map2_->flag = CMC_FLAG_OK;
+    if (_map1_->count != _map2_->count)
+        return 0;
+    for (size_t i = 0; i < _map1_->count; i++)
+    {
+        uint32_t s = _map1_->owner[i];
+        uint64_t handle = (((uint64_t)(_map1_->slots[s].generation) << 32) | (uint64_t)(s));
+        struct slotmap_entry *slot = sm_impl_get_slot(_map2_, handle);
+        if (!slot)
+            return 0;
+        if (_map1_->f_val->cmp(_map1_->buffer[i], _map2_->buffer[slot->index]) != 0)
+            return 0;
+    }
+    return 1;
+}
+static struct slotmap_entry *sm_impl_get_slot(struct slotmap *_map_, uint64_t handle)
+{
+    uint32_t s = ((uint32_t)((handle)&(4294967295U)));
+    uint32_t generation = ((uint32_t)((handle) >> 32));
+    if (s >= _map_->used || generation % 2 == 0)
+        return ((void *)0);
+    struct slotmap_entry *slot = &(_map_->slots[s]);
+    if (slot->generation != generation)
+        return ((void *)0);
+    return slot;
+}
+struct slotmap_iter sm_iter_start(struct slotmap *target)
+{
+    struct slotmap_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.start = 1;
+    iter.end = sm_empty(target);
+    return iter;
+}
+struct slotmap_iter sm_iter_end(struct slotmap *target)
+{
+    struct slotmap_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.start = sm_empty(target);
+    iter.end = 1;
+    if (!sm_empty(target))
+        iter.cursor = target->count - 1;
+    return iter;
+}
+_Bool sm_iter_at_start(struct slotmap_iter *iter)
+{
+    return sm_empty(iter->target) || iter->start;
+}
+_Bool sm_iter_at_end(struct slotmap_iter *iter)
+{
+    return sm_empty(iter->target) || iter->end;
+}
+_Bool sm_iter_to_start(struct slotmap_iter *iter)
+{
+    if (!sm_empty(iter->target))
+    {
+        iter->cursor = 0;
+        iter->start = 1;
+        iter->end = sm_empty(iter->target);
+        return 1;
+    }
+    return 0;
+}
+_Bool sm_iter_to_end(struct slotmap_iter *iter)
+{
+    if (!sm_empty(iter->target))
+    {
+        iter->start = sm_empty(iter->target);
+        iter->cursor = iter->target->count - 1;
+        iter->end = 1;
+        return 1;
+    }
+    return 0;
+}
+_Bool sm_iter_next(struct slotmap_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor + 1 == iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = sm_empty(iter->target);
+    iter->cursor++;
+    return 1;
+}
+_Bool sm_iter_prev(struct slotmap_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = sm_empty(iter->target);
+    iter->cursor--;
+    return 1;
+}
+_Bool sm_iter_advance(struct slotmap_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor + 1 == iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->cursor + steps >= iter->target->count)
+        return 0;
+    iter->start = sm_empty(iter->target);
+    iter->cursor += steps;
+    return 1;
+}
+_Bool sm_iter_rewind(struct slotmap_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->cursor < steps)
+        return 0;
+    iter->end = sm_empty(iter->target);
+    iter->cursor -= steps;
+    return 1;
+}
+_Bool sm_iter_go_to(struct slotmap_iter *iter, size_t index)
+{
+    if (index >= iter->target->count)
+        return 0;
+    if (iter->cursor > index)
+        return sm_iter_rewind(iter, iter->cursor - index);
+    else if (iter->cursor < index)
+        return sm_iter_advance(iter, index - iter->cursor);
+    return 1;
+}
+size_t sm_iter_value(struct slotmap_iter *iter)
+{
+    if (sm_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->target->buffer[iter->cursor];
+}
+size_t *sm_iter_rvalue(struct slotmap_iter *iter)
+{
+    if (sm_empty(iter->target))
+        return ((void *)0);
+    return &(iter->target->buffer[iter->cursor]);
+}
+uint64_t sm_iter_handle(struct slotmap_iter *iter)
+{
+    if (sm_empty(iter->target))
+        return ((uint64_t)0);
+    uint32_t s = iter->target->owner[iter->cursor];
+    return (((uint64_t)(iter->target->slots[s].generation) << 32) | (uint64_t)(s));
+}
+size_t sm_iter_index(struct slotmap_iter *iter)
+{
+    return iter->cursor;
+}
+_Bool sm_to_string(struct slotmap *_map_, FILE *fptr)
+{
+    struct slotmap *m_ = _map_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "buffer:%p, "
+                        "owner:%p, "
+                        "slots:%p, "
+                        "capacity:%"
+                        "I64u"
+                        ", "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks: %p }",
+                        "slotmap", "size_t", m_, m_->buffer, m_->owner, m_->slots, m_->capacity, m_->count, m_->flag,
+                        m_->f_val, m_->alloc, (m_)->callbacks);
+}
+_Bool sm_print(struct slotmap *_map_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    fprintf(fptr, "%s", start);
+    for (size_t i = 0; i < _map_->count; i++)
+    {
+        if (!_map_->f_val->str(fptr, _map_->buffer[i]))
+            return 0;
+        if (i + 1 < _map_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
@@ -3,6 +3,8 @@
 
 static size_t sl_impl_binary_search_first(struct sortedlist *_list_, size_t value);
 static size_t sl_impl_binary_search_last(struct sortedlist *_list_, size_t value);
+static size_t sl_impl_bound(struct sortedlist *_list_, size_t value, _Bool after);
+static size_t sl_impl_remove_span(struct sortedlist *_list_, size_t from, size_t to);
 void sl_impl_sort_quicksort(size_t *array, int (*cmp)(size_t, size_t), size_t low, size_t high);
 void sl_impl_sort_insertion(size_t *array, int (*cmp)(size_t, size_t), size_t low, size_t high);
 struct sortedlist *sl_new(size_t capacity, struct sortedlist_fval *f_val)
@@ -101,6 +103,33 @@ _Bool sl_remove(struct sortedlist *_list_, size_t index)
     ;
     return 1;
 }
+size_t sl_remove_range(struct sortedlist *_list_, size_t low, size_t high)
+{
+    if (sl_empty(_list_))
+    {
+        _list_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    if (_list_->f_val->cmp(low, high) > 0)
+    {
+        _list_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    sl_sort(_list_);
+    size_t from = sl_impl_bound(_list_, low, 0);
+    size_t to = sl_impl_bound(_list_, high, 1);
+    return sl_impl_remove_span(_list_, from, to);
+}
+size_t sl_remove_below(struct sortedlist *_list_, size_t value)
+{
+    if (sl_empty(_list_))
+    {
+        _list_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    sl_sort(_list_);
+    return sl_impl_remove_span(_list_, 0, sl_impl_bound(_list_, value, 0));
+}
 size_t sl_max(struct sortedlist *_list_)
 {
     if (sl_empty(_list_))
@@ -294,6 +323,41 @@ static size_t sl_impl_binary_search_last(struct sortedlist *_list_, size_t value
         return L - 1;
     return _list_->count;
 }
+static size_t sl_impl_bound(struct sortedlist *_list_, size_t value, _Bool after)
+{
+    size_t L = 0;
+    size_t R = _list_->count;
+    while (L < R)
+    {
+        size_t M = L + (R - L) / 2;
+        int cmp = _list_->f_val->cmp(_list_->buffer[M], value);
+        if (cmp < 0 || (after && cmp == 0))
+            L = M + 1;
+        else
+            R = M;
+    }
+    return L;
+}
+static size_t sl_impl_remove_span(struct sortedlist *_list_, size_t from, size_t to)
+{
+    size_t removed = to - from;
+    if (_list_->f_val->free)
+    {
+        for (size_t i = from; i < to; i++)
+            _list_->f_val->free(_list_->buffer[i]);
+    }
+    memmove(_list_->buffer + from, _list_->buffer + to, (_list_->count - to) * sizeof(size_t));
+    memset(_list_->buffer + _list_->count - removed, 0, removed * sizeof(size_t));
+    _list_->count -= removed;
+    _list_->flag = CMC_FLAG_OK;
+    if (removed > 0)
+    {
+        if ((_list_)->callbacks && (_list_)->callbacks->delete)
+            (_list_)->callbacks->delete ();
+        ;
+    }
+    return removed;
+}
 void sl_impl_sort_quicksort(size_t *array, int (*cmp)(size_t, size_t), size_t low, size_t high)
 {
     while (low < high)
@@ -322,7 +386,8 @@ void sl_impl_sort_quicksort(size_t *array, int (*cmp)(size_t, size_t), size_t lo
             array[high] = _tmp_;
             if (pindex - low < high - pindex)
             {
-                sl_impl_sort_quicksort(array, cmp, low, pindex - 1);
+                if (pindex > low)
+                    sl_impl_sort_quicksort(array, cmp, low, pindex - 1);
                 low = pindex + 1;
             }
             else
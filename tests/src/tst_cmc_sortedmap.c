@@ -0,0 +1,759 @@
+
+#include "tst_cmc_sortedmap.h"
+
+static size_t smp_impl_lower_bound(struct sortedmap *_map_, size_t key);
+static size_t smp_impl_get_index(struct sortedmap *_map_, size_t key);
+static void smp_impl_sort(size_t *keys, size_t *values, size_t *tmp_keys, size_t *tmp_values, size_t count,
+                          int (*cmp)(size_t, size_t));
+struct sortedmap *smp_new(size_t capacity, struct sortedmap_fkey *f_key, struct sortedmap_fval *f_val)
+{
+    return smp_new_custom(capacity, f_key, f_val, ((void *)0), ((void *)0));
+}
+struct sortedmap *smp_new_custom(size_t capacity, struct sortedmap_fkey *f_key, struct sortedmap_fval *f_val,
+                                 struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (capacity < 1)
+        return ((void *)0);
+    if (!f_key || !f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct sortedmap *_map_ = alloc->malloc(sizeof(struct sortedmap));
+    if (!_map_)
+        return ((void *)0);
+    _map_->keys = alloc->malloc(sizeof(size_t) * capacity);
+    _map_->values = alloc->malloc(sizeof(size_t) * capacity);
+    if (!_map_->keys || !_map_->values)
+    {
+        alloc->free(_map_->keys);
+        alloc->free(_map_->values);
+        alloc->free(_map_);
+        return ((void *)0);
+    }
+    _map_->capacity = capacity;
+    _map_->count = 0;
+    _map_->pending = 0;
+    _map_->flag = CMC_FLAG_OK;
+    _map_->f_key = f_key;
+    _map_->f_val = f_val;
+    _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    return _map_;
+}
+struct sortedmap *smp_from_pairs(size_t *keys, size_t *values, size_t count, struct sortedmap_fkey *f_key,
+                                 struct sortedmap_fval *f_val)
+{
+    struct sortedmap *_map_ = smp_new(count > 0 ? count : 1, f_key, f_val);
+    if (!_map_)
+        return ((void *)0);
+    memcpy(_map_->keys, keys, sizeof(size_t) * count);
+    memcpy(_map_->values, values, sizeof(size_t) * count);
+    _map_->pending = count;
+    if (!smp_merge(_map_))
+    {
+        _map_->pending = 0;
+        smp_free(_map_);
+        return ((void *)0);
+    }
+    return _map_;
+}
+void smp_clear(struct sortedmap *_map_)
+{
+    size_t total = _map_->count + _map_->pending;
+    for (size_t i = 0; i < total; i++)
+    {
+        if (_map_->f_key->free)
+            _map_->f_key->free(_map_->keys[i]);
+        if (_map_->f_val->free)
+            _map_->f_val->free(_map_->values[i]);
+    }
+    _map_->count = 0;
+    _map_->pending = 0;
+    _map_->flag = CMC_FLAG_OK;
+}
+void smp_free(struct sortedmap *_map_)
+{
+    size_t total = _map_->count + _map_->pending;
+    for (size_t i = 0; i < total; i++)
+    {
+        if (_map_->f_key->free)
+            _map_->f_key->free(_map_->keys[i]);
+        if (_map_->f_val->free)
+            _map_->f_val->free(_map_->values[i]);
+    }
+    _map_->alloc->free(_map_->keys);
+    _map_->alloc->free(_map_->values);
+    _map_->alloc->free(_map_);
+}
+void smp_customize(struct sortedmap *_map_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _map_->alloc = &cmc_alloc_node_default;
+    else
+        _map_->alloc = alloc;
+    (_map_)->callbacks = callbacks;
+    _map_->flag = CMC_FLAG_OK;
+}
+_Bool smp_insert(struct sortedmap *_map_, size_t key, size_t value)
+{
+    if (!smp_merge(_map_))
+        return 0;
+    size_t index = smp_impl_lower_bound(_map_, key);
+    if (index < _map_->count && _map_->f_key->cmp(_map_->keys[index], key) == 0)
+    {
+        _map_->flag = CMC_FLAG_DUPLICATE;
+        return 0;
+    }
+    if (smp_full(_map_))
+    {
+        if (!smp_resize(_map_, _map_->capacity * 2))
+            return 0;
+    }
+    size_t after = _map_->count - index;
+    memmove(_map_->keys + index + 1, _map_->keys + index, sizeof(size_t) * after);
+    memmove(_map_->values + index + 1, _map_->values + index, sizeof(size_t) * after);
+    _map_->keys[index] = key;
+    _map_->values[index] = value;
+    _map_->count++;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->create)
+        (_map_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool smp_push(struct sortedmap *_map_, size_t key, size_t value)
+{
+    if (smp_full(_map_))
+    {
+        if (!smp_resize(_map_, _map_->capacity * 2))
+            return 0;
+    }
+    size_t index = _map_->count + _map_->pending;
+    _map_->keys[index] = key;
+    _map_->values[index] = value;
+    _map_->pending++;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->create)
+        (_map_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool smp_update(struct sortedmap *_map_, size_t key, size_t new_value, size_t *old_value)
+{
+    if (smp_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    size_t index = smp_impl_get_index(_map_, key);
+    if (index == _map_->count)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (old_value)
+        *old_value = _map_->values[index];
+    _map_->values[index] = new_value;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->update)
+        (_map_)->callbacks->update();
+    ;
+    return 1;
+}
+_Bool smp_remove(struct sortedmap *_map_, size_t key, size_t *out_value)
+{
+    if (smp_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    size_t index = smp_impl_get_index(_map_, key);
+    if (index == _map_->count)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (out_value)
+        *out_value = _map_->values[index];
+    size_t after = _map_->count - index - 1;
+    memmove(_map_->keys + index, _map_->keys + index + 1, sizeof(size_t) * after);
+    memmove(_map_->values + index, _map_->values + index + 1, sizeof(size_t) * after);
+    _map_->count--;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->delete)
+        (_map_)->callbacks->delete ();
+    ;
+    return 1;
+}
+_Bool smp_max(struct sortedmap *_map_, size_t *key, size_t *value)
+{
+    if (smp_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    if (key)
+        *key = _map_->keys[_map_->count - 1];
+    if (value)
+        *value = _map_->values[_map_->count - 1];
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool smp_min(struct sortedmap *_map_, size_t *key, size_t *value)
+{
+    if (smp_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    if (key)
+        *key = _map_->keys[0];
+    if (value)
+        *value = _map_->values[0];
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return 1;
+}
+size_t smp_get(struct sortedmap *_map_, size_t key)
+{
+    if (smp_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    size_t index = smp_impl_get_index(_map_, key);
+    if (index == _map_->count)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return (size_t){ 0 };
+    }
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return _map_->values[index];
+}
+size_t *smp_get_ref(struct sortedmap *_map_, size_t key)
+{
+    if (smp_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return ((void *)0);
+    }
+    size_t index = smp_impl_get_index(_map_, key);
+    if (index == _map_->count)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return ((void *)0);
+    }
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return &(_map_->values[index]);
+}
+_Bool smp_lower_bound(struct sortedmap *_map_, size_t key, size_t *out_key, size_t *out_value)
+{
+    if (smp_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    size_t index = smp_impl_lower_bound(_map_, key);
+    if (index == _map_->count)
+    {
+        _map_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (out_key)
+        *out_key = _map_->keys[index];
+    if (out_value)
+        *out_value = _map_->values[index];
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool smp_contains(struct sortedmap *_map_, size_t key)
+{
+    if (!smp_merge(_map_))
+        return 0;
+    _Bool result = smp_impl_get_index(_map_, key) < _map_->count;
+    if ((_map_)->callbacks && (_map_)->callbacks->read)
+        (_map_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool smp_empty(struct sortedmap *_map_)
+{
+    if (!smp_merge(_map_))
+        return 1;
+    return _map_->count == 0;
+}
+_Bool smp_full(struct sortedmap *_map_)
+{
+    return _map_->count + _map_->pending >= _map_->capacity;
+}
+size_t smp_count(struct sortedmap *_map_)
+{
+    smp_merge(_map_);
+    return _map_->count;
+}
+size_t smp_capacity(struct sortedmap *_map_)
+{
+    return _map_->capacity;
+}
+int smp_flag(struct sortedmap *_map_)
+{
+    return _map_->flag;
+}
+_Bool smp_merge(struct sortedmap *_map_)
+{
+    _map_->flag = CMC_FLAG_OK;
+    if (_map_->pending == 0)
+        return 1;
+    size_t n = _map_->pending;
+    size_t *tmp_keys = _map_->alloc->malloc(sizeof(size_t) * n);
+    size_t *tmp_values = _map_->alloc->malloc(sizeof(size_t) * n);
+    if (!tmp_keys || !tmp_values)
+    {
+        _map_->alloc->free(tmp_keys);
+        _map_->alloc->free(tmp_values);
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    size_t *keys = _map_->keys + _map_->count;
+    size_t *values = _map_->values + _map_->count;
+    smp_impl_sort(keys, values, tmp_keys, tmp_values, n, _map_->f_key->cmp);
+    size_t m = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (i + 1 < n && _map_->f_key->cmp(keys[i], keys[i + 1]) == 0)
+        {
+            if (_map_->f_key->free)
+                _map_->f_key->free(keys[i]);
+            if (_map_->f_val->free)
+                _map_->f_val->free(values[i]);
+        }
+        else
+        {
+            tmp_keys[m] = keys[i];
+            tmp_values[m] = values[i];
+            m++;
+        }
+    }
+    size_t a = _map_->count;
+    size_t b = m;
+    size_t w = _map_->count + m;
+    while (b > 0)
+    {
+        int c = a > 0 ? _map_->f_key->cmp(_map_->keys[a - 1], tmp_keys[b - 1]) : -1;
+        if (c > 0)
+        {
+            a--;
+            w--;
+            _map_->keys[w] = _map_->keys[a];
+            _map_->values[w] = _map_->values[a];
+        }
+        else
+        {
+            if (c == 0)
+            {
+                a--;
+                if (_map_->f_key->free)
+                    _map_->f_key->free(_map_->keys[a]);
+                if (_map_->f_val->free)
+                    _map_->f_val->free(_map_->values[a]);
+            }
+            b--;
+            w--;
+            _map_->keys[w] = tmp_keys[b];
+            _map_->values[w] = tmp_values[b];
+        }
+    }
+    size_t merged = _map_->count + m - w;
+    if (w > a)
+    {
+        memmove(_map_->keys + a, _map_->keys + w, sizeof(size_t) * merged);
+        memmove(_map_->values + a, _map_->values + w, sizeof(size_t) * merged);
+    }
+    _map_->count = a + merged;
+    _map_->pending = 0;
+    _map_->alloc->free(tmp_keys);
+    _map_->alloc->free(tmp_values);
+    return 1;
+}
+_Bool smp_resize(struct sortedmap *_map_, size_t capacity)
+{
+    _map_->flag = CMC_FLAG_OK;
+    if (_map_->capacity == capacity)
+        goto success;
+    if (capacity < _map_->count + _map_->pending || capacity == 0)
+    {
+        _map_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    size_t *new_keys = _map_->alloc->realloc(_map_->keys, sizeof(size_t) * capacity);
+    if (!new_keys)
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    _map_->keys = new_keys;
+    size_t *new_values = _map_->alloc->realloc(_map_->values, sizeof(size_t) * capacity);
+    if (!new_values)
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    _map_->values = new_values;
+    _map_->capacity = capacity;
+success:
+    if ((_map_)->callbacks && (_map_)->callbacks->resize)
+        (_map_)->callbacks->resize();
+    ;
+    return 1;
+}
+struct sortedmap *smp_copy_of(struct sortedmap *_map_)
+{
+    if (!smp_merge(_map_))
+        return ((void *)0);
+    struct sortedmap *result = smp_new_custom(_map_->capacity, _map_->f_key, _map_->f_val, _map_->alloc, ((void *)0));
+    if (!result)
+    {
+        _map_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    (result)->callbacks = _map_->callbacks;
+    if (_map_->f_key->cpy)
+    {
+        for (size_t i = 0; i < _map_->count; i++)
+            result->keys[i] = _map_->f_key->cpy(_map_->keys[i]);
+    }
+    else
+        memcpy(result->keys, _map_->keys, sizeof(size_t) * _map_->count);
+    if (_map_->f_val->cpy)
+    {
+        for (size_t i = 0; i < _map_->count; i++)
+            result->values[i] = _map_->f_val->cpy(_map_->values[i]);
+    }
+    else
+        memcpy(result->values, _map_->values, sizeof(size_t) * _map_->count);
+    result->count = _map_->count;
+    _map_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool smp_equals(struct sortedmap *_map1_, struct sortedmap *_map2_)
+{
+    if (smp_count(_map1_) != smp_count(_map2_))
+        return 0;
+    for (size_t i = 0; i < _map1_->count; i++)
+    {
+        if (_map1_->f_key->cmp(_map1_->keys[i], _map2_->keys[i]) != 0)
+            return 0;
+        if (_map1_->f_val->cmp(_map1_->values[i], _map2_->values[i]) != 0)
+            return 0;
+    }
+    return 1;
+}
+static size_t smp_impl_lower_bound(struct sortedmap *_map_, size_t key)
+{
+    size_t L = 0;
+    size_t R = _map_->count;
+    while (L < R)
+    {
+        size_t M = L + (R - L) / 2;
+        if (_map_->f_key->cmp(_map_->keys[M], key) < 0)
+            L = M + 1;
+        else
+            R = M;
+    }
+    return L;
+}
+static size_t smp_impl_get_index(struct sortedmap *_map_, size_t key)
+{
+    size_t index = smp_impl_lower_bound(_map_, key);
+    if (index < _map_->count && _map_->f_key->cmp(_map_->keys[index], key) == 0)
+        return index;
+    return _map_->count;
+}
+static void smp_impl_sort(size_t *keys, size_t *values, size_t *tmp_keys, size_t *tmp_values, size_t count,
+                          int (*cmp)(size_t, size_t))
+{
+    const size_t run = 16;
+    for (size_t low = 0; low < count; low += run)
+    {
+        size_t high = low + run < count ? low + run : count;
+        for (size_t i = low + 1; i < high; i++)
+        {
+            size_t k = keys[i];
+            size_t v = values[i];
+            size_t j = i;
+            while (j > low && cmp(keys[j - 1], k) > 0)
+            {
+                keys[j] = keys[j - 1];
+                values[j] = values[j - 1];
+                j--;
+            }
+            keys[j] = k;
+            values[j] = v;
+        }
+    }
+    size_t *src_k = keys;
+    size_t *src_v = values;
+    size_t *dst_k = tmp_keys;
+    size_t *dst_v = tmp_values;
+    for (size_t width = run; width < count; width *= 2)
+    {
+        for (size_t low = 0; low < count; low += 2 * width)
+        {
+            size_t mid = low + width < count ? low + width : count;
+            size_t high = low + 2 * width < count ? low + 2 * width : count;
+            size_t i = low;
+            size_t j = mid;
+            size_t k = low;
+            while (i < mid && j < high)
+            {
+                if (cmp(src_k[j], src_k[i]) < 0)
+                {
+                    dst_k[k] = src_k[j];
+                    dst_v[k++] = src_v[j++];
+                }
+                else
+                {
+                    dst_k[k] = src_k[i];
+                    dst_v[k++] = src_v[i++];
+                }
+            }
+            while (i < mid)
+            {
+                dst_k[k] = src_k[i];
+                dst_v[k++] = src_v[i++];
+            }
+            while (j < high)
+            {
+                dst_k[k] = src_k[j];
+                dst_v[k++] = src_v[j++];
+            }
+        }
+        size_t *swap_k = src_k;
+        src_k = dst_k;
+        dst_k = swap_k;
+        size_t *swap_v = src_v;
+        src_v = dst_v;
+        dst_v = swap_v;
+    }
+    if (src_k != keys)
+    {
+        memcpy(keys, src_k, sizeof(size_t) * count);
+        memcpy(values, src_v, sizeof(size_t) * count);
+    }
+}
+struct sortedmap_iter smp_iter_start(struct sortedmap *target)
+{
+    struct sortedmap_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.first = 0;
+    iter.count = smp_count(target);
+    iter.start = 1;
+    iter.end = iter.count == 0;
+    return iter;
+}
+struct sortedmap_iter smp_iter_end(struct sortedmap *target)
+{
+    struct sortedmap_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.first = 0;
+    iter.count = smp_count(target);
+    iter.start = iter.count == 0;
+    iter.end = 1;
+    if (iter.count > 0)
+        iter.cursor = iter.count - 1;
+    return iter;
+}
+struct sortedmap_iter smp_iter_range(struct sortedmap *target, size_t from, size_t to)
+{
+    struct sortedmap_iter iter;
+    smp_merge(target);
+    size_t first = smp_impl_lower_bound(target, from);
+    size_t last = smp_impl_lower_bound(target, to);
+    iter.target = target;
+    iter.cursor = first;
+    iter.first = first;
+    iter.count = last > first ? last - first : 0;
+    iter.start = 1;
+    iter.end = iter.count == 0;
+    return iter;
+}
+_Bool smp_iter_at_start(struct sortedmap_iter *iter)
+{
+    return iter->count == 0 || iter->start;
+}
+_Bool smp_iter_at_end(struct sortedmap_iter *iter)
+{
+    return iter->count == 0 || iter->end;
+}
+_Bool smp_iter_to_start(struct sortedmap_iter *iter)
+{
+    if (iter->count > 0)
+    {
+        iter->cursor = iter->first;
+        iter->start = 1;
+        iter->end = 0;
+        return 1;
+    }
+    return 0;
+}
+_Bool smp_iter_to_end(struct sortedmap_iter *iter)
+{
+    if (iter->count > 0)
+    {
+        iter->cursor = iter->first + iter->count - 1;
+        iter->start = 0;
+        iter->end = 1;
+        return 1;
+    }
+    return 0;
+}
+_Bool smp_iter_next(struct sortedmap_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor + 1 == iter->first + iter->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = 0;
+    iter->cursor++;
+    return 1;
+}
+_Bool smp_iter_prev(struct sortedmap_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == iter->first)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = 0;
+    iter->cursor--;
+    return 1;
+}
+_Bool smp_iter_advance(struct sortedmap_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor + 1 == iter->first + iter->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->cursor + steps >= iter->first + iter->count)
+        return 0;
+    iter->start = 0;
+    iter->cursor += steps;
+    return 1;
+}
+_Bool smp_iter_rewind(struct sortedmap_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == iter->first)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->cursor - iter->first < steps)
+        return 0;
+    iter->end = 0;
+    iter->cursor -= steps;
+    return 1;
+}
+_Bool smp_iter_go_to(struct sortedmap_iter *iter, size_t index)
+{
+    if (index >= iter->count)
+        return 0;
+    size_t current = iter->cursor - iter->first;
+    if (current > index)
+        return smp_iter_rewind(iter, current - index);
+    else if (current < index)
+        return smp_iter_advance(iter, index - current);
+    return 1;
+}
+size_t smp_iter_key(struct sortedmap_iter *iter)
+{
+    if (iter->count == 0)
+        return (size_t){ 0 };
+    return iter->target->keys[iter->cursor];
+}
+size_t smp_iter_value(struct sortedmap_iter *iter)
+{
+    if (iter->count == 0)
+        return (size_t){ 0 };
+    return iter->target->values[iter->cursor];
+}
+size_t *smp_iter_rvalue(struct sortedmap_iter *iter)
+{
+    if (iter->count == 0)
+        return ((void *)0);
+    return &(iter->target->values[iter->cursor]);
+}
+size_t smp_iter_index(struct sortedmap_iter *iter)
+{
+    return iter->cursor - iter->first;
+}
+_Bool smp_to_string(struct sortedmap *_map_, FILE *fptr)
+{
+    struct sortedmap *m_ = _map_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s, %s> "
+                        "at %p { "
+                        "keys:%p, "
+                        "values:%p, "
+                        "capacity:%"
+                        "I64u"
+                        ", "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "pending:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_key:%p, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks:%p }",
+                        "sortedmap", "size_t", "size_t", m_, m_->keys, m_->values, m_->capacity, m_->count, m_->pending,
+                        m_->flag, m_->f_key, m_->f_val, m_->alloc, (m_)->callbacks);
+}
+_Bool smp_print(struct sortedmap *_map_, FILE *fptr, const char *start, const char *separator, const char *end,
+                const char *key_val_sep)
+{
+    smp_merge(_map_);
+    fprintf(fptr, "%s", start);
+    for (size_t i = 0; i < _map_->count; i++)
+    {
+        if (!_map_->f_key->str(fptr, _map_->keys[i]))
+            return 0;
+        fprintf(fptr, "%s", key_val_sep);
+        if (!_map_->f_val->str(fptr, _map_->values[i]))
+            return 0;
+        if (i + 1 < _map_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
@@ -0,0 +1,588 @@
+
+#include "tst_cmc_sparseset.h"
+
+static _Bool ss_impl_contains(struct sparseset *_set_, size_t value);
+struct sparseset *ss_new(size_t capacity, struct sparseset_fval *f_val)
+{
+    return ss_new_custom(capacity, f_val, ((void *)0), ((void *)0));
+}
+struct sparseset *ss_new_custom(size_t capacity, struct sparseset_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks)
+{
+    ;
+    if (capacity == 0 || !f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct sparseset *_set_ = alloc->malloc(sizeof(struct sparseset));
+    if (!_set_)
+        return ((void *)0);
+    _set_->dense = alloc->malloc(sizeof(size_t) * capacity);
+    if (!_set_->dense)
+    {
+        alloc->free(_set_);
+        return ((void *)0);
+    }
+    _set_->sparse = alloc->calloc(capacity, sizeof(size_t));
+    if (!_set_->sparse)
+    {
+        alloc->free(_set_->dense);
+        alloc->free(_set_);
+        return ((void *)0);
+    }
+    _set_->capacity = capacity;
+    _set_->count = 0;
+    _set_->flag = CMC_FLAG_OK;
+    _set_->f_val = f_val;
+    _set_->alloc = alloc;
+    (_set_)->callbacks = callbacks;
+    return _set_;
+}
+void ss_clear(struct sparseset *_set_)
+{
+    if (_set_->f_val->free)
+    {
+        for (size_t i = 0; i < _set_->count; i++)
+            _set_->f_val->free(_set_->dense[i]);
+    }
+    _set_->count = 0;
+    _set_->flag = CMC_FLAG_OK;
+}
+void ss_free(struct sparseset *_set_)
+{
+    if (_set_->f_val->free)
+    {
+        for (size_t i = 0; i < _set_->count; i++)
+            _set_->f_val->free(_set_->dense[i]);
+    }
+    _set_->alloc->free(_set_->dense);
+    _set_->alloc->free(_set_->sparse);
+    _set_->alloc->free(_set_);
+}
+void ss_customize(struct sparseset *_set_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _set_->alloc = &cmc_alloc_node_default;
+    else
+        _set_->alloc = alloc;
+    (_set_)->callbacks = callbacks;
+    _set_->flag = CMC_FLAG_OK;
+}
+_Bool ss_insert(struct sparseset *_set_, size_t value)
+{
+    size_t index = (size_t)value;
+    if (index >= _set_->capacity)
+    {
+        if (index == 0xffffffffffffffffULL)
+        {
+            _set_->flag = CMC_FLAG_INVALID;
+            return 0;
+        }
+        size_t capacity = _set_->capacity * 2;
+        if (capacity <= index)
+            capacity = index + 1;
+        if (!ss_resize(_set_, capacity))
+            return 0;
+    }
+    else if (ss_impl_contains(_set_, value))
+    {
+        _set_->flag = CMC_FLAG_DUPLICATE;
+        return 0;
+    }
+    _set_->dense[_set_->count] = value;
+    _set_->sparse[index] = _set_->count;
+    _set_->count++;
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->create)
+        (_set_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool ss_remove(struct sparseset *_set_, size_t value)
+{
+    if (ss_empty(_set_))
+    {
+        _set_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    if (!ss_impl_contains(_set_, value))
+    {
+        _set_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    size_t index = _set_->sparse[(size_t)value];
+    size_t last = _set_->dense[_set_->count - 1];
+    _set_->dense[index] = last;
+    _set_->sparse[(size_t)last] = index;
+    _set_->count--;
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->delete)
+        (_set_)->callbacks->delete ();
+    ;
+    return 1;
+}
+_Bool ss_max(struct sparseset *_set_, size_t *value)
+{
+    if (ss_empty(_set_))
+    {
+        _set_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    size_t max_val = _set_->dense[0];
+    for (size_t i = 1; i < _set_->count; i++)
+    {
+        if (_set_->f_val->cmp(_set_->dense[i], max_val) > 0)
+            max_val = _set_->dense[i];
+    }
+    if (value)
+        *value = max_val;
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool ss_min(struct sparseset *_set_, size_t *value)
+{
+    if (ss_empty(_set_))
+    {
+        _set_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    size_t min_val = _set_->dense[0];
+    for (size_t i = 1; i < _set_->count; i++)
+    {
+        if (_set_->f_val->cmp(_set_->dense[i], min_val) < 0)
+            min_val = _set_->dense[i];
+    }
+    if (value)
+        *value = min_val;
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return 1;
+}
+_Bool ss_contains(struct sparseset *_set_, size_t value)
+{
+    _set_->flag = CMC_FLAG_OK;
+    _Bool result = ss_impl_contains(_set_, value);
+    if ((_set_)->callbacks && (_set_)->callbacks->read)
+        (_set_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool ss_empty(struct sparseset *_set_)
+{
+    return _set_->count == 0;
+}
+_Bool ss_full(struct sparseset *_set_)
+{
+    return _set_->count >= _set_->capacity;
+}
+size_t ss_count(struct sparseset *_set_)
+{
+    return _set_->count;
+}
+size_t ss_capacity(struct sparseset *_set_)
+{
+    return _set_->capacity;
+}
+int ss_flag(struct sparseset *_set_)
+{
+    return _set_->flag;
+}
+_Bool ss_resize(struct sparseset *_set_, size_t capacity)
+{
+    _set_->flag = CMC_FLAG_OK;
+    if (_set_->capacity == capacity)
+        goto success;
+    if (capacity == 0)
+    {
+        _set_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    if (capacity < _set_->capacity)
+    {
+        for (size_t i = 0; i < _set_->count; i++)
+        {
+            if ((size_t)_set_->dense[i] >= capacity)
+            {
+                _set_->flag = CMC_FLAG_INVALID;
+                return 0;
+            }
+        }
+    }
+    if (capacity > 0xffffffffffffffffULL / sizeof(size_t) || capacity > 0xffffffffffffffffULL / sizeof(size_t))
+    {
+        _set_->flag = CMC_FLAG_ERROR;
+        return 0;
+    }
+    if (capacity > _set_->capacity)
+    {
+        size_t *new_dense = _set_->alloc->realloc(_set_->dense, sizeof(size_t) * capacity);
+        if (!new_dense)
+        {
+            _set_->flag = CMC_FLAG_ALLOC;
+            return 0;
+        }
+        _set_->dense = new_dense;
+        size_t *new_sparse = _set_->alloc->realloc(_set_->sparse, sizeof(size_t) * capacity);
+        if (!new_sparse)
+        {
+            _set_->flag = CMC_FLAG_ALLOC;
+            return 0;
+        }
+        memset(new_sparse + _set_->capacity, 0, sizeof(size_t) * (capacity - _set_->capacity));
+        _set_->sparse = new_sparse;
+    }
+    else
+    {
+        size_t *new_sparse = _set_->alloc->realloc(_set_->sparse, sizeof(size_t) * capacity);
+        if (!new_sparse)
+        {
+            _set_->flag = CMC_FLAG_ALLOC;
+            return 0;
+        }
+        _set_->sparse = new_sparse;
+        size_t *new_dense = _set_->alloc->realloc(_set_->dense, sizeof(size_t) * capacity);
+        if (new_dense)
+            _set_->dense = new_dense;
+    }
+    _set_->capacity = capacity;
+success:
+    if ((_set_)->callbacks && (_set_)->callbacks->resize)
+        (_set_)->callbacks->resize();
+    ;
+    return 1;
+}
+struct sparseset *ss_copy_of(struct sparseset *_set_)
+{
+    struct sparseset *result = ss_new_custom(_set_->capacity, _set_->f_val, _set_->alloc, ((void *)0));
+    if (!result)
+    {
+        _set_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    (result)->callbacks = _set_->callbacks;
+    if (_set_->f_val->cpy)
+    {
+        for (size_t i = 0; i < _set_->count; i++)
+            result->dense[i] = _set_->f_val->cpy(_set_->dense[i]);
+    }
+    else
+        memcpy(result->dense, _set_->dense, sizeof(size_t) * _set_->count);
+    for (size_t i = 0; i < _set_->count; i++)
+        result->sparse[(size_t)result->dense[i]] = i;
+    result->count = _set_->count;
+    _set_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool ss_equals(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    _set1_->flag = CMC_FLAG_OK;
+    _set2_->flag = CMC_FLAG_OK;
+    if (_set1_->count != _set2_->count)
+        return 0;
+    for (size_t i = 0; i < _set1_->count; i++)
+    {
+        if (!ss_impl_contains(_set2_, _set1_->dense[i]))
+            return 0;
+    }
+    return 1;
+}
+static _Bool ss_impl_contains(struct sparseset *_set_, size_t value)
+{
+    size_t index = (size_t)value;
+    if (index >= _set_->capacity)
+        return 0;
+    size_t pos = _set_->sparse[index];
+    return pos < _set_->count && _set_->dense[pos] == value;
+}
+struct sparseset_iter ss_iter_start(struct sparseset *target)
+{
+    struct sparseset_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.start = 1;
+    iter.end = ss_empty(target);
+    return iter;
+}
+struct sparseset_iter ss_iter_end(struct sparseset *target)
+{
+    struct sparseset_iter iter;
+    iter.target = target;
+    iter.cursor = 0;
+    iter.start = ss_empty(target);
+    iter.end = 1;
+    if (!ss_empty(target))
+        iter.cursor = target->count - 1;
+    return iter;
+}
+_Bool ss_iter_at_start(struct sparseset_iter *iter)
+{
+    return ss_empty(iter->target) || iter->start;
+}
+_Bool ss_iter_at_end(struct sparseset_iter *iter)
+{
+    return ss_empty(iter->target) || iter->end;
+}
+_Bool ss_iter_to_start(struct sparseset_iter *iter)
+{
+    if (!ss_empty(iter->target))
+    {
+        iter->cursor = 0;
+        iter->start = 1;
+        iter->end = ss_empty(iter->target);
+        return 1;
+    }
+    return 0;
+}
+_Bool ss_iter_to_end(struct sparseset_iter *iter)
+{
+    if (!ss_empty(iter->target))
+    {
+        iter->start = ss_empty(iter->target);
+        iter->cursor = iter->target->count - 1;
+        iter->end = 1;
+        return 1;
+    }
+    return 0;
+}
+_Bool ss_iter_next(struct sparseset_iter *iter)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor + 1 == iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    iter->start = ss_empty(iter->target);
+    iter->cursor++;
+    return 1;
+}
+_Bool ss_iter_prev(struct sparseset_iter *iter)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    iter->end = ss_empty(iter->target);
+    iter->cursor--;
+    return 1;
+}
+_Bool ss_iter_advance(struct sparseset_iter *iter, size_t steps)
+{
+    if (iter->end)
+        return 0;
+    if (iter->cursor + 1 == iter->target->count)
+    {
+        iter->end = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->cursor + steps >= iter->target->count)
+        return 0;
+    iter->start = ss_empty(iter->target);
+    iter->cursor += steps;
+    return 1;
+}
+_Bool ss_iter_rewind(struct sparseset_iter *iter, size_t steps)
+{
+    if (iter->start)
+        return 0;
+    if (iter->cursor == 0)
+    {
+        iter->start = 1;
+        return 0;
+    }
+    if (steps == 0 || iter->cursor < steps)
+        return 0;
+    iter->end = ss_empty(iter->target);
+    iter->cursor -= steps;
+    return 1;
+}
+_Bool ss_iter_go_to(struct sparseset_iter *iter, size_t index)
+{
+    if (index >= iter->target->count)
+        return 0;
+    if (iter->cursor > index)
+        return ss_iter_rewind(iter, iter->cursor - index);
+    else if (iter->cursor < index)
+        return ss_iter_advance(iter, index - iter->cursor);
+    return 1;
+}
+size_t ss_iter_value(struct sparseset_iter *iter)
+{
+    if (ss_empty(iter->target))
+        return (size_t){ 0 };
+    return iter->target->dense[iter->cursor];
+}
+size_t ss_iter_index(struct sparseset_iter *iter)
+{
+    return iter->cursor;
+}
+struct sparseset *ss_union(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    size_t capacity = _set1_->capacity > _set2_->capacity ? _set1_->capacity : _set2_->capacity;
+    struct sparseset *_set_r_ = ss_new_custom(capacity, _set1_->f_val, _set1_->alloc, ((void *)0));
+    if (!_set_r_)
+    {
+        _set1_->flag = CMC_FLAG_ALLOC;
+        _set2_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    for (size_t i = 0; i < _set1_->count; i++)
+        ss_insert(_set_r_, _set1_->dense[i]);
+    for (size_t i = 0; i < _set2_->count; i++)
+    {
+        if (!ss_impl_contains(_set1_, _set2_->dense[i]))
+            ss_insert(_set_r_, _set2_->dense[i]);
+    }
+    (_set_r_)->callbacks = _set1_->callbacks;
+    return _set_r_;
+}
+struct sparseset *ss_intersection(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    struct sparseset *_set_A_ = _set1_->count < _set2_->count ? _set1_ : _set2_;
+    struct sparseset *_set_B_ = _set_A_ == _set1_ ? _set2_ : _set1_;
+    struct sparseset *_set_r_ = ss_new_custom(_set_A_->capacity, _set1_->f_val, _set1_->alloc, ((void *)0));
+    if (!_set_r_)
+    {
+        _set1_->flag = CMC_FLAG_ALLOC;
+        _set2_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    for (size_t i = 0; i < _set_A_->count; i++)
+    {
+        if (ss_impl_contains(_set_B_, _set_A_->dense[i]))
+            ss_insert(_set_r_, _set_A_->dense[i]);
+    }
+    (_set_r_)->callbacks = _set1_->callbacks;
+    return _set_r_;
+}
+struct sparseset *ss_difference(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    struct sparseset *_set_r_ = ss_new_custom(_set1_->capacity, _set1_->f_val, _set1_->alloc, ((void *)0));
+    if (!_set_r_)
+    {
+        _set1_->flag = CMC_FLAG_ALLOC;
+        _set2_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    for (size_t i = 0; i < _set1_->count; i++)
+    {
+        if (!ss_impl_contains(_set2_, _set1_->dense[i]))
+            ss_insert(_set_r_, _set1_->dense[i]);
+    }
+    (_set_r_)->callbacks = _set1_->callbacks;
+    return _set_r_;
+}
+struct sparseset *ss_symmetric_difference(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    size_t capacity = _set1_->capacity > _set2_->capacity ? _set1_->capacity : _set2_->capacity;
+    struct sparseset *_set_r_ = ss_new_custom(capacity, _set1_->f_val, _set1_->alloc, ((void *)0));
+    if (!_set_r_)
+    {
+        _set1_->flag = CMC_FLAG_ALLOC;
+        _set2_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    for (size_t i = 0; i < _set1_->count; i++)
+    {
+        if (!ss_impl_contains(_set2_, _set1_->dense[i]))
+            ss_insert(_set_r_, _set1_->dense[i]);
+    }
+    for (size_t i = 0; i < _set2_->count; i++)
+    {
+        if (!ss_impl_contains(_set1_, _set2_->dense[i]))
+            ss_insert(_set_r_, _set2_->dense[i]);
+    }
+    (_set_r_)->callbacks = _set1_->callbacks;
+    return _set_r_;
+}
+_Bool ss_is_subset(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    _set1_->flag = CMC_FLAG_OK;
+    _set2_->flag = CMC_FLAG_OK;
+    if (_set1_->count > _set2_->count)
+        return 0;
+    for (size_t i = 0; i < _set1_->count; i++)
+    {
+        if (!ss_impl_contains(_set2_, _set1_->dense[i]))
+            return 0;
+    }
+    return 1;
+}
+_Bool ss_is_superset(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    return ss_is_subset(_set2_, _set1_);
+}
+_Bool ss_is_proper_subset(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    _set1_->flag = CMC_FLAG_OK;
+    _set2_->flag = CMC_FLAG_OK;
+    if (_set1_->count >= _set2_->count)
+        return 0;
+    for (size_t i = 0; i < _set1_->count; i++)
+    {
+        if (!ss_impl_contains(_set2_, _set1_->dense[i]))
+            return 0;
+    }
+    return 1;
+}
+_Bool ss_is_proper_superset(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    return ss_is_proper_subset(_set2_, _set1_);
+}
+_Bool ss_is_disjointset(struct sparseset *_set1_, struct sparseset *_set2_)
+{
+    _set1_->flag = CMC_FLAG_OK;
+    _set2_->flag = CMC_FLAG_OK;
+    struct sparseset *_set_A_ = _set1_->count < _set2_->count ? _set1_ : _set2_;
+    struct sparseset *_set_B_ = _set_A_ == _set1_ ? _set2_ : _set1_;
+    for (size_t i = 0; i < _set_A_->count; i++)
+    {
+        if (ss_impl_contains(_set_B_, _set_A_->dense[i]))
+            return 0;
+    }
+    return 1;
+}
+_Bool ss_to_string(struct sparseset *_set_, FILE *fptr)
+{
+    struct sparseset *s_ = _set_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "dense:%p, "
+                        "sparse:%p, "
+                        "capacity:%"
+                        "I64u"
+                        ", "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks: %p }",
+                        "sparseset", "size_t", s_, s_->dense, s_->sparse, s_->capacity, s_->count, s_->flag, s_->f_val,
+                        s_->alloc, (s_)->callbacks);
+}
+_Bool ss_print(struct sparseset *_set_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    fprintf(fptr, "%s", start);
+    for (size_t i = 0; i < _set_->count; i++)
+    {
+        if (!_set_->f_val->str(fptr, _set_->dense[i]))
+            return 0;
+        if (i + 1 < _set_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
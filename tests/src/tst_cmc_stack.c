@@ -1,6 +1,7 @@
 
 #include "tst_cmc_stack.h"
 
+static _Bool s_impl_is_inline(struct stack *_stack_);
 struct stack *s_new(size_t capacity, struct stack_fval *f_val)
 {
     return s_new_custom(capacity, f_val, ((void *)0), ((void *)0));
@@ -18,11 +19,20 @@ struct stack *s_new_custom(size_t capacity, struct stack_fval *f_val, struct cmc
     struct stack *_stack_ = alloc->malloc(sizeof(struct stack));
     if (!_stack_)
         return ((void *)0);
-    _stack_->buffer = alloc->calloc(capacity, sizeof(size_t));
-    if (!_stack_->buffer)
+    if (capacity <= ( + 0))
     {
-        alloc->free(_stack_);
-        return ((void *)0);
+        memset(_stack_->inline_buffer, 0, sizeof(size_t) * ( + 0));
+        _stack_->buffer = _stack_->inline_buffer;
+        capacity = ( + 0);
+    }
+    else
+    {
+        _stack_->buffer = alloc->calloc(capacity, sizeof(size_t));
+        if (!_stack_->buffer)
+        {
+            alloc->free(_stack_);
+            return ((void *)0);
+        }
     }
     _stack_->capacity = capacity;
     _stack_->count = 0;
@@ -50,7 +60,8 @@ void s_free(struct stack *_stack_)
         for (size_t i = 0; i < _stack_->count; i++)
             _stack_->f_val->free(_stack_->buffer[i]);
     }
-    _stack_->alloc->free(_stack_->buffer);
+    if (!s_impl_is_inline(_stack_))
+        _stack_->alloc->free(_stack_->buffer);
     _stack_->alloc->free(_stack_);
 }
 void s_customize(struct stack *_stack_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
@@ -108,12 +119,19 @@ _Bool s_contains(struct stack *_stack_, size_t value)
 {
     _stack_->flag = CMC_FLAG_OK;
     _Bool result = 0;
-    for (size_t i = 0; i < _stack_->count; i++)
+    if (_stack_->f_val->find)
+    {
+        result = _stack_->f_val->find(_stack_->buffer, _stack_->count, value) < _stack_->count;
+    }
+    else
     {
-        if (_stack_->f_val->cmp(_stack_->buffer[i], value) == 0)
+        for (size_t i = 0; i < _stack_->count; i++)
         {
-            result = 1;
-            break;
+            if (_stack_->f_val->cmp(_stack_->buffer[i], value) == 0)
+            {
+                result = 1;
+                break;
+            }
         }
     }
     if ((_stack_)->callbacks && (_stack_)->callbacks->read)
@@ -150,7 +168,25 @@ _Bool s_resize(struct stack *_stack_, size_t capacity)
         _stack_->flag = CMC_FLAG_INVALID;
         return 0;
     }
-    size_t *new_buffer = _stack_->alloc->realloc(_stack_->buffer, sizeof(size_t) * capacity);
+    if (( + 0) > 0 && capacity <= ( + 0))
+    {
+        if (s_impl_is_inline(_stack_))
+            goto success;
+        memcpy(_stack_->inline_buffer, _stack_->buffer, sizeof(size_t) * _stack_->count);
+        _stack_->alloc->free(_stack_->buffer);
+        _stack_->buffer = _stack_->inline_buffer;
+        _stack_->capacity = ( + 0);
+        goto success;
+    }
+    size_t *new_buffer;
+    if (s_impl_is_inline(_stack_))
+    {
+        new_buffer = _stack_->alloc->malloc(sizeof(size_t) * capacity);
+        if (new_buffer)
+            memcpy(new_buffer, _stack_->inline_buffer, sizeof(size_t) * _stack_->count);
+    }
+    else
+        new_buffer = _stack_->alloc->realloc(_stack_->buffer, sizeof(size_t) * capacity);
     if (!new_buffer)
     {
         _stack_->flag = CMC_FLAG_ALLOC;
@@ -198,6 +234,10 @@ _Bool s_equals(struct stack *_stack1_, struct stack *_stack2_)
     }
     return 1;
 }
+static _Bool s_impl_is_inline(struct stack *_stack_)
+{
+    return ( + 0) > 0 && _stack_->buffer == _stack_->inline_buffer;
+}
 struct stack_iter s_iter_start(struct stack *target)
 {
     struct stack_iter iter;
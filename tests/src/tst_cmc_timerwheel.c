@@ -0,0 +1,564 @@
+
+#include "tst_cmc_timerwheel.h"
+
+static struct timerwheel_entry *tmw_impl_get_timer(struct timerwheel *_wheel_, uint64_t handle);
+static void tmw_impl_reset(struct timerwheel *_wheel_);
+static void tmw_impl_link(struct timerwheel *_wheel_, uint32_t t);
+static void tmw_impl_unlink(struct timerwheel *_wheel_, uint32_t t);
+static void tmw_impl_release(struct timerwheel *_wheel_, uint32_t t);
+static void tmw_impl_cascade(struct timerwheel *_wheel_);
+static uint32_t tmw_impl_sort(struct timerwheel *_wheel_, uint32_t t);
+static size_t tmw_impl_lowest_bit(uint64_t bits);
+struct timerwheel *tmw_new(size_t capacity, uint64_t now, struct timerwheel_fval *f_val)
+{
+    return tmw_new_custom(capacity, now, f_val, ((void *)0), ((void *)0));
+}
+struct timerwheel *tmw_new_custom(size_t capacity, uint64_t now, struct timerwheel_fval *f_val,
+                                  struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (capacity == 0 || capacity >= (4294967295U))
+        return ((void *)0);
+    if (!f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct timerwheel *_wheel_ = alloc->malloc(sizeof(struct timerwheel));
+    if (!_wheel_)
+        return ((void *)0);
+    _wheel_->timers = alloc->malloc(sizeof(struct timerwheel_entry) * capacity);
+    if (!_wheel_->timers)
+    {
+        alloc->free(_wheel_);
+        return ((void *)0);
+    }
+    _wheel_->capacity = capacity;
+    _wheel_->count = 0;
+    _wheel_->used = 0;
+    _wheel_->free = (4294967295U);
+    _wheel_->now = now;
+    _wheel_->flag = CMC_FLAG_OK;
+    _wheel_->f_val = f_val;
+    _wheel_->alloc = alloc;
+    (_wheel_)->callbacks = callbacks;
+    tmw_impl_reset(_wheel_);
+    return _wheel_;
+}
+void tmw_clear(struct timerwheel *_wheel_)
+{
+    for (size_t i = 0; i < _wheel_->used; i++)
+    {
+        if (_wheel_->timers[i].generation % 2 == 0)
+            continue;
+        if (_wheel_->f_val->free)
+            _wheel_->f_val->free(_wheel_->timers[i].value);
+        tmw_impl_release(_wheel_, (uint32_t)i);
+    }
+    tmw_impl_reset(_wheel_);
+    _wheel_->count = 0;
+    _wheel_->flag = CMC_FLAG_OK;
+}
+void tmw_free(struct timerwheel *_wheel_)
+{
+    if (_wheel_->f_val->free)
+    {
+        for (size_t i = 0; i < _wheel_->used; i++)
+        {
+            if (_wheel_->timers[i].generation % 2 != 0)
+                _wheel_->f_val->free(_wheel_->timers[i].value);
+        }
+    }
+    _wheel_->alloc->free(_wheel_->timers);
+    _wheel_->alloc->free(_wheel_);
+}
+void tmw_customize(struct timerwheel *_wheel_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _wheel_->alloc = &cmc_alloc_node_default;
+    else
+        _wheel_->alloc = alloc;
+    (_wheel_)->callbacks = callbacks;
+    _wheel_->flag = CMC_FLAG_OK;
+}
+_Bool tmw_schedule(struct timerwheel *_wheel_, uint64_t deadline, size_t value, uint64_t *handle)
+{
+    if (_wheel_->free == (4294967295U) && _wheel_->used == _wheel_->capacity)
+    {
+        size_t capacity = _wheel_->capacity * 2;
+        if (capacity >= (4294967295U))
+            capacity = (4294967295U) - 1;
+        if (capacity == _wheel_->capacity)
+        {
+            _wheel_->flag = CMC_FLAG_ERROR;
+            return 0;
+        }
+        if (!tmw_resize(_wheel_, capacity))
+            return 0;
+    }
+    uint32_t t;
+    if (_wheel_->free != (4294967295U))
+    {
+        t = _wheel_->free;
+        _wheel_->free = _wheel_->timers[t].next;
+    }
+    else
+    {
+        t = (uint32_t)_wheel_->used++;
+        _wheel_->timers[t].generation = 0;
+    }
+    struct timerwheel_entry *timer = &(_wheel_->timers[t]);
+    timer->value = value;
+    timer->deadline = deadline;
+    timer->generation++;
+    tmw_impl_link(_wheel_, t);
+    if (handle)
+        *handle = (((uint64_t)(timer->generation) << 32) | (uint64_t)(t));
+    _wheel_->count++;
+    _wheel_->flag = CMC_FLAG_OK;
+    if ((_wheel_)->callbacks && (_wheel_)->callbacks->create)
+        (_wheel_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool tmw_cancel(struct timerwheel *_wheel_, uint64_t handle, size_t *out_value)
+{
+    if (tmw_empty(_wheel_))
+    {
+        _wheel_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct timerwheel_entry *timer = tmw_impl_get_timer(_wheel_, handle);
+    if (!timer)
+    {
+        _wheel_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    if (out_value)
+        *out_value = timer->value;
+    tmw_impl_unlink(_wheel_, ((uint32_t)((handle)&(4294967295U))));
+    tmw_impl_release(_wheel_, ((uint32_t)((handle)&(4294967295U))));
+    _wheel_->count--;
+    _wheel_->flag = CMC_FLAG_OK;
+    if ((_wheel_)->callbacks && (_wheel_)->callbacks->delete)
+        (_wheel_)->callbacks->delete ();
+    ;
+    return 1;
+}
+_Bool tmw_reschedule(struct timerwheel *_wheel_, uint64_t handle, uint64_t deadline)
+{
+    if (tmw_empty(_wheel_))
+    {
+        _wheel_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct timerwheel_entry *timer = tmw_impl_get_timer(_wheel_, handle);
+    if (!timer)
+    {
+        _wheel_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    tmw_impl_unlink(_wheel_, ((uint32_t)((handle)&(4294967295U))));
+    timer->deadline = deadline;
+    tmw_impl_link(_wheel_, ((uint32_t)((handle)&(4294967295U))));
+    _wheel_->flag = CMC_FLAG_OK;
+    if ((_wheel_)->callbacks && (_wheel_)->callbacks->update)
+        (_wheel_)->callbacks->update();
+    ;
+    return 1;
+}
+size_t tmw_advance(struct timerwheel *_wheel_, uint64_t now, void (*expire)(size_t, uint64_t))
+{
+    if (now < _wheel_->now)
+    {
+        _wheel_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    size_t result = 0;
+    uint64_t tick;
+    while (1)
+    {
+        _wheel_->lists[((11 * (1 << 6)) + 1)] = _wheel_->lists[(11 * (1 << 6))];
+        _wheel_->lists[(11 * (1 << 6))] = (4294967295U);
+        _Bool sorted = 1;
+        for (uint32_t t = _wheel_->lists[((11 * (1 << 6)) + 1)]; t != (4294967295U); t = _wheel_->timers[t].next)
+        {
+            uint32_t next = _wheel_->timers[t].next;
+            if (next != (4294967295U) && _wheel_->timers[next].deadline < _wheel_->timers[t].deadline)
+                sorted = 0;
+            _wheel_->timers[t].list = ((11 * (1 << 6)) + 1);
+        }
+        if (!sorted)
+        {
+            uint32_t prev = (4294967295U);
+            _wheel_->lists[((11 * (1 << 6)) + 1)] = tmw_impl_sort(_wheel_, _wheel_->lists[((11 * (1 << 6)) + 1)]);
+            for (uint32_t t = _wheel_->lists[((11 * (1 << 6)) + 1)]; t != (4294967295U); t = _wheel_->timers[t].next)
+            {
+                _wheel_->timers[t].prev = prev;
+                prev = t;
+            }
+        }
+        while (_wheel_->lists[((11 * (1 << 6)) + 1)] != (4294967295U))
+        {
+            uint32_t t = _wheel_->lists[((11 * (1 << 6)) + 1)];
+            size_t value = _wheel_->timers[t].value;
+            uint64_t deadline = _wheel_->timers[t].deadline;
+            tmw_impl_unlink(_wheel_, t);
+            tmw_impl_release(_wheel_, t);
+            _wheel_->count--;
+            result++;
+            if (expire)
+                expire(value, deadline);
+            else if (_wheel_->f_val->free)
+                _wheel_->f_val->free(value);
+        }
+        if (!tmw_next_tick(_wheel_, &tick) || tick > now)
+            break;
+        _wheel_->now = tick;
+        tmw_impl_cascade(_wheel_);
+    }
+    _wheel_->now = now;
+    _wheel_->flag = CMC_FLAG_OK;
+    if ((_wheel_)->callbacks && (_wheel_)->callbacks->update)
+        (_wheel_)->callbacks->update();
+    ;
+    return result;
+}
+size_t tmw_get(struct timerwheel *_wheel_, uint64_t handle)
+{
+    if (tmw_empty(_wheel_))
+    {
+        _wheel_->flag = CMC_FLAG_EMPTY;
+        return (size_t){ 0 };
+    }
+    struct timerwheel_entry *timer = tmw_impl_get_timer(_wheel_, handle);
+    if (!timer)
+    {
+        _wheel_->flag = CMC_FLAG_NOT_FOUND;
+        return (size_t){ 0 };
+    }
+    _wheel_->flag = CMC_FLAG_OK;
+    if ((_wheel_)->callbacks && (_wheel_)->callbacks->read)
+        (_wheel_)->callbacks->read();
+    ;
+    return timer->value;
+}
+uint64_t tmw_deadline(struct timerwheel *_wheel_, uint64_t handle)
+{
+    if (tmw_empty(_wheel_))
+    {
+        _wheel_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct timerwheel_entry *timer = tmw_impl_get_timer(_wheel_, handle);
+    if (!timer)
+    {
+        _wheel_->flag = CMC_FLAG_NOT_FOUND;
+        return 0;
+    }
+    _wheel_->flag = CMC_FLAG_OK;
+    if ((_wheel_)->callbacks && (_wheel_)->callbacks->read)
+        (_wheel_)->callbacks->read();
+    ;
+    return timer->deadline;
+}
+_Bool tmw_next_tick(struct timerwheel *_wheel_, uint64_t *tick)
+{
+    _wheel_->flag = CMC_FLAG_OK;
+    for (size_t level = 0; level < 11; level++)
+    {
+        size_t shift = level * 6;
+        size_t slot = (size_t)(_wheel_->now >> shift) & ((1 << 6) - 1);
+        if (slot + 1 == (1 << 6))
+            continue;
+        uint64_t bits = _wheel_->occupied[level] >> (slot + 1) << (slot + 1);
+        if (bits == 0)
+            continue;
+        uint64_t above = 0;
+        if (shift + 6 < 64)
+            above = _wheel_->now >> (shift + 6) << (shift + 6);
+        if (tick)
+            *tick = above | ((uint64_t)tmw_impl_lowest_bit(bits) << shift);
+        return 1;
+    }
+    return 0;
+}
+_Bool tmw_contains(struct timerwheel *_wheel_, uint64_t handle)
+{
+    _wheel_->flag = CMC_FLAG_OK;
+    _Bool result = tmw_impl_get_timer(_wheel_, handle) != ((void *)0);
+    if ((_wheel_)->callbacks && (_wheel_)->callbacks->read)
+        (_wheel_)->callbacks->read();
+    ;
+    return result;
+}
+_Bool tmw_empty(struct timerwheel *_wheel_)
+{
+    return _wheel_->count == 0;
+}
+size_t tmw_count(struct timerwheel *_wheel_)
+{
+    return _wheel_->count;
+}
+size_t tmw_capacity(struct timerwheel *_wheel_)
+{
+    return _wheel_->capacity;
+}
+uint64_t tmw_now(struct timerwheel *_wheel_)
+{
+    return _wheel_->now;
+}
+int tmw_flag(struct timerwheel *_wheel_)
+{
+    return _wheel_->flag;
+}
+_Bool tmw_resize(struct timerwheel *_wheel_, size_t capacity)
+{
+    _wheel_->flag = CMC_FLAG_OK;
+    if (_wheel_->capacity == capacity)
+        goto success;
+    if (capacity < _wheel_->used || capacity == 0)
+    {
+        _wheel_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    if (capacity >= (4294967295U))
+    {
+        _wheel_->flag = CMC_FLAG_ERROR;
+        return 0;
+    }
+    struct timerwheel_entry *new_timers =
+        _wheel_->alloc->realloc(_wheel_->timers, sizeof(struct timerwheel_entry) * capacity);
+    if (!new_timers)
+    {
+        _wheel_->flag = CMC_FLAG_ALLOC;
+        return 0;
+    }
+    _wheel_->timers = new_timers;
+    _wheel_->capacity = capacity;
+success:
+    if ((_wheel_)->callbacks && (_wheel_)->callbacks->resize)
+        (_wheel_)->callbacks->resize();
+    ;
+    return 1;
+}
+struct timerwheel *tmw_copy_of(struct timerwheel *_wheel_)
+{
+    struct timerwheel *result =
+        tmw_new_custom(_wheel_->capacity, _wheel_->now, _wheel_->f_val, _wheel_->alloc, ((void *)0));
+    if (!result)
+    {
+        _wheel_->flag = CMC_FLAG_ERROR;
+        return ((void *)0);
+    }
+    (result)->callbacks = _wheel_->callbacks;
+    memcpy(result->timers, _wheel_->timers, sizeof(struct timerwheel_entry) * _wheel_->used);
+    memcpy(result->lists, _wheel_->lists, sizeof(_wheel_->lists));
+    memcpy(result->occupied, _wheel_->occupied, sizeof(_wheel_->occupied));
+    if (_wheel_->f_val->cpy)
+    {
+        for (size_t i = 0; i < _wheel_->used; i++)
+        {
+            if (result->timers[i].generation % 2 != 0)
+                result->timers[i].value = _wheel_->f_val->cpy(_wheel_->timers[i].value);
+        }
+    }
+    result->count = _wheel_->count;
+    result->used = _wheel_->used;
+    result->free = _wheel_->free;
+    _wheel_->flag = CMC_FLAG_OK;
+    return result;
+}
+_Bool tmw_equals(struct timerwheel *_wheel1_, struct timerwheel *_wheel2_)
+{
+    _wheel1_->flag = CMC_FLAG_OK;
+    _wheel2_->flag = CMC_FLAG_OK;
+    if (_wheel1_->now != _wheel2_->now || _wheel1_->count != _wheel2_->count)
+        return 0;
+    for (size_t i = 0; i < _wheel1_->used; i++)
+    {
+        struct timerwheel_entry *timer1 = &(_wheel1_->timers[i]);
+        if (timer1->generation % 2 == 0)
+            continue;
+        uint64_t handle = (((uint64_t)(timer1->generation) << 32) | (uint64_t)(i));
+        struct timerwheel_entry *timer2 = tmw_impl_get_timer(_wheel2_, handle);
+        if (!timer2 || timer1->deadline != timer2->deadline)
+            return 0;
+        if (_wheel1_->f_val->cmp(timer1->value, timer2->value) != 0)
+            return 0;
+    }
+    return 1;
+}
+static struct timerwheel_entry *tmw_impl_get_timer(struct timerwheel *_wheel_, uint64_t handle)
+{
+    uint32_t t = ((uint32_t)((handle)&(4294967295U)));
+    uint32_t generation = ((uint32_t)((handle) >> 32));
+    if (t >= _wheel_->used || generation % 2 == 0)
+        return ((void *)0);
+    struct timerwheel_entry *timer = &(_wheel_->timers[t]);
+    if (timer->generation != generation)
+        return ((void *)0);
+    return timer;
+}
+static void tmw_impl_reset(struct timerwheel *_wheel_)
+{
+    for (size_t i = 0; i <= ((11 * (1 << 6)) + 1); i++)
+        _wheel_->lists[i] = (4294967295U);
+    for (size_t i = 0; i < 11; i++)
+        _wheel_->occupied[i] = 0;
+}
+static void tmw_impl_link(struct timerwheel *_wheel_, uint32_t t)
+{
+    struct timerwheel_entry *timer = &(_wheel_->timers[t]);
+    size_t list = (11 * (1 << 6));
+    if (timer->deadline > _wheel_->now)
+    {
+        uint64_t diff = timer->deadline ^ _wheel_->now;
+        size_t level = 0;
+        while (diff >= (1 << 6))
+        {
+            diff >>= 6;
+            level++;
+        }
+        size_t slot = (size_t)(timer->deadline >> (level * 6)) & ((1 << 6) - 1);
+        list = level * (1 << 6) + slot;
+        _wheel_->occupied[level] |= (uint64_t)1 << slot;
+    }
+    timer->list = (uint16_t)list;
+    timer->prev = (4294967295U);
+    timer->next = _wheel_->lists[list];
+    if (timer->next != (4294967295U))
+        _wheel_->timers[timer->next].prev = t;
+    _wheel_->lists[list] = t;
+}
+static void tmw_impl_unlink(struct timerwheel *_wheel_, uint32_t t)
+{
+    struct timerwheel_entry *timer = &(_wheel_->timers[t]);
+    if (timer->prev != (4294967295U))
+        _wheel_->timers[timer->prev].next = timer->next;
+    else
+        _wheel_->lists[timer->list] = timer->next;
+    if (timer->next != (4294967295U))
+        _wheel_->timers[timer->next].prev = timer->prev;
+    if (timer->list < (11 * (1 << 6)) && _wheel_->lists[timer->list] == (4294967295U))
+    {
+        size_t level = timer->list / (1 << 6);
+        size_t slot = timer->list % (1 << 6);
+        _wheel_->occupied[level] &= ~((uint64_t)1 << slot);
+    }
+}
+static void tmw_impl_release(struct timerwheel *_wheel_, uint32_t t)
+{
+    struct timerwheel_entry *timer = &(_wheel_->timers[t]);
+    timer->generation++;
+    if (timer->generation != 0)
+    {
+        timer->next = _wheel_->free;
+        _wheel_->free = t;
+    }
+}
+static void tmw_impl_cascade(struct timerwheel *_wheel_)
+{
+    for (size_t level = 0; level < 11; level++)
+    {
+        size_t slot = (size_t)(_wheel_->now >> (level * 6)) & ((1 << 6) - 1);
+        size_t list = level * (1 << 6) + slot;
+        uint32_t t = _wheel_->lists[list];
+        if (t == (4294967295U))
+            continue;
+        _wheel_->lists[list] = (4294967295U);
+        _wheel_->occupied[level] &= ~((uint64_t)1 << slot);
+        while (t != (4294967295U))
+        {
+            uint32_t next = _wheel_->timers[t].next;
+            tmw_impl_link(_wheel_, t);
+            t = next;
+        }
+    }
+}
+static uint32_t tmw_impl_sort(struct timerwheel *_wheel_, uint32_t t)
+{
+    if (t == (4294967295U) || _wheel_->timers[t].next == (4294967295U))
+        return t;
+    uint32_t middle = t;
+    uint32_t fast = _wheel_->timers[t].next;
+    while (fast != (4294967295U) && _wheel_->timers[fast].next != (4294967295U))
+    {
+        middle = _wheel_->timers[middle].next;
+        fast = _wheel_->timers[_wheel_->timers[fast].next].next;
+    }
+    uint32_t right = _wheel_->timers[middle].next;
+    _wheel_->timers[middle].next = (4294967295U);
+    uint32_t left = tmw_impl_sort(_wheel_, t);
+    right = tmw_impl_sort(_wheel_, right);
+    uint32_t head = (4294967295U);
+    uint32_t tail = (4294967295U);
+    while (left != (4294967295U) || right != (4294967295U))
+    {
+        uint32_t next;
+        if (right == (4294967295U) ||
+            (left != (4294967295U) && _wheel_->timers[left].deadline <= _wheel_->timers[right].deadline))
+        {
+            next = left;
+            left = _wheel_->timers[left].next;
+        }
+        else
+        {
+            next = right;
+            right = _wheel_->timers[right].next;
+        }
+        if (tail == (4294967295U))
+            head = next;
+        else
+            _wheel_->timers[tail].next = next;
+        tail = next;
+    }
+    return head;
+}
+static size_t tmw_impl_lowest_bit(uint64_t bits)
+{
+    static const unsigned char table[64] = { 0, 1, 56, 2, 57, 49, 28, 3, 61, 58, 42, 50, 38, 29, 17, 4, 62, 47, 59, 36, 45, 43, 51, 22, 53, 39, 33, 30, 24, 18, 12, 5, 63, 55, 48, 27, 60, 41, 37, 16, 46, 35, 44, 21, 52, 32, 23, 11, 54, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6 };
+    return table[((bits & (~bits + 1)) * 0x03f79d71b4ca8b09UL) >> 58];
+}
+_Bool tmw_to_string(struct timerwheel *_wheel_, FILE *fptr)
+{
+    struct timerwheel *w_ = _wheel_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "timers:%p, "
+                        "capacity:%"
+                        "I64u"
+                        ", "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "used:%"
+                        "I64u"
+                        ", "
+                        "now:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks: %p }",
+                        "timerwheel", "size_t", w_, w_->timers, w_->capacity, w_->count, w_->used, w_->now, w_->flag,
+                        w_->f_val, w_->alloc, (w_)->callbacks);
+}
+_Bool tmw_print(struct timerwheel *_wheel_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    fprintf(fptr, "%s", start);
+    size_t printed = 0;
+    for (size_t i = 0; i < _wheel_->used; i++)
+    {
+        if (_wheel_->timers[i].generation % 2 == 0)
+            continue;
+        if (!_wheel_->f_val->str(fptr, _wheel_->timers[i].value))
+            return 0;
+        if (++printed < _wheel_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
@@ -8,10 +8,76 @@ static unsigned char tm_impl_hupdate(struct treemap_node *node);
 static void tm_impl_rotate_right(struct treemap_node **Z);
 static void tm_impl_rotate_left(struct treemap_node **Z);
 static void tm_impl_rebalance(struct treemap *_map_, struct treemap_node *node);
+static size_t tm_impl_free_nodes(struct treemap *_map_, struct treemap_node *scan);
+static void tm_impl_split(struct treemap *_map_, struct treemap_node *node, size_t key, _Bool after,
+                          struct treemap_node **left, struct treemap_node **right);
+static struct treemap_node *tm_impl_join(struct treemap_node *left, struct treemap_node *middle,
+                                         struct treemap_node *right);
+static struct treemap_node *tm_impl_fix(struct treemap_node *node);
+static struct treemap_node *tm_impl_attach(struct treemap *_map_, struct treemap_node *parent, _Bool left, size_t key,
+                                           size_t value);
 struct treemap *tm_new(struct treemap_fkey *f_key, struct treemap_fval *f_val)
 {
     return tm_new_custom(f_key, f_val, ((void *)0), ((void *)0));
 }
+size_t tm_remove_range(struct treemap *_map_, size_t low, size_t high)
+{
+    if (tm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    if (_map_->f_key->cmp(low, high) > 0)
+    {
+        _map_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    struct treemap_node *left = ((void *)0);
+    struct treemap_node *middle = ((void *)0);
+    struct treemap_node *right = ((void *)0);
+    tm_impl_split(_map_, _map_->root, low, 0, &left, &right);
+    tm_impl_split(_map_, right, high, 1, &middle, &right);
+    if (left && right)
+    {
+        struct treemap_node *min = right;
+        while (min->left)
+            min = min->left;
+        tm_impl_split(_map_, right, min->key, 1, &min, &right);
+        _map_->root = tm_impl_join(left, min, right);
+    }
+    else
+        _map_->root = left ? left : right;
+    size_t removed = tm_impl_free_nodes(_map_, middle);
+    _map_->count -= removed;
+    _map_->flag = CMC_FLAG_OK;
+    if (removed > 0)
+    {
+        if ((_map_)->callbacks && (_map_)->callbacks->delete)
+            (_map_)->callbacks->delete ();
+        ;
+    }
+    return removed;
+}
+size_t tm_remove_below(struct treemap *_map_, size_t key)
+{
+    if (tm_empty(_map_))
+    {
+        _map_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct treemap_node *below = ((void *)0);
+    tm_impl_split(_map_, _map_->root, key, 0, &below, &_map_->root);
+    size_t removed = tm_impl_free_nodes(_map_, below);
+    _map_->count -= removed;
+    _map_->flag = CMC_FLAG_OK;
+    if (removed > 0)
+    {
+        if ((_map_)->callbacks && (_map_)->callbacks->delete)
+            (_map_)->callbacks->delete ();
+        ;
+    }
+    return removed;
+}
 struct treemap *tm_new_custom(struct treemap_fkey *f_key, struct treemap_fval *f_val, struct cmc_alloc_node *alloc,
                               struct cmc_callbacks *callbacks)
 {
@@ -34,57 +100,7 @@ struct treemap *tm_new_custom(struct treemap_fkey *f_key, struct treemap_fval *f
 }
 void tm_clear(struct treemap *_map_)
 {
-    struct treemap_node *scan = _map_->root;
-    struct treemap_node *up = ((void *)0);
-    while (scan != ((void *)0))
-    {
-        if (scan->left != ((void *)0))
-        {
-            struct treemap_node *left = scan->left;
-            scan->left = up;
-            up = scan;
-            scan = left;
-        }
-        else if (scan->right != ((void *)0))
-        {
-            struct treemap_node *right = scan->right;
-            scan->left = up;
-            scan->right = ((void *)0);
-            up = scan;
-            scan = right;
-        }
-        else
-        {
-            if (up == ((void *)0))
-            {
-                if (_map_->f_key->free)
-                    _map_->f_key->free(scan->key);
-                if (_map_->f_val->free)
-                    _map_->f_val->free(scan->value);
-                _map_->alloc->free(scan);
-                scan = ((void *)0);
-            }
-            while (up != ((void *)0))
-            {
-                if (_map_->f_key->free)
-                    _map_->f_key->free(scan->key);
-                if (_map_->f_val->free)
-                    _map_->f_val->free(scan->value);
-                _map_->alloc->free(scan);
-                if (up->right != ((void *)0))
-                {
-                    scan = up->right;
-                    up->right = ((void *)0);
-                    break;
-                }
-                else
-                {
-                    scan = up;
-                    up = up->left;
-                }
-            }
-        }
-    }
+    tm_impl_free_nodes(_map_, _map_->root);
     _map_->count = 0;
     _map_->root = ((void *)0);
     _map_->flag = CMC_FLAG_OK;
@@ -107,62 +123,25 @@ void tm_customize(struct treemap *_map_, struct cmc_alloc_node *alloc, struct cm
 _Bool tm_insert(struct treemap *_map_, size_t key, size_t value)
 {
     if (tm_empty(_map_))
+        return tm_impl_attach(_map_, ((void *)0), 0, key, value) != ((void *)0);
+    struct treemap_node *scan = _map_->root;
+    struct treemap_node *parent = scan;
+    int cmp = 0;
+    while (scan != ((void *)0))
     {
-        _map_->root = tm_impl_new_node(_map_, key, value);
-        if (!_map_->root)
-        {
-            _map_->flag = CMC_FLAG_ALLOC;
-            return 0;
-        }
-    }
-    else
-    {
-        struct treemap_node *scan = _map_->root;
-        struct treemap_node *parent = scan;
-        while (scan != ((void *)0))
-        {
-            parent = scan;
-            if (_map_->f_key->cmp(scan->key, key) > 0)
-                scan = scan->left;
-            else if (_map_->f_key->cmp(scan->key, key) < 0)
-                scan = scan->right;
-            else
-            {
-                _map_->flag = CMC_FLAG_DUPLICATE;
-                return 0;
-            }
-        }
-        struct treemap_node *node;
-        if (_map_->f_key->cmp(parent->key, key) > 0)
-        {
-            parent->left = tm_impl_new_node(_map_, key, value);
-            if (!parent->left)
-            {
-                _map_->flag = CMC_FLAG_ALLOC;
-                return 0;
-            }
-            parent->left->parent = parent;
-            node = parent->left;
-        }
+        parent = scan;
+        cmp = _map_->f_key->cmp(scan->key, key);
+        if (cmp > 0)
+            scan = scan->left;
+        else if (cmp < 0)
+            scan = scan->right;
         else
         {
-            parent->right = tm_impl_new_node(_map_, key, value);
-            if (!parent->right)
-            {
-                _map_->flag = CMC_FLAG_ALLOC;
-                return 0;
-            }
-            parent->right->parent = parent;
-            node = parent->right;
+            _map_->flag = CMC_FLAG_DUPLICATE;
+            return 0;
         }
-        tm_impl_rebalance(_map_, node);
     }
-    _map_->count++;
-    _map_->flag = CMC_FLAG_OK;
-    if ((_map_)->callbacks && (_map_)->callbacks->create)
-        (_map_)->callbacks->create();
-    ;
-    return 1;
+    return tm_impl_attach(_map_, parent, cmp > 0, key, value) != ((void *)0);
 }
 _Bool tm_update(struct treemap *_map_, size_t key, size_t new_value, size_t *old_value)
 {
@@ -498,9 +477,10 @@ static struct treemap_node *tm_impl_get_node(struct treemap *_map_, size_t key)
     struct treemap_node *scan = _map_->root;
     while (scan != ((void *)0))
     {
-        if (_map_->f_key->cmp(scan->key, key) > 0)
+        int cmp = _map_->f_key->cmp(scan->key, key);
+        if (cmp > 0)
             scan = scan->left;
-        else if (_map_->f_key->cmp(scan->key, key) < 0)
+        else if (cmp < 0)
             scan = scan->right;
         else
             return scan;
@@ -570,6 +550,7 @@ static void tm_impl_rebalance(struct treemap *_map_, struct treemap_node *node)
     _Bool is_root = 0;
     while (scan != ((void *)0))
     {
+        unsigned char height = scan->height;
         if (scan->parent == ((void *)0))
             is_root = 1;
         scan->height = tm_impl_hupdate(scan);
@@ -593,9 +574,169 @@ static void tm_impl_rebalance(struct treemap *_map_, struct treemap_node *node)
             _map_->root = scan;
             is_root = 0;
         }
+        if (scan->height == height)
+            break;
         scan = scan->parent;
     }
 }
+static struct treemap_node *tm_impl_attach(struct treemap *_map_, struct treemap_node *parent, _Bool left, size_t key,
+                                           size_t value)
+{
+    struct treemap_node *node = tm_impl_new_node(_map_, key, value);
+    if (!node)
+    {
+        _map_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    node->parent = parent;
+    if (!parent)
+        _map_->root = node;
+    else if (left)
+        parent->left = node;
+    else
+        parent->right = node;
+    tm_impl_rebalance(_map_, node);
+    _map_->count++;
+    _map_->flag = CMC_FLAG_OK;
+    if ((_map_)->callbacks && (_map_)->callbacks->create)
+        (_map_)->callbacks->create();
+    ;
+    return node;
+}
+static size_t tm_impl_free_nodes(struct treemap *_map_, struct treemap_node *scan)
+{
+    size_t count = 0;
+    struct treemap_node *up = ((void *)0);
+    while (scan != ((void *)0))
+    {
+        if (scan->left != ((void *)0))
+        {
+            struct treemap_node *left = scan->left;
+            scan->left = up;
+            up = scan;
+            scan = left;
+        }
+        else if (scan->right != ((void *)0))
+        {
+            struct treemap_node *right = scan->right;
+            scan->left = up;
+            scan->right = ((void *)0);
+            up = scan;
+            scan = right;
+        }
+        else
+        {
+            if (up == ((void *)0))
+            {
+                if (_map_->f_key->free)
+                    _map_->f_key->free(scan->key);
+                if (_map_->f_val->free)
+                    _map_->f_val->free(scan->value);
+                _map_->alloc->free(scan);
+                count++;
+                scan = ((void *)0);
+            }
+            while (up != ((void *)0))
+            {
+                if (_map_->f_key->free)
+                    _map_->f_key->free(scan->key);
+                if (_map_->f_val->free)
+                    _map_->f_val->free(scan->value);
+                _map_->alloc->free(scan);
+                count++;
+                if (up->right != ((void *)0))
+                {
+                    scan = up->right;
+                    up->right = ((void *)0);
+                    break;
+                }
+                else
+                {
+                    scan = up;
+                    up = up->left;
+                }
+            }
+        }
+    }
+    return count;
+}
+static void tm_impl_split(struct treemap *_map_, struct treemap_node *node, size_t key, _Bool after,
+                          struct treemap_node **left, struct treemap_node **right)
+{
+    if (!node)
+    {
+        *left = ((void *)0);
+        *right = ((void *)0);
+        return;
+    }
+    struct treemap_node *l = node->left;
+    struct treemap_node *r = node->right;
+    if (l)
+        l->parent = ((void *)0);
+    if (r)
+        r->parent = ((void *)0);
+    int cmp = _map_->f_key->cmp(node->key, key);
+    if (cmp < 0 || (after && cmp == 0))
+    {
+        tm_impl_split(_map_, r, key, after, left, right);
+        *left = tm_impl_join(l, node, *left);
+    }
+    else
+    {
+        tm_impl_split(_map_, l, key, after, left, right);
+        *right = tm_impl_join(*right, node, r);
+    }
+}
+static struct treemap_node *tm_impl_join(struct treemap_node *left, struct treemap_node *middle,
+                                         struct treemap_node *right)
+{
+    unsigned char h_l = tm_impl_h(left);
+    unsigned char h_r = tm_impl_h(right);
+    if (h_l > h_r + 1)
+    {
+        struct treemap_node *sub = tm_impl_join(left->right, middle, right);
+        left->right = sub;
+        sub->parent = left;
+        return tm_impl_fix(left);
+    }
+    else if (h_r > h_l + 1)
+    {
+        struct treemap_node *sub = tm_impl_join(left, middle, right->left);
+        right->left = sub;
+        sub->parent = right;
+        return tm_impl_fix(right);
+    }
+    middle->parent = ((void *)0);
+    middle->left = left;
+    middle->right = right;
+    if (left)
+        left->parent = middle;
+    if (right)
+        right->parent = middle;
+    middle->height = tm_impl_hupdate(middle);
+    return middle;
+}
+static struct treemap_node *tm_impl_fix(struct treemap_node *node)
+{
+    int balance = tm_impl_h(node->right) - tm_impl_h(node->left);
+    if (balance >= 2)
+    {
+        struct treemap_node *child = node->right;
+        if (tm_impl_h(child->right) < tm_impl_h(child->left))
+            tm_impl_rotate_right(&(node->right));
+        tm_impl_rotate_left(&node);
+    }
+    else if (balance <= -2)
+    {
+        struct treemap_node *child = node->left;
+        if (tm_impl_h(child->left) < tm_impl_h(child->right))
+            tm_impl_rotate_left(&(node->left));
+        tm_impl_rotate_right(&node);
+    }
+    else
+        node->height = tm_impl_hupdate(node);
+    return node;
+}
 struct treemap_iter tm_iter_start(struct treemap *target)
 {
     struct treemap_iter iter;
@@ -791,6 +932,101 @@ size_t tm_iter_index(struct treemap_iter *iter)
 {
     return iter->index;
 }
+_Bool tm_insert_hint(struct treemap *_map_, struct treemap_iter *hint, size_t key, size_t value)
+{
+    if (tm_empty(_map_))
+    {
+        if (!tm_insert(_map_, key, value))
+            return 0;
+        *hint = tm_iter_start(_map_);
+        return 1;
+    }
+    struct treemap_node *cursor = hint->cursor;
+    struct treemap_node *parent = ((void *)0);
+    _Bool left = 0;
+    size_t index = hint->index;
+    int cmp = 0;
+    if (_map_->f_key->cmp(key, hint->last->key) > 0)
+    {
+        parent = hint->last;
+        index = _map_->count;
+    }
+    else if (_map_->f_key->cmp(key, hint->first->key) < 0)
+    {
+        parent = hint->first;
+        left = 1;
+        index = 0;
+    }
+    else if ((cmp = _map_->f_key->cmp(key, cursor->key)) == 0)
+    {
+        _map_->flag = CMC_FLAG_DUPLICATE;
+        return 0;
+    }
+    else if (cmp > 0)
+    {
+        struct treemap_node *next = cursor->right;
+        if (next)
+        {
+            while (next->left)
+                next = next->left;
+        }
+        else
+        {
+            next = cursor;
+            while (next->parent->right == next)
+                next = next->parent;
+            next = next->parent;
+        }
+        if (_map_->f_key->cmp(key, next->key) < 0)
+        {
+            parent = cursor->right ? next : cursor;
+            left = cursor->right != ((void *)0);
+            index = hint->index + 1;
+        }
+    }
+    else
+    {
+        struct treemap_node *prev = cursor->left;
+        if (prev)
+        {
+            while (prev->right)
+                prev = prev->right;
+        }
+        else
+        {
+            prev = cursor;
+            while (prev->parent->left == prev)
+                prev = prev->parent;
+            prev = prev->parent;
+        }
+        if (_map_->f_key->cmp(key, prev->key) > 0)
+        {
+            parent = cursor->left ? prev : cursor;
+            left = cursor->left == ((void *)0);
+            index = hint->index;
+        }
+    }
+    if (!parent)
+    {
+        if (!tm_insert(_map_, key, value))
+            return 0;
+        if (cmp < 0)
+            hint->index++;
+        return 1;
+    }
+    struct treemap_node *node = tm_impl_attach(_map_, parent, left, key, value);
+    if (!node)
+        return 0;
+    if (parent == hint->last && !left)
+        hint->last = node;
+    else if (parent == hint->first && left)
+        hint->first = node;
+    hint->cursor = node;
+    hint->index = index;
+    hint->start = 0;
+    hint->end = 0;
+    return 1;
+}
 _Bool tm_to_string(struct treemap *_map_, FILE *fptr)
 {
     struct treemap *m_ = _map_;
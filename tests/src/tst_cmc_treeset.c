@@ -8,10 +8,76 @@ static unsigned char ts_impl_hupdate(struct treeset_node *node);
 static void ts_impl_rotate_right(struct treeset_node **Z);
 static void ts_impl_rotate_left(struct treeset_node **Z);
 static void ts_impl_rebalance(struct treeset *_set_, struct treeset_node *node);
+static size_t ts_impl_free_nodes(struct treeset *_set_, struct treeset_node *scan);
+static void ts_impl_split(struct treeset *_set_, struct treeset_node *node, size_t value, _Bool after,
+                          struct treeset_node **left, struct treeset_node **right);
+static struct treeset_node *ts_impl_join(struct treeset_node *left, struct treeset_node *middle,
+                                         struct treeset_node *right);
+static struct treeset_node *ts_impl_fix(struct treeset_node *node);
+static struct treeset_node *ts_impl_attach(struct treeset *_set_, struct treeset_node *parent, _Bool left,
+                                           size_t value);
 struct treeset *ts_new(struct treeset_fval *f_val)
 {
     return ts_new_custom(f_val, ((void *)0), ((void *)0));
 }
+size_t ts_remove_range(struct treeset *_set_, size_t low, size_t high)
+{
+    if (ts_empty(_set_))
+    {
+        _set_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    if (_set_->f_val->cmp(low, high) > 0)
+    {
+        _set_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    struct treeset_node *left = ((void *)0);
+    struct treeset_node *middle = ((void *)0);
+    struct treeset_node *right = ((void *)0);
+    ts_impl_split(_set_, _set_->root, low, 0, &left, &right);
+    ts_impl_split(_set_, right, high, 1, &middle, &right);
+    if (left && right)
+    {
+        struct treeset_node *min = right;
+        while (min->left)
+            min = min->left;
+        ts_impl_split(_set_, right, min->value, 1, &min, &right);
+        _set_->root = ts_impl_join(left, min, right);
+    }
+    else
+        _set_->root = left ? left : right;
+    size_t removed = ts_impl_free_nodes(_set_, middle);
+    _set_->count -= removed;
+    _set_->flag = CMC_FLAG_OK;
+    if (removed > 0)
+    {
+        if ((_set_)->callbacks && (_set_)->callbacks->delete)
+            (_set_)->callbacks->delete ();
+        ;
+    }
+    return removed;
+}
+size_t ts_remove_below(struct treeset *_set_, size_t value)
+{
+    if (ts_empty(_set_))
+    {
+        _set_->flag = CMC_FLAG_EMPTY;
+        return 0;
+    }
+    struct treeset_node *below = ((void *)0);
+    ts_impl_split(_set_, _set_->root, value, 0, &below, &_set_->root);
+    size_t removed = ts_impl_free_nodes(_set_, below);
+    _set_->count -= removed;
+    _set_->flag = CMC_FLAG_OK;
+    if (removed > 0)
+    {
+        if ((_set_)->callbacks && (_set_)->callbacks->delete)
+            (_set_)->callbacks->delete ();
+        ;
+    }
+    return removed;
+}
 struct treeset *ts_new_custom(struct treeset_fval *f_val, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
 {
     ;
@@ -32,53 +98,7 @@ struct treeset *ts_new_custom(struct treeset_fval *f_val, struct cmc_alloc_node
 }
 void ts_clear(struct treeset *_set_)
 {
-    struct treeset_node *scan = _set_->root;
-    struct treeset_node *up = ((void *)0);
-    while (scan != ((void *)0))
-    {
-        if (scan->left != ((void *)0))
-        {
-            struct treeset_node *left = scan->left;
-            scan->left = up;
-            up = scan;
-            scan = left;
-        }
-        else if (scan->right != ((void *)0))
-        {
-            struct treeset_node *right = scan->right;
-            scan->left = up;
-            scan->right = ((void *)0);
-            up = scan;
-            scan = right;
-        }
-        else
-        {
-            if (up == ((void *)0))
-            {
-                if (_set_->f_val->free)
-                    _set_->f_val->free(scan->value);
-                _set_->alloc->free(scan);
-                scan = ((void *)0);
-            }
-            while (up != ((void *)0))
-            {
-                if (_set_->f_val->free)
-                    _set_->f_val->free(scan->value);
-                _set_->alloc->free(scan);
-                if (up->right != ((void *)0))
-                {
-                    scan = up->right;
-                    up->right = ((void *)0);
-                    break;
-                }
-                else
-                {
-                    scan = up;
-                    up = up->left;
-                }
-            }
-        }
-    }
+    ts_impl_free_nodes(_set_, _set_->root);
     _set_->count = 0;
     _set_->root = ((void *)0);
     _set_->flag = CMC_FLAG_OK;
@@ -101,62 +121,25 @@ void ts_customize(struct treeset *_set_, struct cmc_alloc_node *alloc, struct cm
 _Bool ts_insert(struct treeset *_set_, size_t value)
 {
     if (ts_empty(_set_))
+        return ts_impl_attach(_set_, ((void *)0), 0, value) != ((void *)0);
+    struct treeset_node *scan = _set_->root;
+    struct treeset_node *parent = scan;
+    int cmp = 0;
+    while (scan != ((void *)0))
     {
-        _set_->root = ts_impl_new_node(_set_, value);
-        if (!_set_->root)
-        {
-            _set_->flag = CMC_FLAG_ALLOC;
-            return 0;
-        }
-    }
-    else
-    {
-        struct treeset_node *scan = _set_->root;
-        struct treeset_node *parent = scan;
-        while (scan != ((void *)0))
-        {
-            parent = scan;
-            if (_set_->f_val->cmp(scan->value, value) > 0)
-                scan = scan->left;
-            else if (_set_->f_val->cmp(scan->value, value) < 0)
-                scan = scan->right;
-            else
-            {
-                _set_->flag = CMC_FLAG_DUPLICATE;
-                return 0;
-            }
-        }
-        struct treeset_node *node;
-        if (_set_->f_val->cmp(parent->value, value) > 0)
-        {
-            parent->left = ts_impl_new_node(_set_, value);
-            if (!parent->left)
-            {
-                _set_->flag = CMC_FLAG_ALLOC;
-                return 0;
-            }
-            parent->left->parent = parent;
-            node = parent->left;
-        }
+        parent = scan;
+        cmp = _set_->f_val->cmp(scan->value, value);
+        if (cmp > 0)
+            scan = scan->left;
+        else if (cmp < 0)
+            scan = scan->right;
         else
         {
-            parent->right = ts_impl_new_node(_set_, value);
-            if (!parent->right)
-            {
-                _set_->flag = CMC_FLAG_ALLOC;
-                return 0;
-            }
-            parent->right->parent = parent;
-            node = parent->right;
+            _set_->flag = CMC_FLAG_DUPLICATE;
+            return 0;
         }
-        ts_impl_rebalance(_set_, node);
     }
-    _set_->count++;
-    _set_->flag = CMC_FLAG_OK;
-    if ((_set_)->callbacks && (_set_)->callbacks->create)
-        (_set_)->callbacks->create();
-    ;
-    return 1;
+    return ts_impl_attach(_set_, parent, cmp > 0, value) != ((void *)0);
 }
 _Bool ts_remove(struct treeset *_set_, size_t value)
 {
@@ -377,9 +360,10 @@ static struct treeset_node *ts_impl_get_node(struct treeset *_set_, size_t value
     struct treeset_node *scan = _set_->root;
     while (scan != ((void *)0))
     {
-        if (_set_->f_val->cmp(scan->value, value) > 0)
+        int cmp = _set_->f_val->cmp(scan->value, value);
+        if (cmp > 0)
             scan = scan->left;
-        else if (_set_->f_val->cmp(scan->value, value) < 0)
+        else if (cmp < 0)
             scan = scan->right;
         else
             return scan;
@@ -449,6 +433,7 @@ static void ts_impl_rebalance(struct treeset *_set_, struct treeset_node *node)
     _Bool is_root = 0;
     while (scan != ((void *)0))
     {
+        unsigned char height = scan->height;
         if (scan->parent == ((void *)0))
             is_root = 1;
         scan->height = ts_impl_hupdate(scan);
@@ -472,9 +457,164 @@ static void ts_impl_rebalance(struct treeset *_set_, struct treeset_node *node)
             _set_->root = scan;
             is_root = 0;
         }
+        if (scan->height == height)
+            break;
         scan = scan->parent;
     }
 }
+static struct treeset_node *ts_impl_attach(struct treeset *_set_, struct treeset_node *parent, _Bool left, size_t value)
+{
+    struct treeset_node *node = ts_impl_new_node(_set_, value);
+    if (!node)
+    {
+        _set_->flag = CMC_FLAG_ALLOC;
+        return ((void *)0);
+    }
+    node->parent = parent;
+    if (!parent)
+        _set_->root = node;
+    else if (left)
+        parent->left = node;
+    else
+        parent->right = node;
+    ts_impl_rebalance(_set_, node);
+    _set_->count++;
+    _set_->flag = CMC_FLAG_OK;
+    if ((_set_)->callbacks && (_set_)->callbacks->create)
+        (_set_)->callbacks->create();
+    ;
+    return node;
+}
+static size_t ts_impl_free_nodes(struct treeset *_set_, struct treeset_node *scan)
+{
+    size_t count = 0;
+    struct treeset_node *up = ((void *)0);
+    while (scan != ((void *)0))
+    {
+        if (scan->left != ((void *)0))
+        {
+            struct treeset_node *left = scan->left;
+            scan->left = up;
+            up = scan;
+            scan = left;
+        }
+        else if (scan->right != ((void *)0))
+        {
+            struct treeset_node *right = scan->right;
+            scan->left = up;
+            scan->right = ((void *)0);
+            up = scan;
+            scan = right;
+        }
+        else
+        {
+            if (up == ((void *)0))
+            {
+                if (_set_->f_val->free)
+                    _set_->f_val->free(scan->value);
+                _set_->alloc->free(scan);
+                count++;
+                scan = ((void *)0);
+            }
+            while (up != ((void *)0))
+            {
+                if (_set_->f_val->free)
+                    _set_->f_val->free(scan->value);
+                _set_->alloc->free(scan);
+                count++;
+                if (up->right != ((void *)0))
+                {
+                    scan = up->right;
+                    up->right = ((void *)0);
+                    break;
+                }
+                else
+                {
+                    scan = up;
+                    up = up->left;
+                }
+            }
+        }
+    }
+    return count;
+}
+static void ts_impl_split(struct treeset *_set_, struct treeset_node *node, size_t value, _Bool after,
+                          struct treeset_node **left, struct treeset_node **right)
+{
+    if (!node)
+    {
+        *left = ((void *)0);
+        *right = ((void *)0);
+        return;
+    }
+    struct treeset_node *l = node->left;
+    struct treeset_node *r = node->right;
+    if (l)
+        l->parent = ((void *)0);
+    if (r)
+        r->parent = ((void *)0);
+    int cmp = _set_->f_val->cmp(node->value, value);
+    if (cmp < 0 || (after && cmp == 0))
+    {
+        ts_impl_split(_set_, r, value, after, left, right);
+        *left = ts_impl_join(l, node, *left);
+    }
+    else
+    {
+        ts_impl_split(_set_, l, value, after, left, right);
+        *right = ts_impl_join(*right, node, r);
+    }
+}
+static struct treeset_node *ts_impl_join(struct treeset_node *left, struct treeset_node *middle,
+                                         struct treeset_node *right)
+{
+    unsigned char h_l = ts_impl_h(left);
+    unsigned char h_r = ts_impl_h(right);
+    if (h_l > h_r + 1)
+    {
+        struct treeset_node *sub = ts_impl_join(left->right, middle, right);
+        left->right = sub;
+        sub->parent = left;
+        return ts_impl_fix(left);
+    }
+    else if (h_r > h_l + 1)
+    {
+        struct treeset_node *sub = ts_impl_join(left, middle, right->left);
+        right->left = sub;
+        sub->parent = right;
+        return ts_impl_fix(right);
+    }
+    middle->parent = ((void *)0);
+    middle->left = left;
+    middle->right = right;
+    if (left)
+        left->parent = middle;
+    if (right)
+        right->parent = middle;
+    middle->height = ts_impl_hupdate(middle);
+    return middle;
+}
+static struct treeset_node *ts_impl_fix(struct treeset_node *node)
+{
+    int balance = ts_impl_h(node->right) - ts_impl_h(node->left);
+    if (balance >= 2)
+    {
+        struct treeset_node *child = node->right;
+        if (ts_impl_h(child->right) < ts_impl_h(child->left))
+            ts_impl_rotate_right(&(node->right));
+        ts_impl_rotate_left(&node);
+    }
+    else if (balance <= -2)
+    {
+        struct treeset_node *child = node->left;
+        if (ts_impl_h(child->left) < ts_impl_h(child->right))
+            ts_impl_rotate_left(&(node->left));
+        ts_impl_rotate_right(&node);
+    }
+    else
+        node->height = ts_impl_hupdate(node);
+    return node;
+}
 struct treeset_iter ts_iter_start(struct treeset *target)
 {
     struct treeset_iter iter;
@@ -658,6 +798,101 @@ size_t ts_iter_index(struct treeset_iter *iter)
 {
     return iter->index;
 }
+_Bool ts_insert_hint(struct treeset *_set_, struct treeset_iter *hint, size_t value)
+{
+    if (ts_empty(_set_))
+    {
+        if (!ts_insert(_set_, value))
+            return 0;
+        *hint = ts_iter_start(_set_);
+        return 1;
+    }
+    struct treeset_node *cursor = hint->cursor;
+    struct treeset_node *parent = ((void *)0);
+    _Bool left = 0;
+    size_t index = hint->index;
+    int cmp = 0;
+    if (_set_->f_val->cmp(value, hint->last->value) > 0)
+    {
+        parent = hint->last;
+        index = _set_->count;
+    }
+    else if (_set_->f_val->cmp(value, hint->first->value) < 0)
+    {
+        parent = hint->first;
+        left = 1;
+        index = 0;
+    }
+    else if ((cmp = _set_->f_val->cmp(value, cursor->value)) == 0)
+    {
+        _set_->flag = CMC_FLAG_DUPLICATE;
+        return 0;
+    }
+    else if (cmp > 0)
+    {
+        struct treeset_node *next = cursor->right;
+        if (next)
+        {
+            while (next->left)
+                next = next->left;
+        }
+        else
+        {
+            next = cursor;
+            while (next->parent->right == next)
+                next = next->parent;
+            next = next->parent;
+        }
+        if (_set_->f_val->cmp(value, next->value) < 0)
+        {
+            parent = cursor->right ? next : cursor;
+            left = cursor->right != ((void *)0);
+            index = hint->index + 1;
+        }
+    }
+    else
+    {
+        struct treeset_node *prev = cursor->left;
+        if (prev)
+        {
+            while (prev->right)
+                prev = prev->right;
+        }
+        else
+        {
+            prev = cursor;
+            while (prev->parent->left == prev)
+                prev = prev->parent;
+            prev = prev->parent;
+        }
+        if (_set_->f_val->cmp(value, prev->value) > 0)
+        {
+            parent = cursor->left ? prev : cursor;
+            left = cursor->left == ((void *)0);
+            index = hint->index;
+        }
+    }
+    if (!parent)
+    {
+        if (!ts_insert(_set_, value))
+            return 0;
+        if (cmp < 0)
+            hint->index++;
+        return 1;
+    }
+    struct treeset_node *node = ts_impl_attach(_set_, parent, left, value);
+    if (!node)
+        return 0;
+    if (parent == hint->last && !left)
+        hint->last = node;
+    else if (parent == hint->first && left)
+        hint->first = node;
+    hint->cursor = node;
+    hint->index = index;
+    hint->start = 0;
+    hint->end = 0;
+    return 1;
+}
 struct treeset *ts_union(struct treeset *_set1_, struct treeset *_set2_)
 {
     struct treeset *_set_r_ = ts_new_custom(_set1_->f_val, _set1_->alloc, ((void *)0));
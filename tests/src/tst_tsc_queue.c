@@ -0,0 +1,335 @@
+
+#include "tst_tsc_queue.h"
+
+static _Bool tq_impl_enqueue(struct tsc_queue *_queue_, size_t value, _Bool block, size_t *timeout);
+static size_t tq_impl_dequeue(struct tsc_queue *_queue_, size_t *values, size_t max, _Bool block, size_t *timeout);
+static _Bool tq_impl_wait(struct tsc_queue *_queue_, struct cmc_condvar *cnd, size_t *waiters, size_t *deadline);
+struct tsc_queue *tq_new(size_t capacity, struct tsc_queue_fval *f_val)
+{
+    return tq_new_custom(capacity, f_val, ((void *)0), ((void *)0));
+}
+struct tsc_queue *tq_new_custom(size_t capacity, struct tsc_queue_fval *f_val, struct cmc_alloc_node *alloc,
+                                struct cmc_callbacks *callbacks)
+{
+    ;
+    if (capacity < 1)
+        return ((void *)0);
+    if (!f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct tsc_queue *_queue_ = alloc->malloc(sizeof(struct tsc_queue));
+    if (!_queue_)
+        return ((void *)0);
+    _queue_->buffer = alloc->calloc(capacity, sizeof(size_t));
+    if (!_queue_->buffer)
+    {
+        alloc->free(_queue_);
+        return ((void *)0);
+    }
+    if (!cmc_mtx_init(&_queue_->mutex))
+        goto mutex_error;
+    if (!cmc_cnd_init(&_queue_->not_empty))
+        goto not_empty_error;
+    if (!cmc_cnd_init(&_queue_->not_full))
+        goto not_full_error;
+    _queue_->capacity = capacity;
+    _queue_->count = 0;
+    _queue_->front = 0;
+    _queue_->back = 0;
+    _queue_->consumers = 0;
+    _queue_->producers = 0;
+    _queue_->flag = CMC_FLAG_OK;
+    _queue_->f_val = f_val;
+    _queue_->alloc = alloc;
+    (_queue_)->callbacks = callbacks;
+    return _queue_;
+not_full_error:
+    cmc_cnd_destroy(&_queue_->not_empty);
+not_empty_error:
+    cmc_mtx_destroy(&_queue_->mutex);
+mutex_error:
+    alloc->free(_queue_->buffer);
+    alloc->free(_queue_);
+    return ((void *)0);
+}
+_Bool tq_clear(struct tsc_queue *_queue_)
+{
+    if (!cmc_mtx_lock(&_queue_->mutex))
+    {
+        _queue_->flag = CMC_FLAG_MUTEX;
+        return 0;
+    }
+    if (_queue_->f_val->free)
+    {
+        for (size_t i = _queue_->front, j = 0; j < _queue_->count; j++)
+        {
+            _queue_->f_val->free(_queue_->buffer[i]);
+            i = (i + 1) % _queue_->capacity;
+        }
+    }
+    memset(_queue_->buffer, 0, sizeof(size_t) * _queue_->capacity);
+    _queue_->count = 0;
+    _queue_->front = 0;
+    _queue_->back = 0;
+    _queue_->flag = CMC_FLAG_OK;
+    if (_queue_->producers > 0)
+        cmc_cnd_broadcast(&_queue_->not_full);
+    cmc_mtx_unlock(&_queue_->mutex);
+    return 1;
+}
+void tq_free(struct tsc_queue *_queue_)
+{
+    if (_queue_->f_val->free)
+    {
+        for (size_t i = _queue_->front, j = 0; j < _queue_->count; j++)
+        {
+            _queue_->f_val->free(_queue_->buffer[i]);
+            i = (i + 1) % _queue_->capacity;
+        }
+    }
+    cmc_cnd_destroy(&_queue_->not_full);
+    cmc_cnd_destroy(&_queue_->not_empty);
+    cmc_mtx_destroy(&_queue_->mutex);
+    _queue_->alloc->free(_queue_->buffer);
+    _queue_->alloc->free(_queue_);
+}
+void tq_customize(struct tsc_queue *_queue_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _queue_->alloc = &cmc_alloc_node_default;
+    else
+        _queue_->alloc = alloc;
+    (_queue_)->callbacks = callbacks;
+    _queue_->flag = CMC_FLAG_OK;
+}
+_Bool tq_enqueue(struct tsc_queue *_queue_, size_t value)
+{
+    return tq_impl_enqueue(_queue_, value, 0, ((void *)0));
+}
+_Bool tq_enqueue_wait(struct tsc_queue *_queue_, size_t value)
+{
+    return tq_impl_enqueue(_queue_, value, 1, ((void *)0));
+}
+_Bool tq_enqueue_timed(struct tsc_queue *_queue_, size_t value, size_t timeout)
+{
+    return tq_impl_enqueue(_queue_, value, 1, &timeout);
+}
+_Bool tq_dequeue(struct tsc_queue *_queue_, size_t *value)
+{
+    return tq_impl_dequeue(_queue_, value, 1, 0, ((void *)0)) == 1;
+}
+_Bool tq_dequeue_wait(struct tsc_queue *_queue_, size_t *value)
+{
+    return tq_impl_dequeue(_queue_, value, 1, 1, ((void *)0)) == 1;
+}
+_Bool tq_dequeue_timed(struct tsc_queue *_queue_, size_t *value, size_t timeout)
+{
+    return tq_impl_dequeue(_queue_, value, 1, 1, &timeout) == 1;
+}
+size_t tq_dequeue_many(struct tsc_queue *_queue_, size_t *values, size_t max)
+{
+    return tq_impl_dequeue(_queue_, values, max, 0, ((void *)0));
+}
+size_t tq_dequeue_wait_many(struct tsc_queue *_queue_, size_t *values, size_t max)
+{
+    return tq_impl_dequeue(_queue_, values, max, 1, ((void *)0));
+}
+size_t tq_dequeue_timed_many(struct tsc_queue *_queue_, size_t *values, size_t max, size_t timeout)
+{
+    return tq_impl_dequeue(_queue_, values, max, 1, &timeout);
+}
+_Bool tq_empty(struct tsc_queue *_queue_)
+{
+    return tq_count(_queue_) == 0;
+}
+_Bool tq_full(struct tsc_queue *_queue_)
+{
+    return tq_count(_queue_) >= _queue_->capacity;
+}
+size_t tq_count(struct tsc_queue *_queue_)
+{
+    if (!cmc_mtx_lock(&_queue_->mutex))
+    {
+        _queue_->flag = CMC_FLAG_MUTEX;
+        return 0;
+    }
+    size_t count = _queue_->count;
+    cmc_mtx_unlock(&_queue_->mutex);
+    return count;
+}
+size_t tq_capacity(struct tsc_queue *_queue_)
+{
+    return _queue_->capacity;
+}
+int tq_flag(struct tsc_queue *_queue_)
+{
+    return _queue_->flag;
+}
+static _Bool tq_impl_enqueue(struct tsc_queue *_queue_, size_t value, _Bool block, size_t *timeout)
+{
+    if (!cmc_mtx_lock(&_queue_->mutex))
+    {
+        _queue_->flag = CMC_FLAG_MUTEX;
+        return 0;
+    }
+    size_t deadline = timeout ? cmc_cnd_deadline(*timeout) : 0;
+    while (_queue_->count >= _queue_->capacity)
+    {
+        if (!block)
+        {
+            _queue_->flag = CMC_FLAG_FULL;
+            cmc_mtx_unlock(&_queue_->mutex);
+            return 0;
+        }
+        if (!tq_impl_wait(_queue_, &_queue_->not_full, &_queue_->producers, timeout ? &deadline : ((void *)0)))
+        {
+            if (_queue_->flag == CMC_FLAG_OK)
+                _queue_->flag = CMC_FLAG_FULL;
+            cmc_mtx_unlock(&_queue_->mutex);
+            return 0;
+        }
+    }
+    _queue_->buffer[_queue_->back] = value;
+    _queue_->back = (_queue_->back == _queue_->capacity - 1) ? 0 : _queue_->back + 1;
+    _queue_->count++;
+    _queue_->flag = CMC_FLAG_OK;
+    if (_queue_->consumers > 0)
+        cmc_cnd_signal(&_queue_->not_empty);
+    cmc_mtx_unlock(&_queue_->mutex);
+    if ((_queue_)->callbacks && (_queue_)->callbacks->create)
+        (_queue_)->callbacks->create();
+    ;
+    return 1;
+}
+static size_t tq_impl_dequeue(struct tsc_queue *_queue_, size_t *values, size_t max, _Bool block, size_t *timeout)
+{
+    if (!values || max == 0)
+    {
+        _queue_->flag = CMC_FLAG_INVALID;
+        return 0;
+    }
+    if (!cmc_mtx_lock(&_queue_->mutex))
+    {
+        _queue_->flag = CMC_FLAG_MUTEX;
+        return 0;
+    }
+    size_t deadline = timeout ? cmc_cnd_deadline(*timeout) : 0;
+    while (_queue_->count == 0)
+    {
+        if (!block)
+        {
+            _queue_->flag = CMC_FLAG_EMPTY;
+            cmc_mtx_unlock(&_queue_->mutex);
+            return 0;
+        }
+        if (!tq_impl_wait(_queue_, &_queue_->not_empty, &_queue_->consumers, timeout ? &deadline : ((void *)0)))
+        {
+            if (_queue_->flag == CMC_FLAG_OK)
+                _queue_->flag = CMC_FLAG_EMPTY;
+            cmc_mtx_unlock(&_queue_->mutex);
+            return 0;
+        }
+    }
+    size_t total = max < _queue_->count ? max : _queue_->count;
+    size_t first = _queue_->capacity - _queue_->front;
+    if (first > total)
+        first = total;
+    memcpy(values, _queue_->buffer + _queue_->front, sizeof(size_t) * first);
+    memcpy(values + first, _queue_->buffer, sizeof(size_t) * (total - first));
+    _queue_->front = (_queue_->front + total) % _queue_->capacity;
+    _queue_->count -= total;
+    _queue_->flag = CMC_FLAG_OK;
+    if (_queue_->producers > 0)
+    {
+        if (total == 1)
+            cmc_cnd_signal(&_queue_->not_full);
+        else
+            cmc_cnd_broadcast(&_queue_->not_full);
+    }
+    cmc_mtx_unlock(&_queue_->mutex);
+    if ((_queue_)->callbacks && (_queue_)->callbacks->delete)
+        (_queue_)->callbacks->delete ();
+    ;
+    return total;
+}
+static _Bool tq_impl_wait(struct tsc_queue *_queue_, struct cmc_condvar *cnd, size_t *waiters, size_t *deadline)
+{
+    _Bool woken;
+    size_t remaining = 0;
+    if (deadline)
+    {
+        remaining = cmc_cnd_remaining(*deadline);
+        if (remaining == 0)
+        {
+            _queue_->flag = CMC_FLAG_OK;
+            return 0;
+        }
+    }
+    *waiters += 1;
+    if (deadline)
+        woken = cmc_cnd_timedwait(cnd, &_queue_->mutex, remaining);
+    else
+        woken = cmc_cnd_wait(cnd, &_queue_->mutex);
+    *waiters -= 1;
+    _queue_->flag = cnd->flag;
+    return woken;
+}
+_Bool tq_to_string(struct tsc_queue *_queue_, FILE *fptr)
+{
+    struct tsc_queue *q_ = _queue_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "buffer:%p, "
+                        "capacity:%"
+                        "I64u"
+                        ", "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "front:%"
+                        "I64u"
+                        ", "
+                        "back:%"
+                        "I64u"
+                        ", "
+                        "consumers:%"
+                        "I64u"
+                        ", "
+                        "producers:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks:%p }",
+                        "tsc_queue", "size_t", q_, q_->buffer, q_->capacity, q_->count, q_->front, q_->back,
+                        q_->consumers, q_->producers, q_->flag, q_->f_val, q_->alloc, (q_)->callbacks);
+}
+_Bool tq_print(struct tsc_queue *_queue_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    if (!cmc_mtx_lock(&_queue_->mutex))
+    {
+        _queue_->flag = CMC_FLAG_MUTEX;
+        return 0;
+    }
+    _Bool result = 1;
+    fprintf(fptr, "%s", start);
+    for (size_t i = _queue_->front, j = 0; j < _queue_->count; j++)
+    {
+        if (!_queue_->f_val->str(fptr, _queue_->buffer[i]))
+        {
+            result = 0;
+            break;
+        }
+        i = (i + 1) % _queue_->capacity;
+        if (j + 1 < _queue_->count)
+            fprintf(fptr, "%s", separator);
+    }
+    if (result)
+        fprintf(fptr, "%s", end);
+    cmc_mtx_unlock(&_queue_->mutex);
+    return result;
+}
@@ -0,0 +1,352 @@
+
+#include "tst_tsc_stack.h"
+
+static uint32_t tsk_impl_pop(struct tsc_stack *_stack_, _Atomic(uint64_t) * head);
+static void tsk_impl_push(struct tsc_stack *_stack_, _Atomic(uint64_t) * head, uint32_t first, uint32_t last);
+struct tsc_stack *tsk_new(size_t capacity, struct tsc_stack_fval *f_val)
+{
+    return tsk_new_custom(capacity, f_val, ((void *)0), ((void *)0));
+}
+struct tsc_stack *tsk_new_custom(size_t capacity, struct tsc_stack_fval *f_val, struct cmc_alloc_node *alloc,
+                                 struct cmc_callbacks *callbacks)
+{
+    ;
+    if (capacity < 1 || capacity >= (4294967295U))
+        return ((void *)0);
+    if (!f_val)
+        return ((void *)0);
+    if (!alloc)
+        alloc = &cmc_alloc_node_default;
+    struct tsc_stack *_stack_ = alloc->malloc(sizeof(struct tsc_stack));
+    if (!_stack_)
+        return ((void *)0);
+    _stack_->buffer = alloc->calloc(capacity, sizeof(struct tsc_stack_node));
+    if (!_stack_->buffer)
+    {
+        alloc->free(_stack_);
+        return ((void *)0);
+    }
+    for (size_t i = 0; i < capacity; i++)
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->buffer[i].next); __typeof__((void)0,
+                                                                                                *__atomic_store_ptr) __atomic_store_tmp = (i + 1 < capacity ? (uint32_t)(i + 1) : (4294967295U)); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                                                                 &__atomic_store_tmp,
+                                                                                                                                                                                                                 (0)); });
+    _stack_->capacity = capacity;
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->count); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (0); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                          &__atomic_store_tmp,
+                                                                                                                                                          (0)); });
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->head); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = ((4294967295U)); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                     &__atomic_store_tmp,
+                                                                                                                                                                     (0)); });
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->free); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (0); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                         &__atomic_store_tmp,
+                                                                                                                                                         (0)); });
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                   &__atomic_store_tmp,
+                                                                                                                                                                   (0)); });
+    _stack_->f_val = f_val;
+    _stack_->alloc = alloc;
+    (_stack_)->callbacks = callbacks;
+    return _stack_;
+}
+void tsk_free(struct tsc_stack *_stack_)
+{
+    if (_stack_->f_val->free)
+    {
+        uint32_t index = (uint32_t)__extension__({ __auto_type __atomic_load_ptr = (&_stack_->head); __typeof__((void)0,
+                                                                                                                *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                                     &__atomic_load_tmp,
+                                                                                                                                                                     (5)); __atomic_load_tmp; });
+        while (index != (4294967295U))
+        {
+            _stack_->f_val->free(_stack_->buffer[index].value);
+            index = __extension__({ __auto_type __atomic_load_ptr = (&_stack_->buffer[index].next); __typeof__((void)0,
+                                                                                                               *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                                    &__atomic_load_tmp,
+                                                                                                                                                                    (5)); __atomic_load_tmp; });
+        }
+    }
+    _stack_->alloc->free(_stack_->buffer);
+    _stack_->alloc->free(_stack_);
+}
+void tsk_customize(struct tsc_stack *_stack_, struct cmc_alloc_node *alloc, struct cmc_callbacks *callbacks)
+{
+    ;
+    if (!alloc)
+        _stack_->alloc = &cmc_alloc_node_default;
+    else
+        _stack_->alloc = alloc;
+    (_stack_)->callbacks = callbacks;
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                   &__atomic_store_tmp,
+                                                                                                                                                                   (memory_order_relaxed)); });
+}
+_Bool tsk_push(struct tsc_stack *_stack_, size_t value)
+{
+    uint32_t index = tsk_impl_pop(_stack_, &_stack_->free);
+    if (index == (4294967295U))
+    {
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_FULL); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                         &__atomic_store_tmp,
+                                                                                                                                                                         (memory_order_relaxed)); });
+        return 0;
+    }
+    _stack_->buffer[index].value = value;
+    __atomic_fetch_add((&_stack_->count), (1), (memory_order_relaxed));
+    tsk_impl_push(_stack_, &_stack_->head, index, index);
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                   &__atomic_store_tmp,
+                                                                                                                                                                   (memory_order_relaxed)); });
+    if ((_stack_)->callbacks && (_stack_)->callbacks->create)
+        (_stack_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool tsk_push_many(struct tsc_stack *_stack_, size_t *values, size_t count)
+{
+    if (count == 0)
+    {
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                       &__atomic_store_tmp,
+                                                                                                                                                                       (memory_order_relaxed)); });
+        return 1;
+    }
+    if (count > _stack_->capacity)
+    {
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_FULL); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                         &__atomic_store_tmp,
+                                                                                                                                                                         (memory_order_relaxed)); });
+        return 0;
+    }
+    uint32_t first = (4294967295U);
+    uint32_t last = (4294967295U);
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t index = tsk_impl_pop(_stack_, &_stack_->free);
+        if (index == (4294967295U))
+        {
+            if (first != (4294967295U))
+                tsk_impl_push(_stack_, &_stack_->free, first, last);
+            __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_FULL); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                             &__atomic_store_tmp,
+                                                                                                                                                                             (memory_order_relaxed)); });
+            return 0;
+        }
+        _stack_->buffer[index].value = values[i];
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->buffer[index].next); __typeof__((void)0,
+                                                                                                    *__atomic_store_ptr) __atomic_store_tmp = (first); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                      &__atomic_store_tmp,
+                                                                                                                                                                      (memory_order_relaxed)); });
+        if (first == (4294967295U))
+            last = index;
+        first = index;
+    }
+    __atomic_fetch_add((&_stack_->count), (count), (memory_order_relaxed));
+    tsk_impl_push(_stack_, &_stack_->head, first, last);
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                   &__atomic_store_tmp,
+                                                                                                                                                                   (memory_order_relaxed)); });
+    if ((_stack_)->callbacks && (_stack_)->callbacks->create)
+        (_stack_)->callbacks->create();
+    ;
+    return 1;
+}
+_Bool tsk_pop(struct tsc_stack *_stack_, size_t *value)
+{
+    uint32_t index = tsk_impl_pop(_stack_, &_stack_->head);
+    if (index == (4294967295U))
+    {
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_EMPTY); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                          &__atomic_store_tmp,
+                                                                                                                                                                          (memory_order_relaxed)); });
+        return 0;
+    }
+    __atomic_fetch_sub((&_stack_->count), (1), (memory_order_relaxed));
+    if (value)
+        *value = _stack_->buffer[index].value;
+    tsk_impl_push(_stack_, &_stack_->free, index, index);
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                   &__atomic_store_tmp,
+                                                                                                                                                                   (memory_order_relaxed)); });
+    if ((_stack_)->callbacks && (_stack_)->callbacks->delete)
+        (_stack_)->callbacks->delete ();
+    ;
+    return 1;
+}
+_Bool tsk_empty(struct tsc_stack *_stack_)
+{
+    return (uint32_t)__extension__({ __auto_type __atomic_load_ptr = (&_stack_->head); __typeof__((void)0,
+                                                                                                  *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                       &__atomic_load_tmp,
+                                                                                                                                                       (memory_order_relaxed)); __atomic_load_tmp; }) == (4294967295U);
+}
+_Bool tsk_full(struct tsc_stack *_stack_)
+{
+    return (uint32_t)__extension__({ __auto_type __atomic_load_ptr = (&_stack_->free); __typeof__((void)0,
+                                                                                                  *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                       &__atomic_load_tmp,
+                                                                                                                                                       (memory_order_relaxed)); __atomic_load_tmp; }) == (4294967295U);
+}
+size_t tsk_count(struct tsc_stack *_stack_)
+{
+    return __extension__({ __auto_type __atomic_load_ptr = (&_stack_->count); __typeof__((void)0, *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                       &__atomic_load_tmp,
+                                                                                                                                                       (memory_order_relaxed)); __atomic_load_tmp; });
+}
+size_t tsk_capacity(struct tsc_stack *_stack_)
+{
+    return _stack_->capacity;
+}
+int tsk_flag(struct tsc_stack *_stack_)
+{
+    return __extension__({ __auto_type __atomic_load_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                      &__atomic_load_tmp,
+                                                                                                                                                      (memory_order_relaxed)); __atomic_load_tmp; });
+}
+static uint32_t tsk_impl_pop(struct tsc_stack *_stack_, _Atomic(uint64_t) * head)
+{
+    uint64_t old_head = __extension__({ __auto_type __atomic_load_ptr = (head); __typeof__((void)0, *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                         &__atomic_load_tmp,
+                                                                                                                                                         (memory_order_acquire)); __atomic_load_tmp; });
+    uint64_t new_head;
+    uint32_t index;
+    do
+    {
+        index = (uint32_t)old_head;
+        if (index == (4294967295U))
+            return (4294967295U);
+        uint32_t next = __extension__({ __auto_type __atomic_load_ptr = (&_stack_->buffer[index].next); __typeof__((void)0,
+                                                                                                                   *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                                        &__atomic_load_tmp,
+                                                                                                                                                                        (memory_order_relaxed)); __atomic_load_tmp; });
+        new_head = (((old_head >> 32) + 1) << 32) | next;
+    } while (!__extension__({ __auto_type __atomic_compare_exchange_ptr = (head); __typeof__((void)0, *__atomic_compare_exchange_ptr) __atomic_compare_exchange_tmp = (new_head); __atomic_compare_exchange(__atomic_compare_exchange_ptr, (&old_head), &__atomic_compare_exchange_tmp, 1, (memory_order_acq_rel), (memory_order_acquire)); }));
+    return index;
+}
+static void tsk_impl_push(struct tsc_stack *_stack_, _Atomic(uint64_t) * head, uint32_t first, uint32_t last)
+{
+    uint64_t old_head = __extension__({ __auto_type __atomic_load_ptr = (head); __typeof__((void)0, *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                         &__atomic_load_tmp,
+                                                                                                                                                         (memory_order_relaxed)); __atomic_load_tmp; });
+    uint64_t new_head;
+    do
+    {
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->buffer[last].next); __typeof__((void)0,
+                                                                                                   *__atomic_store_ptr) __atomic_store_tmp = ((uint32_t)old_head); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                                  &__atomic_store_tmp,
+                                                                                                                                                                                  (memory_order_relaxed)); });
+        new_head = (((old_head >> 32) + 1) << 32) | first;
+    } while (!__extension__({ __auto_type __atomic_compare_exchange_ptr = (head); __typeof__((void)0, *__atomic_compare_exchange_ptr) __atomic_compare_exchange_tmp = (new_head); __atomic_compare_exchange(__atomic_compare_exchange_ptr, (&old_head), &__atomic_compare_exchange_tmp, 1, (memory_order_release), (memory_order_relaxed)); }));
+}
+struct tsc_stack_node *tsk_new_node(struct tsc_stack *_stack_, size_t value)
+{
+    uint32_t index = tsk_impl_pop(_stack_, &_stack_->free);
+    if (index == (4294967295U))
+    {
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_FULL); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                         &__atomic_store_tmp,
+                                                                                                                                                                         (memory_order_relaxed)); });
+        return ((void *)0);
+    }
+    struct tsc_stack_node *_node_ = &(_stack_->buffer[index]);
+    _node_->value = value;
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                   &__atomic_store_tmp,
+                                                                                                                                                                   (memory_order_relaxed)); });
+    return _node_;
+}
+void tsk_free_node(struct tsc_stack *_stack_, struct tsc_stack_node *_node_)
+{
+    if (_node_ < _stack_->buffer || _node_ >= _stack_->buffer + _stack_->capacity)
+    {
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_INVALID); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                            &__atomic_store_tmp,
+                                                                                                                                                                            (memory_order_relaxed)); });
+        return;
+    }
+    uint32_t index = (uint32_t)(_node_ - _stack_->buffer);
+    tsk_impl_push(_stack_, &_stack_->free, index, index);
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                   &__atomic_store_tmp,
+                                                                                                                                                                   (memory_order_relaxed)); });
+}
+_Bool tsk_push_node(struct tsc_stack *_stack_, struct tsc_stack_node *_node_)
+{
+    if (_node_ < _stack_->buffer || _node_ >= _stack_->buffer + _stack_->capacity)
+    {
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_INVALID); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                            &__atomic_store_tmp,
+                                                                                                                                                                            (memory_order_relaxed)); });
+        return 0;
+    }
+    uint32_t index = (uint32_t)(_node_ - _stack_->buffer);
+    __atomic_fetch_add((&_stack_->count), (1), (memory_order_relaxed));
+    tsk_impl_push(_stack_, &_stack_->head, index, index);
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                   &__atomic_store_tmp,
+                                                                                                                                                                   (memory_order_relaxed)); });
+    if ((_stack_)->callbacks && (_stack_)->callbacks->create)
+        (_stack_)->callbacks->create();
+    ;
+    return 1;
+}
+struct tsc_stack_node *tsk_pop_node(struct tsc_stack *_stack_)
+{
+    uint32_t index = tsk_impl_pop(_stack_, &_stack_->head);
+    if (index == (4294967295U))
+    {
+        __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_EMPTY); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                          &__atomic_store_tmp,
+                                                                                                                                                                          (memory_order_relaxed)); });
+        return ((void *)0);
+    }
+    __atomic_fetch_sub((&_stack_->count), (1), (memory_order_relaxed));
+    __extension__({ __auto_type __atomic_store_ptr = (&_stack_->flag); __typeof__((void)0, *__atomic_store_ptr) __atomic_store_tmp = (CMC_FLAG_OK); __atomic_store(__atomic_store_ptr,
+                                                                                                                                                                   &__atomic_store_tmp,
+                                                                                                                                                                   (memory_order_relaxed)); });
+    if ((_stack_)->callbacks && (_stack_)->callbacks->delete)
+        (_stack_)->callbacks->delete ();
+    ;
+    return &(_stack_->buffer[index]);
+}
+_Bool tsk_to_string(struct tsc_stack *_stack_, FILE *fptr)
+{
+    struct tsc_stack *s_ = _stack_;
+    return 0 <= fprintf(fptr,
+                        "struct %s<%s> "
+                        "at %p { "
+                        "buffer:%p, "
+                        "capacity:%"
+                        "I64u"
+                        ", "
+                        "count:%"
+                        "I64u"
+                        ", "
+                        "flag:%d, "
+                        "f_val:%p, "
+                        "alloc:%p, "
+                        "callbacks:%p }",
+                        "tsc_stack", "size_t", s_, s_->buffer, s_->capacity, tsk_count(s_), tsk_flag(s_), s_->f_val,
+                        s_->alloc, (s_)->callbacks);
+}
+_Bool tsk_print(struct tsc_stack *_stack_, FILE *fptr, const char *start, const char *separator, const char *end)
+{
+    fprintf(fptr, "%s", start);
+    uint32_t index = (uint32_t)__extension__({ __auto_type __atomic_load_ptr = (&_stack_->head); __typeof__((void)0,
+                                                                                                            *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                                 &__atomic_load_tmp,
+                                                                                                                                                                 (5)); __atomic_load_tmp; });
+    while (index != (4294967295U))
+    {
+        if (!_stack_->f_val->str(fptr, _stack_->buffer[index].value))
+            return 0;
+        index = __extension__({ __auto_type __atomic_load_ptr = (&_stack_->buffer[index].next); __typeof__((void)0,
+                                                                                                           *__atomic_load_ptr) __atomic_load_tmp; __atomic_load(__atomic_load_ptr,
+                                                                                                                                                                &__atomic_load_tmp,
+                                                                                                                                                                (5)); __atomic_load_tmp; });
+        if (index != (4294967295U))
+            fprintf(fptr, "%s", separator);
+    }
+    fprintf(fptr, "%s", end);
+    return 1;
+}
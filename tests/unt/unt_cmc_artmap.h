@@ -0,0 +1,589 @@
+#ifndef CMC_TESTS_UNT_CMC_ARTMAP_H
+#define CMC_TESTS_UNT_CMC_ARTMAP_H
+
+#include "utl.h"
+
+#include "tst_cmc_artmap.h"
+
+struct artmap_fkey *am_fkey = &(struct artmap_fkey){ .cmp = cmc_str_cmp,
+                                                     .cpy = NULL,
+                                                     .str = cmc_str_str,
+                                                     .free = NULL,
+                                                     .hash = cmc_str_hash_java,
+                                                     .pri = cmc_str_cmp,
+                                                     .bytes = cmc_str_bytes };
+
+struct artmap_fval *am_fval = &(struct artmap_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct artmap_fkey *am_fkey_nobytes = &(struct artmap_fkey){ .cmp = cmc_str_cmp, .bytes = NULL };
+
+/* Storage for generated keys, the map doesn't copy them */
+char am_keys[1000][48];
+
+CMC_CREATE_UNIT(CMCArtMap, true, {
+    CMC_CREATE_TEST(new, {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(new[no bytes function], {
+        struct artmap *map = am_new(am_fkey_nobytes, am_fval);
+
+        cmc_assert_equals(ptr, NULL, map);
+    });
+
+    CMC_CREATE_TEST(clear[count], {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 50; i++)
+        {
+            sprintf(am_keys[i], "%zu", i);
+            am_insert(map, am_keys[i], i);
+        }
+
+        cmc_assert_equals(size_t, 50, am_count(map));
+
+        am_clear(map);
+
+        cmc_assert_equals(size_t, 0, am_count(map));
+        cmc_assert_equals(ptr, NULL, map->root);
+        cmc_assert_equals(ptr, NULL, map->head);
+        cmc_assert_equals(ptr, NULL, map->tail);
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(insert[prefix keys], {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert(am_insert(map, "abc", 3));
+        cmc_assert(am_insert(map, "a", 1));
+        cmc_assert(am_insert(map, "", 0));
+        cmc_assert(am_insert(map, "ab", 2));
+        cmc_assert(am_insert(map, "b", 4));
+
+        cmc_assert(!am_insert(map, "ab", 5));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, am_flag(map));
+
+        cmc_assert_equals(size_t, 5, am_count(map));
+        cmc_assert_equals(size_t, 0, am_get(map, ""));
+        cmc_assert_equals(size_t, 1, am_get(map, "a"));
+        cmc_assert_equals(size_t, 2, am_get(map, "ab"));
+        cmc_assert_equals(size_t, 3, am_get(map, "abc"));
+        cmc_assert_equals(size_t, 4, am_get(map, "b"));
+        cmc_assert(!am_contains(map, "abcd"));
+        cmc_assert(!am_contains(map, "c"));
+
+        cmc_assert(am_remove(map, "a", NULL));
+        cmc_assert(am_remove(map, "", NULL));
+        cmc_assert(!am_contains(map, "a"));
+        cmc_assert_equals(size_t, 2, am_get(map, "ab"));
+        cmc_assert_equals(size_t, 3, am_get(map, "abc"));
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(insert[node growth], {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        /* Every single byte key is a child of the root */
+        for (size_t i = 1; i < 256; i++)
+        {
+            am_keys[i][0] = (char)i;
+            am_keys[i][1] = '\0';
+            cmc_assert(am_insert(map, am_keys[i], i));
+        }
+
+        cmc_assert_equals(size_t, 255, am_count(map));
+
+        for (size_t i = 1; i < 256; i++)
+            cmc_assert_equals(size_t, i, am_get(map, am_keys[i]));
+
+        /* Shrink back down through every kind of node */
+        for (size_t i = 1; i < 254; i++)
+            cmc_assert(am_remove(map, am_keys[i], NULL));
+
+        cmc_assert_equals(size_t, 2, am_count(map));
+        cmc_assert_equals(size_t, 254, am_get(map, am_keys[254]));
+        cmc_assert_equals(size_t, 255, am_get(map, am_keys[255]));
+        cmc_assert(!am_contains(map, am_keys[1]));
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(insert[long prefixes], {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            sprintf(am_keys[i], "a very long prefix shared by all keys %zu", i);
+            cmc_assert(am_insert(map, am_keys[i], i));
+        }
+
+        /* Leaves the compressed path in its middle */
+        cmc_assert(am_insert(map, "a very long", 100));
+        cmc_assert(am_insert(map, "a very short", 101));
+
+        for (size_t i = 0; i < 100; i += 2)
+            cmc_assert(am_remove(map, am_keys[i], NULL));
+
+        for (size_t i = 1; i < 100; i += 2)
+            cmc_assert_equals(size_t, i, am_get(map, am_keys[i]));
+
+        cmc_assert_equals(size_t, 100, am_get(map, "a very long"));
+        cmc_assert_equals(size_t, 101, am_get(map, "a very short"));
+        cmc_assert(!am_contains(map, "a very long prefix"));
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(remove[all], {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            sprintf(am_keys[i], "%zu", i * 7);
+            cmc_assert(am_insert(map, am_keys[i], i));
+        }
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            size_t value = 0;
+            cmc_assert(am_remove(map, am_keys[(i * 389) % 1000], &value));
+            cmc_assert_equals(size_t, (i * 389) % 1000, value);
+        }
+
+        cmc_assert_equals(size_t, 0, am_count(map));
+        cmc_assert_equals(ptr, NULL, map->root);
+        cmc_assert_equals(ptr, NULL, map->head);
+        cmc_assert_equals(ptr, NULL, map->tail);
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(max min, {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert(am_insert(map, "m", 1));
+        cmc_assert(am_insert(map, "z", 2));
+        cmc_assert(am_insert(map, "ma", 3));
+        cmc_assert(am_insert(map, "b", 4));
+        cmc_assert(am_insert(map, "zz", 5));
+
+        char *key = NULL;
+        size_t value = 0;
+
+        cmc_assert(am_max(map, &key, &value));
+        cmc_assert_equals(size_t, 5, value);
+
+        cmc_assert(am_min(map, &key, &value));
+        cmc_assert_equals(size_t, 4, value);
+
+        cmc_assert(am_remove(map, "b", NULL));
+        cmc_assert(am_min(map, &key, &value));
+        cmc_assert_equals(size_t, 1, value);
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(longest_prefix, {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert(!am_longest_prefix(map, "abc", NULL, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, am_flag(map));
+
+        cmc_assert(am_insert(map, "a", 1));
+        cmc_assert(am_insert(map, "abc", 3));
+        cmc_assert(am_insert(map, "abcdef", 6));
+        cmc_assert(am_insert(map, "x", 0));
+
+        char *key = NULL;
+        size_t value = 0;
+
+        cmc_assert(am_longest_prefix(map, "abcde", &key, &value));
+        cmc_assert_equals(size_t, 3, value);
+
+        cmc_assert(am_longest_prefix(map, "abcdefgh", &key, &value));
+        cmc_assert_equals(size_t, 6, value);
+
+        cmc_assert(am_longest_prefix(map, "a", &key, &value));
+        cmc_assert_equals(size_t, 1, value);
+
+        cmc_assert(am_longest_prefix(map, "ab", &key, &value));
+        cmc_assert_equals(size_t, 1, value);
+
+        cmc_assert(!am_longest_prefix(map, "b", &key, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, am_flag(map));
+
+        cmc_assert(!am_longest_prefix(map, "", &key, &value));
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(flags, {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        // clear
+        map->flag = CMC_FLAG_ERROR;
+        am_clear(map);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        // insert
+        map->flag = CMC_FLAG_ERROR;
+        cmc_assert(am_insert(map, "1", 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        cmc_assert(!am_insert(map, "1", 2));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, am_flag(map));
+
+        // update
+        cmc_assert(!am_update(map, "2", 2, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, am_flag(map));
+
+        cmc_assert(am_update(map, "1", 2, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        // remove
+        cmc_assert(!am_remove(map, "2", NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, am_flag(map));
+
+        cmc_assert(am_remove(map, "1", NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        cmc_assert(!am_remove(map, "1", NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, am_flag(map));
+
+        // max min
+        map->flag = CMC_FLAG_ERROR;
+        cmc_assert(!am_max(map, NULL, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, am_flag(map));
+
+        map->flag = CMC_FLAG_ERROR;
+        cmc_assert(!am_min(map, NULL, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, am_flag(map));
+
+        cmc_assert(am_insert(map, "1", 1));
+        cmc_assert(am_max(map, NULL, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        map->flag = CMC_FLAG_ERROR;
+        cmc_assert(am_min(map, NULL, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        // get get_ref
+        am_get(map, "2");
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, am_flag(map));
+
+        am_get(map, "1");
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        am_get_ref(map, "2");
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, am_flag(map));
+
+        am_get_ref(map, "1");
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        // longest_prefix
+        am_longest_prefix(map, "2", NULL, NULL);
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, am_flag(map));
+
+        am_longest_prefix(map, "12", NULL, NULL);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+
+        cmc_assert(am_remove(map, "1", NULL));
+        map->flag = CMC_FLAG_ERROR;
+        am_get(map, "1");
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, am_flag(map));
+
+        map->flag = CMC_FLAG_ERROR;
+        am_get_ref(map, "1");
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, am_flag(map));
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            sprintf(am_keys[i], "%zu", i);
+            cmc_assert(am_insert(map, am_keys[i], i));
+        }
+
+        // copy_of
+        map->flag = CMC_FLAG_ERROR;
+        struct artmap *map2 = am_copy_of(map);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map2));
+
+        // equals
+        map->flag = CMC_FLAG_ERROR;
+        map2->flag = CMC_FLAG_ERROR;
+        cmc_assert(am_equals(map, map2));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, am_flag(map2));
+
+        cmc_assert(am_update(map2, "50", 0, NULL));
+        cmc_assert(!am_equals(map, map2));
+
+        am_free(map);
+        am_free(map2);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct artmap *map = am_new_custom(am_fkey, am_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(am_insert(map, "1", 10));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        cmc_assert(am_update(map, "1", 2, NULL));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert(am_remove(map, "1", NULL));
+        cmc_assert_equals(int32_t, 1, total_delete);
+
+        cmc_assert(am_insert(map, "1", 2));
+        cmc_assert_equals(int32_t, 2, total_create);
+
+        cmc_assert(am_max(map, NULL, NULL));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert(am_min(map, NULL, NULL));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert_equals(size_t, 2, am_get(map, "1"));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert_not_equals(ptr, NULL, am_get_ref(map, "1"));
+        cmc_assert_equals(int32_t, 4, total_read);
+
+        cmc_assert(am_contains(map, "1"));
+        cmc_assert_equals(int32_t, 5, total_read);
+
+        cmc_assert(am_longest_prefix(map, "12", NULL, NULL));
+        cmc_assert_equals(int32_t, 6, total_read);
+
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 6, total_read);
+        cmc_assert_equals(int32_t, 1, total_update);
+        cmc_assert_equals(int32_t, 1, total_delete);
+        cmc_assert_equals(int32_t, 0, total_resize);
+
+        am_customize(map, NULL, NULL);
+
+        am_clear(map);
+        cmc_assert(am_insert(map, "1", 10));
+        cmc_assert(am_update(map, "1", 2, NULL));
+        cmc_assert(am_remove(map, "1", NULL));
+        cmc_assert(am_insert(map, "1", 2));
+        cmc_assert(am_max(map, NULL, NULL));
+        cmc_assert(am_min(map, NULL, NULL));
+        cmc_assert_equals(size_t, 2, am_get(map, "1"));
+        cmc_assert_not_equals(ptr, NULL, am_get_ref(map, "1"));
+        cmc_assert(am_contains(map, "1"));
+
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 6, total_read);
+        cmc_assert_equals(int32_t, 1, total_update);
+        cmc_assert_equals(int32_t, 1, total_delete);
+        cmc_assert_equals(int32_t, 0, total_resize);
+
+        cmc_assert_equals(ptr, NULL, map->callbacks);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        am_free(map);
+    });
+});
+
+CMC_CREATE_UNIT(CMCArtMapIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        struct artmap_iter it = am_iter_start(map);
+
+        cmc_assert(!am_iter_next(&it));
+
+        for (size_t i = 1; i <= 1000; i++)
+        {
+            sprintf(am_keys[i - 1], "%zu", i);
+            am_insert(map, am_keys[i - 1], i);
+        }
+
+        size_t sum = 0;
+        char *previous = "";
+        for (it = am_iter_start(map); !am_iter_at_end(&it); am_iter_next(&it))
+        {
+            /* Keys come out in strcmp order */
+            cmc_assert(strcmp(previous, am_iter_key(&it)) < 0);
+            previous = am_iter_key(&it);
+
+            sum += am_iter_value(&it);
+        }
+
+        cmc_assert_equals(size_t, 500500, sum);
+
+        sum = 0;
+
+        am_iter_to_start(&it);
+        do
+        {
+            sum += am_iter_value(&it);
+        } while (am_iter_next(&it));
+
+        cmc_assert_equals(size_t, 500500, sum);
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        struct artmap_iter it = am_iter_end(map);
+
+        cmc_assert(!am_iter_prev(&it));
+
+        for (size_t i = 1; i <= 1000; i++)
+        {
+            sprintf(am_keys[i - 1], "%zu", i);
+            am_insert(map, am_keys[i - 1], i);
+        }
+
+        size_t sum = 0;
+        for (it = am_iter_end(map); !am_iter_at_start(&it); am_iter_prev(&it))
+        {
+            sum += am_iter_value(&it);
+        }
+
+        cmc_assert_equals(size_t, 500500, sum);
+
+        sum = 0;
+
+        am_iter_to_end(&it);
+        do
+        {
+            sum += am_iter_value(&it);
+        } while (am_iter_prev(&it));
+
+        cmc_assert_equals(size_t, 500500, sum);
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_go_to(), {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 10; i++)
+        {
+            sprintf(am_keys[i], "%zu", i);
+            am_insert(map, am_keys[i], i);
+        }
+
+        struct artmap_iter it = am_iter_start(map);
+
+        cmc_assert(am_iter_go_to(&it, 7));
+        cmc_assert_equals(size_t, 7, am_iter_value(&it));
+        cmc_assert_equals(size_t, 7, am_iter_index(&it));
+
+        cmc_assert(am_iter_go_to(&it, 2));
+        cmc_assert_equals(size_t, 2, am_iter_value(&it));
+
+        cmc_assert(!am_iter_go_to(&it, 10));
+
+        am_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prefix(), {
+        struct artmap *map = am_new(am_fkey, am_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        struct artmap_iter it = am_iter_prefix(map, "car");
+
+        cmc_assert(am_iter_at_start(&it));
+        cmc_assert(am_iter_at_end(&it));
+
+        cmc_assert(am_insert(map, "cart", 2));
+        cmc_assert(am_insert(map, "dog", 4));
+        cmc_assert(am_insert(map, "car", 0));
+        cmc_assert(am_insert(map, "cat", 3));
+        cmc_assert(am_insert(map, "carbon", 1));
+        cmc_assert(am_insert(map, "ca", 5));
+
+        size_t total = 0;
+        for (it = am_iter_prefix(map, "car"); !am_iter_at_end(&it); am_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, total, am_iter_value(&it));
+            total++;
+        }
+
+        cmc_assert_equals(size_t, 3, total);
+
+        /* Walking backwards stops at the first key with the prefix */
+        am_iter_to_end(&it);
+        cmc_assert_equals(size_t, 2, am_iter_value(&it));
+
+        total = 0;
+        do
+        {
+            total++;
+        } while (am_iter_prev(&it));
+
+        cmc_assert_equals(size_t, 3, total);
+
+        total = 0;
+        for (it = am_iter_prefix(map, ""); !am_iter_at_end(&it); am_iter_next(&it))
+            total++;
+
+        cmc_assert_equals(size_t, 6, total);
+
+        it = am_iter_prefix(map, "carb");
+        cmc_assert_equals(size_t, 1, am_iter_value(&it));
+        cmc_assert(!am_iter_next(&it));
+
+        it = am_iter_prefix(map, "cart!");
+        cmc_assert(am_iter_at_end(&it));
+
+        it = am_iter_prefix(map, "x");
+        cmc_assert(am_iter_at_end(&it));
+
+        am_free(map);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_ARTMAP_H */
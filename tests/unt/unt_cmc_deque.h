@@ -9,6 +9,25 @@ struct deque_fval *d_fval = &(struct deque_fval){
     .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
 };
 
+/* Orders values by their thousands only, so the sorts can be checked for stability */
+static int d_cmp_thousands(size_t a, size_t b)
+{
+    return cmc_size_cmp(a / 1000, b / 1000);
+}
+
+struct deque_fval *d_fval_thousands = &(struct deque_fval){
+    .cmp = d_cmp_thousands, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = NULL
+};
+
+/* Same as d_fval but searches with cmc_size_find() */
+struct deque_fval *d_fval_find = &(struct deque_fval){ .cmp = cmc_size_cmp,
+                                                       .cpy = NULL,
+                                                       .str = cmc_size_str,
+                                                       .free = NULL,
+                                                       .hash = cmc_size_hash,
+                                                       .pri = cmc_size_cmp,
+                                                       .find = cmc_size_find };
+
 struct deque_fval *d_fval_counter = &(struct deque_fval){
     .cmp = v_c_cmp, .cpy = v_c_cpy, .str = v_c_str, .free = v_c_free, .hash = v_c_hash, .pri = v_c_pri
 };
@@ -16,6 +35,16 @@ struct deque_fval *d_fval_counter = &(struct deque_fval){
 struct cmc_alloc_node *d_alloc_node =
     &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
 
+/* Sum and amount of the values evicted by a deque in overwrite mode */
+static size_t d_evicted_sum = 0;
+static size_t d_evicted_count = 0;
+
+static void d_evict(size_t value)
+{
+    d_evicted_sum += value;
+    d_evicted_count++;
+}
+
 CMC_CREATE_UNIT(CMCDeque, true, {
     CMC_CREATE_TEST(PFX##_new(), {
         struct deque *d = d_new(1000000, d_fval);
@@ -671,6 +700,35 @@ CMC_CREATE_UNIT(CMCDeque, true, {
         cmc_assert(!d_contains(d, 101));
 
         d_free(d);
+
+        d = d_new(16, d_fval_find);
+
+        cmc_assert_not_equals(ptr, NULL, d);
+        cmc_assert(!d_contains(d, 0));
+
+        /* The elements wrap around the start of the buffer */
+        for (size_t i = 0; i < 16; i++)
+        {
+            if (i % 2 == 0)
+                cmc_assert(d_push_back(d, i));
+            else
+                cmc_assert(d_push_front(d, i));
+        }
+
+        cmc_assert_equals(size_t, 16, d_capacity(d));
+
+        for (size_t i = 0; i < 16; i++)
+            cmc_assert(d_contains(d, i));
+
+        cmc_assert(!d_contains(d, 16));
+
+        for (size_t i = 0; i < 8; i++)
+            cmc_assert(d_pop_back(d));
+
+        for (size_t i = 0; i < 16; i++)
+            cmc_assert_equals(bool, i % 2 == 1, d_contains(d, i));
+
+        d_free(d);
     });
 
     CMC_CREATE_TEST(PFX##_empty(), {
@@ -1093,6 +1151,251 @@ CMC_CREATE_UNIT(CMCDeque, true, {
         d_free(d);
     });
 
+    CMC_CREATE_TEST(PFX##_sort(), {
+        struct deque *d = d_new(64, d_fval);
+
+        cmc_assert_not_equals(ptr, NULL, d);
+
+        d_sort(d);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, d_flag(d));
+
+        /* Contiguous elements in the middle of the buffer */
+        for (size_t i = 0; i < 20; i++)
+            cmc_assert(d_push_back(d, 0));
+
+        for (size_t i = 0; i < 20; i++)
+            cmc_assert(d_pop_front(d));
+
+        for (size_t i = 0; i < 30; i++)
+            cmc_assert(d_push_back(d, (i * 7) % 30));
+
+        d_sort(d);
+
+        for (size_t i = 0; i < 30; i++)
+        {
+            cmc_assert_equals(size_t, i, d_front(d));
+            cmc_assert(d_pop_front(d));
+        }
+
+        /* Elements wrapping around the end of the buffer */
+        for (size_t i = 0; i < 64; i++)
+        {
+            if (i % 2 == 0)
+                cmc_assert(d_push_back(d, (i * 13) % 64));
+            else
+                cmc_assert(d_push_front(d, (i * 13) % 64));
+        }
+
+        cmc_assert_equals(size_t, 64, d_capacity(d));
+
+        d_sort(d);
+
+        for (size_t i = 0; i < 64; i++)
+        {
+            cmc_assert_equals(size_t, i, d_front(d));
+            cmc_assert(d_pop_front(d));
+        }
+
+        /* Still usable as a ring after sorting */
+        cmc_assert(d_push_front(d, 1));
+        cmc_assert(d_push_back(d, 2));
+        cmc_assert_equals(size_t, 1, d_front(d));
+        cmc_assert_equals(size_t, 2, d_back(d));
+
+        d_free(d);
+    });
+
+    CMC_CREATE_TEST(PFX##_stable_sort(), {
+        struct deque *d = d_new(1000, d_fval_thousands);
+
+        cmc_assert_not_equals(ptr, NULL, d);
+        cmc_assert(d_stable_sort(d));
+
+        for (size_t i = 0; i < 500; i++)
+            cmc_assert(d_push_back(d, ((i * 37) % 20) * 1000 + i));
+
+        for (size_t i = 0; i < 500; i++)
+            cmc_assert(d_pop_front(d));
+
+        /* Wraps around the end of the buffer */
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(d_push_back(d, ((i * 37) % 20) * 1000 + i));
+
+        cmc_assert_equals(size_t, 1000, d_capacity(d));
+        cmc_assert(d_stable_sort(d));
+        cmc_assert_equals(size_t, 1000, d_count(d));
+
+        size_t prev = d_front(d);
+
+        cmc_assert(d_pop_front(d));
+
+        while (!d_empty(d))
+        {
+            size_t curr = d_front(d);
+
+            cmc_assert_lesser_equals(size_t, curr / 1000, prev / 1000);
+
+            if (curr / 1000 == prev / 1000)
+                cmc_assert_greater(size_t, prev % 1000, curr % 1000);
+
+            prev = curr;
+            cmc_assert(d_pop_front(d));
+        }
+
+        d_free(d);
+    });
+
+    CMC_CREATE_TEST(PFX##_set_overwrite(), {
+        struct deque *d = d_new(10, d_fval);
+
+        cmc_assert_not_equals(ptr, NULL, d);
+
+        d_evicted_sum = 0;
+        d_evicted_count = 0;
+
+        d_set_overwrite(d, true, d_evict);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(d_push_back(d, i));
+
+        cmc_assert_equals(size_t, 10, d_capacity(d));
+        cmc_assert_equals(size_t, 10, d_count(d));
+        cmc_assert_equals(size_t, 90, d_evicted_count);
+        cmc_assert_equals(size_t, 4005, d_evicted_sum);
+
+        struct deque *copy = d_copy_of(d);
+
+        cmc_assert_not_equals(ptr, NULL, copy);
+        cmc_assert(copy->overwrite);
+        cmc_assert(d_push_back(copy, 100));
+        cmc_assert_equals(size_t, 91, d_evicted_count);
+
+        d_free(copy);
+
+        /* Pushing to the front overwrites the back */
+        cmc_assert(d_push_front(d, 1000));
+        cmc_assert_equals(size_t, 1000, d_front(d));
+        cmc_assert_equals(size_t, 98, d_back(d));
+        cmc_assert_equals(size_t, 92, d_evicted_count);
+        cmc_assert(d_pop_front(d));
+        cmc_assert(d_push_back(d, 99));
+        cmc_assert_equals(size_t, 92, d_evicted_count);
+        for (size_t i = 90; i < 100; i++)
+        {
+            cmc_assert_equals(size_t, i, d_front(d));
+            cmc_assert(d_pop_front(d));
+        }
+
+        d_set_overwrite(d, false, NULL);
+
+        for (size_t i = 0; i < 20; i++)
+            cmc_assert(d_push_back(d, i));
+
+        cmc_assert_equals(size_t, 20, d_count(d));
+        cmc_assert_greater_equals(size_t, 20, d_capacity(d));
+        cmc_assert_equals(size_t, 92, d_evicted_count);
+
+        d_free(d);
+    });
+
+    CMC_CREATE_TEST(overwrite[free], {
+        struct deque *d = d_new(8, d_fval_counter);
+
+        cmc_assert_not_equals(ptr, NULL, d);
+
+        v_total_free = 0;
+
+        /* Without evict the overwritten values are freed */
+        d_set_overwrite(d, true, NULL);
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(d_push_back(d, i));
+
+        cmc_assert_equals(int32_t, 2, v_total_free);
+
+        cmc_assert(d_push_front(d, 100));
+        cmc_assert_equals(int32_t, 3, v_total_free);
+
+        size_t values[20] = { 0 };
+
+        /* 12 values are skipped and the 8 in the deque are overwritten */
+        cmc_assert(d_push_back_many(d, values, 20));
+        cmc_assert_equals(size_t, 8, d_count(d));
+        cmc_assert_equals(int32_t, 23, v_total_free);
+
+        d_free(d);
+
+        cmc_assert_equals(int32_t, 31, v_total_free);
+
+        v_total_free = 0;
+    });
+
+    CMC_CREATE_TEST(PFX##_push_back_many(), {
+        struct deque *d = d_new(8, d_fval);
+
+        cmc_assert_not_equals(ptr, NULL, d);
+
+        size_t values[100];
+
+        for (size_t i = 0; i < 100; i++)
+            values[i] = i;
+
+        cmc_assert(d_push_back_many(d, values, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, d_flag(d));
+        cmc_assert_equals(size_t, 0, d_count(d));
+
+        /* Move the back close to the end of the buffer */
+        for (size_t i = 0; i < 6; i++)
+            cmc_assert(d_push_back(d, i));
+        for (size_t i = 0; i < 6; i++)
+            cmc_assert(d_pop_front(d));
+
+        cmc_assert(d_push_back_many(d, values, 5));
+        cmc_assert_equals(size_t, 5, d_count(d));
+        cmc_assert_equals(size_t, 8, d_capacity(d));
+
+        cmc_assert(d_push_back_many(d, values + 5, 20));
+        cmc_assert_equals(size_t, 25, d_count(d));
+
+        for (size_t i = 0; i < 25; i++)
+        {
+            cmc_assert_equals(size_t, i, d_front(d));
+            cmc_assert(d_pop_front(d));
+        }
+
+        d_free(d);
+
+        d = d_new(8, d_fval);
+
+        cmc_assert_not_equals(ptr, NULL, d);
+
+        d_evicted_sum = 0;
+        d_evicted_count = 0;
+
+        d_set_overwrite(d, true, d_evict);
+
+        cmc_assert(d_push_back_many(d, values, 5));
+        cmc_assert(d_push_back_many(d, values + 5, 6));
+        cmc_assert_equals(size_t, 8, d_count(d));
+        cmc_assert_equals(size_t, 3, d_evicted_count);
+        cmc_assert_equals(size_t, 3, d_evicted_sum);
+
+        /* Only the last 8 values are kept */
+        cmc_assert(d_push_back_many(d, values + 11, 20));
+        cmc_assert_equals(size_t, 8, d_count(d));
+        cmc_assert_equals(size_t, 8, d_capacity(d));
+        cmc_assert_equals(size_t, 23, d_evicted_count);
+        cmc_assert_equals(size_t, 253, d_evicted_sum);
+
+        for (size_t i = 23; i < 31; i++)
+        {
+            cmc_assert_equals(size_t, i, d_front(d));
+            cmc_assert(d_pop_front(d));
+        }
+
+        d_free(d);
+    });
+
     CMC_CREATE_TEST(flags, {
         struct deque *d = d_new(100, d_fval);
 
@@ -0,0 +1,382 @@
+#ifndef CMC_TESTS_UNT_CMC_DISJOINTSET_H
+#define CMC_TESTS_UNT_CMC_DISJOINTSET_H
+
+#include "utl.h"
+
+#include "tst_cmc_disjointset.h"
+
+struct disjointset_fval *djs_fval = &(struct disjointset_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct cmc_alloc_node *djs_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+CMC_CREATE_UNIT(CMCDisjointSet, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct disjointset *set = djs_new(1000, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+        cmc_assert_not_equals(ptr, NULL, set->parent);
+        cmc_assert_not_equals(ptr, NULL, set->rank);
+        cmc_assert_not_equals(ptr, NULL, set->size);
+        cmc_assert_not_equals(ptr, NULL, set->next);
+        cmc_assert_not_equals(ptr, NULL, set->prev);
+        cmc_assert_equals(size_t, 1000, djs_count(set));
+        cmc_assert_equals(size_t, 1000, djs_set_count(set));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, djs_flag(set));
+        cmc_assert_equals(ptr, djs_fval, set->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, set->alloc->malloc);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.free, set->alloc->free);
+        cmc_assert_equals(ptr, NULL, set->callbacks);
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            size_t root;
+
+            cmc_assert(djs_find(set, i, &root));
+            cmc_assert_equals(size_t, i, root);
+            cmc_assert_equals(size_t, 1, djs_set_size(set, i));
+        }
+
+        djs_free(set);
+
+        set = djs_new(0, djs_fval);
+        cmc_assert_equals(ptr, NULL, set);
+
+        set = djs_new(1000, NULL);
+        cmc_assert_equals(ptr, NULL, set);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct disjointset *set = djs_new_custom(1000, djs_fval, djs_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+        cmc_assert_equals(ptr, djs_alloc_node, set->alloc);
+        cmc_assert_equals(ptr, callbacks, set->callbacks);
+
+        djs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_clear(), {
+        struct disjointset *set = djs_new(1000, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 1; i < 1000; i++)
+            cmc_assert(djs_union(set, 0, i));
+
+        cmc_assert_equals(size_t, 1, djs_set_count(set));
+
+        djs_clear(set);
+
+        cmc_assert_equals(size_t, 1000, djs_count(set));
+        cmc_assert_equals(size_t, 1000, djs_set_count(set));
+        cmc_assert(!djs_connected(set, 0, 1));
+        cmc_assert_equals(size_t, 1, djs_set_size(set, 0));
+
+        djs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_union() PFX##_connected(), {
+        struct disjointset *set = djs_new(1000, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        /* Groups by the remainder of 10 */
+        for (size_t i = 10; i < 1000; i++)
+            cmc_assert(djs_union(set, i, i - 10));
+
+        cmc_assert_equals(size_t, 10, djs_set_count(set));
+
+        for (size_t i = 0; i < 1000; i += 7)
+        {
+            for (size_t j = 0; j < 1000; j += 13)
+                cmc_assert_equals(bool, i % 10 == j % 10, djs_connected(set, i, j));
+        }
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert_equals(size_t, 100, djs_set_size(set, i));
+
+        /* Already in the same set */
+        cmc_assert(!djs_union(set, 5, 995));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, djs_flag(set));
+        cmc_assert_equals(size_t, 10, djs_set_count(set));
+
+        cmc_assert(djs_union(set, 1, 2));
+        cmc_assert(djs_connected(set, 991, 992));
+        cmc_assert_equals(size_t, 200, djs_set_size(set, 1));
+        cmc_assert_equals(size_t, 9, djs_set_count(set));
+
+        cmc_assert(!djs_union(set, 1, 1000));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, djs_flag(set));
+        cmc_assert(!djs_connected(set, 1000, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, djs_flag(set));
+        cmc_assert_equals(size_t, 0, djs_set_size(set, 1000));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, djs_flag(set));
+
+        djs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_find(), {
+        struct disjointset *set = djs_new(1000, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        /* A long chain */
+        for (size_t i = 1; i < 1000; i++)
+            cmc_assert(djs_union(set, i - 1, i));
+
+        size_t root;
+        size_t other;
+
+        cmc_assert(djs_find(set, 999, &root));
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            cmc_assert(djs_find(set, i, &other));
+            cmc_assert_equals(size_t, root, other);
+        }
+
+        /* Union by rank keeps the trees shallow */
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(set->rank[i] <= 10);
+
+        cmc_assert(!djs_find(set, 1000, &root));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, djs_flag(set));
+
+        djs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_resize(), {
+        struct disjointset *set = djs_new(10, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        cmc_assert(djs_union(set, 0, 9));
+
+        cmc_assert(djs_resize(set, 100));
+        cmc_assert_equals(size_t, 100, djs_count(set));
+        cmc_assert_equals(size_t, 99, djs_set_count(set));
+        cmc_assert(djs_connected(set, 0, 9));
+
+        cmc_assert(djs_union(set, 9, 99));
+        cmc_assert(djs_connected(set, 0, 99));
+
+        cmc_assert(djs_resize(set, 100));
+
+        cmc_assert(!djs_resize(set, 50));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, djs_flag(set));
+
+        djs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of() PFX##_equals(), {
+        struct disjointset *set1 = djs_new(100, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set1);
+
+        for (size_t i = 3; i < 100; i++)
+            cmc_assert(djs_union(set1, i, i % 3));
+
+        struct disjointset *set2 = djs_copy_of(set1);
+
+        cmc_assert_not_equals(ptr, NULL, set2);
+        cmc_assert(djs_equals(set1, set2));
+        cmc_assert_equals(size_t, 3, djs_set_count(set2));
+
+        /* Same partition built in a different order */
+        struct disjointset *set3 = djs_new(100, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set3);
+
+        for (size_t i = 99; i >= 3; i--)
+            cmc_assert(djs_union(set3, i - 3, i));
+
+        cmc_assert(djs_equals(set1, set3));
+        cmc_assert(djs_equals(set3, set1));
+
+        cmc_assert(djs_union(set2, 0, 1));
+        cmc_assert(!djs_equals(set1, set2));
+        cmc_assert(!djs_equals(set2, set1));
+
+        djs_free(set1);
+        djs_free(set2);
+        djs_free(set3);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct disjointset *set = djs_new_custom(10, djs_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(djs_union(set, 1, 2));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert(djs_find(set, 1, NULL));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert(djs_connected(set, 1, 2));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert_equals(size_t, 2, djs_set_size(set, 1));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert(djs_resize(set, 20));
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        cmc_assert_equals(int32_t, 0, total_create);
+        cmc_assert_equals(int32_t, 3, total_read);
+        cmc_assert_equals(int32_t, 1, total_update);
+        cmc_assert_equals(int32_t, 0, total_delete);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        djs_customize(set, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, set->callbacks);
+
+        djs_free(set);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+CMC_CREATE_UNIT(CMCDisjointSetIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct disjointset *set = djs_new(100, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        struct disjointset_iter it = djs_iter_start(set, 5);
+
+        cmc_assert_equals(ptr, set, it.target);
+        cmc_assert_equals(size_t, 5, it.cursor);
+        cmc_assert_equals(size_t, 0, it.index);
+        cmc_assert_equals(size_t, 1, it.count);
+        cmc_assert(djs_iter_at_start(&it));
+        cmc_assert(!djs_iter_at_end(&it));
+        cmc_assert_equals(size_t, 5, djs_iter_value(&it));
+        cmc_assert(!djs_iter_next(&it));
+        cmc_assert(djs_iter_at_end(&it));
+
+        it = djs_iter_start(set, 100);
+
+        cmc_assert_equals(size_t, 0, it.count);
+        cmc_assert(djs_iter_at_start(&it));
+        cmc_assert(djs_iter_at_end(&it));
+        cmc_assert(!djs_iter_next(&it));
+        cmc_assert_equals(size_t, 0, djs_iter_value(&it));
+
+        djs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct disjointset *set = djs_new(100, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 4; i < 100; i++)
+            cmc_assert(djs_union(set, i, i % 4));
+
+        for (size_t start = 0; start < 100; start++)
+        {
+            bool seen[25] = { false };
+            size_t index = 0;
+
+            struct disjointset_iter it = djs_iter_start(set, start);
+
+            cmc_assert_equals(size_t, 25, it.count);
+            cmc_assert_equals(size_t, start, djs_iter_value(&it));
+
+            for (; !djs_iter_at_end(&it); djs_iter_next(&it))
+            {
+                size_t value = djs_iter_value(&it);
+
+                cmc_assert_equals(size_t, start % 4, value % 4);
+                cmc_assert(!seen[value / 4]);
+                cmc_assert_equals(size_t, index, djs_iter_index(&it));
+
+                seen[value / 4] = true;
+                index++;
+            }
+
+            cmc_assert_equals(size_t, 25, index);
+        }
+
+        djs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        struct disjointset *set = djs_new(100, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 1; i < 50; i++)
+            cmc_assert(djs_union(set, 0, i));
+
+        size_t sum = 0;
+        size_t index = 50;
+
+        struct disjointset_iter it = djs_iter_end(set, 10);
+
+        cmc_assert_equals(size_t, 49, djs_iter_index(&it));
+
+        for (; !djs_iter_at_start(&it); djs_iter_prev(&it))
+        {
+            index--;
+            sum += djs_iter_value(&it);
+            cmc_assert_equals(size_t, index, djs_iter_index(&it));
+        }
+
+        cmc_assert_equals(size_t, 0, index);
+        cmc_assert_equals(size_t, 49 * 50 / 2, sum);
+        cmc_assert_equals(size_t, 10, djs_iter_value(&it));
+
+        djs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_go_to(), {
+        struct disjointset *set = djs_new(100, djs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 1; i < 100; i++)
+            cmc_assert(djs_union(set, 0, i));
+
+        struct disjointset_iter it1 = djs_iter_start(set, 0);
+        struct disjointset_iter it2 = djs_iter_start(set, 0);
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            cmc_assert(djs_iter_go_to(&it2, i));
+            cmc_assert_equals(size_t, djs_iter_value(&it1), djs_iter_value(&it2));
+            djs_iter_next(&it1);
+        }
+
+        cmc_assert(!djs_iter_go_to(&it2, 100));
+
+        cmc_assert(djs_iter_to_start(&it2));
+        cmc_assert(djs_iter_advance(&it2, 99));
+        cmc_assert(djs_iter_at_end(&it1));
+        cmc_assert_equals(size_t, djs_iter_value(&it1), djs_iter_value(&it2));
+        cmc_assert(!djs_iter_advance(&it2, 1));
+        cmc_assert(djs_iter_rewind(&it2, 99));
+        cmc_assert_equals(size_t, 0, djs_iter_value(&it2));
+        cmc_assert(djs_iter_to_end(&it2));
+        cmc_assert_equals(size_t, djs_iter_value(&it1), djs_iter_value(&it2));
+
+        djs_free(set);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_DISJOINTSET_H */
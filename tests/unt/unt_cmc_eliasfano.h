@@ -0,0 +1,450 @@
+#ifndef CMC_TESTS_UNT_CMC_ELIASFANO_H
+#define CMC_TESTS_UNT_CMC_ELIASFANO_H
+
+#include "utl.h"
+
+#include "tst_cmc_eliasfano.h"
+
+struct cmc_alloc_node *ef_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+size_t ef_values[5000];
+size_t ef_unsorted[] = { 1, 3, 2 };
+size_t ef_gaps[] = { 0, 1, 3, 100, 100000 };
+size_t ef_duplicates[] = { 5, 5, 5, 9, 9, 1000 };
+size_t ef_repeated1[] = { 1, 1, 2, 2, 2, 7 };
+size_t ef_repeated2[] = { 1, 2, 2, 3, 7, 7 };
+size_t ef_squares[] = { 1, 4, 9 };
+
+/* Fills ef_values with a sorted sequence of irregular gaps, some repeated */
+static void ef_fill(size_t count, size_t seed, size_t max_gap)
+{
+    size_t value = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+        value += (seed >> 33) % (max_gap + 1);
+        ef_values[i] = value;
+    }
+}
+
+CMC_CREATE_UNIT(CMCEliasFano, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        ef_fill(1000, 1, 100);
+
+        struct eliasfano *ef = ef_new(ef_values, 1000);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+        cmc_assert_not_equals(ptr, NULL, ef->lower);
+        cmc_assert_not_equals(ptr, NULL, ef->upper);
+        cmc_assert_equals(size_t, 1000, ef_count(ef));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, ef_flag(ef));
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, ef->alloc->malloc);
+        cmc_assert_equals(ptr, NULL, ef->callbacks);
+
+        /* Takes less than 3 + log2(U / n) bits per value */
+        size_t bits = 3 + ef->low_bits;
+        cmc_assert_lesser_equals(size_t, (1000 * bits + 63) / 64 + 2, (ef->length + 63) / 64 + ef->lower_words);
+
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_new()[edge cases], {
+        struct eliasfano *ef = ef_new(NULL, 0);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+        cmc_assert(ef_empty(ef));
+        cmc_assert_equals(size_t, 0, ef_get(ef, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ef_flag(ef));
+        cmc_assert(!ef_next_geq(ef, 0, NULL, NULL));
+        cmc_assert(!ef_contains(ef, 0));
+
+        ef_free(ef);
+
+        /* Not sorted */
+        cmc_assert_equals(ptr, NULL, ef_new(ef_unsorted, 3));
+        cmc_assert_equals(ptr, NULL, ef_new(NULL, 3));
+
+        /* A single zero and a single huge value */
+        size_t single = 0;
+
+        ef = ef_new(&single, 1);
+        cmc_assert_not_equals(ptr, NULL, ef);
+        cmc_assert_equals(size_t, 0, ef_get(ef, 0));
+        ef_free(ef);
+
+        single = (size_t)1 << 40;
+
+        ef = ef_new(&single, 1);
+        cmc_assert_not_equals(ptr, NULL, ef);
+        cmc_assert_equals(size_t, (size_t)1 << 40, ef_get(ef, 0));
+        cmc_assert(ef_contains(ef, (size_t)1 << 40));
+        cmc_assert(!ef_contains(ef, 1));
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        ef_fill(100, 2, 10);
+
+        struct eliasfano *ef = ef_new_custom(ef_values, 100, ef_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+        cmc_assert_equals(ptr, ef_alloc_node, ef->alloc);
+        cmc_assert_equals(ptr, callbacks, ef->callbacks);
+
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_get(), {
+        for (size_t g = 0; g < 5; g++)
+        {
+            ef_fill(5000, g + 3, ef_gaps[g]);
+
+            struct eliasfano *ef = ef_new(ef_values, 5000);
+
+            cmc_assert_not_equals(ptr, NULL, ef);
+
+            for (size_t i = 0; i < 5000; i++)
+                cmc_assert_equals(size_t, ef_values[i], ef_get(ef, i));
+
+            cmc_assert_equals(size_t, 0, ef_get(ef, 5000));
+            cmc_assert_equals(int32_t, CMC_FLAG_RANGE, ef_flag(ef));
+
+            ef_free(ef);
+        }
+    });
+
+    CMC_CREATE_TEST(PFX##_next_geq(), {
+        ef_fill(3000, 7, 50);
+
+        struct eliasfano *ef = ef_new(ef_values, 3000);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+
+        size_t i = 0;
+        size_t index;
+        size_t result;
+
+        for (size_t value = 0; value <= ef_values[2999]; value++)
+        {
+            while (ef_values[i] < value)
+                i++;
+
+            cmc_assert(ef_next_geq(ef, value, &index, &result));
+            cmc_assert_equals(size_t, i, index);
+            cmc_assert_equals(size_t, ef_values[i], result);
+        }
+
+        cmc_assert(!ef_next_geq(ef, ef_values[2999] + 1, &index, &result));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, ef_flag(ef));
+        cmc_assert(!ef_next_geq(ef, SIZE_MAX, NULL, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, ef_flag(ef));
+
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_next_geq()[duplicates], {
+        struct eliasfano *ef = ef_new(ef_duplicates, 6);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+
+        size_t index;
+        size_t result;
+
+        /* Always the first of equal values */
+        cmc_assert(ef_next_geq(ef, 0, &index, &result));
+        cmc_assert_equals(size_t, 0, index);
+        cmc_assert_equals(size_t, 5, result);
+        cmc_assert(ef_next_geq(ef, 6, &index, &result));
+        cmc_assert_equals(size_t, 3, index);
+        cmc_assert_equals(size_t, 9, result);
+        cmc_assert(ef_next_geq(ef, 10, &index, &result));
+        cmc_assert_equals(size_t, 5, index);
+        cmc_assert_equals(size_t, 1000, result);
+
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_contains(), {
+        for (size_t i = 0; i < 1000; i++)
+            ef_values[i] = i * 3;
+
+        struct eliasfano *ef = ef_new(ef_values, 1000);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+
+        for (size_t i = 0; i < 3000; i++)
+            cmc_assert_equals(bool, i % 3 == 0, ef_contains(ef, i));
+
+        cmc_assert(!ef_contains(ef, 3000));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, ef_flag(ef));
+
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_intersection(), {
+        size_t odd[2000];
+
+        for (size_t i = 0; i < 2000; i++)
+            odd[i] = i * 2 + 1;
+
+        for (size_t i = 0; i < 1500; i++)
+            ef_values[i] = i * 3;
+
+        struct eliasfano *ef1 = ef_new(odd, 2000);
+        struct eliasfano *ef2 = ef_new(ef_values, 1500);
+
+        cmc_assert_not_equals(ptr, NULL, ef1);
+        cmc_assert_not_equals(ptr, NULL, ef2);
+
+        struct eliasfano *ef3 = ef_intersection(ef1, ef2);
+        struct eliasfano *ef4 = ef_intersection(ef2, ef1);
+
+        cmc_assert_not_equals(ptr, NULL, ef3);
+        cmc_assert_not_equals(ptr, NULL, ef4);
+
+        /* Odd multiples of 3 up to 3999 */
+        cmc_assert_equals(size_t, 667, ef_count(ef3));
+        cmc_assert(ef_equals(ef3, ef4));
+
+        for (size_t i = 0; i < ef_count(ef3); i++)
+            cmc_assert_equals(size_t, i * 6 + 3, ef_get(ef3, i));
+
+        ef_free(ef3);
+        ef_free(ef4);
+
+        /* Each common value only once */
+        struct eliasfano *ef5 = ef_new(ef_repeated1, 6);
+        struct eliasfano *ef6 = ef_new(ef_repeated2, 6);
+
+        ef3 = ef_intersection(ef5, ef6);
+
+        cmc_assert_not_equals(ptr, NULL, ef3);
+        cmc_assert_equals(size_t, 3, ef_count(ef3));
+        cmc_assert_equals(size_t, 1, ef_get(ef3, 0));
+        cmc_assert_equals(size_t, 2, ef_get(ef3, 1));
+        cmc_assert_equals(size_t, 7, ef_get(ef3, 2));
+
+        ef_free(ef3);
+
+        /* With an empty sequence */
+        ef4 = ef_new(NULL, 0);
+        ef3 = ef_intersection(ef1, ef4);
+
+        cmc_assert_not_equals(ptr, NULL, ef3);
+        cmc_assert(ef_empty(ef3));
+
+        ef_free(ef3);
+        ef_free(ef4);
+        ef_free(ef5);
+        ef_free(ef6);
+        ef_free(ef1);
+        ef_free(ef2);
+    });
+
+    CMC_CREATE_TEST(PFX##_memory(), {
+        for (size_t i = 0; i < 5000; i++)
+            ef_values[i] = i * 1000;
+
+        struct eliasfano *ef = ef_new(ef_values, 5000);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+
+        /* About 12 bits per value instead of 64 */
+        cmc_assert_lesser_equals(size_t, 5000 * 2, ef_memory(ef));
+        cmc_assert_greater_equals(size_t, 5000, ef_memory(ef));
+
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of(), {
+        ef_fill(2000, 11, 30);
+
+        struct eliasfano *ef1 = ef_new_custom(ef_values, 2000, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, ef1);
+
+        struct eliasfano *ef2 = ef_copy_of(ef1);
+
+        cmc_assert_not_equals(ptr, NULL, ef2);
+        cmc_assert_equals(ptr, ef1->callbacks, ef2->callbacks);
+        cmc_assert(ef_equals(ef1, ef2));
+
+        for (size_t i = 0; i < 2000; i++)
+            cmc_assert_equals(size_t, ef_values[i], ef_get(ef2, i));
+
+        ef_free(ef1);
+        ef_free(ef2);
+    });
+
+    CMC_CREATE_TEST(PFX##_equals(), {
+        ef_fill(100, 13, 30);
+
+        struct eliasfano *ef1 = ef_new(ef_values, 100);
+        struct eliasfano *ef2 = ef_new(ef_values, 100);
+
+        ef_values[50]++;
+
+        struct eliasfano *ef3 = ef_new(ef_values, 100);
+        struct eliasfano *ef4 = ef_new(ef_values, 99);
+
+        cmc_assert(ef_equals(ef1, ef2));
+        cmc_assert(!ef_equals(ef1, ef3));
+        cmc_assert(!ef_equals(ef3, ef4));
+
+        ef_free(ef1);
+        ef_free(ef2);
+        ef_free(ef3);
+        ef_free(ef4);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct eliasfano *ef = ef_new_custom(ef_squares, 3, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert_equals(size_t, 4, ef_get(ef, 1));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert(ef_next_geq(ef, 5, NULL, NULL));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert(ef_contains(ef, 9));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert_equals(int32_t, 0, total_create);
+        cmc_assert_equals(int32_t, 0, total_update);
+        cmc_assert_equals(int32_t, 0, total_delete);
+        cmc_assert_equals(int32_t, 0, total_resize);
+
+        ef_customize(ef, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, ef->callbacks);
+
+        ef_free(ef);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+CMC_CREATE_UNIT(CMCEliasFanoIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct eliasfano *ef = ef_new(NULL, 0);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+
+        struct eliasfano_iter it = ef_iter_start(ef);
+
+        cmc_assert(ef_iter_at_start(&it));
+        cmc_assert(ef_iter_at_end(&it));
+        cmc_assert(!ef_iter_next(&it));
+        cmc_assert(!ef_iter_to_start(&it));
+        cmc_assert_equals(size_t, 0, ef_iter_value(&it));
+
+        ef_free(ef);
+
+        ef = ef_new(ef_squares + 1, 2);
+        it = ef_iter_start(ef);
+
+        cmc_assert(ef_iter_at_start(&it));
+        cmc_assert(!ef_iter_at_end(&it));
+        cmc_assert_equals(size_t, 4, ef_iter_value(&it));
+        cmc_assert_equals(size_t, 0, ef_iter_index(&it));
+
+        it = ef_iter_end(ef);
+
+        cmc_assert(!ef_iter_at_start(&it));
+        cmc_assert(ef_iter_at_end(&it));
+        cmc_assert_equals(size_t, 9, ef_iter_value(&it));
+        cmc_assert_equals(size_t, 1, ef_iter_index(&it));
+
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        ef_fill(5000, 17, 2000);
+
+        struct eliasfano *ef = ef_new(ef_values, 5000);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+
+        size_t index = 0;
+
+        for (struct eliasfano_iter it = ef_iter_start(ef); !ef_iter_at_end(&it); ef_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, index, ef_iter_index(&it));
+            cmc_assert_equals(size_t, ef_values[index], ef_iter_value(&it));
+            index++;
+        }
+
+        cmc_assert_equals(size_t, 5000, index);
+
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        ef_fill(5000, 19, 3);
+
+        struct eliasfano *ef = ef_new(ef_values, 5000);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+
+        size_t index = 5000;
+
+        for (struct eliasfano_iter it = ef_iter_end(ef); !ef_iter_at_start(&it); ef_iter_prev(&it))
+        {
+            index--;
+            cmc_assert_equals(size_t, index, ef_iter_index(&it));
+            cmc_assert_equals(size_t, ef_values[index], ef_iter_value(&it));
+        }
+
+        cmc_assert_equals(size_t, 0, index);
+
+        ef_free(ef);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_go_to(), {
+        ef_fill(1000, 23, 500);
+
+        struct eliasfano *ef = ef_new(ef_values, 1000);
+
+        cmc_assert_not_equals(ptr, NULL, ef);
+
+        struct eliasfano_iter it = ef_iter_start(ef);
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            size_t index = (i * 7919) % 1000;
+
+            cmc_assert(ef_iter_go_to(&it, index));
+            cmc_assert_equals(size_t, ef_values[index], ef_iter_value(&it));
+        }
+
+        cmc_assert(!ef_iter_go_to(&it, 1000));
+
+        cmc_assert(ef_iter_to_start(&it));
+        cmc_assert(ef_iter_advance(&it, 999));
+        cmc_assert_equals(size_t, ef_values[999], ef_iter_value(&it));
+        cmc_assert(!ef_iter_advance(&it, 1));
+        cmc_assert(ef_iter_at_end(&it));
+        cmc_assert(ef_iter_rewind(&it, 999));
+        cmc_assert_equals(size_t, ef_values[0], ef_iter_value(&it));
+        cmc_assert(ef_iter_to_end(&it));
+        cmc_assert_equals(size_t, ef_values[999], ef_iter_value(&it));
+
+        ef_free(ef);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_ELIASFANO_H */
@@ -0,0 +1,307 @@
+#ifndef CMC_TESTS_UNT_CMC_FENWICKTREE_H
+#define CMC_TESTS_UNT_CMC_FENWICKTREE_H
+
+#include "utl.h"
+
+#include "tst_cmc_fenwicktree.h"
+
+static size_t fwt_sum(size_t a, size_t b)
+{
+    return a + b;
+}
+
+static size_t fwt_or(size_t a, size_t b)
+{
+    return a | b;
+}
+
+static size_t fwt_combines = 0;
+
+static size_t fwt_sum_counted(size_t a, size_t b)
+{
+    fwt_combines++;
+    return a + b;
+}
+
+struct fenwicktree_fval *fwt_fval = &(struct fenwicktree_fval){ .cmp = cmc_size_cmp,
+                                                                .cpy = NULL,
+                                                                .str = cmc_size_str,
+                                                                .free = NULL,
+                                                                .hash = cmc_size_hash,
+                                                                .pri = cmc_size_cmp,
+                                                                .combine = fwt_sum };
+
+struct fenwicktree_fval *fwt_fval_or = &(struct fenwicktree_fval){ .cmp = cmc_size_cmp,
+                                                                   .cpy = NULL,
+                                                                   .str = cmc_size_str,
+                                                                   .free = NULL,
+                                                                   .hash = cmc_size_hash,
+                                                                   .pri = cmc_size_cmp,
+                                                                   .combine = fwt_or };
+
+struct fenwicktree_fval *fwt_fval_counted = &(struct fenwicktree_fval){ .cmp = cmc_size_cmp,
+                                                                        .cpy = NULL,
+                                                                        .str = cmc_size_str,
+                                                                        .free = NULL,
+                                                                        .hash = cmc_size_hash,
+                                                                        .pri = cmc_size_cmp,
+                                                                        .combine = fwt_sum_counted };
+
+struct fenwicktree_fval *fwt_fval_nocombine = &(struct fenwicktree_fval){ .cmp = cmc_size_cmp, .combine = NULL };
+
+struct cmc_alloc_node *fwt_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+size_t fwt_values[1000];
+
+CMC_CREATE_UNIT(CMCFenwickTree, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        for (size_t i = 0; i < 1000; i++)
+            fwt_values[i] = i;
+
+        struct fenwicktree *tree = fwt_new(fwt_values, 1000, fwt_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+        cmc_assert_not_equals(ptr, NULL, tree->values);
+        cmc_assert_not_equals(ptr, NULL, tree->tree);
+        cmc_assert_equals(size_t, 1000, fwt_count(tree));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, fwt_flag(tree));
+        cmc_assert_equals(ptr, fwt_fval, tree->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, tree->alloc->malloc);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.free, tree->alloc->free);
+        cmc_assert_equals(ptr, NULL, tree->callbacks);
+
+        /* The values are copied */
+        fwt_values[0] = 1000;
+        cmc_assert_equals(size_t, 0, fwt_get(tree, 0));
+
+        fwt_free(tree);
+
+        tree = fwt_new(fwt_values, 0, fwt_fval);
+        cmc_assert_equals(ptr, NULL, tree);
+
+        tree = fwt_new(NULL, 1000, fwt_fval);
+        cmc_assert_equals(ptr, NULL, tree);
+
+        tree = fwt_new(fwt_values, 1000, NULL);
+        cmc_assert_equals(ptr, NULL, tree);
+
+        tree = fwt_new(fwt_values, 1000, fwt_fval_nocombine);
+        cmc_assert_equals(ptr, NULL, tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct fenwicktree *tree = fwt_new_custom(fwt_values, 1000, fwt_fval, fwt_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+        cmc_assert_equals(ptr, fwt_alloc_node, tree->alloc);
+        cmc_assert_equals(ptr, callbacks, tree->callbacks);
+
+        fwt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_prefix(), {
+        for (size_t i = 0; i < 1000; i++)
+            fwt_values[i] = i % 7;
+
+        struct fenwicktree *tree = fwt_new(fwt_values, 1000, fwt_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        size_t sum = 0;
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            sum += fwt_values[i];
+            cmc_assert_equals(size_t, sum, fwt_prefix(tree, i));
+        }
+
+        fwt_prefix(tree, 1000);
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, fwt_flag(tree));
+
+        fwt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_query(), {
+        for (size_t i = 0; i < 1000; i++)
+            fwt_values[i] = i * 3 + 1;
+
+        struct fenwicktree *tree = fwt_new(fwt_values, 1000, fwt_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t from = 0; from < 1000; from += 7)
+        {
+            size_t sum = 0;
+
+            for (size_t to = from; to < 1000; to++)
+            {
+                sum += fwt_values[to];
+
+                if (to % 13 == 0 || to == from)
+                    cmc_assert_equals(size_t, sum, fwt_query(tree, from, to));
+            }
+        }
+
+        cmc_assert_equals(size_t, 0, fwt_query(tree, 10, 9));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, fwt_flag(tree));
+        cmc_assert_equals(size_t, 0, fwt_query(tree, 10, 1000));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, fwt_flag(tree));
+
+        fwt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_query[combines], {
+        for (size_t i = 0; i < 777; i++)
+            fwt_values[i] = i % 10;
+
+        struct fenwicktree *tree = fwt_new(fwt_values, 777, fwt_fval_counted);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 777; i += 5)
+        {
+            cmc_assert(fwt_update(tree, i, 3));
+            fwt_values[i] += 3;
+        }
+
+        /* 777 values fit in 10 bits so a range is at most 20 blocks */
+        for (size_t from = 0; from < 777; from += 3)
+        {
+            size_t sum = 0;
+
+            for (size_t to = from; to < 777; to++)
+            {
+                sum += fwt_values[to];
+
+                fwt_combines = 0;
+
+                cmc_assert_equals(size_t, sum, fwt_query(tree, from, to));
+                cmc_assert_lesser_equals(size_t, 19, fwt_combines);
+            }
+        }
+
+        fwt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_update(), {
+        for (size_t i = 0; i < 1000; i++)
+            fwt_values[i] = 0;
+
+        struct fenwicktree *tree = fwt_new(fwt_values, 1000, fwt_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 1000; i += 3)
+        {
+            cmc_assert(fwt_update(tree, i, i));
+            fwt_values[i] += i;
+        }
+
+        cmc_assert(fwt_update(tree, 500, 7));
+        fwt_values[500] += 7;
+
+        size_t sum = 0;
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            sum += fwt_values[i];
+            cmc_assert_equals(size_t, fwt_values[i], fwt_get(tree, i));
+            cmc_assert_equals(size_t, sum, fwt_prefix(tree, i));
+        }
+
+        cmc_assert_equals(size_t, 7 + 501 + 504, fwt_query(tree, 499, 505));
+
+        cmc_assert(!fwt_update(tree, 1000, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, fwt_flag(tree));
+
+        fwt_get(tree, 1000);
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, fwt_flag(tree));
+
+        fwt_free(tree);
+    });
+
+    CMC_CREATE_TEST(combine, {
+        for (size_t i = 0; i < 64; i++)
+            fwt_values[i] = (size_t)1 << i;
+
+        struct fenwicktree *tree = fwt_new(fwt_values, 64, fwt_fval_or);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        cmc_assert_equals(size_t, 0xF0, fwt_query(tree, 4, 7));
+        cmc_assert_equals(size_t, 0xFF, fwt_prefix(tree, 7));
+        cmc_assert_equals(size_t, SIZE_MAX, fwt_prefix(tree, 63));
+
+        cmc_assert(fwt_update(tree, 5, 1));
+        cmc_assert_equals(size_t, 0x21, fwt_get(tree, 5));
+        cmc_assert_equals(size_t, 0x31, fwt_query(tree, 4, 5));
+
+        fwt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of() PFX##_equals(), {
+        for (size_t i = 0; i < 1000; i++)
+            fwt_values[i] = i;
+
+        struct fenwicktree *tree1 = fwt_new(fwt_values, 1000, fwt_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree1);
+
+        struct fenwicktree *tree2 = fwt_copy_of(tree1);
+
+        cmc_assert_not_equals(ptr, NULL, tree2);
+        cmc_assert(fwt_equals(tree1, tree2));
+        cmc_assert_equals(size_t, fwt_prefix(tree1, 999), fwt_prefix(tree2, 999));
+
+        cmc_assert(fwt_update(tree2, 10, 1));
+        cmc_assert(!fwt_equals(tree1, tree2));
+
+        fwt_free(tree1);
+        fwt_free(tree2);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct fenwicktree *tree = fwt_new_custom(fwt_values, 1000, fwt_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(fwt_update(tree, 1, 1));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        fwt_get(tree, 1);
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        fwt_prefix(tree, 10);
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        fwt_query(tree, 5, 10);
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert_equals(int32_t, 0, total_create);
+        cmc_assert_equals(int32_t, 3, total_read);
+        cmc_assert_equals(int32_t, 1, total_update);
+        cmc_assert_equals(int32_t, 0, total_delete);
+        cmc_assert_equals(int32_t, 0, total_resize);
+
+        fwt_customize(tree, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, tree->callbacks);
+
+        fwt_free(tree);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_FENWICKTREE_H */
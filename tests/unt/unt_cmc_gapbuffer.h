@@ -0,0 +1,520 @@
+#ifndef CMC_TESTS_UNT_CMC_GAPBUFFER_H
+#define CMC_TESTS_UNT_CMC_GAPBUFFER_H
+
+#include "utl.h"
+
+#include "tst_cmc_gapbuffer.h"
+
+struct gapbuffer_fval *gb_fval = &(struct gapbuffer_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct cmc_alloc_node *gb_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+/* Reference sequence for the randomized edits */
+size_t gb_reference[2000];
+
+CMC_CREATE_UNIT(CMCGapBuffer, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct gapbuffer *gb = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+        cmc_assert_not_equals(ptr, NULL, gb->buffer);
+        cmc_assert_equals(size_t, 100, gb_capacity(gb));
+        cmc_assert_equals(size_t, 0, gb_count(gb));
+        cmc_assert_equals(size_t, 0, gb_cursor(gb));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, gb_flag(gb));
+        cmc_assert_equals(ptr, gb_fval, gb->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, gb->alloc->malloc);
+        cmc_assert_equals(ptr, NULL, gb->callbacks);
+
+        gb_free(gb);
+
+        cmc_assert_equals(ptr, NULL, gb_new(0, gb_fval));
+        cmc_assert_equals(ptr, NULL, gb_new(100, NULL));
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct gapbuffer *gb = gb_new_custom(100, gb_fval, gb_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+        cmc_assert_equals(ptr, gb_alloc_node, gb->alloc);
+        cmc_assert_equals(ptr, callbacks, gb->callbacks);
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_clear(), {
+        struct gapbuffer *gb = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        for (size_t i = 0; i < 150; i++)
+            cmc_assert(gb_push_at(gb, i, i / 2));
+
+        gb_clear(gb);
+
+        cmc_assert_equals(size_t, 0, gb_count(gb));
+        cmc_assert_equals(size_t, 0, gb_cursor(gb));
+        cmc_assert_equals(size_t, 200, gb_capacity(gb));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_push_front(), {
+        struct gapbuffer *gb = gb_new(1, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(gb_push_front(gb, i));
+
+        cmc_assert_equals(size_t, 1000, gb_count(gb));
+        cmc_assert_equals(size_t, 1, gb_cursor(gb));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert_equals(size_t, 999 - i, gb_get(gb, i));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_push_back(), {
+        struct gapbuffer *gb = gb_new(1, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(gb_push_back(gb, i));
+
+        cmc_assert_equals(size_t, 1000, gb_count(gb));
+        cmc_assert_equals(size_t, 1000, gb_cursor(gb));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert_equals(size_t, i, gb_get(gb, i));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_push_at(), {
+        struct gapbuffer *gb = gb_new(10, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        cmc_assert(!gb_push_at(gb, 1, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, gb_flag(gb));
+
+        /* Typing at a cursor in the middle */
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(gb_push_back(gb, i < 50 ? i : i + 100));
+
+        cmc_assert(gb_move_cursor(gb, 50));
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            cmc_assert(gb_push_at(gb, i + 50, gb_cursor(gb)));
+            cmc_assert_equals(size_t, i + 51, gb_cursor(gb));
+        }
+
+        cmc_assert_equals(size_t, 200, gb_count(gb));
+
+        for (size_t i = 0; i < 200; i++)
+            cmc_assert_equals(size_t, i, gb_get(gb, i));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_pop_at(), {
+        struct gapbuffer *gb = gb_new(10, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        cmc_assert(!gb_pop_at(gb, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, gb_flag(gb));
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(gb_push_back(gb, i));
+
+        cmc_assert(!gb_pop_at(gb, 100));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, gb_flag(gb));
+
+        /* Deleting backwards from a cursor */
+        for (size_t i = 60; i > 40; i--)
+        {
+            cmc_assert(gb_pop_at(gb, i - 1));
+            cmc_assert_equals(size_t, i - 1, gb_cursor(gb));
+        }
+
+        cmc_assert_equals(size_t, 80, gb_count(gb));
+
+        for (size_t i = 0; i < 80; i++)
+            cmc_assert_equals(size_t, i < 40 ? i : i + 20, gb_get(gb, i));
+
+        cmc_assert(gb_pop_front(gb));
+        cmc_assert(gb_pop_back(gb));
+        cmc_assert_equals(size_t, 1, gb_front(gb));
+        cmc_assert_equals(size_t, 98, gb_back(gb));
+
+        while (!gb_empty(gb))
+            cmc_assert(gb_pop_back(gb));
+
+        cmc_assert(!gb_pop_back(gb));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, gb_flag(gb));
+        cmc_assert(!gb_pop_front(gb));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(edits[random], {
+        struct gapbuffer *gb = gb_new(4, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        size_t count = 0;
+        size_t cursor = 0;
+        size_t seed = 42;
+
+        /* Edits mostly around a moving cursor checked against a plain array */
+        for (size_t step = 0; step < 20000; step++)
+        {
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+            size_t r = seed >> 33;
+
+            if (r % 16 == 0)
+                cursor = count == 0 ? 0 : (r >> 4) % (count + 1);
+
+            if (count < 1900 && (count == 0 || r % 3 != 0))
+            {
+                memmove(gb_reference + cursor + 1, gb_reference + cursor, sizeof(size_t) * (count - cursor));
+                gb_reference[cursor] = step;
+                count++;
+
+                cmc_assert(gb_push_at(gb, step, cursor));
+
+                cursor++;
+            }
+            else
+            {
+                size_t index = cursor > 0 ? cursor - 1 : 0;
+
+                memmove(gb_reference + index, gb_reference + index + 1, sizeof(size_t) * (count - index - 1));
+                count--;
+
+                cmc_assert(gb_pop_at(gb, index));
+
+                cursor = index;
+            }
+
+            cmc_assert_equals(size_t, count, gb_count(gb));
+        }
+
+        for (size_t i = 0; i < count; i++)
+            cmc_assert_equals(size_t, gb_reference[i], gb_get(gb, i));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_move_cursor(), {
+        struct gapbuffer *gb = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(gb_push_back(gb, i));
+
+        cmc_assert(gb_move_cursor(gb, 10));
+        cmc_assert_equals(size_t, 10, gb_cursor(gb));
+        cmc_assert(gb_move_cursor(gb, 50));
+        cmc_assert(gb_move_cursor(gb, 0));
+        cmc_assert(!gb_move_cursor(gb, 51));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, gb_flag(gb));
+        cmc_assert_equals(size_t, 0, gb_cursor(gb));
+
+        /* Moving the cursor never changes the elements */
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert_equals(size_t, i, gb_get(gb, i));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_get(), {
+        struct gapbuffer *gb = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        cmc_assert_equals(size_t, 0, gb_get(gb, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, gb_flag(gb));
+        cmc_assert_equals(ptr, NULL, gb_get_ref(gb, 0));
+        cmc_assert_equals(size_t, 0, gb_front(gb));
+        cmc_assert_equals(size_t, 0, gb_back(gb));
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(gb_push_back(gb, i));
+
+        cmc_assert(gb_move_cursor(gb, 25));
+
+        cmc_assert_equals(size_t, 0, gb_get(gb, 50));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, gb_flag(gb));
+        cmc_assert_equals(ptr, NULL, gb_get_ref(gb, 50));
+
+        size_t *ref = gb_get_ref(gb, 30);
+
+        cmc_assert_not_equals(ptr, NULL, ref);
+        cmc_assert_equals(size_t, 30, *ref);
+
+        *ref = 300;
+
+        cmc_assert_equals(size_t, 300, gb_get(gb, 30));
+        cmc_assert_equals(size_t, 0, gb_front(gb));
+        cmc_assert_equals(size_t, 49, gb_back(gb));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_index_of(), {
+        struct gapbuffer *gb = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(gb_push_back(gb, i % 10));
+
+        cmc_assert(gb_move_cursor(gb, 25));
+
+        cmc_assert_equals(size_t, 7, gb_index_of(gb, 7, true));
+        cmc_assert_equals(size_t, 47, gb_index_of(gb, 7, false));
+        cmc_assert_equals(size_t, 50, gb_index_of(gb, 10, true));
+        cmc_assert_equals(size_t, 50, gb_index_of(gb, 10, false));
+        cmc_assert(gb_contains(gb, 9));
+        cmc_assert(!gb_contains(gb, 10));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_resize(), {
+        struct gapbuffer *gb = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(gb_push_back(gb, i));
+
+        cmc_assert(gb_move_cursor(gb, 20));
+
+        cmc_assert(gb_resize(gb, 1000));
+        cmc_assert_equals(size_t, 1000, gb_capacity(gb));
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert_equals(size_t, i, gb_get(gb, i));
+
+        cmc_assert(gb_resize(gb, 50));
+        cmc_assert(gb_full(gb));
+        cmc_assert(!gb_fits(gb, 1));
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert_equals(size_t, i, gb_get(gb, i));
+
+        cmc_assert(!gb_resize(gb, 49));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, gb_flag(gb));
+
+        cmc_assert(gb_push_at(gb, 100, 10));
+        cmc_assert_equals(size_t, 100, gb_capacity(gb));
+        cmc_assert_equals(size_t, 100, gb_get(gb, 10));
+        cmc_assert_equals(size_t, 49, gb_back(gb));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of(), {
+        struct gapbuffer *gb1 = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb1);
+
+        for (size_t i = 0; i < 80; i++)
+            cmc_assert(gb_push_at(gb1, i, i / 2));
+
+        struct gapbuffer *gb2 = gb_copy_of(gb1);
+
+        cmc_assert_not_equals(ptr, NULL, gb2);
+        cmc_assert_equals(size_t, 80, gb_count(gb2));
+        cmc_assert(gb_equals(gb1, gb2));
+
+        for (size_t i = 0; i < 80; i++)
+            cmc_assert_equals(size_t, gb_get(gb1, i), gb_get(gb2, i));
+
+        cmc_assert(gb_pop_at(gb2, 5));
+        cmc_assert(!gb_equals(gb1, gb2));
+        cmc_assert(gb_push_at(gb2, gb_get(gb1, 5), 5));
+        cmc_assert(gb_equals(gb1, gb2));
+
+        gb_free(gb1);
+        gb_free(gb2);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct gapbuffer *gb = gb_new_custom(1, gb_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(gb_push_front(gb, 10));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        cmc_assert(gb_push_back(gb, 10));
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        cmc_assert(gb_push_at(gb, 10, 1));
+        cmc_assert_equals(int32_t, 3, total_create);
+        cmc_assert_equals(int32_t, 2, total_resize);
+
+        cmc_assert(gb_pop_at(gb, 1));
+        cmc_assert_equals(int32_t, 1, total_delete);
+
+        cmc_assert(gb_pop_front(gb));
+        cmc_assert_equals(int32_t, 2, total_delete);
+
+        cmc_assert_equals(size_t, 10, gb_front(gb));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert_equals(size_t, 10, gb_back(gb));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert_equals(size_t, 10, gb_get(gb, 0));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert_not_equals(ptr, NULL, gb_get_ref(gb, 0));
+        cmc_assert_equals(int32_t, 4, total_read);
+
+        cmc_assert(gb_contains(gb, 10));
+        cmc_assert_equals(int32_t, 5, total_read);
+
+        cmc_assert(gb_pop_back(gb));
+        cmc_assert_equals(int32_t, 3, total_delete);
+
+        cmc_assert(gb_move_cursor(gb, 0));
+
+        cmc_assert_equals(int32_t, 3, total_create);
+        cmc_assert_equals(int32_t, 5, total_read);
+        cmc_assert_equals(int32_t, 0, total_update);
+        cmc_assert_equals(int32_t, 3, total_delete);
+        cmc_assert_equals(int32_t, 2, total_resize);
+
+        gb_customize(gb, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, gb->callbacks);
+
+        gb_free(gb);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+CMC_CREATE_UNIT(CMCGapBufferIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct gapbuffer *gb = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        struct gapbuffer_iter it = gb_iter_start(gb);
+
+        cmc_assert(gb_iter_at_start(&it));
+        cmc_assert(gb_iter_at_end(&it));
+        cmc_assert(!gb_iter_next(&it));
+        cmc_assert_equals(ptr, NULL, gb_iter_rvalue(&it));
+
+        cmc_assert(gb_push_back(gb, 1));
+        cmc_assert(gb_push_back(gb, 2));
+
+        it = gb_iter_start(gb);
+
+        cmc_assert(gb_iter_at_start(&it));
+        cmc_assert(!gb_iter_at_end(&it));
+        cmc_assert_equals(size_t, 1, gb_iter_value(&it));
+
+        it = gb_iter_end(gb);
+
+        cmc_assert(!gb_iter_at_start(&it));
+        cmc_assert(gb_iter_at_end(&it));
+        cmc_assert_equals(size_t, 2, gb_iter_value(&it));
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct gapbuffer *gb = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        for (size_t i = 0; i < 200; i++)
+            cmc_assert(gb_push_back(gb, i));
+
+        cmc_assert(gb_move_cursor(gb, 77));
+
+        size_t index = 0;
+
+        for (struct gapbuffer_iter it = gb_iter_start(gb); !gb_iter_at_end(&it); gb_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, index, gb_iter_index(&it));
+            cmc_assert_equals(size_t, index, gb_iter_value(&it));
+            cmc_assert_equals(size_t, index, *gb_iter_rvalue(&it));
+            index++;
+        }
+
+        cmc_assert_equals(size_t, 200, index);
+
+        for (struct gapbuffer_iter it = gb_iter_end(gb); !gb_iter_at_start(&it); gb_iter_prev(&it))
+        {
+            index--;
+            cmc_assert_equals(size_t, index, gb_iter_value(&it));
+        }
+
+        cmc_assert_equals(size_t, 0, index);
+
+        gb_free(gb);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_go_to(), {
+        struct gapbuffer *gb = gb_new(100, gb_fval);
+
+        cmc_assert_not_equals(ptr, NULL, gb);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(gb_push_back(gb, i));
+
+        cmc_assert(gb_move_cursor(gb, 33));
+
+        struct gapbuffer_iter it = gb_iter_start(gb);
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            size_t index = (i * 37) % 100;
+
+            cmc_assert(gb_iter_go_to(&it, index));
+            cmc_assert_equals(size_t, index, gb_iter_value(&it));
+        }
+
+        cmc_assert(!gb_iter_go_to(&it, 100));
+
+        cmc_assert(gb_iter_to_start(&it));
+        cmc_assert(gb_iter_advance(&it, 99));
+        cmc_assert_equals(size_t, 99, gb_iter_value(&it));
+        cmc_assert(gb_iter_rewind(&it, 99));
+        cmc_assert_equals(size_t, 0, gb_iter_value(&it));
+        cmc_assert(gb_iter_to_end(&it));
+        cmc_assert_equals(size_t, 99, gb_iter_value(&it));
+
+        gb_free(gb);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_GAPBUFFER_H */
@@ -0,0 +1,489 @@
+#ifndef CMC_TESTS_UNT_CMC_HASHDISJOINTSET_H
+#define CMC_TESTS_UNT_CMC_HASHDISJOINTSET_H
+
+#include "utl.h"
+
+#include "tst_cmc_hashdisjointset.h"
+
+struct hashdisjointset_fkey *hdjs_fkey = &(struct hashdisjointset_fkey){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct hashdisjointset_fkey *hdjs_fkey_counter = &(struct hashdisjointset_fkey){
+    .cmp = k_c_cmp, .cpy = k_c_cpy, .str = k_c_str, .free = k_c_free, .hash = k_c_hash, .pri = k_c_pri
+};
+
+struct cmc_alloc_node *hdjs_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+/* Amount of reallocations that succeed before one fails */
+static size_t hdjs_realloc_left = 0;
+
+static void *hdjs_failing_realloc(void *ptr, size_t size)
+{
+    if (hdjs_realloc_left == 0)
+        return NULL;
+
+    hdjs_realloc_left--;
+
+    return realloc(ptr, size);
+}
+
+struct cmc_alloc_node *hdjs_alloc_node_failing =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = hdjs_failing_realloc, .free = free };
+
+CMC_CREATE_UNIT(CMCHashDisjointSet, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct hashdisjointset *set = hdjs_new(943722, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+        cmc_assert_not_equals(ptr, NULL, set->keys);
+        cmc_assert_not_equals(ptr, NULL, set->buckets);
+        cmc_assert_equals(size_t, 943722, hdjs_capacity(set));
+        cmc_assert_greater_equals(size_t, (size_t)(943722 / 0.6), set->bucket_count);
+        cmc_assert_equals(size_t, 0, hdjs_count(set));
+        cmc_assert_equals(size_t, 0, hdjs_set_count(set));
+        cmc_assert(hdjs_empty(set));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, hdjs_flag(set));
+        cmc_assert_equals(ptr, hdjs_fkey, set->f_key);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, set->alloc->malloc);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.free, set->alloc->free);
+        cmc_assert_equals(ptr, NULL, set->callbacks);
+
+        hdjs_free(set);
+
+        set = hdjs_new(0, 0.6, hdjs_fkey);
+        cmc_assert_equals(ptr, NULL, set);
+
+        set = hdjs_new(100, 0.0, hdjs_fkey);
+        cmc_assert_equals(ptr, NULL, set);
+
+        set = hdjs_new(100, 1.0, hdjs_fkey);
+        cmc_assert_equals(ptr, NULL, set);
+
+        set = hdjs_new(100, 0.6, NULL);
+        cmc_assert_equals(ptr, NULL, set);
+
+        set = hdjs_new(UINT64_MAX, 0.99, hdjs_fkey);
+        cmc_assert_equals(ptr, NULL, set);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct hashdisjointset *set = hdjs_new_custom(100, 0.6, hdjs_fkey, hdjs_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+        cmc_assert_equals(ptr, hdjs_alloc_node, set->alloc);
+        cmc_assert_equals(ptr, callbacks, set->callbacks);
+
+        hdjs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_clear(), {
+        struct hashdisjointset *set = hdjs_new(100, 0.6, hdjs_fkey_counter);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        k_total_free = 0;
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(hdjs_insert(set, i * 1000));
+
+        cmc_assert(hdjs_union(set, 0, 49000));
+
+        hdjs_clear(set);
+
+        cmc_assert_equals(int32_t, 50, k_total_free);
+        cmc_assert_equals(size_t, 0, hdjs_count(set));
+        cmc_assert_equals(size_t, 0, hdjs_set_count(set));
+        cmc_assert(!hdjs_contains(set, 0));
+        cmc_assert(!hdjs_contains(set, 49000));
+
+        cmc_assert(hdjs_insert(set, 49000));
+        cmc_assert_equals(size_t, 1, hdjs_set_size(set, 49000));
+
+        hdjs_free(set);
+
+        cmc_assert_equals(int32_t, 51, k_total_free);
+
+        k_total_free = 0;
+    });
+
+    CMC_CREATE_TEST(PFX##_insert(), {
+        struct hashdisjointset *set = hdjs_new(1, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 1; i <= 1000; i++)
+            cmc_assert(hdjs_insert(set, i * 7919));
+
+        cmc_assert_equals(size_t, 1000, hdjs_count(set));
+        cmc_assert_equals(size_t, 1000, hdjs_set_count(set));
+        cmc_assert_greater_equals(size_t, 1000, hdjs_capacity(set));
+
+        for (size_t i = 1; i <= 1000; i++)
+        {
+            size_t root;
+
+            cmc_assert(hdjs_contains(set, i * 7919));
+            cmc_assert(hdjs_find(set, i * 7919, &root));
+            cmc_assert_equals(size_t, i * 7919, root);
+        }
+
+        cmc_assert(!hdjs_contains(set, 0));
+        cmc_assert(!hdjs_insert(set, 7919));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, hdjs_flag(set));
+        cmc_assert_equals(size_t, 1000, hdjs_count(set));
+
+        hdjs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_union() PFX##_connected(), {
+        struct hashdisjointset *set = hdjs_new(100, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        cmc_assert(!hdjs_union(set, 1, 2));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, hdjs_flag(set));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(hdjs_insert(set, i));
+
+        /* Groups by the remainder of 10 */
+        for (size_t i = 10; i < 1000; i++)
+            cmc_assert(hdjs_union(set, i, i - 10));
+
+        cmc_assert_equals(size_t, 10, hdjs_set_count(set));
+
+        for (size_t i = 0; i < 1000; i += 7)
+        {
+            for (size_t j = 0; j < 1000; j += 13)
+                cmc_assert_equals(bool, i % 10 == j % 10, hdjs_connected(set, i, j));
+        }
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert_equals(size_t, 100, hdjs_set_size(set, i));
+
+        cmc_assert(!hdjs_union(set, 5, 995));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, hdjs_flag(set));
+
+        cmc_assert(hdjs_union(set, 1, 2));
+        cmc_assert_equals(size_t, 200, hdjs_set_size(set, 991));
+        cmc_assert_equals(size_t, 9, hdjs_set_count(set));
+
+        cmc_assert(!hdjs_union(set, 1, 1000));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, hdjs_flag(set));
+        cmc_assert(!hdjs_connected(set, 1000, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, hdjs_flag(set));
+        cmc_assert_equals(size_t, 0, hdjs_set_size(set, 1000));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, hdjs_flag(set));
+
+        size_t root;
+
+        cmc_assert(!hdjs_find(set, 1000, &root));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, hdjs_flag(set));
+
+        hdjs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_resize(), {
+        struct hashdisjointset *set = hdjs_new(10, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hdjs_insert(set, i * 3));
+
+        cmc_assert(hdjs_union(set, 0, 27));
+
+        cmc_assert(hdjs_resize(set, 1000));
+        cmc_assert_equals(size_t, 1000, hdjs_capacity(set));
+        cmc_assert_equals(size_t, 10, hdjs_count(set));
+        cmc_assert(hdjs_connected(set, 0, 27));
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hdjs_contains(set, i * 3));
+
+        cmc_assert(hdjs_resize(set, 10));
+        cmc_assert_equals(size_t, 10, hdjs_capacity(set));
+        cmc_assert(hdjs_connected(set, 0, 27));
+
+        cmc_assert(!hdjs_resize(set, 9));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, hdjs_flag(set));
+        cmc_assert_equals(size_t, 10, hdjs_capacity(set));
+
+        hdjs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_resize[alloc], {
+        struct hashdisjointset *set = hdjs_new_custom(100, 0.6, hdjs_fkey, hdjs_alloc_node_failing, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hdjs_insert(set, i));
+
+        cmc_assert(hdjs_union(set, 0, 9));
+
+        /* Only the first array shrinks */
+        hdjs_realloc_left = 1;
+
+        cmc_assert(hdjs_resize(set, 20));
+        cmc_assert_equals(size_t, 20, hdjs_capacity(set));
+
+        for (size_t i = 10; i < 20; i++)
+            cmc_assert(hdjs_insert(set, i));
+
+        /* Only the first two arrays grow */
+        hdjs_realloc_left = 2;
+
+        cmc_assert(!hdjs_insert(set, 20));
+        cmc_assert_equals(int32_t, CMC_FLAG_ALLOC, hdjs_flag(set));
+        cmc_assert_equals(size_t, 20, hdjs_capacity(set));
+
+        hdjs_realloc_left = SIZE_MAX;
+
+        for (size_t i = 20; i < 60; i++)
+            cmc_assert(hdjs_insert(set, i));
+
+        cmc_assert(hdjs_union(set, 9, 59));
+
+        for (size_t i = 0; i < 60; i++)
+            cmc_assert(hdjs_contains(set, i));
+
+        cmc_assert(hdjs_connected(set, 0, 59));
+        cmc_assert_equals(size_t, 60, hdjs_count(set));
+
+        hdjs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of() PFX##_equals(), {
+        struct hashdisjointset *set1 = hdjs_new(100, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set1);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(hdjs_insert(set1, i * 11));
+
+        for (size_t i = 3; i < 100; i++)
+            cmc_assert(hdjs_union(set1, i * 11, (i % 3) * 11));
+
+        struct hashdisjointset *set2 = hdjs_copy_of(set1);
+
+        cmc_assert_not_equals(ptr, NULL, set2);
+        cmc_assert(hdjs_equals(set1, set2));
+        cmc_assert_equals(size_t, 3, hdjs_set_count(set2));
+        cmc_assert(hdjs_connected(set2, 0, 99 * 11));
+
+        /* Same partition with keys inserted in a different order */
+        struct hashdisjointset *set3 = hdjs_new(10, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set3);
+
+        for (size_t i = 100; i > 0; i--)
+            cmc_assert(hdjs_insert(set3, (i - 1) * 11));
+
+        for (size_t i = 99; i >= 3; i--)
+            cmc_assert(hdjs_union(set3, (i - 3) * 11, i * 11));
+
+        cmc_assert(hdjs_equals(set1, set3));
+        cmc_assert(hdjs_equals(set3, set1));
+
+        cmc_assert(hdjs_union(set2, 0, 11));
+        cmc_assert(!hdjs_equals(set1, set2));
+        cmc_assert(!hdjs_equals(set2, set1));
+
+        cmc_assert(hdjs_insert(set3, 100 * 11));
+        cmc_assert(!hdjs_equals(set1, set3));
+
+        hdjs_free(set1);
+        hdjs_free(set2);
+        hdjs_free(set3);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct hashdisjointset *set = hdjs_new_custom(1, 0.6, hdjs_fkey, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(hdjs_insert(set, 1));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        cmc_assert(hdjs_insert(set, 2));
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        cmc_assert(hdjs_union(set, 1, 2));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert(hdjs_find(set, 1, NULL));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert(hdjs_contains(set, 1));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert(hdjs_connected(set, 1, 2));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert_equals(size_t, 2, hdjs_set_size(set, 2));
+        cmc_assert_equals(int32_t, 4, total_read);
+
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 4, total_read);
+        cmc_assert_equals(int32_t, 1, total_update);
+        cmc_assert_equals(int32_t, 0, total_delete);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        hdjs_customize(set, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, set->callbacks);
+
+        hdjs_free(set);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+CMC_CREATE_UNIT(CMCHashDisjointSetIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct hashdisjointset *set = hdjs_new(100, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        struct hashdisjointset_iter it = hdjs_iter_start(set, 5);
+
+        cmc_assert_equals(size_t, 0, it.count);
+        cmc_assert(hdjs_iter_at_start(&it));
+        cmc_assert(hdjs_iter_at_end(&it));
+        cmc_assert(!hdjs_iter_next(&it));
+        cmc_assert_equals(size_t, 0, hdjs_iter_key(&it));
+
+        cmc_assert(hdjs_insert(set, 5));
+
+        it = hdjs_iter_start(set, 5);
+
+        cmc_assert_equals(ptr, set, it.target);
+        cmc_assert_equals(size_t, 1, it.count);
+        cmc_assert(hdjs_iter_at_start(&it));
+        cmc_assert(!hdjs_iter_at_end(&it));
+        cmc_assert_equals(size_t, 5, hdjs_iter_key(&it));
+
+        hdjs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct hashdisjointset *set = hdjs_new(100, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(hdjs_insert(set, i * 10));
+
+        for (size_t i = 4; i < 100; i++)
+            cmc_assert(hdjs_union(set, i * 10, (i % 4) * 10));
+
+        for (size_t start = 0; start < 100; start++)
+        {
+            bool seen[25] = { false };
+            size_t index = 0;
+
+            struct hashdisjointset_iter it = hdjs_iter_start(set, start * 10);
+
+            cmc_assert_equals(size_t, 25, it.count);
+            cmc_assert_equals(size_t, start * 10, hdjs_iter_key(&it));
+
+            for (; !hdjs_iter_at_end(&it); hdjs_iter_next(&it))
+            {
+                size_t key = hdjs_iter_key(&it) / 10;
+
+                cmc_assert_equals(size_t, start % 4, key % 4);
+                cmc_assert(!seen[key / 4]);
+                cmc_assert_equals(size_t, index, hdjs_iter_index(&it));
+
+                seen[key / 4] = true;
+                index++;
+            }
+
+            cmc_assert_equals(size_t, 25, index);
+        }
+
+        hdjs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        struct hashdisjointset *set = hdjs_new(100, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(hdjs_insert(set, i));
+
+        for (size_t i = 1; i < 50; i++)
+            cmc_assert(hdjs_union(set, 0, i));
+
+        size_t sum = 0;
+        size_t index = 50;
+
+        struct hashdisjointset_iter it = hdjs_iter_end(set, 10);
+
+        cmc_assert_equals(size_t, 49, hdjs_iter_index(&it));
+
+        for (; !hdjs_iter_at_start(&it); hdjs_iter_prev(&it))
+        {
+            index--;
+            sum += hdjs_iter_key(&it);
+            cmc_assert_equals(size_t, index, hdjs_iter_index(&it));
+        }
+
+        cmc_assert_equals(size_t, 0, index);
+        cmc_assert_equals(size_t, 49 * 50 / 2, sum);
+        cmc_assert_equals(size_t, 10, hdjs_iter_key(&it));
+
+        hdjs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_go_to(), {
+        struct hashdisjointset *set = hdjs_new(100, 0.6, hdjs_fkey);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(hdjs_insert(set, i));
+
+        for (size_t i = 1; i < 100; i++)
+            cmc_assert(hdjs_union(set, 0, i));
+
+        struct hashdisjointset_iter it1 = hdjs_iter_start(set, 0);
+        struct hashdisjointset_iter it2 = hdjs_iter_start(set, 0);
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            cmc_assert(hdjs_iter_go_to(&it2, i));
+            cmc_assert_equals(size_t, hdjs_iter_key(&it1), hdjs_iter_key(&it2));
+            hdjs_iter_next(&it1);
+        }
+
+        cmc_assert(!hdjs_iter_go_to(&it2, 100));
+
+        cmc_assert(hdjs_iter_to_start(&it2));
+        cmc_assert(hdjs_iter_advance(&it2, 99));
+        cmc_assert_equals(size_t, hdjs_iter_key(&it1), hdjs_iter_key(&it2));
+        cmc_assert(hdjs_iter_rewind(&it2, 99));
+        cmc_assert_equals(size_t, 0, hdjs_iter_key(&it2));
+        cmc_assert(hdjs_iter_to_end(&it2));
+        cmc_assert_equals(size_t, hdjs_iter_key(&it1), hdjs_iter_key(&it2));
+
+        hdjs_free(set);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_HASHDISJOINTSET_H */
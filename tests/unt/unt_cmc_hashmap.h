@@ -185,14 +185,39 @@ CMC_CREATE_UNIT(CMCHashMap, true, {
         cmc_assert_equals(int32_t, 1000, k_total_free);
         cmc_assert_equals(int32_t, 1000, v_total_free);
 
-        // The buffer is still valid and all zeroes
-        cmc_assert_equals(size_t, 0, *r);
+        // The entries are left behind in an older epoch
+        cmc_assert(!hm_contains(map, 100));
+        cmc_assert_equals(ptr, NULL, hm_get_ref(map, 100));
 
         hm_free(map);
         k_total_free = 0;
         v_total_free = 0;
     });
 
+    CMC_CREATE_TEST(PFX##_clear()[epoch wraparound], {
+        struct hashmap *map = hm_new(100, 0.6, hm_fkey, hm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 3 * UINT16_MAX; i++)
+        {
+            cmc_assert(hm_insert(map, i, i));
+            cmc_assert(hm_insert(map, i + 1, i));
+            cmc_assert(hm_remove(map, i + 1, NULL));
+
+            hm_clear(map);
+
+            cmc_assert(!hm_contains(map, i));
+        }
+
+        cmc_assert_equals(size_t, 0, hm_count(map));
+
+        for (size_t i = 0; i < 3 * UINT16_MAX; i++)
+            cmc_assert(!hm_contains(map, i));
+
+        hm_free(map);
+    });
+
     CMC_CREATE_TEST(PFX##_free(), {
         k_total_free = 0;
         v_total_free = 0;
@@ -409,6 +434,113 @@ CMC_CREATE_UNIT(CMCHashMap, true, {
         hm_free(map);
     });
 
+    CMC_CREATE_TEST(insert[robin hood distances], {
+        struct hashmap *map = hm_new(5000, 0.9, hm_fkey, hm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 5000; i++)
+            cmc_assert(hm_insert(map, i * 7919, i));
+
+        size_t capacity = hm_capacity(map);
+
+        // Every displaced entry must keep track of its distance
+        for (size_t i = 0; i < capacity; i++)
+        {
+            struct hashmap_entry *entry = &(map->buffer[i]);
+
+            if (entry->state == CMC_ES_FILLED)
+            {
+                size_t home = map->f_key->hash(entry->key) % capacity;
+                size_t dist = (i + capacity - home) % capacity;
+
+                cmc_assert_equals(size_t, dist, entry->dist);
+            }
+        }
+
+        for (size_t i = 0; i < 5000; i++)
+        {
+            size_t value = hm_get(map, i * 7919);
+            cmc_assert_equals(size_t, i, value);
+        }
+
+        hm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_insert_ptr(), {
+        struct hashmap *map = hm_new(100, 0.6, hm_fkey, hm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            size_t value = i * 2;
+
+            map->flag = CMC_FLAG_ERROR;
+            cmc_assert(hm_insert_ptr(map, &i, &value));
+            cmc_assert_equals(int32_t, CMC_FLAG_OK, hm_flag(map));
+        }
+
+        cmc_assert_equals(size_t, 1000, hm_count(map));
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            size_t value = hm_get(map, i);
+            cmc_assert_equals(size_t, i * 2, value);
+        }
+
+        size_t key = 10;
+        size_t value = 10;
+
+        cmc_assert(!hm_insert_ptr(map, &key, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, hm_flag(map));
+        cmc_assert_equals(size_t, 1000, hm_count(map));
+
+        hm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_emplace(), {
+        struct hashmap *map = hm_new(100, 0.6, hm_fkey, hm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            map->flag = CMC_FLAG_ERROR;
+            size_t *value = hm_emplace(map, i);
+
+            cmc_assert_not_equals(ptr, NULL, value);
+            cmc_assert_equals(int32_t, CMC_FLAG_OK, hm_flag(map));
+            cmc_assert_equals(size_t, 0, *value);
+
+            *value = i + 1;
+        }
+
+        cmc_assert_equals(size_t, 1000, hm_count(map));
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            size_t value = hm_get(map, i);
+            cmc_assert_equals(size_t, i + 1, value);
+        }
+
+        cmc_assert_equals(ptr, NULL, hm_emplace(map, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, hm_flag(map));
+
+        // Slots left behind by a removal or a clear are handed out zeroed
+        cmc_assert(hm_remove(map, 10, NULL));
+        size_t *value = hm_emplace(map, 10);
+        cmc_assert_not_equals(ptr, NULL, value);
+        cmc_assert_equals(size_t, 0, *value);
+
+        hm_clear(map);
+        value = hm_emplace(map, 20);
+        cmc_assert_not_equals(ptr, NULL, value);
+        cmc_assert_equals(size_t, 0, *value);
+
+        hm_free(map);
+    });
+
     CMC_CREATE_TEST(PFX##_update(), {
         struct hashmap *map = hm_new(100, 0.6, hm_fkey, hm_fval);
 
@@ -690,6 +822,68 @@ CMC_CREATE_UNIT(CMCHashMap, true, {
         hm_free(map);
     });
 
+    CMC_CREATE_TEST(PFX##_shrink_to_fit(), {
+        struct hashmap *map = hm_new(100, 0.6, hm_fkey, hm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 100000; i++)
+            hm_insert(map, i, i);
+
+        size_t peak = hm_capacity(map);
+
+        for (size_t i = 10; i < 100000; i++)
+            hm_remove(map, i, NULL);
+
+        // Disabled by default
+        cmc_assert_equals(size_t, peak, hm_capacity(map));
+
+        map->flag = CMC_FLAG_ERROR;
+        cmc_assert(hm_shrink_to_fit(map));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, hm_flag(map));
+        cmc_assert_lesser(size_t, 100, hm_capacity(map));
+        cmc_assert_equals(size_t, 10, hm_count(map));
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hm_contains(map, i));
+
+        size_t capacity = hm_capacity(map);
+        cmc_assert(hm_shrink_to_fit(map));
+        cmc_assert_equals(size_t, capacity, hm_capacity(map));
+
+        hm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_set_shrink(), {
+        struct hashmap *map = hm_new(100, 0.6, hm_fkey, hm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert(!hm_set_shrink(map, -0.1));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, hm_flag(map));
+        cmc_assert(!hm_set_shrink(map, 0.3));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, hm_flag(map));
+        cmc_assert(hm_set_shrink(map, 0.1));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, hm_flag(map));
+
+        for (size_t i = 0; i < 100000; i++)
+            hm_insert(map, i, i);
+
+        for (size_t i = 10; i < 100000; i++)
+        {
+            cmc_assert(hm_remove(map, i, NULL));
+            cmc_assert_equals(int32_t, CMC_FLAG_OK, hm_flag(map));
+        }
+
+        cmc_assert_lesser(size_t, 100, hm_capacity(map));
+        cmc_assert_equals(size_t, 10, hm_count(map));
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hm_contains(map, i));
+
+        hm_free(map);
+    });
+
     CMC_CREATE_TEST(flags, {
         struct hashmap *map = hm_new(100, 0.6, hm_fkey, hm_fval);
 
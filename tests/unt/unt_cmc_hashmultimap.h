@@ -340,6 +340,68 @@ CMC_CREATE_UNIT(CMCHashMultiMap, true, {
         hmm_free(map);
     });
 
+    CMC_CREATE_TEST(PFX##_shrink_to_fit(), {
+        struct hashmultimap *map = hmm_new(100, 0.6, hmm_fkey, hmm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 100000; i++)
+            hmm_insert(map, i, i);
+
+        size_t peak = hmm_capacity(map);
+
+        for (size_t i = 10; i < 100000; i++)
+            hmm_remove(map, i, NULL);
+
+        // Disabled by default
+        cmc_assert_equals(size_t, peak, hmm_capacity(map));
+
+        map->flag = CMC_FLAG_ERROR;
+        cmc_assert(hmm_shrink_to_fit(map));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, hmm_flag(map));
+        cmc_assert_lesser(size_t, 100, hmm_capacity(map));
+        cmc_assert_equals(size_t, 10, hmm_count(map));
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hmm_contains(map, i));
+
+        size_t capacity = hmm_capacity(map);
+        cmc_assert(hmm_shrink_to_fit(map));
+        cmc_assert_equals(size_t, capacity, hmm_capacity(map));
+
+        hmm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_set_shrink(), {
+        struct hashmultimap *map = hmm_new(100, 0.6, hmm_fkey, hmm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert(!hmm_set_shrink(map, -0.1));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, hmm_flag(map));
+        cmc_assert(!hmm_set_shrink(map, 0.3));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, hmm_flag(map));
+        cmc_assert(hmm_set_shrink(map, 0.1));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, hmm_flag(map));
+
+        for (size_t i = 0; i < 100000; i++)
+            hmm_insert(map, i, i);
+
+        for (size_t i = 10; i < 100000; i++)
+        {
+            cmc_assert(hmm_remove(map, i, NULL));
+            cmc_assert_equals(int32_t, CMC_FLAG_OK, hmm_flag(map));
+        }
+
+        cmc_assert_lesser(size_t, 100, hmm_capacity(map));
+        cmc_assert_equals(size_t, 10, hmm_count(map));
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hmm_contains(map, i));
+
+        hmm_free(map);
+    });
+
     CMC_CREATE_TEST(flags, {
         struct hashmultimap *map = hmm_new(100, 0.8, hmm_fkey, hmm_fval);
 
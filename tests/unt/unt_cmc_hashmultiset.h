@@ -97,6 +97,30 @@ CMC_CREATE_UNIT(CMCHashMultiSet, true, {
         v_total_free = 0;
     });
 
+    CMC_CREATE_TEST(PFX##_clear()[epoch wraparound], {
+        struct hashmultiset *set = hms_new(100, 0.6, hms_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 3 * UINT16_MAX; i++)
+        {
+            cmc_assert(hms_insert(set, i));
+            cmc_assert(hms_insert(set, i + 1));
+            cmc_assert(hms_remove(set, i + 1));
+
+            hms_clear(set);
+
+            cmc_assert(!hms_contains(set, i));
+        }
+
+        cmc_assert_equals(size_t, 0, hms_count(set));
+
+        for (size_t i = 0; i < 3 * UINT16_MAX; i++)
+            cmc_assert(!hms_contains(set, i));
+
+        hms_free(set);
+    });
+
     CMC_CREATE_TEST(PFX##_free(), {
         v_total_free = 0;
         struct hashmultiset *set = hms_new(100, 0.6, hms_fval_counter);
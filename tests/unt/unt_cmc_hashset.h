@@ -97,6 +97,30 @@ CMC_CREATE_UNIT(CMCHashSet, true, {
         v_total_free = 0;
     });
 
+    CMC_CREATE_TEST(PFX##_clear()[epoch wraparound], {
+        struct hashset *set = hs_new(100, 0.6, hs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 3 * UINT16_MAX; i++)
+        {
+            cmc_assert(hs_insert(set, i));
+            cmc_assert(hs_insert(set, i + 1));
+            cmc_assert(hs_remove(set, i + 1));
+
+            hs_clear(set);
+
+            cmc_assert(!hs_contains(set, i));
+        }
+
+        cmc_assert_equals(size_t, 0, hs_count(set));
+
+        for (size_t i = 0; i < 3 * UINT16_MAX; i++)
+            cmc_assert(!hs_contains(set, i));
+
+        hs_free(set);
+    });
+
     CMC_CREATE_TEST(PFX##_free(), {
         v_total_free = 0;
         struct hashset *set = hs_new(100, 0.6, hs_fval_counter);
@@ -470,6 +494,68 @@ CMC_CREATE_UNIT(CMCHashSet, true, {
         hs_free(set);
     });
 
+    CMC_CREATE_TEST(PFX##_shrink_to_fit(), {
+        struct hashset *set = hs_new(100, 0.6, hs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 100000; i++)
+            hs_insert(set, i);
+
+        size_t peak = hs_capacity(set);
+
+        for (size_t i = 10; i < 100000; i++)
+            hs_remove(set, i);
+
+        // Disabled by default
+        cmc_assert_equals(size_t, peak, hs_capacity(set));
+
+        set->flag = CMC_FLAG_ERROR;
+        cmc_assert(hs_shrink_to_fit(set));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, hs_flag(set));
+        cmc_assert_lesser(size_t, 100, hs_capacity(set));
+        cmc_assert_equals(size_t, 10, hs_count(set));
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hs_contains(set, i));
+
+        size_t capacity = hs_capacity(set);
+        cmc_assert(hs_shrink_to_fit(set));
+        cmc_assert_equals(size_t, capacity, hs_capacity(set));
+
+        hs_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_set_shrink(), {
+        struct hashset *set = hs_new(100, 0.6, hs_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        cmc_assert(!hs_set_shrink(set, -0.1));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, hs_flag(set));
+        cmc_assert(!hs_set_shrink(set, 0.3));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, hs_flag(set));
+        cmc_assert(hs_set_shrink(set, 0.1));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, hs_flag(set));
+
+        for (size_t i = 0; i < 100000; i++)
+            hs_insert(set, i);
+
+        for (size_t i = 10; i < 100000; i++)
+        {
+            cmc_assert(hs_remove(set, i));
+            cmc_assert_equals(int32_t, CMC_FLAG_OK, hs_flag(set));
+        }
+
+        cmc_assert_lesser(size_t, 100, hs_capacity(set));
+        cmc_assert_equals(size_t, 10, hs_count(set));
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hs_contains(set, i));
+
+        hs_free(set);
+    });
+
     CMC_CREATE_TEST(flags, {
         struct hashset *set = hs_new(1, 0.99, hs_fval);
 
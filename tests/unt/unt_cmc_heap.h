@@ -9,6 +9,15 @@ struct heap_fval *h_fval = &(struct heap_fval){
     .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
 };
 
+/* Same as h_fval but searches with cmc_size_find() */
+struct heap_fval *h_fval_find = &(struct heap_fval){ .cmp = cmc_size_cmp,
+                                                     .cpy = NULL,
+                                                     .str = cmc_size_str,
+                                                     .free = NULL,
+                                                     .hash = cmc_size_hash,
+                                                     .pri = cmc_size_cmp,
+                                                     .find = cmc_size_find };
+
 CMC_CREATE_UNIT(CMCHeap, true, {
     CMC_CREATE_TEST(new, {
         struct heap *h = h_new(1000000, CMC_MAX_HEAP, h_fval);
@@ -160,6 +169,24 @@ CMC_CREATE_UNIT(CMCHeap, true, {
         h_free(h);
     });
 
+    CMC_CREATE_TEST(contains[find], {
+        struct heap *h = h_new(100, CMC_MAX_HEAP, h_fval_find);
+
+        cmc_assert_not_equals(ptr, NULL, h);
+        cmc_assert(!h_contains(h, 1));
+
+        for (size_t i = 1; i <= 100; i++)
+            cmc_assert(h_insert(h, i * 2));
+
+        for (size_t i = 1; i <= 100; i++)
+        {
+            cmc_assert(h_contains(h, i * 2));
+            cmc_assert(!h_contains(h, i * 2 + 1));
+        }
+
+        h_free(h);
+    });
+
     CMC_CREATE_TEST(flags, {
         struct heap *h = h_new(100, CMC_MAX_HEAP, h_fval);
 
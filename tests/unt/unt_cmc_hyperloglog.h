@@ -0,0 +1,347 @@
+#ifndef CMC_TESTS_UNT_CMC_HYPERLOGLOG_H
+#define CMC_TESTS_UNT_CMC_HYPERLOGLOG_H
+
+#include "utl.h"
+
+#include "tst_cmc_hyperloglog.h"
+
+struct hyperloglog_fval *hll_fval = &(struct hyperloglog_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct hyperloglog_fval *hll_fval_no_hash = &(struct hyperloglog_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = NULL, .pri = cmc_size_cmp
+};
+
+struct cmc_alloc_node *hll_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+/* If the estimate is within the given error of the actual cardinality */
+static bool hll_close(size_t estimate, size_t actual, double error)
+{
+    double difference = (double)estimate - (double)actual;
+
+    if (difference < 0)
+        difference = -difference;
+
+    return difference <= (double)actual * error;
+}
+
+CMC_CREATE_UNIT(CMCHyperLogLog, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct hyperloglog *hll = hll_new(12, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, hll);
+        cmc_assert_equals(ptr, NULL, hll->registers);
+        cmc_assert_not_equals(ptr, NULL, hll->sparse);
+        cmc_assert_equals(size_t, 0, hll->sparse_count);
+        cmc_assert_equals(size_t, 12, hll_precision(hll));
+        cmc_assert(hll_sparse(hll));
+        cmc_assert_equals(size_t, 0, hll_estimate(hll));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, hll_flag(hll));
+        cmc_assert_equals(ptr, hll_fval, hll->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, hll->alloc->malloc);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.free, hll->alloc->free);
+        cmc_assert_equals(ptr, NULL, hll->callbacks);
+
+        hll_free(hll);
+
+        hll = hll_new(CMC_HYPERLOGLOG_MIN_PRECISION, hll_fval);
+        cmc_assert_not_equals(ptr, NULL, hll);
+        hll_free(hll);
+
+        hll = hll_new(CMC_HYPERLOGLOG_MAX_PRECISION, hll_fval);
+        cmc_assert_not_equals(ptr, NULL, hll);
+        hll_free(hll);
+
+        hll = hll_new(CMC_HYPERLOGLOG_MIN_PRECISION - 1, hll_fval);
+        cmc_assert_equals(ptr, NULL, hll);
+
+        hll = hll_new(CMC_HYPERLOGLOG_MAX_PRECISION + 1, hll_fval);
+        cmc_assert_equals(ptr, NULL, hll);
+
+        hll = hll_new(12, NULL);
+        cmc_assert_equals(ptr, NULL, hll);
+
+        hll = hll_new(12, hll_fval_no_hash);
+        cmc_assert_equals(ptr, NULL, hll);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct hyperloglog *hll = hll_new_custom(12, hll_fval, hll_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, hll);
+        cmc_assert_equals(ptr, hll_alloc_node, hll->alloc);
+        cmc_assert_equals(ptr, callbacks, hll->callbacks);
+
+        hll_free(hll);
+    });
+
+    CMC_CREATE_TEST(PFX##_clear(), {
+        struct hyperloglog *hll = hll_new(12, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, hll);
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(hll_add(hll, i));
+
+        hll_clear(hll);
+
+        cmc_assert(hll_sparse(hll));
+        cmc_assert_equals(size_t, 0, hll_estimate(hll));
+
+        for (size_t i = 0; i < 10000; i++)
+            cmc_assert(hll_add(hll, i));
+
+        cmc_assert(!hll_sparse(hll));
+
+        hll_clear(hll);
+
+        /* Stays dense */
+        cmc_assert(!hll_sparse(hll));
+        cmc_assert_equals(size_t, 0, hll_estimate(hll));
+
+        hll_free(hll);
+    });
+
+    CMC_CREATE_TEST(PFX##_add() PFX##_estimate(), {
+        struct hyperloglog *hll = hll_new(12, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, hll);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(hll_add(hll, i));
+
+        cmc_assert(hll_sparse(hll));
+        cmc_assert(hll_close(hll_estimate(hll), 100, 0.03));
+
+        size_t estimate = hll_estimate(hll);
+
+        /* Values that were already added change nothing */
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(hll_add(hll, i));
+
+        cmc_assert_equals(size_t, estimate, hll_estimate(hll));
+
+        for (size_t i = 100; i < 1000; i++)
+            cmc_assert(hll_add(hll, i));
+
+        cmc_assert(!hll_sparse(hll));
+        cmc_assert(hll_close(hll_estimate(hll), 1000, 0.03));
+
+        for (size_t i = 1000; i < 200000; i++)
+            cmc_assert(hll_add(hll, i * 31));
+
+        /* Three times the standard error */
+        cmc_assert(hll_close(hll_estimate(hll), 200000, 0.05));
+
+        hll_free(hll);
+    });
+
+    CMC_CREATE_TEST(PFX##_add() precisions, {
+        for (size_t p = CMC_HYPERLOGLOG_MIN_PRECISION; p <= CMC_HYPERLOGLOG_MAX_PRECISION; p++)
+        {
+            struct hyperloglog *hll = hll_new(p, hll_fval);
+
+            cmc_assert_not_equals(ptr, NULL, hll);
+
+            for (size_t i = 0; i < 50000; i++)
+                cmc_assert(hll_add(hll, i));
+
+            /* Four times the standard error */
+            cmc_assert(hll_close(hll_estimate(hll), 50000, 4.16 / (double)((size_t)1 << (p / 2))));
+
+            hll_free(hll);
+        }
+    });
+
+    CMC_CREATE_TEST(PFX##_add_many(), {
+        struct hyperloglog *hll1 = hll_new(10, hll_fval);
+        struct hyperloglog *hll2 = hll_new(10, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, hll1);
+        cmc_assert_not_equals(ptr, NULL, hll2);
+
+        size_t values[1000];
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            values[i] = i * i;
+            cmc_assert(hll_add(hll1, values[i]));
+        }
+
+        cmc_assert(hll_add_many(hll2, values, 1000));
+        cmc_assert(hll_equals(hll1, hll2));
+
+        cmc_assert(hll_add_many(hll2, values, 0));
+        cmc_assert(hll_equals(hll1, hll2));
+
+        hll_free(hll1);
+        hll_free(hll2);
+    });
+
+    CMC_CREATE_TEST(PFX##_merge(), {
+        struct hyperloglog *all = hll_new(12, hll_fval);
+        struct hyperloglog *small1 = hll_new(12, hll_fval);
+        struct hyperloglog *small2 = hll_new(12, hll_fval);
+        struct hyperloglog *large1 = hll_new(12, hll_fval);
+        struct hyperloglog *large2 = hll_new(12, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, all);
+        cmc_assert_not_equals(ptr, NULL, small1);
+        cmc_assert_not_equals(ptr, NULL, small2);
+        cmc_assert_not_equals(ptr, NULL, large1);
+        cmc_assert_not_equals(ptr, NULL, large2);
+
+        for (size_t i = 0; i < 50; i++)
+        {
+            cmc_assert(hll_add(small1, i));
+            cmc_assert(hll_add(small2, i + 50));
+        }
+
+        for (size_t i = 0; i < 10000; i++)
+        {
+            cmc_assert(hll_add(large1, i + 100));
+            cmc_assert(hll_add(large2, i + 10100));
+        }
+
+        for (size_t i = 0; i < 20100; i++)
+            cmc_assert(hll_add(all, i));
+
+        /* Sparse into sparse */
+        cmc_assert(hll_merge(small1, small2));
+        cmc_assert(hll_sparse(small1));
+        cmc_assert(hll_close(hll_estimate(small1), 100, 0.03));
+
+        /* Dense into dense */
+        cmc_assert(hll_merge(large1, large2));
+        cmc_assert(hll_close(hll_estimate(large1), 20000, 0.05));
+
+        /* Sparse into dense */
+        cmc_assert(hll_merge(large1, small1));
+        cmc_assert(hll_equals(all, large1));
+
+        /* Dense into sparse */
+        cmc_assert(hll_merge(small1, large1));
+        cmc_assert(!hll_sparse(small1));
+        cmc_assert(hll_equals(all, small1));
+
+        /* Merging again changes nothing */
+        cmc_assert(hll_merge(small1, all));
+        cmc_assert(hll_equals(all, small1));
+
+        struct hyperloglog *other = hll_new(10, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, other);
+
+        cmc_assert(!hll_merge(all, other));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, hll_flag(all));
+
+        hll_free(all);
+        hll_free(small1);
+        hll_free(small2);
+        hll_free(large1);
+        hll_free(large2);
+        hll_free(other);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of() PFX##_equals(), {
+        struct hyperloglog *hll1 = hll_new(12, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, hll1);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(hll_add(hll1, i));
+
+        struct hyperloglog *hll2 = hll_copy_of(hll1);
+
+        cmc_assert_not_equals(ptr, NULL, hll2);
+        cmc_assert(hll_sparse(hll2));
+        cmc_assert(hll_equals(hll1, hll2));
+        cmc_assert_equals(size_t, hll_estimate(hll1), hll_estimate(hll2));
+
+        cmc_assert(hll_add(hll2, 1000));
+        cmc_assert(!hll_equals(hll1, hll2));
+
+        /* A dense sketch with the same registers as a sparse one */
+        struct hyperloglog *hll3 = hll_new(12, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, hll3);
+
+        for (size_t i = 0; i < 10000; i++)
+            cmc_assert(hll_add(hll3, i));
+
+        hll_clear(hll3);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(hll_add(hll3, i));
+
+        cmc_assert(!hll_sparse(hll3));
+        cmc_assert(hll_equals(hll1, hll3));
+        cmc_assert(hll_equals(hll3, hll1));
+
+        struct hyperloglog *hll4 = hll_copy_of(hll3);
+
+        cmc_assert_not_equals(ptr, NULL, hll4);
+        cmc_assert(!hll_sparse(hll4));
+        cmc_assert(hll_equals(hll3, hll4));
+
+        struct hyperloglog *hll5 = hll_new(10, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, hll5);
+        cmc_assert(!hll_equals(hll1, hll5));
+
+        hll_free(hll1);
+        hll_free(hll2);
+        hll_free(hll3);
+        hll_free(hll4);
+        hll_free(hll5);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct hyperloglog *hll1 = hll_new_custom(12, hll_fval, NULL, callbacks);
+        struct hyperloglog *hll2 = hll_new(12, hll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, hll1);
+        cmc_assert_not_equals(ptr, NULL, hll2);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(hll_add(hll1, 1));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        cmc_assert(hll_add_many(hll1, (size_t[]){ 2, 3, 4 }, 3));
+        cmc_assert_equals(int32_t, 4, total_create);
+
+        cmc_assert(hll_merge(hll1, hll2));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert_equals(size_t, 4, hll_estimate(hll1));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert_equals(int32_t, 4, total_create);
+        cmc_assert_equals(int32_t, 1, total_read);
+        cmc_assert_equals(int32_t, 1, total_update);
+        cmc_assert_equals(int32_t, 0, total_delete);
+        cmc_assert_equals(int32_t, 0, total_resize);
+
+        hll_customize(hll1, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, hll1->callbacks);
+
+        hll_free(hll1);
+        hll_free(hll2);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_HYPERLOGLOG_H */
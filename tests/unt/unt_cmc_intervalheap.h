@@ -413,6 +413,137 @@ CMC_CREATE_UNIT(CMCIntervalHeap, true, {
         ih_free(ih);
     });
 
+    CMC_CREATE_TEST(PFX##_offer_max(), {
+        struct intervalheap *ih = ih_new(1, ih_fval);
+
+        cmc_assert_not_equals(ptr, NULL, ih);
+
+        cmc_assert(ih_set_limit(ih, 101));
+        cmc_assert_equals(size_t, 101, ih_limit(ih));
+
+        size_t capacity = ih_capacity(ih);
+
+        /* A permutation of [0, 10007) */
+        for (size_t i = 0; i < 10007; i++)
+        {
+            ih_offer_max(ih, i * 7919 % 10007);
+            cmc_assert_equals(int32_t, CMC_FLAG_OK, ih_flag(ih));
+        }
+
+        cmc_assert_equals(size_t, 101, ih_count(ih));
+        cmc_assert_equals(size_t, capacity, ih_capacity(ih));
+        cmc_assert_equals(size_t, 10006, ih_max(ih));
+
+        cmc_assert(!ih_offer_max(ih, 9906));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, ih_flag(ih));
+        cmc_assert(ih_offer_max(ih, 10007));
+
+        for (size_t i = 9907; i <= 10007; i++)
+        {
+            cmc_assert_equals(size_t, i, ih_min(ih));
+            cmc_assert(ih_remove_min(ih));
+        }
+
+        cmc_assert(ih_empty(ih));
+
+        ih_free(ih);
+    });
+
+    CMC_CREATE_TEST(PFX##_offer_min(), {
+        struct intervalheap *ih = ih_new(100, ih_fval);
+
+        cmc_assert_not_equals(ptr, NULL, ih);
+
+        /* Unbounded heaps keep every value */
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(ih_offer_min(ih, i));
+
+        cmc_assert_equals(size_t, 10, ih_count(ih));
+
+        ih_clear(ih);
+
+        cmc_assert(ih_set_limit(ih, 1));
+
+        for (size_t i = 0; i < 10007; i++)
+            ih_offer_min(ih, 10006 - i * 7919 % 10007);
+
+        cmc_assert_equals(size_t, 1, ih_count(ih));
+        cmc_assert_equals(size_t, 0, ih_min(ih));
+        cmc_assert_equals(size_t, 0, ih_max(ih));
+
+        ih_clear(ih);
+
+        cmc_assert(ih_set_limit(ih, 50));
+
+        for (size_t i = 0; i < 10007; i++)
+            ih_offer_min(ih, 10006 - i * 7919 % 10007);
+
+        cmc_assert_equals(size_t, 50, ih_count(ih));
+
+        for (size_t i = 49; i > 0; i--)
+        {
+            cmc_assert_equals(size_t, i, ih_max(ih));
+            cmc_assert(ih_remove_max(ih));
+        }
+
+        cmc_assert_equals(size_t, 0, ih_max(ih));
+
+        ih_free(ih);
+    });
+
+    CMC_CREATE_TEST(PFX##_offer_many_max(), {
+        struct intervalheap *ih = ih_new(100, ih_fval);
+
+        cmc_assert_not_equals(ptr, NULL, ih);
+
+        size_t values[1000];
+
+        for (size_t i = 0; i < 1000; i++)
+            values[i] = 999 - i;
+
+        cmc_assert(ih_set_limit(ih, 10));
+
+        /* Only the first ten values are greater than the Min */
+        cmc_assert_equals(size_t, 10, ih_offer_many_max(ih, values, 1000));
+        cmc_assert_equals(size_t, 10, ih_count(ih));
+        cmc_assert_equals(size_t, 990, ih_min(ih));
+        cmc_assert_equals(size_t, 999, ih_max(ih));
+
+        /* Every value but the first one is less than the Max */
+        cmc_assert_equals(size_t, 999, ih_offer_many_min(ih, values, 1000));
+        cmc_assert_equals(size_t, 10, ih_count(ih));
+        cmc_assert_equals(size_t, 0, ih_min(ih));
+        cmc_assert_equals(size_t, 9, ih_max(ih));
+
+        ih_free(ih);
+    });
+
+    CMC_CREATE_TEST(PFX##_set_limit(), {
+        struct intervalheap *ih = ih_new(10, ih_fval);
+
+        cmc_assert_not_equals(ptr, NULL, ih);
+
+        for (size_t i = 0; i < 20; i++)
+            cmc_assert(ih_insert(ih, i));
+
+        cmc_assert(!ih_set_limit(ih, 19));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, ih_flag(ih));
+        cmc_assert_equals(size_t, 0, ih_limit(ih));
+
+        cmc_assert(ih_set_limit(ih, 1001));
+        cmc_assert_greater_equals(size_t, 501, ih_capacity(ih));
+
+        cmc_assert(ih_set_limit(ih, 20));
+        cmc_assert(!ih_offer_max(ih, 0));
+        cmc_assert_equals(size_t, 20, ih_count(ih));
+
+        cmc_assert(ih_set_limit(ih, 0));
+        cmc_assert(ih_offer_max(ih, 0));
+        cmc_assert_equals(size_t, 21, ih_count(ih));
+
+        ih_free(ih);
+    });
+
     CMC_CREATE_TEST(buffer_growth[capacity = 1], {
         struct intervalheap *ih = ih_new(1, ih_fval);
 
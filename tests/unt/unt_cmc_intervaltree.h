@@ -0,0 +1,592 @@
+#ifndef CMC_TESTS_UNT_CMC_INTERVALTREE_H
+#define CMC_TESTS_UNT_CMC_INTERVALTREE_H
+
+#include "utl.h"
+
+#include "tst_cmc_intervaltree.h"
+
+struct intervaltree_fkey *itv_fkey = &(struct intervaltree_fkey){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct intervaltree_fval *itv_fval = &(struct intervaltree_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct cmc_alloc_node *itv_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+/* Intervals reported by itv_match */
+size_t itv_matches = 0;
+size_t itv_match_sum = 0;
+size_t itv_last_low = 0;
+bool itv_sorted = true;
+
+void itv_match(size_t low, size_t high, size_t value)
+{
+    (void)high;
+
+    if (itv_matches > 0 && low < itv_last_low)
+        itv_sorted = false;
+
+    itv_matches++;
+    itv_match_sum += value;
+    itv_last_low = low;
+}
+
+void itv_match_reset(void)
+{
+    itv_matches = 0;
+    itv_match_sum = 0;
+    itv_last_low = 0;
+    itv_sorted = true;
+}
+
+/* Checks the greatest high endpoint and the AVL balance of every subtree */
+bool itv_valid(struct intervaltree_node *node, size_t *max, int *height)
+{
+    if (!node)
+    {
+        *height = 0;
+        return true;
+    }
+
+    size_t max_l = 0, max_r = 0;
+    int h_l = 0, h_r = 0;
+
+    if (!itv_valid(node->left, &max_l, &h_l) || !itv_valid(node->right, &max_r, &h_r))
+        return false;
+
+    *max = node->high;
+
+    if (node->left && max_l > *max)
+        *max = max_l;
+    if (node->right && max_r > *max)
+        *max = max_r;
+
+    *height = 1 + (h_l > h_r ? h_l : h_r);
+
+    return node->max == *max && h_l - h_r < 2 && h_r - h_l < 2;
+}
+
+/* Reference intervals for the randomized test */
+size_t itv_ref_low[400];
+size_t itv_ref_high[400];
+bool itv_ref_used[400];
+
+CMC_CREATE_UNIT(CMCIntervalTree, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+        cmc_assert_equals(ptr, NULL, tree->root);
+        cmc_assert_equals(size_t, 0, itv_count(tree));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, itv_flag(tree));
+        cmc_assert_equals(ptr, itv_fkey, tree->f_key);
+        cmc_assert_equals(ptr, itv_fval, tree->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, tree->alloc->malloc);
+        cmc_assert_equals(ptr, NULL, tree->callbacks);
+
+        itv_free(tree);
+
+        cmc_assert_equals(ptr, NULL, itv_new(NULL, itv_fval));
+        cmc_assert_equals(ptr, NULL, itv_new(itv_fkey, NULL));
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct intervaltree *tree = itv_new_custom(itv_fkey, itv_fval, itv_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+        cmc_assert_equals(ptr, itv_alloc_node, tree->alloc);
+        cmc_assert_equals(ptr, callbacks, tree->callbacks);
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_clear(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(itv_insert(tree, i, i + 10, i));
+
+        itv_clear(tree);
+
+        cmc_assert_equals(size_t, 0, itv_count(tree));
+        cmc_assert_equals(ptr, NULL, tree->root);
+        cmc_assert(itv_insert(tree, 1, 2, 3));
+        cmc_assert_equals(size_t, 1, itv_count(tree));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_insert(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        cmc_assert(itv_insert(tree, 5, 10, 1));
+        cmc_assert(itv_insert(tree, 5, 12, 2));
+        cmc_assert(itv_insert(tree, 7, 7, 3));
+        cmc_assert(itv_insert(tree, 0, 5, 4));
+
+        cmc_assert(!itv_insert(tree, 5, 10, 5));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, itv_flag(tree));
+
+        cmc_assert(!itv_insert(tree, 10, 5, 6));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, itv_flag(tree));
+
+        cmc_assert_equals(size_t, 4, itv_count(tree));
+        cmc_assert_equals(size_t, 12, tree->root->max);
+
+        size_t max = 0;
+        int height = 0;
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(itv_insert(tree, 100 + i, 100 + i + (i * 7) % 50, i));
+
+        cmc_assert_equals(size_t, 1004, itv_count(tree));
+        cmc_assert(itv_valid(tree->root, &max, &height));
+        cmc_assert_equals(size_t, 100 + 999 + (999 * 7) % 50, max);
+        cmc_assert_lesser_equals(int32_t, 15, height);
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_update(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        size_t old = 0;
+
+        cmc_assert(itv_insert(tree, 1, 4, 10));
+        cmc_assert(itv_update(tree, 1, 4, 20, &old));
+        cmc_assert_equals(size_t, 10, old);
+        cmc_assert_equals(size_t, 20, itv_get(tree, 1, 4));
+        cmc_assert(itv_update(tree, 1, 4, 30, NULL));
+        cmc_assert_equals(size_t, 30, itv_get(tree, 1, 4));
+
+        cmc_assert(!itv_update(tree, 1, 5, 40, &old));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, itv_flag(tree));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        size_t out = 0;
+
+        cmc_assert(!itv_remove(tree, 1, 2, &out));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, itv_flag(tree));
+
+        for (size_t i = 0; i < 500; i++)
+            cmc_assert(itv_insert(tree, i, i < 250 ? 1000 - i : 750, i));
+
+        cmc_assert(!itv_remove(tree, 1, 2, &out));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, itv_flag(tree));
+
+        size_t max = 0;
+        int height = 0;
+
+        /* Removes the intervals reaching furthest first */
+        for (size_t i = 0; i < 250; i++)
+        {
+            cmc_assert(itv_remove(tree, i, 1000 - i, &out));
+            cmc_assert_equals(size_t, i < 249 ? 999 - i : 750, tree->root->max);
+            cmc_assert_equals(size_t, i, out);
+            cmc_assert(itv_valid(tree->root, &max, &height));
+        }
+
+        cmc_assert_equals(size_t, 250, itv_count(tree));
+        cmc_assert_equals(size_t, 750, max);
+
+        for (size_t i = 250; i < 500; i++)
+            cmc_assert(itv_remove(tree, i, 750, NULL));
+
+        cmc_assert(itv_empty(tree));
+        cmc_assert_equals(ptr, NULL, tree->root);
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_get(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        cmc_assert_equals(size_t, 0, itv_get(tree, 1, 2));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, itv_flag(tree));
+
+        cmc_assert(itv_insert(tree, 1, 2, 3));
+        cmc_assert(itv_insert(tree, 1, 3, 4));
+
+        cmc_assert_equals(size_t, 3, itv_get(tree, 1, 2));
+        cmc_assert_equals(size_t, 4, itv_get(tree, 1, 3));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, itv_flag(tree));
+
+        cmc_assert_equals(size_t, 0, itv_get(tree, 2, 3));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, itv_flag(tree));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_get_ref(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        cmc_assert_equals(ptr, NULL, itv_get_ref(tree, 1, 2));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, itv_flag(tree));
+
+        cmc_assert(itv_insert(tree, 1, 2, 3));
+
+        size_t *ref = itv_get_ref(tree, 1, 2);
+
+        cmc_assert_not_equals(ptr, NULL, ref);
+
+        *ref = 10;
+
+        cmc_assert_equals(size_t, 10, itv_get(tree, 1, 2));
+
+        cmc_assert_equals(ptr, NULL, itv_get_ref(tree, 0, 2));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, itv_flag(tree));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_overlaps(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        cmc_assert_equals(size_t, 0, itv_overlaps(tree, 0, 100, itv_match));
+
+        cmc_assert(itv_insert(tree, 10, 20, 1));
+        cmc_assert(itv_insert(tree, 15, 25, 2));
+        cmc_assert(itv_insert(tree, 30, 40, 4));
+        cmc_assert(itv_insert(tree, 0, 100, 8));
+        cmc_assert(itv_insert(tree, 50, 50, 16));
+
+        itv_match_reset();
+
+        cmc_assert_equals(size_t, 3, itv_overlaps(tree, 18, 29, itv_match));
+        cmc_assert_equals(size_t, 3, itv_matches);
+        cmc_assert_equals(size_t, 1 + 2 + 8, itv_match_sum);
+        cmc_assert(itv_sorted);
+
+        /* Closed intervals overlap when they only share an endpoint */
+        cmc_assert_equals(size_t, 3, itv_overlaps(tree, 25, 30, NULL));
+        cmc_assert_equals(size_t, 2, itv_overlaps(tree, 41, 50, NULL));
+        cmc_assert_equals(size_t, 5, itv_overlaps(tree, 0, 100, NULL));
+        cmc_assert_equals(size_t, 0, itv_overlaps(tree, 101, 200, NULL));
+
+        cmc_assert_equals(size_t, 0, itv_overlaps(tree, 30, 20, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, itv_flag(tree));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_stab(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(itv_insert(tree, i * 10, i * 10 + 15, i));
+
+        itv_match_reset();
+
+        cmc_assert_equals(size_t, 2, itv_stab(tree, 505, itv_match));
+        cmc_assert_equals(size_t, 49 + 50, itv_match_sum);
+        cmc_assert(itv_sorted);
+
+        cmc_assert_equals(size_t, 1, itv_stab(tree, 0, NULL));
+        cmc_assert_equals(size_t, 2, itv_stab(tree, 10, NULL));
+        cmc_assert_equals(size_t, 1, itv_stab(tree, 1005, NULL));
+        cmc_assert_equals(size_t, 0, itv_stab(tree, 1006, NULL));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(overlaps[random], {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 400; i++)
+            itv_ref_used[i] = false;
+
+        size_t seed = 7;
+
+        /* Inserts and removes intervals and checks queries against a scan */
+        for (size_t step = 0; step < 6000; step++)
+        {
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+            size_t r = seed >> 33;
+            size_t slot = r % 400;
+
+            if (!itv_ref_used[slot])
+            {
+                itv_ref_low[slot] = (r >> 9) % 5000;
+                itv_ref_high[slot] = itv_ref_low[slot] + (r >> 22) % 300;
+                itv_ref_used[slot] = itv_insert(tree, itv_ref_low[slot], itv_ref_high[slot], slot);
+            }
+            else
+            {
+                cmc_assert(itv_remove(tree, itv_ref_low[slot], itv_ref_high[slot], NULL));
+                itv_ref_used[slot] = false;
+            }
+
+            size_t low = (r >> 12) % 5400;
+            size_t high = low + (r >> 3) % 100;
+            size_t expected = 0;
+            size_t expected_sum = 0;
+
+            for (size_t i = 0; i < 400; i++)
+            {
+                if (itv_ref_used[i] && itv_ref_low[i] <= high && itv_ref_high[i] >= low)
+                {
+                    expected++;
+                    expected_sum += i;
+                }
+            }
+
+            itv_match_reset();
+
+            cmc_assert_equals(size_t, expected, itv_overlaps(tree, low, high, itv_match));
+            cmc_assert_equals(size_t, expected_sum, itv_match_sum);
+            cmc_assert(itv_sorted);
+        }
+
+        size_t max = 0;
+        int height = 0;
+
+        cmc_assert(itv_valid(tree->root, &max, &height));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_contains(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        cmc_assert(!itv_contains(tree, 1, 2));
+
+        cmc_assert(itv_insert(tree, 1, 2, 3));
+
+        cmc_assert(itv_contains(tree, 1, 2));
+        cmc_assert(!itv_contains(tree, 1, 3));
+        cmc_assert(!itv_contains(tree, 0, 2));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of(), {
+        struct intervaltree *tree1 = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree1);
+
+        for (size_t i = 0; i < 200; i++)
+            cmc_assert(itv_insert(tree1, i % 20, i, i));
+
+        struct intervaltree *tree2 = itv_copy_of(tree1);
+
+        cmc_assert_not_equals(ptr, NULL, tree2);
+        cmc_assert_equals(size_t, 200, itv_count(tree2));
+        cmc_assert(itv_equals(tree1, tree2));
+        cmc_assert_equals(size_t, itv_stab(tree1, 100, NULL), itv_stab(tree2, 100, NULL));
+
+        itv_free(tree1);
+        itv_free(tree2);
+    });
+
+    CMC_CREATE_TEST(PFX##_equals(), {
+        struct intervaltree *tree1 = itv_new(itv_fkey, itv_fval);
+        struct intervaltree *tree2 = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree1);
+        cmc_assert_not_equals(ptr, NULL, tree2);
+
+        cmc_assert(itv_equals(tree1, tree2));
+
+        /* Different insertion orders build different trees */
+        for (size_t i = 0; i < 100; i++)
+        {
+            cmc_assert(itv_insert(tree1, i, i + 5, i));
+            cmc_assert(itv_insert(tree2, 99 - i, 104 - i, 99 - i));
+        }
+
+        cmc_assert(itv_equals(tree1, tree2));
+
+        cmc_assert(itv_update(tree2, 10, 15, 0, NULL));
+        cmc_assert(!itv_equals(tree1, tree2));
+        cmc_assert(itv_update(tree2, 10, 15, 10, NULL));
+
+        cmc_assert(itv_remove(tree2, 10, 15, NULL));
+        cmc_assert(itv_insert(tree2, 10, 16, 10));
+        cmc_assert(!itv_equals(tree1, tree2));
+
+        cmc_assert(itv_insert(tree2, 10, 15, 10));
+        cmc_assert(!itv_equals(tree1, tree2));
+
+        itv_free(tree1);
+        itv_free(tree2);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct intervaltree *tree = itv_new_custom(itv_fkey, itv_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(itv_insert(tree, 1, 2, 3));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        cmc_assert(itv_update(tree, 1, 2, 4, NULL));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert_equals(size_t, 4, itv_get(tree, 1, 2));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert_equals(size_t, 1, itv_stab(tree, 2, NULL));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert(itv_contains(tree, 1, 2));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert(itv_remove(tree, 1, 2, NULL));
+        cmc_assert_equals(int32_t, 1, total_delete);
+
+        cmc_assert_equals(int32_t, 0, total_resize);
+
+        itv_free(tree);
+    });
+});
+
+CMC_CREATE_UNIT(CMCIntervalTreeIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        struct intervaltree_iter it = itv_iter_start(tree);
+
+        cmc_assert(itv_iter_at_start(&it));
+        cmc_assert(itv_iter_at_end(&it));
+
+        cmc_assert(itv_insert(tree, 5, 9, 1));
+        cmc_assert(itv_insert(tree, 5, 6, 2));
+        cmc_assert(itv_insert(tree, 8, 8, 3));
+
+        it = itv_iter_start(tree);
+
+        cmc_assert(itv_iter_at_start(&it));
+        cmc_assert(!itv_iter_at_end(&it));
+        cmc_assert_equals(size_t, 5, itv_iter_low(&it));
+        cmc_assert_equals(size_t, 6, itv_iter_high(&it));
+        cmc_assert_equals(size_t, 2, itv_iter_value(&it));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_end(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        cmc_assert(itv_insert(tree, 5, 9, 1));
+        cmc_assert(itv_insert(tree, 5, 6, 2));
+        cmc_assert(itv_insert(tree, 8, 8, 3));
+
+        struct intervaltree_iter it = itv_iter_end(tree);
+
+        cmc_assert(!itv_iter_at_start(&it));
+        cmc_assert(itv_iter_at_end(&it));
+        cmc_assert_equals(size_t, 8, itv_iter_low(&it));
+        cmc_assert_equals(size_t, 3, itv_iter_value(&it));
+        cmc_assert_equals(size_t, 2, itv_iter_index(&it));
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(itv_insert(tree, i / 2, i / 2 + i % 2, i));
+
+        size_t total = 0;
+
+        for (struct intervaltree_iter it = itv_iter_start(tree); !itv_iter_at_end(&it); itv_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, total, itv_iter_value(&it));
+            cmc_assert_equals(size_t, total, itv_iter_index(&it));
+            total++;
+        }
+
+        cmc_assert_equals(size_t, 100, total);
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(itv_insert(tree, i / 2, i / 2 + i % 2, i));
+
+        size_t total = 100;
+
+        for (struct intervaltree_iter it = itv_iter_end(tree); !itv_iter_at_start(&it); itv_iter_prev(&it))
+        {
+            total--;
+            cmc_assert_equals(size_t, total, itv_iter_value(&it));
+        }
+
+        cmc_assert_equals(size_t, 0, total);
+
+        itv_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_go_to(), {
+        struct intervaltree *tree = itv_new(itv_fkey, itv_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(itv_insert(tree, i, i * 2, i));
+
+        struct intervaltree_iter it = itv_iter_start(tree);
+
+        cmc_assert(itv_iter_go_to(&it, 30));
+        cmc_assert_equals(size_t, 30, itv_iter_low(&it));
+        cmc_assert_equals(size_t, 60, itv_iter_high(&it));
+
+        cmc_assert(itv_iter_go_to(&it, 10));
+        cmc_assert_equals(size_t, 10, itv_iter_value(&it));
+
+        *itv_iter_rvalue(&it) = 100;
+
+        cmc_assert_equals(size_t, 100, itv_get(tree, 10, 20));
+        cmc_assert(!itv_iter_go_to(&it, 50));
+
+        itv_free(tree);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_INTERVALTREE_H */
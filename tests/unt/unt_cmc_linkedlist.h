@@ -9,6 +9,16 @@ struct linkedlist_fval *ll_fval = &(struct linkedlist_fval){
     .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
 };
 
+/* Orders values by their thousands only, so the sorts can be checked for stability */
+static int ll_cmp_thousands(size_t a, size_t b)
+{
+    return cmc_size_cmp(a / 1000, b / 1000);
+}
+
+struct linkedlist_fval *ll_fval_thousands = &(struct linkedlist_fval){
+    .cmp = ll_cmp_thousands, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = NULL
+};
+
 CMC_CREATE_UNIT(CMCLinkedList, true, {
     CMC_CREATE_TEST(new, {
         struct linkedlist *ll = ll_new(ll_fval);
@@ -78,6 +88,68 @@ CMC_CREATE_UNIT(CMCLinkedList, true, {
         ll_free(ll);
     });
 
+    CMC_CREATE_TEST(sort, {
+        struct linkedlist *ll = ll_new(ll_fval);
+
+        cmc_assert_not_equals(ptr, NULL, ll);
+
+        ll_sort(ll);
+        cmc_assert_equals(ptr, NULL, ll->head);
+        cmc_assert_equals(ptr, NULL, ll->tail);
+
+        cmc_assert(ll_push_back(ll, 5));
+        ll_sort(ll);
+        cmc_assert_equals(ptr, ll->head, ll->tail);
+
+        ll_clear(ll);
+
+        for (size_t i = 0; i < 1001; i++)
+            cmc_assert(ll_push_back(ll, (i * 389) % 1001));
+
+        ll_sort(ll);
+
+        cmc_assert_equals(size_t, 1001, ll_count(ll));
+        cmc_assert_equals(ptr, NULL, ll->head->prev);
+        cmc_assert_equals(ptr, NULL, ll->tail->next);
+
+        size_t i = 0;
+
+        for (struct linkedlist_node *node = ll->head; node; node = node->next, i++)
+        {
+            cmc_assert_equals(size_t, i, node->value);
+
+            if (node->next)
+                cmc_assert_equals(ptr, node, node->next->prev);
+            else
+                cmc_assert_equals(ptr, node, ll->tail);
+        }
+
+        cmc_assert_equals(size_t, 1001, i);
+
+        ll_free(ll);
+    });
+
+    CMC_CREATE_TEST(sort[stable], {
+        struct linkedlist *ll = ll_new(ll_fval_thousands);
+
+        cmc_assert_not_equals(ptr, NULL, ll);
+
+        for (size_t i = 0; i < 999; i++)
+            cmc_assert(ll_push_back(ll, ((i * 37) % 20) * 1000 + i));
+
+        ll_sort(ll);
+
+        for (struct linkedlist_node *node = ll->head; node->next; node = node->next)
+        {
+            cmc_assert_lesser_equals(size_t, node->next->value / 1000, node->value / 1000);
+
+            if (node->value / 1000 == node->next->value / 1000)
+                cmc_assert_greater(size_t, node->value % 1000, node->next->value % 1000);
+        }
+
+        ll_free(ll);
+    });
+
     CMC_CREATE_TEST(flags, {
         struct linkedlist *ll = ll_new(ll_fval);
 
@@ -1,6 +1,8 @@
 #ifndef CMC_TESTS_UNT_CMC_LIST_H
 #define CMC_TESTS_UNT_CMC_LIST_H
 
+#include <math.h>
+
 #include "utl.h"
 
 #include "tst_cmc_list.h"
@@ -9,6 +11,58 @@ struct list_fval *l_fval = &(struct list_fval){
     .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
 };
 
+/* Orders values by their thousands only, so the sorts can be checked for stability */
+static int l_cmp_thousands(size_t a, size_t b)
+{
+    return cmc_size_cmp(a / 1000, b / 1000);
+}
+
+struct list_fval *l_fval_thousands = &(struct list_fval){
+    .cmp = l_cmp_thousands, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = NULL
+};
+
+/* Same as l_fval but searches with cmc_size_find() */
+struct list_fval *l_fval_find = &(struct list_fval){ .cmp = cmc_size_cmp,
+                                                     .cpy = NULL,
+                                                     .str = cmc_size_str,
+                                                     .free = NULL,
+                                                     .hash = cmc_size_hash,
+                                                     .pri = cmc_size_cmp,
+                                                     .find = cmc_size_find };
+
+/* A List that keeps up to 4 elements inside its struct */
+C_MACRO_COLLECTIONS_ALL(CMC, LIST, (l4, list4, 4, , size_t))
+
+struct list4_fval *l4_fval = &(struct list4_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+/* Amount of blocks currently allocated through l4_alloc_node */
+static size_t l4_blocks = 0;
+
+static void *l4_mem_malloc(size_t size)
+{
+    l4_blocks++;
+    return malloc(size);
+}
+
+static void *l4_mem_calloc(size_t count, size_t size)
+{
+    l4_blocks++;
+    return calloc(count, size);
+}
+
+static void l4_mem_free(void *ptr)
+{
+    if (ptr)
+        l4_blocks--;
+    free(ptr);
+}
+
+struct cmc_alloc_node *l4_alloc_node = &(struct cmc_alloc_node){
+    .malloc = l4_mem_malloc, .calloc = l4_mem_calloc, .realloc = realloc, .free = l4_mem_free
+};
+
 CMC_CREATE_UNIT(CMCList, true, {
     CMC_CREATE_TEST(new, {
         struct list *l = l_new(1000000, l_fval);
@@ -310,6 +364,210 @@ CMC_CREATE_UNIT(CMCList, true, {
         l_free(l);
     });
 
+    CMC_CREATE_TEST(index_of[find], {
+        struct list *l = l_new(100, l_fval_find);
+
+        cmc_assert_not_equals(ptr, NULL, l);
+
+        for (size_t i = 0; i < 1003; i++)
+            cmc_assert(l_push_back(l, i % 500));
+
+        for (size_t i = 0; i < 500; i++)
+        {
+            cmc_assert_equals(size_t, i, l_index_of(l, i, true));
+            cmc_assert_equals(size_t, i < 3 ? 1000 + i : 500 + i, l_index_of(l, i, false));
+            cmc_assert(l_contains(l, i));
+        }
+
+        cmc_assert_equals(size_t, l_count(l), l_index_of(l, 500, true));
+        cmc_assert(!l_contains(l, 500));
+
+        l_clear(l);
+
+        cmc_assert_equals(size_t, 0, l_index_of(l, 0, true));
+        cmc_assert(!l_contains(l, 0));
+
+        l_free(l);
+    });
+
+    CMC_CREATE_TEST(find[futils], {
+        int32_t i32[37];
+        float f32[37];
+        double f64[37];
+
+        for (size_t i = 0; i < 37; i++)
+        {
+            i32[i] = -(int32_t)i;
+            f32[i] = (float)i / 2;
+            f64[i] = (double)i / 2;
+        }
+
+        for (size_t i = 0; i < 37; i++)
+        {
+            cmc_assert_equals(size_t, i, cmc_i32_find(i32, 37, -(int32_t)i));
+            cmc_assert_equals(size_t, i, cmc_float_find(f32, 37, (float)i / 2));
+            cmc_assert_equals(size_t, i, cmc_double_find(f64, 37, (double)i / 2));
+        }
+
+        cmc_assert_equals(size_t, 37, cmc_i32_find(i32, 37, 1));
+        cmc_assert_equals(size_t, 37, cmc_float_find(f32, 37, -1.0f));
+        cmc_assert_equals(size_t, 37, cmc_double_find(f64, 37, 0.25));
+        cmc_assert_equals(size_t, 0, cmc_i32_find(i32, 0, 0));
+
+        /* NaN is equal to every value, like in cmc_float_cmp */
+        f32[20] = NAN;
+        f64[20] = NAN;
+
+        for (size_t i = 0; i < 37; i++)
+        {
+            cmc_assert_equals(size_t, i < 20 ? i : 20, cmc_float_find(f32, 37, (float)i / 2));
+            cmc_assert_equals(size_t, i < 20 ? i : 20, cmc_double_find(f64, 37, (double)i / 2));
+        }
+
+        cmc_assert_equals(size_t, 20, cmc_float_find(f32, 37, -1.0f));
+        cmc_assert_equals(size_t, 20, cmc_double_find(f64, 37, 0.25));
+        cmc_assert_equals(size_t, 0, cmc_float_find(f32, 37, NAN));
+        cmc_assert_equals(size_t, 0, cmc_double_find(f64, 37, NAN));
+        cmc_assert_equals(int32_t, 0, cmc_float_cmp(f32[0], NAN));
+    });
+
+    CMC_CREATE_TEST(sort, {
+        struct list *l = l_new(100, l_fval);
+
+        cmc_assert_not_equals(ptr, NULL, l);
+
+        l_sort(l);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, l_flag(l));
+
+        size_t seed = 7;
+        size_t sum = 0;
+
+        for (size_t i = 0; i < 5000; i++)
+        {
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+            cmc_assert(l_push_back(l, (seed >> 33) % 1000));
+            sum += l_get(l, i);
+        }
+
+        /* Random, sorted, reversed */
+        for (size_t round = 0; round < 3; round++)
+        {
+            if (round == 2)
+            {
+                for (size_t i = 0; i < l_count(l) / 2; i++)
+                {
+                    size_t tmp = l->buffer[i];
+                    l->buffer[i] = l->buffer[l_count(l) - 1 - i];
+                    l->buffer[l_count(l) - 1 - i] = tmp;
+                }
+            }
+
+            l_sort(l);
+
+            size_t check = l_get(l, 0);
+
+            for (size_t i = 1; i < l_count(l); i++)
+            {
+                cmc_assert_lesser_equals(size_t, l_get(l, i), l_get(l, i - 1));
+                check += l_get(l, i);
+            }
+
+            cmc_assert_equals(size_t, sum, check);
+        }
+
+        l_clear(l);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(l_push_back(l, 42));
+
+        l_sort(l);
+
+        cmc_assert_equals(size_t, 1000, l_count(l));
+        cmc_assert_equals(size_t, 42, l_front(l));
+        cmc_assert_equals(size_t, 42, l_back(l));
+
+        l_free(l);
+    });
+
+    CMC_CREATE_TEST(stable_sort, {
+        struct list *l = l_new(100, l_fval_thousands);
+
+        cmc_assert_not_equals(ptr, NULL, l);
+        cmc_assert(l_stable_sort(l));
+
+        /* The thousands are the key and the rest is the original position */
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(l_push_back(l, ((i * 37) % 20) * 1000 + i));
+
+        cmc_assert(l_stable_sort(l));
+        cmc_assert_equals(size_t, 1000, l_count(l));
+
+        for (size_t i = 1; i < l_count(l); i++)
+        {
+            cmc_assert_lesser_equals(size_t, l_get(l, i) / 1000, l_get(l, i - 1) / 1000);
+
+            if (l_get(l, i) / 1000 == l_get(l, i - 1) / 1000)
+                cmc_assert_greater(size_t, l_get(l, i - 1) % 1000, l_get(l, i) % 1000);
+        }
+
+        l_free(l);
+    });
+
+    CMC_CREATE_TEST(inline_buffer[SIZE = 4], {
+        struct list4 *l = l4_new_custom(2, l4_fval, l4_alloc_node, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, l);
+        cmc_assert_equals(size_t, 1, l4_blocks);
+        cmc_assert_equals(ptr, l->inline_buffer, l->buffer);
+        cmc_assert_equals(size_t, 4, l4_capacity(l));
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert(l4_push_back(l, i));
+
+        cmc_assert_equals(size_t, 1, l4_blocks);
+        cmc_assert_equals(ptr, l->inline_buffer, l->buffer);
+
+        /* Spill to the heap */
+        cmc_assert(l4_push_back(l, 4));
+
+        cmc_assert_equals(size_t, 2, l4_blocks);
+        cmc_assert_not_equals(ptr, l->inline_buffer, l->buffer);
+        cmc_assert_greater_equals(size_t, 5, l4_capacity(l));
+
+        for (size_t i = 0; i < 5; i++)
+            cmc_assert_equals(size_t, i, l4_get(l, i));
+
+        struct list4 *copy = l4_copy_of(l);
+
+        cmc_assert_not_equals(ptr, NULL, copy);
+        cmc_assert(l4_equals(l, copy));
+        cmc_assert_equals(size_t, 4, l4_blocks);
+
+        l4_free(copy);
+
+        /* Shrinking back to SIZE moves the elements inside the struct */
+        cmc_assert(l4_pop_back(l));
+        cmc_assert(l4_resize(l, 4));
+
+        cmc_assert_equals(size_t, 1, l4_blocks);
+        cmc_assert_equals(ptr, l->inline_buffer, l->buffer);
+        cmc_assert_equals(size_t, 4, l4_capacity(l));
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert_equals(size_t, i, l4_get(l, i));
+
+        cmc_assert(l4_resize(l, 1000));
+        cmc_assert_equals(size_t, 2, l4_blocks);
+        cmc_assert_equals(size_t, 1000, l4_capacity(l));
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert_equals(size_t, i, l4_get(l, i));
+
+        l4_free(l);
+
+        cmc_assert_equals(size_t, 0, l4_blocks);
+    });
+
     CMC_CREATE_TEST(flags, {
         struct list *l = l_new(100, l_fval);
 
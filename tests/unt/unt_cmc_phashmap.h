@@ -0,0 +1,617 @@
+#ifndef CMC_TESTS_UNT_CMC_PHASHMAP_H
+#define CMC_TESTS_UNT_CMC_PHASHMAP_H
+
+#include "utl.h"
+
+#include "tst_cmc_phashmap.h"
+
+struct phashmap_fkey *phm_fkey = &(struct phashmap_fkey){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct phashmap_fval *phm_fval = &(struct phashmap_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct cmc_alloc_node *phm_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+/* Only 4 different hashes so that most keys end up in collision nodes */
+size_t phm_bad_hash(size_t key)
+{
+    return key % 4;
+}
+
+struct phashmap_fkey *phm_fkey_collide = &(struct phashmap_fkey){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = phm_bad_hash, .pri = cmc_size_cmp
+};
+
+/* Replaces the map with a new version that has key, freeing the old one */
+bool phm_insert_into(struct phashmap **map, size_t key, size_t value)
+{
+    struct phashmap *next = phm_insert(*map, key, value);
+
+    if (!next)
+        return false;
+
+    phm_free(*map);
+    *map = next;
+
+    return true;
+}
+
+/* Replaces the map with a new version without key, freeing the old one */
+bool phm_remove_from(struct phashmap **map, size_t key)
+{
+    struct phashmap *next = phm_remove(*map, key, NULL);
+
+    if (!next)
+        return false;
+
+    phm_free(*map);
+    *map = next;
+
+    return true;
+}
+
+/* Versions kept by the randomized test and what each should contain, where */
+/* 0 means that the key is not there and anything else is the value plus 1 */
+struct phashmap *phm_versions[32];
+size_t phm_reference[32][300];
+
+CMC_CREATE_UNIT(CMCPHashMap, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct phashmap *map = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_equals(ptr, NULL, map->root);
+        cmc_assert_equals(size_t, 0, phm_count(map));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, phm_flag(map));
+        cmc_assert_equals(ptr, phm_fkey, map->f_key);
+        cmc_assert_equals(ptr, phm_fval, map->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, map->alloc->malloc);
+        cmc_assert_equals(ptr, NULL, map->callbacks);
+
+        phm_free(map);
+
+        cmc_assert_equals(ptr, NULL, phm_new(NULL, phm_fval));
+        cmc_assert_equals(ptr, NULL, phm_new(phm_fkey, NULL));
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct phashmap *map = phm_new_custom(phm_fkey, phm_fval, phm_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_equals(ptr, phm_alloc_node, map->alloc);
+        cmc_assert_equals(ptr, callbacks, map->callbacks);
+
+        struct phashmap *next = phm_insert(map, 1, 2);
+
+        cmc_assert_not_equals(ptr, NULL, next);
+        cmc_assert_equals(ptr, phm_alloc_node, next->alloc);
+        cmc_assert_equals(ptr, callbacks, next->callbacks);
+
+        phm_free(map);
+        phm_free(next);
+    });
+
+    CMC_CREATE_TEST(PFX##_insert(), {
+        struct phashmap *map1 = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        struct phashmap *map2 = phm_insert(map1, 10, 100);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert_equals(size_t, 0, phm_count(map1));
+        cmc_assert_equals(size_t, 1, phm_count(map2));
+        cmc_assert(!phm_contains(map1, 10));
+        cmc_assert(phm_contains(map2, 10));
+
+        cmc_assert_equals(ptr, NULL, phm_insert(map2, 10, 200));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, phm_flag(map2));
+
+        for (size_t i = 0; i < 5000; i++)
+            cmc_assert(phm_insert_into(&map2, i + 1000, i));
+
+        cmc_assert_equals(size_t, 5001, phm_count(map2));
+
+        for (size_t i = 0; i < 5000; i++)
+            cmc_assert_equals(size_t, i, phm_get(map2, i + 1000));
+
+        cmc_assert_equals(size_t, 100, phm_get(map2, 10));
+        cmc_assert(phm_empty(map1));
+
+        phm_free(map1);
+        phm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_update(), {
+        struct phashmap *map1 = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        size_t old = 0;
+
+        cmc_assert_equals(ptr, NULL, phm_update(map1, 1, 2, &old));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, phm_flag(map1));
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(phm_insert_into(&map1, i, i));
+
+        struct phashmap *map2 = phm_update(map1, 50, 500, &old);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert_equals(size_t, 50, old);
+        cmc_assert_equals(size_t, 50, phm_get(map1, 50));
+        cmc_assert_equals(size_t, 500, phm_get(map2, 50));
+        cmc_assert_equals(size_t, 100, phm_count(map2));
+
+        cmc_assert_equals(ptr, NULL, phm_update(map2, 100, 1, &old));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, phm_flag(map2));
+
+        phm_free(map1);
+        phm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove(), {
+        struct phashmap *map1 = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        size_t out = 0;
+
+        cmc_assert_equals(ptr, NULL, phm_remove(map1, 1, &out));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, phm_flag(map1));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(phm_insert_into(&map1, i, i * 2));
+
+        struct phashmap *map2 = phm_remove(map1, 500, &out);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert_equals(size_t, 1000, out);
+        cmc_assert(phm_contains(map1, 500));
+        cmc_assert(!phm_contains(map2, 500));
+        cmc_assert_equals(size_t, 999, phm_count(map2));
+
+        cmc_assert_equals(ptr, NULL, phm_remove(map2, 500, &out));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, phm_flag(map2));
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            if (i != 500)
+                cmc_assert(phm_remove_from(&map2, i));
+        }
+
+        cmc_assert(phm_empty(map2));
+        cmc_assert_equals(ptr, NULL, map2->root);
+        cmc_assert_equals(size_t, 1000, phm_count(map1));
+
+        phm_free(map1);
+        phm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_get(), {
+        struct phashmap *map = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert_equals(size_t, 0, phm_get(map, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, phm_flag(map));
+
+        cmc_assert(phm_insert_into(&map, 1, 2));
+
+        cmc_assert_equals(size_t, 2, phm_get(map, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, phm_flag(map));
+
+        cmc_assert_equals(size_t, 0, phm_get(map, 2));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, phm_flag(map));
+
+        phm_free(map);
+    });
+
+    CMC_CREATE_TEST(collisions, {
+        struct phashmap *map = phm_new(phm_fkey_collide, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 200; i++)
+            cmc_assert(phm_insert_into(&map, i, i + 1));
+
+        cmc_assert_equals(ptr, NULL, phm_insert(map, 33, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, phm_flag(map));
+
+        struct phashmap *updated = phm_update(map, 33, 0, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, updated);
+        cmc_assert_equals(size_t, 0, phm_get(updated, 33));
+        cmc_assert_equals(size_t, 34, phm_get(map, 33));
+
+        phm_free(updated);
+
+        for (size_t i = 0; i < 200; i++)
+            cmc_assert_equals(size_t, i + 1, phm_get(map, i));
+
+        /* Leaves a single key behind in each collision node */
+        for (size_t i = 4; i < 200; i++)
+            cmc_assert(phm_remove_from(&map, i));
+
+        cmc_assert_equals(size_t, 4, phm_count(map));
+
+        /* Each key is back in the root */
+        cmc_assert_equals(size_t, 4, map->root->length);
+        cmc_assert_equals(uint32_t, 0, map->root->nodemap);
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert_equals(size_t, i + 1, phm_get(map, i));
+
+        cmc_assert_equals(ptr, NULL, phm_remove(map, 4, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, phm_flag(map));
+
+        phm_free(map);
+    });
+
+    CMC_CREATE_TEST(versions[random], {
+        struct phashmap *map = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t k = 0; k < 300; k++)
+            phm_reference[0][k] = 0;
+
+        phm_versions[0] = map;
+
+        size_t seed = 11;
+
+        /* Each version is derived from a random earlier one, which must stay */
+        /* unchanged */
+        for (size_t v = 1; v < 32; v++)
+        {
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+            size_t from = (seed >> 33) % v;
+
+            struct phashmap *next = phm_copy_of(phm_versions[from]);
+
+            cmc_assert_not_equals(ptr, NULL, next);
+
+            for (size_t k = 0; k < 300; k++)
+                phm_reference[v][k] = phm_reference[from][k];
+
+            for (size_t step = 0; step < 200; step++)
+            {
+                seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+                size_t key = (seed >> 33) % 300;
+
+                if (phm_reference[v][key] == 0)
+                {
+                    cmc_assert(phm_insert_into(&next, key, step));
+                    phm_reference[v][key] = step + 1;
+                }
+                else if ((seed >> 40) % 2 == 0)
+                {
+                    cmc_assert(phm_remove_from(&next, key));
+                    phm_reference[v][key] = 0;
+                }
+                else
+                {
+                    struct phashmap *updated = phm_update(next, key, step, NULL);
+
+                    cmc_assert_not_equals(ptr, NULL, updated);
+
+                    phm_free(next);
+                    next = updated;
+                    phm_reference[v][key] = step + 1;
+                }
+            }
+
+            phm_versions[v] = next;
+        }
+
+        for (size_t v = 0; v < 32; v++)
+        {
+            size_t count = 0;
+
+            for (size_t k = 0; k < 300; k++)
+            {
+                if (phm_reference[v][k] == 0)
+                    cmc_assert(!phm_contains(phm_versions[v], k));
+                else
+                {
+                    cmc_assert_equals(size_t, phm_reference[v][k] - 1, phm_get(phm_versions[v], k));
+                    count++;
+                }
+            }
+
+            cmc_assert_equals(size_t, count, phm_count(phm_versions[v]));
+        }
+
+        for (size_t v = 0; v < 32; v++)
+            phm_free(phm_versions[v]);
+    });
+
+    CMC_CREATE_TEST(sharing, {
+        struct phashmap *map1 = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        for (size_t i = 0; i < 10000; i++)
+            cmc_assert(phm_insert_into(&map1, i, i));
+
+        struct phashmap *map2 = phm_update(map1, 1234, 0, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+
+        /* Only the child on the path to the updated key was copied */
+        size_t shared = 0;
+
+        cmc_assert_equals(uint32_t, UINT32_MAX, map1->root->nodemap);
+
+        for (size_t i = 0; i < 32; i++)
+        {
+            if (map1->root->children[i] == map2->root->children[i])
+            {
+                cmc_assert_equals(size_t, 2, map1->root->children[i]->refcount);
+                shared++;
+            }
+        }
+
+        cmc_assert_equals(size_t, 31, shared);
+
+        phm_free(map1);
+
+        for (size_t i = 0; i < 10000; i++)
+            cmc_assert_equals(size_t, i == 1234 ? 0 : i, phm_get(map2, i));
+
+        phm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of(), {
+        struct phashmap *map1 = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        struct phashmap *map2 = phm_copy_of(map1);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert(phm_equals(map1, map2));
+
+        phm_free(map2);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(phm_insert_into(&map1, i, i));
+
+        map2 = phm_copy_of(map1);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert_equals(ptr, map1->root, map2->root);
+        cmc_assert_equals(size_t, 2, map1->root->refcount);
+        cmc_assert_equals(size_t, 1000, phm_count(map2));
+
+        phm_free(map1);
+
+        cmc_assert_equals(size_t, 1, map2->root->refcount);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert_equals(size_t, i, phm_get(map2, i));
+
+        phm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_equals(), {
+        struct phashmap *map1 = phm_new(phm_fkey, phm_fval);
+        struct phashmap *map2 = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+        cmc_assert_not_equals(ptr, NULL, map2);
+
+        cmc_assert(phm_equals(map1, map2));
+
+        /* Built in different orders */
+        for (size_t i = 0; i < 500; i++)
+        {
+            cmc_assert(phm_insert_into(&map1, i, i));
+            cmc_assert(phm_insert_into(&map2, 499 - i, 499 - i));
+        }
+
+        cmc_assert(phm_equals(map1, map2));
+
+        struct phashmap *map3 = phm_update(map2, 10, 11, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, map3);
+        cmc_assert(!phm_equals(map1, map3));
+
+        phm_free(map3);
+
+        map3 = phm_remove(map2, 10, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, map3);
+        cmc_assert(!phm_equals(map1, map3));
+        cmc_assert(phm_insert_into(&map3, 1000, 10));
+        cmc_assert(!phm_equals(map1, map3));
+
+        phm_free(map1);
+        phm_free(map2);
+        phm_free(map3);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct phashmap *map = phm_new_custom(phm_fkey, phm_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(phm_insert_into(&map, 1, 2));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        struct phashmap *updated = phm_update(map, 1, 3, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, updated);
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert_equals(size_t, 3, phm_get(updated, 1));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert(phm_contains(map, 1));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert(phm_remove_from(&updated, 1));
+        cmc_assert_equals(int32_t, 1, total_delete);
+
+        cmc_assert_equals(int32_t, 0, total_resize);
+
+        phm_free(map);
+        phm_free(updated);
+    });
+});
+
+CMC_CREATE_UNIT(CMCPHashMapIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct phashmap *map = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        struct phashmap_iter it = phm_iter_start(map);
+
+        cmc_assert(phm_iter_at_start(&it));
+        cmc_assert(phm_iter_at_end(&it));
+
+        cmc_assert(phm_insert_into(&map, 1, 2));
+
+        it = phm_iter_start(map);
+
+        cmc_assert(phm_iter_at_start(&it));
+        cmc_assert(!phm_iter_at_end(&it));
+        cmc_assert_equals(size_t, 1, phm_iter_key(&it));
+        cmc_assert_equals(size_t, 2, phm_iter_value(&it));
+
+        phm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_end(), {
+        struct phashmap *map = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(phm_insert_into(&map, i, i));
+
+        struct phashmap_iter it = phm_iter_end(map);
+
+        cmc_assert(!phm_iter_at_start(&it));
+        cmc_assert(phm_iter_at_end(&it));
+        cmc_assert_equals(size_t, 99, phm_iter_index(&it));
+
+        phm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct phashmap *map = phm_new(phm_fkey_collide, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(phm_insert_into(&map, i, i));
+
+        struct phashmap *other = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, other);
+
+        for (size_t i = 0; i < 3000; i++)
+            cmc_assert(phm_insert_into(&other, i, i));
+
+        size_t total = 0;
+        size_t sum = 0;
+
+        for (struct phashmap_iter it = phm_iter_start(map); !phm_iter_at_end(&it); phm_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, total, phm_iter_index(&it));
+            cmc_assert_equals(size_t, phm_iter_key(&it), phm_iter_value(&it));
+            sum += phm_iter_key(&it);
+            total++;
+        }
+
+        cmc_assert_equals(size_t, 50, total);
+        cmc_assert_equals(size_t, 49 * 50 / 2, sum);
+
+        total = 0;
+        sum = 0;
+
+        for (struct phashmap_iter it = phm_iter_start(other); !phm_iter_at_end(&it); phm_iter_next(&it))
+        {
+            sum += phm_iter_key(&it);
+            total++;
+        }
+
+        cmc_assert_equals(size_t, 3000, total);
+        cmc_assert_equals(size_t, 2999 * 3000 / 2, sum);
+
+        phm_free(map);
+        phm_free(other);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        struct phashmap *map = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 3000; i++)
+            cmc_assert(phm_insert_into(&map, i, i));
+
+        struct phashmap_iter forward = phm_iter_start(map);
+
+        cmc_assert(phm_iter_go_to(&forward, 2999));
+
+        size_t total = 0;
+
+        /* Walking back visits the same keys in reverse */
+        for (struct phashmap_iter it = phm_iter_end(map); !phm_iter_at_start(&it); phm_iter_prev(&it))
+        {
+            cmc_assert_equals(size_t, phm_iter_key(&forward), phm_iter_key(&it));
+            cmc_assert_equals(size_t, 2999 - total, phm_iter_index(&it));
+            phm_iter_prev(&forward);
+            total++;
+        }
+
+        cmc_assert_equals(size_t, 3000, total);
+
+        phm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_go_to(), {
+        struct phashmap *map = phm_new(phm_fkey, phm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 200; i++)
+            cmc_assert(phm_insert_into(&map, i, i));
+
+        struct phashmap_iter it1 = phm_iter_start(map);
+        struct phashmap_iter it2 = phm_iter_start(map);
+
+        cmc_assert(phm_iter_go_to(&it1, 150));
+        cmc_assert(phm_iter_advance(&it2, 150));
+        cmc_assert_equals(size_t, phm_iter_key(&it2), phm_iter_key(&it1));
+
+        cmc_assert(phm_iter_go_to(&it1, 20));
+        cmc_assert(phm_iter_rewind(&it2, 130));
+        cmc_assert_equals(size_t, phm_iter_key(&it2), phm_iter_key(&it1));
+
+        cmc_assert(!phm_iter_go_to(&it1, 200));
+        cmc_assert(phm_iter_to_end(&it1));
+        cmc_assert_equals(size_t, 199, phm_iter_index(&it1));
+        cmc_assert(phm_iter_to_start(&it1));
+        cmc_assert_equals(size_t, 0, phm_iter_index(&it1));
+
+        phm_free(map);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_PHASHMAP_H */
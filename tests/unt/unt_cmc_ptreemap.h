@@ -0,0 +1,690 @@
+#ifndef CMC_TESTS_UNT_CMC_PTREEMAP_H
+#define CMC_TESTS_UNT_CMC_PTREEMAP_H
+
+#include "utl.h"
+
+#include "tst_cmc_ptreemap.h"
+
+struct ptreemap_fkey *ptm_fkey = &(struct ptreemap_fkey){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct ptreemap_fval *ptm_fval = &(struct ptreemap_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct cmc_alloc_node *ptm_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+/* Returns the height of the subtree at node if it is a valid AVL Tree with */
+/* keys in [low, high], or -1 otherwise */
+int ptm_check(struct ptreemap_node *node, size_t low, size_t high)
+{
+    if (!node)
+        return 0;
+
+    if (node->key < low || node->key > high || node->refcount == 0)
+        return -1;
+
+    int h_l = node->key == 0 ? (node->left ? -1 : 0) : ptm_check(node->left, low, node->key - 1);
+    int h_r = ptm_check(node->right, node->key + 1, high);
+
+    if (h_l < 0 || h_r < 0 || h_l - h_r > 1 || h_r - h_l > 1)
+        return -1;
+
+    int height = 1 + (h_l > h_r ? h_l : h_r);
+
+    return height == node->height ? height : -1;
+}
+
+/* Replaces the map with a new version that has key, freeing the old one */
+bool ptm_insert_into(struct ptreemap **map, size_t key, size_t value)
+{
+    struct ptreemap *next = ptm_insert(*map, key, value);
+
+    if (!next)
+        return false;
+
+    ptm_free(*map);
+    *map = next;
+
+    return true;
+}
+
+/* Replaces the map with a new version without key, freeing the old one */
+bool ptm_remove_from(struct ptreemap **map, size_t key)
+{
+    struct ptreemap *next = ptm_remove(*map, key, NULL);
+
+    if (!next)
+        return false;
+
+    ptm_free(*map);
+    *map = next;
+
+    return true;
+}
+
+/* Versions kept by the randomized test and what each should contain, where */
+/* 0 means that the key is not there and anything else is the value plus 1 */
+struct ptreemap *ptm_versions[32];
+size_t ptm_reference[32][300];
+
+CMC_CREATE_UNIT(CMCPTreeMap, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_equals(ptr, NULL, map->root);
+        cmc_assert_equals(size_t, 0, ptm_count(map));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, ptm_flag(map));
+        cmc_assert_equals(ptr, ptm_fkey, map->f_key);
+        cmc_assert_equals(ptr, ptm_fval, map->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, map->alloc->malloc);
+        cmc_assert_equals(ptr, NULL, map->callbacks);
+
+        ptm_free(map);
+
+        cmc_assert_equals(ptr, NULL, ptm_new(NULL, ptm_fval));
+        cmc_assert_equals(ptr, NULL, ptm_new(ptm_fkey, NULL));
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct ptreemap *map = ptm_new_custom(ptm_fkey, ptm_fval, ptm_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_equals(ptr, ptm_alloc_node, map->alloc);
+        cmc_assert_equals(ptr, callbacks, map->callbacks);
+
+        struct ptreemap *next = ptm_insert(map, 1, 2);
+
+        cmc_assert_not_equals(ptr, NULL, next);
+        cmc_assert_equals(ptr, ptm_alloc_node, next->alloc);
+        cmc_assert_equals(ptr, callbacks, next->callbacks);
+
+        ptm_free(map);
+        ptm_free(next);
+    });
+
+    CMC_CREATE_TEST(PFX##_insert(), {
+        struct ptreemap *map1 = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        struct ptreemap *map2 = ptm_insert(map1, 10, 100);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert_equals(size_t, 0, ptm_count(map1));
+        cmc_assert_equals(size_t, 1, ptm_count(map2));
+        cmc_assert(!ptm_contains(map1, 10));
+        cmc_assert(ptm_contains(map2, 10));
+
+        cmc_assert_equals(ptr, NULL, ptm_insert(map2, 10, 200));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, ptm_flag(map2));
+
+        for (size_t i = 0; i < 5000; i++)
+            cmc_assert(ptm_insert_into(&map2, i + 1000, i));
+
+        cmc_assert_equals(size_t, 5001, ptm_count(map2));
+
+        for (size_t i = 0; i < 5000; i++)
+            cmc_assert_equals(size_t, i, ptm_get(map2, i + 1000));
+
+        cmc_assert_equals(size_t, 100, ptm_get(map2, 10));
+        cmc_assert(ptm_empty(map1));
+
+        ptm_free(map1);
+        ptm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_update(), {
+        struct ptreemap *map1 = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        size_t old = 0;
+
+        cmc_assert_equals(ptr, NULL, ptm_update(map1, 1, 2, &old));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ptm_flag(map1));
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(ptm_insert_into(&map1, i, i));
+
+        struct ptreemap *map2 = ptm_update(map1, 50, 500, &old);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert_equals(size_t, 50, old);
+        cmc_assert_equals(size_t, 50, ptm_get(map1, 50));
+        cmc_assert_equals(size_t, 500, ptm_get(map2, 50));
+        cmc_assert_equals(size_t, 100, ptm_count(map2));
+
+        cmc_assert_equals(ptr, NULL, ptm_update(map2, 100, 1, &old));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, ptm_flag(map2));
+
+        ptm_free(map1);
+        ptm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove(), {
+        struct ptreemap *map1 = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        size_t out = 0;
+
+        cmc_assert_equals(ptr, NULL, ptm_remove(map1, 1, &out));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ptm_flag(map1));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(ptm_insert_into(&map1, i, i * 2));
+
+        struct ptreemap *map2 = ptm_remove(map1, 500, &out);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert_equals(size_t, 1000, out);
+        cmc_assert(ptm_contains(map1, 500));
+        cmc_assert(!ptm_contains(map2, 500));
+        cmc_assert_equals(size_t, 999, ptm_count(map2));
+
+        cmc_assert_equals(ptr, NULL, ptm_remove(map2, 500, &out));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, ptm_flag(map2));
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            if (i != 500)
+                cmc_assert(ptm_remove_from(&map2, i));
+        }
+
+        cmc_assert(ptm_empty(map2));
+        cmc_assert_equals(ptr, NULL, map2->root);
+        cmc_assert_equals(size_t, 1000, ptm_count(map1));
+
+        ptm_free(map1);
+        ptm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_get(), {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert_equals(size_t, 0, ptm_get(map, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ptm_flag(map));
+
+        cmc_assert(ptm_insert_into(&map, 1, 2));
+
+        cmc_assert_equals(size_t, 2, ptm_get(map, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, ptm_flag(map));
+
+        cmc_assert_equals(size_t, 0, ptm_get(map, 2));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, ptm_flag(map));
+
+        ptm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_max(), {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        size_t key = 0;
+        size_t value = 0;
+
+        cmc_assert(!ptm_max(map, &key, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ptm_flag(map));
+
+        for (size_t i = 1; i <= 100; i++)
+            cmc_assert(ptm_insert_into(&map, (i * 37) % 101, i));
+
+        cmc_assert(ptm_max(map, &key, &value));
+        cmc_assert_equals(size_t, 100, key);
+        cmc_assert_equals(size_t, 30, value);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, ptm_flag(map));
+
+        ptm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_min(), {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        size_t key = 0;
+        size_t value = 0;
+
+        cmc_assert(!ptm_min(map, &key, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ptm_flag(map));
+
+        for (size_t i = 1; i <= 100; i++)
+            cmc_assert(ptm_insert_into(&map, (i * 37) % 101, i));
+
+        cmc_assert(ptm_min(map, &key, &value));
+        cmc_assert_equals(size_t, 1, key);
+        cmc_assert_equals(size_t, 71, value);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, ptm_flag(map));
+
+        ptm_free(map);
+    });
+
+    CMC_CREATE_TEST(balance, {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        /* Sorted insertions would degrade an unbalanced tree into a list */
+        for (size_t i = 0; i < 4096; i++)
+        {
+            cmc_assert(ptm_insert_into(&map, i, i));
+
+            if (i % 256 == 0)
+                cmc_assert_greater(int32_t, 0, ptm_check(map->root, 0, SIZE_MAX));
+        }
+
+        cmc_assert_equals(int32_t, 13, ptm_check(map->root, 0, SIZE_MAX));
+
+        /* Removals from both ends and from the middle */
+        for (size_t i = 0; i < 1024; i++)
+        {
+            cmc_assert(ptm_remove_from(&map, i));
+            cmc_assert(ptm_remove_from(&map, 4095 - i));
+            cmc_assert(ptm_remove_from(&map, 1024 + i * 2));
+
+            if (i % 128 == 0)
+                cmc_assert_greater(int32_t, 0, ptm_check(map->root, 0, SIZE_MAX));
+        }
+
+        cmc_assert_equals(size_t, 1024, ptm_count(map));
+        cmc_assert_greater(int32_t, 0, ptm_check(map->root, 0, SIZE_MAX));
+
+        for (size_t i = 1024; i < 3072; i++)
+            cmc_assert(ptm_contains(map, i) == (i % 2 == 1));
+
+        ptm_free(map);
+    });
+
+    CMC_CREATE_TEST(versions[random], {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t k = 0; k < 300; k++)
+            ptm_reference[0][k] = 0;
+
+        ptm_versions[0] = map;
+
+        size_t seed = 11;
+
+        /* Each version is derived from a random earlier one, which must stay */
+        /* unchanged */
+        for (size_t v = 1; v < 32; v++)
+        {
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+            size_t from = (seed >> 33) % v;
+
+            struct ptreemap *next = ptm_copy_of(ptm_versions[from]);
+
+            cmc_assert_not_equals(ptr, NULL, next);
+
+            for (size_t k = 0; k < 300; k++)
+                ptm_reference[v][k] = ptm_reference[from][k];
+
+            for (size_t step = 0; step < 200; step++)
+            {
+                seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+                size_t key = (seed >> 33) % 300;
+
+                if (ptm_reference[v][key] == 0)
+                {
+                    cmc_assert(ptm_insert_into(&next, key, step));
+                    ptm_reference[v][key] = step + 1;
+                }
+                else if ((seed >> 40) % 2 == 0)
+                {
+                    cmc_assert(ptm_remove_from(&next, key));
+                    ptm_reference[v][key] = 0;
+                }
+                else
+                {
+                    struct ptreemap *updated = ptm_update(next, key, step, NULL);
+
+                    cmc_assert_not_equals(ptr, NULL, updated);
+
+                    ptm_free(next);
+                    next = updated;
+                    ptm_reference[v][key] = step + 1;
+                }
+            }
+
+            ptm_versions[v] = next;
+        }
+
+        for (size_t v = 0; v < 32; v++)
+        {
+            size_t count = 0;
+
+            for (size_t k = 0; k < 300; k++)
+            {
+                if (ptm_reference[v][k] == 0)
+                    cmc_assert(!ptm_contains(ptm_versions[v], k));
+                else
+                {
+                    cmc_assert_equals(size_t, ptm_reference[v][k] - 1, ptm_get(ptm_versions[v], k));
+                    count++;
+                }
+            }
+
+            cmc_assert_equals(size_t, count, ptm_count(ptm_versions[v]));
+            cmc_assert_greater_equals(int32_t, 0, ptm_check(ptm_versions[v]->root, 0, SIZE_MAX));
+        }
+
+        for (size_t v = 0; v < 32; v++)
+            ptm_free(ptm_versions[v]);
+    });
+
+    CMC_CREATE_TEST(sharing, {
+        struct ptreemap *map1 = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        for (size_t i = 0; i < 10000; i++)
+            cmc_assert(ptm_insert_into(&map1, i, i));
+
+        struct ptreemap *map2 = ptm_update(map1, 1234, 0, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+
+        /* Only the nodes on the path to the updated key were copied and */
+        /* each of them points to the other child of the node it copies */
+        struct ptreemap_node *node1 = map1->root;
+        struct ptreemap_node *node2 = map2->root;
+        size_t copied = 0;
+
+        while (node1->key != 1234)
+        {
+            cmc_assert_not_equals(ptr, node1, node2);
+            cmc_assert_equals(size_t, node1->key, node2->key);
+
+            if (1234 < node1->key)
+            {
+                cmc_assert_equals(ptr, node1->right, node2->right);
+                cmc_assert_equals(size_t, 2, node1->right->refcount);
+                node1 = node1->left;
+                node2 = node2->left;
+            }
+            else
+            {
+                cmc_assert_equals(ptr, node1->left, node2->left);
+                cmc_assert_equals(size_t, 2, node1->left->refcount);
+                node1 = node1->right;
+                node2 = node2->right;
+            }
+
+            copied++;
+        }
+
+        cmc_assert_not_equals(ptr, node1, node2);
+        cmc_assert_equals(ptr, node1->left, node2->left);
+        cmc_assert_equals(ptr, node1->right, node2->right);
+        cmc_assert_lesser(size_t, 17, copied);
+
+        ptm_free(map1);
+
+        for (size_t i = 0; i < 10000; i++)
+            cmc_assert_equals(size_t, i == 1234 ? 0 : i, ptm_get(map2, i));
+
+        ptm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of(), {
+        struct ptreemap *map1 = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        struct ptreemap *map2 = ptm_copy_of(map1);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert(ptm_equals(map1, map2));
+
+        ptm_free(map2);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(ptm_insert_into(&map1, i, i));
+
+        map2 = ptm_copy_of(map1);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert_equals(ptr, map1->root, map2->root);
+        cmc_assert_equals(size_t, 2, map1->root->refcount);
+        cmc_assert_equals(size_t, 1000, ptm_count(map2));
+
+        ptm_free(map1);
+
+        cmc_assert_equals(size_t, 1, map2->root->refcount);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert_equals(size_t, i, ptm_get(map2, i));
+
+        ptm_free(map2);
+    });
+
+    CMC_CREATE_TEST(PFX##_equals(), {
+        struct ptreemap *map1 = ptm_new(ptm_fkey, ptm_fval);
+        struct ptreemap *map2 = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+        cmc_assert_not_equals(ptr, NULL, map2);
+
+        cmc_assert(ptm_equals(map1, map2));
+
+        /* Built in different orders */
+        for (size_t i = 0; i < 500; i++)
+        {
+            cmc_assert(ptm_insert_into(&map1, i, i));
+            cmc_assert(ptm_insert_into(&map2, 499 - i, 499 - i));
+        }
+
+        cmc_assert(ptm_equals(map1, map2));
+
+        struct ptreemap *map3 = ptm_update(map2, 10, 11, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, map3);
+        cmc_assert(!ptm_equals(map1, map3));
+
+        ptm_free(map3);
+
+        map3 = ptm_remove(map2, 10, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, map3);
+        cmc_assert(!ptm_equals(map1, map3));
+        cmc_assert(ptm_insert_into(&map3, 1000, 10));
+        cmc_assert(!ptm_equals(map1, map3));
+
+        ptm_free(map1);
+        ptm_free(map2);
+        ptm_free(map3);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct ptreemap *map = ptm_new_custom(ptm_fkey, ptm_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(ptm_insert_into(&map, 1, 2));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        struct ptreemap *updated = ptm_update(map, 1, 3, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, updated);
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert_equals(size_t, 3, ptm_get(updated, 1));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert(ptm_contains(map, 1));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert(ptm_remove_from(&updated, 1));
+        cmc_assert_equals(int32_t, 1, total_delete);
+
+        cmc_assert_equals(int32_t, 0, total_resize);
+
+        ptm_free(map);
+        ptm_free(updated);
+    });
+});
+
+CMC_CREATE_UNIT(CMCPTreeMapIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        struct ptreemap_iter it = ptm_iter_start(map);
+
+        cmc_assert(ptm_iter_at_start(&it));
+        cmc_assert(ptm_iter_at_end(&it));
+
+        cmc_assert(ptm_insert_into(&map, 1, 2));
+
+        it = ptm_iter_start(map);
+
+        cmc_assert(ptm_iter_at_start(&it));
+        cmc_assert(!ptm_iter_at_end(&it));
+        cmc_assert_equals(size_t, 1, ptm_iter_key(&it));
+        cmc_assert_equals(size_t, 2, ptm_iter_value(&it));
+
+        ptm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_end(), {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(ptm_insert_into(&map, i, i));
+
+        struct ptreemap_iter it = ptm_iter_end(map);
+
+        cmc_assert(!ptm_iter_at_start(&it));
+        cmc_assert(ptm_iter_at_end(&it));
+        cmc_assert_equals(size_t, 99, ptm_iter_index(&it));
+
+        ptm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 1; i <= 3000; i++)
+            cmc_assert(ptm_insert_into(&map, (i * 1237) % 3001, i));
+
+        size_t total = 0;
+
+        /* Keys come out sorted */
+        for (struct ptreemap_iter it = ptm_iter_start(map); !ptm_iter_at_end(&it); ptm_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, total, ptm_iter_index(&it));
+            cmc_assert_equals(size_t, total + 1, ptm_iter_key(&it));
+            total++;
+        }
+
+        cmc_assert_equals(size_t, 3000, total);
+
+        /* An older version iterates over its own keys */
+        struct ptreemap *old = ptm_copy_of(map);
+
+        cmc_assert_not_equals(ptr, NULL, old);
+
+        for (size_t i = 1; i <= 3000; i += 2)
+            cmc_assert(ptm_remove_from(&map, i));
+
+        total = 0;
+
+        for (struct ptreemap_iter it = ptm_iter_start(map); !ptm_iter_at_end(&it); ptm_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, (total + 1) * 2, ptm_iter_key(&it));
+            total++;
+        }
+
+        cmc_assert_equals(size_t, 1500, total);
+
+        total = 0;
+
+        for (struct ptreemap_iter it = ptm_iter_start(old); !ptm_iter_at_end(&it); ptm_iter_next(&it))
+            total++;
+
+        cmc_assert_equals(size_t, 3000, total);
+
+        ptm_free(map);
+        ptm_free(old);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 3000; i++)
+            cmc_assert(ptm_insert_into(&map, i, i));
+
+        struct ptreemap_iter forward = ptm_iter_start(map);
+
+        cmc_assert(ptm_iter_go_to(&forward, 2999));
+
+        size_t total = 0;
+
+        /* Walking back visits the same keys in reverse */
+        for (struct ptreemap_iter it = ptm_iter_end(map); !ptm_iter_at_start(&it); ptm_iter_prev(&it))
+        {
+            cmc_assert_equals(size_t, ptm_iter_key(&forward), ptm_iter_key(&it));
+            cmc_assert_equals(size_t, 2999 - total, ptm_iter_index(&it));
+            ptm_iter_prev(&forward);
+            total++;
+        }
+
+        cmc_assert_equals(size_t, 3000, total);
+
+        ptm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_go_to(), {
+        struct ptreemap *map = ptm_new(ptm_fkey, ptm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 200; i++)
+            cmc_assert(ptm_insert_into(&map, i, i));
+
+        struct ptreemap_iter it1 = ptm_iter_start(map);
+        struct ptreemap_iter it2 = ptm_iter_start(map);
+
+        cmc_assert(ptm_iter_go_to(&it1, 150));
+        cmc_assert(ptm_iter_advance(&it2, 150));
+        cmc_assert_equals(size_t, ptm_iter_key(&it2), ptm_iter_key(&it1));
+
+        cmc_assert(ptm_iter_go_to(&it1, 20));
+        cmc_assert(ptm_iter_rewind(&it2, 130));
+        cmc_assert_equals(size_t, ptm_iter_key(&it2), ptm_iter_key(&it1));
+
+        cmc_assert(!ptm_iter_go_to(&it1, 200));
+        cmc_assert(ptm_iter_to_end(&it1));
+        cmc_assert_equals(size_t, 199, ptm_iter_index(&it1));
+        cmc_assert(ptm_iter_to_start(&it1));
+        cmc_assert_equals(size_t, 0, ptm_iter_index(&it1));
+
+        ptm_free(map);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_PTREEMAP_H */
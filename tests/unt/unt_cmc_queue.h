@@ -9,6 +9,29 @@ struct queue_fval *q_fval = &(struct queue_fval){
     .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
 };
 
+/* Same as q_fval but searches with cmc_size_find() */
+struct queue_fval *q_fval_find = &(struct queue_fval){ .cmp = cmc_size_cmp,
+                                                       .cpy = NULL,
+                                                       .str = cmc_size_str,
+                                                       .free = NULL,
+                                                       .hash = cmc_size_hash,
+                                                       .pri = cmc_size_cmp,
+                                                       .find = cmc_size_find };
+
+struct queue_fval *q_fval_counter = &(struct queue_fval){
+    .cmp = v_c_cmp, .cpy = v_c_cpy, .str = v_c_str, .free = v_c_free, .hash = v_c_hash, .pri = v_c_pri
+};
+
+/* Sum and amount of the values evicted by a queue in overwrite mode */
+static size_t q_evicted_sum = 0;
+static size_t q_evicted_count = 0;
+
+static void q_evict(size_t value)
+{
+    q_evicted_sum += value;
+    q_evicted_count++;
+}
+
 CMC_CREATE_UNIT(CMCQueue, true, {
     CMC_CREATE_TEST(new, {
         struct queue *q = q_new(1000000, q_fval);
@@ -240,6 +263,35 @@ CMC_CREATE_UNIT(CMCQueue, true, {
         q_free(q);
     });
 
+    CMC_CREATE_TEST(contains[find], {
+        struct queue *q = q_new(16, q_fval_find);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+        cmc_assert(!q_contains(q, 1));
+
+        for (size_t i = 1; i <= 12; i++)
+            cmc_assert(q_enqueue(q, i));
+
+        for (size_t i = 1; i <= 8; i++)
+            cmc_assert(q_dequeue(q));
+
+        /* The elements wrap around the end of the buffer */
+        for (size_t i = 13; i <= 24; i++)
+            cmc_assert(q_enqueue(q, i));
+
+        cmc_assert_equals(size_t, 16, q_capacity(q));
+
+        for (size_t i = 1; i <= 8; i++)
+            cmc_assert(!q_contains(q, i));
+
+        for (size_t i = 9; i <= 24; i++)
+            cmc_assert(q_contains(q, i));
+
+        cmc_assert(!q_contains(q, 25));
+
+        q_free(q);
+    });
+
     CMC_CREATE_TEST(empty, {
         struct queue *q = q_new(100, q_fval);
 
@@ -410,6 +462,145 @@ CMC_CREATE_UNIT(CMCQueue, true, {
         q_free(q2);
     });
 
+    CMC_CREATE_TEST(PFX##_set_overwrite(), {
+        struct queue *q = q_new(10, q_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        q_evicted_sum = 0;
+        q_evicted_count = 0;
+
+        q_set_overwrite(q, true, q_evict);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(q_enqueue(q, i));
+
+        cmc_assert_equals(size_t, 10, q_capacity(q));
+        cmc_assert_equals(size_t, 10, q_count(q));
+        cmc_assert_equals(size_t, 90, q_evicted_count);
+        cmc_assert_equals(size_t, 4005, q_evicted_sum);
+
+        struct queue *copy = q_copy_of(q);
+
+        cmc_assert_not_equals(ptr, NULL, copy);
+        cmc_assert(copy->overwrite);
+        cmc_assert(q_enqueue(copy, 100));
+        cmc_assert_equals(size_t, 91, q_evicted_count);
+
+        q_free(copy);
+        for (size_t i = 90; i < 100; i++)
+        {
+            cmc_assert_equals(size_t, i, q_peek(q));
+            cmc_assert(q_dequeue(q));
+        }
+
+        q_set_overwrite(q, false, NULL);
+
+        for (size_t i = 0; i < 20; i++)
+            cmc_assert(q_enqueue(q, i));
+
+        cmc_assert_equals(size_t, 20, q_count(q));
+        cmc_assert_greater_equals(size_t, 20, q_capacity(q));
+        cmc_assert_equals(size_t, 91, q_evicted_count);
+
+        q_free(q);
+    });
+
+    CMC_CREATE_TEST(overwrite[free], {
+        struct queue *q = q_new(8, q_fval_counter);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        v_total_free = 0;
+
+        /* Without evict the overwritten values are freed */
+        q_set_overwrite(q, true, NULL);
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(q_enqueue(q, i));
+
+        cmc_assert_equals(int32_t, 2, v_total_free);
+
+        size_t values[20] = { 0 };
+
+        /* 12 values are skipped and the 8 in the queue are overwritten */
+        cmc_assert(q_enqueue_many(q, values, 20));
+        cmc_assert_equals(size_t, 8, q_count(q));
+        cmc_assert_equals(int32_t, 22, v_total_free);
+
+        q_free(q);
+
+        cmc_assert_equals(int32_t, 30, v_total_free);
+
+        v_total_free = 0;
+    });
+
+    CMC_CREATE_TEST(PFX##_enqueue_many(), {
+        struct queue *q = q_new(8, q_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        size_t values[100];
+
+        for (size_t i = 0; i < 100; i++)
+            values[i] = i;
+
+        cmc_assert(q_enqueue_many(q, values, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, q_flag(q));
+        cmc_assert_equals(size_t, 0, q_count(q));
+
+        /* Move the back close to the end of the buffer */
+        for (size_t i = 0; i < 6; i++)
+            cmc_assert(q_enqueue(q, i));
+        for (size_t i = 0; i < 6; i++)
+            cmc_assert(q_dequeue(q));
+
+        cmc_assert(q_enqueue_many(q, values, 5));
+        cmc_assert_equals(size_t, 5, q_count(q));
+        cmc_assert_equals(size_t, 8, q_capacity(q));
+
+        cmc_assert(q_enqueue_many(q, values + 5, 20));
+        cmc_assert_equals(size_t, 25, q_count(q));
+
+        for (size_t i = 0; i < 25; i++)
+        {
+            cmc_assert_equals(size_t, i, q_peek(q));
+            cmc_assert(q_dequeue(q));
+        }
+
+        q_free(q);
+
+        q = q_new(8, q_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        q_evicted_sum = 0;
+        q_evicted_count = 0;
+
+        q_set_overwrite(q, true, q_evict);
+
+        cmc_assert(q_enqueue_many(q, values, 5));
+        cmc_assert(q_enqueue_many(q, values + 5, 6));
+        cmc_assert_equals(size_t, 8, q_count(q));
+        cmc_assert_equals(size_t, 3, q_evicted_count);
+        cmc_assert_equals(size_t, 3, q_evicted_sum);
+
+        /* Only the last 8 values are kept */
+        cmc_assert(q_enqueue_many(q, values + 11, 20));
+        cmc_assert_equals(size_t, 8, q_count(q));
+        cmc_assert_equals(size_t, 8, q_capacity(q));
+        cmc_assert_equals(size_t, 23, q_evicted_count);
+        cmc_assert_equals(size_t, 253, q_evicted_sum);
+
+        for (size_t i = 23; i < 31; i++)
+        {
+            cmc_assert_equals(size_t, i, q_peek(q));
+            cmc_assert(q_dequeue(q));
+        }
+
+        q_free(q);
+    });
+
     CMC_CREATE_TEST(flag, {
         struct queue *q = q_new(100, q_fval);
 
@@ -0,0 +1,379 @@
+#ifndef CMC_TESTS_UNT_CMC_SEGMENTTREE_H
+#define CMC_TESTS_UNT_CMC_SEGMENTTREE_H
+
+#include "utl.h"
+
+#include "tst_cmc_segmenttree.h"
+
+static size_t sgt_sum(size_t a, size_t b)
+{
+    return a + b;
+}
+
+static size_t sgt_min(size_t a, size_t b)
+{
+    return a < b ? a : b;
+}
+
+static size_t sgt_first(size_t a, size_t b)
+{
+    (void)b;
+    return a;
+}
+
+/* Adds update to each of the count values */
+static size_t sgt_sum_add(size_t value, size_t update, size_t count)
+{
+    return value + update * count;
+}
+
+static size_t sgt_min_add(size_t value, size_t update, size_t count)
+{
+    (void)count;
+    return value + update;
+}
+
+/* Sets each of the count values to update */
+static size_t sgt_sum_assign(size_t value, size_t update, size_t count)
+{
+    (void)value;
+    return update * count;
+}
+
+struct segmenttree_fval *sgt_fval = &(struct segmenttree_fval){ .cmp = cmc_size_cmp,
+                                                                .cpy = NULL,
+                                                                .str = cmc_size_str,
+                                                                .free = NULL,
+                                                                .hash = cmc_size_hash,
+                                                                .pri = cmc_size_cmp,
+                                                                .combine = sgt_sum,
+                                                                .apply = sgt_sum_add };
+
+struct segmenttree_fval *sgt_fval_min = &(struct segmenttree_fval){ .cmp = cmc_size_cmp,
+                                                                    .cpy = NULL,
+                                                                    .str = cmc_size_str,
+                                                                    .free = NULL,
+                                                                    .hash = cmc_size_hash,
+                                                                    .pri = cmc_size_cmp,
+                                                                    .combine = sgt_min,
+                                                                    .apply = sgt_min_add };
+
+struct segmenttree_fval *sgt_fval_assign = &(struct segmenttree_fval){ .cmp = cmc_size_cmp,
+                                                                       .cpy = NULL,
+                                                                       .str = cmc_size_str,
+                                                                       .free = NULL,
+                                                                       .hash = cmc_size_hash,
+                                                                       .pri = cmc_size_cmp,
+                                                                       .combine = sgt_sum,
+                                                                       .apply = sgt_sum_assign };
+
+struct segmenttree_fval *sgt_fval_first = &(struct segmenttree_fval){ .cmp = cmc_size_cmp,
+                                                                      .cpy = NULL,
+                                                                      .str = cmc_size_str,
+                                                                      .free = NULL,
+                                                                      .hash = cmc_size_hash,
+                                                                      .pri = cmc_size_cmp,
+                                                                      .combine = sgt_first,
+                                                                      .apply = NULL };
+
+struct cmc_alloc_node *sgt_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+size_t sgt_values[1000];
+
+CMC_CREATE_UNIT(CMCSegmentTree, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        for (size_t i = 0; i < 1000; i++)
+            sgt_values[i] = i;
+
+        struct segmenttree *tree = sgt_new(sgt_values, 1000, sgt_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+        cmc_assert_not_equals(ptr, NULL, tree->tree);
+        cmc_assert_not_equals(ptr, NULL, tree->lazy);
+        cmc_assert_not_equals(ptr, NULL, tree->pending);
+        cmc_assert_equals(size_t, 2048, tree->nodes);
+        cmc_assert_equals(size_t, 1000, sgt_count(tree));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, sgt_flag(tree));
+        cmc_assert_equals(ptr, sgt_fval, tree->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, tree->alloc->malloc);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.free, tree->alloc->free);
+        cmc_assert_equals(ptr, NULL, tree->callbacks);
+        cmc_assert_equals(size_t, 999 * 1000 / 2, sgt_query(tree, 0, 999));
+
+        sgt_free(tree);
+
+        /* Without an apply function there is nothing to keep pending */
+        tree = sgt_new(sgt_values, 1, sgt_fval_first);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+        cmc_assert_equals(ptr, NULL, tree->lazy);
+        cmc_assert_equals(ptr, NULL, tree->pending);
+        cmc_assert_equals(size_t, 2, tree->nodes);
+        cmc_assert_equals(size_t, 0, sgt_get(tree, 0));
+
+        sgt_free(tree);
+
+        tree = sgt_new(sgt_values, 0, sgt_fval);
+        cmc_assert_equals(ptr, NULL, tree);
+
+        tree = sgt_new(NULL, 1000, sgt_fval);
+        cmc_assert_equals(ptr, NULL, tree);
+
+        tree = sgt_new(sgt_values, 1000, NULL);
+        cmc_assert_equals(ptr, NULL, tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct segmenttree *tree = sgt_new_custom(sgt_values, 1000, sgt_fval, sgt_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+        cmc_assert_equals(ptr, sgt_alloc_node, tree->alloc);
+        cmc_assert_equals(ptr, callbacks, tree->callbacks);
+
+        sgt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_query(), {
+        for (size_t i = 0; i < 1000; i++)
+            sgt_values[i] = (i * 7919) % 1009;
+
+        struct segmenttree *tree = sgt_new(sgt_values, 1000, sgt_fval_min);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t from = 0; from < 1000; from += 7)
+        {
+            size_t min = SIZE_MAX;
+
+            for (size_t to = from; to < 1000; to++)
+            {
+                min = sgt_min(min, sgt_values[to]);
+
+                if (to % 13 == 0 || to == from)
+                    cmc_assert_equals(size_t, min, sgt_query(tree, from, to));
+            }
+        }
+
+        cmc_assert_equals(size_t, 0, sgt_query(tree, 10, 9));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, sgt_flag(tree));
+        cmc_assert_equals(size_t, 0, sgt_query(tree, 10, 1000));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, sgt_flag(tree));
+
+        sgt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_query() order, {
+        for (size_t i = 0; i < 1000; i++)
+            sgt_values[i] = i;
+
+        /* Only works if values are combined from left to right */
+        struct segmenttree *tree = sgt_new(sgt_values, 1000, sgt_fval_first);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t from = 0; from < 1000; from++)
+            cmc_assert_equals(size_t, from, sgt_query(tree, from, 999));
+
+        sgt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_set() PFX##_get(), {
+        for (size_t i = 0; i < 1000; i++)
+            sgt_values[i] = 1;
+
+        struct segmenttree *tree = sgt_new(sgt_values, 1000, sgt_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 1000; i += 2)
+            cmc_assert(sgt_set(tree, i, i));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert_equals(size_t, i % 2 == 0 ? i : 1, sgt_get(tree, i));
+
+        /* 0 + 2 + ... + 998 and 500 ones */
+        cmc_assert_equals(size_t, 249500 + 500, sgt_query(tree, 0, 999));
+
+        cmc_assert(!sgt_set(tree, 1000, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, sgt_flag(tree));
+
+        sgt_get(tree, 1000);
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, sgt_flag(tree));
+
+        sgt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_update(), {
+        for (size_t i = 0; i < 1000; i++)
+            sgt_values[i] = i % 10;
+
+        struct segmenttree *tree = sgt_new(sgt_values, 1000, sgt_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            size_t from = (i * 37) % 1000;
+            size_t to = from + (i * 53) % (1000 - from);
+
+            cmc_assert(sgt_update(tree, from, to, i));
+
+            for (size_t j = from; j <= to; j++)
+                sgt_values[j] += i;
+
+            /* Point updates in between the range updates */
+            if (i % 10 == 0)
+            {
+                cmc_assert(sgt_set(tree, to, 5));
+                sgt_values[to] = 5;
+            }
+        }
+
+        for (size_t from = 0; from < 1000; from += 11)
+        {
+            size_t sum = 0;
+
+            for (size_t to = from; to < 1000; to++)
+            {
+                sum += sgt_values[to];
+
+                if (to % 17 == 0 || to == from)
+                    cmc_assert_equals(size_t, sum, sgt_query(tree, from, to));
+            }
+        }
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert_equals(size_t, sgt_values[i], sgt_get(tree, i));
+
+        cmc_assert(!sgt_update(tree, 10, 9, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, sgt_flag(tree));
+        cmc_assert(!sgt_update(tree, 10, 1000, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, sgt_flag(tree));
+
+        sgt_free(tree);
+
+        tree = sgt_new(sgt_values, 1000, sgt_fval_first);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+        cmc_assert(!sgt_update(tree, 0, 10, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, sgt_flag(tree));
+
+        sgt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_update() min, {
+        for (size_t i = 0; i < 1000; i++)
+            sgt_values[i] = 1000 - i;
+
+        struct segmenttree *tree = sgt_new(sgt_values, 1000, sgt_fval_min);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        cmc_assert(sgt_update(tree, 900, 999, 1000));
+        cmc_assert_equals(size_t, 101, sgt_query(tree, 0, 999));
+        cmc_assert_equals(size_t, 1001, sgt_query(tree, 900, 999));
+        cmc_assert_equals(size_t, 101, sgt_query(tree, 899, 950));
+
+        cmc_assert(sgt_update(tree, 0, 999, 5));
+        cmc_assert_equals(size_t, 106, sgt_query(tree, 0, 999));
+        cmc_assert_equals(size_t, 1006, sgt_get(tree, 999));
+
+        sgt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_update() assign, {
+        for (size_t i = 0; i < 1000; i++)
+            sgt_values[i] = 1;
+
+        struct segmenttree *tree = sgt_new(sgt_values, 1000, sgt_fval_assign);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        /* Overlapping updates where the newer one must win */
+        cmc_assert(sgt_update(tree, 0, 499, 2));
+        cmc_assert(sgt_update(tree, 0, 999, 3));
+        cmc_assert(sgt_update(tree, 250, 749, 4));
+
+        cmc_assert_equals(size_t, 250 * 3 + 500 * 4 + 250 * 3, sgt_query(tree, 0, 999));
+        cmc_assert_equals(size_t, 3, sgt_get(tree, 0));
+        cmc_assert_equals(size_t, 4, sgt_get(tree, 250));
+        cmc_assert_equals(size_t, 4, sgt_get(tree, 749));
+        cmc_assert_equals(size_t, 3, sgt_get(tree, 750));
+
+        sgt_free(tree);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of() PFX##_equals(), {
+        for (size_t i = 0; i < 1000; i++)
+            sgt_values[i] = i;
+
+        struct segmenttree *tree1 = sgt_new(sgt_values, 1000, sgt_fval);
+
+        cmc_assert_not_equals(ptr, NULL, tree1);
+
+        /* Leaves some updates pending */
+        cmc_assert(sgt_update(tree1, 0, 999, 1));
+        cmc_assert(sgt_update(tree1, 100, 199, 1));
+
+        struct segmenttree *tree2 = sgt_copy_of(tree1);
+
+        cmc_assert_not_equals(ptr, NULL, tree2);
+        cmc_assert(sgt_equals(tree1, tree2));
+        cmc_assert_equals(size_t, 100, sgt_get(tree2, 99));
+        cmc_assert_equals(size_t, 102, sgt_get(tree2, 100));
+
+        cmc_assert(sgt_set(tree2, 10, 0));
+        cmc_assert(!sgt_equals(tree1, tree2));
+
+        cmc_assert(sgt_set(tree2, 10, 11));
+        cmc_assert(sgt_equals(tree1, tree2));
+
+        sgt_free(tree1);
+        sgt_free(tree2);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct segmenttree *tree = sgt_new_custom(sgt_values, 1000, sgt_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, tree);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(sgt_set(tree, 1, 1));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert(sgt_update(tree, 1, 10, 1));
+        cmc_assert_equals(int32_t, 2, total_update);
+
+        sgt_get(tree, 1);
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        sgt_query(tree, 5, 10);
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert_equals(int32_t, 0, total_create);
+        cmc_assert_equals(int32_t, 2, total_read);
+        cmc_assert_equals(int32_t, 2, total_update);
+        cmc_assert_equals(int32_t, 0, total_delete);
+        cmc_assert_equals(int32_t, 0, total_resize);
+
+        sgt_customize(tree, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, tree->callbacks);
+
+        sgt_free(tree);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_SEGMENTTREE_H */
@@ -0,0 +1,442 @@
+#ifndef CMC_TESTS_UNT_CMC_SLOTMAP_H
+#define CMC_TESTS_UNT_CMC_SLOTMAP_H
+
+#include "utl.h"
+
+#include "tst_cmc_slotmap.h"
+
+struct slotmap_fval *sm_fval = &(struct slotmap_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct slotmap_fval *sm_fval_counter = &(struct slotmap_fval){
+    .cmp = v_c_cmp, .cpy = v_c_cpy, .str = v_c_str, .free = v_c_free, .hash = v_c_hash, .pri = v_c_pri
+};
+
+struct cmc_alloc_node *sm_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+uint64_t sm_handles[1000];
+
+CMC_CREATE_UNIT(CMCSlotMap, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct slotmap *map = sm_new(100, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_not_equals(ptr, NULL, map->buffer);
+        cmc_assert_not_equals(ptr, NULL, map->owner);
+        cmc_assert_not_equals(ptr, NULL, map->slots);
+        cmc_assert_equals(size_t, 100, sm_capacity(map));
+        cmc_assert_equals(size_t, 0, sm_count(map));
+        cmc_assert_equals(size_t, 0, map->used);
+        cmc_assert_equals(uint32_t, CMC_SLOTMAP_END, map->free);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, sm_flag(map));
+        cmc_assert_equals(ptr, sm_fval, map->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, map->alloc->malloc);
+        cmc_assert_equals(ptr, NULL, map->callbacks);
+
+        sm_free(map);
+
+        map = sm_new(0, sm_fval);
+        cmc_assert_equals(ptr, NULL, map);
+
+        map = sm_new(UINT32_MAX, sm_fval);
+        cmc_assert_equals(ptr, NULL, map);
+
+        map = sm_new(100, NULL);
+        cmc_assert_equals(ptr, NULL, map);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct slotmap *map = sm_new_custom(100, sm_fval, sm_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_equals(ptr, sm_alloc_node, map->alloc);
+        cmc_assert_equals(ptr, callbacks, map->callbacks);
+
+        sm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_clear(), {
+        v_total_free = 0;
+        struct slotmap *map = sm_new(100, sm_fval_counter);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(sm_insert(map, i, &sm_handles[i]));
+
+        sm_clear(map);
+
+        cmc_assert_equals(size_t, 0, sm_count(map));
+        cmc_assert_equals(int32_t, 50, v_total_free);
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(!sm_contains(map, sm_handles[i]));
+
+        /* Slots are reused but old handles stay stale */
+        uint64_t handle;
+        cmc_assert(sm_insert(map, 7, &handle));
+        cmc_assert_equals(size_t, 50, map->used);
+        cmc_assert(sm_contains(map, handle));
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(!sm_contains(map, sm_handles[i]));
+
+        sm_free(map);
+        v_total_free = 0;
+    });
+
+    CMC_CREATE_TEST(PFX##_insert(), {
+        struct slotmap *map = sm_new(1, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(sm_insert(map, i * 3, &sm_handles[i]));
+
+        cmc_assert_equals(size_t, 1000, sm_count(map));
+        cmc_assert_greater_equals(size_t, 1000, sm_capacity(map));
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            cmc_assert(sm_contains(map, sm_handles[i]));
+            cmc_assert_equals(size_t, i * 3, sm_get(map, sm_handles[i]));
+        }
+
+        /* The null handle is never valid */
+        cmc_assert(!sm_contains(map, CMC_SLOTMAP_NULL));
+
+        cmc_assert(sm_insert(map, 5, NULL));
+        cmc_assert_equals(size_t, 1001, sm_count(map));
+
+        sm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove(), {
+        struct slotmap *map = sm_new(100, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        size_t value;
+
+        cmc_assert(!sm_remove(map, CMC_SLOTMAP_NULL, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, sm_flag(map));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(sm_insert(map, i, &sm_handles[i]));
+
+        for (size_t i = 0; i < 1000; i += 2)
+        {
+            cmc_assert(sm_remove(map, sm_handles[i], &value));
+            cmc_assert_equals(size_t, i, value);
+        }
+
+        cmc_assert_equals(size_t, 500, sm_count(map));
+
+        /* Handles of the remaining values are still valid after the buffer */
+        /* was compacted */
+        for (size_t i = 0; i < 1000; i++)
+        {
+            cmc_assert_equals(bool, i % 2 != 0, sm_contains(map, sm_handles[i]));
+
+            if (i % 2 != 0)
+                cmc_assert_equals(size_t, i, sm_get(map, sm_handles[i]));
+        }
+
+        cmc_assert(!sm_remove(map, sm_handles[0], NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, sm_flag(map));
+
+        /* A reused slot doesn't bring back the old handle */
+        uint64_t handle;
+        cmc_assert(sm_insert(map, 12345, &handle));
+        cmc_assert_equals(uint32_t, CMC_SLOTMAP_INDEX(sm_handles[998]), CMC_SLOTMAP_INDEX(handle));
+        cmc_assert(!sm_contains(map, sm_handles[998]));
+        cmc_assert_equals(size_t, 0, sm_get(map, sm_handles[998]));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, sm_flag(map));
+        cmc_assert_equals(size_t, 12345, sm_get(map, handle));
+
+        for (size_t i = 1; i < 1000; i += 2)
+            cmc_assert(sm_remove(map, sm_handles[i], NULL));
+
+        cmc_assert(sm_remove(map, handle, NULL));
+        cmc_assert(sm_empty(map));
+
+        sm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_update() PFX##_get_ref(), {
+        struct slotmap *map = sm_new(100, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        uint64_t handle;
+        size_t old;
+
+        cmc_assert(!sm_update(map, CMC_SLOTMAP_NULL, 1, &old));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, sm_flag(map));
+        cmc_assert_equals(ptr, NULL, sm_get_ref(map, CMC_SLOTMAP_NULL));
+
+        cmc_assert(sm_insert(map, 10, &handle));
+
+        cmc_assert(sm_update(map, handle, 20, &old));
+        cmc_assert_equals(size_t, 10, old);
+        cmc_assert_equals(size_t, 20, sm_get(map, handle));
+
+        size_t *ref = sm_get_ref(map, handle);
+        cmc_assert_not_equals(ptr, NULL, ref);
+        *ref = 30;
+        cmc_assert_equals(size_t, 30, sm_get(map, handle));
+
+        cmc_assert(!sm_update(map, handle + 1, 1, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, sm_flag(map));
+        cmc_assert_equals(ptr, NULL, sm_get_ref(map, handle + ((uint64_t)2 << 32)));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, sm_flag(map));
+
+        sm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_handle_at(), {
+        struct slotmap *map = sm_new(100, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert_equals(uint64_t, CMC_SLOTMAP_NULL, sm_handle_at(map, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_RANGE, sm_flag(map));
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(sm_insert(map, i, &sm_handles[i]));
+
+        cmc_assert(sm_remove(map, sm_handles[0], NULL));
+
+        for (size_t i = 0; i < sm_count(map); i++)
+        {
+            uint64_t handle = sm_handle_at(map, i);
+
+            cmc_assert_equals(size_t, map->buffer[i], sm_get(map, handle));
+            cmc_assert_equals(uint64_t, sm_handles[map->buffer[i]], handle);
+        }
+
+        sm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_resize(), {
+        struct slotmap *map = sm_new(10, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(sm_insert(map, i, &sm_handles[i]));
+
+        cmc_assert(sm_full(map));
+
+        cmc_assert(sm_resize(map, 100));
+        cmc_assert_equals(size_t, 100, sm_capacity(map));
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert_equals(size_t, i, sm_get(map, sm_handles[i]));
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(sm_remove(map, sm_handles[i], NULL));
+
+        /* Used slots are never dropped */
+        cmc_assert(!sm_resize(map, 5));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, sm_flag(map));
+
+        cmc_assert(sm_resize(map, 10));
+        cmc_assert_equals(size_t, 10, sm_capacity(map));
+
+        sm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of() PFX##_equals(), {
+        struct slotmap *map1 = sm_new(100, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(sm_insert(map1, i, &sm_handles[i]));
+
+        for (size_t i = 0; i < 100; i += 5)
+            cmc_assert(sm_remove(map1, sm_handles[i], NULL));
+
+        struct slotmap *map2 = sm_copy_of(map1);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert(sm_equals(map1, map2));
+
+        for (size_t i = 0; i < 100; i++)
+        {
+            cmc_assert_equals(bool, sm_contains(map1, sm_handles[i]), sm_contains(map2, sm_handles[i]));
+
+            if (i % 5 != 0)
+                cmc_assert_equals(size_t, i, sm_get(map2, sm_handles[i]));
+        }
+
+        cmc_assert(sm_update(map2, sm_handles[1], 1000, NULL));
+        cmc_assert(!sm_equals(map1, map2));
+
+        sm_free(map1);
+        sm_free(map2);
+    });
+
+    CMC_CREATE_TEST(generation wraparound, {
+        struct slotmap *map = sm_new(1, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        uint64_t handle;
+
+        cmc_assert(sm_insert(map, 1, &handle));
+        cmc_assert(sm_remove(map, handle, NULL));
+
+        /* Fast forward the slot to its last generation */
+        map->slots[0].generation = UINT32_MAX - 1;
+
+        cmc_assert(sm_insert(map, 2, &handle));
+        cmc_assert_equals(uint32_t, UINT32_MAX, CMC_SLOTMAP_GENERATION(handle));
+        cmc_assert(sm_remove(map, handle, NULL));
+
+        /* The slot is retired and a new one is used */
+        cmc_assert_equals(uint32_t, CMC_SLOTMAP_END, map->free);
+
+        cmc_assert(sm_insert(map, 3, &handle));
+        cmc_assert_equals(uint32_t, 1, CMC_SLOTMAP_INDEX(handle));
+        cmc_assert_equals(uint32_t, 1, CMC_SLOTMAP_GENERATION(handle));
+        cmc_assert_equals(size_t, 2, map->used);
+
+        sm_free(map);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct slotmap *map = sm_new_custom(1, sm_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        uint64_t handle;
+
+        cmc_assert(sm_insert(map, 1, &handle));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        cmc_assert(sm_insert(map, 2, NULL));
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        cmc_assert(sm_update(map, handle, 3, NULL));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert_equals(size_t, 3, sm_get(map, handle));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert_not_equals(ptr, NULL, sm_get_ref(map, handle));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert(sm_contains(map, handle));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert(sm_remove(map, handle, NULL));
+        cmc_assert_equals(int32_t, 1, total_delete);
+
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 3, total_read);
+        cmc_assert_equals(int32_t, 1, total_update);
+        cmc_assert_equals(int32_t, 1, total_delete);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        sm_customize(map, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, map->callbacks);
+
+        sm_free(map);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+CMC_CREATE_UNIT(CMCSlotMapIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct slotmap *map = sm_new(100, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        struct slotmap_iter it = sm_iter_start(map);
+
+        cmc_assert_equals(ptr, map, it.target);
+        cmc_assert_equals(size_t, 0, it.cursor);
+        cmc_assert_equals(bool, true, it.start);
+        cmc_assert_equals(bool, true, it.end);
+        cmc_assert_equals(uint64_t, CMC_SLOTMAP_NULL, sm_iter_handle(&it));
+        cmc_assert_equals(ptr, NULL, sm_iter_rvalue(&it));
+
+        sm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct slotmap *map = sm_new(100, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(sm_insert(map, i, &sm_handles[i]));
+
+        for (size_t i = 0; i < 1000; i += 4)
+            cmc_assert(sm_remove(map, sm_handles[i], NULL));
+
+        size_t sum = 0;
+        size_t index = 0;
+
+        struct slotmap_iter it = sm_iter_start(map);
+
+        for (; !sm_iter_at_end(&it); sm_iter_next(&it))
+        {
+            size_t value = sm_iter_value(&it);
+
+            cmc_assert_equals(size_t, index, sm_iter_index(&it));
+            cmc_assert_equals(uint64_t, sm_handles[value], sm_iter_handle(&it));
+            cmc_assert_equals(size_t, value, *sm_iter_rvalue(&it));
+
+            sum += value;
+            index++;
+        }
+
+        cmc_assert_equals(size_t, 750, index);
+        cmc_assert_equals(size_t, 499500 - 124500, sum);
+
+        sm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        struct slotmap *map = sm_new(100, sm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(sm_insert(map, i, NULL));
+
+        size_t index = 100;
+
+        struct slotmap_iter it = sm_iter_end(map);
+
+        for (; !sm_iter_at_start(&it); sm_iter_prev(&it))
+        {
+            index--;
+            cmc_assert_equals(size_t, index, sm_iter_value(&it));
+        }
+
+        cmc_assert_equals(size_t, 0, index);
+
+        sm_free(map);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_SLOTMAP_H */
@@ -112,6 +112,62 @@ CMC_CREATE_UNIT(CMCSortedList, true, {
         sl_free(sl);
     });
 
+    CMC_CREATE_TEST(PFX##_remove_range(), {
+        struct sortedlist *sl = sl_new(100, sl_fval);
+
+        cmc_assert_not_equals(ptr, NULL, sl);
+
+        cmc_assert_equals(size_t, 0, sl_remove_range(sl, 0, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, sl_flag(sl));
+
+        /* Every value from 0 to 499 twice */
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(sl_insert(sl, (i * 7) % 500));
+
+        cmc_assert_equals(size_t, 0, sl_remove_range(sl, 10, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, sl_flag(sl));
+
+        cmc_assert_equals(size_t, 200, sl_remove_range(sl, 100, 199));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, sl_flag(sl));
+        cmc_assert_equals(size_t, 800, sl_count(sl));
+
+        for (size_t i = 0; i < 800; i++)
+        {
+            size_t value = i / 2 < 100 ? i / 2 : i / 2 + 100;
+            cmc_assert_equals(size_t, value, sl_get(sl, i));
+        }
+
+        cmc_assert_equals(size_t, 0, sl_remove_range(sl, 150, 160));
+        cmc_assert_equals(size_t, 2, sl_remove_range(sl, 499, 1000));
+        cmc_assert_equals(size_t, 798, sl_remove_range(sl, 0, 498));
+        cmc_assert(sl_empty(sl));
+
+        sl_free(sl);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove_below(), {
+        struct sortedlist *sl = sl_new(100, sl_fval);
+
+        cmc_assert_not_equals(ptr, NULL, sl);
+
+        cmc_assert_equals(size_t, 0, sl_remove_below(sl, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, sl_flag(sl));
+
+        for (size_t i = 1000; i > 0; i--)
+            cmc_assert(sl_insert(sl, i));
+
+        cmc_assert_equals(size_t, 0, sl_remove_below(sl, 1));
+        cmc_assert_equals(size_t, 299, sl_remove_below(sl, 300));
+        cmc_assert_equals(size_t, 701, sl_count(sl));
+        cmc_assert_equals(size_t, 300, sl_min(sl));
+        cmc_assert_equals(size_t, 1000, sl_max(sl));
+
+        cmc_assert_equals(size_t, 701, sl_remove_below(sl, 5000));
+        cmc_assert(sl_empty(sl));
+
+        sl_free(sl);
+    });
+
     CMC_CREATE_TEST(index_of, {
         struct sortedlist *sl = sl_new(1, sl_fval);
 
@@ -0,0 +1,492 @@
+#ifndef CMC_TESTS_UNT_CMC_SORTEDMAP_H
+#define CMC_TESTS_UNT_CMC_SORTEDMAP_H
+
+#include "utl.h"
+
+#include "tst_cmc_sortedmap.h"
+
+struct sortedmap_fkey *smp_fkey = &(struct sortedmap_fkey){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct sortedmap_fval *smp_fval = &(struct sortedmap_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct sortedmap_fkey *smp_fkey_counter = &(struct sortedmap_fkey){
+    .cmp = k_c_cmp, .cpy = k_c_cpy, .str = k_c_str, .free = k_c_free, .hash = k_c_hash, .pri = k_c_pri
+};
+
+struct sortedmap_fval *smp_fval_counter = &(struct sortedmap_fval){
+    .cmp = v_c_cmp, .cpy = v_c_cpy, .str = v_c_str, .free = v_c_free, .hash = v_c_hash, .pri = v_c_pri
+};
+
+struct cmc_alloc_node *smp_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+size_t smp_keys[1000];
+size_t smp_values[1000];
+
+CMC_CREATE_UNIT(CMCSortedMap, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct sortedmap *map = smp_new(100, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_not_equals(ptr, NULL, map->keys);
+        cmc_assert_not_equals(ptr, NULL, map->values);
+        cmc_assert_equals(size_t, 100, smp_capacity(map));
+        cmc_assert_equals(size_t, 0, smp_count(map));
+        cmc_assert_equals(size_t, 0, map->pending);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, smp_flag(map));
+        cmc_assert_equals(ptr, smp_fkey, map->f_key);
+        cmc_assert_equals(ptr, smp_fval, map->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, map->alloc->malloc);
+        cmc_assert_equals(ptr, NULL, map->callbacks);
+
+        smp_free(map);
+
+        map = smp_new(0, smp_fkey, smp_fval);
+        cmc_assert_equals(ptr, NULL, map);
+
+        map = smp_new(100, NULL, smp_fval);
+        cmc_assert_equals(ptr, NULL, map);
+
+        map = smp_new(100, smp_fkey, NULL);
+        cmc_assert_equals(ptr, NULL, map);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct sortedmap *map = smp_new_custom(100, smp_fkey, smp_fval, smp_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_equals(ptr, smp_alloc_node, map->alloc);
+        cmc_assert_equals(ptr, callbacks, map->callbacks);
+
+        smp_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_from_pairs(), {
+        /* Keys in reverse order and with repeated keys */
+        for (size_t i = 0; i < 1000; i++)
+        {
+            smp_keys[i] = (999 - i) / 2;
+            smp_values[i] = i;
+        }
+
+        struct sortedmap *map = smp_from_pairs(smp_keys, smp_values, 1000, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert_equals(size_t, 500, smp_count(map));
+
+        /* The last pair with a given key wins */
+        for (size_t i = 0; i < 500; i++)
+        {
+            cmc_assert_equals(size_t, i, map->keys[i]);
+            cmc_assert_equals(size_t, 999 - 2 * i, smp_get(map, i));
+        }
+
+        smp_free(map);
+
+        map = smp_from_pairs(smp_keys, smp_values, 0, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+        cmc_assert(smp_empty(map));
+
+        smp_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_clear(), {
+        k_total_free = 0;
+        v_total_free = 0;
+
+        struct sortedmap *map = smp_new(100, smp_fkey_counter, smp_fval_counter);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(smp_insert(map, i, i));
+
+        for (size_t i = 50; i < 80; i++)
+            cmc_assert(smp_push(map, i, i));
+
+        smp_clear(map);
+
+        cmc_assert_equals(size_t, 0, smp_count(map));
+        cmc_assert_equals(int32_t, 80, k_total_free);
+        cmc_assert_equals(int32_t, 80, v_total_free);
+
+        smp_free(map);
+
+        k_total_free = 0;
+        v_total_free = 0;
+    });
+
+    CMC_CREATE_TEST(PFX##_insert(), {
+        struct sortedmap *map = smp_new(1, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(smp_insert(map, (i * 7919) % 1000, i));
+
+        cmc_assert_equals(size_t, 1000, smp_count(map));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert_equals(size_t, i, map->keys[i]);
+
+        cmc_assert(!smp_insert(map, 500, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, smp_flag(map));
+
+        smp_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_push() PFX##_merge(), {
+        k_total_free = 0;
+        v_total_free = 0;
+
+        struct sortedmap *map = smp_new(1, smp_fkey_counter, smp_fval_counter);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 100; i += 2)
+            cmc_assert(smp_insert(map, i, i));
+
+        /* Pushing doesn't sort anything */
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(smp_push(map, 99 - 2 * i, 99 - 2 * i));
+
+        cmc_assert_equals(size_t, 50, map->pending);
+
+        /* Replaces the pair that is already in the map and the pushed one */
+        cmc_assert(smp_push(map, 10, 1000));
+        cmc_assert(smp_push(map, 11, 1100));
+        cmc_assert(smp_push(map, 11, 1101));
+
+        cmc_assert(smp_merge(map));
+        cmc_assert_equals(size_t, 0, map->pending);
+        cmc_assert_equals(size_t, 100, map->count);
+        cmc_assert_equals(int32_t, 3, k_total_free);
+        cmc_assert_equals(int32_t, 3, v_total_free);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert_equals(size_t, i, map->keys[i]);
+
+        cmc_assert_equals(size_t, 1000, smp_get(map, 10));
+        cmc_assert_equals(size_t, 1101, smp_get(map, 11));
+        cmc_assert_equals(size_t, 13, smp_get(map, 13));
+
+        /* Reads merge on their own */
+        cmc_assert(smp_push(map, 200, 200));
+        cmc_assert(smp_push(map, 150, 150));
+        cmc_assert(smp_contains(map, 150));
+        cmc_assert_equals(size_t, 0, map->pending);
+        cmc_assert_equals(size_t, 102, smp_count(map));
+
+        smp_free(map);
+
+        k_total_free = 0;
+        v_total_free = 0;
+    });
+
+    CMC_CREATE_TEST(PFX##_update() PFX##_remove(), {
+        struct sortedmap *map = smp_new(100, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        size_t value;
+
+        cmc_assert(!smp_update(map, 1, 1, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, smp_flag(map));
+        cmc_assert(!smp_remove(map, 1, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, smp_flag(map));
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(smp_push(map, i, i));
+
+        cmc_assert(smp_update(map, 50, 5000, &value));
+        cmc_assert_equals(size_t, 50, value);
+        cmc_assert_equals(size_t, 5000, smp_get(map, 50));
+
+        cmc_assert(!smp_update(map, 100, 1, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, smp_flag(map));
+
+        for (size_t i = 0; i < 100; i += 2)
+            cmc_assert(smp_remove(map, i, NULL));
+
+        cmc_assert(!smp_remove(map, 0, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, smp_flag(map));
+
+        cmc_assert_equals(size_t, 50, smp_count(map));
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert_equals(bool, i % 2 != 0, smp_contains(map, i));
+
+        size_t *ref = smp_get_ref(map, 51);
+        cmc_assert_not_equals(ptr, NULL, ref);
+        *ref = 1;
+        cmc_assert_equals(size_t, 1, smp_get(map, 51));
+        cmc_assert_equals(ptr, NULL, smp_get_ref(map, 50));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, smp_flag(map));
+
+        smp_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_max() PFX##_min() PFX##_lower_bound(), {
+        struct sortedmap *map = smp_new(100, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        size_t key;
+        size_t value;
+
+        cmc_assert(!smp_max(map, &key, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, smp_flag(map));
+        cmc_assert(!smp_min(map, &key, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, smp_flag(map));
+        cmc_assert(!smp_lower_bound(map, 1, &key, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, smp_flag(map));
+
+        for (size_t i = 10; i <= 100; i += 10)
+            cmc_assert(smp_push(map, i, i * 2));
+
+        cmc_assert(smp_max(map, &key, &value));
+        cmc_assert_equals(size_t, 100, key);
+        cmc_assert_equals(size_t, 200, value);
+
+        cmc_assert(smp_min(map, &key, &value));
+        cmc_assert_equals(size_t, 10, key);
+        cmc_assert_equals(size_t, 20, value);
+
+        cmc_assert(smp_lower_bound(map, 0, &key, &value));
+        cmc_assert_equals(size_t, 10, key);
+        cmc_assert(smp_lower_bound(map, 30, &key, &value));
+        cmc_assert_equals(size_t, 30, key);
+        cmc_assert(smp_lower_bound(map, 31, &key, &value));
+        cmc_assert_equals(size_t, 40, key);
+        cmc_assert_equals(size_t, 80, value);
+        cmc_assert(!smp_lower_bound(map, 101, &key, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, smp_flag(map));
+
+        smp_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_resize(), {
+        struct sortedmap *map = smp_new(10, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(smp_push(map, i, i));
+
+        cmc_assert(smp_full(map));
+
+        cmc_assert(!smp_resize(map, 5));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, smp_flag(map));
+
+        cmc_assert(smp_resize(map, 100));
+        cmc_assert_equals(size_t, 100, smp_capacity(map));
+        cmc_assert_equals(size_t, 10, smp_count(map));
+
+        smp_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of() PFX##_equals(), {
+        struct sortedmap *map1 = smp_new(100, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map1);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(smp_push(map1, 99 - i, i));
+
+        struct sortedmap *map2 = smp_copy_of(map1);
+
+        cmc_assert_not_equals(ptr, NULL, map2);
+        cmc_assert(smp_equals(map1, map2));
+
+        cmc_assert(smp_update(map2, 7, 0, NULL));
+        cmc_assert(!smp_equals(map1, map2));
+
+        cmc_assert(smp_update(map2, 7, 92, NULL));
+        cmc_assert(smp_equals(map1, map2));
+
+        cmc_assert(smp_push(map2, 1000, 0));
+        cmc_assert(!smp_equals(map1, map2));
+
+        smp_free(map1);
+        smp_free(map2);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct sortedmap *map = smp_new_custom(1, smp_fkey, smp_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(smp_insert(map, 1, 1));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        cmc_assert(smp_push(map, 2, 2));
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        cmc_assert(smp_update(map, 1, 10, NULL));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert_equals(size_t, 10, smp_get(map, 1));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert(smp_contains(map, 2));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert(smp_max(map, NULL, NULL));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert(smp_remove(map, 1, NULL));
+        cmc_assert_equals(int32_t, 1, total_delete);
+
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 3, total_read);
+        cmc_assert_equals(int32_t, 1, total_update);
+        cmc_assert_equals(int32_t, 1, total_delete);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        smp_customize(map, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, map->callbacks);
+
+        smp_free(map);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+CMC_CREATE_UNIT(CMCSortedMapIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct sortedmap *map = smp_new(100, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        struct sortedmap_iter it = smp_iter_start(map);
+
+        cmc_assert_equals(ptr, map, it.target);
+        cmc_assert_equals(size_t, 0, it.cursor);
+        cmc_assert_equals(size_t, 0, it.count);
+        cmc_assert(smp_iter_at_start(&it));
+        cmc_assert(smp_iter_at_end(&it));
+        cmc_assert_equals(ptr, NULL, smp_iter_rvalue(&it));
+
+        smp_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct sortedmap *map = smp_new(100, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 1; i <= 1000; i++)
+            cmc_assert(smp_push(map, 1000 - i, i));
+
+        size_t index = 0;
+
+        struct sortedmap_iter it = smp_iter_start(map);
+
+        for (; !smp_iter_at_end(&it); smp_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, index, smp_iter_index(&it));
+            cmc_assert_equals(size_t, index, smp_iter_key(&it));
+            cmc_assert_equals(size_t, 1000 - index, smp_iter_value(&it));
+            cmc_assert_equals(size_t, 1000 - index, *smp_iter_rvalue(&it));
+
+            index++;
+        }
+
+        cmc_assert_equals(size_t, 1000, index);
+
+        smp_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        struct sortedmap *map = smp_new(100, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(smp_push(map, i, i));
+
+        size_t index = 100;
+
+        struct sortedmap_iter it = smp_iter_end(map);
+
+        for (; !smp_iter_at_start(&it); smp_iter_prev(&it))
+        {
+            index--;
+            cmc_assert_equals(size_t, index, smp_iter_key(&it));
+        }
+
+        cmc_assert_equals(size_t, 0, index);
+
+        smp_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_range(), {
+        struct sortedmap *map = smp_new(100, smp_fkey, smp_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(smp_push(map, i * 10, i));
+
+        struct sortedmap_iter it = smp_iter_range(map, 95, 200);
+
+        cmc_assert_equals(size_t, 10, it.first);
+        cmc_assert_equals(size_t, 10, it.count);
+
+        size_t index = 0;
+
+        for (; !smp_iter_at_end(&it); smp_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, index, smp_iter_index(&it));
+            cmc_assert_equals(size_t, 100 + index * 10, smp_iter_key(&it));
+
+            index++;
+        }
+
+        cmc_assert_equals(size_t, 10, index);
+
+        /* Backwards inside the range */
+        for (; !smp_iter_at_start(&it); smp_iter_prev(&it))
+            index--;
+
+        cmc_assert_equals(size_t, 0, index);
+        cmc_assert_equals(size_t, 100, smp_iter_key(&it));
+
+        cmc_assert(smp_iter_go_to(&it, 5));
+        cmc_assert_equals(size_t, 150, smp_iter_key(&it));
+        cmc_assert(!smp_iter_go_to(&it, 10));
+        cmc_assert(smp_iter_to_end(&it));
+        cmc_assert_equals(size_t, 190, smp_iter_key(&it));
+        cmc_assert(smp_iter_rewind(&it, 9));
+        cmc_assert_equals(size_t, 100, smp_iter_key(&it));
+
+        it = smp_iter_range(map, 991, 2000);
+        cmc_assert_equals(size_t, 0, it.count);
+        cmc_assert(smp_iter_at_start(&it));
+        cmc_assert(smp_iter_at_end(&it));
+
+        it = smp_iter_range(map, 50, 10);
+        cmc_assert_equals(size_t, 0, it.count);
+
+        smp_free(map);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_SORTEDMAP_H */
@@ -0,0 +1,484 @@
+#ifndef CMC_TESTS_UNT_CMC_SPARSESET_H
+#define CMC_TESTS_UNT_CMC_SPARSESET_H
+
+#include "utl.h"
+
+#include "tst_cmc_sparseset.h"
+
+struct sparseset_fval *ss_fval = &(struct sparseset_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct cmc_alloc_node *ss_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+/* Amount of reallocations that succeed before one fails */
+static size_t ss_realloc_left = 0;
+
+static void *ss_failing_realloc(void *ptr, size_t size)
+{
+    if (ss_realloc_left == 0)
+        return NULL;
+
+    ss_realloc_left--;
+
+    return realloc(ptr, size);
+}
+
+struct cmc_alloc_node *ss_alloc_node_failing =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = ss_failing_realloc, .free = free };
+
+CMC_CREATE_UNIT(CMCSparseSet, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct sparseset *set = ss_new(1000, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+        cmc_assert_not_equals(ptr, NULL, set->dense);
+        cmc_assert_not_equals(ptr, NULL, set->sparse);
+        cmc_assert_equals(size_t, 1000, ss_capacity(set));
+        cmc_assert_equals(size_t, 0, ss_count(set));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, set->flag);
+        cmc_assert_equals(ptr, ss_fval, set->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, set->alloc->malloc);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.calloc, set->alloc->calloc);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.realloc, set->alloc->realloc);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.free, set->alloc->free);
+        cmc_assert_equals(ptr, NULL, set->callbacks);
+
+        ss_free(set);
+
+        set = ss_new(0, ss_fval);
+        cmc_assert_equals(ptr, NULL, set);
+
+        set = ss_new(1000, NULL);
+        cmc_assert_equals(ptr, NULL, set);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct sparseset *set = ss_new_custom(1000, ss_fval, ss_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+        cmc_assert_equals(ptr, ss_alloc_node, set->alloc);
+        cmc_assert_equals(ptr, callbacks, set->callbacks);
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_clear(), {
+        struct sparseset *set = ss_new(100, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 100; i += 2)
+            cmc_assert(ss_insert(set, i));
+
+        cmc_assert_equals(size_t, 50, ss_count(set));
+
+        ss_clear(set);
+
+        cmc_assert_equals(size_t, 0, ss_count(set));
+        cmc_assert_equals(size_t, 100, ss_capacity(set));
+
+        /* Stale sparse slots must not be seen as values */
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(!ss_contains(set, i));
+
+        cmc_assert(ss_insert(set, 98));
+        cmc_assert(ss_contains(set, 98));
+        cmc_assert(!ss_contains(set, 0));
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_insert(), {
+        struct sparseset *set = ss_new(10, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        cmc_assert(ss_insert(set, 3));
+        cmc_assert(!ss_insert(set, 3));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, ss_flag(set));
+
+        /* Grows the universe */
+        cmc_assert(ss_insert(set, 1000));
+        cmc_assert_greater(size_t, 1000, ss_capacity(set));
+        cmc_assert(ss_contains(set, 3));
+        cmc_assert(ss_contains(set, 1000));
+        cmc_assert(!ss_contains(set, 999));
+        cmc_assert(!ss_contains(set, 1000000));
+        cmc_assert_equals(size_t, 2, ss_count(set));
+
+        cmc_assert(!ss_insert(set, SIZE_MAX));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, ss_flag(set));
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove(), {
+        struct sparseset *set = ss_new(1000, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        cmc_assert(!ss_remove(set, 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ss_flag(set));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(ss_insert(set, i));
+
+        cmc_assert(!ss_remove(set, 1000));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, ss_flag(set));
+
+        for (size_t i = 0; i < 1000; i += 3)
+            cmc_assert(ss_remove(set, i));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert_equals(bool, i % 3 != 0, ss_contains(set, i));
+
+        /* The dense array stays packed */
+        for (size_t i = 0; i < ss_count(set); i++)
+            cmc_assert_equals(size_t, i, set->sparse[set->dense[i]]);
+
+        cmc_assert(!ss_remove(set, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, ss_flag(set));
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_max() PFX##_min(), {
+        struct sparseset *set = ss_new(100, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        size_t max;
+        size_t min;
+
+        cmc_assert(!ss_max(set, &max));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ss_flag(set));
+        cmc_assert(!ss_min(set, &min));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ss_flag(set));
+
+        cmc_assert(ss_insert(set, 50));
+        cmc_assert(ss_insert(set, 7));
+        cmc_assert(ss_insert(set, 99));
+        cmc_assert(ss_insert(set, 23));
+
+        cmc_assert(ss_max(set, &max));
+        cmc_assert(ss_min(set, &min));
+        cmc_assert_equals(size_t, 99, max);
+        cmc_assert_equals(size_t, 7, min);
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_resize(), {
+        struct sparseset *set = ss_new(100, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        cmc_assert(ss_insert(set, 10));
+        cmc_assert(ss_insert(set, 60));
+
+        cmc_assert(ss_resize(set, 500));
+        cmc_assert_equals(size_t, 500, ss_capacity(set));
+        cmc_assert(ss_contains(set, 10));
+        cmc_assert(ss_contains(set, 60));
+
+        cmc_assert(!ss_resize(set, 50));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, ss_flag(set));
+        cmc_assert_equals(size_t, 500, ss_capacity(set));
+
+        cmc_assert(ss_resize(set, 61));
+        cmc_assert_equals(size_t, 61, ss_capacity(set));
+        cmc_assert(ss_contains(set, 60));
+        cmc_assert(ss_full(set) == false);
+
+        cmc_assert(!ss_resize(set, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, ss_flag(set));
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_resize[alloc], {
+        struct sparseset *set = ss_new_custom(100, ss_fval, ss_alloc_node_failing, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        cmc_assert(ss_insert(set, 10));
+        cmc_assert(ss_insert(set, 60));
+
+        ss_realloc_left = 1;
+
+        cmc_assert(!ss_resize(set, 500));
+        cmc_assert_equals(int32_t, CMC_FLAG_ALLOC, ss_flag(set));
+        cmc_assert_equals(size_t, 100, ss_capacity(set));
+        cmc_assert(ss_insert(set, 99));
+        cmc_assert(ss_contains(set, 60));
+        cmc_assert(ss_remove(set, 99));
+
+        ss_realloc_left = 0;
+
+        cmc_assert(!ss_resize(set, 61));
+        cmc_assert_equals(int32_t, CMC_FLAG_ALLOC, ss_flag(set));
+        cmc_assert_equals(size_t, 100, ss_capacity(set));
+        cmc_assert(ss_insert(set, 99));
+        cmc_assert(ss_remove(set, 99));
+
+        /* Only the dense array fails to shrink */
+        ss_realloc_left = 1;
+
+        cmc_assert(ss_resize(set, 61));
+        cmc_assert_equals(size_t, 61, ss_capacity(set));
+        cmc_assert(ss_contains(set, 10));
+        cmc_assert(ss_contains(set, 60));
+        cmc_assert(ss_insert(set, 0));
+        cmc_assert(!ss_insert(set, 61));
+
+        ss_realloc_left = SIZE_MAX;
+
+        cmc_assert(ss_resize(set, 1000));
+        cmc_assert(ss_insert(set, 999));
+        cmc_assert_equals(size_t, 4, ss_count(set));
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of() PFX##_equals(), {
+        struct sparseset *set1 = ss_new(100, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set1);
+
+        for (size_t i = 0; i < 100; i += 7)
+            cmc_assert(ss_insert(set1, i));
+
+        struct sparseset *set2 = ss_copy_of(set1);
+
+        cmc_assert_not_equals(ptr, NULL, set2);
+        cmc_assert_equals(size_t, ss_count(set1), ss_count(set2));
+        cmc_assert(ss_equals(set1, set2));
+
+        cmc_assert(ss_remove(set2, 14));
+        cmc_assert(!ss_equals(set1, set2));
+        cmc_assert(ss_insert(set2, 15));
+        cmc_assert(!ss_equals(set1, set2));
+
+        ss_free(set1);
+        ss_free(set2);
+    });
+
+    CMC_CREATE_TEST(set operations, {
+        struct sparseset *set1 = ss_new(100, ss_fval);
+        struct sparseset *set2 = ss_new(1000, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set1);
+        cmc_assert_not_equals(ptr, NULL, set2);
+
+        for (size_t i = 0; i < 60; i++)
+            cmc_assert(ss_insert(set1, i));
+
+        for (size_t i = 40; i < 800; i++)
+            cmc_assert(ss_insert(set2, i));
+
+        struct sparseset *r = ss_union(set1, set2);
+        cmc_assert_not_equals(ptr, NULL, r);
+        cmc_assert_equals(size_t, 800, ss_count(r));
+        ss_free(r);
+
+        r = ss_intersection(set1, set2);
+        cmc_assert_not_equals(ptr, NULL, r);
+        cmc_assert_equals(size_t, 20, ss_count(r));
+        ss_free(r);
+
+        r = ss_difference(set1, set2);
+        cmc_assert_not_equals(ptr, NULL, r);
+        cmc_assert_equals(size_t, 40, ss_count(r));
+        cmc_assert(ss_contains(r, 39));
+        cmc_assert(!ss_contains(r, 40));
+        ss_free(r);
+
+        r = ss_symmetric_difference(set1, set2);
+        cmc_assert_not_equals(ptr, NULL, r);
+        cmc_assert_equals(size_t, 780, ss_count(r));
+        ss_free(r);
+
+        cmc_assert(!ss_is_subset(set1, set2));
+        cmc_assert(!ss_is_disjointset(set1, set2));
+
+        ss_clear(set1);
+
+        for (size_t i = 40; i < 60; i++)
+            cmc_assert(ss_insert(set1, i));
+
+        cmc_assert(ss_is_subset(set1, set2));
+        cmc_assert(ss_is_proper_subset(set1, set2));
+        cmc_assert(ss_is_superset(set2, set1));
+        cmc_assert(ss_is_proper_superset(set2, set1));
+        cmc_assert(!ss_is_proper_subset(set1, set1));
+
+        ss_clear(set1);
+        cmc_assert(ss_insert(set1, 0));
+        cmc_assert(ss_insert(set1, 900));
+        cmc_assert(ss_is_disjointset(set1, set2));
+        cmc_assert(ss_insert(set1, 799));
+        cmc_assert(!ss_is_disjointset(set1, set2));
+
+        ss_free(set1);
+        ss_free(set2);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct sparseset *set = ss_new_custom(10, ss_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(ss_insert(set, 5));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        cmc_assert(ss_insert(set, 50));
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        cmc_assert(ss_contains(set, 5));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert(ss_max(set, NULL));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert(ss_min(set, NULL));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert(ss_remove(set, 5));
+        cmc_assert_equals(int32_t, 1, total_delete);
+
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 3, total_read);
+        cmc_assert_equals(int32_t, 0, total_update);
+        cmc_assert_equals(int32_t, 1, total_delete);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        ss_customize(set, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, set->callbacks);
+
+        ss_free(set);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+CMC_CREATE_UNIT(CMCSparseSetIter, true, {
+    CMC_CREATE_TEST(PFX##_iter_start(), {
+        struct sparseset *set = ss_new(100, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        struct sparseset_iter it = ss_iter_start(set);
+
+        cmc_assert_equals(ptr, set, it.target);
+        cmc_assert_equals(size_t, 0, it.cursor);
+        cmc_assert_equals(bool, true, it.start);
+        cmc_assert_equals(bool, true, it.end);
+
+        cmc_assert(ss_iter_at_start(&it));
+        cmc_assert(ss_iter_at_end(&it));
+
+        cmc_assert(ss_insert(set, 1));
+        cmc_assert(ss_insert(set, 2));
+
+        it = ss_iter_start(set);
+
+        cmc_assert_equals(size_t, 0, it.cursor);
+        cmc_assert_equals(bool, false, it.end);
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_next(), {
+        struct sparseset *set = ss_new(1000, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 1; i <= 1000; i++)
+            cmc_assert(ss_insert(set, 1000 - i));
+
+        size_t sum = 0;
+        size_t index = 0;
+
+        struct sparseset_iter it = ss_iter_start(set);
+
+        for (; !ss_iter_at_end(&it); ss_iter_next(&it))
+        {
+            cmc_assert_equals(size_t, index, ss_iter_index(&it));
+            cmc_assert_equals(size_t, 999 - index, ss_iter_value(&it));
+
+            sum += ss_iter_value(&it);
+            index++;
+        }
+
+        cmc_assert_equals(size_t, 1000, index);
+        cmc_assert_equals(size_t, 499500, sum);
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_prev(), {
+        struct sparseset *set = ss_new(1000, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(ss_insert(set, i));
+
+        size_t index = 1000;
+
+        struct sparseset_iter it = ss_iter_end(set);
+
+        for (; !ss_iter_at_start(&it); ss_iter_prev(&it))
+        {
+            index--;
+            cmc_assert_equals(size_t, index, ss_iter_value(&it));
+        }
+
+        cmc_assert_equals(size_t, 0, index);
+
+        ss_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_iter_go_to(), {
+        struct sparseset *set = ss_new(100, ss_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(ss_insert(set, i * 2));
+
+        struct sparseset_iter it = ss_iter_start(set);
+
+        cmc_assert(ss_iter_go_to(&it, 40));
+        cmc_assert_equals(size_t, 80, ss_iter_value(&it));
+
+        cmc_assert(ss_iter_go_to(&it, 10));
+        cmc_assert_equals(size_t, 20, ss_iter_value(&it));
+
+        cmc_assert(!ss_iter_go_to(&it, 100));
+
+        cmc_assert(ss_iter_advance(&it, 89));
+        cmc_assert_equals(size_t, 198, ss_iter_value(&it));
+
+        cmc_assert(ss_iter_rewind(&it, 99));
+        cmc_assert_equals(size_t, 0, ss_iter_value(&it));
+
+        ss_free(set);
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_SPARSESET_H */
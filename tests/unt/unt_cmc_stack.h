@@ -9,6 +9,48 @@ struct stack_fval *s_fval = &(struct stack_fval){
     .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
 };
 
+/* Same as s_fval but searches with cmc_size_find() */
+struct stack_fval *s_fval_find = &(struct stack_fval){ .cmp = cmc_size_cmp,
+                                                       .cpy = NULL,
+                                                       .str = cmc_size_str,
+                                                       .free = NULL,
+                                                       .hash = cmc_size_hash,
+                                                       .pri = cmc_size_cmp,
+                                                       .find = cmc_size_find };
+
+/* A Stack that keeps up to 4 elements inside its struct */
+C_MACRO_COLLECTIONS_ALL(CMC, STACK, (s4, stack4, 4, , size_t))
+
+struct stack4_fval *s4_fval = &(struct stack4_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+/* Amount of blocks currently allocated through s4_alloc_node */
+static size_t s4_blocks = 0;
+
+static void *s4_mem_malloc(size_t size)
+{
+    s4_blocks++;
+    return malloc(size);
+}
+
+static void *s4_mem_calloc(size_t count, size_t size)
+{
+    s4_blocks++;
+    return calloc(count, size);
+}
+
+static void s4_mem_free(void *ptr)
+{
+    if (ptr)
+        s4_blocks--;
+    free(ptr);
+}
+
+struct cmc_alloc_node *s4_alloc_node = &(struct cmc_alloc_node){
+    .malloc = s4_mem_malloc, .calloc = s4_mem_calloc, .realloc = realloc, .free = s4_mem_free
+};
+
 CMC_CREATE_UNIT(CMCStack, true, {
     CMC_CREATE_TEST(new, {
         struct stack *s = s_new(1000000, s_fval);
@@ -229,6 +271,24 @@ CMC_CREATE_UNIT(CMCStack, true, {
         s_free(s);
     });
 
+    CMC_CREATE_TEST(contains[find], {
+        struct stack *s = s_new(100, s_fval_find);
+
+        cmc_assert_not_equals(ptr, NULL, s);
+        cmc_assert(!s_contains(s, 0));
+
+        for (size_t i = 0; i < 150; i++)
+            cmc_assert(s_push(s, i * 2));
+
+        for (size_t i = 0; i < 150; i++)
+        {
+            cmc_assert(s_contains(s, i * 2));
+            cmc_assert(!s_contains(s, i * 2 + 1));
+        }
+
+        s_free(s);
+    });
+
     CMC_CREATE_TEST(empty, {
         struct stack *s = s_new(100, s_fval);
 
@@ -276,6 +336,61 @@ CMC_CREATE_UNIT(CMCStack, true, {
         s_free(s);
     });
 
+    CMC_CREATE_TEST(inline_buffer[SIZE = 4], {
+        struct stack4 *s = s4_new_custom(2, s4_fval, s4_alloc_node, NULL);
+
+        cmc_assert_not_equals(ptr, NULL, s);
+        cmc_assert_equals(size_t, 1, s4_blocks);
+        cmc_assert_equals(ptr, s->inline_buffer, s->buffer);
+        cmc_assert_equals(size_t, 4, s4_capacity(s));
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert(s4_push(s, i));
+
+        cmc_assert_equals(size_t, 1, s4_blocks);
+        cmc_assert_equals(ptr, s->inline_buffer, s->buffer);
+
+        /* Spill to the heap */
+        cmc_assert(s4_push(s, 4));
+
+        cmc_assert_equals(size_t, 2, s4_blocks);
+        cmc_assert_not_equals(ptr, s->inline_buffer, s->buffer);
+        cmc_assert_greater_equals(size_t, 5, s4_capacity(s));
+
+        for (size_t i = 0; i < 5; i++)
+            cmc_assert_equals(size_t, i, s->buffer[i]);
+
+        struct stack4 *copy = s4_copy_of(s);
+
+        cmc_assert_not_equals(ptr, NULL, copy);
+        cmc_assert(s4_equals(s, copy));
+        cmc_assert_equals(size_t, 4, s4_blocks);
+
+        s4_free(copy);
+
+        /* Shrinking back to SIZE moves the elements inside the struct */
+        cmc_assert(s4_pop(s));
+        cmc_assert(s4_resize(s, 4));
+
+        cmc_assert_equals(size_t, 1, s4_blocks);
+        cmc_assert_equals(ptr, s->inline_buffer, s->buffer);
+        cmc_assert_equals(size_t, 4, s4_capacity(s));
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert_equals(size_t, i, s->buffer[i]);
+
+        cmc_assert(s4_resize(s, 1000));
+        cmc_assert_equals(size_t, 2, s4_blocks);
+        cmc_assert_equals(size_t, 1000, s4_capacity(s));
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert_equals(size_t, i, s->buffer[i]);
+
+        s4_free(s);
+
+        cmc_assert_equals(size_t, 0, s4_blocks);
+    });
+
     CMC_CREATE_TEST(flags, {
         struct stack *s = s_new(100, s_fval);
 
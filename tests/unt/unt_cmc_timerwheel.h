@@ -0,0 +1,588 @@
+#ifndef CMC_TESTS_UNT_CMC_TIMERWHEEL_H
+#define CMC_TESTS_UNT_CMC_TIMERWHEEL_H
+
+#include "utl.h"
+
+#include "tst_cmc_timerwheel.h"
+
+struct timerwheel_fval *tmw_fval = &(struct timerwheel_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+struct timerwheel_fval *tmw_fval_counter = &(struct timerwheel_fval){
+    .cmp = v_c_cmp, .cpy = v_c_cpy, .str = v_c_str, .free = v_c_free, .hash = v_c_hash, .pri = v_c_pri
+};
+
+struct cmc_alloc_node *tmw_alloc_node =
+    &(struct cmc_alloc_node){ .malloc = malloc, .calloc = calloc, .realloc = realloc, .free = free };
+
+/* State shared with the expire functions */
+static struct timerwheel *tmw_wheel = NULL;
+static size_t tmw_expired = 0;
+static size_t tmw_last_value = 0;
+static uint64_t tmw_last_deadline = 0;
+static bool tmw_in_order = true;
+static bool tmw_on_time = true;
+
+static void tmw_expire(size_t value, uint64_t deadline)
+{
+    if (deadline < tmw_last_deadline)
+        tmw_in_order = false;
+
+    if (deadline > tmw_wheel->now)
+        tmw_on_time = false;
+
+    tmw_expired++;
+    tmw_last_value = value;
+    tmw_last_deadline = deadline;
+}
+
+/* Schedules the same timer again 10 ticks later */
+static void tmw_expire_periodic(size_t value, uint64_t deadline)
+{
+    tmw_expire(value, deadline);
+
+    tmw_schedule(tmw_wheel, deadline + 10, value, NULL);
+}
+
+/* Schedules a timer that is already due */
+static void tmw_expire_due(size_t value, uint64_t deadline)
+{
+    tmw_expire(value, deadline);
+
+    tmw_schedule(tmw_wheel, deadline, value + 1, NULL);
+}
+
+static void tmw_reset(struct timerwheel *wheel)
+{
+    tmw_wheel = wheel;
+    tmw_expired = 0;
+    tmw_last_value = 0;
+    tmw_last_deadline = 0;
+    tmw_in_order = true;
+    tmw_on_time = true;
+}
+
+static uint64_t tmw_random(uint64_t *state)
+{
+    *state = *state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+
+    return *state >> 33;
+}
+
+CMC_CREATE_UNIT(CMCTimerWheel, true, {
+    CMC_CREATE_TEST(PFX##_new(), {
+        struct timerwheel *wheel = tmw_new(1000, 500, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+        cmc_assert_not_equals(ptr, NULL, wheel->timers);
+        cmc_assert_equals(size_t, 1000, tmw_capacity(wheel));
+        cmc_assert_equals(size_t, 0, tmw_count(wheel));
+        cmc_assert_equals(uint64_t, 500, tmw_now(wheel));
+        cmc_assert(tmw_empty(wheel));
+        cmc_assert(!tmw_next_tick(wheel, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, tmw_flag(wheel));
+        cmc_assert_equals(ptr, tmw_fval, wheel->f_val);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.malloc, wheel->alloc->malloc);
+        cmc_assert_equals(ptr, cmc_alloc_node_default.free, wheel->alloc->free);
+        cmc_assert_equals(ptr, NULL, wheel->callbacks);
+
+        tmw_free(wheel);
+
+        wheel = tmw_new(0, 0, tmw_fval);
+        cmc_assert_equals(ptr, NULL, wheel);
+
+        wheel = tmw_new(1000, 0, NULL);
+        cmc_assert_equals(ptr, NULL, wheel);
+
+        wheel = tmw_new(UINT32_MAX, 0, tmw_fval);
+        cmc_assert_equals(ptr, NULL, wheel);
+    });
+
+    CMC_CREATE_TEST(PFX##_new_custom(), {
+        struct timerwheel *wheel = tmw_new_custom(1000, 0, tmw_fval, tmw_alloc_node, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+        cmc_assert_equals(ptr, tmw_alloc_node, wheel->alloc);
+        cmc_assert_equals(ptr, callbacks, wheel->callbacks);
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(PFX##_clear(), {
+        struct timerwheel *wheel = tmw_new(100, 0, tmw_fval_counter);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        uint64_t handle;
+
+        v_total_free = 0;
+
+        for (size_t i = 1; i <= 100; i++)
+            cmc_assert(tmw_schedule(wheel, i * 1000, i, &handle));
+
+        tmw_clear(wheel);
+
+        cmc_assert_equals(int32_t, 100, v_total_free);
+        cmc_assert_equals(size_t, 0, tmw_count(wheel));
+        cmc_assert(!tmw_contains(wheel, handle));
+        cmc_assert(!tmw_next_tick(wheel, NULL));
+        cmc_assert_equals(size_t, 0, tmw_advance(wheel, 1000000, NULL));
+
+        cmc_assert(tmw_schedule(wheel, 1000001, 1, NULL));
+        cmc_assert_equals(size_t, 1, tmw_advance(wheel, 1000001, NULL));
+
+        tmw_free(wheel);
+
+        cmc_assert_equals(int32_t, 101, v_total_free);
+
+        v_total_free = 0;
+    });
+
+    CMC_CREATE_TEST(PFX##_schedule() PFX##_advance(), {
+        struct timerwheel *wheel = tmw_new(1, 0, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        tmw_reset(wheel);
+
+        for (size_t i = 1000; i >= 1; i--)
+            cmc_assert(tmw_schedule(wheel, i, i, NULL));
+
+        cmc_assert_equals(size_t, 1000, tmw_count(wheel));
+
+        cmc_assert_equals(size_t, 0, tmw_advance(wheel, 0, tmw_expire));
+        cmc_assert_equals(size_t, 1, tmw_advance(wheel, 1, tmw_expire));
+        cmc_assert_equals(size_t, 1, tmw_last_value);
+        cmc_assert_equals(size_t, 499, tmw_advance(wheel, 500, tmw_expire));
+        cmc_assert_equals(size_t, 500, tmw_last_value);
+        cmc_assert_equals(uint64_t, 500, tmw_now(wheel));
+        cmc_assert_equals(size_t, 500, tmw_count(wheel));
+        cmc_assert_equals(size_t, 500, tmw_advance(wheel, 5000, tmw_expire));
+        cmc_assert_equals(size_t, 1000, tmw_last_value);
+        cmc_assert_equals(size_t, 1000, tmw_expired);
+        cmc_assert(tmw_in_order);
+        cmc_assert(tmw_on_time);
+        cmc_assert(tmw_empty(wheel));
+
+        cmc_assert_equals(size_t, 0, tmw_advance(wheel, 4999, tmw_expire));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, tmw_flag(wheel));
+        cmc_assert_equals(uint64_t, 5000, tmw_now(wheel));
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(advance[far deadlines], {
+        struct timerwheel *wheel = tmw_new(100, 12345, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        /* Deadlines spread over the levels of the wheel */
+        for (size_t level = 0; level < CMC_TIMERWHEEL_LEVELS; level++)
+        {
+            uint64_t deadline = UINT64_MAX >> (60 - level * CMC_TIMERWHEEL_BITS);
+
+            if (deadline > 12345)
+                cmc_assert(tmw_schedule(wheel, deadline, level, NULL));
+        }
+
+        tmw_reset(wheel);
+
+        size_t total = tmw_count(wheel);
+
+        for (size_t i = 0; i < total; i++)
+        {
+            uint64_t tick;
+
+            cmc_assert(tmw_next_tick(wheel, &tick));
+            cmc_assert_greater(uint64_t, tmw_now(wheel), tick);
+
+            /* Not a single tick early */
+            while (tmw_expired == i)
+            {
+                cmc_assert(tmw_next_tick(wheel, &tick));
+                cmc_assert_equals(size_t, 0, tmw_advance(wheel, tick - 1, tmw_expire));
+                tmw_advance(wheel, tick, tmw_expire);
+            }
+
+            cmc_assert_equals(size_t, i + 1, tmw_expired);
+            cmc_assert_equals(uint64_t, tmw_last_deadline, tmw_now(wheel));
+        }
+
+        cmc_assert(tmw_in_order);
+        cmc_assert(tmw_on_time);
+        cmc_assert_equals(uint64_t, UINT64_MAX, tmw_last_deadline);
+        cmc_assert(!tmw_next_tick(wheel, NULL));
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(advance[random deadlines], {
+        struct timerwheel *wheel = tmw_new(100, 0, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        uint64_t state = 42;
+        uint64_t deadlines[1000];
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            deadlines[i] = tmw_random(&state) % 100000;
+            cmc_assert(tmw_schedule(wheel, deadlines[i], i, NULL));
+        }
+
+        tmw_reset(wheel);
+
+        uint64_t now = 0;
+
+        while (!tmw_empty(wheel))
+        {
+            now += tmw_random(&state) % 3000;
+
+            size_t due = 0;
+
+            for (size_t i = 0; i < 1000; i++)
+            {
+                if (deadlines[i] <= now)
+                    due++;
+            }
+
+            tmw_advance(wheel, now, tmw_expire);
+
+            cmc_assert_equals(size_t, due, tmw_expired);
+            cmc_assert_equals(size_t, 1000 - due, tmw_count(wheel));
+        }
+
+        cmc_assert(tmw_in_order);
+        cmc_assert(tmw_on_time);
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(advance[due timers], {
+        struct timerwheel *wheel = tmw_new(100, 1000, tmw_fval_counter);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        v_total_free = 0;
+
+        /* Deadlines that are not after the current time are due */
+        cmc_assert(tmw_schedule(wheel, 0, 1, NULL));
+        cmc_assert(tmw_schedule(wheel, 1000, 2, NULL));
+        cmc_assert(tmw_schedule(wheel, 1001, 3, NULL));
+
+        cmc_assert_equals(size_t, 2, tmw_advance(wheel, 1000, NULL));
+        cmc_assert_equals(int32_t, 2, v_total_free);
+        cmc_assert_equals(size_t, 1, tmw_count(wheel));
+
+        tmw_reset(wheel);
+
+        /* Due timers scheduled from expire wait for the next batch */
+        cmc_assert_equals(size_t, 1, tmw_advance(wheel, 1001, tmw_expire_due));
+        cmc_assert_equals(size_t, 3, tmw_last_value);
+        cmc_assert_equals(size_t, 1, tmw_count(wheel));
+        cmc_assert_equals(size_t, 1, tmw_advance(wheel, 1001, tmw_expire_due));
+        cmc_assert_equals(size_t, 4, tmw_last_value);
+        cmc_assert_equals(size_t, 1, tmw_count(wheel));
+
+        tmw_free(wheel);
+
+        cmc_assert_equals(int32_t, 3, v_total_free);
+
+        v_total_free = 0;
+
+        wheel = tmw_new(100, 1000, tmw_fval_counter);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        /* Timers that are already due still expire in order of deadline */
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(tmw_schedule(wheel, (i * 37) % 50 * 20, i, NULL));
+
+        cmc_assert(tmw_schedule(wheel, 1001, 50, NULL));
+
+        tmw_reset(wheel);
+
+        cmc_assert_equals(size_t, 51, tmw_advance(wheel, 1001, tmw_expire));
+        cmc_assert(tmw_in_order);
+        cmc_assert_equals(size_t, 50, tmw_last_value);
+
+        tmw_free(wheel);
+
+        v_total_free = 0;
+    });
+
+    CMC_CREATE_TEST(advance[periodic timer], {
+        struct timerwheel *wheel = tmw_new(1, 0, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        tmw_reset(wheel);
+
+        cmc_assert(tmw_schedule(wheel, 10, 7, NULL));
+
+        cmc_assert_equals(size_t, 10, tmw_advance(wheel, 100, tmw_expire_periodic));
+        cmc_assert_equals(uint64_t, 100, tmw_last_deadline);
+        cmc_assert_equals(size_t, 1, tmw_count(wheel));
+        cmc_assert_equals(size_t, 90, tmw_advance(wheel, 1000, tmw_expire_periodic));
+        cmc_assert_equals(size_t, 100, tmw_expired);
+        cmc_assert(tmw_in_order);
+        cmc_assert(tmw_on_time);
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(PFX##_cancel(), {
+        struct timerwheel *wheel = tmw_new(100, 0, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        uint64_t handles[1000];
+        size_t value;
+
+        cmc_assert(!tmw_cancel(wheel, CMC_TIMERWHEEL_NULL, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tmw_flag(wheel));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(tmw_schedule(wheel, (i % 100) * 100, i, &(handles[i])));
+
+        for (size_t i = 0; i < 1000; i += 2)
+        {
+            cmc_assert(tmw_cancel(wheel, handles[i], &value));
+            cmc_assert_equals(size_t, i, value);
+        }
+
+        cmc_assert_equals(size_t, 500, tmw_count(wheel));
+
+        cmc_assert(!tmw_cancel(wheel, handles[0], NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, tmw_flag(wheel));
+        cmc_assert(!tmw_cancel(wheel, CMC_TIMERWHEEL_NULL, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, tmw_flag(wheel));
+
+        tmw_reset(wheel);
+
+        cmc_assert_equals(size_t, 500, tmw_advance(wheel, 10000, tmw_expire));
+        cmc_assert_equals(size_t, 1, tmw_last_value % 2);
+        cmc_assert(tmw_in_order);
+
+        /* Freed timers are reused but old handles stay stale */
+        cmc_assert(tmw_schedule(wheel, 20000, 1, &(handles[0])));
+        cmc_assert(!tmw_contains(wheel, handles[1]));
+        cmc_assert(tmw_contains(wheel, handles[0]));
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(PFX##_reschedule(), {
+        struct timerwheel *wheel = tmw_new(100, 0, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        uint64_t handle1;
+        uint64_t handle2;
+
+        cmc_assert(!tmw_reschedule(wheel, CMC_TIMERWHEEL_NULL, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tmw_flag(wheel));
+
+        cmc_assert(tmw_schedule(wheel, 100000, 1, &handle1));
+        cmc_assert(tmw_schedule(wheel, 50, 2, &handle2));
+
+        cmc_assert(tmw_reschedule(wheel, handle1, 10));
+        cmc_assert(tmw_reschedule(wheel, handle2, 1000000));
+        cmc_assert_equals(uint64_t, 10, tmw_deadline(wheel, handle1));
+        cmc_assert_equals(uint64_t, 1000000, tmw_deadline(wheel, handle2));
+
+        tmw_reset(wheel);
+
+        cmc_assert_equals(size_t, 1, tmw_advance(wheel, 100000, tmw_expire));
+        cmc_assert_equals(size_t, 1, tmw_last_value);
+        cmc_assert(!tmw_contains(wheel, handle1));
+
+        /* Keeps pushing the deadline forward, like a connection timeout */
+        for (uint64_t now = 100000; now < 999990; now += 10)
+        {
+            cmc_assert(tmw_reschedule(wheel, handle2, now + 20));
+            cmc_assert_equals(size_t, 0, tmw_advance(wheel, now + 10, tmw_expire));
+        }
+
+        cmc_assert(!tmw_reschedule(wheel, handle1, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, tmw_flag(wheel));
+
+        cmc_assert_equals(size_t, 1, tmw_advance(wheel, 1000000, tmw_expire));
+        cmc_assert_equals(size_t, 2, tmw_last_value);
+        cmc_assert_equals(uint64_t, 1000000, tmw_last_deadline);
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(PFX##_get() PFX##_deadline(), {
+        struct timerwheel *wheel = tmw_new(100, 0, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        uint64_t handle;
+
+        cmc_assert_equals(size_t, 0, tmw_get(wheel, CMC_TIMERWHEEL_NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tmw_flag(wheel));
+        cmc_assert_equals(uint64_t, 0, tmw_deadline(wheel, CMC_TIMERWHEEL_NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tmw_flag(wheel));
+
+        cmc_assert(tmw_schedule(wheel, 777, 10, &handle));
+        cmc_assert_equals(size_t, 10, tmw_get(wheel, handle));
+        cmc_assert_equals(uint64_t, 777, tmw_deadline(wheel, handle));
+
+        cmc_assert_equals(size_t, 0, tmw_get(wheel, handle + 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, tmw_flag(wheel));
+        cmc_assert_equals(uint64_t, 0, tmw_deadline(wheel, handle + 1));
+        cmc_assert_equals(int32_t, CMC_FLAG_NOT_FOUND, tmw_flag(wheel));
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(PFX##_next_tick(), {
+        struct timerwheel *wheel = tmw_new(100, 0, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        uint64_t tick;
+
+        cmc_assert(!tmw_next_tick(wheel, &tick));
+
+        cmc_assert(tmw_schedule(wheel, 50, 1, NULL));
+        cmc_assert(tmw_schedule(wheel, 3000, 2, NULL));
+        cmc_assert(tmw_next_tick(wheel, &tick));
+        cmc_assert_equals(uint64_t, 50, tick);
+
+        cmc_assert_equals(size_t, 1, tmw_advance(wheel, 50, NULL));
+
+        /* Never later than the earliest deadline */
+        while (tmw_next_tick(wheel, &tick))
+        {
+            cmc_assert_lesser_equals(uint64_t, 3000, tick);
+            tmw_advance(wheel, tick, NULL);
+        }
+
+        cmc_assert_equals(uint64_t, 3000, tmw_now(wheel));
+        cmc_assert(tmw_empty(wheel));
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(PFX##_resize(), {
+        struct timerwheel *wheel = tmw_new(10, 0, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        uint64_t handle;
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(tmw_schedule(wheel, i + 1, i, &handle));
+
+        cmc_assert(tmw_resize(wheel, 100));
+        cmc_assert_equals(size_t, 100, tmw_capacity(wheel));
+        cmc_assert_equals(size_t, 9, tmw_get(wheel, handle));
+
+        cmc_assert(!tmw_resize(wheel, 5));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, tmw_flag(wheel));
+
+        cmc_assert(tmw_resize(wheel, 10));
+        cmc_assert_equals(size_t, 10, tmw_capacity(wheel));
+        cmc_assert_equals(size_t, 10, tmw_advance(wheel, 10, NULL));
+
+        tmw_free(wheel);
+    });
+
+    CMC_CREATE_TEST(PFX##_copy_of() PFX##_equals(), {
+        struct timerwheel *wheel1 = tmw_new(100, 0, tmw_fval);
+
+        cmc_assert_not_equals(ptr, NULL, wheel1);
+
+        uint64_t handle;
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(tmw_schedule(wheel1, i * 97, i, &handle));
+
+        cmc_assert_equals(size_t, 11, tmw_advance(wheel1, 1000, NULL));
+
+        struct timerwheel *wheel2 = tmw_copy_of(wheel1);
+
+        cmc_assert_not_equals(ptr, NULL, wheel2);
+        cmc_assert(tmw_equals(wheel1, wheel2));
+        cmc_assert(tmw_equals(wheel2, wheel1));
+        cmc_assert_equals(size_t, 99, tmw_get(wheel2, handle));
+
+        /* Both wheels keep working on their own */
+        cmc_assert_equals(size_t, 89, tmw_advance(wheel2, 100000, NULL));
+        cmc_assert(!tmw_equals(wheel1, wheel2));
+        cmc_assert_equals(size_t, 89, tmw_count(wheel1));
+
+        cmc_assert_equals(size_t, 89, tmw_advance(wheel1, 100000, NULL));
+        cmc_assert(tmw_equals(wheel1, wheel2));
+
+        cmc_assert(tmw_schedule(wheel1, 100001, 1, NULL));
+        cmc_assert(tmw_schedule(wheel2, 100002, 1, NULL));
+        cmc_assert(!tmw_equals(wheel1, wheel2));
+
+        tmw_free(wheel1);
+        tmw_free(wheel2);
+    });
+
+    CMC_CREATE_TEST(callbacks, {
+        struct timerwheel *wheel = tmw_new_custom(1, 0, tmw_fval, NULL, callbacks);
+
+        cmc_assert_not_equals(ptr, NULL, wheel);
+
+        uint64_t handle;
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+
+        cmc_assert(tmw_schedule(wheel, 10, 1, NULL));
+        cmc_assert_equals(int32_t, 1, total_create);
+
+        cmc_assert(tmw_schedule(wheel, 20, 2, &handle));
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        cmc_assert(tmw_reschedule(wheel, handle, 30));
+        cmc_assert_equals(int32_t, 1, total_update);
+
+        cmc_assert_equals(size_t, 2, tmw_get(wheel, handle));
+        cmc_assert_equals(int32_t, 1, total_read);
+
+        cmc_assert_equals(uint64_t, 30, tmw_deadline(wheel, handle));
+        cmc_assert_equals(int32_t, 2, total_read);
+
+        cmc_assert(tmw_contains(wheel, handle));
+        cmc_assert_equals(int32_t, 3, total_read);
+
+        cmc_assert(tmw_cancel(wheel, handle, NULL));
+        cmc_assert_equals(int32_t, 1, total_delete);
+
+        cmc_assert_equals(size_t, 1, tmw_advance(wheel, 100, NULL));
+        cmc_assert_equals(int32_t, 2, total_update);
+
+        cmc_assert_equals(int32_t, 2, total_create);
+        cmc_assert_equals(int32_t, 3, total_read);
+        cmc_assert_equals(int32_t, 2, total_update);
+        cmc_assert_equals(int32_t, 1, total_delete);
+        cmc_assert_equals(int32_t, 1, total_resize);
+
+        tmw_customize(wheel, NULL, NULL);
+
+        cmc_assert_equals(ptr, NULL, wheel->callbacks);
+
+        tmw_free(wheel);
+
+        total_create = 0;
+        total_read = 0;
+        total_update = 0;
+        total_delete = 0;
+        total_resize = 0;
+    });
+});
+
+#endif /* CMC_TESTS_UNT_CMC_TIMERWHEEL_H */
@@ -13,6 +13,28 @@ struct treemap_fval *tm_fval = &(struct treemap_fval){
     .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
 };
 
+/* Height of the subtree at node if it is a valid AVL Tree with the right */
+/* parent pointers, or -1 otherwise */
+int tm_check(struct treemap_node *node, struct treemap_node *parent)
+{
+    if (!node)
+        return 0;
+
+    if (node->parent != parent || (node->left && node->left->key >= node->key) ||
+        (node->right && node->right->key <= node->key))
+        return -1;
+
+    int h_l = tm_check(node->left, node);
+    int h_r = tm_check(node->right, node);
+
+    if (h_l < 0 || h_r < 0 || h_l - h_r > 1 || h_r - h_l > 1)
+        return -1;
+
+    int height = 1 + (h_l > h_r ? h_l : h_r);
+
+    return height == node->height ? height : -1;
+}
+
 CMC_CREATE_UNIT(CMCTreeMap, true, {
     CMC_CREATE_TEST(new, {
         struct treemap *map = tm_new(tm_fkey, tm_fval);
@@ -136,6 +158,109 @@ CMC_CREATE_UNIT(CMCTreeMap, true, {
         tm_free(map2);
     });
 
+    CMC_CREATE_TEST(PFX##_remove_range(), {
+        struct treemap *map = tm_new(tm_fkey, tm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert_equals(size_t, 0, tm_remove_range(map, 0, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tm_flag(map));
+
+        for (size_t i = 0; i < 2000; i++)
+            cmc_assert(tm_insert(map, (i * 7919) % 2000, i));
+
+        cmc_assert_equals(size_t, 0, tm_remove_range(map, 10, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, tm_flag(map));
+
+        cmc_assert_equals(size_t, 1000, tm_remove_range(map, 500, 1499));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, tm_flag(map));
+        cmc_assert_equals(size_t, 1000, tm_count(map));
+        cmc_assert_greater(int32_t, 0, tm_check(map->root, NULL));
+
+        for (size_t i = 0; i < 2000; i++)
+            cmc_assert(tm_contains(map, i) == (i < 500 || i >= 1500));
+
+        cmc_assert_equals(size_t, 0, tm_remove_range(map, 500, 1499));
+        cmc_assert_equals(size_t, 1, tm_remove_range(map, 1500, 1500));
+        cmc_assert_equals(size_t, 499, tm_remove_range(map, 1501, 5000));
+        cmc_assert_greater(int32_t, 0, tm_check(map->root, NULL));
+
+        cmc_assert_equals(size_t, 500, tm_remove_range(map, 0, 5000));
+        cmc_assert(tm_empty(map));
+        cmc_assert_equals(ptr, NULL, map->root);
+
+        tm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove_range[random], {
+        struct treemap *map = tm_new(tm_fkey, tm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        size_t seed = 5;
+
+        for (size_t round = 0; round < 20; round++)
+        {
+            for (size_t i = 0; i < 1000; i++)
+            {
+                seed = seed * 6364136223846793005u + 1442695040888963407u;
+                tm_insert(map, (seed >> 33) % 3000, i);
+            }
+
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+            size_t low = (seed >> 33) % 3000;
+            size_t high = low + (seed >> 45) % 1000;
+            size_t expected = 0;
+
+            for (size_t k = low; k <= high; k++)
+                expected += tm_contains(map, k) ? 1 : 0;
+
+            size_t count = tm_count(map);
+
+            cmc_assert_equals(size_t, expected, tm_remove_range(map, low, high));
+            cmc_assert_equals(size_t, count - expected, tm_count(map));
+            cmc_assert_greater_equals(int32_t, 0, tm_check(map->root, NULL));
+
+            for (size_t k = low; k <= high; k++)
+                cmc_assert(!tm_contains(map, k));
+        }
+
+        tm_free(map);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove_below(), {
+        struct treemap *map = tm_new(tm_fkey, tm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        cmc_assert_equals(size_t, 0, tm_remove_below(map, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tm_flag(map));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(tm_insert(map, i, i));
+
+        cmc_assert_equals(size_t, 0, tm_remove_below(map, 0));
+        cmc_assert_equals(size_t, 250, tm_remove_below(map, 250));
+        cmc_assert_equals(size_t, 750, tm_count(map));
+        cmc_assert_greater(int32_t, 0, tm_check(map->root, NULL));
+
+        size_t key = 0;
+
+        cmc_assert(tm_min(map, &key, NULL));
+        cmc_assert_equals(size_t, 250, key);
+
+        cmc_assert_equals(size_t, 749, tm_remove_below(map, 999));
+        cmc_assert_equals(size_t, 1, tm_count(map));
+        cmc_assert(tm_contains(map, 999));
+        cmc_assert_greater(int32_t, 0, tm_check(map->root, NULL));
+
+        cmc_assert_equals(size_t, 1, tm_remove_below(map, 5000));
+        cmc_assert(tm_empty(map));
+
+        tm_free(map);
+    });
+
     CMC_CREATE_TEST(callbacks, {
         struct treemap *map = tm_new_custom(tm_fkey, tm_fval, NULL, callbacks);
 
@@ -650,6 +775,87 @@ CMC_CREATE_UNIT(CMCTreeMapIter, true, {
 
         tm_free(map);
     });
+
+    CMC_CREATE_TEST(PFX##_insert_hint(), {
+        struct treemap *map = tm_new(tm_fkey, tm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        struct treemap_iter it = tm_iter_end(map);
+
+        /* Ascending keys are appended after the iterator */
+        for (size_t i = 0; i < 1000; i++)
+        {
+            cmc_assert(tm_insert_hint(map, &it, i * 4, i));
+            cmc_assert_equals(size_t, i * 4, tm_iter_key(&it));
+            cmc_assert_equals(size_t, i, tm_iter_index(&it));
+        }
+
+        cmc_assert_equals(size_t, 1000, tm_count(map));
+        cmc_assert_lesser_equals(uint8_t, 14, map->root->height);
+
+        cmc_assert(!tm_insert_hint(map, &it, 400, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, tm_flag(map));
+
+        /* Right after and right before the cursor */
+        cmc_assert(tm_iter_go_to(&it, 500));
+        cmc_assert(tm_insert_hint(map, &it, 2002, 1));
+        cmc_assert_equals(size_t, 2002, tm_iter_key(&it));
+        cmc_assert_equals(size_t, 501, tm_iter_index(&it));
+        cmc_assert(tm_insert_hint(map, &it, 2001, 2));
+        cmc_assert_equals(size_t, 2001, tm_iter_key(&it));
+        cmc_assert_equals(size_t, 501, tm_iter_index(&it));
+
+        /* After the last key from anywhere in the map */
+        cmc_assert(tm_iter_to_start(&it));
+
+        for (size_t i = 0; i < 3; i++)
+            cmc_assert(tm_insert_hint(map, &it, 4001 + i, 0));
+
+        cmc_assert_equals(size_t, 1004, tm_iter_index(&it));
+        cmc_assert(!tm_iter_next(&it));
+
+        /* Far from the cursor it falls back to _insert and stays in place */
+        cmc_assert(tm_iter_go_to(&it, 300));
+
+        size_t key = tm_iter_key(&it);
+
+        cmc_assert(tm_insert_hint(map, &it, 9, 0));
+        cmc_assert(tm_insert_hint(map, &it, 3001, 0));
+        cmc_assert_equals(size_t, key, tm_iter_key(&it));
+        cmc_assert_equals(size_t, 301, tm_iter_index(&it));
+
+        cmc_assert_equals(size_t, 1007, tm_count(map));
+
+        size_t index = 0;
+        size_t prev = 0;
+
+        for (it = tm_iter_start(map); !tm_iter_at_end(&it); tm_iter_next(&it))
+        {
+            cmc_assert(index == 0 || prev < tm_iter_key(&it));
+            cmc_assert(tm_contains(map, tm_iter_key(&it)));
+            prev = tm_iter_key(&it);
+            index++;
+        }
+
+        cmc_assert_equals(size_t, 1007, index);
+
+        tm_free(map);
+
+        map = tm_new(tm_fkey, tm_fval);
+
+        cmc_assert_not_equals(ptr, NULL, map);
+
+        it = tm_iter_start(map);
+
+        cmc_assert(tm_insert_hint(map, &it, 5, 5));
+        cmc_assert_equals(size_t, 5, tm_iter_key(&it));
+        cmc_assert(tm_insert_hint(map, &it, 4, 4));
+        cmc_assert_equals(size_t, 0, tm_iter_index(&it));
+        cmc_assert_equals(size_t, 2, tm_count(map));
+
+        tm_free(map);
+    });
 });
 
 #ifdef CMC_TEST_MAIN
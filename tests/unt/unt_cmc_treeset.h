@@ -9,6 +9,28 @@ struct treeset_fval *ts_fval = &(struct treeset_fval){
     .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
 };
 
+/* Height of the subtree at node if it is a valid AVL Tree with the right */
+/* parent pointers, or -1 otherwise */
+int ts_check(struct treeset_node *node, struct treeset_node *parent)
+{
+    if (!node)
+        return 0;
+
+    if (node->parent != parent || (node->left && node->left->value >= node->value) ||
+        (node->right && node->right->value <= node->value))
+        return -1;
+
+    int h_l = ts_check(node->left, node);
+    int h_r = ts_check(node->right, node);
+
+    if (h_l < 0 || h_r < 0 || h_l - h_r > 1 || h_r - h_l > 1)
+        return -1;
+
+    int height = 1 + (h_l > h_r ? h_l : h_r);
+
+    return height == node->height ? height : -1;
+}
+
 CMC_CREATE_UNIT(CMCTreeSet, true, {
     CMC_CREATE_TEST(new, {
         struct treeset *set = ts_new(ts_fval);
@@ -100,6 +122,109 @@ CMC_CREATE_UNIT(CMCTreeSet, true, {
         ts_free(set2);
     });
 
+    CMC_CREATE_TEST(PFX##_remove_range(), {
+        struct treeset *set = ts_new(ts_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        cmc_assert_equals(size_t, 0, ts_remove_range(set, 0, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ts_flag(set));
+
+        for (size_t i = 0; i < 2000; i++)
+            cmc_assert(ts_insert(set, (i * 7919) % 2000));
+
+        cmc_assert_equals(size_t, 0, ts_remove_range(set, 10, 0));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, ts_flag(set));
+
+        cmc_assert_equals(size_t, 1000, ts_remove_range(set, 500, 1499));
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, ts_flag(set));
+        cmc_assert_equals(size_t, 1000, ts_count(set));
+        cmc_assert_greater(int32_t, 0, ts_check(set->root, NULL));
+
+        for (size_t i = 0; i < 2000; i++)
+            cmc_assert(ts_contains(set, i) == (i < 500 || i >= 1500));
+
+        cmc_assert_equals(size_t, 0, ts_remove_range(set, 500, 1499));
+        cmc_assert_equals(size_t, 1, ts_remove_range(set, 1500, 1500));
+        cmc_assert_equals(size_t, 499, ts_remove_range(set, 1501, 5000));
+        cmc_assert_greater(int32_t, 0, ts_check(set->root, NULL));
+
+        cmc_assert_equals(size_t, 500, ts_remove_range(set, 0, 5000));
+        cmc_assert(ts_empty(set));
+        cmc_assert_equals(ptr, NULL, set->root);
+
+        ts_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove_range[random], {
+        struct treeset *set = ts_new(ts_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        size_t seed = 5;
+
+        for (size_t round = 0; round < 20; round++)
+        {
+            for (size_t i = 0; i < 1000; i++)
+            {
+                seed = seed * 6364136223846793005u + 1442695040888963407u;
+                ts_insert(set, (seed >> 33) % 3000);
+            }
+
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+            size_t low = (seed >> 33) % 3000;
+            size_t high = low + (seed >> 45) % 1000;
+            size_t expected = 0;
+
+            for (size_t k = low; k <= high; k++)
+                expected += ts_contains(set, k) ? 1 : 0;
+
+            size_t count = ts_count(set);
+
+            cmc_assert_equals(size_t, expected, ts_remove_range(set, low, high));
+            cmc_assert_equals(size_t, count - expected, ts_count(set));
+            cmc_assert_greater_equals(int32_t, 0, ts_check(set->root, NULL));
+
+            for (size_t k = low; k <= high; k++)
+                cmc_assert(!ts_contains(set, k));
+        }
+
+        ts_free(set);
+    });
+
+    CMC_CREATE_TEST(PFX##_remove_below(), {
+        struct treeset *set = ts_new(ts_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        cmc_assert_equals(size_t, 0, ts_remove_below(set, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, ts_flag(set));
+
+        for (size_t i = 0; i < 1000; i++)
+            cmc_assert(ts_insert(set, i));
+
+        cmc_assert_equals(size_t, 0, ts_remove_below(set, 0));
+        cmc_assert_equals(size_t, 250, ts_remove_below(set, 250));
+        cmc_assert_equals(size_t, 750, ts_count(set));
+        cmc_assert_greater(int32_t, 0, ts_check(set->root, NULL));
+
+        size_t key = 0;
+
+        cmc_assert(ts_min(set, &key));
+        cmc_assert_equals(size_t, 250, key);
+
+        cmc_assert_equals(size_t, 749, ts_remove_below(set, 999));
+        cmc_assert_equals(size_t, 1, ts_count(set));
+        cmc_assert(ts_contains(set, 999));
+        cmc_assert_greater(int32_t, 0, ts_check(set->root, NULL));
+
+        cmc_assert_equals(size_t, 1, ts_remove_below(set, 5000));
+        cmc_assert(ts_empty(set));
+
+        ts_free(set);
+    });
+
     CMC_CREATE_TEST(callbacks, {
         struct treeset *set = ts_new_custom(ts_fval, NULL, callbacks);
 
@@ -565,6 +690,87 @@ CMC_CREATE_UNIT(CMCTreeSetIter, true, {
 
         ts_free(set);
     });
+
+    CMC_CREATE_TEST(PFX##_insert_hint(), {
+        struct treeset *set = ts_new(ts_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        struct treeset_iter it = ts_iter_end(set);
+
+        /* Ascending keys are appended after the iterator */
+        for (size_t i = 0; i < 1000; i++)
+        {
+            cmc_assert(ts_insert_hint(set, &it, i * 4));
+            cmc_assert_equals(size_t, i * 4, ts_iter_value(&it));
+            cmc_assert_equals(size_t, i, ts_iter_index(&it));
+        }
+
+        cmc_assert_equals(size_t, 1000, ts_count(set));
+        cmc_assert_lesser_equals(uint8_t, 14, set->root->height);
+
+        cmc_assert(!ts_insert_hint(set, &it, 400));
+        cmc_assert_equals(int32_t, CMC_FLAG_DUPLICATE, ts_flag(set));
+
+        /* Right after and right before the cursor */
+        cmc_assert(ts_iter_go_to(&it, 500));
+        cmc_assert(ts_insert_hint(set, &it, 2002));
+        cmc_assert_equals(size_t, 2002, ts_iter_value(&it));
+        cmc_assert_equals(size_t, 501, ts_iter_index(&it));
+        cmc_assert(ts_insert_hint(set, &it, 2001));
+        cmc_assert_equals(size_t, 2001, ts_iter_value(&it));
+        cmc_assert_equals(size_t, 501, ts_iter_index(&it));
+
+        /* After the last key from anywhere in the set */
+        cmc_assert(ts_iter_to_start(&it));
+
+        for (size_t i = 0; i < 3; i++)
+            cmc_assert(ts_insert_hint(set, &it, 4001 + i));
+
+        cmc_assert_equals(size_t, 1004, ts_iter_index(&it));
+        cmc_assert(!ts_iter_next(&it));
+
+        /* Far from the cursor it falls back to _insert and stays in place */
+        cmc_assert(ts_iter_go_to(&it, 300));
+
+        size_t key = ts_iter_value(&it);
+
+        cmc_assert(ts_insert_hint(set, &it, 9));
+        cmc_assert(ts_insert_hint(set, &it, 3001));
+        cmc_assert_equals(size_t, key, ts_iter_value(&it));
+        cmc_assert_equals(size_t, 301, ts_iter_index(&it));
+
+        cmc_assert_equals(size_t, 1007, ts_count(set));
+
+        size_t index = 0;
+        size_t prev = 0;
+
+        for (it = ts_iter_start(set); !ts_iter_at_end(&it); ts_iter_next(&it))
+        {
+            cmc_assert(index == 0 || prev < ts_iter_value(&it));
+            cmc_assert(ts_contains(set, ts_iter_value(&it)));
+            prev = ts_iter_value(&it);
+            index++;
+        }
+
+        cmc_assert_equals(size_t, 1007, index);
+
+        ts_free(set);
+
+        set = ts_new(ts_fval);
+
+        cmc_assert_not_equals(ptr, NULL, set);
+
+        it = ts_iter_start(set);
+
+        cmc_assert(ts_insert_hint(set, &it, 5));
+        cmc_assert_equals(size_t, 5, ts_iter_value(&it));
+        cmc_assert(ts_insert_hint(set, &it, 4));
+        cmc_assert_equals(size_t, 0, ts_iter_index(&it));
+        cmc_assert_equals(size_t, 2, ts_count(set));
+
+        ts_free(set);
+    });
 });
 
 #ifdef CMC_TEST_MAIN
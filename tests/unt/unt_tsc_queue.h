@@ -0,0 +1,277 @@
+#ifndef CMC_TESTS_UNT_TSC_QUEUE_H
+#define CMC_TESTS_UNT_TSC_QUEUE_H
+
+#include "utl.h"
+
+#include "tst_tsc_queue.h"
+
+#include "utl_thread.h"
+
+struct tsc_queue_fval *tq_fval = &(struct tsc_queue_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+/* Each producer enqueues the numbers from 1 to 10000 */
+int tq_producer(void *args)
+{
+    struct tsc_queue *q = args;
+
+    for (size_t i = 1; i <= 10000; i++)
+    {
+        if (!tq_enqueue_wait(q, i))
+            return 1;
+    }
+
+    return 0;
+}
+
+struct tq_consumer_args
+{
+    struct tsc_queue *q;
+    size_t sum;
+};
+
+/* Each consumer dequeues 20000 elements and sums them up */
+int tq_consumer(void *args)
+{
+    struct tq_consumer_args *c = args;
+    struct tsc_queue *q = c->q;
+
+    size_t buffer[64];
+    size_t total = 0;
+
+    c->sum = 0;
+
+    while (total < 20000)
+    {
+        size_t max = 20000 - total < 64 ? 20000 - total : 64;
+        size_t n = tq_dequeue_wait_many(q, buffer, max);
+
+        if (n == 0)
+            return 1;
+
+        for (size_t i = 0; i < n; i++)
+            c->sum += buffer[i];
+
+        total += n;
+    }
+
+    return 0;
+}
+
+CMC_CREATE_UNIT(TSCQueue, true, {
+    CMC_CREATE_TEST(new, {
+        struct tsc_queue *q = tq_new(1000000, tq_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+        cmc_assert_not_equals(ptr, NULL, q->buffer);
+        cmc_assert_equals(size_t, 1000000, tq_capacity(q));
+        cmc_assert_equals(size_t, 0, tq_count(q));
+        cmc_assert(tq_empty(q));
+
+        tq_free(q);
+    });
+
+    CMC_CREATE_TEST(new[capacity = 0], {
+        struct tsc_queue *q = tq_new(0, tq_fval);
+
+        cmc_assert_equals(ptr, NULL, q);
+    });
+
+    CMC_CREATE_TEST(new[capacity = UINT64_MAX], {
+        struct tsc_queue *q = tq_new(UINT64_MAX, tq_fval);
+
+        cmc_assert_equals(ptr, NULL, q);
+    });
+
+    CMC_CREATE_TEST(clear[count capacity], {
+        struct tsc_queue *q = tq_new(100, tq_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        for (size_t i = 0; i < 50; i++)
+            cmc_assert(tq_enqueue(q, i));
+
+        cmc_assert_equals(size_t, 50, tq_count(q));
+
+        cmc_assert(tq_clear(q));
+
+        cmc_assert_equals(size_t, 0, tq_count(q));
+        cmc_assert_equals(size_t, 100, tq_capacity(q));
+
+        tq_free(q);
+    });
+
+    CMC_CREATE_TEST(enqueue[full], {
+        struct tsc_queue *q = tq_new(10, tq_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(tq_enqueue(q, i));
+
+        cmc_assert(tq_full(q));
+        cmc_assert(!tq_enqueue(q, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_FULL, tq_flag(q));
+        cmc_assert_equals(size_t, 10, tq_count(q));
+
+        tq_free(q);
+    });
+
+    CMC_CREATE_TEST(dequeue[item preservation], {
+        struct tsc_queue *q = tq_new(7, tq_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        size_t value = 0;
+
+        /* Wraps around the circular buffer a few times */
+        for (size_t i = 1; i <= 100; i++)
+        {
+            cmc_assert(tq_enqueue(q, i));
+            cmc_assert(tq_dequeue(q, &value));
+            cmc_assert_equals(size_t, i, value);
+        }
+
+        cmc_assert(!tq_dequeue(q, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tq_flag(q));
+
+        tq_free(q);
+    });
+
+    CMC_CREATE_TEST(dequeue[invalid], {
+        struct tsc_queue *q = tq_new(7, tq_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        cmc_assert(tq_enqueue(q, 1));
+        cmc_assert(!tq_dequeue(q, NULL));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, tq_flag(q));
+        cmc_assert_equals(size_t, 1, tq_count(q));
+
+        tq_free(q);
+    });
+
+    CMC_CREATE_TEST(dequeue_many[wrap around], {
+        struct tsc_queue *q = tq_new(10, tq_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        size_t buffer[10];
+
+        for (size_t i = 0; i < 6; i++)
+            cmc_assert(tq_enqueue(q, i));
+
+        cmc_assert_equals(size_t, 6, tq_dequeue_many(q, buffer, 6));
+
+        /* front is now at 6 so the next 10 elements wrap around */
+        for (size_t i = 0; i < 10; i++)
+            cmc_assert(tq_enqueue(q, i));
+
+        cmc_assert_equals(size_t, 4, tq_dequeue_many(q, buffer, 4));
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert_equals(size_t, i, buffer[i]);
+
+        cmc_assert_equals(size_t, 6, tq_dequeue_many(q, buffer, 10));
+
+        for (size_t i = 0; i < 6; i++)
+            cmc_assert_equals(size_t, i + 4, buffer[i]);
+
+        cmc_assert_equals(size_t, 0, tq_dequeue_many(q, buffer, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tq_flag(q));
+
+        tq_free(q);
+    });
+
+    CMC_CREATE_TEST(enqueue_timed[full], {
+        struct tsc_queue *q = tq_new(1, tq_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        cmc_assert(tq_enqueue_timed(q, 1, 10));
+        cmc_assert(!tq_enqueue_timed(q, 2, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_FULL, tq_flag(q));
+        cmc_assert_equals(size_t, 1, tq_count(q));
+
+        tq_free(q);
+    });
+
+    CMC_CREATE_TEST(dequeue_timed[empty], {
+        struct tsc_queue *q = tq_new(1, tq_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        size_t value = 0;
+        size_t buffer[4];
+
+        cmc_assert(!tq_dequeue_timed(q, &value, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tq_flag(q));
+
+        cmc_assert_equals(size_t, 0, tq_dequeue_timed_many(q, buffer, 4, 10));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tq_flag(q));
+
+        cmc_assert(tq_enqueue(q, 5));
+        cmc_assert(tq_dequeue_timed(q, &value, 10));
+        cmc_assert_equals(size_t, 5, value);
+
+        tq_free(q);
+    });
+
+    CMC_CREATE_TEST(threads[producers consumers], {
+        struct tsc_queue *q = tq_new(16, tq_fval);
+
+        cmc_assert_not_equals(ptr, NULL, q);
+
+        struct cmc_thread producers[4];
+        struct cmc_thread consumers[2];
+        struct tq_consumer_args args[2];
+
+        for (size_t i = 0; i < 2; i++)
+        {
+            args[i].q = q;
+            cmc_assert(cmc_thrd_create(&consumers[i], tq_consumer, &args[i]));
+        }
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert(cmc_thrd_create(&producers[i], tq_producer, q));
+
+        int result = -1;
+
+        for (size_t i = 0; i < 4; i++)
+        {
+            cmc_assert(cmc_thrd_join(&producers[i], &result));
+            cmc_assert_equals(int32_t, 0, result);
+        }
+
+        for (size_t i = 0; i < 2; i++)
+        {
+            cmc_assert(cmc_thrd_join(&consumers[i], &result));
+            cmc_assert_equals(int32_t, 0, result);
+        }
+
+        cmc_assert_equals(size_t, 200020000, args[0].sum + args[1].sum);
+        cmc_assert(tq_empty(q));
+        cmc_assert_equals(size_t, 0, q->producers);
+        cmc_assert_equals(size_t, 0, q->consumers);
+
+        tq_free(q);
+    });
+});
+
+#ifdef CMC_TEST_MAIN
+int main(void)
+{
+    int result = TSCQueue();
+
+    printf(" +---------------------------------------------------------------+");
+    printf("\n");
+    printf(" | TSCQueue Suit : %-48s |\n", result == 0 ? "PASSED" : "FAILED");
+    printf(" +---------------------------------------------------------------+");
+    printf("\n\n\n");
+
+    return result;
+}
+#endif
+
+#endif /* CMC_TESTS_UNT_TSC_QUEUE_H */
@@ -0,0 +1,259 @@
+#ifndef CMC_TESTS_UNT_TSC_STACK_H
+#define CMC_TESTS_UNT_TSC_STACK_H
+
+#include "utl.h"
+
+#include "tst_tsc_stack.h"
+
+#include "utl_thread.h"
+
+struct tsc_stack_fval *tsk_fval = &(struct tsc_stack_fval){
+    .cmp = cmc_size_cmp, .cpy = NULL, .str = cmc_size_str, .free = NULL, .hash = cmc_size_hash, .pri = cmc_size_cmp
+};
+
+/* Takes objects from a shared pool and gives them back, many times */
+int tsk_pool_worker(void *args)
+{
+    struct tsc_stack *pool = args;
+
+    for (size_t i = 0; i < 100000; i++)
+    {
+        size_t value;
+
+        if (tsk_pop(pool, &value))
+        {
+            if (!tsk_push(pool, value))
+                return 1;
+        }
+
+        struct tsc_stack_node *node = tsk_pop_node(pool);
+
+        if (node && !tsk_push_node(pool, node))
+            return 1;
+    }
+
+    return 0;
+}
+
+CMC_CREATE_UNIT(TSCStack, true, {
+    CMC_CREATE_TEST(new, {
+        struct tsc_stack *s = tsk_new(1000000, tsk_fval);
+
+        cmc_assert_not_equals(ptr, NULL, s);
+        cmc_assert_not_equals(ptr, NULL, s->buffer);
+        cmc_assert_equals(size_t, 1000000, tsk_capacity(s));
+        cmc_assert_equals(size_t, 0, tsk_count(s));
+        cmc_assert(tsk_empty(s));
+        cmc_assert(!tsk_full(s));
+
+        tsk_free(s);
+    });
+
+    CMC_CREATE_TEST(new[capacity = 0], {
+        struct tsc_stack *s = tsk_new(0, tsk_fval);
+
+        cmc_assert_equals(ptr, NULL, s);
+    });
+
+    CMC_CREATE_TEST(new[capacity = UINT32_MAX], {
+        struct tsc_stack *s = tsk_new(UINT32_MAX, tsk_fval);
+
+        cmc_assert_equals(ptr, NULL, s);
+    });
+
+    CMC_CREATE_TEST(push[full], {
+        struct tsc_stack *s = tsk_new(100, tsk_fval);
+
+        cmc_assert_not_equals(ptr, NULL, s);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(tsk_push(s, i));
+
+        cmc_assert(tsk_full(s));
+        cmc_assert_equals(size_t, 100, tsk_count(s));
+
+        cmc_assert(!tsk_push(s, 100));
+        cmc_assert_equals(int32_t, CMC_FLAG_FULL, tsk_flag(s));
+
+        tsk_free(s);
+    });
+
+    CMC_CREATE_TEST(pop[item preservation], {
+        struct tsc_stack *s = tsk_new(100, tsk_fval);
+
+        cmc_assert_not_equals(ptr, NULL, s);
+
+        for (size_t i = 0; i < 100; i++)
+            cmc_assert(tsk_push(s, i));
+
+        size_t value;
+
+        for (size_t i = 100; i > 0; i--)
+        {
+            cmc_assert(tsk_pop(s, &value));
+            cmc_assert_equals(size_t, i - 1, value);
+        }
+
+        cmc_assert(tsk_empty(s));
+        cmc_assert(!tsk_pop(s, &value));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tsk_flag(s));
+
+        tsk_free(s);
+    });
+
+    CMC_CREATE_TEST(push_many[item preservation], {
+        struct tsc_stack *s = tsk_new(10, tsk_fval);
+
+        cmc_assert_not_equals(ptr, NULL, s);
+
+        size_t values[6];
+
+        for (size_t i = 0; i < 6; i++)
+            values[i] = i + 1;
+
+        cmc_assert(tsk_push(s, 0));
+        cmc_assert(tsk_push_many(s, values, 6));
+        cmc_assert_equals(size_t, 7, tsk_count(s));
+
+        size_t value;
+
+        for (size_t i = 7; i > 0; i--)
+        {
+            cmc_assert(tsk_pop(s, &value));
+            cmc_assert_equals(size_t, i - 1, value);
+        }
+
+        tsk_free(s);
+    });
+
+    CMC_CREATE_TEST(push_many[full], {
+        struct tsc_stack *s = tsk_new(10, tsk_fval);
+
+        cmc_assert_not_equals(ptr, NULL, s);
+
+        size_t values[6];
+
+        for (size_t i = 0; i < 6; i++)
+            values[i] = i + 1;
+
+        cmc_assert(tsk_push_many(s, values, 6));
+        cmc_assert(!tsk_push_many(s, values, 6));
+        cmc_assert_equals(int32_t, CMC_FLAG_FULL, tsk_flag(s));
+        cmc_assert_equals(size_t, 6, tsk_count(s));
+
+        /* The free nodes taken by the failed call were given back */
+        cmc_assert(tsk_push_many(s, values, 4));
+        cmc_assert(tsk_full(s));
+
+        tsk_free(s);
+    });
+
+    CMC_CREATE_TEST(node[in place], {
+        struct tsc_stack *s = tsk_new(2, tsk_fval);
+
+        cmc_assert_not_equals(ptr, NULL, s);
+
+        struct tsc_stack_node *node = tsk_new_node(s, 10);
+
+        cmc_assert_not_equals(ptr, NULL, node);
+        cmc_assert(tsk_push_node(s, node));
+
+        node = tsk_pop_node(s);
+
+        cmc_assert_not_equals(ptr, NULL, node);
+        cmc_assert_equals(size_t, 10, node->value);
+        cmc_assert(tsk_empty(s));
+
+        node->value += 5;
+
+        cmc_assert(tsk_push_node(s, node));
+
+        size_t value;
+        cmc_assert(tsk_pop(s, &value));
+        cmc_assert_equals(size_t, 15, value);
+
+        cmc_assert_equals(ptr, NULL, tsk_pop_node(s));
+        cmc_assert_equals(int32_t, CMC_FLAG_EMPTY, tsk_flag(s));
+
+        node = tsk_new_node(s, 1);
+        cmc_assert_not_equals(ptr, NULL, node);
+
+        struct tsc_stack_node *other = tsk_new_node(s, 2);
+        cmc_assert_not_equals(ptr, NULL, other);
+
+        other = tsk_new_node(s, 3);
+        cmc_assert_equals(ptr, NULL, other);
+        cmc_assert_equals(int32_t, CMC_FLAG_FULL, tsk_flag(s));
+
+        struct tsc_stack_node outside = { 0 };
+
+        tsk_free_node(s, &outside);
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, tsk_flag(s));
+        cmc_assert(!tsk_push_node(s, &outside));
+        cmc_assert_equals(int32_t, CMC_FLAG_INVALID, tsk_flag(s));
+
+        other = tsk_new_node(s, 3);
+        cmc_assert_equals(ptr, NULL, other);
+
+        tsk_free_node(s, node);
+        cmc_assert_equals(int32_t, CMC_FLAG_OK, tsk_flag(s));
+
+        other = tsk_new_node(s, 3);
+        cmc_assert_not_equals(ptr, NULL, other);
+
+        tsk_free(s);
+    });
+
+    CMC_CREATE_TEST(threads[object pool], {
+        struct tsc_stack *s = tsk_new(8, tsk_fval);
+
+        cmc_assert_not_equals(ptr, NULL, s);
+
+        for (size_t i = 1; i <= 8; i++)
+            cmc_assert(tsk_push(s, i));
+
+        struct cmc_thread threads[4];
+
+        for (size_t i = 0; i < 4; i++)
+            cmc_assert(cmc_thrd_create(&threads[i], tsk_pool_worker, s));
+
+        int result = -1;
+
+        for (size_t i = 0; i < 4; i++)
+        {
+            cmc_assert(cmc_thrd_join(&threads[i], &result));
+            cmc_assert_equals(int32_t, 0, result);
+        }
+
+        /* No object was lost or duplicated */
+        size_t value;
+        size_t sum = 0;
+
+        cmc_assert_equals(size_t, 8, tsk_count(s));
+
+        while (tsk_pop(s, &value))
+            sum += value;
+
+        cmc_assert_equals(size_t, 36, sum);
+        cmc_assert(tsk_empty(s));
+
+        tsk_free(s);
+    });
+});
+
+#ifdef CMC_TEST_MAIN
+int main(void)
+{
+    int result = TSCStack();
+
+    printf(" +---------------------------------------------------------------+");
+    printf("\n");
+    printf(" | TSCStack Suit : %-48s |\n", result == 0 ? "PASSED" : "FAILED");
+    printf(" +---------------------------------------------------------------+");
+    printf("\n\n\n");
+
+    return result;
+}
+#endif
+
+#endif /* CMC_TESTS_UNT_TSC_STACK_H */